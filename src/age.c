@@ -0,0 +1,4013 @@
+/* Unicode Age
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the DerivedAge.txt file in
+ * the Unicode Character database by the ucd-tools/tools/age.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+#define V1_1 UCD_AGE_V1_1
+#define V2_0 UCD_AGE_V2_0
+#define V2_1 UCD_AGE_V2_1
+#define V3_0 UCD_AGE_V3_0
+#define V3_1 UCD_AGE_V3_1
+#define V3_2 UCD_AGE_V3_2
+#define V4_0 UCD_AGE_V4_0
+#define V4_1 UCD_AGE_V4_1
+#define V5_0 UCD_AGE_V5_0
+#define V5_1 UCD_AGE_V5_1
+#define V5_2 UCD_AGE_V5_2
+#define V6_0 UCD_AGE_V6_0
+#define V6_1 UCD_AGE_V6_1
+#define V6_2 UCD_AGE_V6_2
+#define V6_3 UCD_AGE_V6_3
+#define V7_0 UCD_AGE_V7_0
+#define V8_0 UCD_AGE_V8_0
+#define V9_0 UCD_AGE_V9_0
+#define V10_0 UCD_AGE_V10_0
+#define V11_0 UCD_AGE_V11_0
+#define V12_0 UCD_AGE_V12_0
+#define NA UCD_AGE_NA
+
+/* Unicode Character Data 12.0.0 */
+
+static const uint8_t ages_V1_1[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+};
+
+static const uint8_t ages_V3_0[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 60 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 70 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* C0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* D0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* E0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* F0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+};
+
+static const uint8_t ages_V3_2[256] =
+{
+	/* 00 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 10 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 20 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 30 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 40 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 50 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 60 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 70 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 80 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 90 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* A0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* B0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* C0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* D0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* E0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* F0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+};
+
+static const uint8_t ages_V5_1[256] =
+{
+	/* 00 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 10 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 20 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 30 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 40 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 50 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 60 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 70 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 80 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 90 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* A0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* B0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* C0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* D0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* E0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* F0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+};
+
+static const uint8_t ages_V2_0[256] =
+{
+	/* 00 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 10 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 20 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 30 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 40 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 50 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 60 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 70 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 80 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 90 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* A0 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* B0 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* C0 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* D0 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* E0 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* F0 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+};
+
+static const uint8_t ages_V7_0[256] =
+{
+	/* 00 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 10 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+};
+
+static const uint8_t ages_NA[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_V5_0[256] =
+{
+	/* 00 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 10 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 20 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 30 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 40 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 50 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 60 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 70 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 80 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 90 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* A0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* B0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* C0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* D0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* E0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* F0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+};
+
+static const uint8_t ages_V5_2[256] =
+{
+	/* 00 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 10 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 20 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 30 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 40 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 50 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 60 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 70 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 80 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 90 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* A0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* B0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* C0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* D0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* E0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* F0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+};
+
+static const uint8_t ages_V8_0[256] =
+{
+	/* 00 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 10 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 20 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 30 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 40 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 50 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 60 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 70 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 80 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 90 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* A0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* B0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* C0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* D0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* E0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* F0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+};
+
+static const uint8_t ages_V6_0[256] =
+{
+	/* 00 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 10 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 20 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 30 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 40 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 50 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 60 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 70 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 80 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 90 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* A0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* B0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* C0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* D0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* E0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* F0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+};
+
+static const uint8_t ages_V9_0[256] =
+{
+	/* 00 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 10 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 20 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 30 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 40 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 50 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 60 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 70 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 80 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 90 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* A0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* B0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* C0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* D0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* E0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* F0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+};
+
+static const uint8_t ages_V3_1[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 50 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 60 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 70 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 80 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 90 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* A0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* B0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* C0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* D0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* E0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* F0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+};
+
+static const uint8_t ages_V10_0[256] =
+{
+	/* 00 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 10 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 20 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 30 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 40 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 50 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 60 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 70 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 80 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 90 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* A0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* B0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* C0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* D0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* E0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* F0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+};
+
+static const uint8_t ages_000100[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V3_0, V3_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+};
+
+static const uint8_t ages_000200[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_2, V4_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V4_0, V4_0, V4_0, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 40 */ V4_1, V4_1, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V3_0, V3_0, V3_0, V4_0, V4_0,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V3_0, V3_0, V3_0, V4_0,
+	/* F0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+};
+
+static const uint8_t ages_000300[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_2,
+	/* 50 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_1, V4_1, V4_1, V4_1, V4_1, V4_0, V4_0, V4_0,
+	/* 60 */ V1_1, V1_1, V3_0, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 70 */ V5_1, V5_1, V5_1, V5_1, V1_1, V1_1, V5_1, V5_1, NA, NA, V1_1, V5_0, V5_0, V5_0, V1_1, V7_0,
+	/* 80 */ NA, NA, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, NA, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_2, V3_2, V1_1, V3_0, V1_1, V3_0, V1_1, V3_0,
+	/* E0 */ V1_1, V3_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V3_1, V3_1, V3_2, V4_0, V4_0, V4_0, V4_0, V4_0, V4_1, V4_1, V4_1, V4_1,
+};
+
+static const uint8_t ages_000400[256] =
+{
+	/* 00 */ V3_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V3_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_1, V3_0, V3_0, V3_2, V3_2, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V3_2, V1_1, V1_1, V3_2, V3_2, V1_1, V1_1, V3_2, V3_2, V5_0,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_1, V4_1, V1_1, V1_1, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+};
+
+static const uint8_t ages_000500[256] =
+{
+	/* 00 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 10 */ V5_0, V5_0, V5_0, V5_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 20 */ V5_1, V5_1, V5_1, V5_1, V5_2, V5_2, V6_0, V6_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V11_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V11_0, V1_1, V3_0, NA, NA, V7_0, V7_0, V6_1,
+	/* 90 */ NA, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* A0 */ V2_0, V2_0, V4_1, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_0, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V2_0, V4_1, V4_1, V4_1, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA, V11_0,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_000600[256] =
+{
+	/* 00 */ V4_0, V4_0, V4_0, V4_0, V6_1, V7_0, V5_1, V5_1, V5_1, V5_1, V5_1, V4_1, V1_1, V4_0, V4_0, V4_0,
+	/* 10 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V5_1, V5_1, V5_1, V5_1, V5_1, V1_1, V6_3, NA, V4_1, V1_1,
+	/* 20 */ V6_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V3_0, V3_0, V3_0, V4_0, V4_0, V4_0, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V6_0,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V3_2,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_0, V4_0,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V3_0, V3_0, V3_0, V4_0,
+};
+
+static const uint8_t ages_000700[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, V3_0,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_0, V4_0, V4_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, V4_0, V4_0, V4_0,
+	/* 50 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 60 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_1, V5_1,
+	/* 70 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_2, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* D0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* E0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* F0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, NA, NA, V11_0, V11_0, V11_0,
+};
+
+static const uint8_t ages_000800[256] =
+{
+	/* 00 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 10 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 20 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA,
+	/* 30 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA,
+	/* 40 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 50 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA, NA, V6_0, NA,
+	/* 60 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ V6_1, V7_0, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V7_0, V7_0, V7_0,
+	/* B0 */ V7_0, V7_0, V7_0, V8_0, V8_0, NA, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, V11_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* E0 */ V9_0, V9_0, V9_0, V8_0, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* F0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V7_0,
+};
+
+static const uint8_t ages_000900[256] =
+{
+	/* 00 */ V5_2, V1_1, V1_1, V1_1, V4_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V6_0, V6_0, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_2, V6_0,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V5_2, V6_0, V6_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V5_1, V5_1, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0, V5_2, V5_2, V5_0, V5_0, V4_1, V5_0, V5_0,
+	/* 80 */ V7_0, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1,
+	/* 90 */ V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, NA, V1_1, NA, NA, NA, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V4_0, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, V4_1, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, V1_1, NA, NA, NA, NA, V1_1, V1_1, NA, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_2, V10_0, V10_0, V11_0, NA,
+};
+
+static const uint8_t ages_000A00[256] =
+{
+	/* 00 */ NA, V4_0, V1_1, V4_0, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA, V1_1,
+	/* 10 */ V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, NA, V1_1, V1_1, NA, V1_1, V1_1, NA, V1_1, V1_1, NA, NA, V1_1, NA, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, NA, NA, NA, NA, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, NA, NA,
+	/* 50 */ NA, V5_1, NA, NA, NA, NA, NA, NA, NA, V1_1, V1_1, V1_1, V1_1, NA, V1_1, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V5_1, V11_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_0, V1_1, NA, V1_1,
+	/* 90 */ V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, NA, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, NA, NA,
+	/* D0 */ V1_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V1_1, V4_0, V4_0, V4_0, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V6_1, V4_0, NA, NA, NA, NA, NA, NA, NA, V8_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+};
+
+static const uint8_t ages_000B00[256] =
+{
+	/* 00 */ NA, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1,
+	/* 10 */ V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, NA, V1_1, V1_1, NA, V4_0, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V5_1, NA, NA, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, V1_1, V1_1, NA, NA, NA, NA, V1_1, V1_1, NA, V1_1,
+	/* 60 */ V1_1, V1_1, V5_1, V5_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V4_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, V1_1, V1_1,
+	/* 90 */ V1_1, NA, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, V1_1, V1_1, NA, V1_1, NA, V1_1, V1_1,
+	/* A0 */ NA, NA, NA, V1_1, V1_1, NA, NA, NA, V1_1, V1_1, V1_1, NA, NA, NA, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_1, V1_1, V1_1, V1_1, NA, NA, NA, NA, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, NA, NA, NA, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, NA, NA,
+	/* D0 */ V5_1, NA, NA, NA, NA, NA, NA, V1_1, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, V4_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_000C00[256] =
+{
+	/* 00 */ V7_0, V1_1, V1_1, V1_1, V11_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1,
+	/* 10 */ V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V7_0, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, V5_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, V1_1, V1_1, NA, V5_1, V5_1, V8_0, NA, NA, NA, NA, NA,
+	/* 60 */ V1_1, V1_1, V5_1, V5_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, V12_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 80 */ V9_0, V7_0, V1_1, V1_1, V11_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1,
+	/* 90 */ V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V4_0, V4_0, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, V1_1, V1_1, NA, NA, NA, NA, NA, NA, NA, V1_1, NA,
+	/* E0 */ V1_1, V1_1, V5_0, V5_0, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ NA, V5_0, V5_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_000D00[256] =
+{
+	/* 00 */ V10_0, V7_0, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1,
+	/* 10 */ V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V6_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V6_0, V10_0, V10_0, V5_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V5_1, NA, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V6_0, V9_0,
+	/* 50 */ NA, NA, NA, NA, V9_0, V9_0, V9_0, V1_1, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V8_0,
+	/* 60 */ V1_1, V1_1, V5_1, V5_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V9_0, V9_0, V9_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 80 */ NA, NA, V3_0, V3_0, NA, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, NA, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, V3_0, NA, NA,
+	/* C0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA, V3_0, NA, NA, NA, NA, V3_0,
+	/* D0 */ V3_0, V3_0, V3_0, V3_0, V3_0, NA, V3_0, NA, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* E0 */ NA, NA, NA, NA, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ NA, NA, V3_0, V3_0, V3_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_000E00[256] =
+{
+	/* 00 */ NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, V1_1, V1_1, NA, V1_1, NA, V12_0, V1_1, V1_1, V12_0, V1_1, NA, V12_0, V1_1, V12_0, V12_0,
+	/* 90 */ V12_0, V12_0, V12_0, V12_0, V1_1, V1_1, V1_1, V1_1, V12_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V12_0, V1_1, V1_1, V1_1, NA, V1_1, NA, V1_1, V12_0, V12_0, V1_1, V1_1, V12_0, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V12_0, V1_1, V1_1, V1_1, NA, NA,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V6_1, V6_1,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_000F00[256] =
+{
+	/* 00 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 10 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 20 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 30 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 40 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, NA, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 50 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 60 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V3_0, V5_1, V5_1, NA, NA, NA,
+	/* 70 */ NA, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 80 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V6_0, V6_0, V6_0, V6_0,
+	/* 90 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V3_0, V2_0, NA, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* A0 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V3_0, V3_0,
+	/* B0 */ V3_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V3_0, V2_0, V3_0, V3_0, V3_0, NA, V3_0, V3_0,
+	/* C0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, V5_1, V3_0,
+	/* D0 */ V4_1, V4_1, V5_1, V5_1, V5_1, V5_2, V5_2, V5_2, V5_2, V6_0, V6_0, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_001000[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_0, V3_0, V5_1, V3_0, V3_0, V3_0, V3_0, V3_0, V5_1, V3_0, V3_0, V5_1, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V5_1, V5_1, V5_1, V3_0, V3_0, V3_0, V3_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 60 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 70 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 80 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 90 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_2, V5_2, V5_2, V5_2, V5_1, V5_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V6_1, NA, NA, NA, NA, NA, V6_1, NA, NA,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V3_2, V4_1, V4_1, V1_1, V4_1, V6_1, V6_1, V6_1,
+};
+
+static const uint8_t ages_001100[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_2, V5_2, V5_2, V5_2, V5_2, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V5_2, V5_2, V5_2, V5_2, V5_2, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+};
+
+static const uint8_t ages_001200[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_1, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_1, V3_0, NA, V3_0, V3_0, V3_0, V3_0, NA, NA,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, V3_0, NA, V3_0, V3_0, V3_0, V3_0, NA, NA,
+	/* 60 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 70 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_1, V3_0, NA, V3_0, V3_0, V3_0, V3_0, NA, NA,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_1,
+	/* B0 */ V3_0, NA, V3_0, V3_0, V3_0, V3_0, NA, NA, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA,
+	/* C0 */ V3_0, NA, V3_0, V3_0, V3_0, V3_0, NA, NA, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_1,
+	/* D0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* E0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_1,
+	/* F0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+};
+
+static const uint8_t ages_001300[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_1,
+	/* 10 */ V3_0, NA, V3_0, V3_0, V3_0, V3_0, NA, NA, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_1,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_1, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, V6_0, V6_0, V4_1,
+	/* 60 */ V4_1, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 70 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA,
+	/* 80 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 90 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA, NA, NA,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* C0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* D0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* E0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* F0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V8_0, NA, NA, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, NA, NA,
+};
+
+static const uint8_t ages_001400[256] =
+{
+	/* 00 */ V5_2, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 60 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 70 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* C0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* D0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* E0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* F0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+};
+
+static const uint8_t ages_001600[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 60 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 70 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* C0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* D0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* E0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* F0 */ V3_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_001700[256] =
+{
+	/* 00 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, NA, V3_2, V3_2,
+	/* 10 */ V3_2, V3_2, V3_2, V3_2, V3_2, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 30 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 50 */ V3_2, V3_2, V3_2, V3_2, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, NA, V3_2, V3_2,
+	/* 70 */ V3_2, NA, V3_2, V3_2, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* C0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* D0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V4_0, NA, NA,
+	/* E0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA, NA, NA, NA,
+	/* F0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_001800[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA, NA, NA, NA,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 60 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 70 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V11_0, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V5_1, NA, NA, NA, NA, NA,
+	/* B0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* C0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* D0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* E0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* F0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_001900[256] =
+{
+	/* 00 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 10 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V7_0, V7_0, NA,
+	/* 20 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA, NA, NA,
+	/* 30 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA, NA, NA,
+	/* 40 */ V4_0, NA, NA, NA, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 50 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 60 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA,
+	/* 70 */ V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 90 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* A0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_2, V5_2, NA, NA, NA, NA,
+	/* B0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* C0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA, NA, NA,
+	/* D0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_2, NA, NA, NA, V4_1, V4_1,
+	/* E0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* F0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+};
+
+static const uint8_t ages_001A00[256] =
+{
+	/* 00 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, V4_1, V4_1,
+	/* 20 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 30 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 40 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 50 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA,
+	/* 60 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 70 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, V5_2,
+	/* 80 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA,
+	/* 90 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA,
+	/* A0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_001B00[256] =
+{
+	/* 00 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 10 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 20 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 30 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 40 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, NA, NA, NA, NA,
+	/* 50 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 60 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 70 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, NA, NA, NA,
+	/* 80 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 90 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* A0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V6_1, V6_1, V6_1, V5_1, V5_1,
+	/* B0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* C0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* D0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* E0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* F0 */ V6_0, V6_0, V6_0, V6_0, NA, NA, NA, NA, NA, NA, NA, NA, V6_0, V6_0, V6_0, V6_0,
+};
+
+static const uint8_t ages_001C00[256] =
+{
+	/* 00 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 10 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 20 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 30 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, NA, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 40 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, NA, V5_1, V5_1, V5_1,
+	/* 50 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 60 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 70 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 80 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* A0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* B0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, V11_0, V11_0, V11_0,
+	/* C0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* E0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* F0 */ V5_2, V5_2, V5_2, V6_1, V6_1, V6_1, V6_1, V10_0, V7_0, V7_0, V12_0, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_001D00[256] =
+{
+	/* 00 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 10 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 20 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 30 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 40 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 50 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 60 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_1, V4_1, V4_1, V4_1,
+	/* 70 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 80 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 90 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* A0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* B0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* C0 */ V4_1, V4_1, V4_1, V4_1, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* D0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* E0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V10_0, V10_0, V10_0, V10_0, NA, V9_0, V6_0, V5_2, V5_0, V5_0,
+};
+
+static const uint8_t ages_001E00[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V2_0, V5_1, V5_1, V5_1, V5_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+};
+
+static const uint8_t ages_001F00[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, NA, V1_1, NA, V1_1, NA, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ NA, NA, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA,
+};
+
+static const uint8_t ages_002000[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_2, V3_2,
+	/* 50 */ V3_2, V3_2, V3_2, V4_0, V4_0, V4_1, V4_1, V3_2, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V3_2,
+	/* 60 */ V3_2, V3_2, V3_2, V3_2, V5_1, NA, V6_3, V6_3, V6_3, V6_3, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V3_2, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA,
+	/* 90 */ V4_1, V4_1, V4_1, V4_1, V4_1, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA, NA, NA,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V2_0, V2_1, V3_0, V3_0, V3_0,
+	/* B0 */ V3_2, V3_2, V4_1, V4_1, V4_1, V4_1, V5_2, V5_2, V5_2, V6_0, V6_2, V7_0, V7_0, V7_0, V8_0, V10_0,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V3_0, V3_0, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V4_1, V5_0, V5_0, V5_0, V5_0,
+	/* F0 */ V5_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_002100[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V4_0, V4_1, V3_2, V3_2, V3_2,
+	/* 40 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V4_1, V5_0, V5_0, V5_1,
+	/* 50 */ V5_2, V5_2, V5_2, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V3_0, V5_0, V5_1, V5_1, V5_1, V5_1, V5_2, V8_0, V8_0, NA, NA, NA, NA,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* F0 */ V3_0, V3_0, V3_0, V3_0, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+};
+
+static const uint8_t ages_002200[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+};
+
+static const uint8_t ages_002300[256] =
+{
+	/* 00 */ V1_1, V3_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_2, V3_0, V3_0, V3_0,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* A0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* B0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* C0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V4_0,
+	/* D0 */ V4_0, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_0, V5_0, V5_0, V5_0,
+	/* E0 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_2, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* F0 */ V6_0, V6_0, V6_0, V6_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V9_0, V9_0, V9_0, V9_0, V10_0,
+};
+
+static const uint8_t ages_002400[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* F0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V4_0,
+};
+
+static const uint8_t ages_002500[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+};
+
+static const uint8_t ages_002600[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V4_0, V4_0, V3_2, V3_2, V4_1, V3_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V3_0, V3_0, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V4_1, V4_1,
+	/* 80 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 90 */ V4_0, V4_0, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_1, V5_2, V5_2,
+	/* A0 */ V4_0, V4_0, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* B0 */ V4_1, V4_1, V5_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_2, V5_2, V5_2,
+	/* C0 */ V5_1, V5_1, V5_1, V5_1, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V6_0, V5_2,
+	/* D0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* E0 */ V5_2, V5_2, V6_0, V5_2, V6_0, V6_0, V6_0, V6_0, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* F0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+};
+
+static const uint8_t ages_002700[256] =
+{
+	/* 00 */ V7_0, V1_1, V1_1, V1_1, V1_1, V6_0, V1_1, V1_1, V1_1, V1_1, V6_0, V6_0, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V6_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V6_0, V1_1, V6_0, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V6_0, V6_0, V6_0, V1_1, V5_2, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V6_0,
+	/* 60 */ V6_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 70 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V6_0, V6_0, V6_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V6_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V6_0,
+	/* C0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_0, V5_0, V5_0, V5_0, V6_1, V5_1, V6_1, V6_0, V6_0,
+	/* D0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* E0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V5_1, V5_1, V5_1, V5_1,
+	/* F0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+};
+
+static const uint8_t ages_002B00[256] =
+{
+	/* 00 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_1, V4_1,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 20 */ V5_0, V5_0, V5_0, V5_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 30 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 40 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V7_0, V7_0, V7_0,
+	/* 50 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_2, V5_2, V5_2, V5_2, V5_2, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V11_0, V11_0, V11_0, V7_0, V7_0, V7_0,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V12_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V7_0, V7_0, V10_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* E0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V8_0, V8_0, V8_0, V8_0,
+	/* F0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V12_0,
+};
+
+static const uint8_t ages_002C00[256] =
+{
+	/* 00 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 20 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA,
+	/* 30 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 40 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 50 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA,
+	/* 60 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_1, V5_1, V5_1,
+	/* 70 */ V5_2, V5_1, V5_1, V5_1, V5_0, V5_0, V5_0, V5_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_2, V5_2,
+	/* 80 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 90 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* A0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* B0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* C0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* D0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* E0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* F0 */ V5_2, V5_2, V6_1, V6_1, NA, NA, NA, NA, NA, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+};
+
+static const uint8_t ages_002D00[256] =
+{
+	/* 00 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 20 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, V6_1, NA, NA, NA, NA, NA, V6_1, NA, NA,
+	/* 30 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 40 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 50 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 60 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V6_1, V6_1, NA, NA, NA, NA, NA, NA, NA, V4_1,
+	/* 70 */ V6_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V6_0,
+	/* 80 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 90 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA,
+	/* B0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA,
+	/* C0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA,
+	/* D0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA,
+	/* E0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* F0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+};
+
+static const uint8_t ages_002E00[256] =
+{
+	/* 00 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_1, V5_1, V5_1, V5_1, V4_1, V4_1, V5_1, V5_1,
+	/* 20 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 30 */ V5_1, V5_2, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V9_0, V9_0, V10_0, V10_0, V10_0, V10_0, V10_0, V11_0, V11_0, V11_0, V11_0, V11_0, V12_0,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* C0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* D0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* E0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* F0 */ V3_0, V3_0, V3_0, V3_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_002F00[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 60 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 70 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* C0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* D0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_003000[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_0, V3_0, V3_0, V3_2, V3_2, V3_2, V3_0, V1_1,
+	/* 40 */ NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V3_2, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2,
+	/* A0 */ V3_2, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2,
+};
+
+static const uint8_t ages_003100[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V5_1, V10_0, V11_0,
+	/* 30 */ NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V6_0, V6_0, V6_0, NA, NA, NA, NA, NA,
+	/* C0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* D0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* E0 */ V5_1, V5_1, V5_1, V5_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+};
+
+static const uint8_t ages_003200[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_0, V4_0, NA,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 50 */ V4_0, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_0, V4_0, V4_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_0, V4_0, V4_0, V4_0,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA,
+};
+
+static const uint8_t ages_003300[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_0, V4_0, V4_0, V4_0, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_0, V4_0,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_0,
+};
+
+static const uint8_t ages_004D00[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 60 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 70 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* D0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* E0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* F0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+};
+
+static const uint8_t ages_009F00[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* B0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_1, V5_1, V5_1, V5_1,
+	/* C0 */ V5_1, V5_1, V5_1, V5_1, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V6_1, V8_0, V8_0, V8_0,
+	/* D0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* E0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_00A400[256] =
+{
+	/* 00 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 10 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 20 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 30 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 40 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 50 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 60 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 70 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* 80 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, NA, NA, NA,
+	/* 90 */ V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* A0 */ V3_0, V3_0, V3_2, V3_2, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* B0 */ V3_0, V3_0, V3_0, V3_0, V3_2, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0, V3_0,
+	/* C0 */ V3_0, V3_2, V3_0, V3_0, V3_0, V3_2, V3_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* E0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* F0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+};
+
+static const uint8_t ages_00A600[256] =
+{
+	/* 00 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 10 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 20 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 50 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 60 */ V6_0, V6_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 70 */ V5_1, V5_1, V5_1, V5_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V5_1, V5_1, V5_1, V5_1,
+	/* 80 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 90 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V8_0, V6_1,
+	/* A0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* B0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* C0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* D0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* E0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* F0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_00A700[256] =
+{
+	/* 00 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V5_0, V5_0, V5_0, V5_0, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 20 */ V5_0, V5_0, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 30 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 40 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 50 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 60 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 70 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 80 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V6_0, V6_0, V8_0,
+	/* 90 */ V6_0, V6_0, V6_1, V6_1, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_1, V7_0, V7_0, V7_0, V9_0, V11_0,
+	/* B0 */ V7_0, V7_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V11_0, V11_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* C0 */ NA, NA, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, V7_0, V6_1, V6_1, V6_0, V5_1, V5_1, V5_1, V5_1, V5_1,
+};
+
+static const uint8_t ages_00A800[256] =
+{
+	/* 00 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 20 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA,
+	/* 30 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA,
+	/* 40 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 50 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 60 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 70 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 90 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* A0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* B0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* C0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V9_0, NA, NA, NA, NA, NA, NA, NA, NA, V5_1, V5_1,
+	/* D0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* F0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V8_0, V8_0, V11_0, V11_0,
+};
+
+static const uint8_t ages_00A900[256] =
+{
+	/* 00 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 10 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 20 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 30 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 40 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 50 */ V5_1, V5_1, V5_1, V5_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V5_1,
+	/* 60 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 70 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA,
+	/* 80 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 90 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* A0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* B0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* C0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, V5_2,
+	/* D0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, V5_2, V5_2,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA,
+};
+
+static const uint8_t ages_00AA00[256] =
+{
+	/* 00 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 10 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 20 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 30 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA,
+	/* 50 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, V5_1, V5_1, V5_1, V5_1,
+	/* 60 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 70 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V7_0, V7_0, V7_0, V7_0,
+	/* 80 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 90 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* A0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* B0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* C0 */ V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* E0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* F0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_00AB00[256] =
+{
+	/* 00 */ NA, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA, NA, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA,
+	/* 10 */ NA, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V8_0, V8_0, V8_0, V8_0, V7_0, V7_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 80 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 90 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* A0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* B0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* C0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* D0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* E0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA,
+	/* F0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_00D700[256] =
+{
+	/* 00 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 10 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 20 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 30 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 40 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 50 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 60 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 70 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 80 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* 90 */ V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0, V2_0,
+	/* A0 */ V2_0, V2_0, V2_0, V2_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* C0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* D0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* E0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* F0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_00FA00[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V6_1, V6_1,
+	/* 30 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 40 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 50 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 60 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V5_2, V5_2, V5_2, NA, NA,
+	/* 70 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 80 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 90 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* A0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* B0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* C0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* D0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_00FB00[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA, NA, V3_0, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, NA,
+	/* 40 */ V1_1, V1_1, NA, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* C0 */ V6_0, V6_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+};
+
+static const uint8_t ages_00FD00[256] =
+{
+	/* 00 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* E0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V4_0, NA, NA,
+};
+
+static const uint8_t ages_00FE00[256] =
+{
+	/* 00 */ V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2, V3_2,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA, NA, NA,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V5_1, V5_1, V5_1, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V8_0, V8_0,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V3_2, V3_2, V4_0, V4_0, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 60 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, NA, NA, NA, NA,
+	/* 70 */ V1_1, V1_1, V1_1, V3_2, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* C0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* F0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1,
+};
+
+static const uint8_t ages_00FF00[256] =
+{
+	/* 00 */ NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 10 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 20 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 30 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 40 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 50 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V3_2,
+	/* 60 */ V3_2, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 70 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 80 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* 90 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* A0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* B0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA,
+	/* C0 */ NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1,
+	/* D0 */ NA, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, NA, V1_1, V1_1, V1_1, NA, NA, NA,
+	/* E0 */ V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, V1_1, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, V3_0, V3_0, V3_0, V2_1, V1_1, V1_1, V1_1,
+};
+
+static const uint8_t ages_010000[256] =
+{
+	/* 00 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, V4_0, V4_0, V4_0,
+	/* 10 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 20 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 30 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, V4_0, V4_0, NA, V4_0,
+	/* 40 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA,
+	/* 50 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 90 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* A0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* B0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* C0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* D0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* E0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* F0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010100[256] =
+{
+	/* 00 */ V4_0, V4_0, V4_0, NA, NA, NA, NA, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 10 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 20 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 30 */ V4_0, V4_0, V4_0, V4_0, NA, NA, NA, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 40 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 50 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 60 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 70 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 80 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V7_0, V7_0, V9_0, V9_0, NA,
+	/* 90 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, NA, NA,
+	/* A0 */ V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* E0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* F0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA,
+};
+
+static const uint8_t ages_010200[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 90 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, NA,
+	/* A0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* B0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* C0 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* D0 */ V5_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010300[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V7_0,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, V10_0, V10_0, V10_0,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, NA, NA, NA, NA,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA,
+	/* 80 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 90 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, V4_0,
+	/* A0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* B0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* C0 */ V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* D0 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010400[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V4_0, V4_0, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V4_0, V4_0,
+	/* 50 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 60 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 70 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 80 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 90 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA,
+	/* A0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA, NA, NA, NA, NA,
+	/* B0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* C0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* D0 */ V9_0, V9_0, V9_0, V9_0, NA, NA, NA, NA, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* E0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* F0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010500[256] =
+{
+	/* 00 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 10 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V7_0,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010700[256] =
+{
+	/* 00 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 10 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010800[256] =
+{
+	/* 00 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA, V4_0, NA, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 10 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 20 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 30 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, V4_0, V4_0, NA, NA, NA, V4_0, NA, NA, V4_0,
+	/* 40 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 50 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* F0 */ V8_0, V8_0, V8_0, NA, V8_0, V8_0, NA, NA, NA, NA, NA, V8_0, V8_0, V8_0, V8_0, V8_0,
+};
+
+static const uint8_t ages_010900[256] =
+{
+	/* 00 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 10 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_2, V5_2, NA, NA, NA, V5_0,
+	/* 20 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 30 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, NA, NA, NA, V5_1,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 90 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* A0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* B0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, NA, NA, NA, NA, V8_0, V8_0, V6_1, V6_1,
+	/* C0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* D0 */ NA, NA, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* E0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* F0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+};
+
+static const uint8_t ages_010A00[256] =
+{
+	/* 00 */ V4_1, V4_1, V4_1, V4_1, NA, V4_1, V4_1, NA, NA, NA, NA, NA, V4_1, V4_1, V4_1, V4_1,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, NA, V4_1, V4_1, V4_1, NA, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 20 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 30 */ V4_1, V4_1, V4_1, V4_1, V11_0, V11_0, NA, NA, V4_1, V4_1, V4_1, NA, NA, NA, NA, V4_1,
+	/* 40 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V11_0, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 70 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010B00[256] =
+{
+	/* 00 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 10 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 20 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 30 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 40 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 50 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 60 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 70 */ V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, V7_0, V7_0, V7_0, V7_0, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010C00[256] =
+{
+	/* 00 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 10 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 20 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 30 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 40 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 90 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* A0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* B0 */ V8_0, V8_0, V8_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* D0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* E0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* F0 */ V8_0, V8_0, V8_0, NA, NA, NA, NA, NA, NA, NA, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+};
+
+static const uint8_t ages_010D00[256] =
+{
+	/* 00 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 10 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 20 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010E00[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 70 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_010F00[256] =
+{
+	/* 00 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 10 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 20 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 40 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 50 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* F0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011000[256] =
+{
+	/* 00 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 10 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 20 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 30 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 40 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA, NA,
+	/* 50 */ NA, NA, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 60 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V7_0,
+	/* 80 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 90 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* A0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* B0 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* C0 */ V5_2, V5_2, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V11_0, NA, NA,
+	/* D0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* E0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011100[256] =
+{
+	/* 00 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 10 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 20 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 30 */ V6_1, V6_1, V6_1, V6_1, V6_1, NA, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 40 */ V6_1, V6_1, V6_1, V6_1, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 90 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* A0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* B0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* C0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V8_0, V8_0, V8_0, V8_0, V7_0, NA, NA,
+	/* D0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V7_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* E0 */ NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011200[256] =
+{
+	/* 00 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 10 */ V7_0, V7_0, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V9_0, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, NA, V8_0, NA, V8_0, V8_0, V8_0, V8_0, NA, V8_0,
+	/* 90 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, NA, V8_0,
+	/* A0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, NA, NA, NA, NA, NA, NA,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011300[256] =
+{
+	/* 00 */ V8_0, V7_0, V7_0, V7_0, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, V7_0,
+	/* 10 */ V7_0, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ V7_0, NA, V7_0, V7_0, NA, V7_0, V7_0, V7_0, V7_0, V7_0, NA, V11_0, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, V7_0, V7_0, NA, NA, V7_0, V7_0, V7_0, NA, NA,
+	/* 50 */ V8_0, NA, NA, NA, NA, NA, NA, V7_0, NA, NA, NA, NA, NA, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011400[256] =
+{
+	/* 00 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 10 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 20 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 30 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 40 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 50 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, V9_0, NA, V9_0, V11_0, V12_0,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011500[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* D0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011600[256] =
+{
+	/* 00 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 10 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 90 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* A0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* B0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V12_0, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011700[256] =
+{
+	/* 00 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 10 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V11_0, NA, NA, V8_0, V8_0, V8_0,
+	/* 20 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, NA, NA, NA, NA,
+	/* 30 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011800[256] =
+{
+	/* 00 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 10 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 20 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 30 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V7_0,
+};
+
+static const uint8_t ages_011900[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* B0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* C0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* D0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* E0 */ V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011A00[256] =
+{
+	/* 00 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 10 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 20 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 30 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 40 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 60 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 70 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 80 */ V10_0, V10_0, V10_0, V10_0, V12_0, V12_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 90 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V11_0, V10_0, V10_0,
+	/* A0 */ V10_0, V10_0, V10_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011C00[256] =
+{
+	/* 00 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 10 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 20 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 30 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 40 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 60 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, NA,
+	/* 70 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 80 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 90 */ NA, NA, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* A0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* B0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011D00[256] =
+{
+	/* 00 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA, V10_0, V10_0, NA, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 10 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 20 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 30 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA, NA, NA, V10_0, NA, V10_0, V10_0, NA, V10_0,
+	/* 40 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, V11_0, V11_0, NA, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 70 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 80 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA,
+	/* 90 */ V11_0, V11_0, NA, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011E00[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* F0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_011F00[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* D0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* E0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* F0 */ V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V12_0,
+};
+
+static const uint8_t ages_012300[256] =
+{
+	/* 00 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 10 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 20 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 30 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 40 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 50 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 60 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V8_0, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_012400[256] =
+{
+	/* 00 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 10 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 20 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 30 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 40 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 50 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 60 */ V5_0, V5_0, V5_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA,
+	/* 70 */ V5_0, V5_0, V5_0, V5_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 90 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* A0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* B0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* C0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* D0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* E0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* F0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+};
+
+static const uint8_t ages_012500[256] =
+{
+	/* 00 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 10 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 20 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 30 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 40 */ V8_0, V8_0, V8_0, V8_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_013400[256] =
+{
+	/* 00 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 10 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 20 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA,
+	/* 30 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_014600[256] =
+{
+	/* 00 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 10 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 20 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 30 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 40 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_016A00[256] =
+{
+	/* 00 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 10 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 20 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 30 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, V7_0, V7_0,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_016B00[256] =
+{
+	/* 00 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 10 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, V7_0, V7_0, V7_0,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_016E00[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 50 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 60 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 70 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 80 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 90 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_016F00[256] =
+{
+	/* 00 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 10 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 20 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 30 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 40 */ V6_1, V6_1, V6_1, V6_1, V6_1, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, V12_0,
+	/* 50 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 60 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 70 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V12_0,
+	/* 80 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, V6_1,
+	/* 90 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V9_0, V10_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_018700[256] =
+{
+	/* 00 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 10 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 20 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 30 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 40 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 50 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 60 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 70 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 80 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 90 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* A0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* B0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* C0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* D0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* E0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V11_0, V11_0, V11_0,
+	/* F0 */ V11_0, V11_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_018A00[256] =
+{
+	/* 00 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 10 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 20 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 30 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 40 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 50 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 60 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 70 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 80 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 90 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* A0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* B0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* C0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* D0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* E0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* F0 */ V9_0, V9_0, V9_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01B000[256] =
+{
+	/* 00 */ V6_0, V6_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 10 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 20 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 30 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 40 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 50 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 60 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 70 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 80 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 90 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* A0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* B0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* C0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* D0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* E0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* F0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+};
+
+static const uint8_t ages_01B100[256] =
+{
+	/* 00 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 10 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 80 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 90 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* A0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* B0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* C0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* D0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* E0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* F0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+};
+
+static const uint8_t ages_01B200[256] =
+{
+	/* 00 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 10 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 20 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 30 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 40 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 50 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 60 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 70 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 80 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 90 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* A0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* B0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* C0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* D0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* E0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* F0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01BC00[256] =
+{
+	/* 00 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 10 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01D000[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 50 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 60 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 70 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 80 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 90 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* A0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* B0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* C0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* D0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* E0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* F0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01D100[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, NA, V5_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 50 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 60 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 70 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 80 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 90 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* A0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* B0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* C0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* D0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V8_0, V8_0,
+	/* E0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01D200[256] =
+{
+	/* 00 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 10 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 20 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 30 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, V4_1,
+	/* 40 */ V4_1, V4_1, V4_1, V4_1, V4_1, V4_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* F0 */ V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01D300[256] =
+{
+	/* 00 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 10 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 20 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 30 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 40 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 50 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0, V5_0,
+	/* 70 */ V5_0, V5_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01D400[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 50 */ V3_1, V3_1, V3_1, V3_1, V3_1, NA, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 60 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 70 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 80 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 90 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, V3_1, V3_1,
+	/* A0 */ NA, NA, V3_1, NA, NA, V3_1, V3_1, NA, NA, V3_1, V3_1, V3_1, V3_1, NA, V3_1, V3_1,
+	/* B0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, V3_1, NA, V3_1, V3_1, V3_1,
+	/* C0 */ V3_1, V4_0, V3_1, V3_1, NA, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* D0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* E0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* F0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+};
+
+static const uint8_t ages_01D500[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, V3_1, V3_1, V3_1, V3_1, NA, NA, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, NA, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, V3_1, V3_1,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, V3_1, V3_1, V3_1, V3_1, NA,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, NA, V3_1, NA, NA, NA, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 50 */ V3_1, NA, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 60 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 70 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 80 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 90 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* A0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* B0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* C0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* D0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* E0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* F0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+};
+
+static const uint8_t ages_01D600[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 50 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 60 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 70 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 80 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 90 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* A0 */ V3_1, V3_1, V3_1, V3_1, V4_1, V4_1, NA, NA, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* B0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* C0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* D0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* E0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* F0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+};
+
+static const uint8_t ages_01D700[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 50 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 60 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 70 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 80 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 90 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* A0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* B0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* C0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V5_0, V5_0, NA, NA, V3_1, V3_1,
+	/* D0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* E0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* F0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+};
+
+static const uint8_t ages_01DA00[256] =
+{
+	/* 00 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 10 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 20 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 30 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 40 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 50 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 60 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 70 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 80 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* A0 */ NA, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01E000[256] =
+{
+	/* 00 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 10 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 20 */ V9_0, V9_0, NA, V9_0, V9_0, NA, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01E100[256] =
+{
+	/* 00 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 10 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 20 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA,
+	/* 30 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA,
+	/* 40 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, V12_0, V12_0,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01E200[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* D0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* E0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* F0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, V12_0,
+};
+
+static const uint8_t ages_01E800[256] =
+{
+	/* 00 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 10 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01E900[256] =
+{
+	/* 00 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 10 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 20 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 30 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 40 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V12_0, NA, NA, NA, NA,
+	/* 50 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, NA, NA, V9_0, V9_0,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01EC00[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 80 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* 90 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* A0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* B0 */ V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01ED00[256] =
+{
+	/* 00 */ NA, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 10 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 20 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 30 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01EE00[256] =
+{
+	/* 00 */ V6_1, V6_1, V6_1, V6_1, NA, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 10 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 20 */ NA, V6_1, V6_1, NA, V6_1, NA, NA, V6_1, NA, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 30 */ V6_1, V6_1, V6_1, NA, V6_1, V6_1, V6_1, V6_1, NA, V6_1, NA, V6_1, NA, NA, NA, NA,
+	/* 40 */ NA, NA, V6_1, NA, NA, NA, NA, V6_1, NA, V6_1, NA, V6_1, NA, V6_1, V6_1, V6_1,
+	/* 50 */ NA, V6_1, V6_1, NA, V6_1, NA, NA, V6_1, NA, V6_1, NA, V6_1, NA, V6_1, NA, V6_1,
+	/* 60 */ NA, V6_1, V6_1, NA, V6_1, NA, NA, V6_1, V6_1, V6_1, V6_1, NA, V6_1, V6_1, V6_1, V6_1,
+	/* 70 */ V6_1, V6_1, V6_1, NA, V6_1, V6_1, V6_1, V6_1, NA, V6_1, V6_1, V6_1, V6_1, NA, V6_1, NA,
+	/* 80 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, NA, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* 90 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, NA, NA, NA, NA,
+	/* A0 */ NA, V6_1, V6_1, V6_1, NA, V6_1, V6_1, V6_1, V6_1, V6_1, NA, V6_1, V6_1, V6_1, V6_1, V6_1,
+	/* B0 */ V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, V6_1, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ V6_1, V6_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01F000[256] =
+{
+	/* 00 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 10 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 20 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, NA, NA, NA, NA,
+	/* 30 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 40 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 50 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 60 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 70 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 80 */ V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1, V5_1,
+	/* 90 */ V5_1, V5_1, V5_1, V5_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA,
+	/* B0 */ NA, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0,
+	/* C0 */ NA, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* D0 */ NA, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01F100[256] =
+{
+	/* 00 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V7_0, V7_0, NA, NA, NA,
+	/* 10 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 20 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V11_0,
+	/* 30 */ V6_0, V5_2, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V5_2, V6_0, V5_2,
+	/* 40 */ V6_0, V6_0, V5_2, V6_0, V6_0, V6_0, V5_2, V6_0, V6_0, V6_0, V5_2, V5_2, V5_2, V5_2, V5_2, V6_0,
+	/* 50 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V5_2, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V5_2,
+	/* 60 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_1, V6_1, V12_0, NA, NA, NA,
+	/* 70 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V5_2, V6_0, V5_2, V5_2, V6_0, V6_0, V5_2,
+	/* 80 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V5_2, V5_2, V5_2, V5_2, V6_0, V6_0,
+	/* 90 */ V5_2, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* A0 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* F0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+};
+
+static const uint8_t ages_01F200[256] =
+{
+	/* 00 */ V5_2, V6_0, V6_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 20 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 30 */ V5_2, V5_2, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V9_0, NA, NA, NA, NA,
+	/* 40 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V6_0, V6_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01F300[256] =
+{
+	/* 00 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 10 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 20 */ V6_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V8_0, V8_0, V8_0,
+	/* 30 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 40 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 50 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 60 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 70 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0, V8_0, V8_0,
+	/* 80 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 90 */ V6_0, V6_0, V6_0, V6_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* B0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* C0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V7_0, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0, V7_0, V7_0, V7_0, V8_0,
+	/* D0 */ V8_0, V8_0, V8_0, V8_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* E0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* F0 */ V6_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+};
+
+static const uint8_t ages_01F400[256] =
+{
+	/* 00 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 10 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 20 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 30 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0,
+	/* 40 */ V6_0, V7_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 50 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 60 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 70 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 80 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 90 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* A0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* B0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* C0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* D0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* E0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* F0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0, V6_0, V6_0, V6_0, V6_0, V7_0, V7_0, V8_0,
+};
+
+static const uint8_t ages_01F500[256] =
+{
+	/* 00 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 10 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 20 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 30 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0, V7_0,
+	/* 40 */ V6_1, V6_1, V6_1, V6_1, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 50 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 60 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V9_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, V9_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+};
+
+static const uint8_t ages_01F600[256] =
+{
+	/* 00 */ V6_1, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 10 */ V6_0, V6_1, V6_0, V6_0, V6_0, V6_1, V6_0, V6_1, V6_0, V6_1, V6_0, V6_1, V6_0, V6_0, V6_0, V6_1,
+	/* 20 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_1, V6_1, V6_0, V6_0, V6_0, V6_0, V6_1, V6_0, V6_1, V6_1,
+	/* 30 */ V6_0, V6_0, V6_0, V6_0, V6_1, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 40 */ V6_0, V7_0, V7_0, V8_0, V8_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 80 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 90 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* A0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* B0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* C0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V8_0, V9_0, V9_0, V10_0, V10_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA,
+	/* F0 */ V7_0, V7_0, V7_0, V7_0, V9_0, V9_0, V9_0, V10_0, V10_0, V11_0, V12_0, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01F700[256] =
+{
+	/* 00 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 10 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 20 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 30 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 40 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 50 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 60 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 70 */ V6_0, V6_0, V6_0, V6_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* B0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* C0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* D0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01F800[256] =
+{
+	/* 00 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA,
+	/* 10 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 20 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 30 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 40 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 70 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* 80 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0,
+	/* A0 */ V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, V7_0, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01F900[256] =
+{
+	/* 00 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, NA, V12_0, V12_0, V12_0,
+	/* 10 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V10_0,
+	/* 20 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 30 */ V9_0, V10_0, V10_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V12_0,
+	/* 40 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V10_0, V11_0, V11_0, V11_0,
+	/* 50 */ V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V10_0,
+	/* 60 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V11_0, V11_0, V11_0, V11_0,
+	/* 70 */ V11_0, V12_0, NA, V11_0, V11_0, V11_0, V11_0, NA, NA, NA, V11_0, V12_0, V11_0, V11_0, V11_0, V11_0,
+	/* 80 */ V8_0, V8_0, V8_0, V8_0, V8_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0, V9_0,
+	/* 90 */ V9_0, V9_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* A0 */ V11_0, V11_0, V11_0, NA, NA, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, V12_0, V12_0,
+	/* B0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* C0 */ V8_0, V11_0, V11_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, V12_0, V12_0, V12_0,
+	/* D0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* E0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+	/* F0 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0,
+};
+
+static const uint8_t ages_01FA00[256] =
+{
+	/* 00 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 10 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 20 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 30 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 40 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, V12_0,
+	/* 50 */ V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, V11_0, NA, NA,
+	/* 70 */ V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA,
+	/* 80 */ V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ V12_0, V12_0, V12_0, V12_0, V12_0, V12_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_01FF00[256] =
+{
+	/* 00 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, V2_0, V2_0,
+};
+
+static const uint8_t ages_02A600[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 50 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 60 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 70 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 80 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 90 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* A0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* B0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* C0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* D0 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_02B700[256] =
+{
+	/* 00 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 10 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 20 */ V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2, V5_2,
+	/* 30 */ V5_2, V5_2, V5_2, V5_2, V5_2, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 50 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 60 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 70 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 80 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 90 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* A0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* B0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* C0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* D0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* E0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* F0 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+};
+
+static const uint8_t ages_02B800[256] =
+{
+	/* 00 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0,
+	/* 10 */ V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, V6_0, NA, NA,
+	/* 20 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 30 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 40 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 50 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 60 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 70 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 80 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 90 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* A0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* B0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* C0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* D0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* E0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* F0 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+};
+
+static const uint8_t ages_02CE00[256] =
+{
+	/* 00 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 10 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 20 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 30 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 40 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 50 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 60 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 70 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 80 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* 90 */ V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0, V8_0,
+	/* A0 */ V8_0, V8_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* C0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* D0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* E0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* F0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+};
+
+static const uint8_t ages_02EB00[256] =
+{
+	/* 00 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 10 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 20 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 30 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 40 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 50 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 60 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 70 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 80 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* 90 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* A0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* B0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* C0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* D0 */ V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0, V10_0,
+	/* E0 */ V10_0, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_02FA00[256] =
+{
+	/* 00 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 10 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, NA, NA,
+	/* 20 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 30 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 40 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 50 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 60 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 70 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_0E0000[256] =
+{
+	/* 00 */ NA, V3_1, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 10 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 20 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 30 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 40 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 50 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 60 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 70 */ V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1, V3_1,
+	/* 80 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* 90 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* A0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* B0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* C0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* D0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* E0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t ages_0E0100[256] =
+{
+	/* 00 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 10 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 20 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 30 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 40 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 50 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 60 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 70 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 80 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* 90 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* A0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* B0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* C0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* D0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* E0 */ V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0, V4_0,
+	/* F0 */ NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA, NA,
+};
+
+static const uint8_t *ages_000000_00D7FF[] =
+{
+	ages_V1_1, /* 000000 */
+	ages_000100,
+	ages_000200,
+	ages_000300,
+	ages_000400,
+	ages_000500,
+	ages_000600,
+	ages_000700,
+	ages_000800,
+	ages_000900,
+	ages_000A00,
+	ages_000B00,
+	ages_000C00,
+	ages_000D00,
+	ages_000E00,
+	ages_000F00,
+	ages_001000,
+	ages_001100,
+	ages_001200,
+	ages_001300,
+	ages_001400,
+	ages_V3_0, /* 001500 */
+	ages_001600,
+	ages_001700,
+	ages_001800,
+	ages_001900,
+	ages_001A00,
+	ages_001B00,
+	ages_001C00,
+	ages_001D00,
+	ages_001E00,
+	ages_001F00,
+	ages_002000,
+	ages_002100,
+	ages_002200,
+	ages_002300,
+	ages_002400,
+	ages_002500,
+	ages_002600,
+	ages_002700,
+	ages_V3_0, /* 002800 */
+	ages_V3_2, /* 002900 */
+	ages_V3_2, /* 002A00 */
+	ages_002B00,
+	ages_002C00,
+	ages_002D00,
+	ages_002E00,
+	ages_002F00,
+	ages_003000,
+	ages_003100,
+	ages_003200,
+	ages_003300,
+	ages_V3_0, /* 003400 */
+	ages_V3_0, /* 003500 */
+	ages_V3_0, /* 003600 */
+	ages_V3_0, /* 003700 */
+	ages_V3_0, /* 003800 */
+	ages_V3_0, /* 003900 */
+	ages_V3_0, /* 003A00 */
+	ages_V3_0, /* 003B00 */
+	ages_V3_0, /* 003C00 */
+	ages_V3_0, /* 003D00 */
+	ages_V3_0, /* 003E00 */
+	ages_V3_0, /* 003F00 */
+	ages_V3_0, /* 004000 */
+	ages_V3_0, /* 004100 */
+	ages_V3_0, /* 004200 */
+	ages_V3_0, /* 004300 */
+	ages_V3_0, /* 004400 */
+	ages_V3_0, /* 004500 */
+	ages_V3_0, /* 004600 */
+	ages_V3_0, /* 004700 */
+	ages_V3_0, /* 004800 */
+	ages_V3_0, /* 004900 */
+	ages_V3_0, /* 004A00 */
+	ages_V3_0, /* 004B00 */
+	ages_V3_0, /* 004C00 */
+	ages_004D00,
+	ages_V1_1, /* 004E00 */
+	ages_V1_1, /* 004F00 */
+	ages_V1_1, /* 005000 */
+	ages_V1_1, /* 005100 */
+	ages_V1_1, /* 005200 */
+	ages_V1_1, /* 005300 */
+	ages_V1_1, /* 005400 */
+	ages_V1_1, /* 005500 */
+	ages_V1_1, /* 005600 */
+	ages_V1_1, /* 005700 */
+	ages_V1_1, /* 005800 */
+	ages_V1_1, /* 005900 */
+	ages_V1_1, /* 005A00 */
+	ages_V1_1, /* 005B00 */
+	ages_V1_1, /* 005C00 */
+	ages_V1_1, /* 005D00 */
+	ages_V1_1, /* 005E00 */
+	ages_V1_1, /* 005F00 */
+	ages_V1_1, /* 006000 */
+	ages_V1_1, /* 006100 */
+	ages_V1_1, /* 006200 */
+	ages_V1_1, /* 006300 */
+	ages_V1_1, /* 006400 */
+	ages_V1_1, /* 006500 */
+	ages_V1_1, /* 006600 */
+	ages_V1_1, /* 006700 */
+	ages_V1_1, /* 006800 */
+	ages_V1_1, /* 006900 */
+	ages_V1_1, /* 006A00 */
+	ages_V1_1, /* 006B00 */
+	ages_V1_1, /* 006C00 */
+	ages_V1_1, /* 006D00 */
+	ages_V1_1, /* 006E00 */
+	ages_V1_1, /* 006F00 */
+	ages_V1_1, /* 007000 */
+	ages_V1_1, /* 007100 */
+	ages_V1_1, /* 007200 */
+	ages_V1_1, /* 007300 */
+	ages_V1_1, /* 007400 */
+	ages_V1_1, /* 007500 */
+	ages_V1_1, /* 007600 */
+	ages_V1_1, /* 007700 */
+	ages_V1_1, /* 007800 */
+	ages_V1_1, /* 007900 */
+	ages_V1_1, /* 007A00 */
+	ages_V1_1, /* 007B00 */
+	ages_V1_1, /* 007C00 */
+	ages_V1_1, /* 007D00 */
+	ages_V1_1, /* 007E00 */
+	ages_V1_1, /* 007F00 */
+	ages_V1_1, /* 008000 */
+	ages_V1_1, /* 008100 */
+	ages_V1_1, /* 008200 */
+	ages_V1_1, /* 008300 */
+	ages_V1_1, /* 008400 */
+	ages_V1_1, /* 008500 */
+	ages_V1_1, /* 008600 */
+	ages_V1_1, /* 008700 */
+	ages_V1_1, /* 008800 */
+	ages_V1_1, /* 008900 */
+	ages_V1_1, /* 008A00 */
+	ages_V1_1, /* 008B00 */
+	ages_V1_1, /* 008C00 */
+	ages_V1_1, /* 008D00 */
+	ages_V1_1, /* 008E00 */
+	ages_V1_1, /* 008F00 */
+	ages_V1_1, /* 009000 */
+	ages_V1_1, /* 009100 */
+	ages_V1_1, /* 009200 */
+	ages_V1_1, /* 009300 */
+	ages_V1_1, /* 009400 */
+	ages_V1_1, /* 009500 */
+	ages_V1_1, /* 009600 */
+	ages_V1_1, /* 009700 */
+	ages_V1_1, /* 009800 */
+	ages_V1_1, /* 009900 */
+	ages_V1_1, /* 009A00 */
+	ages_V1_1, /* 009B00 */
+	ages_V1_1, /* 009C00 */
+	ages_V1_1, /* 009D00 */
+	ages_V1_1, /* 009E00 */
+	ages_009F00,
+	ages_V3_0, /* 00A000 */
+	ages_V3_0, /* 00A100 */
+	ages_V3_0, /* 00A200 */
+	ages_V3_0, /* 00A300 */
+	ages_00A400,
+	ages_V5_1, /* 00A500 */
+	ages_00A600,
+	ages_00A700,
+	ages_00A800,
+	ages_00A900,
+	ages_00AA00,
+	ages_00AB00,
+	ages_V2_0, /* 00AC00 */
+	ages_V2_0, /* 00AD00 */
+	ages_V2_0, /* 00AE00 */
+	ages_V2_0, /* 00AF00 */
+	ages_V2_0, /* 00B000 */
+	ages_V2_0, /* 00B100 */
+	ages_V2_0, /* 00B200 */
+	ages_V2_0, /* 00B300 */
+	ages_V2_0, /* 00B400 */
+	ages_V2_0, /* 00B500 */
+	ages_V2_0, /* 00B600 */
+	ages_V2_0, /* 00B700 */
+	ages_V2_0, /* 00B800 */
+	ages_V2_0, /* 00B900 */
+	ages_V2_0, /* 00BA00 */
+	ages_V2_0, /* 00BB00 */
+	ages_V2_0, /* 00BC00 */
+	ages_V2_0, /* 00BD00 */
+	ages_V2_0, /* 00BE00 */
+	ages_V2_0, /* 00BF00 */
+	ages_V2_0, /* 00C000 */
+	ages_V2_0, /* 00C100 */
+	ages_V2_0, /* 00C200 */
+	ages_V2_0, /* 00C300 */
+	ages_V2_0, /* 00C400 */
+	ages_V2_0, /* 00C500 */
+	ages_V2_0, /* 00C600 */
+	ages_V2_0, /* 00C700 */
+	ages_V2_0, /* 00C800 */
+	ages_V2_0, /* 00C900 */
+	ages_V2_0, /* 00CA00 */
+	ages_V2_0, /* 00CB00 */
+	ages_V2_0, /* 00CC00 */
+	ages_V2_0, /* 00CD00 */
+	ages_V2_0, /* 00CE00 */
+	ages_V2_0, /* 00CF00 */
+	ages_V2_0, /* 00D000 */
+	ages_V2_0, /* 00D100 */
+	ages_V2_0, /* 00D200 */
+	ages_V2_0, /* 00D300 */
+	ages_V2_0, /* 00D400 */
+	ages_V2_0, /* 00D500 */
+	ages_V2_0, /* 00D600 */
+	ages_00D700,
+};
+
+static const uint8_t *ages_00F800_02FAFF[] =
+{
+	ages_V1_1, /* 00F800 */
+	ages_V1_1, /* 00F900 */
+	ages_00FA00,
+	ages_00FB00,
+	ages_V1_1, /* 00FC00 */
+	ages_00FD00,
+	ages_00FE00,
+	ages_00FF00,
+	ages_010000,
+	ages_010100,
+	ages_010200,
+	ages_010300,
+	ages_010400,
+	ages_010500,
+	ages_V7_0, /* 010600 */
+	ages_010700,
+	ages_010800,
+	ages_010900,
+	ages_010A00,
+	ages_010B00,
+	ages_010C00,
+	ages_010D00,
+	ages_010E00,
+	ages_010F00,
+	ages_011000,
+	ages_011100,
+	ages_011200,
+	ages_011300,
+	ages_011400,
+	ages_011500,
+	ages_011600,
+	ages_011700,
+	ages_011800,
+	ages_011900,
+	ages_011A00,
+	ages_NA, /* 011B00 */
+	ages_011C00,
+	ages_011D00,
+	ages_011E00,
+	ages_011F00,
+	ages_V5_0, /* 012000 */
+	ages_V5_0, /* 012100 */
+	ages_V5_0, /* 012200 */
+	ages_012300,
+	ages_012400,
+	ages_012500,
+	ages_NA, /* 012600 */
+	ages_NA, /* 012700 */
+	ages_NA, /* 012800 */
+	ages_NA, /* 012900 */
+	ages_NA, /* 012A00 */
+	ages_NA, /* 012B00 */
+	ages_NA, /* 012C00 */
+	ages_NA, /* 012D00 */
+	ages_NA, /* 012E00 */
+	ages_NA, /* 012F00 */
+	ages_V5_2, /* 013000 */
+	ages_V5_2, /* 013100 */
+	ages_V5_2, /* 013200 */
+	ages_V5_2, /* 013300 */
+	ages_013400,
+	ages_NA, /* 013500 */
+	ages_NA, /* 013600 */
+	ages_NA, /* 013700 */
+	ages_NA, /* 013800 */
+	ages_NA, /* 013900 */
+	ages_NA, /* 013A00 */
+	ages_NA, /* 013B00 */
+	ages_NA, /* 013C00 */
+	ages_NA, /* 013D00 */
+	ages_NA, /* 013E00 */
+	ages_NA, /* 013F00 */
+	ages_NA, /* 014000 */
+	ages_NA, /* 014100 */
+	ages_NA, /* 014200 */
+	ages_NA, /* 014300 */
+	ages_V8_0, /* 014400 */
+	ages_V8_0, /* 014500 */
+	ages_014600,
+	ages_NA, /* 014700 */
+	ages_NA, /* 014800 */
+	ages_NA, /* 014900 */
+	ages_NA, /* 014A00 */
+	ages_NA, /* 014B00 */
+	ages_NA, /* 014C00 */
+	ages_NA, /* 014D00 */
+	ages_NA, /* 014E00 */
+	ages_NA, /* 014F00 */
+	ages_NA, /* 015000 */
+	ages_NA, /* 015100 */
+	ages_NA, /* 015200 */
+	ages_NA, /* 015300 */
+	ages_NA, /* 015400 */
+	ages_NA, /* 015500 */
+	ages_NA, /* 015600 */
+	ages_NA, /* 015700 */
+	ages_NA, /* 015800 */
+	ages_NA, /* 015900 */
+	ages_NA, /* 015A00 */
+	ages_NA, /* 015B00 */
+	ages_NA, /* 015C00 */
+	ages_NA, /* 015D00 */
+	ages_NA, /* 015E00 */
+	ages_NA, /* 015F00 */
+	ages_NA, /* 016000 */
+	ages_NA, /* 016100 */
+	ages_NA, /* 016200 */
+	ages_NA, /* 016300 */
+	ages_NA, /* 016400 */
+	ages_NA, /* 016500 */
+	ages_NA, /* 016600 */
+	ages_NA, /* 016700 */
+	ages_V6_0, /* 016800 */
+	ages_V6_0, /* 016900 */
+	ages_016A00,
+	ages_016B00,
+	ages_NA, /* 016C00 */
+	ages_NA, /* 016D00 */
+	ages_016E00,
+	ages_016F00,
+	ages_V9_0, /* 017000 */
+	ages_V9_0, /* 017100 */
+	ages_V9_0, /* 017200 */
+	ages_V9_0, /* 017300 */
+	ages_V9_0, /* 017400 */
+	ages_V9_0, /* 017500 */
+	ages_V9_0, /* 017600 */
+	ages_V9_0, /* 017700 */
+	ages_V9_0, /* 017800 */
+	ages_V9_0, /* 017900 */
+	ages_V9_0, /* 017A00 */
+	ages_V9_0, /* 017B00 */
+	ages_V9_0, /* 017C00 */
+	ages_V9_0, /* 017D00 */
+	ages_V9_0, /* 017E00 */
+	ages_V9_0, /* 017F00 */
+	ages_V9_0, /* 018000 */
+	ages_V9_0, /* 018100 */
+	ages_V9_0, /* 018200 */
+	ages_V9_0, /* 018300 */
+	ages_V9_0, /* 018400 */
+	ages_V9_0, /* 018500 */
+	ages_V9_0, /* 018600 */
+	ages_018700,
+	ages_V9_0, /* 018800 */
+	ages_V9_0, /* 018900 */
+	ages_018A00,
+	ages_NA, /* 018B00 */
+	ages_NA, /* 018C00 */
+	ages_NA, /* 018D00 */
+	ages_NA, /* 018E00 */
+	ages_NA, /* 018F00 */
+	ages_NA, /* 019000 */
+	ages_NA, /* 019100 */
+	ages_NA, /* 019200 */
+	ages_NA, /* 019300 */
+	ages_NA, /* 019400 */
+	ages_NA, /* 019500 */
+	ages_NA, /* 019600 */
+	ages_NA, /* 019700 */
+	ages_NA, /* 019800 */
+	ages_NA, /* 019900 */
+	ages_NA, /* 019A00 */
+	ages_NA, /* 019B00 */
+	ages_NA, /* 019C00 */
+	ages_NA, /* 019D00 */
+	ages_NA, /* 019E00 */
+	ages_NA, /* 019F00 */
+	ages_NA, /* 01A000 */
+	ages_NA, /* 01A100 */
+	ages_NA, /* 01A200 */
+	ages_NA, /* 01A300 */
+	ages_NA, /* 01A400 */
+	ages_NA, /* 01A500 */
+	ages_NA, /* 01A600 */
+	ages_NA, /* 01A700 */
+	ages_NA, /* 01A800 */
+	ages_NA, /* 01A900 */
+	ages_NA, /* 01AA00 */
+	ages_NA, /* 01AB00 */
+	ages_NA, /* 01AC00 */
+	ages_NA, /* 01AD00 */
+	ages_NA, /* 01AE00 */
+	ages_NA, /* 01AF00 */
+	ages_01B000,
+	ages_01B100,
+	ages_01B200,
+	ages_NA, /* 01B300 */
+	ages_NA, /* 01B400 */
+	ages_NA, /* 01B500 */
+	ages_NA, /* 01B600 */
+	ages_NA, /* 01B700 */
+	ages_NA, /* 01B800 */
+	ages_NA, /* 01B900 */
+	ages_NA, /* 01BA00 */
+	ages_NA, /* 01BB00 */
+	ages_01BC00,
+	ages_NA, /* 01BD00 */
+	ages_NA, /* 01BE00 */
+	ages_NA, /* 01BF00 */
+	ages_NA, /* 01C000 */
+	ages_NA, /* 01C100 */
+	ages_NA, /* 01C200 */
+	ages_NA, /* 01C300 */
+	ages_NA, /* 01C400 */
+	ages_NA, /* 01C500 */
+	ages_NA, /* 01C600 */
+	ages_NA, /* 01C700 */
+	ages_NA, /* 01C800 */
+	ages_NA, /* 01C900 */
+	ages_NA, /* 01CA00 */
+	ages_NA, /* 01CB00 */
+	ages_NA, /* 01CC00 */
+	ages_NA, /* 01CD00 */
+	ages_NA, /* 01CE00 */
+	ages_NA, /* 01CF00 */
+	ages_01D000,
+	ages_01D100,
+	ages_01D200,
+	ages_01D300,
+	ages_01D400,
+	ages_01D500,
+	ages_01D600,
+	ages_01D700,
+	ages_V8_0, /* 01D800 */
+	ages_V8_0, /* 01D900 */
+	ages_01DA00,
+	ages_NA, /* 01DB00 */
+	ages_NA, /* 01DC00 */
+	ages_NA, /* 01DD00 */
+	ages_NA, /* 01DE00 */
+	ages_NA, /* 01DF00 */
+	ages_01E000,
+	ages_01E100,
+	ages_01E200,
+	ages_NA, /* 01E300 */
+	ages_NA, /* 01E400 */
+	ages_NA, /* 01E500 */
+	ages_NA, /* 01E600 */
+	ages_NA, /* 01E700 */
+	ages_01E800,
+	ages_01E900,
+	ages_NA, /* 01EA00 */
+	ages_NA, /* 01EB00 */
+	ages_01EC00,
+	ages_01ED00,
+	ages_01EE00,
+	ages_NA, /* 01EF00 */
+	ages_01F000,
+	ages_01F100,
+	ages_01F200,
+	ages_01F300,
+	ages_01F400,
+	ages_01F500,
+	ages_01F600,
+	ages_01F700,
+	ages_01F800,
+	ages_01F900,
+	ages_01FA00,
+	ages_NA, /* 01FB00 */
+	ages_NA, /* 01FC00 */
+	ages_NA, /* 01FD00 */
+	ages_NA, /* 01FE00 */
+	ages_01FF00,
+	ages_V3_1, /* 020000 */
+	ages_V3_1, /* 020100 */
+	ages_V3_1, /* 020200 */
+	ages_V3_1, /* 020300 */
+	ages_V3_1, /* 020400 */
+	ages_V3_1, /* 020500 */
+	ages_V3_1, /* 020600 */
+	ages_V3_1, /* 020700 */
+	ages_V3_1, /* 020800 */
+	ages_V3_1, /* 020900 */
+	ages_V3_1, /* 020A00 */
+	ages_V3_1, /* 020B00 */
+	ages_V3_1, /* 020C00 */
+	ages_V3_1, /* 020D00 */
+	ages_V3_1, /* 020E00 */
+	ages_V3_1, /* 020F00 */
+	ages_V3_1, /* 021000 */
+	ages_V3_1, /* 021100 */
+	ages_V3_1, /* 021200 */
+	ages_V3_1, /* 021300 */
+	ages_V3_1, /* 021400 */
+	ages_V3_1, /* 021500 */
+	ages_V3_1, /* 021600 */
+	ages_V3_1, /* 021700 */
+	ages_V3_1, /* 021800 */
+	ages_V3_1, /* 021900 */
+	ages_V3_1, /* 021A00 */
+	ages_V3_1, /* 021B00 */
+	ages_V3_1, /* 021C00 */
+	ages_V3_1, /* 021D00 */
+	ages_V3_1, /* 021E00 */
+	ages_V3_1, /* 021F00 */
+	ages_V3_1, /* 022000 */
+	ages_V3_1, /* 022100 */
+	ages_V3_1, /* 022200 */
+	ages_V3_1, /* 022300 */
+	ages_V3_1, /* 022400 */
+	ages_V3_1, /* 022500 */
+	ages_V3_1, /* 022600 */
+	ages_V3_1, /* 022700 */
+	ages_V3_1, /* 022800 */
+	ages_V3_1, /* 022900 */
+	ages_V3_1, /* 022A00 */
+	ages_V3_1, /* 022B00 */
+	ages_V3_1, /* 022C00 */
+	ages_V3_1, /* 022D00 */
+	ages_V3_1, /* 022E00 */
+	ages_V3_1, /* 022F00 */
+	ages_V3_1, /* 023000 */
+	ages_V3_1, /* 023100 */
+	ages_V3_1, /* 023200 */
+	ages_V3_1, /* 023300 */
+	ages_V3_1, /* 023400 */
+	ages_V3_1, /* 023500 */
+	ages_V3_1, /* 023600 */
+	ages_V3_1, /* 023700 */
+	ages_V3_1, /* 023800 */
+	ages_V3_1, /* 023900 */
+	ages_V3_1, /* 023A00 */
+	ages_V3_1, /* 023B00 */
+	ages_V3_1, /* 023C00 */
+	ages_V3_1, /* 023D00 */
+	ages_V3_1, /* 023E00 */
+	ages_V3_1, /* 023F00 */
+	ages_V3_1, /* 024000 */
+	ages_V3_1, /* 024100 */
+	ages_V3_1, /* 024200 */
+	ages_V3_1, /* 024300 */
+	ages_V3_1, /* 024400 */
+	ages_V3_1, /* 024500 */
+	ages_V3_1, /* 024600 */
+	ages_V3_1, /* 024700 */
+	ages_V3_1, /* 024800 */
+	ages_V3_1, /* 024900 */
+	ages_V3_1, /* 024A00 */
+	ages_V3_1, /* 024B00 */
+	ages_V3_1, /* 024C00 */
+	ages_V3_1, /* 024D00 */
+	ages_V3_1, /* 024E00 */
+	ages_V3_1, /* 024F00 */
+	ages_V3_1, /* 025000 */
+	ages_V3_1, /* 025100 */
+	ages_V3_1, /* 025200 */
+	ages_V3_1, /* 025300 */
+	ages_V3_1, /* 025400 */
+	ages_V3_1, /* 025500 */
+	ages_V3_1, /* 025600 */
+	ages_V3_1, /* 025700 */
+	ages_V3_1, /* 025800 */
+	ages_V3_1, /* 025900 */
+	ages_V3_1, /* 025A00 */
+	ages_V3_1, /* 025B00 */
+	ages_V3_1, /* 025C00 */
+	ages_V3_1, /* 025D00 */
+	ages_V3_1, /* 025E00 */
+	ages_V3_1, /* 025F00 */
+	ages_V3_1, /* 026000 */
+	ages_V3_1, /* 026100 */
+	ages_V3_1, /* 026200 */
+	ages_V3_1, /* 026300 */
+	ages_V3_1, /* 026400 */
+	ages_V3_1, /* 026500 */
+	ages_V3_1, /* 026600 */
+	ages_V3_1, /* 026700 */
+	ages_V3_1, /* 026800 */
+	ages_V3_1, /* 026900 */
+	ages_V3_1, /* 026A00 */
+	ages_V3_1, /* 026B00 */
+	ages_V3_1, /* 026C00 */
+	ages_V3_1, /* 026D00 */
+	ages_V3_1, /* 026E00 */
+	ages_V3_1, /* 026F00 */
+	ages_V3_1, /* 027000 */
+	ages_V3_1, /* 027100 */
+	ages_V3_1, /* 027200 */
+	ages_V3_1, /* 027300 */
+	ages_V3_1, /* 027400 */
+	ages_V3_1, /* 027500 */
+	ages_V3_1, /* 027600 */
+	ages_V3_1, /* 027700 */
+	ages_V3_1, /* 027800 */
+	ages_V3_1, /* 027900 */
+	ages_V3_1, /* 027A00 */
+	ages_V3_1, /* 027B00 */
+	ages_V3_1, /* 027C00 */
+	ages_V3_1, /* 027D00 */
+	ages_V3_1, /* 027E00 */
+	ages_V3_1, /* 027F00 */
+	ages_V3_1, /* 028000 */
+	ages_V3_1, /* 028100 */
+	ages_V3_1, /* 028200 */
+	ages_V3_1, /* 028300 */
+	ages_V3_1, /* 028400 */
+	ages_V3_1, /* 028500 */
+	ages_V3_1, /* 028600 */
+	ages_V3_1, /* 028700 */
+	ages_V3_1, /* 028800 */
+	ages_V3_1, /* 028900 */
+	ages_V3_1, /* 028A00 */
+	ages_V3_1, /* 028B00 */
+	ages_V3_1, /* 028C00 */
+	ages_V3_1, /* 028D00 */
+	ages_V3_1, /* 028E00 */
+	ages_V3_1, /* 028F00 */
+	ages_V3_1, /* 029000 */
+	ages_V3_1, /* 029100 */
+	ages_V3_1, /* 029200 */
+	ages_V3_1, /* 029300 */
+	ages_V3_1, /* 029400 */
+	ages_V3_1, /* 029500 */
+	ages_V3_1, /* 029600 */
+	ages_V3_1, /* 029700 */
+	ages_V3_1, /* 029800 */
+	ages_V3_1, /* 029900 */
+	ages_V3_1, /* 029A00 */
+	ages_V3_1, /* 029B00 */
+	ages_V3_1, /* 029C00 */
+	ages_V3_1, /* 029D00 */
+	ages_V3_1, /* 029E00 */
+	ages_V3_1, /* 029F00 */
+	ages_V3_1, /* 02A000 */
+	ages_V3_1, /* 02A100 */
+	ages_V3_1, /* 02A200 */
+	ages_V3_1, /* 02A300 */
+	ages_V3_1, /* 02A400 */
+	ages_V3_1, /* 02A500 */
+	ages_02A600,
+	ages_V5_2, /* 02A700 */
+	ages_V5_2, /* 02A800 */
+	ages_V5_2, /* 02A900 */
+	ages_V5_2, /* 02AA00 */
+	ages_V5_2, /* 02AB00 */
+	ages_V5_2, /* 02AC00 */
+	ages_V5_2, /* 02AD00 */
+	ages_V5_2, /* 02AE00 */
+	ages_V5_2, /* 02AF00 */
+	ages_V5_2, /* 02B000 */
+	ages_V5_2, /* 02B100 */
+	ages_V5_2, /* 02B200 */
+	ages_V5_2, /* 02B300 */
+	ages_V5_2, /* 02B400 */
+	ages_V5_2, /* 02B500 */
+	ages_V5_2, /* 02B600 */
+	ages_02B700,
+	ages_02B800,
+	ages_V8_0, /* 02B900 */
+	ages_V8_0, /* 02BA00 */
+	ages_V8_0, /* 02BB00 */
+	ages_V8_0, /* 02BC00 */
+	ages_V8_0, /* 02BD00 */
+	ages_V8_0, /* 02BE00 */
+	ages_V8_0, /* 02BF00 */
+	ages_V8_0, /* 02C000 */
+	ages_V8_0, /* 02C100 */
+	ages_V8_0, /* 02C200 */
+	ages_V8_0, /* 02C300 */
+	ages_V8_0, /* 02C400 */
+	ages_V8_0, /* 02C500 */
+	ages_V8_0, /* 02C600 */
+	ages_V8_0, /* 02C700 */
+	ages_V8_0, /* 02C800 */
+	ages_V8_0, /* 02C900 */
+	ages_V8_0, /* 02CA00 */
+	ages_V8_0, /* 02CB00 */
+	ages_V8_0, /* 02CC00 */
+	ages_V8_0, /* 02CD00 */
+	ages_02CE00,
+	ages_V10_0, /* 02CF00 */
+	ages_V10_0, /* 02D000 */
+	ages_V10_0, /* 02D100 */
+	ages_V10_0, /* 02D200 */
+	ages_V10_0, /* 02D300 */
+	ages_V10_0, /* 02D400 */
+	ages_V10_0, /* 02D500 */
+	ages_V10_0, /* 02D600 */
+	ages_V10_0, /* 02D700 */
+	ages_V10_0, /* 02D800 */
+	ages_V10_0, /* 02D900 */
+	ages_V10_0, /* 02DA00 */
+	ages_V10_0, /* 02DB00 */
+	ages_V10_0, /* 02DC00 */
+	ages_V10_0, /* 02DD00 */
+	ages_V10_0, /* 02DE00 */
+	ages_V10_0, /* 02DF00 */
+	ages_V10_0, /* 02E000 */
+	ages_V10_0, /* 02E100 */
+	ages_V10_0, /* 02E200 */
+	ages_V10_0, /* 02E300 */
+	ages_V10_0, /* 02E400 */
+	ages_V10_0, /* 02E500 */
+	ages_V10_0, /* 02E600 */
+	ages_V10_0, /* 02E700 */
+	ages_V10_0, /* 02E800 */
+	ages_V10_0, /* 02E900 */
+	ages_V10_0, /* 02EA00 */
+	ages_02EB00,
+	ages_NA, /* 02EC00 */
+	ages_NA, /* 02ED00 */
+	ages_NA, /* 02EE00 */
+	ages_NA, /* 02EF00 */
+	ages_NA, /* 02F000 */
+	ages_NA, /* 02F100 */
+	ages_NA, /* 02F200 */
+	ages_NA, /* 02F300 */
+	ages_NA, /* 02F400 */
+	ages_NA, /* 02F500 */
+	ages_NA, /* 02F600 */
+	ages_NA, /* 02F700 */
+	ages_V3_1, /* 02F800 */
+	ages_V3_1, /* 02F900 */
+	ages_02FA00,
+};
+
+static const uint8_t *ages_0E0000_0E01FF[] =
+{
+	ages_0E0000,
+	ages_0E0100,
+};
+
+static ucd_age lookup_age(codepoint_t c)
+{
+	if (c <= 0x00D7FF) /* 000000..00D7FF */
+	{
+		const uint8_t *table = ages_000000_00D7FF[(c - 0x000000) / 256];
+		return (ucd_age)table[c % 256];
+	}
+	if (c <= 0x00DFFF) return V2_0; /* 00D800..00DFFF : Surrogates */
+	if (c <= 0x00F7FF) return V1_1; /* 00E000..00F7FF : Private Use Area */
+	if (c <= 0x02FAFF) /* 00F800..02FAFF */
+	{
+		const uint8_t *table = ages_00F800_02FAFF[(c - 0x00F800) / 256];
+		return (ucd_age)table[c % 256];
+	}
+	if (c <= 0x0DFFFF) /* 02FB00..0DFFFF : Unassigned */
+		return (c & 0xFFFE) == 0xFFFE ? V2_0 : NA; /* Noncharacters */
+	if (c <= 0x0E01FF) /* 0E0000..0E01FF */
+	{
+		const uint8_t *table = ages_0E0000_0E01FF[(c - 0x0E0000) / 256];
+		return (ucd_age)table[c % 256];
+	}
+	if (c <= 0x0EFFFF) /* 0E0200..0EFFFF : Unassigned */
+		return (c & 0xFFFE) == 0xFFFE ? V2_0 : NA; /* Noncharacters */
+	if (c <= 0x10FFFF) return V2_0; /* 0F0000..10FFFF : Plane 15/16 Private Use */
+	return NA; /* Invalid Unicode Codepoint */
+}
+
+ucd_age ucd_lookup_age(codepoint_t c)
+{
+	return lookup_age(c);
+}
+
+void ucd_lookup_age_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint8_t)lookup_age(in[i]);
+}
+
+ucd_age ucd_max_age_n(const codepoint_t *in, size_t n, ucd_age limit)
+{
+	ucd_age max_age = V1_1;
+	size_t i;
+	for (i = 0; i < n; ++i)
+	{
+		ucd_age age = in[i] < 0x80 ? V1_1 : lookup_age(in[i]);
+		if (age > max_age)
+		{
+			max_age = age;
+			if (max_age > limit)
+				break;
+		}
+	}
+	return max_age;
+}
@@ -0,0 +1,671 @@
+/* Unicode Bidirectional Algorithm
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "ucd/ucd.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* The maximum explicit embedding level (BD2). */
+#define MAX_DEPTH 125
+
+/* The maximum number of opening brackets on the bracket pair stack (BD16). */
+#define MAX_BRACKETS 63
+
+#define BIDI_CLASS_BIT(c) (1ul << (UCD_BIDI_CLASS_##c))
+
+/* The bidi classes of the codepoints that can give a codepoint in a left to
+ * right paragraph a non-zero embedding level.
+ */
+#define RTL_CLASSES \
+	(BIDI_CLASS_BIT(R) | BIDI_CLASS_BIT(AL) | BIDI_CLASS_BIT(AN) | \
+	 BIDI_CLASS_BIT(RLE) | BIDI_CLASS_BIT(RLO) | BIDI_CLASS_BIT(RLI) | \
+	 BIDI_CLASS_BIT(LRE) | BIDI_CLASS_BIT(LRO) | BIDI_CLASS_BIT(LRI) | \
+	 BIDI_CLASS_BIT(FSI))
+
+/* The neutral and isolate formatting characters (NI). */
+#define NEUTRAL_CLASSES \
+	(BIDI_CLASS_BIT(B) | BIDI_CLASS_BIT(S) | BIDI_CLASS_BIT(WS) | \
+	 BIDI_CLASS_BIT(ON) | BIDI_CLASS_BIT(FSI) | BIDI_CLASS_BIT(LRI) | \
+	 BIDI_CLASS_BIT(RLI) | BIDI_CLASS_BIT(PDI))
+
+#define IS_ISOLATE_INITIATOR(t) \
+	((t) == UCD_BIDI_CLASS_LRI || (t) == UCD_BIDI_CLASS_RLI || (t) == UCD_BIDI_CLASS_FSI)
+
+#define IS_NEUTRAL(t) ((1ul << (t)) & NEUTRAL_CLASSES)
+
+/* The codepoints removed by X9 are given the BN type, so are skipped by the
+ * isolating run sequences.
+ */
+#define IS_REMOVED(t) ((t) == UCD_BIDI_CLASS_BN)
+
+#define EMBEDDING_DIRECTION(level) ((level) & 1 ? UCD_BIDI_CLASS_R : UCD_BIDI_CLASS_L)
+
+typedef struct bidi_paragraph_
+{
+	const codepoint_t *in;
+	size_t n;
+	uint8_t level;     /* The paragraph embedding level. */
+	uint8_t *types;    /* The bidi class of each codepoint, as resolved by the rules. */
+	uint8_t *levels;   /* The embedding level of each codepoint. */
+	size_t *sequence;  /* The codepoints in the current isolating run sequence. */
+	size_t *brackets;  /* The offset of the closing bracket for each opening bracket in the sequence. */
+	size_t *matches;   /* The offset of the matching PDI or isolate initiator (BD9), or n. */
+} bidi_paragraph;
+
+typedef struct directional_status_
+{
+	uint8_t level;
+	uint8_t override; /* L, R or ON (neutral) */
+	uint8_t isolate;
+} directional_status;
+
+/* Find the matching PDI for each isolate initiator, and the matching isolate
+ * initiator for each PDI (BD9). This uses the matches array as the stack of
+ * open isolate initiators, so the matches are found in a single pass.
+ */
+static void find_isolate_pairs(bidi_paragraph *p)
+{
+	size_t i, j, top = p->n;
+	for (i = 0; i < p->n; ++i)
+	{
+		p->matches[i] = p->n;
+		switch (p->types[i])
+		{
+		case UCD_BIDI_CLASS_LRI:
+		case UCD_BIDI_CLASS_RLI:
+		case UCD_BIDI_CLASS_FSI:
+			p->matches[i] = top;
+			top = i;
+			break;
+		case UCD_BIDI_CLASS_PDI:
+			if (top != p->n)
+			{
+				j = top;
+				top = p->matches[j];
+				p->matches[j] = i;
+				p->matches[i] = j;
+			}
+			break;
+		case UCD_BIDI_CLASS_B:
+			for (; top != p->n; top = j)
+			{
+				j = p->matches[top];
+				p->matches[top] = p->n;
+			}
+			break;
+		default:
+			break;
+		}
+	}
+	for (; top != p->n; top = j)
+	{
+		j = p->matches[top];
+		p->matches[top] = p->n;
+	}
+}
+
+/* Return the direction (L or R) of the first strong character between start
+ * and end, skipping the characters between an isolate initiator and its
+ * matching PDI (P2), or -1 if there is no strong character. The end of an FSI
+ * is its matching PDI, so this can be used to find its direction (X5c).
+ */
+static int first_strong(const bidi_paragraph *p, size_t start, size_t end)
+{
+	size_t i;
+	for (i = start; i < end; ++i)
+	{
+		switch (p->types[i])
+		{
+		case UCD_BIDI_CLASS_L:
+			return UCD_BIDI_CLASS_L;
+		case UCD_BIDI_CLASS_R:
+		case UCD_BIDI_CLASS_AL:
+			return UCD_BIDI_CLASS_R;
+		case UCD_BIDI_CLASS_LRI:
+		case UCD_BIDI_CLASS_RLI:
+		case UCD_BIDI_CLASS_FSI:
+			if (p->matches[i] >= end)
+				return -1;
+			i = p->matches[i];
+			break;
+		case UCD_BIDI_CLASS_B:
+			return -1;
+		}
+	}
+	return -1;
+}
+
+/* Resolve the explicit embedding levels and directions (X1-X8), and remove
+ * the embedding and override formatting characters and BN characters (X9).
+ */
+static void resolve_explicit(bidi_paragraph *p)
+{
+	directional_status stack[MAX_DEPTH + 2];
+	size_t top = 0, i;
+	size_t overflow_isolates = 0, overflow_embeddings = 0, valid_isolates = 0;
+	uint8_t t, level;
+
+	stack[0].level = p->level;
+	stack[0].override = UCD_BIDI_CLASS_ON;
+	stack[0].isolate = 0;
+
+	for (i = 0; i < p->n; ++i)
+	{
+		t = p->types[i];
+		switch (t)
+		{
+		case UCD_BIDI_CLASS_RLE:
+		case UCD_BIDI_CLASS_LRE:
+		case UCD_BIDI_CLASS_RLO:
+		case UCD_BIDI_CLASS_LRO: /* X2 - X5 */
+			if (t == UCD_BIDI_CLASS_RLE || t == UCD_BIDI_CLASS_RLO)
+				level = (stack[top].level + 1) | 1;
+			else
+				level = (stack[top].level + 2) & ~1;
+			if (level <= MAX_DEPTH && overflow_isolates == 0 && overflow_embeddings == 0)
+			{
+				++top;
+				stack[top].level = level;
+				if (t == UCD_BIDI_CLASS_RLO)
+					stack[top].override = UCD_BIDI_CLASS_R;
+				else if (t == UCD_BIDI_CLASS_LRO)
+					stack[top].override = UCD_BIDI_CLASS_L;
+				else
+					stack[top].override = UCD_BIDI_CLASS_ON;
+				stack[top].isolate = 0;
+			}
+			else if (overflow_isolates == 0)
+				++overflow_embeddings;
+			p->levels[i] = stack[top].level;
+			p->types[i] = UCD_BIDI_CLASS_BN;
+			break;
+		case UCD_BIDI_CLASS_RLI:
+		case UCD_BIDI_CLASS_LRI:
+		case UCD_BIDI_CLASS_FSI: /* X5a - X5c */
+			p->levels[i] = stack[top].level;
+			if (stack[top].override != UCD_BIDI_CLASS_ON)
+				p->types[i] = stack[top].override;
+			if (t == UCD_BIDI_CLASS_FSI)
+				t = first_strong(p, i + 1, p->matches[i]) == UCD_BIDI_CLASS_R ? UCD_BIDI_CLASS_RLI : UCD_BIDI_CLASS_LRI;
+			if (t == UCD_BIDI_CLASS_RLI)
+				level = (stack[top].level + 1) | 1;
+			else
+				level = (stack[top].level + 2) & ~1;
+			if (level <= MAX_DEPTH && overflow_isolates == 0 && overflow_embeddings == 0)
+			{
+				++valid_isolates;
+				++top;
+				stack[top].level = level;
+				stack[top].override = UCD_BIDI_CLASS_ON;
+				stack[top].isolate = 1;
+			}
+			else
+				++overflow_isolates;
+			break;
+		case UCD_BIDI_CLASS_PDI: /* X6a */
+			if (overflow_isolates > 0)
+				--overflow_isolates;
+			else if (valid_isolates > 0)
+			{
+				overflow_embeddings = 0;
+				while (!stack[top].isolate)
+					--top;
+				--top;
+				--valid_isolates;
+			}
+			p->levels[i] = stack[top].level;
+			if (stack[top].override != UCD_BIDI_CLASS_ON)
+				p->types[i] = stack[top].override;
+			break;
+		case UCD_BIDI_CLASS_PDF: /* X7 */
+			if (overflow_isolates > 0)
+				;
+			else if (overflow_embeddings > 0)
+				--overflow_embeddings;
+			else if (!stack[top].isolate && top > 0)
+				--top;
+			p->levels[i] = stack[top].level;
+			p->types[i] = UCD_BIDI_CLASS_BN;
+			break;
+		case UCD_BIDI_CLASS_B: /* X8 */
+			p->levels[i] = p->level;
+			break;
+		case UCD_BIDI_CLASS_BN:
+			p->levels[i] = stack[top].level;
+			break;
+		default: /* X6 */
+			p->levels[i] = stack[top].level;
+			if (stack[top].override != UCD_BIDI_CLASS_ON)
+				p->types[i] = stack[top].override;
+			break;
+		}
+	}
+}
+
+/* Return L for L, and R for R, AN and EN (N0, N1), or -1 otherwise. */
+static int strong_direction(uint8_t t)
+{
+	switch (t)
+	{
+	case UCD_BIDI_CLASS_L:
+		return UCD_BIDI_CLASS_L;
+	case UCD_BIDI_CLASS_R:
+	case UCD_BIDI_CLASS_AN:
+	case UCD_BIDI_CLASS_EN:
+		return UCD_BIDI_CLASS_R;
+	default:
+		return -1;
+	}
+}
+
+#define TYPE(k) p->types[p->sequence[k]]
+
+/* Resolve the weak types in an isolating run sequence (W1-W7). */
+static void resolve_weak(bidi_paragraph *p, size_t m, uint8_t sos)
+{
+	size_t k, end;
+	uint8_t prev, strong, t;
+
+	for (k = 0, prev = sos; k < m; ++k) /* W1 */
+	{
+		if (TYPE(k) == UCD_BIDI_CLASS_NSM)
+			TYPE(k) = IS_ISOLATE_INITIATOR(prev) || prev == UCD_BIDI_CLASS_PDI ? UCD_BIDI_CLASS_ON : prev;
+		prev = TYPE(k);
+	}
+
+	for (k = 0, strong = sos; k < m; ++k) /* W2, W3 */
+	{
+		switch (TYPE(k))
+		{
+		case UCD_BIDI_CLASS_L:
+		case UCD_BIDI_CLASS_R:
+			strong = TYPE(k);
+			break;
+		case UCD_BIDI_CLASS_AL:
+			strong = UCD_BIDI_CLASS_AL;
+			TYPE(k) = UCD_BIDI_CLASS_R;
+			break;
+		case UCD_BIDI_CLASS_EN:
+			if (strong == UCD_BIDI_CLASS_AL)
+				TYPE(k) = UCD_BIDI_CLASS_AN;
+			break;
+		}
+	}
+
+	for (k = 1; k + 1 < m; ++k) /* W4 */
+	{
+		t = TYPE(k);
+		if (t == UCD_BIDI_CLASS_ES && TYPE(k - 1) == UCD_BIDI_CLASS_EN && TYPE(k + 1) == UCD_BIDI_CLASS_EN)
+			TYPE(k) = UCD_BIDI_CLASS_EN;
+		else if (t == UCD_BIDI_CLASS_CS && TYPE(k - 1) == TYPE(k + 1) &&
+		         (TYPE(k - 1) == UCD_BIDI_CLASS_EN || TYPE(k - 1) == UCD_BIDI_CLASS_AN))
+			TYPE(k) = TYPE(k - 1);
+	}
+
+	for (k = 0; k < m; ) /* W5, W6 */
+	{
+		t = TYPE(k);
+		if (t == UCD_BIDI_CLASS_ET)
+		{
+			for (end = k + 1; end < m && TYPE(end) == UCD_BIDI_CLASS_ET; ++end)
+				;
+			if ((k > 0 && TYPE(k - 1) == UCD_BIDI_CLASS_EN) || (end < m && TYPE(end) == UCD_BIDI_CLASS_EN))
+				t = UCD_BIDI_CLASS_EN;
+			else
+				t = UCD_BIDI_CLASS_ON;
+			for (; k < end; ++k)
+				TYPE(k) = t;
+		}
+		else
+		{
+			if (t == UCD_BIDI_CLASS_ES || t == UCD_BIDI_CLASS_CS)
+				TYPE(k) = UCD_BIDI_CLASS_ON;
+			++k;
+		}
+	}
+
+	for (k = 0, strong = sos; k < m; ++k) /* W7 */
+	{
+		t = TYPE(k);
+		if (t == UCD_BIDI_CLASS_L || t == UCD_BIDI_CLASS_R)
+			strong = t;
+		else if (t == UCD_BIDI_CLASS_EN && strong == UCD_BIDI_CLASS_L)
+			TYPE(k) = UCD_BIDI_CLASS_L;
+	}
+}
+
+/* Return the canonical equivalent of a bracket, so U+2329 and U+3008 (and
+ * U+232A and U+3009) are matched as the same bracket (BD16).
+ */
+static codepoint_t canonical_bracket(codepoint_t c)
+{
+	codepoint_t decomposed[UCD_MAX_DECOMPOSITION];
+	if (ucd_decompose(c, UCD_NFD, decomposed) == 1)
+		return decomposed[0];
+	return c;
+}
+
+/* Find the bracket pairs in an isolating run sequence (BD16). */
+static void find_bracket_pairs(bidi_paragraph *p, size_t m)
+{
+	codepoint_t closing[MAX_BRACKETS];
+	size_t opening[MAX_BRACKETS];
+	size_t k, depth = 0, d;
+	codepoint_t c;
+
+	for (k = 0; k < m; ++k)
+	{
+		p->brackets[k] = 0;
+		if (TYPE(k) != UCD_BIDI_CLASS_ON)
+			continue;
+		c = p->in[p->sequence[k]];
+		switch (ucd_lookup_bidi_paired_bracket_type(c))
+		{
+		case UCD_BIDI_PAIRED_BRACKET_TYPE_OPEN:
+			if (depth == MAX_BRACKETS)
+			{
+				for (; k < m; ++k)
+					p->brackets[k] = 0;
+				return;
+			}
+			closing[depth] = canonical_bracket(ucd_lookup_bidi_paired_bracket(c));
+			opening[depth] = k;
+			++depth;
+			break;
+		case UCD_BIDI_PAIRED_BRACKET_TYPE_CLOSE:
+			c = canonical_bracket(c);
+			for (d = depth; d > 0; --d)
+			{
+				if (closing[d - 1] == c)
+				{
+					p->brackets[opening[d - 1]] = k;
+					depth = d - 1;
+					break;
+				}
+			}
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+/* Set the type of a paired bracket, and the NSM characters following it (N0). */
+static void set_bracket_type(bidi_paragraph *p, size_t m, size_t k, uint8_t t)
+{
+	TYPE(k) = t;
+	for (++k; k < m && ucd_lookup_bidi_class(p->in[p->sequence[k]]) == UCD_BIDI_CLASS_NSM; ++k)
+		TYPE(k) = t;
+}
+
+/* Resolve the paired brackets in an isolating run sequence (N0). */
+static void resolve_brackets(bidi_paragraph *p, size_t m, uint8_t sos, uint8_t level)
+{
+	int embedding = EMBEDDING_DIRECTION(level);
+	int opposite = embedding == UCD_BIDI_CLASS_L ? UCD_BIDI_CLASS_R : UCD_BIDI_CLASS_L;
+	int strong, direction, context;
+	size_t open, close, k;
+
+	find_bracket_pairs(p, m);
+	for (open = 0; open < m; ++open)
+	{
+		close = p->brackets[open];
+		if (close == 0)
+			continue;
+
+		direction = -1;
+		for (k = open + 1; k < close; ++k)
+		{
+			strong = strong_direction(TYPE(k));
+			if (strong == embedding)
+			{
+				direction = embedding;
+				break;
+			}
+			if (strong == opposite)
+				direction = opposite;
+		}
+
+		if (direction == -1) /* N0 d: no strong types in the brackets */
+			continue;
+		if (direction == opposite) /* N0 c: check the context before the brackets */
+		{
+			context = sos;
+			for (k = open; k > 0; --k)
+			{
+				strong = strong_direction(TYPE(k - 1));
+				if (strong != -1)
+				{
+					context = strong;
+					break;
+				}
+			}
+			if (context != opposite)
+				direction = embedding;
+		}
+
+		set_bracket_type(p, m, open, (uint8_t)direction);
+		set_bracket_type(p, m, close, (uint8_t)direction);
+	}
+}
+
+/* Resolve the neutral and isolate formatting types in an isolating run
+ * sequence (N1, N2).
+ */
+static void resolve_neutral(bidi_paragraph *p, size_t m, uint8_t sos, uint8_t eos, uint8_t level)
+{
+	size_t k, end;
+	int before, after;
+	uint8_t t;
+
+	for (k = 0; k < m; k = end)
+	{
+		if (!IS_NEUTRAL(TYPE(k)))
+		{
+			end = k + 1;
+			continue;
+		}
+
+		for (end = k + 1; end < m && IS_NEUTRAL(TYPE(end)); ++end)
+			;
+		before = k == 0 ? sos : strong_direction(TYPE(k - 1));
+		after = end == m ? eos : strong_direction(TYPE(end));
+		t = before == after ? (uint8_t)before : EMBEDDING_DIRECTION(level);
+		for (; k < end; ++k)
+			TYPE(k) = t;
+	}
+}
+
+/* Resolve the types in the isolating run sequence starting at the level run
+ * at offset start (X10), returning the offset of the end of that level run.
+ */
+static size_t resolve_sequence(bidi_paragraph *p, size_t start)
+{
+	size_t m = 0, i = start, j, last = start, run_end = p->n;
+	uint8_t level = p->levels[start], sos, eos, adjacent;
+
+	for (;;)
+	{
+		for (j = i; j < p->n; ++j)
+		{
+			if (IS_REMOVED(p->types[j]))
+				continue;
+			if (p->levels[j] != level)
+				break;
+			p->sequence[m++] = j;
+			last = j;
+		}
+		if (i == start)
+			run_end = j;
+
+		if (!IS_ISOLATE_INITIATOR(ucd_lookup_bidi_class(p->in[last])))
+			break;
+		i = p->matches[last];
+		if (i == p->n)
+			break;
+	}
+
+	adjacent = p->level;
+	for (j = start; j > 0; --j)
+	{
+		if (!IS_REMOVED(p->types[j - 1]))
+		{
+			adjacent = p->levels[j - 1];
+			break;
+		}
+	}
+	sos = EMBEDDING_DIRECTION(level > adjacent ? level : adjacent);
+
+	adjacent = p->level;
+	if (!IS_ISOLATE_INITIATOR(ucd_lookup_bidi_class(p->in[last])))
+	{
+		for (j = last + 1; j < p->n; ++j)
+		{
+			if (!IS_REMOVED(p->types[j]))
+			{
+				adjacent = p->levels[j];
+				break;
+			}
+		}
+	}
+	eos = EMBEDDING_DIRECTION(level > adjacent ? level : adjacent);
+
+	resolve_weak(p, m, sos);
+	resolve_brackets(p, m, sos, level);
+	resolve_neutral(p, m, sos, eos, level);
+	return run_end;
+}
+
+/* Resolve the implicit levels (I1, I2), give the removed characters the level
+ * of the preceding character, and reset the separators and trailing
+ * whitespace to the paragraph level (L1).
+ */
+static void resolve_levels(bidi_paragraph *p)
+{
+	size_t i;
+	int trailing = 1;
+	uint8_t t;
+
+	for (i = 0; i < p->n; ++i)
+	{
+		t = p->types[i];
+		if (IS_REMOVED(t))
+			p->levels[i] = i == 0 ? p->level : p->levels[i - 1];
+		else if ((p->levels[i] & 1) == 0)
+		{
+			if (t == UCD_BIDI_CLASS_R)
+				p->levels[i] += 1;
+			else if (t == UCD_BIDI_CLASS_AN || t == UCD_BIDI_CLASS_EN)
+				p->levels[i] += 2;
+		}
+		else if (t == UCD_BIDI_CLASS_L || t == UCD_BIDI_CLASS_AN || t == UCD_BIDI_CLASS_EN)
+			p->levels[i] += 1;
+	}
+
+	for (i = p->n; i > 0; --i)
+	{
+		switch (ucd_lookup_bidi_class(p->in[i - 1]))
+		{
+		case UCD_BIDI_CLASS_S:
+		case UCD_BIDI_CLASS_B:
+			p->levels[i - 1] = p->level;
+			trailing = 1;
+			break;
+		case UCD_BIDI_CLASS_WS:
+		case UCD_BIDI_CLASS_FSI:
+		case UCD_BIDI_CLASS_LRI:
+		case UCD_BIDI_CLASS_RLI:
+		case UCD_BIDI_CLASS_PDI:
+			if (trailing)
+				p->levels[i - 1] = p->level;
+			break;
+		default:
+			if (IS_REMOVED(p->types[i - 1]) && trailing)
+				p->levels[i - 1] = p->level;
+			else
+				trailing = 0;
+			break;
+		}
+	}
+}
+
+int ucd_utf32_bidi_levels(const codepoint_t *in, size_t n, ucd_bidi_direction direction, uint8_t *levels)
+{
+	bidi_paragraph p;
+	size_t i;
+
+	if (n == 0)
+		return direction == UCD_BIDI_DIRECTION_RTL ? 1 : 0;
+
+	if (direction != UCD_BIDI_DIRECTION_RTL)
+	{
+		for (i = 0; i < n; ++i)
+		{
+			if (in[i] >= 0x80 && ((1ul << ucd_lookup_bidi_class(in[i])) & RTL_CLASSES))
+				break;
+		}
+		if (i == n) /* all the codepoints have a level of 0 */
+		{
+			memset(levels, 0, n);
+			return 0;
+		}
+	}
+
+	p.sequence = malloc(n * (3 * sizeof(size_t) + 1));
+	if (!p.sequence)
+		return -1;
+	p.brackets = p.sequence + n;
+	p.matches = p.brackets + n;
+	p.types = (uint8_t *)(p.matches + n);
+	p.levels = levels;
+	p.in = in;
+	p.n = n;
+	ucd_lookup_bidi_class_n(in, n, p.types);
+	find_isolate_pairs(&p);
+
+	if (direction == UCD_BIDI_DIRECTION_AUTO) /* P2, P3 */
+		p.level = first_strong(&p, 0, n) == UCD_BIDI_CLASS_R ? 1 : 0;
+	else
+		p.level = direction == UCD_BIDI_DIRECTION_RTL ? 1 : 0;
+
+	resolve_explicit(&p);
+
+	for (i = 0; i < n; )
+	{
+		if (IS_REMOVED(p.types[i]))
+			++i;
+		else if (p.matches[i] < i) /* a PDI with a matching isolate initiator */
+		{
+			/* The level run continues the isolating run sequence of its
+			 * isolate initiator, so has already been resolved. */
+			uint8_t level = p.levels[i];
+			for (++i; i < n && (IS_REMOVED(p.types[i]) || p.levels[i] == level); ++i)
+				;
+		}
+		else
+			i = resolve_sequence(&p, i);
+	}
+
+	resolve_levels(&p);
+	free(p.sequence);
+	return p.level;
+}
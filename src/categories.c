@@ -3705,7 +3705,7 @@ static const uint8_t *categories_0E0000_0E01FF[] =
 	categories_0E0100,
 };
 
-ucd_category ucd_lookup_category(codepoint_t c)
+static ucd_category lookup_category(codepoint_t c)
 {
 	if (c <= 0x00D7FF) /* 000000..00D7FF */
 	{
@@ -3733,6 +3733,18 @@ ucd_category ucd_lookup_category(codepoint_t c)
 	return Ii; /* Invalid Unicode Codepoint */
 }
 
+ucd_category ucd_lookup_category(codepoint_t c)
+{
+	return lookup_category(c);
+}
+
+void ucd_lookup_category_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint8_t)lookup_category(in[i]);
+}
+
 ucd_category_group ucd_get_category_group_for_category(ucd_category c)
 {
 	switch (c)
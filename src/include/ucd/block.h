@@ -0,0 +1,348 @@
+/* Unicode Character Database API : Block Codes
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UNICODE_CHARACTER_DATA_BLOCKS_H
+#define UNICODE_CHARACTER_DATA_BLOCKS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Unicode Block
+  *
+  * The blocks are in codepoint order, using the Block property value aliases.
+  *
+  * @see   http://www.unicode.org/reports/tr44/
+  */
+typedef enum ucd_block_
+{
+	UCD_BLOCK_NB, /**< @brief No Block */
+	UCD_BLOCK_ASCII, /**< @brief Basic Latin */
+	UCD_BLOCK_Latin_1_Sup, /**< @brief Latin-1 Supplement */
+	UCD_BLOCK_Latin_Ext_A, /**< @brief Latin Extended-A */
+	UCD_BLOCK_Latin_Ext_B, /**< @brief Latin Extended-B */
+	UCD_BLOCK_IPA_Ext, /**< @brief IPA Extensions */
+	UCD_BLOCK_Modifier_Letters, /**< @brief Spacing Modifier Letters */
+	UCD_BLOCK_Diacriticals, /**< @brief Combining Diacritical Marks */
+	UCD_BLOCK_Greek, /**< @brief Greek and Coptic */
+	UCD_BLOCK_Cyrillic, /**< @brief Cyrillic */
+	UCD_BLOCK_Cyrillic_Sup, /**< @brief Cyrillic Supplement */
+	UCD_BLOCK_Armenian, /**< @brief Armenian */
+	UCD_BLOCK_Hebrew, /**< @brief Hebrew */
+	UCD_BLOCK_Arabic, /**< @brief Arabic */
+	UCD_BLOCK_Syriac, /**< @brief Syriac */
+	UCD_BLOCK_Arabic_Sup, /**< @brief Arabic Supplement */
+	UCD_BLOCK_Thaana, /**< @brief Thaana */
+	UCD_BLOCK_NKo, /**< @brief NKo */
+	UCD_BLOCK_Samaritan, /**< @brief Samaritan */
+	UCD_BLOCK_Mandaic, /**< @brief Mandaic */
+	UCD_BLOCK_Syriac_Sup, /**< @brief Syriac Supplement */
+	UCD_BLOCK_Arabic_Ext_A, /**< @brief Arabic Extended-A */
+	UCD_BLOCK_Devanagari, /**< @brief Devanagari */
+	UCD_BLOCK_Bengali, /**< @brief Bengali */
+	UCD_BLOCK_Gurmukhi, /**< @brief Gurmukhi */
+	UCD_BLOCK_Gujarati, /**< @brief Gujarati */
+	UCD_BLOCK_Oriya, /**< @brief Oriya */
+	UCD_BLOCK_Tamil, /**< @brief Tamil */
+	UCD_BLOCK_Telugu, /**< @brief Telugu */
+	UCD_BLOCK_Kannada, /**< @brief Kannada */
+	UCD_BLOCK_Malayalam, /**< @brief Malayalam */
+	UCD_BLOCK_Sinhala, /**< @brief Sinhala */
+	UCD_BLOCK_Thai, /**< @brief Thai */
+	UCD_BLOCK_Lao, /**< @brief Lao */
+	UCD_BLOCK_Tibetan, /**< @brief Tibetan */
+	UCD_BLOCK_Myanmar, /**< @brief Myanmar */
+	UCD_BLOCK_Georgian, /**< @brief Georgian */
+	UCD_BLOCK_Jamo, /**< @brief Hangul Jamo */
+	UCD_BLOCK_Ethiopic, /**< @brief Ethiopic */
+	UCD_BLOCK_Ethiopic_Sup, /**< @brief Ethiopic Supplement */
+	UCD_BLOCK_Cherokee, /**< @brief Cherokee */
+	UCD_BLOCK_UCAS, /**< @brief Unified Canadian Aboriginal Syllabics */
+	UCD_BLOCK_Ogham, /**< @brief Ogham */
+	UCD_BLOCK_Runic, /**< @brief Runic */
+	UCD_BLOCK_Tagalog, /**< @brief Tagalog */
+	UCD_BLOCK_Hanunoo, /**< @brief Hanunoo */
+	UCD_BLOCK_Buhid, /**< @brief Buhid */
+	UCD_BLOCK_Tagbanwa, /**< @brief Tagbanwa */
+	UCD_BLOCK_Khmer, /**< @brief Khmer */
+	UCD_BLOCK_Mongolian, /**< @brief Mongolian */
+	UCD_BLOCK_UCAS_Ext, /**< @brief Unified Canadian Aboriginal Syllabics Extended */
+	UCD_BLOCK_Limbu, /**< @brief Limbu */
+	UCD_BLOCK_Tai_Le, /**< @brief Tai Le */
+	UCD_BLOCK_New_Tai_Lue, /**< @brief New Tai Lue */
+	UCD_BLOCK_Khmer_Symbols, /**< @brief Khmer Symbols */
+	UCD_BLOCK_Buginese, /**< @brief Buginese */
+	UCD_BLOCK_Tai_Tham, /**< @brief Tai Tham */
+	UCD_BLOCK_Diacriticals_Ext, /**< @brief Combining Diacritical Marks Extended */
+	UCD_BLOCK_Balinese, /**< @brief Balinese */
+	UCD_BLOCK_Sundanese, /**< @brief Sundanese */
+	UCD_BLOCK_Batak, /**< @brief Batak */
+	UCD_BLOCK_Lepcha, /**< @brief Lepcha */
+	UCD_BLOCK_Ol_Chiki, /**< @brief Ol Chiki */
+	UCD_BLOCK_Cyrillic_Ext_C, /**< @brief Cyrillic Extended-C */
+	UCD_BLOCK_Georgian_Ext, /**< @brief Georgian Extended */
+	UCD_BLOCK_Sundanese_Sup, /**< @brief Sundanese Supplement */
+	UCD_BLOCK_Vedic_Ext, /**< @brief Vedic Extensions */
+	UCD_BLOCK_Phonetic_Ext, /**< @brief Phonetic Extensions */
+	UCD_BLOCK_Phonetic_Ext_Sup, /**< @brief Phonetic Extensions Supplement */
+	UCD_BLOCK_Diacriticals_Sup, /**< @brief Combining Diacritical Marks Supplement */
+	UCD_BLOCK_Latin_Ext_Additional, /**< @brief Latin Extended Additional */
+	UCD_BLOCK_Greek_Ext, /**< @brief Greek Extended */
+	UCD_BLOCK_Punctuation, /**< @brief General Punctuation */
+	UCD_BLOCK_Super_And_Sub, /**< @brief Superscripts and Subscripts */
+	UCD_BLOCK_Currency_Symbols, /**< @brief Currency Symbols */
+	UCD_BLOCK_Diacriticals_For_Symbols, /**< @brief Combining Diacritical Marks for Symbols */
+	UCD_BLOCK_Letterlike_Symbols, /**< @brief Letterlike Symbols */
+	UCD_BLOCK_Number_Forms, /**< @brief Number Forms */
+	UCD_BLOCK_Arrows, /**< @brief Arrows */
+	UCD_BLOCK_Math_Operators, /**< @brief Mathematical Operators */
+	UCD_BLOCK_Misc_Technical, /**< @brief Miscellaneous Technical */
+	UCD_BLOCK_Control_Pictures, /**< @brief Control Pictures */
+	UCD_BLOCK_OCR, /**< @brief Optical Character Recognition */
+	UCD_BLOCK_Enclosed_Alphanum, /**< @brief Enclosed Alphanumerics */
+	UCD_BLOCK_Box_Drawing, /**< @brief Box Drawing */
+	UCD_BLOCK_Block_Elements, /**< @brief Block Elements */
+	UCD_BLOCK_Geometric_Shapes, /**< @brief Geometric Shapes */
+	UCD_BLOCK_Misc_Symbols, /**< @brief Miscellaneous Symbols */
+	UCD_BLOCK_Dingbats, /**< @brief Dingbats */
+	UCD_BLOCK_Misc_Math_Symbols_A, /**< @brief Miscellaneous Mathematical Symbols-A */
+	UCD_BLOCK_Sup_Arrows_A, /**< @brief Supplemental Arrows-A */
+	UCD_BLOCK_Braille, /**< @brief Braille Patterns */
+	UCD_BLOCK_Sup_Arrows_B, /**< @brief Supplemental Arrows-B */
+	UCD_BLOCK_Misc_Math_Symbols_B, /**< @brief Miscellaneous Mathematical Symbols-B */
+	UCD_BLOCK_Sup_Math_Operators, /**< @brief Supplemental Mathematical Operators */
+	UCD_BLOCK_Misc_Arrows, /**< @brief Miscellaneous Symbols and Arrows */
+	UCD_BLOCK_Glagolitic, /**< @brief Glagolitic */
+	UCD_BLOCK_Latin_Ext_C, /**< @brief Latin Extended-C */
+	UCD_BLOCK_Coptic, /**< @brief Coptic */
+	UCD_BLOCK_Georgian_Sup, /**< @brief Georgian Supplement */
+	UCD_BLOCK_Tifinagh, /**< @brief Tifinagh */
+	UCD_BLOCK_Ethiopic_Ext, /**< @brief Ethiopic Extended */
+	UCD_BLOCK_Cyrillic_Ext_A, /**< @brief Cyrillic Extended-A */
+	UCD_BLOCK_Sup_Punctuation, /**< @brief Supplemental Punctuation */
+	UCD_BLOCK_CJK_Radicals_Sup, /**< @brief CJK Radicals Supplement */
+	UCD_BLOCK_Kangxi, /**< @brief Kangxi Radicals */
+	UCD_BLOCK_IDC, /**< @brief Ideographic Description Characters */
+	UCD_BLOCK_CJK_Symbols, /**< @brief CJK Symbols and Punctuation */
+	UCD_BLOCK_Hiragana, /**< @brief Hiragana */
+	UCD_BLOCK_Katakana, /**< @brief Katakana */
+	UCD_BLOCK_Bopomofo, /**< @brief Bopomofo */
+	UCD_BLOCK_Compat_Jamo, /**< @brief Hangul Compatibility Jamo */
+	UCD_BLOCK_Kanbun, /**< @brief Kanbun */
+	UCD_BLOCK_Bopomofo_Ext, /**< @brief Bopomofo Extended */
+	UCD_BLOCK_CJK_Strokes, /**< @brief CJK Strokes */
+	UCD_BLOCK_Katakana_Ext, /**< @brief Katakana Phonetic Extensions */
+	UCD_BLOCK_Enclosed_CJK, /**< @brief Enclosed CJK Letters and Months */
+	UCD_BLOCK_CJK_Compat, /**< @brief CJK Compatibility */
+	UCD_BLOCK_CJK_Ext_A, /**< @brief CJK Unified Ideographs Extension A */
+	UCD_BLOCK_Yijing, /**< @brief Yijing Hexagram Symbols */
+	UCD_BLOCK_CJK, /**< @brief CJK Unified Ideographs */
+	UCD_BLOCK_Yi_Syllables, /**< @brief Yi Syllables */
+	UCD_BLOCK_Yi_Radicals, /**< @brief Yi Radicals */
+	UCD_BLOCK_Lisu, /**< @brief Lisu */
+	UCD_BLOCK_Vai, /**< @brief Vai */
+	UCD_BLOCK_Cyrillic_Ext_B, /**< @brief Cyrillic Extended-B */
+	UCD_BLOCK_Bamum, /**< @brief Bamum */
+	UCD_BLOCK_Modifier_Tone_Letters, /**< @brief Modifier Tone Letters */
+	UCD_BLOCK_Latin_Ext_D, /**< @brief Latin Extended-D */
+	UCD_BLOCK_Syloti_Nagri, /**< @brief Syloti Nagri */
+	UCD_BLOCK_Indic_Number_Forms, /**< @brief Common Indic Number Forms */
+	UCD_BLOCK_Phags_Pa, /**< @brief Phags-pa */
+	UCD_BLOCK_Saurashtra, /**< @brief Saurashtra */
+	UCD_BLOCK_Devanagari_Ext, /**< @brief Devanagari Extended */
+	UCD_BLOCK_Kayah_Li, /**< @brief Kayah Li */
+	UCD_BLOCK_Rejang, /**< @brief Rejang */
+	UCD_BLOCK_Jamo_Ext_A, /**< @brief Hangul Jamo Extended-A */
+	UCD_BLOCK_Javanese, /**< @brief Javanese */
+	UCD_BLOCK_Myanmar_Ext_B, /**< @brief Myanmar Extended-B */
+	UCD_BLOCK_Cham, /**< @brief Cham */
+	UCD_BLOCK_Myanmar_Ext_A, /**< @brief Myanmar Extended-A */
+	UCD_BLOCK_Tai_Viet, /**< @brief Tai Viet */
+	UCD_BLOCK_Meetei_Mayek_Ext, /**< @brief Meetei Mayek Extensions */
+	UCD_BLOCK_Ethiopic_Ext_A, /**< @brief Ethiopic Extended-A */
+	UCD_BLOCK_Latin_Ext_E, /**< @brief Latin Extended-E */
+	UCD_BLOCK_Cherokee_Sup, /**< @brief Cherokee Supplement */
+	UCD_BLOCK_Meetei_Mayek, /**< @brief Meetei Mayek */
+	UCD_BLOCK_Hangul, /**< @brief Hangul Syllables */
+	UCD_BLOCK_Jamo_Ext_B, /**< @brief Hangul Jamo Extended-B */
+	UCD_BLOCK_High_Surrogates, /**< @brief High Surrogates */
+	UCD_BLOCK_High_PU_Surrogates, /**< @brief High Private Use Surrogates */
+	UCD_BLOCK_Low_Surrogates, /**< @brief Low Surrogates */
+	UCD_BLOCK_PUA, /**< @brief Private Use Area */
+	UCD_BLOCK_CJK_Compat_Ideographs, /**< @brief CJK Compatibility Ideographs */
+	UCD_BLOCK_Alphabetic_PF, /**< @brief Alphabetic Presentation Forms */
+	UCD_BLOCK_Arabic_PF_A, /**< @brief Arabic Presentation Forms-A */
+	UCD_BLOCK_VS, /**< @brief Variation Selectors */
+	UCD_BLOCK_Vertical_Forms, /**< @brief Vertical Forms */
+	UCD_BLOCK_Half_Marks, /**< @brief Combining Half Marks */
+	UCD_BLOCK_CJK_Compat_Forms, /**< @brief CJK Compatibility Forms */
+	UCD_BLOCK_Small_Forms, /**< @brief Small Form Variants */
+	UCD_BLOCK_Arabic_PF_B, /**< @brief Arabic Presentation Forms-B */
+	UCD_BLOCK_Half_And_Full_Forms, /**< @brief Halfwidth and Fullwidth Forms */
+	UCD_BLOCK_Specials, /**< @brief Specials */
+	UCD_BLOCK_Linear_B_Syllabary, /**< @brief Linear B Syllabary */
+	UCD_BLOCK_Linear_B_Ideograms, /**< @brief Linear B Ideograms */
+	UCD_BLOCK_Aegean_Numbers, /**< @brief Aegean Numbers */
+	UCD_BLOCK_Ancient_Greek_Numbers, /**< @brief Ancient Greek Numbers */
+	UCD_BLOCK_Ancient_Symbols, /**< @brief Ancient Symbols */
+	UCD_BLOCK_Phaistos, /**< @brief Phaistos Disc */
+	UCD_BLOCK_Lycian, /**< @brief Lycian */
+	UCD_BLOCK_Carian, /**< @brief Carian */
+	UCD_BLOCK_Coptic_Epact_Numbers, /**< @brief Coptic Epact Numbers */
+	UCD_BLOCK_Old_Italic, /**< @brief Old Italic */
+	UCD_BLOCK_Gothic, /**< @brief Gothic */
+	UCD_BLOCK_Old_Permic, /**< @brief Old Permic */
+	UCD_BLOCK_Ugaritic, /**< @brief Ugaritic */
+	UCD_BLOCK_Old_Persian, /**< @brief Old Persian */
+	UCD_BLOCK_Deseret, /**< @brief Deseret */
+	UCD_BLOCK_Shavian, /**< @brief Shavian */
+	UCD_BLOCK_Osmanya, /**< @brief Osmanya */
+	UCD_BLOCK_Osage, /**< @brief Osage */
+	UCD_BLOCK_Elbasan, /**< @brief Elbasan */
+	UCD_BLOCK_Caucasian_Albanian, /**< @brief Caucasian Albanian */
+	UCD_BLOCK_Linear_A, /**< @brief Linear A */
+	UCD_BLOCK_Cypriot_Syllabary, /**< @brief Cypriot Syllabary */
+	UCD_BLOCK_Imperial_Aramaic, /**< @brief Imperial Aramaic */
+	UCD_BLOCK_Palmyrene, /**< @brief Palmyrene */
+	UCD_BLOCK_Nabataean, /**< @brief Nabataean */
+	UCD_BLOCK_Hatran, /**< @brief Hatran */
+	UCD_BLOCK_Phoenician, /**< @brief Phoenician */
+	UCD_BLOCK_Lydian, /**< @brief Lydian */
+	UCD_BLOCK_Meroitic_Hieroglyphs, /**< @brief Meroitic Hieroglyphs */
+	UCD_BLOCK_Meroitic_Cursive, /**< @brief Meroitic Cursive */
+	UCD_BLOCK_Kharoshthi, /**< @brief Kharoshthi */
+	UCD_BLOCK_Old_South_Arabian, /**< @brief Old South Arabian */
+	UCD_BLOCK_Old_North_Arabian, /**< @brief Old North Arabian */
+	UCD_BLOCK_Manichaean, /**< @brief Manichaean */
+	UCD_BLOCK_Avestan, /**< @brief Avestan */
+	UCD_BLOCK_Inscriptional_Parthian, /**< @brief Inscriptional Parthian */
+	UCD_BLOCK_Inscriptional_Pahlavi, /**< @brief Inscriptional Pahlavi */
+	UCD_BLOCK_Psalter_Pahlavi, /**< @brief Psalter Pahlavi */
+	UCD_BLOCK_Old_Turkic, /**< @brief Old Turkic */
+	UCD_BLOCK_Old_Hungarian, /**< @brief Old Hungarian */
+	UCD_BLOCK_Hanifi_Rohingya, /**< @brief Hanifi Rohingya */
+	UCD_BLOCK_Rumi, /**< @brief Rumi Numeral Symbols */
+	UCD_BLOCK_Old_Sogdian, /**< @brief Old Sogdian */
+	UCD_BLOCK_Sogdian, /**< @brief Sogdian */
+	UCD_BLOCK_Elymaic, /**< @brief Elymaic */
+	UCD_BLOCK_Brahmi, /**< @brief Brahmi */
+	UCD_BLOCK_Kaithi, /**< @brief Kaithi */
+	UCD_BLOCK_Sora_Sompeng, /**< @brief Sora Sompeng */
+	UCD_BLOCK_Chakma, /**< @brief Chakma */
+	UCD_BLOCK_Mahajani, /**< @brief Mahajani */
+	UCD_BLOCK_Sharada, /**< @brief Sharada */
+	UCD_BLOCK_Sinhala_Archaic_Numbers, /**< @brief Sinhala Archaic Numbers */
+	UCD_BLOCK_Khojki, /**< @brief Khojki */
+	UCD_BLOCK_Multani, /**< @brief Multani */
+	UCD_BLOCK_Khudawadi, /**< @brief Khudawadi */
+	UCD_BLOCK_Grantha, /**< @brief Grantha */
+	UCD_BLOCK_Newa, /**< @brief Newa */
+	UCD_BLOCK_Tirhuta, /**< @brief Tirhuta */
+	UCD_BLOCK_Siddham, /**< @brief Siddham */
+	UCD_BLOCK_Modi, /**< @brief Modi */
+	UCD_BLOCK_Mongolian_Sup, /**< @brief Mongolian Supplement */
+	UCD_BLOCK_Takri, /**< @brief Takri */
+	UCD_BLOCK_Ahom, /**< @brief Ahom */
+	UCD_BLOCK_Dogra, /**< @brief Dogra */
+	UCD_BLOCK_Warang_Citi, /**< @brief Warang Citi */
+	UCD_BLOCK_Nandinagari, /**< @brief Nandinagari */
+	UCD_BLOCK_Zanabazar_Square, /**< @brief Zanabazar Square */
+	UCD_BLOCK_Soyombo, /**< @brief Soyombo */
+	UCD_BLOCK_Pau_Cin_Hau, /**< @brief Pau Cin Hau */
+	UCD_BLOCK_Bhaiksuki, /**< @brief Bhaiksuki */
+	UCD_BLOCK_Marchen, /**< @brief Marchen */
+	UCD_BLOCK_Masaram_Gondi, /**< @brief Masaram Gondi */
+	UCD_BLOCK_Gunjala_Gondi, /**< @brief Gunjala Gondi */
+	UCD_BLOCK_Makasar, /**< @brief Makasar */
+	UCD_BLOCK_Tamil_Sup, /**< @brief Tamil Supplement */
+	UCD_BLOCK_Cuneiform, /**< @brief Cuneiform */
+	UCD_BLOCK_Cuneiform_Numbers, /**< @brief Cuneiform Numbers and Punctuation */
+	UCD_BLOCK_Early_Dynastic_Cuneiform, /**< @brief Early Dynastic Cuneiform */
+	UCD_BLOCK_Egyptian_Hieroglyphs, /**< @brief Egyptian Hieroglyphs */
+	UCD_BLOCK_Egyptian_Hieroglyph_Format_Controls, /**< @brief Egyptian Hieroglyph Format Controls */
+	UCD_BLOCK_Anatolian_Hieroglyphs, /**< @brief Anatolian Hieroglyphs */
+	UCD_BLOCK_Bamum_Sup, /**< @brief Bamum Supplement */
+	UCD_BLOCK_Mro, /**< @brief Mro */
+	UCD_BLOCK_Bassa_Vah, /**< @brief Bassa Vah */
+	UCD_BLOCK_Pahawh_Hmong, /**< @brief Pahawh Hmong */
+	UCD_BLOCK_Medefaidrin, /**< @brief Medefaidrin */
+	UCD_BLOCK_Miao, /**< @brief Miao */
+	UCD_BLOCK_Ideographic_Symbols, /**< @brief Ideographic Symbols and Punctuation */
+	UCD_BLOCK_Tangut, /**< @brief Tangut */
+	UCD_BLOCK_Tangut_Components, /**< @brief Tangut Components */
+	UCD_BLOCK_Kana_Sup, /**< @brief Kana Supplement */
+	UCD_BLOCK_Kana_Ext_A, /**< @brief Kana Extended-A */
+	UCD_BLOCK_Small_Kana_Ext, /**< @brief Small Kana Extension */
+	UCD_BLOCK_Nushu, /**< @brief Nushu */
+	UCD_BLOCK_Duployan, /**< @brief Duployan */
+	UCD_BLOCK_Shorthand_Format_Controls, /**< @brief Shorthand Format Controls */
+	UCD_BLOCK_Byzantine_Music, /**< @brief Byzantine Musical Symbols */
+	UCD_BLOCK_Music, /**< @brief Musical Symbols */
+	UCD_BLOCK_Ancient_Greek_Music, /**< @brief Ancient Greek Musical Notation */
+	UCD_BLOCK_Mayan_Numerals, /**< @brief Mayan Numerals */
+	UCD_BLOCK_Tai_Xuan_Jing, /**< @brief Tai Xuan Jing Symbols */
+	UCD_BLOCK_Counting_Rod, /**< @brief Counting Rod Numerals */
+	UCD_BLOCK_Math_Alphanum, /**< @brief Mathematical Alphanumeric Symbols */
+	UCD_BLOCK_Sutton_SignWriting, /**< @brief Sutton SignWriting */
+	UCD_BLOCK_Glagolitic_Sup, /**< @brief Glagolitic Supplement */
+	UCD_BLOCK_Nyiakeng_Puachue_Hmong, /**< @brief Nyiakeng Puachue Hmong */
+	UCD_BLOCK_Wancho, /**< @brief Wancho */
+	UCD_BLOCK_Mende_Kikakui, /**< @brief Mende Kikakui */
+	UCD_BLOCK_Adlam, /**< @brief Adlam */
+	UCD_BLOCK_Indic_Siyaq_Numbers, /**< @brief Indic Siyaq Numbers */
+	UCD_BLOCK_Ottoman_Siyaq_Numbers, /**< @brief Ottoman Siyaq Numbers */
+	UCD_BLOCK_Arabic_Math, /**< @brief Arabic Mathematical Alphabetic Symbols */
+	UCD_BLOCK_Mahjong, /**< @brief Mahjong Tiles */
+	UCD_BLOCK_Domino, /**< @brief Domino Tiles */
+	UCD_BLOCK_Playing_Cards, /**< @brief Playing Cards */
+	UCD_BLOCK_Enclosed_Alphanum_Sup, /**< @brief Enclosed Alphanumeric Supplement */
+	UCD_BLOCK_Enclosed_Ideographic_Sup, /**< @brief Enclosed Ideographic Supplement */
+	UCD_BLOCK_Misc_Pictographs, /**< @brief Miscellaneous Symbols and Pictographs */
+	UCD_BLOCK_Emoticons, /**< @brief Emoticons */
+	UCD_BLOCK_Ornamental_Dingbats, /**< @brief Ornamental Dingbats */
+	UCD_BLOCK_Transport_And_Map, /**< @brief Transport and Map Symbols */
+	UCD_BLOCK_Alchemical, /**< @brief Alchemical Symbols */
+	UCD_BLOCK_Geometric_Shapes_Ext, /**< @brief Geometric Shapes Extended */
+	UCD_BLOCK_Sup_Arrows_C, /**< @brief Supplemental Arrows-C */
+	UCD_BLOCK_Sup_Symbols_And_Pictographs, /**< @brief Supplemental Symbols and Pictographs */
+	UCD_BLOCK_Chess_Symbols, /**< @brief Chess Symbols */
+	UCD_BLOCK_Symbols_And_Pictographs_Ext_A, /**< @brief Symbols and Pictographs Extended-A */
+	UCD_BLOCK_CJK_Ext_B, /**< @brief CJK Unified Ideographs Extension B */
+	UCD_BLOCK_CJK_Ext_C, /**< @brief CJK Unified Ideographs Extension C */
+	UCD_BLOCK_CJK_Ext_D, /**< @brief CJK Unified Ideographs Extension D */
+	UCD_BLOCK_CJK_Ext_E, /**< @brief CJK Unified Ideographs Extension E */
+	UCD_BLOCK_CJK_Ext_F, /**< @brief CJK Unified Ideographs Extension F */
+	UCD_BLOCK_CJK_Compat_Ideographs_Sup, /**< @brief CJK Compatibility Ideographs Supplement */
+	UCD_BLOCK_Tags, /**< @brief Tags */
+	UCD_BLOCK_VS_Sup, /**< @brief Variation Selectors Supplement */
+	UCD_BLOCK_Sup_PUA_A, /**< @brief Supplementary Private Use Area-A */
+	UCD_BLOCK_Sup_PUA_B, /**< @brief Supplementary Private Use Area-B */
+} ucd_block;
+
+/** @brief The number of ucd_block values.
+  */
+#define UCD_BLOCK_COUNT 301
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
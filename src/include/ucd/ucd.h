@@ -21,9 +21,11 @@
 #ifndef UNICODE_CHARACTER_DATA_H
 #define UNICODE_CHARACTER_DATA_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "script.h"
+#include "block.h"
 
 #ifdef __cplusplus
 extern "C"
@@ -34,6 +36,34 @@ extern "C"
   */
 typedef uint32_t codepoint_t;
 
+/** @brief The maximum number of codepoints in a full case mapping.
+  */
+#define UCD_MAX_FULL_CASE_MAPPING 3
+
+/** @brief The maximum number of codepoints in the full decomposition of a
+  *        codepoint.
+  */
+#define UCD_MAX_DECOMPOSITION 18
+
+/** @brief The number of decomposed codepoints in a normalization segment
+  *        that are held without allocating memory.
+  */
+#define UCD_MAX_NORMALIZATION_SEGMENT 64
+
+/** @brief The maximum number of scripts in the Script Extensions of a
+  *        codepoint.
+  */
+#define UCD_MAX_SCRIPT_EXTENSIONS 32
+
+/** @brief The maximum length of a Unicode character name, not including the
+  *        terminating NUL character.
+  */
+#define UCD_MAX_NAME_LENGTH 88
+
+/** @brief The value returned when a Unicode codepoint could not be found.
+  */
+#define UCD_INVALID_CODEPOINT 0xFFFFFFFF
+
 /** @brief Unicode General Category Groups
   * @see   http://www.unicode.org/reports/tr44/
   */
@@ -131,6 +161,14 @@ ucd_category_group ucd_lookup_category_group(codepoint_t c);
   */
 ucd_category ucd_lookup_category(codepoint_t c);
 
+/** @brief Lookup the General Category for each Unicode codepoint in a buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The General Category (ucd_category) of each Unicode codepoint.
+  */
+void ucd_lookup_category_n(const codepoint_t *in, size_t n, uint8_t *out);
+
 /** @brief Get a string representation of the script enumeration value.
   *
   * @param s The value to get the string representation for.
@@ -146,6 +184,64 @@ const char *ucd_get_script_string(ucd_script s);
   */
 ucd_script ucd_lookup_script(codepoint_t c);
 
+/** @brief Lookup the Script for each Unicode codepoint in a buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The Script (ucd_script) of each Unicode codepoint.
+  */
+void ucd_lookup_script_n(const codepoint_t *in, size_t n, uint8_t *out);
+
+/** @brief Lookup the Script Extensions for a Unicode codepoint.
+  *
+  * The Script Extensions are the scripts that a codepoint is used with. For
+  * most codepoints this is the Script of the codepoint, but some Common and
+  * Inherited codepoints are only used with a few scripts, and some codepoints
+  * are shared by several related scripts.
+  *
+  * @param c      The Unicode codepoint to lookup.
+  * @param out    The Script Extensions (ucd_script) of the codepoint, in
+  *               script order.
+  * @param outlen The number of scripts the out buffer can hold. This should be
+  *               UCD_MAX_SCRIPT_EXTENSIONS to hold all the scripts.
+  * @return       The number of scripts in the Script Extensions.
+  */
+size_t ucd_lookup_script_extensions(codepoint_t c, uint8_t *out, size_t outlen);
+
+/** @brief Return the length of the first script run in UTF-32 data.
+  *
+  * A script run is a sequence of codepoints that share a script, using the
+  * Script Extensions of each codepoint. The Common and Inherited codepoints
+  * (such as punctuation and combining marks) that are not restricted to a set
+  * of scripts are included in the run they are in, so that a Common or
+  * Inherited codepoint at the start of the text is resolved to the script of
+  * the codepoints following it, and the others are resolved to the script of
+  * the codepoints before them.
+  *
+  * @param in     The UTF-32 data to segment.
+  * @param n      The number of codepoints in the UTF-32 data.
+  * @param script The script of the run. If the run codepoints share several
+  *               scripts, this is the first script in script order. This is
+  *               Common (or Inherited) if the run only has Common and
+  *               Inherited codepoints.
+  * @return       The number of codepoints in the first script run, or 0 if
+  *               the UTF-32 data is empty.
+  */
+size_t ucd_utf32_next_script_run(const codepoint_t *in, size_t n, ucd_script *script);
+
+/** @brief Return the length of the first script run in UTF-8 data.
+  *
+  * This is the same as ucd_utf32_next_script_run. Ill-formed UTF-8 sequences
+  * are treated as the Common U+FFFD REPLACEMENT CHARACTER.
+  *
+  * @param in     The UTF-8 data to segment.
+  * @param len    The number of bytes in the UTF-8 data.
+  * @param script The script of the run.
+  * @return       The number of bytes in the first script run, or 0 if the
+  *               UTF-8 data is empty.
+  */
+size_t ucd_utf8_next_script_run(const char *in, size_t len, ucd_script *script);
+
 /** @brief Properties
  */
 typedef uint64_t ucd_property;
@@ -190,15 +286,68 @@ typedef uint64_t ucd_property;
 #define UCD_PROPERTY_REGIONAL_INDICATOR                 0x0000002000000000ull /**< @brief Regional_Indicator */
 #define UCD_PROPERTY_EMOJI_COMPONENT                    0x0000004000000000ull /**< @brief Emoji_Component */
 #define UCD_PROPERTY_EXTENDED_PICTOGRAPHIC              0x0000008000000000ull /**< @brief Extended_Pictographic */
+#define UCD_PROPERTY_XID_START                          0x0000010000000000ull /**< @brief XID_Start */
+#define UCD_PROPERTY_XID_CONTINUE                       0x0000020000000000ull /**< @brief XID_Continue */
 
 /** @brief Return the properties of the specified codepoint.
  *
  * @param c        The Unicode codepoint to lookup.
- * @param category The General Category of the codepoint.
+ * @param category The General Category of the codepoint. This is not used,
+ *                 and is kept for compatibility with previous versions.
  * @return         The properties associated with the codepoint.
  */
 ucd_property ucd_properties(codepoint_t c, ucd_category category);
 
+/** @brief Return the properties of the specified codepoint.
+ *
+ * @param c The Unicode codepoint to lookup.
+ * @return  The properties associated with the codepoint.
+ */
+ucd_property ucd_lookup_properties(codepoint_t c);
+
+/** @brief Return the properties of each Unicode codepoint in a buffer.
+ *
+ * @param in  The Unicode codepoints to lookup.
+ * @param n   The number of codepoints in the in and out buffers.
+ * @param out The properties associated with each Unicode codepoint.
+ */
+void ucd_lookup_properties_n(const codepoint_t *in, size_t n, ucd_property *out);
+
+/** @brief ctype classes
+ */
+typedef uint16_t ucd_ctype;
+
+#define UCD_CTYPE_ALNUM  0x0001 /**< @brief The 'alnum' class */
+#define UCD_CTYPE_ALPHA  0x0002 /**< @brief The 'alpha' class */
+#define UCD_CTYPE_BLANK  0x0004 /**< @brief The 'blank' class */
+#define UCD_CTYPE_CNTRL  0x0008 /**< @brief The 'cntrl' class */
+#define UCD_CTYPE_DIGIT  0x0010 /**< @brief The 'digit' class */
+#define UCD_CTYPE_GRAPH  0x0020 /**< @brief The 'graph' class */
+#define UCD_CTYPE_LOWER  0x0040 /**< @brief The 'lower' class */
+#define UCD_CTYPE_PRINT  0x0080 /**< @brief The 'print' class */
+#define UCD_CTYPE_PUNCT  0x0100 /**< @brief The 'punct' class */
+#define UCD_CTYPE_SPACE  0x0200 /**< @brief The 'space' class */
+#define UCD_CTYPE_UPPER  0x0400 /**< @brief The 'upper' class */
+#define UCD_CTYPE_XDIGIT 0x0800 /**< @brief The 'xdigit' class */
+
+/** @brief Return the ctype classes of the specified codepoint.
+  *
+  * This allows a codepoint to be tested against several classes at once,
+  * e.g. `ucd_ctype_mask(c) & (UCD_CTYPE_ALPHA | UCD_CTYPE_DIGIT)`.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The ctype classes (UCD_CTYPE_*) the codepoint is in.
+  */
+ucd_ctype ucd_ctype_mask(codepoint_t c);
+
+/** @brief Return the ctype classes of each Unicode codepoint in a buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The ctype classes (UCD_CTYPE_*) of each Unicode codepoint.
+  */
+void ucd_ctype_mask_n(const codepoint_t *in, size_t n, ucd_ctype *out);
+
 /** @brief Is the codepoint in the 'alnum' class?
   *
   * @param c The Unicode codepoint to check.
@@ -287,7 +436,8 @@ int ucd_isxdigit(codepoint_t c);
   *
   * This function only uses the simple case mapping present in the
   * UnicodeData file. The data in SpecialCasing requires Unicode
-  * codepoints to be mapped to multiple codepoints.
+  * codepoints to be mapped to multiple codepoints, so is only used by the
+  * full case mapping functions.
   *
   * @param c The Unicode codepoint to convert.
   * @return  The upper-case Unicode codepoint for this codepoint, or
@@ -295,11 +445,49 @@ int ucd_isxdigit(codepoint_t c);
   */
 codepoint_t ucd_toupper(codepoint_t c);
 
+/** @brief Convert each Unicode codepoint in a buffer to upper-case.
+  *
+  * This uses the same simple case mapping as ucd_toupper. The in and out
+  * buffers may be the same buffer.
+  *
+  * @param in  The Unicode codepoints to convert.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The converted Unicode codepoints.
+  */
+void ucd_toupper_n(const codepoint_t *in, size_t n, codepoint_t *out);
+
+/** @brief Convert the Unicode codepoint to upper-case using the full case mapping.
+  *
+  * This uses the unconditional mappings in SpecialCasing, falling back to
+  * the simple case mapping used by ucd_toupper. The language and context
+  * dependent mappings in SpecialCasing are not supported.
+  *
+  * @param c   The Unicode codepoint to convert.
+  * @param out The upper-case Unicode codepoints. This must have space for
+  *            UCD_MAX_FULL_CASE_MAPPING entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_toupper_full(codepoint_t c, codepoint_t *out);
+
+/** @brief Convert each Unicode codepoint in a buffer to upper-case using the full
+  *        case mapping.
+  *
+  * @param in     The Unicode codepoints to convert.
+  * @param n      The number of codepoints in the in buffer.
+  * @param out    The converted Unicode codepoints.
+  * @param outlen The number of codepoints the out buffer can hold.
+  * @return       The number of codepoints needed to hold the converted data. If
+  *               this is greater than outlen, the out buffer only contains the
+  *               full mappings of the codepoints that fit.
+  */
+size_t ucd_toupper_full_n(const codepoint_t *in, size_t n, codepoint_t *out, size_t outlen);
+
 /** @brief Convert the Unicode codepoint to lower-case.
   *
   * This function only uses the simple case mapping present in the
   * UnicodeData file. The data in SpecialCasing requires Unicode
-  * codepoints to be mapped to multiple codepoints.
+  * codepoints to be mapped to multiple codepoints, so is only used by the
+  * full case mapping functions.
   *
   * @param c The Unicode codepoint to convert.
   * @return  The lower-case Unicode codepoint for this codepoint, or
@@ -307,11 +495,49 @@ codepoint_t ucd_toupper(codepoint_t c);
   */
 codepoint_t ucd_tolower(codepoint_t c);
 
+/** @brief Convert each Unicode codepoint in a buffer to lower-case.
+  *
+  * This uses the same simple case mapping as ucd_tolower. The in and out
+  * buffers may be the same buffer.
+  *
+  * @param in  The Unicode codepoints to convert.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The converted Unicode codepoints.
+  */
+void ucd_tolower_n(const codepoint_t *in, size_t n, codepoint_t *out);
+
+/** @brief Convert the Unicode codepoint to lower-case using the full case mapping.
+  *
+  * This uses the unconditional mappings in SpecialCasing, falling back to
+  * the simple case mapping used by ucd_tolower. The language and context
+  * dependent mappings in SpecialCasing are not supported.
+  *
+  * @param c   The Unicode codepoint to convert.
+  * @param out The lower-case Unicode codepoints. This must have space for
+  *            UCD_MAX_FULL_CASE_MAPPING entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_tolower_full(codepoint_t c, codepoint_t *out);
+
+/** @brief Convert each Unicode codepoint in a buffer to lower-case using the full
+  *        case mapping.
+  *
+  * @param in     The Unicode codepoints to convert.
+  * @param n      The number of codepoints in the in buffer.
+  * @param out    The converted Unicode codepoints.
+  * @param outlen The number of codepoints the out buffer can hold.
+  * @return       The number of codepoints needed to hold the converted data. If
+  *               this is greater than outlen, the out buffer only contains the
+  *               full mappings of the codepoints that fit.
+  */
+size_t ucd_tolower_full_n(const codepoint_t *in, size_t n, codepoint_t *out, size_t outlen);
+
 /** @brief Convert the Unicode codepoint to title-case.
   *
   * This function only uses the simple case mapping present in the
   * UnicodeData file. The data in SpecialCasing requires Unicode
-  * codepoints to be mapped to multiple codepoints.
+  * codepoints to be mapped to multiple codepoints, so is only used by the
+  * full case mapping functions.
   *
   * @param c The Unicode codepoint to convert.
   * @return  The title-case Unicode codepoint for this codepoint, or
@@ -319,159 +545,1499 @@ codepoint_t ucd_tolower(codepoint_t c);
   */
 codepoint_t ucd_totitle(codepoint_t c);
 
-#ifdef __cplusplus
-}
+/** @brief Convert each Unicode codepoint in a buffer to title-case.
+  *
+  * This uses the same simple case mapping as ucd_totitle. The in and out
+  * buffers may be the same buffer.
+  *
+  * @param in  The Unicode codepoints to convert.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The converted Unicode codepoints.
+  */
+void ucd_totitle_n(const codepoint_t *in, size_t n, codepoint_t *out);
 
-/** @brief Unicode Character Database
+/** @brief Convert the Unicode codepoint to title-case using the full case mapping.
+  *
+  * This uses the unconditional mappings in SpecialCasing, falling back to
+  * the simple case mapping used by ucd_totitle. The language and context
+  * dependent mappings in SpecialCasing are not supported.
+  *
+  * @param c   The Unicode codepoint to convert.
+  * @param out The title-case Unicode codepoints. This must have space for
+  *            UCD_MAX_FULL_CASE_MAPPING entries.
+  * @return    The number of codepoints written to the out buffer.
   */
-namespace ucd
-{
-	/** @brief Represents a Unicode codepoint.
-	  */
-	using ::codepoint_t;
+size_t ucd_totitle_full(codepoint_t c, codepoint_t *out);
 
-	/** @brief Unicode General Category Groups
-	  * @see   http://www.unicode.org/reports/tr44/
-	  */
-	enum category_group
-	{
-		C = UCD_CATEGORY_GROUP_C, /**< @brief Other */
-		I = UCD_CATEGORY_GROUP_I, /**< @brief Invalid */
-		L = UCD_CATEGORY_GROUP_L, /**< @brief Letter */
-		M = UCD_CATEGORY_GROUP_M, /**< @brief Mark */
-		N = UCD_CATEGORY_GROUP_N, /**< @brief Number */
-		P = UCD_CATEGORY_GROUP_P, /**< @brief Punctuation */
-		S = UCD_CATEGORY_GROUP_S, /**< @brief Symbol */
-		Z = UCD_CATEGORY_GROUP_Z, /**< @brief Separator */
-	};
+/** @brief Convert each Unicode codepoint in a buffer to title-case using the full
+  *        case mapping.
+  *
+  * @param in     The Unicode codepoints to convert.
+  * @param n      The number of codepoints in the in buffer.
+  * @param out    The converted Unicode codepoints.
+  * @param outlen The number of codepoints the out buffer can hold.
+  * @return       The number of codepoints needed to hold the converted data. If
+  *               this is greater than outlen, the out buffer only contains the
+  *               full mappings of the codepoints that fit.
+  */
+size_t ucd_totitle_full_n(const codepoint_t *in, size_t n, codepoint_t *out, size_t outlen);
 
-	/** @brief Get a string representation of the category_group enumeration value.
-	  *
-	  * @param c The value to get the string representation for.
-	  *
-	  * @return The string representation, or "-" if the value is not recognized.
-	  */
-	inline const char *get_category_group_string(category_group c)
-	{
-		return ucd_get_category_group_string((ucd_category_group)c);
-	}
+/** @brief Case fold the Unicode codepoint.
+  *
+  * This uses the simple (C and S) case foldings in CaseFolding. These map
+  * characters that only differ by case to the same codepoint, so should be
+  * used instead of ucd_tolower for case-insensitive comparisons.
+  *
+  * @param c The Unicode codepoint to case fold.
+  * @return  The case folded Unicode codepoint for this codepoint, or this
+  *          codepoint if it does not have a case folding.
+  */
+codepoint_t ucd_casefold(codepoint_t c);
 
-	/** @brief Unicode General Category Values
-	  * @see   http://www.unicode.org/reports/tr44/
-	  */
-	enum category
-	{
-		Cc = UCD_CATEGORY_Cc, /**< @brief Control Character */
-		Cf = UCD_CATEGORY_Cf, /**< @brief Format Control Character */
-		Cn = UCD_CATEGORY_Cn, /**< @brief Unassigned */
-		Co = UCD_CATEGORY_Co, /**< @brief Private Use */
-		Cs = UCD_CATEGORY_Cs, /**< @brief Surrogate Code Point */
+/** @brief Case fold the Unicode codepoint using the full case folding.
+  *
+  * This uses the full (C and F) case foldings in CaseFolding. The Turkic (T)
+  * case foldings are not supported.
+  *
+  * @param c   The Unicode codepoint to case fold.
+  * @param out The case folded Unicode codepoints. This must have space for
+  *            UCD_MAX_FULL_CASE_MAPPING entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_casefold_full(codepoint_t c, codepoint_t *out);
 
-		Ii = UCD_CATEGORY_Ii, /**< @brief Invalid Unicode Codepoint */
+/** @brief Grapheme Cluster Break
+  * @see   http://www.unicode.org/reports/tr29/
+  */
+typedef enum ucd_grapheme_cluster_break_
+{
+	UCD_GRAPHEME_CLUSTER_BREAK_XX,  /**< @brief Other */
+	UCD_GRAPHEME_CLUSTER_BREAK_CN,  /**< @brief Control */
+	UCD_GRAPHEME_CLUSTER_BREAK_CR,  /**< @brief Carriage Return */
+	UCD_GRAPHEME_CLUSTER_BREAK_EX,  /**< @brief Extend */
+	UCD_GRAPHEME_CLUSTER_BREAK_L,   /**< @brief Hangul Leading Jamo */
+	UCD_GRAPHEME_CLUSTER_BREAK_LF,  /**< @brief Line Feed */
+	UCD_GRAPHEME_CLUSTER_BREAK_LV,  /**< @brief Hangul LV Syllable */
+	UCD_GRAPHEME_CLUSTER_BREAK_LVT, /**< @brief Hangul LVT Syllable */
+	UCD_GRAPHEME_CLUSTER_BREAK_PP,  /**< @brief Prepend */
+	UCD_GRAPHEME_CLUSTER_BREAK_RI,  /**< @brief Regional Indicator */
+	UCD_GRAPHEME_CLUSTER_BREAK_SM,  /**< @brief Spacing Mark */
+	UCD_GRAPHEME_CLUSTER_BREAK_T,   /**< @brief Hangul Trailing Jamo */
+	UCD_GRAPHEME_CLUSTER_BREAK_V,   /**< @brief Hangul Vowel Jamo */
+	UCD_GRAPHEME_CLUSTER_BREAK_ZWJ, /**< @brief Zero Width Joiner */
+} ucd_grapheme_cluster_break;
+
+/** @brief Lookup the Grapheme Cluster Break property for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Grapheme Cluster Break property of the Unicode codepoint.
+  */
+ucd_grapheme_cluster_break ucd_lookup_grapheme_cluster_break(codepoint_t c);
 
-		Ll = UCD_CATEGORY_Ll, /**< @brief Lower Case Letter */
-		Lm = UCD_CATEGORY_Lm, /**< @brief Letter Modifier */
-		Lo = UCD_CATEGORY_Lo, /**< @brief Other Letter */
-		Lt = UCD_CATEGORY_Lt, /**< @brief Title Case Letter */
-		Lu = UCD_CATEGORY_Lu, /**< @brief Upper Case Letter */
+/** @brief Lookup the Grapheme Cluster Break property for each Unicode
+  *        codepoint in a buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The Grapheme Cluster Break property (ucd_grapheme_cluster_break)
+  *            of each Unicode codepoint.
+  */
+void ucd_lookup_grapheme_cluster_break_n(const codepoint_t *in, size_t n, uint8_t *out);
 
-		Mc = UCD_CATEGORY_Mc, /**< @brief Spacing Mark */
-		Me = UCD_CATEGORY_Me, /**< @brief Enclosing Mark */
-		Mn = UCD_CATEGORY_Mn, /**< @brief Non-Spacing Mark */
+/** @brief The state of the grapheme cluster boundary algorithm.
+  *
+  * This holds the context needed to locate grapheme cluster boundaries
+  * one codepoint at a time, so text can be processed as it is received.
+  */
+typedef struct ucd_grapheme_break_state_
+{
+	uint8_t state; /**< @brief The internal break state. */
+} ucd_grapheme_break_state;
 
-		Nd = UCD_CATEGORY_Nd, /**< @brief Decimal Digit */
-		Nl = UCD_CATEGORY_Nl, /**< @brief Letter-Like Number */
-		No = UCD_CATEGORY_No, /**< @brief Other Number */
+/** @brief Initialize the grapheme cluster boundary state for the start of the text.
+  *
+  * @param state The grapheme cluster boundary state to initialize.
+  */
+void ucd_grapheme_break_init(ucd_grapheme_break_state *state);
 
-		Pc = UCD_CATEGORY_Pc, /**< @brief Connector */
-		Pd = UCD_CATEGORY_Pd, /**< @brief Dash/Hyphen */
-		Pe = UCD_CATEGORY_Pe, /**< @brief Close Punctuation Mark */
-		Pf = UCD_CATEGORY_Pf, /**< @brief Final Quotation Mark */
-		Pi = UCD_CATEGORY_Pi, /**< @brief Initial Quotation Mark */
-		Po = UCD_CATEGORY_Po, /**< @brief Other */
-		Ps = UCD_CATEGORY_Ps, /**< @brief Open Punctuation Mark */
+/** @brief Process the next codepoint using the grapheme cluster boundary rules.
+  *
+  * This implements the extended grapheme cluster rules in UAX #29 using a
+  * state table.
+  *
+  * @param state The grapheme cluster boundary state.
+  * @param c     The next Unicode codepoint in the text.
+  * @return      Non-zero if there is a grapheme cluster boundary before the
+  *              codepoint (including at the start of the text), zero otherwise.
+  */
+int ucd_grapheme_break_next(ucd_grapheme_break_state *state, codepoint_t c);
 
-		Sc = UCD_CATEGORY_Sc, /**< @brief Currency Symbol */
-		Sk = UCD_CATEGORY_Sk, /**< @brief Modifier Symbol */
-		Sm = UCD_CATEGORY_Sm, /**< @brief Math Symbol */
-		So = UCD_CATEGORY_So, /**< @brief Other Symbol */
+/** @brief Return the length of the first grapheme cluster in UTF-32 data.
+  *
+  * @param in The UTF-32 data to segment.
+  * @param n  The number of codepoints in the UTF-32 data.
+  * @return   The number of codepoints in the first grapheme cluster, or 0 if
+  *           the UTF-32 data is empty.
+  */
+size_t ucd_utf32_next_grapheme(const codepoint_t *in, size_t n);
 
-		Zl = UCD_CATEGORY_Zl, /**< @brief Line Separator */
-		Zp = UCD_CATEGORY_Zp, /**< @brief Paragraph Separator */
-		Zs = UCD_CATEGORY_Zs, /**< @brief Space Separator */
-	};
+/** @brief Return the length of the first grapheme cluster in UTF-8 data.
+  *
+  * Ill-formed UTF-8 sequences are treated as separate grapheme clusters.
+  *
+  * @param in  The UTF-8 data to segment.
+  * @param len The number of bytes in the UTF-8 data.
+  * @return    The number of bytes in the first grapheme cluster, or 0 if the
+  *            UTF-8 data is empty.
+  */
+size_t ucd_utf8_next_grapheme(const char *in, size_t len);
 
-	/** @brief Get a string representation of the category enumeration value.
-	  *
-	  * @param c The value to get the string representation for.
-	  *
-	  * @return The string representation, or "--" if the value is not recognized.
-	  */
-	inline const char *get_category_string(category c)
-	{
-		return ucd_get_category_string((ucd_category)c);
-	}
+/** @brief Word Break
+  * @see   http://www.unicode.org/reports/tr29/
+  */
+typedef enum ucd_word_break_
+{
+	UCD_WORD_BREAK_XX,        /**< @brief Other */
+	UCD_WORD_BREAK_CR,        /**< @brief Carriage Return */
+	UCD_WORD_BREAK_DQ,        /**< @brief Double Quote */
+	UCD_WORD_BREAK_EX,        /**< @brief Extend Number Letter */
+	UCD_WORD_BREAK_Extend,    /**< @brief Extend */
+	UCD_WORD_BREAK_FO,        /**< @brief Format */
+	UCD_WORD_BREAK_HL,        /**< @brief Hebrew Letter */
+	UCD_WORD_BREAK_KA,        /**< @brief Katakana */
+	UCD_WORD_BREAK_LE,        /**< @brief Letter */
+	UCD_WORD_BREAK_LF,        /**< @brief Line Feed */
+	UCD_WORD_BREAK_MB,        /**< @brief Mid Number Letter */
+	UCD_WORD_BREAK_ML,        /**< @brief Mid Letter */
+	UCD_WORD_BREAK_MN,        /**< @brief Mid Number */
+	UCD_WORD_BREAK_NL,        /**< @brief New Line */
+	UCD_WORD_BREAK_NU,        /**< @brief Numeric */
+	UCD_WORD_BREAK_RI,        /**< @brief Regional Indicator */
+	UCD_WORD_BREAK_SQ,        /**< @brief Single Quote */
+	UCD_WORD_BREAK_WSegSpace, /**< @brief Word Segment Space */
+	UCD_WORD_BREAK_ZWJ,       /**< @brief Zero Width Joiner */
+} ucd_word_break;
+
+/** @brief Lookup the Word Break property for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Word Break property of the Unicode codepoint.
+  */
+ucd_word_break ucd_lookup_word_break(codepoint_t c);
 
-	/** @brief Lookup the General Category Group for a General Category.
-	  *
-	  * @param c The General Category to lookup.
-	  * @return  The General Category Group of the General Category.
-	  */
-	inline category_group lookup_category_group(category c)
-	{
-		return (category_group)ucd_get_category_group_for_category((ucd_category)c);
-	}
+/** @brief Lookup the Word Break property for each Unicode codepoint in a
+  *        buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The Word Break property (ucd_word_break) of each Unicode
+  *            codepoint.
+  */
+void ucd_lookup_word_break_n(const codepoint_t *in, size_t n, uint8_t *out);
 
-	/** @brief Lookup the General Category Group for a Unicode codepoint.
-	  *
-	  * @param c The Unicode codepoint to lookup.
-	  * @return  The General Category Group of the Unicode codepoint.
-	  */
-	inline category_group lookup_category_group(codepoint_t c)
-	{
-		return (category_group)ucd_lookup_category_group(c);
-	}
+/** @brief Return the length of the first word in UTF-32 data.
+  *
+  * This implements the word boundary rules in UAX #29 using a state table.
+  * The end of the word may depend on the codepoints that follow it, so the
+  * data should contain the rest of the text, not just the next word.
+  *
+  * @param in The UTF-32 data to segment.
+  * @param n  The number of codepoints in the UTF-32 data.
+  * @return   The number of codepoints in the first word, or 0 if the
+  *           UTF-32 data is empty.
+  */
+size_t ucd_utf32_next_word(const codepoint_t *in, size_t n);
 
-	/** @brief Lookup the General Category for a Unicode codepoint.
-	  *
-	  * @param c The Unicode codepoint to lookup.
-	  * @return  The General Category of the Unicode codepoint.
-	  */
-	inline category lookup_category(codepoint_t c)
-	{
-		return (category)ucd_lookup_category(c);
-	}
+/** @brief Return the length of the first word in UTF-8 data.
+  *
+  * This implements the word boundary rules in UAX #29 using a state table.
+  * The end of the word may depend on the codepoints that follow it, so the
+  * data should contain the rest of the text, not just the next word.
+  *
+  * Ill-formed UTF-8 sequences are treated as Other codepoints.
+  *
+  * @param in  The UTF-8 data to segment.
+  * @param len The number of bytes in the UTF-8 data.
+  * @return    The number of bytes in the first word, or 0 if the UTF-8
+  *            data is empty.
+  */
+size_t ucd_utf8_next_word(const char *in, size_t len);
 
-	/** @brief Get a string representation of the script enumeration value.
-	  *
-	  * @param s The value to get the string representation for.
-	  *
-	  * @return The string representation, or "----" if the value is not recognized.
-	  */
-	inline const char *get_script_string(script s)
-	{
-		return ucd_get_script_string((ucd_script)s);
-	}
+/** @brief Sentence Break
+  * @see   http://www.unicode.org/reports/tr29/
+  */
+typedef enum ucd_sentence_break_
+{
+	UCD_SENTENCE_BREAK_XX, /**< @brief Other */
+	UCD_SENTENCE_BREAK_AT, /**< @brief ATerm */
+	UCD_SENTENCE_BREAK_CL, /**< @brief Close */
+	UCD_SENTENCE_BREAK_CR, /**< @brief Carriage Return */
+	UCD_SENTENCE_BREAK_EX, /**< @brief Extend */
+	UCD_SENTENCE_BREAK_FO, /**< @brief Format */
+	UCD_SENTENCE_BREAK_LE, /**< @brief Other Letter */
+	UCD_SENTENCE_BREAK_LF, /**< @brief Line Feed */
+	UCD_SENTENCE_BREAK_LO, /**< @brief Lower */
+	UCD_SENTENCE_BREAK_NU, /**< @brief Numeric */
+	UCD_SENTENCE_BREAK_SC, /**< @brief Sentence Continue */
+	UCD_SENTENCE_BREAK_SE, /**< @brief Separator */
+	UCD_SENTENCE_BREAK_SP, /**< @brief Space */
+	UCD_SENTENCE_BREAK_ST, /**< @brief STerm */
+	UCD_SENTENCE_BREAK_UP, /**< @brief Upper */
+} ucd_sentence_break;
+
+/** @brief Lookup the Sentence Break property for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Sentence Break property of the Unicode codepoint.
+  */
+ucd_sentence_break ucd_lookup_sentence_break(codepoint_t c);
 
-	/** @brief Lookup the Script for a Unicode codepoint.
-	  *
-	  * @param c The Unicode codepoint to lookup.
-	  * @return  The Script of the Unicode codepoint.
-	  */
-	inline script lookup_script(codepoint_t c)
-	{
-		return (script)ucd_lookup_script(c);
-	}
+/** @brief Lookup the Sentence Break property for each Unicode codepoint in a
+  *        buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The Sentence Break property (ucd_sentence_break) of each Unicode
+  *            codepoint.
+  */
+void ucd_lookup_sentence_break_n(const codepoint_t *in, size_t n, uint8_t *out);
 
-	/** @brief Properties
-	 */
-	typedef ucd_property property;
-	enum
-	{
-		White_Space = UCD_PROPERTY_WHITE_SPACE, /**< @brief White_Space */
-		Bidi_Control = UCD_PROPERTY_BIDI_CONTROL, /**< @brief Bidi_Control */
-		Join_Control = UCD_PROPERTY_JOIN_CONTROL, /**< @brief Join_Control */
-		Dash = UCD_PROPERTY_DASH, /**< @brief Dash */
+/** @brief Return the length of the first sentence in UTF-32 data.
+  *
+  * This implements the sentence boundary rules in UAX #29 using a state table.
+  * The end of the sentence may depend on the codepoints that follow it, so the
+  * data should contain the rest of the text, not just the next sentence.
+  *
+  * @param in The UTF-32 data to segment.
+  * @param n  The number of codepoints in the UTF-32 data.
+  * @return   The number of codepoints in the first sentence, or 0 if the
+  *           UTF-32 data is empty.
+  */
+size_t ucd_utf32_next_sentence(const codepoint_t *in, size_t n);
+
+/** @brief Return the length of the first sentence in UTF-8 data.
+  *
+  * This implements the sentence boundary rules in UAX #29 using a state table.
+  * The end of the sentence may depend on the codepoints that follow it, so the
+  * data should contain the rest of the text, not just the next sentence.
+  *
+  * Ill-formed UTF-8 sequences are treated as Other codepoints.
+  *
+  * @param in  The UTF-8 data to segment.
+  * @param len The number of bytes in the UTF-8 data.
+  * @return    The number of bytes in the first sentence, or 0 if the UTF-8
+  *            data is empty.
+  */
+size_t ucd_utf8_next_sentence(const char *in, size_t len);
+
+/** @brief Line Break
+  * @see   http://www.unicode.org/reports/tr14/
+  */
+typedef enum ucd_line_break_
+{
+	UCD_LINE_BREAK_XX,  /**< @brief Unknown */
+	UCD_LINE_BREAK_AI,  /**< @brief Ambiguous */
+	UCD_LINE_BREAK_AL,  /**< @brief Alphabetic */
+	UCD_LINE_BREAK_B2,  /**< @brief Break Opportunity Before and After */
+	UCD_LINE_BREAK_BA,  /**< @brief Break After */
+	UCD_LINE_BREAK_BB,  /**< @brief Break Before */
+	UCD_LINE_BREAK_BK,  /**< @brief Mandatory Break */
+	UCD_LINE_BREAK_CB,  /**< @brief Contingent Break Opportunity */
+	UCD_LINE_BREAK_CJ,  /**< @brief Conditional Japanese Starter */
+	UCD_LINE_BREAK_CL,  /**< @brief Close Punctuation */
+	UCD_LINE_BREAK_CM,  /**< @brief Combining Mark */
+	UCD_LINE_BREAK_CP,  /**< @brief Close Parenthesis */
+	UCD_LINE_BREAK_CR,  /**< @brief Carriage Return */
+	UCD_LINE_BREAK_EB,  /**< @brief Emoji Base */
+	UCD_LINE_BREAK_EM,  /**< @brief Emoji Modifier */
+	UCD_LINE_BREAK_EX,  /**< @brief Exclamation/Interrogation */
+	UCD_LINE_BREAK_GL,  /**< @brief Non-breaking ("Glue") */
+	UCD_LINE_BREAK_H2,  /**< @brief Hangul LV Syllable */
+	UCD_LINE_BREAK_H3,  /**< @brief Hangul LVT Syllable */
+	UCD_LINE_BREAK_HL,  /**< @brief Hebrew Letter */
+	UCD_LINE_BREAK_HY,  /**< @brief Hyphen */
+	UCD_LINE_BREAK_ID,  /**< @brief Ideographic */
+	UCD_LINE_BREAK_IN,  /**< @brief Inseparable */
+	UCD_LINE_BREAK_IS,  /**< @brief Infix Numeric Separator */
+	UCD_LINE_BREAK_JL,  /**< @brief Hangul L Jamo */
+	UCD_LINE_BREAK_JT,  /**< @brief Hangul T Jamo */
+	UCD_LINE_BREAK_JV,  /**< @brief Hangul V Jamo */
+	UCD_LINE_BREAK_LF,  /**< @brief Line Feed */
+	UCD_LINE_BREAK_NL,  /**< @brief Next Line */
+	UCD_LINE_BREAK_NS,  /**< @brief Nonstarter */
+	UCD_LINE_BREAK_NU,  /**< @brief Numeric */
+	UCD_LINE_BREAK_OP,  /**< @brief Open Punctuation */
+	UCD_LINE_BREAK_PO,  /**< @brief Postfix Numeric */
+	UCD_LINE_BREAK_PR,  /**< @brief Prefix Numeric */
+	UCD_LINE_BREAK_QU,  /**< @brief Quotation */
+	UCD_LINE_BREAK_RI,  /**< @brief Regional Indicator */
+	UCD_LINE_BREAK_SA,  /**< @brief Complex Context Dependent (South East Asian) */
+	UCD_LINE_BREAK_SG,  /**< @brief Surrogate */
+	UCD_LINE_BREAK_SP,  /**< @brief Space */
+	UCD_LINE_BREAK_SY,  /**< @brief Symbols Allowing Break After */
+	UCD_LINE_BREAK_WJ,  /**< @brief Word Joiner */
+	UCD_LINE_BREAK_ZW,  /**< @brief Zero Width Space */
+	UCD_LINE_BREAK_ZWJ, /**< @brief Zero Width Joiner */
+} ucd_line_break;
+
+/** @brief Lookup the Line Break property for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Line Break property of the Unicode codepoint.
+  */
+ucd_line_break ucd_lookup_line_break(codepoint_t c);
+
+/** @brief Lookup the Line Break property for each Unicode codepoint in a
+  *        buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The Line Break property (ucd_line_break) of each Unicode
+  *            codepoint.
+  */
+void ucd_lookup_line_break_n(const codepoint_t *in, size_t n, uint8_t *out);
+
+/** @brief The line break opportunity before a codepoint.
+  */
+typedef enum ucd_break_opportunity_
+{
+	UCD_BREAK_PROHIBITED, /**< @brief A line break is not allowed. */
+	UCD_BREAK_ALLOWED,    /**< @brief A line break is allowed. */
+	UCD_BREAK_MANDATORY,  /**< @brief A line break is required. */
+} ucd_break_opportunity;
+
+/** @brief The state of the line breaking algorithm.
+  *
+  * This holds the context needed to locate the line break opportunities in a
+  * paragraph as it is received, one chunk at a time.
+  */
+typedef struct ucd_line_break_state_
+{
+	uint8_t state; /**< @brief The internal break state. */
+} ucd_line_break_state;
+
+/** @brief Initialize the line breaking state for the start of a paragraph.
+  *
+  * @param state The line breaking state to initialize.
+  */
+void ucd_line_break_init(ucd_line_break_state *state);
+
+/** @brief Find the line break opportunities in a chunk of UTF-32 data.
+  *
+  * This implements the default line breaking rules in UAX #14 using a state
+  * table, with the AI, CJ, SA, SG and XX classes resolved as described by LB1.
+  * The number rule (LB25) uses the regular expression from Example 7, so the
+  * break before an OP following a PR or PO depends on whether the OP is then
+  * followed by a NU. There is never a break opportunity before the first
+  * codepoint (LB2), and there is always one at the end of the text (LB3).
+  *
+  * If last is not set and the chunk ends with a PR or PO followed by an OP and
+  * any combining marks, the codepoints from the OP onwards are not processed,
+  * and should be passed at the start of the next chunk.
+  *
+  * @param state The line breaking state.
+  * @param in    The UTF-32 data to process.
+  * @param n     The number of codepoints in the in and out buffers.
+  * @param last  Set if this is the last chunk in the paragraph.
+  * @param out   The line break opportunity (ucd_break_opportunity) before each
+  *              codepoint.
+  * @return      The number of codepoints processed.
+  */
+size_t ucd_utf32_line_breaks(ucd_line_break_state *state, const codepoint_t *in, size_t n, int last, uint8_t *out);
+
+/** @brief Find the line break opportunities in a chunk of UTF-8 data.
+  *
+  * This is the same as ucd_utf32_line_breaks, but if last is not set and the
+  * chunk ends part way through a UTF-8 sequence, those bytes are also left to
+  * be passed at the start of the next chunk. Ill-formed UTF-8 sequences are
+  * processed as Unknown (XX) codepoints.
+  *
+  * @param state The line breaking state.
+  * @param in    The UTF-8 data to process.
+  * @param len   The number of bytes in the in and out buffers.
+  * @param last  Set if this is the last chunk in the paragraph.
+  * @param out   The line break opportunity (ucd_break_opportunity) before each
+  *              byte. This is UCD_BREAK_PROHIBITED for the bytes after the first
+  *              byte of a UTF-8 sequence.
+  * @return      The number of bytes processed.
+  */
+size_t ucd_utf8_line_breaks(ucd_line_break_state *state, const char *in, size_t len, int last, uint8_t *out);
+
+/** @brief Lookup the Canonical Combining Class for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Canonical_Combining_Class (ccc) property of the Unicode
+  *          codepoint, from 0 (Not_Reordered) to 240.
+  */
+uint8_t ucd_lookup_ccc(codepoint_t c);
+
+/** @brief Lookup the Canonical Combining Class for each Unicode codepoint in a
+  *        buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The Canonical_Combining_Class property of each Unicode codepoint.
+  */
+void ucd_lookup_ccc_n(const codepoint_t *in, size_t n, uint8_t *out);
+
+/** @brief Unicode Normalization Forms
+  * @see   http://www.unicode.org/reports/tr15/
+  */
+typedef enum ucd_normalization_form_
+{
+	UCD_NFC,  /**< @brief Canonical Decomposition, followed by Canonical Composition */
+	UCD_NFD,  /**< @brief Canonical Decomposition */
+	UCD_NFKC, /**< @brief Compatibility Decomposition, followed by Canonical Composition */
+	UCD_NFKD, /**< @brief Compatibility Decomposition */
+} ucd_normalization_form;
+
+/** @brief The result of a normalization quick check.
+  */
+typedef enum ucd_quick_check_
+{
+	UCD_QUICK_CHECK_YES,   /**< @brief The text is normalized. */
+	UCD_QUICK_CHECK_NO,    /**< @brief The text is not normalized. */
+	UCD_QUICK_CHECK_MAYBE, /**< @brief The text needs to be normalized to tell. */
+} ucd_quick_check;
+
+/** @brief Lookup the NFC_QC, NFD_QC, NFKC_QC or NFKD_QC property for a Unicode
+  *        codepoint.
+  *
+  * @param c    The Unicode codepoint to lookup.
+  * @param form The normalization form of the quick check property.
+  * @return     The quick check property of the Unicode codepoint.
+  */
+ucd_quick_check ucd_lookup_quick_check(codepoint_t c, ucd_normalization_form form);
+
+/** @brief Get the full decomposition of a Unicode codepoint.
+  *
+  * This is the canonical decomposition for NFC and NFD, and the compatibility
+  * decomposition for NFKC and NFKD. The decomposition mappings are applied
+  * recursively, including the algorithmic Hangul syllable decompositions. The
+  * decomposed codepoints are not reordered.
+  *
+  * @param c    The Unicode codepoint to decompose.
+  * @param form The normalization form of the decomposition.
+  * @param out  The decomposed Unicode codepoints. This must have space for
+  *             UCD_MAX_DECOMPOSITION entries.
+  * @return     The number of codepoints written to the out buffer.
+  */
+size_t ucd_decompose(codepoint_t c, ucd_normalization_form form, codepoint_t *out);
+
+/** @brief Get the primary composite of two Unicode codepoints.
+  *
+  * @param a The first Unicode codepoint.
+  * @param b The second Unicode codepoint.
+  * @return  The primary composite of a followed by b, or 0 if there is none.
+  */
+codepoint_t ucd_compose(codepoint_t a, codepoint_t b);
+
+/** @brief Check if UTF-32 data is normalized using the quick check properties.
+  *
+  * This implements the quick check algorithm in UAX #15. It checks the text in
+  * a single pass without normalizing it.
+  *
+  * @param in   The UTF-32 data to check.
+  * @param n    The number of codepoints in the UTF-32 data.
+  * @param form The normalization form to check for.
+  * @return     UCD_QUICK_CHECK_MAYBE if the text needs to be normalized to
+  *             tell if it is in the normalization form.
+  */
+ucd_quick_check ucd_utf32_quick_check(const codepoint_t *in, size_t n, ucd_normalization_form form);
+
+/** @brief Check if UTF-8 data is normalized using the quick check properties.
+  *
+  * This is the same as ucd_utf32_quick_check, with ill-formed UTF-8 sequences
+  * treated as starters that are in all normalization forms.
+  *
+  * @param in   The UTF-8 data to check.
+  * @param len  The number of bytes in the UTF-8 data.
+  * @param form The normalization form to check for.
+  * @return     UCD_QUICK_CHECK_MAYBE if the text needs to be normalized to
+  *             tell if it is in the normalization form.
+  */
+ucd_quick_check ucd_utf8_quick_check(const char *in, size_t len, ucd_normalization_form form);
+
+/** @brief Check if UTF-32 data is normalized.
+  *
+  * This uses the quick check properties, only normalizing the parts of the
+  * text that have a UCD_QUICK_CHECK_MAYBE value to compare them with the
+  * input. The normalized text is not written to a buffer.
+  *
+  * @param in   The UTF-32 data to check.
+  * @param n    The number of codepoints in the UTF-32 data.
+  * @param form The normalization form to check for.
+  * @return     1 if the text is in the normalization form, 0 if it is not, or
+  *             -1 if there is not enough memory to check a segment that is
+  *             longer than UCD_MAX_NORMALIZATION_SEGMENT codepoints.
+  */
+int ucd_utf32_is_normalized(const codepoint_t *in, size_t n, ucd_normalization_form form);
+
+/** @brief Check if UTF-8 data is normalized.
+  *
+  * This is the same as ucd_utf32_is_normalized, with ill-formed UTF-8
+  * sequences treated as starters that are in all normalization forms.
+  *
+  * @param in   The UTF-8 data to check.
+  * @param len  The number of bytes in the UTF-8 data.
+  * @param form The normalization form to check for.
+  * @return     1 if the text is in the normalization form, 0 if it is not, or
+  *             -1 if there is not enough memory to check a segment that is
+  *             longer than UCD_MAX_NORMALIZATION_SEGMENT codepoints.
+  */
+int ucd_utf8_is_normalized(const char *in, size_t len, ucd_normalization_form form);
+
+/** @brief Normalize UTF-32 data.
+  *
+  * The text is processed one segment at a time, where a segment starts at a
+  * codepoint that decomposes to a starter that does not compose with the
+  * previous codepoint. The segments that pass the quick check are copied to
+  * the out buffer unchanged. Memory is only allocated for a segment that is
+  * longer than UCD_MAX_NORMALIZATION_SEGMENT codepoints, such as a long run of
+  * combining marks.
+  *
+  * @param in     The UTF-32 data to normalize.
+  * @param n      The number of codepoints in the UTF-32 data.
+  * @param form   The normalization form to convert the text to.
+  * @param out    The normalized UTF-32 data.
+  * @param outlen The number of codepoints the out buffer can hold.
+  * @return       The number of codepoints needed to hold the normalized data,
+  *               or (size_t)-1 if there is not enough memory to normalize a
+  *               segment. If this is greater than outlen, the out buffer only
+  *               contains the normalized segments that fit.
+  */
+size_t ucd_utf32_normalize(const codepoint_t *in, size_t n, ucd_normalization_form form, codepoint_t *out, size_t outlen);
+
+/** @brief Normalize UTF-8 data.
+  *
+  * This is the same as ucd_utf32_normalize, with ill-formed UTF-8 sequences
+  * copied unchanged. The out buffer is not null terminated.
+  *
+  * @param in     The UTF-8 data to normalize.
+  * @param len    The number of bytes in the UTF-8 data.
+  * @param form   The normalization form to convert the text to.
+  * @param out    The normalized UTF-8 data.
+  * @param outlen The number of bytes the out buffer can hold.
+  * @return       The number of bytes needed to hold the normalized data, or
+  *               (size_t)-1 if there is not enough memory to normalize a
+  *               segment. If this is greater than outlen, the out buffer only
+  *               contains the normalized segments that fit.
+  */
+size_t ucd_utf8_normalize(const char *in, size_t len, ucd_normalization_form form, char *out, size_t outlen);
+
+/** @brief Bidi Class
+  * @see   http://www.unicode.org/reports/tr9/
+  */
+typedef enum ucd_bidi_class_
+{
+	UCD_BIDI_CLASS_L,   /**< @brief Left To Right */
+	UCD_BIDI_CLASS_AL,  /**< @brief Arabic Letter */
+	UCD_BIDI_CLASS_AN,  /**< @brief Arabic Number */
+	UCD_BIDI_CLASS_B,   /**< @brief Paragraph Separator */
+	UCD_BIDI_CLASS_BN,  /**< @brief Boundary Neutral */
+	UCD_BIDI_CLASS_CS,  /**< @brief Common Separator */
+	UCD_BIDI_CLASS_EN,  /**< @brief European Number */
+	UCD_BIDI_CLASS_ES,  /**< @brief European Separator */
+	UCD_BIDI_CLASS_ET,  /**< @brief European Terminator */
+	UCD_BIDI_CLASS_FSI, /**< @brief First Strong Isolate */
+	UCD_BIDI_CLASS_LRE, /**< @brief Left To Right Embedding */
+	UCD_BIDI_CLASS_LRI, /**< @brief Left To Right Isolate */
+	UCD_BIDI_CLASS_LRO, /**< @brief Left To Right Override */
+	UCD_BIDI_CLASS_NSM, /**< @brief Nonspacing Mark */
+	UCD_BIDI_CLASS_ON,  /**< @brief Other Neutral */
+	UCD_BIDI_CLASS_PDF, /**< @brief Pop Directional Format */
+	UCD_BIDI_CLASS_PDI, /**< @brief Pop Directional Isolate */
+	UCD_BIDI_CLASS_R,   /**< @brief Right To Left */
+	UCD_BIDI_CLASS_RLE, /**< @brief Right To Left Embedding */
+	UCD_BIDI_CLASS_RLI, /**< @brief Right To Left Isolate */
+	UCD_BIDI_CLASS_RLO, /**< @brief Right To Left Override */
+	UCD_BIDI_CLASS_S,   /**< @brief Segment Separator */
+	UCD_BIDI_CLASS_WS,  /**< @brief White Space */
+} ucd_bidi_class;
+
+/** @brief Lookup the Bidi Class property for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Bidi Class property of the Unicode codepoint.
+  */
+ucd_bidi_class ucd_lookup_bidi_class(codepoint_t c);
+
+/** @brief Lookup the Bidi Class property for each Unicode codepoint in a
+  *        buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The Bidi Class property (ucd_bidi_class) of each Unicode
+  *            codepoint.
+  */
+void ucd_lookup_bidi_class_n(const codepoint_t *in, size_t n, uint8_t *out);
+
+/** @brief Bidi Paired Bracket Type
+  * @see   http://www.unicode.org/reports/tr9/
+  */
+typedef enum ucd_bidi_paired_bracket_type_
+{
+	UCD_BIDI_PAIRED_BRACKET_TYPE_NONE,  /**< @brief Not a paired bracket */
+	UCD_BIDI_PAIRED_BRACKET_TYPE_OPEN,  /**< @brief Opening bracket */
+	UCD_BIDI_PAIRED_BRACKET_TYPE_CLOSE, /**< @brief Closing bracket */
+} ucd_bidi_paired_bracket_type;
+
+/** @brief Lookup the Bidi Paired Bracket Type property for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Bidi Paired Bracket Type property of the Unicode codepoint.
+  */
+ucd_bidi_paired_bracket_type ucd_lookup_bidi_paired_bracket_type(codepoint_t c);
+
+/** @brief Lookup the Bidi Paired Bracket property for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The opening bracket for a closing bracket, the closing bracket
+  *          for an opening bracket, or c if it is not a paired bracket.
+  */
+codepoint_t ucd_lookup_bidi_paired_bracket(codepoint_t c);
+
+/** @brief The direction of a paragraph in the bidirectional algorithm.
+  */
+typedef enum ucd_bidi_direction_
+{
+	UCD_BIDI_DIRECTION_LTR,  /**< @brief Left to right (paragraph level 0) */
+	UCD_BIDI_DIRECTION_RTL,  /**< @brief Right to left (paragraph level 1) */
+	UCD_BIDI_DIRECTION_AUTO, /**< @brief The direction of the first strong character (P2, P3) */
+} ucd_bidi_direction;
+
+/** @brief Resolve the embedding levels of a paragraph of UTF-32 data.
+  *
+  * This implements the rules of the Unicode Bidirectional Algorithm up to and
+  * including L1, so the levels can be used to reorder the text of each line
+  * in the paragraph (L2). If the paragraph is not right to left, and does not
+  * contain any right to left (R, AL or AN) or explicit embedding, override or
+  * isolate characters, the levels are set to 0 without running the rules.
+  *
+  * The characters removed by rule X9 (embedding, override and pop
+  * directional formatting characters, and BN characters) are given the level
+  * of the preceding character.
+  *
+  * @param in        The UTF-32 data of the paragraph. This may end with a
+  *                  paragraph separator (B), but should not contain any
+  *                  other paragraph separators.
+  * @param n         The number of codepoints in the in and levels buffers.
+  * @param direction The direction of the paragraph.
+  * @param levels    The resolved embedding level of each codepoint.
+  * @return          The paragraph embedding level (0 or 1), or -1 if there
+  *                  is not enough memory to resolve the levels.
+  */
+int ucd_utf32_bidi_levels(const codepoint_t *in, size_t n, ucd_bidi_direction direction, uint8_t *levels);
+
+/** @brief East Asian Width
+  * @see   http://www.unicode.org/reports/tr11/
+  */
+typedef enum ucd_east_asian_width_
+{
+	UCD_EAST_ASIAN_WIDTH_N,  /**< @brief Neutral */
+	UCD_EAST_ASIAN_WIDTH_A,  /**< @brief Ambiguous */
+	UCD_EAST_ASIAN_WIDTH_F,  /**< @brief Fullwidth */
+	UCD_EAST_ASIAN_WIDTH_H,  /**< @brief Halfwidth */
+	UCD_EAST_ASIAN_WIDTH_Na, /**< @brief Narrow */
+	UCD_EAST_ASIAN_WIDTH_W,  /**< @brief Wide */
+} ucd_east_asian_width;
+
+/** @brief Lookup the East Asian Width property for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The East Asian Width property of the Unicode codepoint.
+  */
+ucd_east_asian_width ucd_lookup_east_asian_width(codepoint_t c);
+
+/** @brief Lookup the East Asian Width property for each Unicode codepoint in
+  *        a buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The East Asian Width property (ucd_east_asian_width) of each
+  *            Unicode codepoint.
+  */
+void ucd_lookup_east_asian_width_n(const codepoint_t *in, size_t n, uint8_t *out);
+
+/** @brief Get the number of columns used to display a Unicode codepoint.
+  *
+  * Like the POSIX wcwidth function, this is 0 for the null character, and -1
+  * for the other control characters, surrogates and invalid codepoints. The
+  * non-spacing (Mn), enclosing (Me) and format (Cf) characters, other than the
+  * prepended concatenation marks, and the Hangul medial vowel and final
+  * consonant jamo, have a width of 0. The East Asian Wide (W) and Fullwidth
+  * (F) characters have a width of 2. All other characters, including the East
+  * Asian Ambiguous (A) characters, have a width of 1.
+  *
+  * @param c The Unicode codepoint to get the width of.
+  * @return  The number of columns used to display the codepoint.
+  */
+int ucd_wcwidth(codepoint_t c);
+
+/** @brief Get the number of columns used to display UTF-8 data.
+  *
+  * This is the sum of the ucd_wcwidth values of the codepoints, where the
+  * codepoints that are not printable (with a width of -1) do not use any
+  * columns. Ill-formed UTF-8 sequences have a width of 1, as they are
+  * displayed as U+FFFD.
+  *
+  * @param in  The UTF-8 data to get the width of.
+  * @param len The number of bytes in the in buffer.
+  * @return    The number of columns used to display the data.
+  */
+size_t ucd_utf8_width(const char *in, size_t len);
+
+/** @brief Get the name of a Unicode codepoint.
+  *
+  * This is the Name property of the codepoint. The names of the Hangul
+  * syllables and of the CJK and Tangut ideographs are derived from the
+  * codepoint as described in UAX #44, so are not stored in the name table.
+  *
+  * @param c      The Unicode codepoint to get the name of.
+  * @param out    The buffer to write the NUL terminated name to.
+  * @param outlen The size of the out buffer. This should be at least
+  *               UCD_MAX_NAME_LENGTH + 1 to hold the name.
+  * @return       The length of the name, not including the terminating NUL
+  *               character, or 0 if the codepoint does not have a name.
+  */
+size_t ucd_get_name(codepoint_t c, char *out, size_t outlen);
+
+/** @brief Lookup the Unicode codepoint with the given name.
+  *
+  * The name must match the Name property of the codepoint exactly, as
+  * returned by ucd_get_name.
+  *
+  * @param name The name of the Unicode codepoint.
+  * @return     The Unicode codepoint, or UCD_INVALID_CODEPOINT if no codepoint
+  *             has that name.
+  */
+codepoint_t ucd_lookup_name(const char *name);
+
+/** @brief Get a string representation of the block enumeration value.
+  *
+  * @param b The value to get the string representation for.
+  *
+  * @return The string representation, or "--" if the value is not recognized.
+  */
+const char *ucd_get_block_string(ucd_block b);
+
+/** @brief Lookup the Block for a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Block of the Unicode codepoint, or UCD_BLOCK_NB if the
+  *          codepoint is not in a block.
+  */
+ucd_block ucd_lookup_block(codepoint_t c);
+
+/** @brief Lookup the Block for each Unicode codepoint in a buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The Block (ucd_block) of each Unicode codepoint.
+  */
+void ucd_lookup_block_n(const codepoint_t *in, size_t n, uint16_t *out);
+
+/** @brief Count the number of codepoints in each Block.
+  *
+  * The counts are added to the existing values in the counts buffer, so the
+  * text can be processed in several calls.
+  *
+  * @param in     The Unicode codepoints to count.
+  * @param n      The number of codepoints in the in buffer.
+  * @param counts The number of codepoints in each Block, indexed by the
+  *               ucd_block value. This must have UCD_BLOCK_COUNT entries.
+  */
+void ucd_count_blocks(const codepoint_t *in, size_t n, size_t *counts);
+
+/** @brief Count the number of codepoints in each Block in UTF-8 data.
+  *
+  * Ill-formed UTF-8 sequences are counted as U+FFFD, in the Specials block.
+  *
+  * @param in     The UTF-8 data to count.
+  * @param len    The number of bytes in the in buffer.
+  * @param counts The number of codepoints in each Block, indexed by the
+  *               ucd_block value. This must have UCD_BLOCK_COUNT entries.
+  */
+void ucd_utf8_count_blocks(const char *in, size_t len, size_t *counts);
+
+/** @brief Age
+  *
+  * The Unicode version that a codepoint was first assigned in. The values are
+  * in version order, with the unassigned codepoints (NA) after the latest
+  * version, so the ages can be compared.
+  *
+  * @see   http://www.unicode.org/reports/tr44/
+  */
+typedef enum ucd_age_
+{
+	UCD_AGE_V1_1,  /**< @brief Unicode 1.1 */
+	UCD_AGE_V2_0,  /**< @brief Unicode 2.0 */
+	UCD_AGE_V2_1,  /**< @brief Unicode 2.1 */
+	UCD_AGE_V3_0,  /**< @brief Unicode 3.0 */
+	UCD_AGE_V3_1,  /**< @brief Unicode 3.1 */
+	UCD_AGE_V3_2,  /**< @brief Unicode 3.2 */
+	UCD_AGE_V4_0,  /**< @brief Unicode 4.0 */
+	UCD_AGE_V4_1,  /**< @brief Unicode 4.1 */
+	UCD_AGE_V5_0,  /**< @brief Unicode 5.0 */
+	UCD_AGE_V5_1,  /**< @brief Unicode 5.1 */
+	UCD_AGE_V5_2,  /**< @brief Unicode 5.2 */
+	UCD_AGE_V6_0,  /**< @brief Unicode 6.0 */
+	UCD_AGE_V6_1,  /**< @brief Unicode 6.1 */
+	UCD_AGE_V6_2,  /**< @brief Unicode 6.2 */
+	UCD_AGE_V6_3,  /**< @brief Unicode 6.3 */
+	UCD_AGE_V7_0,  /**< @brief Unicode 7.0 */
+	UCD_AGE_V8_0,  /**< @brief Unicode 8.0 */
+	UCD_AGE_V9_0,  /**< @brief Unicode 9.0 */
+	UCD_AGE_V10_0, /**< @brief Unicode 10.0 */
+	UCD_AGE_V11_0, /**< @brief Unicode 11.0 */
+	UCD_AGE_V12_0, /**< @brief Unicode 12.0 */
+	UCD_AGE_NA,    /**< @brief Unassigned */
+} ucd_age;
+
+/** @brief Lookup the Age of a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Age of the Unicode codepoint, or UCD_AGE_NA if the codepoint
+  *          is not assigned.
+  */
+ucd_age ucd_lookup_age(codepoint_t c);
+
+/** @brief Lookup the Age of each Unicode codepoint in a buffer.
+  *
+  * @param in  The Unicode codepoints to lookup.
+  * @param n   The number of codepoints in the in and out buffers.
+  * @param out The Age (ucd_age) of each Unicode codepoint.
+  */
+void ucd_lookup_age_n(const codepoint_t *in, size_t n, uint8_t *out);
+
+/** @brief Get the latest Age of the Unicode codepoints in a buffer.
+  *
+  * This is used to check that text only uses the codepoints assigned in a
+  * given Unicode version. The scan stops at the first codepoint that is newer
+  * than limit, so the text is only processed once.
+  *
+  * @param in    The Unicode codepoints to check.
+  * @param n     The number of codepoints in the in buffer.
+  * @param limit The latest Age that is allowed.
+  * @return      The latest Age of the codepoints, or the Age of the first
+  *              codepoint that is newer than limit. This is UCD_AGE_V1_1 for
+  *              an empty buffer.
+  */
+ucd_age ucd_max_age_n(const codepoint_t *in, size_t n, ucd_age limit);
+
+/** @brief Get the latest Age of the Unicode codepoints in UTF-8 data.
+  *
+  * Ill-formed UTF-8 sequences have the UCD_AGE_NA age.
+  *
+  * @param in    The UTF-8 data to check.
+  * @param len   The number of bytes in the in buffer.
+  * @param limit The latest Age that is allowed.
+  * @return      The latest Age of the codepoints, or the Age of the first
+  *              codepoint that is newer than limit.
+  */
+ucd_age ucd_utf8_max_age(const char *in, size_t len, ucd_age limit);
+
+/** @brief Numeric Type
+  * @see   http://www.unicode.org/reports/tr44/
+  */
+typedef enum ucd_numeric_type_
+{
+	UCD_NUMERIC_TYPE_None, /**< @brief The codepoint does not have a numeric value */
+	UCD_NUMERIC_TYPE_De,   /**< @brief Decimal (Nd) digit */
+	UCD_NUMERIC_TYPE_Di,   /**< @brief Digit */
+	UCD_NUMERIC_TYPE_Nu,   /**< @brief Numeric */
+} ucd_numeric_type;
+
+/** @brief Lookup the Numeric_Type property of a Unicode codepoint.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The Numeric_Type property of the Unicode codepoint.
+  */
+ucd_numeric_type ucd_lookup_numeric_type(codepoint_t c);
+
+/** @brief Lookup the Numeric_Value property of a Unicode codepoint.
+  *
+  * The numeric values from the Unihan data are not included.
+  *
+  * @param c           The Unicode codepoint to lookup.
+  * @param numerator   The numerator of the numeric value, or 0 if the
+  *                    codepoint does not have a numeric value.
+  * @param denominator The denominator of the numeric value.
+  * @return            The Numeric_Type property of the Unicode codepoint.
+  */
+ucd_numeric_type ucd_lookup_numeric_value(codepoint_t c, int64_t *numerator, int64_t *denominator);
+
+/** @brief Get the value of a decimal (Nd) digit.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The value of the digit (0 to 9), or -1 if the codepoint is not a
+  *          decimal digit.
+  */
+int ucd_digit_value(codepoint_t c);
+
+/** @brief Parse an unsigned integer at the start of UTF-8 data.
+  *
+  * The integer is the run of decimal (Nd) digits from the same set of ten
+  * digits as the first digit, so "12" in ASCII digits followed by an
+  * Arabic-Indic digit is parsed as 12.
+  *
+  * @param in    The UTF-8 data to parse.
+  * @param len   The number of bytes in the in buffer.
+  * @param value The value of the integer, or UINT64_MAX if the integer is
+  *              too large.
+  * @return      The number of bytes used by the integer, or 0 if the data
+  *              does not start with a decimal digit.
+  */
+size_t ucd_utf8_parse_uint(const char *in, size_t len, uint64_t *value);
+
+/** @brief Scan an identifier at the start of UTF-8 data.
+  *
+  * This uses the UAX #31 default identifier syntax, where the identifier is
+  * an XID_Start codepoint followed by zero or more XID_Continue codepoints.
+  * The ASCII identifier characters are checked 16 (or 32 with AVX2) bytes at
+  * a time.
+  *
+  * @param in  The UTF-8 data to scan.
+  * @param len The number of bytes in the in buffer.
+  * @return    The number of bytes used by the identifier, or 0 if the data
+  *            does not start with an XID_Start codepoint.
+  *
+  * @see   http://www.unicode.org/reports/tr31/
+  */
+size_t ucd_utf8_scan_identifier(const char *in, size_t len);
+
+/** @brief Skip the Pattern_White_Space codepoints at the start of UTF-8 data.
+  *
+  * The ASCII whitespace characters are checked 16 (or 32 with AVX2) bytes at
+  * a time.
+  *
+  * @param in  The UTF-8 data to scan.
+  * @param len The number of bytes in the in buffer.
+  * @return    The number of bytes used by the Pattern_White_Space codepoints.
+  *
+  * @see   http://www.unicode.org/reports/tr31/
+  */
+size_t ucd_utf8_skip_pattern_whitespace(const char *in, size_t len);
+
+/** @brief Get the length of the Pattern_Syntax codepoints at the start of
+  *        UTF-8 data.
+  *
+  * The ASCII syntax characters are checked 16 (or 32 with AVX2) bytes at a
+  * time.
+  *
+  * @param in  The UTF-8 data to scan.
+  * @param len The number of bytes in the in buffer.
+  * @return    The number of bytes used by the Pattern_Syntax codepoints.
+  *
+  * @see   http://www.unicode.org/reports/tr31/
+  */
+size_t ucd_utf8_span_pattern_syntax(const char *in, size_t len);
+
+/** @brief The General Category, Script, properties and case conversion data
+  *        of a Unicode codepoint.
+  */
+typedef struct ucd_record_
+{
+	ucd_property properties; /**< @brief The properties of the codepoint. */
+	uint8_t category;        /**< @brief The General Category (ucd_category) of the codepoint. */
+	uint8_t script;          /**< @brief The Script (ucd_script) of the codepoint. */
+	uint16_t casing;         /**< @brief The case conversion data index of the codepoint. */
+} ucd_record;
+
+/** @brief Lookup the record for a Unicode codepoint.
+  *
+  * The record provides the same information as ucd_lookup_category,
+  * ucd_lookup_script and ucd_properties using a single table lookup.
+  *
+  * @param c The Unicode codepoint to lookup.
+  * @return  The record of the Unicode codepoint.
+  */
+const ucd_record *ucd_lookup_record(codepoint_t c);
+
+/** @brief Convert the Unicode codepoint to upper-case using its record.
+  *
+  * @param r The record of the Unicode codepoint.
+  * @param c The Unicode codepoint to convert.
+  * @return  The same value as ucd_toupper.
+  */
+codepoint_t ucd_record_toupper(const ucd_record *r, codepoint_t c);
+
+/** @brief Convert the Unicode codepoint to lower-case using its record.
+  *
+  * @param r The record of the Unicode codepoint.
+  * @param c The Unicode codepoint to convert.
+  * @return  The same value as ucd_tolower.
+  */
+codepoint_t ucd_record_tolower(const ucd_record *r, codepoint_t c);
+
+/** @brief Convert the Unicode codepoint to title-case using its record.
+  *
+  * @param r The record of the Unicode codepoint.
+  * @param c The Unicode codepoint to convert.
+  * @return  The same value as ucd_totitle.
+  */
+codepoint_t ucd_record_totitle(const ucd_record *r, codepoint_t c);
+
+/** @brief Decode UTF-8 data to Unicode codepoints.
+  *
+  * This stops when either all the UTF-8 data has been decoded, or the out
+  * buffer is full. Ill-formed UTF-8 sequences are decoded as a codepoint
+  * greater than U+10FFFF, which has the Ii General Category.
+  *
+  * @param in   The UTF-8 data to decode.
+  * @param len  The number of bytes in the UTF-8 data.
+  * @param out  The decoded Unicode codepoints.
+  * @param n    The number of codepoints the out buffer can hold.
+  * @param used If not NULL, set to the number of bytes decoded.
+  * @return     The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf8_decode(const char *in, size_t len, codepoint_t *out, size_t n, size_t *used);
+
+/** @brief Lookup the General Category for each codepoint in UTF-8 data.
+  *
+  * Ill-formed UTF-8 sequences have the Ii General Category. The UTF-8 data
+  * should end on a codepoint boundary, as a truncated sequence at the end of
+  * the data is treated as ill-formed.
+  *
+  * @param in  The UTF-8 data to lookup.
+  * @param len The number of bytes in the UTF-8 data.
+  * @param out The General Category (ucd_category) of each codepoint. This must
+  *            have space for len entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf8_lookup_category_n(const char *in, size_t len, uint8_t *out);
+
+/** @brief Lookup the Script for each codepoint in UTF-8 data.
+  *
+  * Ill-formed UTF-8 sequences have the Zzzz Script. The UTF-8 data
+  * should end on a codepoint boundary, as a truncated sequence at the end of
+  * the data is treated as ill-formed.
+  *
+  * @param in  The UTF-8 data to lookup.
+  * @param len The number of bytes in the UTF-8 data.
+  * @param out The Script (ucd_script) of each codepoint. This must
+  *            have space for len entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf8_lookup_script_n(const char *in, size_t len, uint8_t *out);
+
+/** @brief Return the properties for each codepoint in UTF-8 data.
+  *
+  * Ill-formed UTF-8 sequences have no properties. The UTF-8 data
+  * should end on a codepoint boundary, as a truncated sequence at the end of
+  * the data is treated as ill-formed.
+  *
+  * @param in  The UTF-8 data to lookup.
+  * @param len The number of bytes in the UTF-8 data.
+  * @param out The properties of each codepoint. This must
+  *            have space for len entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf8_lookup_properties_n(const char *in, size_t len, ucd_property *out);
+
+/** @brief Return the ctype classes for each codepoint in UTF-8 data.
+  *
+  * Ill-formed UTF-8 sequences have no ctype classes. The UTF-8 data should end
+  * on a codepoint boundary, as a truncated sequence at the end of the data is
+  * treated as ill-formed.
+  *
+  * @param in  The UTF-8 data to lookup.
+  * @param len The number of bytes in the UTF-8 data.
+  * @param out The ctype classes (UCD_CTYPE_*) of each codepoint. This must
+  *            have space for len entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf8_ctype_mask_n(const char *in, size_t len, ucd_ctype *out);
+
+/** @brief Convert UTF-8 data to lower-case.
+  *
+  * Each codepoint is converted using ucd_tolower. Ill-formed UTF-8 sequences
+  * are copied unchanged. The out buffer is not null terminated.
+  *
+  * The in and out buffers may be the same, as long as the converted data is
+  * not longer than the input data at any point. This is the case when the
+  * converted codepoints have the same UTF-8 length as the input codepoints.
+  *
+  * @param in     The UTF-8 data to convert.
+  * @param len    The number of bytes in the UTF-8 data.
+  * @param out    The converted UTF-8 data.
+  * @param outlen The number of bytes the out buffer can hold.
+  * @return       The number of bytes needed to hold the converted data. If
+  *               this is greater than outlen, the out buffer only contains the
+  *               UTF-8 sequences that fit.
+  */
+size_t ucd_utf8_tolower(const char *in, size_t len, char *out, size_t outlen);
+
+/** @brief Convert UTF-8 data to upper-case.
+  *
+  * Each codepoint is converted using ucd_toupper. Ill-formed UTF-8 sequences
+  * are copied unchanged. The out buffer is not null terminated.
+  *
+  * The in and out buffers may be the same, as long as the converted data is
+  * not longer than the input data at any point. This is the case when the
+  * converted codepoints have the same UTF-8 length as the input codepoints.
+  *
+  * @param in     The UTF-8 data to convert.
+  * @param len    The number of bytes in the UTF-8 data.
+  * @param out    The converted UTF-8 data.
+  * @param outlen The number of bytes the out buffer can hold.
+  * @return       The number of bytes needed to hold the converted data. If
+  *               this is greater than outlen, the out buffer only contains the
+  *               UTF-8 sequences that fit.
+  */
+size_t ucd_utf8_toupper(const char *in, size_t len, char *out, size_t outlen);
+
+/** @brief Convert UTF-8 data to title-case.
+  *
+  * Each codepoint is converted using ucd_totitle. Ill-formed UTF-8 sequences
+  * are copied unchanged. The out buffer is not null terminated.
+  *
+  * The in and out buffers may be the same, as long as the converted data is
+  * not longer than the input data at any point. This is the case when the
+  * converted codepoints have the same UTF-8 length as the input codepoints.
+  *
+  * @param in     The UTF-8 data to convert.
+  * @param len    The number of bytes in the UTF-8 data.
+  * @param out    The converted UTF-8 data.
+  * @param outlen The number of bytes the out buffer can hold.
+  * @return       The number of bytes needed to hold the converted data. If
+  *               this is greater than outlen, the out buffer only contains the
+  *               UTF-8 sequences that fit.
+  */
+size_t ucd_utf8_totitle(const char *in, size_t len, char *out, size_t outlen);
+
+/** @brief Case fold UTF-8 data.
+  *
+  * Each codepoint is converted using ucd_casefold_full. Ill-formed UTF-8
+  * sequences are copied unchanged. The out buffer is not null terminated.
+  *
+  * The in and out buffers may be the same, as long as the folded data is not
+  * longer than the input data at any point.
+  *
+  * @param in     The UTF-8 data to case fold.
+  * @param len    The number of bytes in the UTF-8 data.
+  * @param out    The case folded UTF-8 data.
+  * @param outlen The number of bytes the out buffer can hold.
+  * @return       The number of bytes needed to hold the case folded data. If
+  *               this is greater than outlen, the out buffer only contains the
+  *               UTF-8 sequences that fit.
+  */
+size_t ucd_utf8_casefold(const char *in, size_t len, char *out, size_t outlen);
+
+/** @brief Compare two UTF-8 strings, ignoring case differences.
+  *
+  * This compares the case folded data (as written by ucd_utf8_casefold)
+  * of the two strings, without writing it to a buffer. The comparison is
+  * in codepoint order.
+  *
+  * @param a    The first UTF-8 string.
+  * @param alen The number of bytes in the first UTF-8 string.
+  * @param b    The second UTF-8 string.
+  * @param blen The number of bytes in the second UTF-8 string.
+  * @return     Less than zero if a is ordered before b, zero if they are equal,
+  *             and greater than zero if a is ordered after b.
+  */
+int ucd_utf8_casecmp(const char *a, size_t alen, const char *b, size_t blen);
+
+/** @brief Return a hash of the case folded UTF-8 data.
+  *
+  * This is the 32-bit FNV-1a hash of the case folded data (as written by
+  * ucd_utf8_casefold), without writing it to a buffer. Strings that compare
+  * equal using ucd_utf8_casecmp have the same hash.
+  *
+  * @param in  The UTF-8 data to hash.
+  * @param len The number of bytes in the UTF-8 data.
+  * @return    The hash of the case folded UTF-8 data.
+  */
+uint32_t ucd_utf8_casefold_hash(const char *in, size_t len);
+
+/** @brief Decode UTF-16 data to Unicode codepoints.
+  *
+  * This stops when either all the UTF-16 data has been decoded, or the out
+  * buffer is full. Unpaired surrogates are decoded as the surrogate codepoint,
+  * which has the Cs General Category.
+  *
+  * UTF-32 data does not need to be decoded, and can be passed directly to the
+  * codepoint buffer functions like ucd_lookup_category_n.
+  *
+  * @param in   The UTF-16 data to decode.
+  * @param len  The number of code units in the UTF-16 data.
+  * @param out  The decoded Unicode codepoints.
+  * @param n    The number of codepoints the out buffer can hold.
+  * @param used If not NULL, set to the number of code units decoded.
+  * @return     The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf16_decode(const uint16_t *in, size_t len, codepoint_t *out, size_t n, size_t *used);
+
+/** @brief Lookup the General Category for each codepoint in UTF-16 data.
+  *
+  * Unpaired surrogates have the Cs General Category, as with the
+  * codepoint buffer version of this function.
+  *
+  * @param in  The UTF-16 data to lookup.
+  * @param len The number of code units in the UTF-16 data.
+  * @param out The General Category (ucd_category) of each codepoint. This must
+  *            have space for len entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf16_lookup_category_n(const uint16_t *in, size_t len, uint8_t *out);
+
+/** @brief Lookup the Script for each codepoint in UTF-16 data.
+  *
+  * Unpaired surrogates have the Zzzz Script, as with the
+  * codepoint buffer version of this function.
+  *
+  * @param in  The UTF-16 data to lookup.
+  * @param len The number of code units in the UTF-16 data.
+  * @param out The Script (ucd_script) of each codepoint. This must
+  *            have space for len entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf16_lookup_script_n(const uint16_t *in, size_t len, uint8_t *out);
+
+/** @brief Return the properties for each codepoint in UTF-16 data.
+  *
+  * Unpaired surrogates have no properties, as with the
+  * codepoint buffer version of this function.
+  *
+  * @param in  The UTF-16 data to lookup.
+  * @param len The number of code units in the UTF-16 data.
+  * @param out The properties of each codepoint. This must
+  *            have space for len entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf16_lookup_properties_n(const uint16_t *in, size_t len, ucd_property *out);
+
+/** @brief Return the ctype classes for each codepoint in UTF-16 data.
+  *
+  * Unpaired surrogates have no ctype classes, as with the
+  * codepoint buffer version of this function.
+  *
+  * @param in  The UTF-16 data to lookup.
+  * @param len The number of code units in the UTF-16 data.
+  * @param out The ctype classes (UCD_CTYPE_*) of each codepoint. This must
+  *            have space for len entries.
+  * @return    The number of codepoints written to the out buffer.
+  */
+size_t ucd_utf16_ctype_mask_n(const uint16_t *in, size_t len, ucd_ctype *out);
+
+#ifdef __cplusplus
+}
+
+/** @brief Unicode Character Database
+  */
+namespace ucd
+{
+	/** @brief Represents a Unicode codepoint.
+	  */
+	using ::codepoint_t;
+
+	/** @brief Unicode General Category Groups
+	  * @see   http://www.unicode.org/reports/tr44/
+	  */
+	enum category_group
+	{
+		C = UCD_CATEGORY_GROUP_C, /**< @brief Other */
+		I = UCD_CATEGORY_GROUP_I, /**< @brief Invalid */
+		L = UCD_CATEGORY_GROUP_L, /**< @brief Letter */
+		M = UCD_CATEGORY_GROUP_M, /**< @brief Mark */
+		N = UCD_CATEGORY_GROUP_N, /**< @brief Number */
+		P = UCD_CATEGORY_GROUP_P, /**< @brief Punctuation */
+		S = UCD_CATEGORY_GROUP_S, /**< @brief Symbol */
+		Z = UCD_CATEGORY_GROUP_Z, /**< @brief Separator */
+	};
+
+	/** @brief Get a string representation of the category_group enumeration value.
+	  *
+	  * @param c The value to get the string representation for.
+	  *
+	  * @return The string representation, or "-" if the value is not recognized.
+	  */
+	inline const char *get_category_group_string(category_group c)
+	{
+		return ucd_get_category_group_string((ucd_category_group)c);
+	}
+
+	/** @brief Unicode General Category Values
+	  * @see   http://www.unicode.org/reports/tr44/
+	  */
+	enum category
+	{
+		Cc = UCD_CATEGORY_Cc, /**< @brief Control Character */
+		Cf = UCD_CATEGORY_Cf, /**< @brief Format Control Character */
+		Cn = UCD_CATEGORY_Cn, /**< @brief Unassigned */
+		Co = UCD_CATEGORY_Co, /**< @brief Private Use */
+		Cs = UCD_CATEGORY_Cs, /**< @brief Surrogate Code Point */
+
+		Ii = UCD_CATEGORY_Ii, /**< @brief Invalid Unicode Codepoint */
+
+		Ll = UCD_CATEGORY_Ll, /**< @brief Lower Case Letter */
+		Lm = UCD_CATEGORY_Lm, /**< @brief Letter Modifier */
+		Lo = UCD_CATEGORY_Lo, /**< @brief Other Letter */
+		Lt = UCD_CATEGORY_Lt, /**< @brief Title Case Letter */
+		Lu = UCD_CATEGORY_Lu, /**< @brief Upper Case Letter */
+
+		Mc = UCD_CATEGORY_Mc, /**< @brief Spacing Mark */
+		Me = UCD_CATEGORY_Me, /**< @brief Enclosing Mark */
+		Mn = UCD_CATEGORY_Mn, /**< @brief Non-Spacing Mark */
+
+		Nd = UCD_CATEGORY_Nd, /**< @brief Decimal Digit */
+		Nl = UCD_CATEGORY_Nl, /**< @brief Letter-Like Number */
+		No = UCD_CATEGORY_No, /**< @brief Other Number */
+
+		Pc = UCD_CATEGORY_Pc, /**< @brief Connector */
+		Pd = UCD_CATEGORY_Pd, /**< @brief Dash/Hyphen */
+		Pe = UCD_CATEGORY_Pe, /**< @brief Close Punctuation Mark */
+		Pf = UCD_CATEGORY_Pf, /**< @brief Final Quotation Mark */
+		Pi = UCD_CATEGORY_Pi, /**< @brief Initial Quotation Mark */
+		Po = UCD_CATEGORY_Po, /**< @brief Other */
+		Ps = UCD_CATEGORY_Ps, /**< @brief Open Punctuation Mark */
+
+		Sc = UCD_CATEGORY_Sc, /**< @brief Currency Symbol */
+		Sk = UCD_CATEGORY_Sk, /**< @brief Modifier Symbol */
+		Sm = UCD_CATEGORY_Sm, /**< @brief Math Symbol */
+		So = UCD_CATEGORY_So, /**< @brief Other Symbol */
+
+		Zl = UCD_CATEGORY_Zl, /**< @brief Line Separator */
+		Zp = UCD_CATEGORY_Zp, /**< @brief Paragraph Separator */
+		Zs = UCD_CATEGORY_Zs, /**< @brief Space Separator */
+	};
+
+	/** @brief Get a string representation of the category enumeration value.
+	  *
+	  * @param c The value to get the string representation for.
+	  *
+	  * @return The string representation, or "--" if the value is not recognized.
+	  */
+	inline const char *get_category_string(category c)
+	{
+		return ucd_get_category_string((ucd_category)c);
+	}
+
+	/** @brief Lookup the General Category Group for a General Category.
+	  *
+	  * @param c The General Category to lookup.
+	  * @return  The General Category Group of the General Category.
+	  */
+	inline category_group lookup_category_group(category c)
+	{
+		return (category_group)ucd_get_category_group_for_category((ucd_category)c);
+	}
+
+	/** @brief Lookup the General Category Group for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The General Category Group of the Unicode codepoint.
+	  */
+	inline category_group lookup_category_group(codepoint_t c)
+	{
+		return (category_group)ucd_lookup_category_group(c);
+	}
+
+	/** @brief Lookup the General Category for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The General Category of the Unicode codepoint.
+	  */
+	inline category lookup_category(codepoint_t c)
+	{
+		return (category)ucd_lookup_category(c);
+	}
+
+	/** @brief Lookup the General Category for each Unicode codepoint in a buffer.
+	  *
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The General Category (ucd::category) of each Unicode codepoint.
+	  */
+	inline void lookup_category(const codepoint_t *in, size_t n, uint8_t *out)
+	{
+		ucd_lookup_category_n(in, n, out);
+	}
+
+	/** @brief Get a string representation of the script enumeration value.
+	  *
+	  * @param s The value to get the string representation for.
+	  *
+	  * @return The string representation, or "----" if the value is not recognized.
+	  */
+	inline const char *get_script_string(script s)
+	{
+		return ucd_get_script_string((ucd_script)s);
+	}
+
+	/** @brief Lookup the Script for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Script of the Unicode codepoint.
+	  */
+	inline script lookup_script(codepoint_t c)
+	{
+		return (script)ucd_lookup_script(c);
+	}
+
+	/** @brief Lookup the Script for each Unicode codepoint in a buffer.
+	  *
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The Script (ucd::script) of each Unicode codepoint.
+	  */
+	inline void lookup_script(const codepoint_t *in, size_t n, uint8_t *out)
+	{
+		ucd_lookup_script_n(in, n, out);
+	}
+
+	/** @brief Lookup the Script Extensions for a Unicode codepoint.
+	  *
+	  * @param c      The Unicode codepoint to lookup.
+	  * @param out    The Script Extensions (ucd::script) of the codepoint.
+	  * @param outlen The number of scripts the out buffer can hold.
+	  * @return       The number of scripts in the Script Extensions.
+	  */
+	inline size_t lookup_script_extensions(codepoint_t c, uint8_t *out, size_t outlen)
+	{
+		return ucd_lookup_script_extensions(c, out, outlen);
+	}
+
+	/** @brief Return the length of the first script run in UTF-32 data.
+	  *
+	  * @param in The UTF-32 data to segment.
+	  * @param n  The number of codepoints in the UTF-32 data.
+	  * @param s  The script of the run.
+	  * @return   The number of codepoints in the first script run.
+	  */
+	inline size_t utf32_next_script_run(const codepoint_t *in, size_t n, script &s)
+	{
+		ucd_script ret;
+		size_t len = ucd_utf32_next_script_run(in, n, &ret);
+		s = (script)ret;
+		return len;
+	}
+
+	/** @brief Return the length of the first script run in UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to segment.
+	  * @param len The number of bytes in the UTF-8 data.
+	  * @param s   The script of the run.
+	  * @return    The number of bytes in the first script run.
+	  */
+	inline size_t utf8_next_script_run(const char *in, size_t len, script &s)
+	{
+		ucd_script ret;
+		size_t n = ucd_utf8_next_script_run(in, len, &ret);
+		s = (script)ret;
+		return n;
+	}
+
+	/** @brief Properties
+	 */
+	typedef ucd_property property;
+	enum
+	{
+		White_Space = UCD_PROPERTY_WHITE_SPACE, /**< @brief White_Space */
+		Bidi_Control = UCD_PROPERTY_BIDI_CONTROL, /**< @brief Bidi_Control */
+		Join_Control = UCD_PROPERTY_JOIN_CONTROL, /**< @brief Join_Control */
+		Dash = UCD_PROPERTY_DASH, /**< @brief Dash */
 		Hyphen = UCD_PROPERTY_HYPHEN, /**< @brief Hyphen */
 		Quotation_Mark = UCD_PROPERTY_QUOTATION_MARK, /**< @brief Quotation_Mark */
 		Terminal_Punctuation = UCD_PROPERTY_TERMINAL_PUNCTUATION, /**< @brief Terminal_Punctuation */
@@ -508,182 +2074,1352 @@ namespace ucd
 		Regional_Indicator = UCD_PROPERTY_REGIONAL_INDICATOR, /**< @brief Regional_Indicator */
 		Emoji_Component = UCD_PROPERTY_EMOJI_COMPONENT, /**< @brief Emoji_Component */
 		Extended_Pictographic = UCD_PROPERTY_EXTENDED_PICTOGRAPHIC, /**< @brief Extended_Pictographic */
+		XID_Start = UCD_PROPERTY_XID_START, /**< @brief XID_Start */
+		XID_Continue = UCD_PROPERTY_XID_CONTINUE, /**< @brief XID_Continue */
+	};
+
+	/** @brief Return the properties of the specified codepoint.
+	 *
+	 * @param c   The Unicode codepoint to lookup.
+	 * @param cat The General Category of the codepoint.
+	 * @return    The properties associated with the codepoint.
+	 */
+	inline property properties(codepoint_t c, category cat)
+	{
+		return (property)ucd_properties(c, (ucd_category)cat);
+	}
+
+	/** @brief Return the properties of the specified codepoint.
+	 *
+	 * @param c The Unicode codepoint to lookup.
+	 * @return  The properties associated with the codepoint.
+	 */
+	inline property properties(codepoint_t c)
+	{
+		return (property)ucd_lookup_properties(c);
+	}
+
+	/** @brief Return the properties of each Unicode codepoint in a buffer.
+	 *
+	 * @param in  The Unicode codepoints to lookup.
+	 * @param n   The number of codepoints in the in and out buffers.
+	 * @param out The properties associated with each Unicode codepoint.
+	 */
+	inline void properties(const codepoint_t *in, size_t n, property *out)
+	{
+		ucd_lookup_properties_n(in, n, out);
+	}
+
+	/** @brief ctype classes
+	 */
+	typedef ucd_ctype ctype;
+
+	/** @brief Return the ctype classes of the specified codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The ctype classes (UCD_CTYPE_*) the codepoint is in.
+	  */
+	inline ctype ctype_mask(codepoint_t c)
+	{
+		return (ctype)ucd_ctype_mask(c);
+	}
+
+	/** @brief Return the ctype classes of each Unicode codepoint in a buffer.
+	  *
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The ctype classes (UCD_CTYPE_*) of each Unicode codepoint.
+	  */
+	inline void ctype_mask(const codepoint_t *in, size_t n, ctype *out)
+	{
+		ucd_ctype_mask_n(in, n, out);
+	}
+
+	/** @brief Is the codepoint in the 'alnum' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'alnum' class, zero otherwise.
+	  */
+	inline int isalnum(codepoint_t c)
+	{
+		return ucd_isalnum(c);
+	}
+
+	/** @brief Is the codepoint in the 'alpha' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'alpha' class, zero otherwise.
+	  */
+	inline int isalpha(codepoint_t c)
+	{
+		return ucd_isalpha(c);
+	}
+
+	/** @brief Is the codepoint in the 'blank' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'blank' class, zero otherwise.
+	  */
+	inline int isblank(codepoint_t c)
+	{
+		return ucd_isblank(c);
+	}
+
+	/** @brief Is the codepoint in the 'cntrl' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'cntrl' class, zero otherwise.
+	  */
+	inline int iscntrl(codepoint_t c)
+	{
+		return ucd_iscntrl(c);
+	}
+
+	/** @brief Is the codepoint in the 'digit' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'digit' class, zero otherwise.
+	  */
+	inline int isdigit(codepoint_t c)
+	{
+		return ucd_isdigit(c);
+	}
+
+	/** @brief Is the codepoint in the 'graph' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'graph' class, zero otherwise.
+	  */
+	inline int isgraph(codepoint_t c)
+	{
+		return ucd_isgraph(c);
+	}
+
+	/** @brief Is the codepoint in the 'lower' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'lower' class, zero otherwise.
+	  */
+	inline int islower(codepoint_t c)
+	{
+		return ucd_islower(c);
+	}
+
+	/** @brief Is the codepoint in the 'print' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'print' class, zero otherwise.
+	  */
+	inline int isprint(codepoint_t c)
+	{
+		return ucd_isprint(c);
+	}
+
+	/** @brief Is the codepoint in the 'punct' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'punct' class, zero otherwise.
+	  */
+	inline int ispunct(codepoint_t c)
+	{
+		return ucd_ispunct(c);
+	}
+
+	/** @brief Is the codepoint in the 'space' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'space' class, zero otherwise.
+	  */
+	inline int isspace(codepoint_t c)
+	{
+		return ucd_isspace(c);
+	}
+
+	/** @brief Is the codepoint in the 'upper' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'upper' class, zero otherwise.
+	  */
+	inline int isupper(codepoint_t c)
+	{
+		return ucd_isupper(c);
+	}
+
+	/** @brief Is the codepoint in the 'xdigit' class?
+	  *
+	  * @param c The Unicode codepoint to check.
+	  * @return  Non-zero if the codepoint is in the 'xdigit' class, zero otherwise.
+	  */
+	inline int isxdigit(codepoint_t c)
+	{
+		return ucd_isxdigit(c);
+	}
+
+	/** @brief Convert the Unicode codepoint to upper-case.
+	  *
+	  * This function only uses the simple case mapping present in the
+	  * UnicodeData file. The data in SpecialCasing requires Unicode
+	  * codepoints to be mapped to multiple codepoints, so is only used by the
+	  * full case mapping functions.
+	  *
+	  * @param c The Unicode codepoint to convert.
+	  * @return  The upper-case Unicode codepoint for this codepoint, or
+	  *          this codepoint if there is no upper-case codepoint.
+	  */
+	inline codepoint_t toupper(codepoint_t c)
+	{
+		return ucd_toupper(c);
+	}
+
+	/** @brief Convert each Unicode codepoint in a buffer to upper-case.
+	  *
+	  * @param in  The Unicode codepoints to convert.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The converted Unicode codepoints.
+	  */
+	inline void toupper(const codepoint_t *in, size_t n, codepoint_t *out)
+	{
+		ucd_toupper_n(in, n, out);
+	}
+
+	/** @brief Convert the Unicode codepoint to upper-case using the full case mapping.
+	  *
+	  * @param c   The Unicode codepoint to convert.
+	  * @param out The upper-case Unicode codepoints. This must have space for
+	  *            UCD_MAX_FULL_CASE_MAPPING entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t toupper_full(codepoint_t c, codepoint_t *out)
+	{
+		return ucd_toupper_full(c, out);
+	}
+
+	/** @brief Convert each Unicode codepoint in a buffer to upper-case using the
+	  *        full case mapping.
+	  *
+	  * @param in     The Unicode codepoints to convert.
+	  * @param n      The number of codepoints in the in buffer.
+	  * @param out    The converted Unicode codepoints.
+	  * @param outlen The number of codepoints the out buffer can hold.
+	  * @return       The number of codepoints needed to hold the converted data.
+	  */
+	inline size_t toupper_full(const codepoint_t *in, size_t n, codepoint_t *out, size_t outlen)
+	{
+		return ucd_toupper_full_n(in, n, out, outlen);
+	}
+
+	/** @brief Convert the Unicode codepoint to lower-case.
+	  *
+	  * This function only uses the simple case mapping present in the
+	  * UnicodeData file. The data in SpecialCasing requires Unicode
+	  * codepoints to be mapped to multiple codepoints, so is only used by the
+	  * full case mapping functions.
+	  *
+	  * @param c The Unicode codepoint to convert.
+	  * @return  The lower-case Unicode codepoint for this codepoint, or
+	  *          this codepoint if there is no upper-case codepoint.
+	  */
+	inline codepoint_t tolower(codepoint_t c)
+	{
+		return ucd_tolower(c);
+	}
+
+	/** @brief Convert each Unicode codepoint in a buffer to lower-case.
+	  *
+	  * @param in  The Unicode codepoints to convert.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The converted Unicode codepoints.
+	  */
+	inline void tolower(const codepoint_t *in, size_t n, codepoint_t *out)
+	{
+		ucd_tolower_n(in, n, out);
+	}
+
+	/** @brief Convert the Unicode codepoint to lower-case using the full case mapping.
+	  *
+	  * @param c   The Unicode codepoint to convert.
+	  * @param out The lower-case Unicode codepoints. This must have space for
+	  *            UCD_MAX_FULL_CASE_MAPPING entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t tolower_full(codepoint_t c, codepoint_t *out)
+	{
+		return ucd_tolower_full(c, out);
+	}
+
+	/** @brief Convert each Unicode codepoint in a buffer to lower-case using the
+	  *        full case mapping.
+	  *
+	  * @param in     The Unicode codepoints to convert.
+	  * @param n      The number of codepoints in the in buffer.
+	  * @param out    The converted Unicode codepoints.
+	  * @param outlen The number of codepoints the out buffer can hold.
+	  * @return       The number of codepoints needed to hold the converted data.
+	  */
+	inline size_t tolower_full(const codepoint_t *in, size_t n, codepoint_t *out, size_t outlen)
+	{
+		return ucd_tolower_full_n(in, n, out, outlen);
+	}
+
+	/** @brief Convert the Unicode codepoint to title-case.
+	  *
+	  * This function only uses the simple case mapping present in the
+	  * UnicodeData file. The data in SpecialCasing requires Unicode
+	  * codepoints to be mapped to multiple codepoints, so is only used by the
+	  * full case mapping functions.
+	  *
+	  * @param c The Unicode codepoint to convert.
+	  * @return  The title-case Unicode codepoint for this codepoint, or
+	  *          this codepoint if there is no upper-case codepoint.
+	  */
+	inline codepoint_t totitle(codepoint_t c)
+	{
+		return ucd_totitle(c);
+	}
+
+	/** @brief Convert each Unicode codepoint in a buffer to title-case.
+	  *
+	  * @param in  The Unicode codepoints to convert.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The converted Unicode codepoints.
+	  */
+	inline void totitle(const codepoint_t *in, size_t n, codepoint_t *out)
+	{
+		ucd_totitle_n(in, n, out);
+	}
+
+	/** @brief Convert the Unicode codepoint to title-case using the full case mapping.
+	  *
+	  * @param c   The Unicode codepoint to convert.
+	  * @param out The title-case Unicode codepoints. This must have space for
+	  *            UCD_MAX_FULL_CASE_MAPPING entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t totitle_full(codepoint_t c, codepoint_t *out)
+	{
+		return ucd_totitle_full(c, out);
+	}
+
+	/** @brief Convert each Unicode codepoint in a buffer to title-case using the
+	  *        full case mapping.
+	  *
+	  * @param in     The Unicode codepoints to convert.
+	  * @param n      The number of codepoints in the in buffer.
+	  * @param out    The converted Unicode codepoints.
+	  * @param outlen The number of codepoints the out buffer can hold.
+	  * @return       The number of codepoints needed to hold the converted data.
+	  */
+	inline size_t totitle_full(const codepoint_t *in, size_t n, codepoint_t *out, size_t outlen)
+	{
+		return ucd_totitle_full_n(in, n, out, outlen);
+	}
+
+	/** @brief Case fold the Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to case fold.
+	  * @return  The case folded Unicode codepoint for this codepoint, or this
+	  *          codepoint if it does not have a case folding.
+	  */
+	inline codepoint_t casefold(codepoint_t c)
+	{
+		return ucd_casefold(c);
+	}
+
+	/** @brief Case fold the Unicode codepoint using the full case folding.
+	  *
+	  * @param c   The Unicode codepoint to case fold.
+	  * @param out The case folded Unicode codepoints. This must have space for
+	  *            UCD_MAX_FULL_CASE_MAPPING entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t casefold_full(codepoint_t c, codepoint_t *out)
+	{
+		return ucd_casefold_full(c, out);
+	}
+
+	/** @brief Grapheme Cluster Break
+	  * @see   http://www.unicode.org/reports/tr29/
+	  */
+	typedef ucd_grapheme_cluster_break grapheme_cluster_break;
+
+	/** @brief Lookup the Grapheme Cluster Break property for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Grapheme Cluster Break property of the Unicode codepoint.
+	  */
+	inline grapheme_cluster_break lookup_grapheme_cluster_break(codepoint_t c)
+	{
+		return ucd_lookup_grapheme_cluster_break(c);
+	}
+
+	/** @brief Lookup the Grapheme Cluster Break property for each Unicode
+	  *        codepoint in a buffer.
+	  *
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The Grapheme Cluster Break property of each Unicode codepoint.
+	  */
+	inline void lookup_grapheme_cluster_break(const codepoint_t *in, size_t n, uint8_t *out)
+	{
+		ucd_lookup_grapheme_cluster_break_n(in, n, out);
+	}
+
+	/** @brief The state of the grapheme cluster boundary algorithm.
+	  */
+	class grapheme_break_state
+	{
+	public:
+		grapheme_break_state()
+		{
+			ucd_grapheme_break_init(&m_state);
+		}
+
+		/** @brief Process the next codepoint using the grapheme cluster boundary rules.
+		  *
+		  * @param c The next Unicode codepoint in the text.
+		  * @return  true if there is a grapheme cluster boundary before the
+		  *          codepoint (including at the start of the text).
+		  */
+		bool next(codepoint_t c)
+		{
+			return ucd_grapheme_break_next(&m_state, c) != 0;
+		}
+	private:
+		ucd_grapheme_break_state m_state;
+	};
+
+	/** @brief Return the length of the first grapheme cluster in UTF-32 data.
+	  *
+	  * @param in The UTF-32 data to segment.
+	  * @param n  The number of codepoints in the UTF-32 data.
+	  * @return   The number of codepoints in the first grapheme cluster.
+	  */
+	inline size_t utf32_next_grapheme(const codepoint_t *in, size_t n)
+	{
+		return ucd_utf32_next_grapheme(in, n);
+	}
+
+	/** @brief Return the length of the first grapheme cluster in UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to segment.
+	  * @param len The number of bytes in the UTF-8 data.
+	  * @return    The number of bytes in the first grapheme cluster.
+	  */
+	inline size_t utf8_next_grapheme(const char *in, size_t len)
+	{
+		return ucd_utf8_next_grapheme(in, len);
+	}
+
+	/** @brief Word Break
+	  * @see   http://www.unicode.org/reports/tr29/
+	  */
+	typedef ucd_word_break word_break;
+
+	/** @brief Lookup the Word Break property for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Word Break property of the Unicode codepoint.
+	  */
+	inline word_break lookup_word_break(codepoint_t c)
+	{
+		return ucd_lookup_word_break(c);
+	}
+
+	/** @brief Lookup the Word Break property for each Unicode codepoint in a
+	  *        buffer.
+	  *
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The Word Break property of each Unicode codepoint.
+	  */
+	inline void lookup_word_break(const codepoint_t *in, size_t n, uint8_t *out)
+	{
+		ucd_lookup_word_break_n(in, n, out);
+	}
+
+	/** @brief Return the length of the first word in UTF-32 data.
+	  *
+	  * @param in The UTF-32 data to segment.
+	  * @param n  The number of codepoints in the UTF-32 data.
+	  * @return   The number of codepoints in the first word.
+	  */
+	inline size_t utf32_next_word(const codepoint_t *in, size_t n)
+	{
+		return ucd_utf32_next_word(in, n);
+	}
+
+	/** @brief Return the length of the first word in UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to segment.
+	  * @param len The number of bytes in the UTF-8 data.
+	  * @return    The number of bytes in the first word.
+	  */
+	inline size_t utf8_next_word(const char *in, size_t len)
+	{
+		return ucd_utf8_next_word(in, len);
+	}
+
+	/** @brief Sentence Break
+	  * @see   http://www.unicode.org/reports/tr29/
+	  */
+	typedef ucd_sentence_break sentence_break;
+
+	/** @brief Lookup the Sentence Break property for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Sentence Break property of the Unicode codepoint.
+	  */
+	inline sentence_break lookup_sentence_break(codepoint_t c)
+	{
+		return ucd_lookup_sentence_break(c);
+	}
+
+	/** @brief Lookup the Sentence Break property for each Unicode codepoint in a
+	  *        buffer.
+	  *
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The Sentence Break property of each Unicode codepoint.
+	  */
+	inline void lookup_sentence_break(const codepoint_t *in, size_t n, uint8_t *out)
+	{
+		ucd_lookup_sentence_break_n(in, n, out);
+	}
+
+	/** @brief Return the length of the first sentence in UTF-32 data.
+	  *
+	  * @param in The UTF-32 data to segment.
+	  * @param n  The number of codepoints in the UTF-32 data.
+	  * @return   The number of codepoints in the first sentence.
+	  */
+	inline size_t utf32_next_sentence(const codepoint_t *in, size_t n)
+	{
+		return ucd_utf32_next_sentence(in, n);
+	}
+
+	/** @brief Return the length of the first sentence in UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to segment.
+	  * @param len The number of bytes in the UTF-8 data.
+	  * @return    The number of bytes in the first sentence.
+	  */
+	inline size_t utf8_next_sentence(const char *in, size_t len)
+	{
+		return ucd_utf8_next_sentence(in, len);
+	}
+
+	/** @brief Line Break
+	  * @see   http://www.unicode.org/reports/tr14/
+	  */
+	typedef ucd_line_break line_break;
+
+	/** @brief Lookup the Line Break property for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Line Break property of the Unicode codepoint.
+	  */
+	inline line_break lookup_line_break(codepoint_t c)
+	{
+		return ucd_lookup_line_break(c);
+	}
+
+	/** @brief Lookup the Line Break property for each Unicode codepoint in a
+	  *        buffer.
+	  *
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The Line Break property of each Unicode codepoint.
+	  */
+	inline void lookup_line_break(const codepoint_t *in, size_t n, uint8_t *out)
+	{
+		ucd_lookup_line_break_n(in, n, out);
+	}
+
+	/** @brief The line break opportunity before a codepoint.
+	  */
+	typedef ucd_break_opportunity break_opportunity;
+
+	/** @brief The state of the line breaking algorithm.
+	  */
+	class line_break_state
+	{
+	public:
+		line_break_state()
+		{
+			ucd_line_break_init(&m_state);
+		}
+
+		/** @brief Find the line break opportunities in a chunk of UTF-32 data.
+		  *
+		  * @param in   The UTF-32 data to process.
+		  * @param n    The number of codepoints in the in and out buffers.
+		  * @param last Set if this is the last chunk in the paragraph.
+		  * @param out  The line break opportunity before each codepoint.
+		  * @return     The number of codepoints processed.
+		  */
+		size_t next(const codepoint_t *in, size_t n, bool last, uint8_t *out)
+		{
+			return ucd_utf32_line_breaks(&m_state, in, n, last, out);
+		}
+
+		/** @brief Find the line break opportunities in a chunk of UTF-8 data.
+		  *
+		  * @param in   The UTF-8 data to process.
+		  * @param len  The number of bytes in the in and out buffers.
+		  * @param last Set if this is the last chunk in the paragraph.
+		  * @param out  The line break opportunity before each byte.
+		  * @return     The number of bytes processed.
+		  */
+		size_t next(const char *in, size_t len, bool last, uint8_t *out)
+		{
+			return ucd_utf8_line_breaks(&m_state, in, len, last, out);
+		}
+	private:
+		ucd_line_break_state m_state;
 	};
 
-	/** @brief Return the properties of the specified codepoint.
-	 *
-	 * @param c   The Unicode codepoint to lookup.
-	 * @param cat The General Category of the codepoint.
-	 * @return    The properties associated with the codepoint.
-	 */
-	inline property properties(codepoint_t c, category cat)
+	/** @brief Lookup the Canonical Combining Class for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Canonical_Combining_Class property of the Unicode codepoint.
+	  */
+	inline uint8_t lookup_ccc(codepoint_t c)
+	{
+		return ucd_lookup_ccc(c);
+	}
+
+	/** @brief Lookup the Canonical Combining Class for each Unicode codepoint
+	  *        in a buffer.
+	  *
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The Canonical_Combining_Class property of each Unicode codepoint.
+	  */
+	inline void lookup_ccc(const codepoint_t *in, size_t n, uint8_t *out)
+	{
+		ucd_lookup_ccc_n(in, n, out);
+	}
+
+	/** @brief Unicode Normalization Forms
+	  * @see   http://www.unicode.org/reports/tr15/
+	  */
+	typedef ucd_normalization_form normalization_form;
+
+	/** @brief The result of a normalization quick check.
+	  */
+	typedef ucd_quick_check quick_check;
+
+	/** @brief Lookup the NFC_QC, NFD_QC, NFKC_QC or NFKD_QC property for a
+	  *        Unicode codepoint.
+	  *
+	  * @param c    The Unicode codepoint to lookup.
+	  * @param form The normalization form of the quick check property.
+	  * @return     The quick check property of the Unicode codepoint.
+	  */
+	inline quick_check lookup_quick_check(codepoint_t c, normalization_form form)
+	{
+		return ucd_lookup_quick_check(c, form);
+	}
+
+	/** @brief Get the full decomposition of a Unicode codepoint.
+	  *
+	  * @param c    The Unicode codepoint to decompose.
+	  * @param form The normalization form of the decomposition.
+	  * @param out  The decomposed Unicode codepoints. This must have space for
+	  *             UCD_MAX_DECOMPOSITION entries.
+	  * @return     The number of codepoints written to the out buffer.
+	  */
+	inline size_t decompose(codepoint_t c, normalization_form form, codepoint_t *out)
+	{
+		return ucd_decompose(c, form, out);
+	}
+
+	/** @brief Get the primary composite of two Unicode codepoints.
+	  *
+	  * @param a The first Unicode codepoint.
+	  * @param b The second Unicode codepoint.
+	  * @return  The primary composite of a followed by b, or 0 if there is none.
+	  */
+	inline codepoint_t compose(codepoint_t a, codepoint_t b)
+	{
+		return ucd_compose(a, b);
+	}
+
+	/** @brief Check if UTF-32 data is normalized using the quick check
+	  *        properties.
+	  *
+	  * @param in   The UTF-32 data to check.
+	  * @param n    The number of codepoints in the UTF-32 data.
+	  * @param form The normalization form to check for.
+	  * @return     The quick check result.
+	  */
+	inline quick_check utf32_quick_check(const codepoint_t *in, size_t n, normalization_form form)
+	{
+		return ucd_utf32_quick_check(in, n, form);
+	}
+
+	/** @brief Check if UTF-8 data is normalized using the quick check
+	  *        properties.
+	  *
+	  * @param in   The UTF-8 data to check.
+	  * @param len  The number of bytes in the UTF-8 data.
+	  * @param form The normalization form to check for.
+	  * @return     The quick check result.
+	  */
+	inline quick_check utf8_quick_check(const char *in, size_t len, normalization_form form)
+	{
+		return ucd_utf8_quick_check(in, len, form);
+	}
+
+	/** @brief Check if UTF-32 data is normalized.
+	  *
+	  * @param in   The UTF-32 data to check.
+	  * @param n    The number of codepoints in the UTF-32 data.
+	  * @param form The normalization form to check for.
+	  * @return     True if the text is in the normalization form, or false if
+	  *             it is not or there is not enough memory to check it.
+	  */
+	inline bool utf32_is_normalized(const codepoint_t *in, size_t n, normalization_form form)
+	{
+		return ucd_utf32_is_normalized(in, n, form) > 0;
+	}
+
+	/** @brief Check if UTF-8 data is normalized.
+	  *
+	  * @param in   The UTF-8 data to check.
+	  * @param len  The number of bytes in the UTF-8 data.
+	  * @param form The normalization form to check for.
+	  * @return     True if the text is in the normalization form, or false if
+	  *             it is not or there is not enough memory to check it.
+	  */
+	inline bool utf8_is_normalized(const char *in, size_t len, normalization_form form)
+	{
+		return ucd_utf8_is_normalized(in, len, form) > 0;
+	}
+
+	/** @brief Normalize UTF-32 data.
+	  *
+	  * @param in     The UTF-32 data to normalize.
+	  * @param n      The number of codepoints in the UTF-32 data.
+	  * @param form   The normalization form to convert the text to.
+	  * @param out    The normalized UTF-32 data.
+	  * @param outlen The number of codepoints the out buffer can hold.
+	  * @return       The number of codepoints needed to hold the normalized data.
+	  */
+	inline size_t utf32_normalize(const codepoint_t *in, size_t n, normalization_form form, codepoint_t *out, size_t outlen)
+	{
+		return ucd_utf32_normalize(in, n, form, out, outlen);
+	}
+
+	/** @brief Normalize UTF-8 data.
+	  *
+	  * @param in     The UTF-8 data to normalize.
+	  * @param len    The number of bytes in the UTF-8 data.
+	  * @param form   The normalization form to convert the text to.
+	  * @param out    The normalized UTF-8 data.
+	  * @param outlen The number of bytes the out buffer can hold.
+	  * @return       The number of bytes needed to hold the normalized data.
+	  */
+	inline size_t utf8_normalize(const char *in, size_t len, normalization_form form, char *out, size_t outlen)
+	{
+		return ucd_utf8_normalize(in, len, form, out, outlen);
+	}
+
+	/** @brief Bidi Class
+	  * @see   http://www.unicode.org/reports/tr9/
+	  */
+	typedef ucd_bidi_class bidi_class;
+
+	/** @brief Lookup the Bidi Class property for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Bidi Class property of the Unicode codepoint.
+	  */
+	inline bidi_class lookup_bidi_class(codepoint_t c)
+	{
+		return ucd_lookup_bidi_class(c);
+	}
+
+	/** @brief Lookup the Bidi Class property for each Unicode codepoint in a
+	  *        buffer.
+	  *
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The Bidi Class property of each Unicode codepoint.
+	  */
+	inline void lookup_bidi_class(const codepoint_t *in, size_t n, uint8_t *out)
+	{
+		ucd_lookup_bidi_class_n(in, n, out);
+	}
+
+	/** @brief Bidi Paired Bracket Type
+	  * @see   http://www.unicode.org/reports/tr9/
+	  */
+	typedef ucd_bidi_paired_bracket_type bidi_paired_bracket_type;
+
+	/** @brief Lookup the Bidi Paired Bracket Type property for a Unicode
+	  *        codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Bidi Paired Bracket Type property of the Unicode codepoint.
+	  */
+	inline bidi_paired_bracket_type lookup_bidi_paired_bracket_type(codepoint_t c)
+	{
+		return ucd_lookup_bidi_paired_bracket_type(c);
+	}
+
+	/** @brief Lookup the Bidi Paired Bracket property for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The paired bracket of the Unicode codepoint, or c if it is not
+	  *          a paired bracket.
+	  */
+	inline codepoint_t lookup_bidi_paired_bracket(codepoint_t c)
 	{
-		return (property)ucd_properties(c, (ucd_category)cat);
+		return ucd_lookup_bidi_paired_bracket(c);
 	}
 
-	/** @brief Is the codepoint in the 'alnum' class?
+	/** @brief The direction of a paragraph in the bidirectional algorithm.
+	  */
+	typedef ucd_bidi_direction bidi_direction;
+
+	/** @brief Resolve the embedding levels of a paragraph of UTF-32 data.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'alnum' class, zero otherwise.
+	  * @param in        The UTF-32 data of the paragraph.
+	  * @param n         The number of codepoints in the in and levels buffers.
+	  * @param direction The direction of the paragraph.
+	  * @param levels    The resolved embedding level of each codepoint.
+	  * @return          The paragraph embedding level (0 or 1), or -1 if there
+	  *                  is not enough memory to resolve the levels.
 	  */
-	inline int isalnum(codepoint_t c)
+	inline int utf32_bidi_levels(const codepoint_t *in, size_t n, bidi_direction direction, uint8_t *levels)
 	{
-		return ucd_isalnum(c);
+		return ucd_utf32_bidi_levels(in, n, direction, levels);
 	}
 
-	/** @brief Is the codepoint in the 'alpha' class?
+	/** @brief East Asian Width
+	  * @see   http://www.unicode.org/reports/tr11/
+	  */
+	typedef ucd_east_asian_width east_asian_width;
+
+	/** @brief Lookup the East Asian Width property for a Unicode codepoint.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'alpha' class, zero otherwise.
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The East Asian Width property of the Unicode codepoint.
 	  */
-	inline int isalpha(codepoint_t c)
+	inline east_asian_width lookup_east_asian_width(codepoint_t c)
 	{
-		return ucd_isalpha(c);
+		return ucd_lookup_east_asian_width(c);
 	}
 
-	/** @brief Is the codepoint in the 'blank' class?
+	/** @brief Lookup the East Asian Width property for each Unicode codepoint
+	  *        in a buffer.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'blank' class, zero otherwise.
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The East Asian Width property of each Unicode codepoint.
 	  */
-	inline int isblank(codepoint_t c)
+	inline void lookup_east_asian_width(const codepoint_t *in, size_t n, uint8_t *out)
 	{
-		return ucd_isblank(c);
+		ucd_lookup_east_asian_width_n(in, n, out);
 	}
 
-	/** @brief Is the codepoint in the 'cntrl' class?
+	/** @brief Get the number of columns used to display a Unicode codepoint.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'cntrl' class, zero otherwise.
+	  * @param c The Unicode codepoint to get the width of.
+	  * @return  The number of columns used to display the codepoint, or -1 if
+	  *          it is not printable.
 	  */
-	inline int iscntrl(codepoint_t c)
+	inline int wcwidth(codepoint_t c)
 	{
-		return ucd_iscntrl(c);
+		return ucd_wcwidth(c);
 	}
 
-	/** @brief Is the codepoint in the 'digit' class?
+	/** @brief Get the number of columns used to display UTF-8 data.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'digit' class, zero otherwise.
+	  * @param in  The UTF-8 data to get the width of.
+	  * @param len The number of bytes in the in buffer.
+	  * @return    The number of columns used to display the data.
 	  */
-	inline int isdigit(codepoint_t c)
+	inline size_t utf8_width(const char *in, size_t len)
 	{
-		return ucd_isdigit(c);
+		return ucd_utf8_width(in, len);
 	}
 
-	/** @brief Is the codepoint in the 'graph' class?
+	/** @brief Get the name of a Unicode codepoint.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'graph' class, zero otherwise.
+	  * @param c      The Unicode codepoint to get the name of.
+	  * @param out    The buffer to write the NUL terminated name to.
+	  * @param outlen The size of the out buffer.
+	  * @return       The length of the name, or 0 if the codepoint does not
+	  *               have a name.
 	  */
-	inline int isgraph(codepoint_t c)
+	inline size_t get_name(codepoint_t c, char *out, size_t outlen)
 	{
-		return ucd_isgraph(c);
+		return ucd_get_name(c, out, outlen);
 	}
 
-	/** @brief Is the codepoint in the 'lower' class?
+	/** @brief Lookup the Unicode codepoint with the given name.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'lower' class, zero otherwise.
+	  * @param name The name of the Unicode codepoint.
+	  * @return     The Unicode codepoint, or UCD_INVALID_CODEPOINT if no
+	  *             codepoint has that name.
 	  */
-	inline int islower(codepoint_t c)
+	inline codepoint_t lookup_name(const char *name)
 	{
-		return ucd_islower(c);
+		return ucd_lookup_name(name);
 	}
 
-	/** @brief Is the codepoint in the 'print' class?
+	/** @brief Unicode Block
+	  */
+	typedef ucd_block block;
+
+	/** @brief Get a string representation of the block enumeration value.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'print' class, zero otherwise.
+	  * @param b The value to get the string representation for.
+	  *
+	  * @return The string representation, or "--" if the value is not recognized.
 	  */
-	inline int isprint(codepoint_t c)
+	inline const char *get_block_string(block b)
 	{
-		return ucd_isprint(c);
+		return ucd_get_block_string(b);
 	}
 
-	/** @brief Is the codepoint in the 'punct' class?
+	/** @brief Lookup the Block for a Unicode codepoint.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'punct' class, zero otherwise.
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Block of the Unicode codepoint.
 	  */
-	inline int ispunct(codepoint_t c)
+	inline block lookup_block(codepoint_t c)
 	{
-		return ucd_ispunct(c);
+		return ucd_lookup_block(c);
 	}
 
-	/** @brief Is the codepoint in the 'space' class?
+	/** @brief Lookup the Block for each Unicode codepoint in a buffer.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'space' class, zero otherwise.
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The Block (ucd_block) of each Unicode codepoint.
 	  */
-	inline int isspace(codepoint_t c)
+	inline void lookup_block(const codepoint_t *in, size_t n, uint16_t *out)
 	{
-		return ucd_isspace(c);
+		ucd_lookup_block_n(in, n, out);
 	}
 
-	/** @brief Is the codepoint in the 'upper' class?
+	/** @brief Count the number of codepoints in each Block.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'upper' class, zero otherwise.
+	  * @param in     The Unicode codepoints to count.
+	  * @param n      The number of codepoints in the in buffer.
+	  * @param counts The number of codepoints in each Block. This must have
+	  *               UCD_BLOCK_COUNT entries.
 	  */
-	inline int isupper(codepoint_t c)
+	inline void count_blocks(const codepoint_t *in, size_t n, size_t *counts)
 	{
-		return ucd_isupper(c);
+		ucd_count_blocks(in, n, counts);
 	}
 
-	/** @brief Is the codepoint in the 'xdigit' class?
+	/** @brief Count the number of codepoints in each Block in UTF-8 data.
 	  *
-	  * @param c The Unicode codepoint to check.
-	  * @return  Non-zero if the codepoint is in the 'xdigit' class, zero otherwise.
+	  * @param in     The UTF-8 data to count.
+	  * @param len    The number of bytes in the in buffer.
+	  * @param counts The number of codepoints in each Block. This must have
+	  *               UCD_BLOCK_COUNT entries.
 	  */
-	inline int isxdigit(codepoint_t c)
+	inline void utf8_count_blocks(const char *in, size_t len, size_t *counts)
 	{
-		return ucd_isxdigit(c);
+		ucd_utf8_count_blocks(in, len, counts);
 	}
 
-	/** @brief Convert the Unicode codepoint to upper-case.
+	/** @brief Age
+	  */
+	typedef ucd_age age;
+
+	/** @brief Lookup the Age of a Unicode codepoint.
 	  *
-	  * This function only uses the simple case mapping present in the
-	  * UnicodeData file. The data in SpecialCasing requires Unicode
-	  * codepoints to be mapped to multiple codepoints.
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Age of the Unicode codepoint.
+	  */
+	inline age lookup_age(codepoint_t c)
+	{
+		return ucd_lookup_age(c);
+	}
+
+	/** @brief Lookup the Age of each Unicode codepoint in a buffer.
 	  *
-	  * @param c The Unicode codepoint to convert.
-	  * @return  The upper-case Unicode codepoint for this codepoint, or
-	  *          this codepoint if there is no upper-case codepoint.
+	  * @param in  The Unicode codepoints to lookup.
+	  * @param n   The number of codepoints in the in and out buffers.
+	  * @param out The Age (ucd_age) of each Unicode codepoint.
 	  */
-	inline codepoint_t toupper(codepoint_t c)
+	inline void lookup_age(const codepoint_t *in, size_t n, uint8_t *out)
 	{
-		return ucd_toupper(c);
+		ucd_lookup_age_n(in, n, out);
 	}
 
-	/** @brief Convert the Unicode codepoint to lower-case.
+	/** @brief Get the latest Age of the Unicode codepoints in a buffer.
 	  *
-	  * This function only uses the simple case mapping present in the
-	  * UnicodeData file. The data in SpecialCasing requires Unicode
-	  * codepoints to be mapped to multiple codepoints.
+	  * @param in    The Unicode codepoints to check.
+	  * @param n     The number of codepoints in the in buffer.
+	  * @param limit The latest Age that is allowed.
+	  * @return      The latest Age of the codepoints, stopping at the first
+	  *              codepoint that is newer than limit.
+	  */
+	inline age max_age(const codepoint_t *in, size_t n, age limit)
+	{
+		return ucd_max_age_n(in, n, limit);
+	}
+
+	/** @brief Get the latest Age of the Unicode codepoints in UTF-8 data.
+	  *
+	  * @param in    The UTF-8 data to check.
+	  * @param len   The number of bytes in the in buffer.
+	  * @param limit The latest Age that is allowed.
+	  * @return      The latest Age of the codepoints, stopping at the first
+	  *              codepoint that is newer than limit.
+	  */
+	inline age utf8_max_age(const char *in, size_t len, age limit)
+	{
+		return ucd_utf8_max_age(in, len, limit);
+	}
+
+	/** @brief Numeric Type
+	  */
+	typedef ucd_numeric_type numeric_type;
+
+	/** @brief Lookup the Numeric_Type property of a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The Numeric_Type property of the Unicode codepoint.
+	  */
+	inline numeric_type lookup_numeric_type(codepoint_t c)
+	{
+		return ucd_lookup_numeric_type(c);
+	}
+
+	/** @brief Lookup the Numeric_Value property of a Unicode codepoint.
+	  *
+	  * @param c           The Unicode codepoint to lookup.
+	  * @param numerator   The numerator of the numeric value.
+	  * @param denominator The denominator of the numeric value.
+	  * @return            The Numeric_Type property of the Unicode codepoint.
+	  */
+	inline numeric_type lookup_numeric_value(codepoint_t c, int64_t &numerator, int64_t &denominator)
+	{
+		return ucd_lookup_numeric_value(c, &numerator, &denominator);
+	}
+
+	/** @brief Get the value of a decimal (Nd) digit.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The value of the digit (0 to 9), or -1 if the codepoint is not
+	  *          a decimal digit.
+	  */
+	inline int digit_value(codepoint_t c)
+	{
+		return ucd_digit_value(c);
+	}
+
+	/** @brief Parse an unsigned integer at the start of UTF-8 data.
+	  *
+	  * @param in    The UTF-8 data to parse.
+	  * @param len   The number of bytes in the in buffer.
+	  * @param value The value of the integer.
+	  * @return      The number of bytes used by the integer.
+	  */
+	inline size_t utf8_parse_uint(const char *in, size_t len, uint64_t &value)
+	{
+		return ucd_utf8_parse_uint(in, len, &value);
+	}
+
+	/** @brief Scan an identifier at the start of UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to scan.
+	  * @param len The number of bytes in the in buffer.
+	  * @return    The number of bytes used by the identifier.
+	  */
+	inline size_t utf8_scan_identifier(const char *in, size_t len)
+	{
+		return ucd_utf8_scan_identifier(in, len);
+	}
+
+	/** @brief Skip the Pattern_White_Space codepoints at the start of UTF-8
+	  *        data.
+	  *
+	  * @param in  The UTF-8 data to scan.
+	  * @param len The number of bytes in the in buffer.
+	  * @return    The number of bytes used by the Pattern_White_Space codepoints.
+	  */
+	inline size_t utf8_skip_pattern_whitespace(const char *in, size_t len)
+	{
+		return ucd_utf8_skip_pattern_whitespace(in, len);
+	}
+
+	/** @brief Get the length of the Pattern_Syntax codepoints at the start of
+	  *        UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to scan.
+	  * @param len The number of bytes in the in buffer.
+	  * @return    The number of bytes used by the Pattern_Syntax codepoints.
+	  */
+	inline size_t utf8_span_pattern_syntax(const char *in, size_t len)
+	{
+		return ucd_utf8_span_pattern_syntax(in, len);
+	}
+
+	/** @brief The General Category, Script, properties and case conversion data
+	  *        of a Unicode codepoint.
+	  */
+	typedef ucd_record record;
+
+	/** @brief Lookup the record for a Unicode codepoint.
+	  *
+	  * @param c The Unicode codepoint to lookup.
+	  * @return  The record of the Unicode codepoint.
+	  */
+	inline const record &lookup_record(codepoint_t c)
+	{
+		return *ucd_lookup_record(c);
+	}
+
+	/** @brief Convert the Unicode codepoint to upper-case using its record.
 	  *
+	  * @param r The record of the Unicode codepoint.
 	  * @param c The Unicode codepoint to convert.
-	  * @return  The lower-case Unicode codepoint for this codepoint, or
-	  *          this codepoint if there is no upper-case codepoint.
+	  * @return  The same value as toupper.
 	  */
-	inline codepoint_t tolower(codepoint_t c)
+	inline codepoint_t toupper(const record &r, codepoint_t c)
 	{
-		return ucd_tolower(c);
+		return ucd_record_toupper(&r, c);
 	}
 
-	/** @brief Convert the Unicode codepoint to title-case.
+	/** @brief Convert the Unicode codepoint to lower-case using its record.
 	  *
-	  * This function only uses the simple case mapping present in the
-	  * UnicodeData file. The data in SpecialCasing requires Unicode
-	  * codepoints to be mapped to multiple codepoints.
+	  * @param r The record of the Unicode codepoint.
+	  * @param c The Unicode codepoint to convert.
+	  * @return  The same value as tolower.
+	  */
+	inline codepoint_t tolower(const record &r, codepoint_t c)
+	{
+		return ucd_record_tolower(&r, c);
+	}
+
+	/** @brief Convert the Unicode codepoint to title-case using its record.
 	  *
+	  * @param r The record of the Unicode codepoint.
 	  * @param c The Unicode codepoint to convert.
-	  * @return  The title-case Unicode codepoint for this codepoint, or
-	  *          this codepoint if there is no upper-case codepoint.
+	  * @return  The same value as totitle.
 	  */
-	inline codepoint_t totitle(codepoint_t c)
+	inline codepoint_t totitle(const record &r, codepoint_t c)
 	{
-		return ucd_totitle(c);
+		return ucd_record_totitle(&r, c);
+	}
+
+	/** @brief Decode UTF-8 data to Unicode codepoints.
+	  *
+	  * @param in   The UTF-8 data to decode.
+	  * @param len  The number of bytes in the UTF-8 data.
+	  * @param out  The decoded Unicode codepoints.
+	  * @param n    The number of codepoints the out buffer can hold.
+	  * @param used If not NULL, set to the number of bytes decoded.
+	  * @return     The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf8_decode(const char *in, size_t len, codepoint_t *out, size_t n, size_t *used = NULL)
+	{
+		return ucd_utf8_decode(in, len, out, n, used);
+	}
+
+	/** @brief Lookup the General Category for each codepoint in UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to lookup.
+	  * @param len The number of bytes in the UTF-8 data.
+	  * @param out The General Category (ucd::category) of each codepoint. This
+	  *            must have space for len entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf8_lookup_category(const char *in, size_t len, uint8_t *out)
+	{
+		return ucd_utf8_lookup_category_n(in, len, out);
+	}
+
+	/** @brief Lookup the Script for each codepoint in UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to lookup.
+	  * @param len The number of bytes in the UTF-8 data.
+	  * @param out The Script (ucd::script) of each codepoint. This must
+	  *            have space for len entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf8_lookup_script(const char *in, size_t len, uint8_t *out)
+	{
+		return ucd_utf8_lookup_script_n(in, len, out);
+	}
+
+	/** @brief Return the properties for each codepoint in UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to lookup.
+	  * @param len The number of bytes in the UTF-8 data.
+	  * @param out The properties of each codepoint. This must
+	  *            have space for len entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf8_properties(const char *in, size_t len, property *out)
+	{
+		return ucd_utf8_lookup_properties_n(in, len, out);
+	}
+
+	/** @brief Return the ctype classes for each codepoint in UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to lookup.
+	  * @param len The number of bytes in the UTF-8 data.
+	  * @param out The ctype classes (UCD_CTYPE_*) of each codepoint. This must
+	  *            have space for len entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf8_ctype_mask(const char *in, size_t len, ctype *out)
+	{
+		return ucd_utf8_ctype_mask_n(in, len, out);
+	}
+
+	/** @brief Convert UTF-8 data to lower-case.
+	  *
+	  * @param in     The UTF-8 data to convert.
+	  * @param len    The number of bytes in the UTF-8 data.
+	  * @param out    The converted UTF-8 data.
+	  * @param outlen The number of bytes the out buffer can hold.
+	  * @return       The number of bytes needed to hold the converted data.
+	  */
+	inline size_t utf8_tolower(const char *in, size_t len, char *out, size_t outlen)
+	{
+		return ucd_utf8_tolower(in, len, out, outlen);
+	}
+
+	/** @brief Convert UTF-8 data to upper-case.
+	  *
+	  * @param in     The UTF-8 data to convert.
+	  * @param len    The number of bytes in the UTF-8 data.
+	  * @param out    The converted UTF-8 data.
+	  * @param outlen The number of bytes the out buffer can hold.
+	  * @return       The number of bytes needed to hold the converted data.
+	  */
+	inline size_t utf8_toupper(const char *in, size_t len, char *out, size_t outlen)
+	{
+		return ucd_utf8_toupper(in, len, out, outlen);
+	}
+
+	/** @brief Convert UTF-8 data to title-case.
+	  *
+	  * @param in     The UTF-8 data to convert.
+	  * @param len    The number of bytes in the UTF-8 data.
+	  * @param out    The converted UTF-8 data.
+	  * @param outlen The number of bytes the out buffer can hold.
+	  * @return       The number of bytes needed to hold the converted data.
+	  */
+	inline size_t utf8_totitle(const char *in, size_t len, char *out, size_t outlen)
+	{
+		return ucd_utf8_totitle(in, len, out, outlen);
+	}
+
+	/** @brief Case fold UTF-8 data.
+	  *
+	  * @param in     The UTF-8 data to case fold.
+	  * @param len    The number of bytes in the UTF-8 data.
+	  * @param out    The case folded UTF-8 data.
+	  * @param outlen The number of bytes the out buffer can hold.
+	  * @return       The number of bytes needed to hold the case folded data.
+	  */
+	inline size_t utf8_casefold(const char *in, size_t len, char *out, size_t outlen)
+	{
+		return ucd_utf8_casefold(in, len, out, outlen);
+	}
+
+	/** @brief Compare two UTF-8 strings, ignoring case differences.
+	  *
+	  * @param a    The first UTF-8 string.
+	  * @param alen The number of bytes in the first UTF-8 string.
+	  * @param b    The second UTF-8 string.
+	  * @param blen The number of bytes in the second UTF-8 string.
+	  * @return     Less than zero if a is ordered before b, zero if they are
+	  *             equal, and greater than zero if a is ordered after b.
+	  */
+	inline int utf8_casecmp(const char *a, size_t alen, const char *b, size_t blen)
+	{
+		return ucd_utf8_casecmp(a, alen, b, blen);
+	}
+
+	/** @brief Return a hash of the case folded UTF-8 data.
+	  *
+	  * @param in  The UTF-8 data to hash.
+	  * @param len The number of bytes in the UTF-8 data.
+	  * @return    The hash of the case folded UTF-8 data.
+	  */
+	inline uint32_t utf8_casefold_hash(const char *in, size_t len)
+	{
+		return ucd_utf8_casefold_hash(in, len);
+	}
+
+	/** @brief Decode UTF-16 data to Unicode codepoints.
+	  *
+	  * @param in   The UTF-16 data to decode.
+	  * @param len  The number of code units in the UTF-16 data.
+	  * @param out  The decoded Unicode codepoints.
+	  * @param n    The number of codepoints the out buffer can hold.
+	  * @param used If not NULL, set to the number of code units decoded.
+	  * @return     The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf16_decode(const uint16_t *in, size_t len, codepoint_t *out, size_t n, size_t *used = NULL)
+	{
+		return ucd_utf16_decode(in, len, out, n, used);
+	}
+
+	/** @brief Lookup the General Category for each codepoint in UTF-16 data.
+	  *
+	  * @param in  The UTF-16 data to lookup.
+	  * @param len The number of code units in the UTF-16 data.
+	  * @param out The General Category (ucd::category) of each codepoint. This must
+	  *            have space for len entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf16_lookup_category(const uint16_t *in, size_t len, uint8_t *out)
+	{
+		return ucd_utf16_lookup_category_n(in, len, out);
+	}
+
+	/** @brief Lookup the Script for each codepoint in UTF-16 data.
+	  *
+	  * @param in  The UTF-16 data to lookup.
+	  * @param len The number of code units in the UTF-16 data.
+	  * @param out The Script (ucd::script) of each codepoint. This must
+	  *            have space for len entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf16_lookup_script(const uint16_t *in, size_t len, uint8_t *out)
+	{
+		return ucd_utf16_lookup_script_n(in, len, out);
+	}
+
+	/** @brief Return the properties for each codepoint in UTF-16 data.
+	  *
+	  * @param in  The UTF-16 data to lookup.
+	  * @param len The number of code units in the UTF-16 data.
+	  * @param out The properties of each codepoint. This must
+	  *            have space for len entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf16_properties(const uint16_t *in, size_t len, property *out)
+	{
+		return ucd_utf16_lookup_properties_n(in, len, out);
+	}
+
+	/** @brief Return the ctype classes for each codepoint in UTF-16 data.
+	  *
+	  * @param in  The UTF-16 data to lookup.
+	  * @param len The number of code units in the UTF-16 data.
+	  * @param out The ctype classes (UCD_CTYPE_*) of each codepoint. This must
+	  *            have space for len entries.
+	  * @return    The number of codepoints written to the out buffer.
+	  */
+	inline size_t utf16_ctype_mask(const uint16_t *in, size_t len, ctype *out)
+	{
+		return ucd_utf16_ctype_mask_n(in, len, out);
 	}
 }
 #endif
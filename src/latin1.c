@@ -0,0 +1,301 @@
+/* Latin-1 Character Data
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the UnicodeData.txt,
+ * PropList.txt and DerivedCoreProperties.txt files in the Unicode Character
+ * database by the ucd-tools/tools/latin1.py script.
+ */
+
+#include "latin1.h"
+
+#define ALNUM  UCD_CTYPE_ALNUM
+#define ALPHA  UCD_CTYPE_ALPHA
+#define BLANK  UCD_CTYPE_BLANK
+#define CNTRL  UCD_CTYPE_CNTRL
+#define DIGIT  UCD_CTYPE_DIGIT
+#define GRAPH  UCD_CTYPE_GRAPH
+#define LOWER  UCD_CTYPE_LOWER
+#define PRINT  UCD_CTYPE_PRINT
+#define PUNCT  UCD_CTYPE_PUNCT
+#define SPACE  UCD_CTYPE_SPACE
+#define UPPER  UCD_CTYPE_UPPER
+#define XDIGIT UCD_CTYPE_XDIGIT
+
+/* Unicode Character Data 12.0.0 */
+
+const latin1_entry ucd_latin1_data[256] =
+{
+	/* 00 */ { CNTRL, 0x0000, 0x0000, 0x0000 },
+	/* 01 */ { CNTRL, 0x0001, 0x0001, 0x0001 },
+	/* 02 */ { CNTRL, 0x0002, 0x0002, 0x0002 },
+	/* 03 */ { CNTRL, 0x0003, 0x0003, 0x0003 },
+	/* 04 */ { CNTRL, 0x0004, 0x0004, 0x0004 },
+	/* 05 */ { CNTRL, 0x0005, 0x0005, 0x0005 },
+	/* 06 */ { CNTRL, 0x0006, 0x0006, 0x0006 },
+	/* 07 */ { CNTRL, 0x0007, 0x0007, 0x0007 },
+	/* 08 */ { CNTRL, 0x0008, 0x0008, 0x0008 },
+	/* 09 */ { BLANK|CNTRL|SPACE, 0x0009, 0x0009, 0x0009 },
+	/* 0A */ { CNTRL|SPACE, 0x000A, 0x000A, 0x000A },
+	/* 0B */ { CNTRL|SPACE, 0x000B, 0x000B, 0x000B },
+	/* 0C */ { CNTRL|SPACE, 0x000C, 0x000C, 0x000C },
+	/* 0D */ { CNTRL|SPACE, 0x000D, 0x000D, 0x000D },
+	/* 0E */ { CNTRL, 0x000E, 0x000E, 0x000E },
+	/* 0F */ { CNTRL, 0x000F, 0x000F, 0x000F },
+	/* 10 */ { CNTRL, 0x0010, 0x0010, 0x0010 },
+	/* 11 */ { CNTRL, 0x0011, 0x0011, 0x0011 },
+	/* 12 */ { CNTRL, 0x0012, 0x0012, 0x0012 },
+	/* 13 */ { CNTRL, 0x0013, 0x0013, 0x0013 },
+	/* 14 */ { CNTRL, 0x0014, 0x0014, 0x0014 },
+	/* 15 */ { CNTRL, 0x0015, 0x0015, 0x0015 },
+	/* 16 */ { CNTRL, 0x0016, 0x0016, 0x0016 },
+	/* 17 */ { CNTRL, 0x0017, 0x0017, 0x0017 },
+	/* 18 */ { CNTRL, 0x0018, 0x0018, 0x0018 },
+	/* 19 */ { CNTRL, 0x0019, 0x0019, 0x0019 },
+	/* 1A */ { CNTRL, 0x001A, 0x001A, 0x001A },
+	/* 1B */ { CNTRL, 0x001B, 0x001B, 0x001B },
+	/* 1C */ { CNTRL, 0x001C, 0x001C, 0x001C },
+	/* 1D */ { CNTRL, 0x001D, 0x001D, 0x001D },
+	/* 1E */ { CNTRL, 0x001E, 0x001E, 0x001E },
+	/* 1F */ { CNTRL, 0x001F, 0x001F, 0x001F },
+	/* 20 */ { BLANK|PRINT|SPACE, 0x0020, 0x0020, 0x0020 },
+	/* 21 */ { GRAPH|PRINT|PUNCT, 0x0021, 0x0021, 0x0021 },
+	/* 22 */ { GRAPH|PRINT|PUNCT, 0x0022, 0x0022, 0x0022 },
+	/* 23 */ { GRAPH|PRINT|PUNCT, 0x0023, 0x0023, 0x0023 },
+	/* 24 */ { GRAPH|PRINT|PUNCT, 0x0024, 0x0024, 0x0024 },
+	/* 25 */ { GRAPH|PRINT|PUNCT, 0x0025, 0x0025, 0x0025 },
+	/* 26 */ { GRAPH|PRINT|PUNCT, 0x0026, 0x0026, 0x0026 },
+	/* 27 */ { GRAPH|PRINT|PUNCT, 0x0027, 0x0027, 0x0027 },
+	/* 28 */ { GRAPH|PRINT|PUNCT, 0x0028, 0x0028, 0x0028 },
+	/* 29 */ { GRAPH|PRINT|PUNCT, 0x0029, 0x0029, 0x0029 },
+	/* 2A */ { GRAPH|PRINT|PUNCT, 0x002A, 0x002A, 0x002A },
+	/* 2B */ { GRAPH|PRINT|PUNCT, 0x002B, 0x002B, 0x002B },
+	/* 2C */ { GRAPH|PRINT|PUNCT, 0x002C, 0x002C, 0x002C },
+	/* 2D */ { GRAPH|PRINT|PUNCT, 0x002D, 0x002D, 0x002D },
+	/* 2E */ { GRAPH|PRINT|PUNCT, 0x002E, 0x002E, 0x002E },
+	/* 2F */ { GRAPH|PRINT|PUNCT, 0x002F, 0x002F, 0x002F },
+	/* 30 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0030, 0x0030, 0x0030 },
+	/* 31 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0031, 0x0031, 0x0031 },
+	/* 32 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0032, 0x0032, 0x0032 },
+	/* 33 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0033, 0x0033, 0x0033 },
+	/* 34 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0034, 0x0034, 0x0034 },
+	/* 35 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0035, 0x0035, 0x0035 },
+	/* 36 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0036, 0x0036, 0x0036 },
+	/* 37 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0037, 0x0037, 0x0037 },
+	/* 38 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0038, 0x0038, 0x0038 },
+	/* 39 */ { ALNUM|DIGIT|GRAPH|PRINT|XDIGIT, 0x0039, 0x0039, 0x0039 },
+	/* 3A */ { GRAPH|PRINT|PUNCT, 0x003A, 0x003A, 0x003A },
+	/* 3B */ { GRAPH|PRINT|PUNCT, 0x003B, 0x003B, 0x003B },
+	/* 3C */ { GRAPH|PRINT|PUNCT, 0x003C, 0x003C, 0x003C },
+	/* 3D */ { GRAPH|PRINT|PUNCT, 0x003D, 0x003D, 0x003D },
+	/* 3E */ { GRAPH|PRINT|PUNCT, 0x003E, 0x003E, 0x003E },
+	/* 3F */ { GRAPH|PRINT|PUNCT, 0x003F, 0x003F, 0x003F },
+	/* 40 */ { GRAPH|PRINT|PUNCT, 0x0040, 0x0040, 0x0040 },
+	/* 41 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER|XDIGIT, 0x0041, 0x0061, 0x0041 },
+	/* 42 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER|XDIGIT, 0x0042, 0x0062, 0x0042 },
+	/* 43 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER|XDIGIT, 0x0043, 0x0063, 0x0043 },
+	/* 44 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER|XDIGIT, 0x0044, 0x0064, 0x0044 },
+	/* 45 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER|XDIGIT, 0x0045, 0x0065, 0x0045 },
+	/* 46 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER|XDIGIT, 0x0046, 0x0066, 0x0046 },
+	/* 47 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0047, 0x0067, 0x0047 },
+	/* 48 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0048, 0x0068, 0x0048 },
+	/* 49 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0049, 0x0069, 0x0049 },
+	/* 4A */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x004A, 0x006A, 0x004A },
+	/* 4B */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x004B, 0x006B, 0x004B },
+	/* 4C */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x004C, 0x006C, 0x004C },
+	/* 4D */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x004D, 0x006D, 0x004D },
+	/* 4E */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x004E, 0x006E, 0x004E },
+	/* 4F */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x004F, 0x006F, 0x004F },
+	/* 50 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0050, 0x0070, 0x0050 },
+	/* 51 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0051, 0x0071, 0x0051 },
+	/* 52 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0052, 0x0072, 0x0052 },
+	/* 53 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0053, 0x0073, 0x0053 },
+	/* 54 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0054, 0x0074, 0x0054 },
+	/* 55 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0055, 0x0075, 0x0055 },
+	/* 56 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0056, 0x0076, 0x0056 },
+	/* 57 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0057, 0x0077, 0x0057 },
+	/* 58 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0058, 0x0078, 0x0058 },
+	/* 59 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x0059, 0x0079, 0x0059 },
+	/* 5A */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x005A, 0x007A, 0x005A },
+	/* 5B */ { GRAPH|PRINT|PUNCT, 0x005B, 0x005B, 0x005B },
+	/* 5C */ { GRAPH|PRINT|PUNCT, 0x005C, 0x005C, 0x005C },
+	/* 5D */ { GRAPH|PRINT|PUNCT, 0x005D, 0x005D, 0x005D },
+	/* 5E */ { GRAPH|PRINT|PUNCT, 0x005E, 0x005E, 0x005E },
+	/* 5F */ { GRAPH|PRINT|PUNCT, 0x005F, 0x005F, 0x005F },
+	/* 60 */ { GRAPH|PRINT|PUNCT, 0x0060, 0x0060, 0x0060 },
+	/* 61 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT|XDIGIT, 0x0041, 0x0061, 0x0041 },
+	/* 62 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT|XDIGIT, 0x0042, 0x0062, 0x0042 },
+	/* 63 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT|XDIGIT, 0x0043, 0x0063, 0x0043 },
+	/* 64 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT|XDIGIT, 0x0044, 0x0064, 0x0044 },
+	/* 65 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT|XDIGIT, 0x0045, 0x0065, 0x0045 },
+	/* 66 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT|XDIGIT, 0x0046, 0x0066, 0x0046 },
+	/* 67 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0047, 0x0067, 0x0047 },
+	/* 68 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0048, 0x0068, 0x0048 },
+	/* 69 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0049, 0x0069, 0x0049 },
+	/* 6A */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x004A, 0x006A, 0x004A },
+	/* 6B */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x004B, 0x006B, 0x004B },
+	/* 6C */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x004C, 0x006C, 0x004C },
+	/* 6D */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x004D, 0x006D, 0x004D },
+	/* 6E */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x004E, 0x006E, 0x004E },
+	/* 6F */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x004F, 0x006F, 0x004F },
+	/* 70 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0050, 0x0070, 0x0050 },
+	/* 71 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0051, 0x0071, 0x0051 },
+	/* 72 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0052, 0x0072, 0x0052 },
+	/* 73 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0053, 0x0073, 0x0053 },
+	/* 74 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0054, 0x0074, 0x0054 },
+	/* 75 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0055, 0x0075, 0x0055 },
+	/* 76 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0056, 0x0076, 0x0056 },
+	/* 77 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0057, 0x0077, 0x0057 },
+	/* 78 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0058, 0x0078, 0x0058 },
+	/* 79 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0059, 0x0079, 0x0059 },
+	/* 7A */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x005A, 0x007A, 0x005A },
+	/* 7B */ { GRAPH|PRINT|PUNCT, 0x007B, 0x007B, 0x007B },
+	/* 7C */ { GRAPH|PRINT|PUNCT, 0x007C, 0x007C, 0x007C },
+	/* 7D */ { GRAPH|PRINT|PUNCT, 0x007D, 0x007D, 0x007D },
+	/* 7E */ { GRAPH|PRINT|PUNCT, 0x007E, 0x007E, 0x007E },
+	/* 7F */ { CNTRL, 0x007F, 0x007F, 0x007F },
+	/* 80 */ { CNTRL, 0x0080, 0x0080, 0x0080 },
+	/* 81 */ { CNTRL, 0x0081, 0x0081, 0x0081 },
+	/* 82 */ { CNTRL, 0x0082, 0x0082, 0x0082 },
+	/* 83 */ { CNTRL, 0x0083, 0x0083, 0x0083 },
+	/* 84 */ { CNTRL, 0x0084, 0x0084, 0x0084 },
+	/* 85 */ { CNTRL|SPACE, 0x0085, 0x0085, 0x0085 },
+	/* 86 */ { CNTRL, 0x0086, 0x0086, 0x0086 },
+	/* 87 */ { CNTRL, 0x0087, 0x0087, 0x0087 },
+	/* 88 */ { CNTRL, 0x0088, 0x0088, 0x0088 },
+	/* 89 */ { CNTRL, 0x0089, 0x0089, 0x0089 },
+	/* 8A */ { CNTRL, 0x008A, 0x008A, 0x008A },
+	/* 8B */ { CNTRL, 0x008B, 0x008B, 0x008B },
+	/* 8C */ { CNTRL, 0x008C, 0x008C, 0x008C },
+	/* 8D */ { CNTRL, 0x008D, 0x008D, 0x008D },
+	/* 8E */ { CNTRL, 0x008E, 0x008E, 0x008E },
+	/* 8F */ { CNTRL, 0x008F, 0x008F, 0x008F },
+	/* 90 */ { CNTRL, 0x0090, 0x0090, 0x0090 },
+	/* 91 */ { CNTRL, 0x0091, 0x0091, 0x0091 },
+	/* 92 */ { CNTRL, 0x0092, 0x0092, 0x0092 },
+	/* 93 */ { CNTRL, 0x0093, 0x0093, 0x0093 },
+	/* 94 */ { CNTRL, 0x0094, 0x0094, 0x0094 },
+	/* 95 */ { CNTRL, 0x0095, 0x0095, 0x0095 },
+	/* 96 */ { CNTRL, 0x0096, 0x0096, 0x0096 },
+	/* 97 */ { CNTRL, 0x0097, 0x0097, 0x0097 },
+	/* 98 */ { CNTRL, 0x0098, 0x0098, 0x0098 },
+	/* 99 */ { CNTRL, 0x0099, 0x0099, 0x0099 },
+	/* 9A */ { CNTRL, 0x009A, 0x009A, 0x009A },
+	/* 9B */ { CNTRL, 0x009B, 0x009B, 0x009B },
+	/* 9C */ { CNTRL, 0x009C, 0x009C, 0x009C },
+	/* 9D */ { CNTRL, 0x009D, 0x009D, 0x009D },
+	/* 9E */ { CNTRL, 0x009E, 0x009E, 0x009E },
+	/* 9F */ { CNTRL, 0x009F, 0x009F, 0x009F },
+	/* A0 */ { PRINT, 0x00A0, 0x00A0, 0x00A0 },
+	/* A1 */ { GRAPH|PRINT|PUNCT, 0x00A1, 0x00A1, 0x00A1 },
+	/* A2 */ { GRAPH|PRINT|PUNCT, 0x00A2, 0x00A2, 0x00A2 },
+	/* A3 */ { GRAPH|PRINT|PUNCT, 0x00A3, 0x00A3, 0x00A3 },
+	/* A4 */ { GRAPH|PRINT|PUNCT, 0x00A4, 0x00A4, 0x00A4 },
+	/* A5 */ { GRAPH|PRINT|PUNCT, 0x00A5, 0x00A5, 0x00A5 },
+	/* A6 */ { GRAPH|PRINT|PUNCT, 0x00A6, 0x00A6, 0x00A6 },
+	/* A7 */ { GRAPH|PRINT|PUNCT, 0x00A7, 0x00A7, 0x00A7 },
+	/* A8 */ { GRAPH|PRINT|PUNCT, 0x00A8, 0x00A8, 0x00A8 },
+	/* A9 */ { GRAPH|PRINT|PUNCT, 0x00A9, 0x00A9, 0x00A9 },
+	/* AA */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00AA, 0x00AA, 0x00AA },
+	/* AB */ { GRAPH|PRINT|PUNCT, 0x00AB, 0x00AB, 0x00AB },
+	/* AC */ { GRAPH|PRINT|PUNCT, 0x00AC, 0x00AC, 0x00AC },
+	/* AD */ { 0, 0x00AD, 0x00AD, 0x00AD },
+	/* AE */ { GRAPH|PRINT|PUNCT, 0x00AE, 0x00AE, 0x00AE },
+	/* AF */ { GRAPH|PRINT|PUNCT, 0x00AF, 0x00AF, 0x00AF },
+	/* B0 */ { GRAPH|PRINT|PUNCT, 0x00B0, 0x00B0, 0x00B0 },
+	/* B1 */ { GRAPH|PRINT|PUNCT, 0x00B1, 0x00B1, 0x00B1 },
+	/* B2 */ { ALNUM|GRAPH|PRINT, 0x00B2, 0x00B2, 0x00B2 },
+	/* B3 */ { ALNUM|GRAPH|PRINT, 0x00B3, 0x00B3, 0x00B3 },
+	/* B4 */ { GRAPH|PRINT|PUNCT, 0x00B4, 0x00B4, 0x00B4 },
+	/* B5 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x039C, 0x00B5, 0x039C },
+	/* B6 */ { GRAPH|PRINT|PUNCT, 0x00B6, 0x00B6, 0x00B6 },
+	/* B7 */ { GRAPH|PRINT|PUNCT, 0x00B7, 0x00B7, 0x00B7 },
+	/* B8 */ { GRAPH|PRINT|PUNCT, 0x00B8, 0x00B8, 0x00B8 },
+	/* B9 */ { ALNUM|GRAPH|PRINT, 0x00B9, 0x00B9, 0x00B9 },
+	/* BA */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00BA, 0x00BA, 0x00BA },
+	/* BB */ { GRAPH|PRINT|PUNCT, 0x00BB, 0x00BB, 0x00BB },
+	/* BC */ { ALNUM|GRAPH|PRINT, 0x00BC, 0x00BC, 0x00BC },
+	/* BD */ { ALNUM|GRAPH|PRINT, 0x00BD, 0x00BD, 0x00BD },
+	/* BE */ { ALNUM|GRAPH|PRINT, 0x00BE, 0x00BE, 0x00BE },
+	/* BF */ { GRAPH|PRINT|PUNCT, 0x00BF, 0x00BF, 0x00BF },
+	/* C0 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C0, 0x00E0, 0x00C0 },
+	/* C1 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C1, 0x00E1, 0x00C1 },
+	/* C2 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C2, 0x00E2, 0x00C2 },
+	/* C3 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C3, 0x00E3, 0x00C3 },
+	/* C4 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C4, 0x00E4, 0x00C4 },
+	/* C5 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C5, 0x00E5, 0x00C5 },
+	/* C6 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C6, 0x00E6, 0x00C6 },
+	/* C7 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C7, 0x00E7, 0x00C7 },
+	/* C8 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C8, 0x00E8, 0x00C8 },
+	/* C9 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00C9, 0x00E9, 0x00C9 },
+	/* CA */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00CA, 0x00EA, 0x00CA },
+	/* CB */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00CB, 0x00EB, 0x00CB },
+	/* CC */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00CC, 0x00EC, 0x00CC },
+	/* CD */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00CD, 0x00ED, 0x00CD },
+	/* CE */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00CE, 0x00EE, 0x00CE },
+	/* CF */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00CF, 0x00EF, 0x00CF },
+	/* D0 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00D0, 0x00F0, 0x00D0 },
+	/* D1 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00D1, 0x00F1, 0x00D1 },
+	/* D2 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00D2, 0x00F2, 0x00D2 },
+	/* D3 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00D3, 0x00F3, 0x00D3 },
+	/* D4 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00D4, 0x00F4, 0x00D4 },
+	/* D5 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00D5, 0x00F5, 0x00D5 },
+	/* D6 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00D6, 0x00F6, 0x00D6 },
+	/* D7 */ { GRAPH|PRINT|PUNCT, 0x00D7, 0x00D7, 0x00D7 },
+	/* D8 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00D8, 0x00F8, 0x00D8 },
+	/* D9 */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00D9, 0x00F9, 0x00D9 },
+	/* DA */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00DA, 0x00FA, 0x00DA },
+	/* DB */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00DB, 0x00FB, 0x00DB },
+	/* DC */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00DC, 0x00FC, 0x00DC },
+	/* DD */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00DD, 0x00FD, 0x00DD },
+	/* DE */ { ALNUM|ALPHA|GRAPH|PRINT|UPPER, 0x00DE, 0x00FE, 0x00DE },
+	/* DF */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00DF, 0x00DF, 0x00DF },
+	/* E0 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C0, 0x00E0, 0x00C0 },
+	/* E1 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C1, 0x00E1, 0x00C1 },
+	/* E2 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C2, 0x00E2, 0x00C2 },
+	/* E3 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C3, 0x00E3, 0x00C3 },
+	/* E4 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C4, 0x00E4, 0x00C4 },
+	/* E5 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C5, 0x00E5, 0x00C5 },
+	/* E6 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C6, 0x00E6, 0x00C6 },
+	/* E7 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C7, 0x00E7, 0x00C7 },
+	/* E8 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C8, 0x00E8, 0x00C8 },
+	/* E9 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00C9, 0x00E9, 0x00C9 },
+	/* EA */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00CA, 0x00EA, 0x00CA },
+	/* EB */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00CB, 0x00EB, 0x00CB },
+	/* EC */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00CC, 0x00EC, 0x00CC },
+	/* ED */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00CD, 0x00ED, 0x00CD },
+	/* EE */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00CE, 0x00EE, 0x00CE },
+	/* EF */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00CF, 0x00EF, 0x00CF },
+	/* F0 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00D0, 0x00F0, 0x00D0 },
+	/* F1 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00D1, 0x00F1, 0x00D1 },
+	/* F2 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00D2, 0x00F2, 0x00D2 },
+	/* F3 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00D3, 0x00F3, 0x00D3 },
+	/* F4 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00D4, 0x00F4, 0x00D4 },
+	/* F5 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00D5, 0x00F5, 0x00D5 },
+	/* F6 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00D6, 0x00F6, 0x00D6 },
+	/* F7 */ { GRAPH|PRINT|PUNCT, 0x00F7, 0x00F7, 0x00F7 },
+	/* F8 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00D8, 0x00F8, 0x00D8 },
+	/* F9 */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00D9, 0x00F9, 0x00D9 },
+	/* FA */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00DA, 0x00FA, 0x00DA },
+	/* FB */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00DB, 0x00FB, 0x00DB },
+	/* FC */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00DC, 0x00FC, 0x00DC },
+	/* FD */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00DD, 0x00FD, 0x00DD },
+	/* FE */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x00DE, 0x00FE, 0x00DE },
+	/* FF */ { ALNUM|ALPHA|GRAPH|LOWER|PRINT, 0x0178, 0x00FF, 0x0178 },
+};
@@ -0,0 +1,46 @@
+/* Latin-1 Character Data
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UNICODE_CHARACTER_DATA_LATIN1_H
+#define UNICODE_CHARACTER_DATA_LATIN1_H
+
+#include "ucd/ucd.h"
+
+/* The data for a codepoint in the U+0000..U+00FF range. This is used to avoid
+ * the general category, property and case conversion lookups for the most
+ * common codepoints.
+ */
+typedef struct latin1_entry_
+{
+	ucd_ctype ctype;
+	uint16_t upper;
+	uint16_t lower;
+	uint16_t title;
+} latin1_entry;
+
+/* This is internal to the library, so it is not exported from the shared
+ * library on platforms that support symbol visibility.
+ */
+#if defined(__GNUC__) && !defined(_WIN32)
+__attribute__((visibility("hidden")))
+#endif
+extern const latin1_entry ucd_latin1_data[256];
+
+#endif
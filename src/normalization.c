@@ -0,0 +1,8275 @@
+/* Unicode Normalization Data
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the UnicodeData.txt and
+ * DerivedNormalizationProps.txt files in the Unicode Character database by
+ * the ucd-tools/tools/normalization.py script.
+ */
+
+#include "ucd/ucd.h"
+#include "normalization.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data 12.0.0 */
+
+/* The full decompositions, referenced by the offset and length in the
+ * normalization records.
+ */
+static const codepoint_t decompositions[] =
+{
+	/*     0 */ 0x000000, 0x000020, 0x000020, 0x000308, 0x000061, 0x000020, 0x000304, 0x000032,
+	/*     8 */ 0x000033, 0x000020, 0x000301, 0x0003BC, 0x000020, 0x000327, 0x000031, 0x00006F,
+	/*    16 */ 0x000031, 0x002044, 0x000034, 0x000031, 0x002044, 0x000032, 0x000033, 0x002044,
+	/*    24 */ 0x000034, 0x000041, 0x000300, 0x000041, 0x000301, 0x000041, 0x000302, 0x000041,
+	/*    32 */ 0x000303, 0x000041, 0x000308, 0x000041, 0x00030A, 0x000043, 0x000327, 0x000045,
+	/*    40 */ 0x000300, 0x000045, 0x000301, 0x000045, 0x000302, 0x000045, 0x000308, 0x000049,
+	/*    48 */ 0x000300, 0x000049, 0x000301, 0x000049, 0x000302, 0x000049, 0x000308, 0x00004E,
+	/*    56 */ 0x000303, 0x00004F, 0x000300, 0x00004F, 0x000301, 0x00004F, 0x000302, 0x00004F,
+	/*    64 */ 0x000303, 0x00004F, 0x000308, 0x000055, 0x000300, 0x000055, 0x000301, 0x000055,
+	/*    72 */ 0x000302, 0x000055, 0x000308, 0x000059, 0x000301, 0x000061, 0x000300, 0x000061,
+	/*    80 */ 0x000301, 0x000061, 0x000302, 0x000061, 0x000303, 0x000061, 0x000308, 0x000061,
+	/*    88 */ 0x00030A, 0x000063, 0x000327, 0x000065, 0x000300, 0x000065, 0x000301, 0x000065,
+	/*    96 */ 0x000302, 0x000065, 0x000308, 0x000069, 0x000300, 0x000069, 0x000301, 0x000069,
+	/*   104 */ 0x000302, 0x000069, 0x000308, 0x00006E, 0x000303, 0x00006F, 0x000300, 0x00006F,
+	/*   112 */ 0x000301, 0x00006F, 0x000302, 0x00006F, 0x000303, 0x00006F, 0x000308, 0x000075,
+	/*   120 */ 0x000300, 0x000075, 0x000301, 0x000075, 0x000302, 0x000075, 0x000308, 0x000079,
+	/*   128 */ 0x000301, 0x000079, 0x000308, 0x000041, 0x000304, 0x000061, 0x000304, 0x000041,
+	/*   136 */ 0x000306, 0x000061, 0x000306, 0x000041, 0x000328, 0x000061, 0x000328, 0x000043,
+	/*   144 */ 0x000301, 0x000063, 0x000301, 0x000043, 0x000302, 0x000063, 0x000302, 0x000043,
+	/*   152 */ 0x000307, 0x000063, 0x000307, 0x000043, 0x00030C, 0x000063, 0x00030C, 0x000044,
+	/*   160 */ 0x00030C, 0x000064, 0x00030C, 0x000045, 0x000304, 0x000065, 0x000304, 0x000045,
+	/*   168 */ 0x000306, 0x000065, 0x000306, 0x000045, 0x000307, 0x000065, 0x000307, 0x000045,
+	/*   176 */ 0x000328, 0x000065, 0x000328, 0x000045, 0x00030C, 0x000065, 0x00030C, 0x000047,
+	/*   184 */ 0x000302, 0x000067, 0x000302, 0x000047, 0x000306, 0x000067, 0x000306, 0x000047,
+	/*   192 */ 0x000307, 0x000067, 0x000307, 0x000047, 0x000327, 0x000067, 0x000327, 0x000048,
+	/*   200 */ 0x000302, 0x000068, 0x000302, 0x000049, 0x000303, 0x000069, 0x000303, 0x000049,
+	/*   208 */ 0x000304, 0x000069, 0x000304, 0x000049, 0x000306, 0x000069, 0x000306, 0x000049,
+	/*   216 */ 0x000328, 0x000069, 0x000328, 0x000049, 0x000307, 0x000049, 0x00004A, 0x000069,
+	/*   224 */ 0x00006A, 0x00004A, 0x000302, 0x00006A, 0x000302, 0x00004B, 0x000327, 0x00006B,
+	/*   232 */ 0x000327, 0x00004C, 0x000301, 0x00006C, 0x000301, 0x00004C, 0x000327, 0x00006C,
+	/*   240 */ 0x000327, 0x00004C, 0x00030C, 0x00006C, 0x00030C, 0x00004C, 0x0000B7, 0x00006C,
+	/*   248 */ 0x0000B7, 0x00004E, 0x000301, 0x00006E, 0x000301, 0x00004E, 0x000327, 0x00006E,
+	/*   256 */ 0x000327, 0x00004E, 0x00030C, 0x00006E, 0x00030C, 0x0002BC, 0x00006E, 0x00004F,
+	/*   264 */ 0x000304, 0x00006F, 0x000304, 0x00004F, 0x000306, 0x00006F, 0x000306, 0x00004F,
+	/*   272 */ 0x00030B, 0x00006F, 0x00030B, 0x000052, 0x000301, 0x000072, 0x000301, 0x000052,
+	/*   280 */ 0x000327, 0x000072, 0x000327, 0x000052, 0x00030C, 0x000072, 0x00030C, 0x000053,
+	/*   288 */ 0x000301, 0x000073, 0x000301, 0x000053, 0x000302, 0x000073, 0x000302, 0x000053,
+	/*   296 */ 0x000327, 0x000073, 0x000327, 0x000053, 0x00030C, 0x000073, 0x00030C, 0x000054,
+	/*   304 */ 0x000327, 0x000074, 0x000327, 0x000054, 0x00030C, 0x000074, 0x00030C, 0x000055,
+	/*   312 */ 0x000303, 0x000075, 0x000303, 0x000055, 0x000304, 0x000075, 0x000304, 0x000055,
+	/*   320 */ 0x000306, 0x000075, 0x000306, 0x000055, 0x00030A, 0x000075, 0x00030A, 0x000055,
+	/*   328 */ 0x00030B, 0x000075, 0x00030B, 0x000055, 0x000328, 0x000075, 0x000328, 0x000057,
+	/*   336 */ 0x000302, 0x000077, 0x000302, 0x000059, 0x000302, 0x000079, 0x000302, 0x000059,
+	/*   344 */ 0x000308, 0x00005A, 0x000301, 0x00007A, 0x000301, 0x00005A, 0x000307, 0x00007A,
+	/*   352 */ 0x000307, 0x00005A, 0x00030C, 0x00007A, 0x00030C, 0x000073, 0x00004F, 0x00031B,
+	/*   360 */ 0x00006F, 0x00031B, 0x000055, 0x00031B, 0x000075, 0x00031B, 0x000044, 0x00005A,
+	/*   368 */ 0x00030C, 0x000044, 0x00007A, 0x00030C, 0x000064, 0x00007A, 0x00030C, 0x00004C,
+	/*   376 */ 0x00004A, 0x00004C, 0x00006A, 0x00006C, 0x00006A, 0x00004E, 0x00004A, 0x00004E,
+	/*   384 */ 0x00006A, 0x00006E, 0x00006A, 0x000041, 0x00030C, 0x000061, 0x00030C, 0x000049,
+	/*   392 */ 0x00030C, 0x000069, 0x00030C, 0x00004F, 0x00030C, 0x00006F, 0x00030C, 0x000055,
+	/*   400 */ 0x00030C, 0x000075, 0x00030C, 0x000055, 0x000308, 0x000304, 0x000075, 0x000308,
+	/*   408 */ 0x000304, 0x000055, 0x000308, 0x000301, 0x000075, 0x000308, 0x000301, 0x000055,
+	/*   416 */ 0x000308, 0x00030C, 0x000075, 0x000308, 0x00030C, 0x000055, 0x000308, 0x000300,
+	/*   424 */ 0x000075, 0x000308, 0x000300, 0x000041, 0x000308, 0x000304, 0x000061, 0x000308,
+	/*   432 */ 0x000304, 0x000041, 0x000307, 0x000304, 0x000061, 0x000307, 0x000304, 0x0000C6,
+	/*   440 */ 0x000304, 0x0000E6, 0x000304, 0x000047, 0x00030C, 0x000067, 0x00030C, 0x00004B,
+	/*   448 */ 0x00030C, 0x00006B, 0x00030C, 0x00004F, 0x000328, 0x00006F, 0x000328, 0x00004F,
+	/*   456 */ 0x000328, 0x000304, 0x00006F, 0x000328, 0x000304, 0x0001B7, 0x00030C, 0x000292,
+	/*   464 */ 0x00030C, 0x00006A, 0x00030C, 0x000044, 0x00005A, 0x000044, 0x00007A, 0x000064,
+	/*   472 */ 0x00007A, 0x000047, 0x000301, 0x000067, 0x000301, 0x00004E, 0x000300, 0x00006E,
+	/*   480 */ 0x000300, 0x000041, 0x00030A, 0x000301, 0x000061, 0x00030A, 0x000301, 0x0000C6,
+	/*   488 */ 0x000301, 0x0000E6, 0x000301, 0x0000D8, 0x000301, 0x0000F8, 0x000301, 0x000041,
+	/*   496 */ 0x00030F, 0x000061, 0x00030F, 0x000041, 0x000311, 0x000061, 0x000311, 0x000045,
+	/*   504 */ 0x00030F, 0x000065, 0x00030F, 0x000045, 0x000311, 0x000065, 0x000311, 0x000049,
+	/*   512 */ 0x00030F, 0x000069, 0x00030F, 0x000049, 0x000311, 0x000069, 0x000311, 0x00004F,
+	/*   520 */ 0x00030F, 0x00006F, 0x00030F, 0x00004F, 0x000311, 0x00006F, 0x000311, 0x000052,
+	/*   528 */ 0x00030F, 0x000072, 0x00030F, 0x000052, 0x000311, 0x000072, 0x000311, 0x000055,
+	/*   536 */ 0x00030F, 0x000075, 0x00030F, 0x000055, 0x000311, 0x000075, 0x000311, 0x000053,
+	/*   544 */ 0x000326, 0x000073, 0x000326, 0x000054, 0x000326, 0x000074, 0x000326, 0x000048,
+	/*   552 */ 0x00030C, 0x000068, 0x00030C, 0x000041, 0x000307, 0x000061, 0x000307, 0x000045,
+	/*   560 */ 0x000327, 0x000065, 0x000327, 0x00004F, 0x000308, 0x000304, 0x00006F, 0x000308,
+	/*   568 */ 0x000304, 0x00004F, 0x000303, 0x000304, 0x00006F, 0x000303, 0x000304, 0x00004F,
+	/*   576 */ 0x000307, 0x00006F, 0x000307, 0x00004F, 0x000307, 0x000304, 0x00006F, 0x000307,
+	/*   584 */ 0x000304, 0x000059, 0x000304, 0x000079, 0x000304, 0x000068, 0x000266, 0x00006A,
+	/*   592 */ 0x000072, 0x000279, 0x00027B, 0x000281, 0x000077, 0x000079, 0x000020, 0x000306,
+	/*   600 */ 0x000020, 0x000307, 0x000020, 0x00030A, 0x000020, 0x000328, 0x000020, 0x000303,
+	/*   608 */ 0x000020, 0x00030B, 0x000263, 0x00006C, 0x000078, 0x000295, 0x000300, 0x000301,
+	/*   616 */ 0x000313, 0x000308, 0x000301, 0x0002B9, 0x000020, 0x000345, 0x00003B, 0x0000A8,
+	/*   624 */ 0x000301, 0x000020, 0x000308, 0x000301, 0x000391, 0x000301, 0x0000B7, 0x000395,
+	/*   632 */ 0x000301, 0x000397, 0x000301, 0x000399, 0x000301, 0x00039F, 0x000301, 0x0003A5,
+	/*   640 */ 0x000301, 0x0003A9, 0x000301, 0x0003B9, 0x000308, 0x000301, 0x000399, 0x000308,
+	/*   648 */ 0x0003A5, 0x000308, 0x0003B1, 0x000301, 0x0003B5, 0x000301, 0x0003B7, 0x000301,
+	/*   656 */ 0x0003B9, 0x000301, 0x0003C5, 0x000308, 0x000301, 0x0003B9, 0x000308, 0x0003C5,
+	/*   664 */ 0x000308, 0x0003BF, 0x000301, 0x0003C5, 0x000301, 0x0003C9, 0x000301, 0x0003B2,
+	/*   672 */ 0x0003B8, 0x0003A5, 0x0003D2, 0x000301, 0x0003D2, 0x000308, 0x0003C6, 0x0003C0,
+	/*   680 */ 0x0003BA, 0x0003C1, 0x0003C2, 0x000398, 0x0003B5, 0x0003A3, 0x000415, 0x000300,
+	/*   688 */ 0x000415, 0x000308, 0x000413, 0x000301, 0x000406, 0x000308, 0x00041A, 0x000301,
+	/*   696 */ 0x000418, 0x000300, 0x000423, 0x000306, 0x000418, 0x000306, 0x000438, 0x000306,
+	/*   704 */ 0x000435, 0x000300, 0x000435, 0x000308, 0x000433, 0x000301, 0x000456, 0x000308,
+	/*   712 */ 0x00043A, 0x000301, 0x000438, 0x000300, 0x000443, 0x000306, 0x000474, 0x00030F,
+	/*   720 */ 0x000475, 0x00030F, 0x000416, 0x000306, 0x000436, 0x000306, 0x000410, 0x000306,
+	/*   728 */ 0x000430, 0x000306, 0x000410, 0x000308, 0x000430, 0x000308, 0x000415, 0x000306,
+	/*   736 */ 0x000435, 0x000306, 0x0004D8, 0x000308, 0x0004D9, 0x000308, 0x000416, 0x000308,
+	/*   744 */ 0x000436, 0x000308, 0x000417, 0x000308, 0x000437, 0x000308, 0x000418, 0x000304,
+	/*   752 */ 0x000438, 0x000304, 0x000418, 0x000308, 0x000438, 0x000308, 0x00041E, 0x000308,
+	/*   760 */ 0x00043E, 0x000308, 0x0004E8, 0x000308, 0x0004E9, 0x000308, 0x00042D, 0x000308,
+	/*   768 */ 0x00044D, 0x000308, 0x000423, 0x000304, 0x000443, 0x000304, 0x000423, 0x000308,
+	/*   776 */ 0x000443, 0x000308, 0x000423, 0x00030B, 0x000443, 0x00030B, 0x000427, 0x000308,
+	/*   784 */ 0x000447, 0x000308, 0x00042B, 0x000308, 0x00044B, 0x000308, 0x000565, 0x000582,
+	/*   792 */ 0x000627, 0x000653, 0x000627, 0x000654, 0x000648, 0x000654, 0x000627, 0x000655,
+	/*   800 */ 0x00064A, 0x000654, 0x000627, 0x000674, 0x000648, 0x000674, 0x0006C7, 0x000674,
+	/*   808 */ 0x00064A, 0x000674, 0x0006D5, 0x000654, 0x0006C1, 0x000654, 0x0006D2, 0x000654,
+	/*   816 */ 0x000928, 0x00093C, 0x000930, 0x00093C, 0x000933, 0x00093C, 0x000915, 0x00093C,
+	/*   824 */ 0x000916, 0x00093C, 0x000917, 0x00093C, 0x00091C, 0x00093C, 0x000921, 0x00093C,
+	/*   832 */ 0x000922, 0x00093C, 0x00092B, 0x00093C, 0x00092F, 0x00093C, 0x0009C7, 0x0009BE,
+	/*   840 */ 0x0009C7, 0x0009D7, 0x0009A1, 0x0009BC, 0x0009A2, 0x0009BC, 0x0009AF, 0x0009BC,
+	/*   848 */ 0x000A32, 0x000A3C, 0x000A38, 0x000A3C, 0x000A16, 0x000A3C, 0x000A17, 0x000A3C,
+	/*   856 */ 0x000A1C, 0x000A3C, 0x000A2B, 0x000A3C, 0x000B47, 0x000B56, 0x000B47, 0x000B3E,
+	/*   864 */ 0x000B47, 0x000B57, 0x000B21, 0x000B3C, 0x000B22, 0x000B3C, 0x000B92, 0x000BD7,
+	/*   872 */ 0x000BC6, 0x000BBE, 0x000BC7, 0x000BBE, 0x000BC6, 0x000BD7, 0x000C46, 0x000C56,
+	/*   880 */ 0x000CBF, 0x000CD5, 0x000CC6, 0x000CD5, 0x000CC6, 0x000CD6, 0x000CC6, 0x000CC2,
+	/*   888 */ 0x000CC6, 0x000CC2, 0x000CD5, 0x000D46, 0x000D3E, 0x000D47, 0x000D3E, 0x000D46,
+	/*   896 */ 0x000D57, 0x000DD9, 0x000DCA, 0x000DD9, 0x000DCF, 0x000DD9, 0x000DCF, 0x000DCA,
+	/*   904 */ 0x000DD9, 0x000DDF, 0x000E4D, 0x000E32, 0x000ECD, 0x000EB2, 0x000EAB, 0x000E99,
+	/*   912 */ 0x000EAB, 0x000EA1, 0x000F0B, 0x000F42, 0x000FB7, 0x000F4C, 0x000FB7, 0x000F51,
+	/*   920 */ 0x000FB7, 0x000F56, 0x000FB7, 0x000F5B, 0x000FB7, 0x000F40, 0x000FB5, 0x000F71,
+	/*   928 */ 0x000F72, 0x000F71, 0x000F74, 0x000FB2, 0x000F80, 0x000FB2, 0x000F71, 0x000F80,
+	/*   936 */ 0x000FB3, 0x000F80, 0x000FB3, 0x000F71, 0x000F80, 0x000F71, 0x000F80, 0x000F92,
+	/*   944 */ 0x000FB7, 0x000F9C, 0x000FB7, 0x000FA1, 0x000FB7, 0x000FA6, 0x000FB7, 0x000FAB,
+	/*   952 */ 0x000FB7, 0x000F90, 0x000FB5, 0x001025, 0x00102E, 0x0010DC, 0x001B05, 0x001B35,
+	/*   960 */ 0x001B07, 0x001B35, 0x001B09, 0x001B35, 0x001B0B, 0x001B35, 0x001B0D, 0x001B35,
+	/*   968 */ 0x001B11, 0x001B35, 0x001B3A, 0x001B35, 0x001B3C, 0x001B35, 0x001B3E, 0x001B35,
+	/*   976 */ 0x001B3F, 0x001B35, 0x001B42, 0x001B35, 0x000041, 0x0000C6, 0x000042, 0x000044,
+	/*   984 */ 0x000045, 0x00018E, 0x000047, 0x000048, 0x000049, 0x00004A, 0x00004B, 0x00004C,
+	/*   992 */ 0x00004D, 0x00004E, 0x00004F, 0x000222, 0x000050, 0x000052, 0x000054, 0x000055,
+	/*  1000 */ 0x000057, 0x000250, 0x000251, 0x001D02, 0x000062, 0x000064, 0x000065, 0x000259,
+	/*  1008 */ 0x00025B, 0x00025C, 0x000067, 0x00006B, 0x00006D, 0x00014B, 0x000254, 0x001D16,
+	/*  1016 */ 0x001D17, 0x000070, 0x000074, 0x000075, 0x001D1D, 0x00026F, 0x000076, 0x001D25,
+	/*  1024 */ 0x0003B3, 0x0003B4, 0x0003C7, 0x000069, 0x00043D, 0x000252, 0x000063, 0x000255,
+	/*  1032 */ 0x0000F0, 0x000066, 0x00025F, 0x000261, 0x000265, 0x000268, 0x000269, 0x00026A,
+	/*  1040 */ 0x001D7B, 0x00029D, 0x00026D, 0x001D85, 0x00029F, 0x000271, 0x000270, 0x000272,
+	/*  1048 */ 0x000273, 0x000274, 0x000275, 0x000278, 0x000282, 0x000283, 0x0001AB, 0x000289,
+	/*  1056 */ 0x00028A, 0x001D1C, 0x00028B, 0x00028C, 0x00007A, 0x000290, 0x000291, 0x000292,
+	/*  1064 */ 0x000041, 0x000325, 0x000061, 0x000325, 0x000042, 0x000307, 0x000062, 0x000307,
+	/*  1072 */ 0x000042, 0x000323, 0x000062, 0x000323, 0x000042, 0x000331, 0x000062, 0x000331,
+	/*  1080 */ 0x000043, 0x000327, 0x000301, 0x000063, 0x000327, 0x000301, 0x000044, 0x000307,
+	/*  1088 */ 0x000064, 0x000307, 0x000044, 0x000323, 0x000064, 0x000323, 0x000044, 0x000331,
+	/*  1096 */ 0x000064, 0x000331, 0x000044, 0x000327, 0x000064, 0x000327, 0x000044, 0x00032D,
+	/*  1104 */ 0x000064, 0x00032D, 0x000045, 0x000304, 0x000300, 0x000065, 0x000304, 0x000300,
+	/*  1112 */ 0x000045, 0x000304, 0x000301, 0x000065, 0x000304, 0x000301, 0x000045, 0x00032D,
+	/*  1120 */ 0x000065, 0x00032D, 0x000045, 0x000330, 0x000065, 0x000330, 0x000045, 0x000327,
+	/*  1128 */ 0x000306, 0x000065, 0x000327, 0x000306, 0x000046, 0x000307, 0x000066, 0x000307,
+	/*  1136 */ 0x000047, 0x000304, 0x000067, 0x000304, 0x000048, 0x000307, 0x000068, 0x000307,
+	/*  1144 */ 0x000048, 0x000323, 0x000068, 0x000323, 0x000048, 0x000308, 0x000068, 0x000308,
+	/*  1152 */ 0x000048, 0x000327, 0x000068, 0x000327, 0x000048, 0x00032E, 0x000068, 0x00032E,
+	/*  1160 */ 0x000049, 0x000330, 0x000069, 0x000330, 0x000049, 0x000308, 0x000301, 0x000069,
+	/*  1168 */ 0x000308, 0x000301, 0x00004B, 0x000301, 0x00006B, 0x000301, 0x00004B, 0x000323,
+	/*  1176 */ 0x00006B, 0x000323, 0x00004B, 0x000331, 0x00006B, 0x000331, 0x00004C, 0x000323,
+	/*  1184 */ 0x00006C, 0x000323, 0x00004C, 0x000323, 0x000304, 0x00006C, 0x000323, 0x000304,
+	/*  1192 */ 0x00004C, 0x000331, 0x00006C, 0x000331, 0x00004C, 0x00032D, 0x00006C, 0x00032D,
+	/*  1200 */ 0x00004D, 0x000301, 0x00006D, 0x000301, 0x00004D, 0x000307, 0x00006D, 0x000307,
+	/*  1208 */ 0x00004D, 0x000323, 0x00006D, 0x000323, 0x00004E, 0x000307, 0x00006E, 0x000307,
+	/*  1216 */ 0x00004E, 0x000323, 0x00006E, 0x000323, 0x00004E, 0x000331, 0x00006E, 0x000331,
+	/*  1224 */ 0x00004E, 0x00032D, 0x00006E, 0x00032D, 0x00004F, 0x000303, 0x000301, 0x00006F,
+	/*  1232 */ 0x000303, 0x000301, 0x00004F, 0x000303, 0x000308, 0x00006F, 0x000303, 0x000308,
+	/*  1240 */ 0x00004F, 0x000304, 0x000300, 0x00006F, 0x000304, 0x000300, 0x00004F, 0x000304,
+	/*  1248 */ 0x000301, 0x00006F, 0x000304, 0x000301, 0x000050, 0x000301, 0x000070, 0x000301,
+	/*  1256 */ 0x000050, 0x000307, 0x000070, 0x000307, 0x000052, 0x000307, 0x000072, 0x000307,
+	/*  1264 */ 0x000052, 0x000323, 0x000072, 0x000323, 0x000052, 0x000323, 0x000304, 0x000072,
+	/*  1272 */ 0x000323, 0x000304, 0x000052, 0x000331, 0x000072, 0x000331, 0x000053, 0x000307,
+	/*  1280 */ 0x000073, 0x000307, 0x000053, 0x000323, 0x000073, 0x000323, 0x000053, 0x000301,
+	/*  1288 */ 0x000307, 0x000073, 0x000301, 0x000307, 0x000053, 0x00030C, 0x000307, 0x000073,
+	/*  1296 */ 0x00030C, 0x000307, 0x000053, 0x000323, 0x000307, 0x000073, 0x000323, 0x000307,
+	/*  1304 */ 0x000054, 0x000307, 0x000074, 0x000307, 0x000054, 0x000323, 0x000074, 0x000323,
+	/*  1312 */ 0x000054, 0x000331, 0x000074, 0x000331, 0x000054, 0x00032D, 0x000074, 0x00032D,
+	/*  1320 */ 0x000055, 0x000324, 0x000075, 0x000324, 0x000055, 0x000330, 0x000075, 0x000330,
+	/*  1328 */ 0x000055, 0x00032D, 0x000075, 0x00032D, 0x000055, 0x000303, 0x000301, 0x000075,
+	/*  1336 */ 0x000303, 0x000301, 0x000055, 0x000304, 0x000308, 0x000075, 0x000304, 0x000308,
+	/*  1344 */ 0x000056, 0x000303, 0x000076, 0x000303, 0x000056, 0x000323, 0x000076, 0x000323,
+	/*  1352 */ 0x000057, 0x000300, 0x000077, 0x000300, 0x000057, 0x000301, 0x000077, 0x000301,
+	/*  1360 */ 0x000057, 0x000308, 0x000077, 0x000308, 0x000057, 0x000307, 0x000077, 0x000307,
+	/*  1368 */ 0x000057, 0x000323, 0x000077, 0x000323, 0x000058, 0x000307, 0x000078, 0x000307,
+	/*  1376 */ 0x000058, 0x000308, 0x000078, 0x000308, 0x000059, 0x000307, 0x000079, 0x000307,
+	/*  1384 */ 0x00005A, 0x000302, 0x00007A, 0x000302, 0x00005A, 0x000323, 0x00007A, 0x000323,
+	/*  1392 */ 0x00005A, 0x000331, 0x00007A, 0x000331, 0x000068, 0x000331, 0x000074, 0x000308,
+	/*  1400 */ 0x000077, 0x00030A, 0x000079, 0x00030A, 0x000061, 0x0002BE, 0x00017F, 0x000307,
+	/*  1408 */ 0x000041, 0x000323, 0x000061, 0x000323, 0x000041, 0x000309, 0x000061, 0x000309,
+	/*  1416 */ 0x000041, 0x000302, 0x000301, 0x000061, 0x000302, 0x000301, 0x000041, 0x000302,
+	/*  1424 */ 0x000300, 0x000061, 0x000302, 0x000300, 0x000041, 0x000302, 0x000309, 0x000061,
+	/*  1432 */ 0x000302, 0x000309, 0x000041, 0x000302, 0x000303, 0x000061, 0x000302, 0x000303,
+	/*  1440 */ 0x000041, 0x000323, 0x000302, 0x000061, 0x000323, 0x000302, 0x000041, 0x000306,
+	/*  1448 */ 0x000301, 0x000061, 0x000306, 0x000301, 0x000041, 0x000306, 0x000300, 0x000061,
+	/*  1456 */ 0x000306, 0x000300, 0x000041, 0x000306, 0x000309, 0x000061, 0x000306, 0x000309,
+	/*  1464 */ 0x000041, 0x000306, 0x000303, 0x000061, 0x000306, 0x000303, 0x000041, 0x000323,
+	/*  1472 */ 0x000306, 0x000061, 0x000323, 0x000306, 0x000045, 0x000323, 0x000065, 0x000323,
+	/*  1480 */ 0x000045, 0x000309, 0x000065, 0x000309, 0x000045, 0x000303, 0x000065, 0x000303,
+	/*  1488 */ 0x000045, 0x000302, 0x000301, 0x000065, 0x000302, 0x000301, 0x000045, 0x000302,
+	/*  1496 */ 0x000300, 0x000065, 0x000302, 0x000300, 0x000045, 0x000302, 0x000309, 0x000065,
+	/*  1504 */ 0x000302, 0x000309, 0x000045, 0x000302, 0x000303, 0x000065, 0x000302, 0x000303,
+	/*  1512 */ 0x000045, 0x000323, 0x000302, 0x000065, 0x000323, 0x000302, 0x000049, 0x000309,
+	/*  1520 */ 0x000069, 0x000309, 0x000049, 0x000323, 0x000069, 0x000323, 0x00004F, 0x000323,
+	/*  1528 */ 0x00006F, 0x000323, 0x00004F, 0x000309, 0x00006F, 0x000309, 0x00004F, 0x000302,
+	/*  1536 */ 0x000301, 0x00006F, 0x000302, 0x000301, 0x00004F, 0x000302, 0x000300, 0x00006F,
+	/*  1544 */ 0x000302, 0x000300, 0x00004F, 0x000302, 0x000309, 0x00006F, 0x000302, 0x000309,
+	/*  1552 */ 0x00004F, 0x000302, 0x000303, 0x00006F, 0x000302, 0x000303, 0x00004F, 0x000323,
+	/*  1560 */ 0x000302, 0x00006F, 0x000323, 0x000302, 0x00004F, 0x00031B, 0x000301, 0x00006F,
+	/*  1568 */ 0x00031B, 0x000301, 0x00004F, 0x00031B, 0x000300, 0x00006F, 0x00031B, 0x000300,
+	/*  1576 */ 0x00004F, 0x00031B, 0x000309, 0x00006F, 0x00031B, 0x000309, 0x00004F, 0x00031B,
+	/*  1584 */ 0x000303, 0x00006F, 0x00031B, 0x000303, 0x00004F, 0x00031B, 0x000323, 0x00006F,
+	/*  1592 */ 0x00031B, 0x000323, 0x000055, 0x000323, 0x000075, 0x000323, 0x000055, 0x000309,
+	/*  1600 */ 0x000075, 0x000309, 0x000055, 0x00031B, 0x000301, 0x000075, 0x00031B, 0x000301,
+	/*  1608 */ 0x000055, 0x00031B, 0x000300, 0x000075, 0x00031B, 0x000300, 0x000055, 0x00031B,
+	/*  1616 */ 0x000309, 0x000075, 0x00031B, 0x000309, 0x000055, 0x00031B, 0x000303, 0x000075,
+	/*  1624 */ 0x00031B, 0x000303, 0x000055, 0x00031B, 0x000323, 0x000075, 0x00031B, 0x000323,
+	/*  1632 */ 0x000059, 0x000300, 0x000079, 0x000300, 0x000059, 0x000323, 0x000079, 0x000323,
+	/*  1640 */ 0x000059, 0x000309, 0x000079, 0x000309, 0x000059, 0x000303, 0x000079, 0x000303,
+	/*  1648 */ 0x0003B1, 0x000313, 0x0003B1, 0x000314, 0x0003B1, 0x000313, 0x000300, 0x0003B1,
+	/*  1656 */ 0x000314, 0x000300, 0x0003B1, 0x000313, 0x000301, 0x0003B1, 0x000314, 0x000301,
+	/*  1664 */ 0x0003B1, 0x000313, 0x000342, 0x0003B1, 0x000314, 0x000342, 0x000391, 0x000313,
+	/*  1672 */ 0x000391, 0x000314, 0x000391, 0x000313, 0x000300, 0x000391, 0x000314, 0x000300,
+	/*  1680 */ 0x000391, 0x000313, 0x000301, 0x000391, 0x000314, 0x000301, 0x000391, 0x000313,
+	/*  1688 */ 0x000342, 0x000391, 0x000314, 0x000342, 0x0003B5, 0x000313, 0x0003B5, 0x000314,
+	/*  1696 */ 0x0003B5, 0x000313, 0x000300, 0x0003B5, 0x000314, 0x000300, 0x0003B5, 0x000313,
+	/*  1704 */ 0x000301, 0x0003B5, 0x000314, 0x000301, 0x000395, 0x000313, 0x000395, 0x000314,
+	/*  1712 */ 0x000395, 0x000313, 0x000300, 0x000395, 0x000314, 0x000300, 0x000395, 0x000313,
+	/*  1720 */ 0x000301, 0x000395, 0x000314, 0x000301, 0x0003B7, 0x000313, 0x0003B7, 0x000314,
+	/*  1728 */ 0x0003B7, 0x000313, 0x000300, 0x0003B7, 0x000314, 0x000300, 0x0003B7, 0x000313,
+	/*  1736 */ 0x000301, 0x0003B7, 0x000314, 0x000301, 0x0003B7, 0x000313, 0x000342, 0x0003B7,
+	/*  1744 */ 0x000314, 0x000342, 0x000397, 0x000313, 0x000397, 0x000314, 0x000397, 0x000313,
+	/*  1752 */ 0x000300, 0x000397, 0x000314, 0x000300, 0x000397, 0x000313, 0x000301, 0x000397,
+	/*  1760 */ 0x000314, 0x000301, 0x000397, 0x000313, 0x000342, 0x000397, 0x000314, 0x000342,
+	/*  1768 */ 0x0003B9, 0x000313, 0x0003B9, 0x000314, 0x0003B9, 0x000313, 0x000300, 0x0003B9,
+	/*  1776 */ 0x000314, 0x000300, 0x0003B9, 0x000313, 0x000301, 0x0003B9, 0x000314, 0x000301,
+	/*  1784 */ 0x0003B9, 0x000313, 0x000342, 0x0003B9, 0x000314, 0x000342, 0x000399, 0x000313,
+	/*  1792 */ 0x000399, 0x000314, 0x000399, 0x000313, 0x000300, 0x000399, 0x000314, 0x000300,
+	/*  1800 */ 0x000399, 0x000313, 0x000301, 0x000399, 0x000314, 0x000301, 0x000399, 0x000313,
+	/*  1808 */ 0x000342, 0x000399, 0x000314, 0x000342, 0x0003BF, 0x000313, 0x0003BF, 0x000314,
+	/*  1816 */ 0x0003BF, 0x000313, 0x000300, 0x0003BF, 0x000314, 0x000300, 0x0003BF, 0x000313,
+	/*  1824 */ 0x000301, 0x0003BF, 0x000314, 0x000301, 0x00039F, 0x000313, 0x00039F, 0x000314,
+	/*  1832 */ 0x00039F, 0x000313, 0x000300, 0x00039F, 0x000314, 0x000300, 0x00039F, 0x000313,
+	/*  1840 */ 0x000301, 0x00039F, 0x000314, 0x000301, 0x0003C5, 0x000313, 0x0003C5, 0x000314,
+	/*  1848 */ 0x0003C5, 0x000313, 0x000300, 0x0003C5, 0x000314, 0x000300, 0x0003C5, 0x000313,
+	/*  1856 */ 0x000301, 0x0003C5, 0x000314, 0x000301, 0x0003C5, 0x000313, 0x000342, 0x0003C5,
+	/*  1864 */ 0x000314, 0x000342, 0x0003A5, 0x000314, 0x0003A5, 0x000314, 0x000300, 0x0003A5,
+	/*  1872 */ 0x000314, 0x000301, 0x0003A5, 0x000314, 0x000342, 0x0003C9, 0x000313, 0x0003C9,
+	/*  1880 */ 0x000314, 0x0003C9, 0x000313, 0x000300, 0x0003C9, 0x000314, 0x000300, 0x0003C9,
+	/*  1888 */ 0x000313, 0x000301, 0x0003C9, 0x000314, 0x000301, 0x0003C9, 0x000313, 0x000342,
+	/*  1896 */ 0x0003C9, 0x000314, 0x000342, 0x0003A9, 0x000313, 0x0003A9, 0x000314, 0x0003A9,
+	/*  1904 */ 0x000313, 0x000300, 0x0003A9, 0x000314, 0x000300, 0x0003A9, 0x000313, 0x000301,
+	/*  1912 */ 0x0003A9, 0x000314, 0x000301, 0x0003A9, 0x000313, 0x000342, 0x0003A9, 0x000314,
+	/*  1920 */ 0x000342, 0x0003B1, 0x000300, 0x0003B5, 0x000300, 0x0003B7, 0x000300, 0x0003B9,
+	/*  1928 */ 0x000300, 0x0003BF, 0x000300, 0x0003C5, 0x000300, 0x0003C9, 0x000300, 0x0003B1,
+	/*  1936 */ 0x000313, 0x000345, 0x0003B1, 0x000314, 0x000345, 0x0003B1, 0x000313, 0x000300,
+	/*  1944 */ 0x000345, 0x0003B1, 0x000314, 0x000300, 0x000345, 0x0003B1, 0x000313, 0x000301,
+	/*  1952 */ 0x000345, 0x0003B1, 0x000314, 0x000301, 0x000345, 0x0003B1, 0x000313, 0x000342,
+	/*  1960 */ 0x000345, 0x0003B1, 0x000314, 0x000342, 0x000345, 0x000391, 0x000313, 0x000345,
+	/*  1968 */ 0x000391, 0x000314, 0x000345, 0x000391, 0x000313, 0x000300, 0x000345, 0x000391,
+	/*  1976 */ 0x000314, 0x000300, 0x000345, 0x000391, 0x000313, 0x000301, 0x000345, 0x000391,
+	/*  1984 */ 0x000314, 0x000301, 0x000345, 0x000391, 0x000313, 0x000342, 0x000345, 0x000391,
+	/*  1992 */ 0x000314, 0x000342, 0x000345, 0x0003B7, 0x000313, 0x000345, 0x0003B7, 0x000314,
+	/*  2000 */ 0x000345, 0x0003B7, 0x000313, 0x000300, 0x000345, 0x0003B7, 0x000314, 0x000300,
+	/*  2008 */ 0x000345, 0x0003B7, 0x000313, 0x000301, 0x000345, 0x0003B7, 0x000314, 0x000301,
+	/*  2016 */ 0x000345, 0x0003B7, 0x000313, 0x000342, 0x000345, 0x0003B7, 0x000314, 0x000342,
+	/*  2024 */ 0x000345, 0x000397, 0x000313, 0x000345, 0x000397, 0x000314, 0x000345, 0x000397,
+	/*  2032 */ 0x000313, 0x000300, 0x000345, 0x000397, 0x000314, 0x000300, 0x000345, 0x000397,
+	/*  2040 */ 0x000313, 0x000301, 0x000345, 0x000397, 0x000314, 0x000301, 0x000345, 0x000397,
+	/*  2048 */ 0x000313, 0x000342, 0x000345, 0x000397, 0x000314, 0x000342, 0x000345, 0x0003C9,
+	/*  2056 */ 0x000313, 0x000345, 0x0003C9, 0x000314, 0x000345, 0x0003C9, 0x000313, 0x000300,
+	/*  2064 */ 0x000345, 0x0003C9, 0x000314, 0x000300, 0x000345, 0x0003C9, 0x000313, 0x000301,
+	/*  2072 */ 0x000345, 0x0003C9, 0x000314, 0x000301, 0x000345, 0x0003C9, 0x000313, 0x000342,
+	/*  2080 */ 0x000345, 0x0003C9, 0x000314, 0x000342, 0x000345, 0x0003A9, 0x000313, 0x000345,
+	/*  2088 */ 0x0003A9, 0x000314, 0x000345, 0x0003A9, 0x000313, 0x000300, 0x000345, 0x0003A9,
+	/*  2096 */ 0x000314, 0x000300, 0x000345, 0x0003A9, 0x000313, 0x000301, 0x000345, 0x0003A9,
+	/*  2104 */ 0x000314, 0x000301, 0x000345, 0x0003A9, 0x000313, 0x000342, 0x000345, 0x0003A9,
+	/*  2112 */ 0x000314, 0x000342, 0x000345, 0x0003B1, 0x000306, 0x0003B1, 0x000304, 0x0003B1,
+	/*  2120 */ 0x000300, 0x000345, 0x0003B1, 0x000345, 0x0003B1, 0x000301, 0x000345, 0x0003B1,
+	/*  2128 */ 0x000342, 0x0003B1, 0x000342, 0x000345, 0x000391, 0x000306, 0x000391, 0x000304,
+	/*  2136 */ 0x000391, 0x000300, 0x000391, 0x000345, 0x000020, 0x000313, 0x0003B9, 0x000020,
+	/*  2144 */ 0x000342, 0x0000A8, 0x000342, 0x000020, 0x000308, 0x000342, 0x0003B7, 0x000300,
+	/*  2152 */ 0x000345, 0x0003B7, 0x000345, 0x0003B7, 0x000301, 0x000345, 0x0003B7, 0x000342,
+	/*  2160 */ 0x0003B7, 0x000342, 0x000345, 0x000395, 0x000300, 0x000397, 0x000300, 0x000397,
+	/*  2168 */ 0x000345, 0x001FBF, 0x000300, 0x000020, 0x000313, 0x000300, 0x001FBF, 0x000301,
+	/*  2176 */ 0x000020, 0x000313, 0x000301, 0x001FBF, 0x000342, 0x000020, 0x000313, 0x000342,
+	/*  2184 */ 0x0003B9, 0x000306, 0x0003B9, 0x000304, 0x0003B9, 0x000308, 0x000300, 0x0003B9,
+	/*  2192 */ 0x000342, 0x0003B9, 0x000308, 0x000342, 0x000399, 0x000306, 0x000399, 0x000304,
+	/*  2200 */ 0x000399, 0x000300, 0x001FFE, 0x000300, 0x000020, 0x000314, 0x000300, 0x001FFE,
+	/*  2208 */ 0x000301, 0x000020, 0x000314, 0x000301, 0x001FFE, 0x000342, 0x000020, 0x000314,
+	/*  2216 */ 0x000342, 0x0003C5, 0x000306, 0x0003C5, 0x000304, 0x0003C5, 0x000308, 0x000300,
+	/*  2224 */ 0x0003C1, 0x000313, 0x0003C1, 0x000314, 0x0003C5, 0x000342, 0x0003C5, 0x000308,
+	/*  2232 */ 0x000342, 0x0003A5, 0x000306, 0x0003A5, 0x000304, 0x0003A5, 0x000300, 0x0003A1,
+	/*  2240 */ 0x000314, 0x0000A8, 0x000300, 0x000020, 0x000308, 0x000300, 0x000060, 0x0003C9,
+	/*  2248 */ 0x000300, 0x000345, 0x0003C9, 0x000345, 0x0003C9, 0x000301, 0x000345, 0x0003C9,
+	/*  2256 */ 0x000342, 0x0003C9, 0x000342, 0x000345, 0x00039F, 0x000300, 0x0003A9, 0x000300,
+	/*  2264 */ 0x0003A9, 0x000345, 0x0000B4, 0x000020, 0x000314, 0x002002, 0x002003, 0x002010,
+	/*  2272 */ 0x000020, 0x000333, 0x00002E, 0x00002E, 0x00002E, 0x00002E, 0x00002E, 0x00002E,
+	/*  2280 */ 0x002032, 0x002032, 0x002032, 0x002032, 0x002032, 0x002035, 0x002035, 0x002035,
+	/*  2288 */ 0x002035, 0x002035, 0x000021, 0x000021, 0x000020, 0x000305, 0x00003F, 0x00003F,
+	/*  2296 */ 0x00003F, 0x000021, 0x000021, 0x00003F, 0x002032, 0x002032, 0x002032, 0x002032,
+	/*  2304 */ 0x000030, 0x000034, 0x000035, 0x000036, 0x000037, 0x000038, 0x000039, 0x00002B,
+	/*  2312 */ 0x002212, 0x00003D, 0x000028, 0x000029, 0x00006E, 0x000052, 0x000073, 0x000061,
+	/*  2320 */ 0x00002F, 0x000063, 0x000061, 0x00002F, 0x000073, 0x000043, 0x0000B0, 0x000043,
+	/*  2328 */ 0x000063, 0x00002F, 0x00006F, 0x000063, 0x00002F, 0x000075, 0x000190, 0x0000B0,
+	/*  2336 */ 0x000046, 0x000127, 0x00004E, 0x00006F, 0x000051, 0x000053, 0x00004D, 0x000054,
+	/*  2344 */ 0x000045, 0x00004C, 0x000054, 0x00004D, 0x00005A, 0x0003A9, 0x000046, 0x0005D0,
+	/*  2352 */ 0x0005D1, 0x0005D2, 0x0005D3, 0x000046, 0x000041, 0x000058, 0x000393, 0x0003A0,
+	/*  2360 */ 0x002211, 0x000031, 0x002044, 0x000037, 0x000031, 0x002044, 0x000039, 0x000031,
+	/*  2368 */ 0x002044, 0x000031, 0x000030, 0x000031, 0x002044, 0x000033, 0x000032, 0x002044,
+	/*  2376 */ 0x000033, 0x000031, 0x002044, 0x000035, 0x000032, 0x002044, 0x000035, 0x000033,
+	/*  2384 */ 0x002044, 0x000035, 0x000034, 0x002044, 0x000035, 0x000031, 0x002044, 0x000036,
+	/*  2392 */ 0x000035, 0x002044, 0x000036, 0x000031, 0x002044, 0x000038, 0x000033, 0x002044,
+	/*  2400 */ 0x000038, 0x000035, 0x002044, 0x000038, 0x000037, 0x002044, 0x000038, 0x000031,
+	/*  2408 */ 0x002044, 0x000049, 0x000049, 0x000049, 0x000049, 0x000049, 0x000049, 0x000056,
+	/*  2416 */ 0x000056, 0x000056, 0x000049, 0x000056, 0x000049, 0x000049, 0x000056, 0x000049,
+	/*  2424 */ 0x000049, 0x000049, 0x000049, 0x000058, 0x000058, 0x000058, 0x000049, 0x000058,
+	/*  2432 */ 0x000049, 0x000049, 0x000069, 0x000069, 0x000069, 0x000069, 0x000069, 0x000069,
+	/*  2440 */ 0x000076, 0x000076, 0x000069, 0x000076, 0x000069, 0x000069, 0x000076, 0x000069,
+	/*  2448 */ 0x000069, 0x000069, 0x000069, 0x000078, 0x000078, 0x000069, 0x000078, 0x000069,
+	/*  2456 */ 0x000069, 0x000030, 0x002044, 0x000033, 0x002190, 0x000338, 0x002192, 0x000338,
+	/*  2464 */ 0x002194, 0x000338, 0x0021D0, 0x000338, 0x0021D4, 0x000338, 0x0021D2, 0x000338,
+	/*  2472 */ 0x002203, 0x000338, 0x002208, 0x000338, 0x00220B, 0x000338, 0x002223, 0x000338,
+	/*  2480 */ 0x002225, 0x000338, 0x00222B, 0x00222B, 0x00222B, 0x00222B, 0x00222B, 0x00222E,
+	/*  2488 */ 0x00222E, 0x00222E, 0x00222E, 0x00222E, 0x00223C, 0x000338, 0x002243, 0x000338,
+	/*  2496 */ 0x002245, 0x000338, 0x002248, 0x000338, 0x00003D, 0x000338, 0x002261, 0x000338,
+	/*  2504 */ 0x00224D, 0x000338, 0x00003C, 0x000338, 0x00003E, 0x000338, 0x002264, 0x000338,
+	/*  2512 */ 0x002265, 0x000338, 0x002272, 0x000338, 0x002273, 0x000338, 0x002276, 0x000338,
+	/*  2520 */ 0x002277, 0x000338, 0x00227A, 0x000338, 0x00227B, 0x000338, 0x002282, 0x000338,
+	/*  2528 */ 0x002283, 0x000338, 0x002286, 0x000338, 0x002287, 0x000338, 0x0022A2, 0x000338,
+	/*  2536 */ 0x0022A8, 0x000338, 0x0022A9, 0x000338, 0x0022AB, 0x000338, 0x00227C, 0x000338,
+	/*  2544 */ 0x00227D, 0x000338, 0x002291, 0x000338, 0x002292, 0x000338, 0x0022B2, 0x000338,
+	/*  2552 */ 0x0022B3, 0x000338, 0x0022B4, 0x000338, 0x0022B5, 0x000338, 0x003008, 0x003009,
+	/*  2560 */ 0x000031, 0x000030, 0x000031, 0x000031, 0x000031, 0x000032, 0x000031, 0x000033,
+	/*  2568 */ 0x000031, 0x000034, 0x000031, 0x000035, 0x000031, 0x000036, 0x000031, 0x000037,
+	/*  2576 */ 0x000031, 0x000038, 0x000031, 0x000039, 0x000032, 0x000030, 0x000028, 0x000031,
+	/*  2584 */ 0x000029, 0x000028, 0x000032, 0x000029, 0x000028, 0x000033, 0x000029, 0x000028,
+	/*  2592 */ 0x000034, 0x000029, 0x000028, 0x000035, 0x000029, 0x000028, 0x000036, 0x000029,
+	/*  2600 */ 0x000028, 0x000037, 0x000029, 0x000028, 0x000038, 0x000029, 0x000028, 0x000039,
+	/*  2608 */ 0x000029, 0x000028, 0x000031, 0x000030, 0x000029, 0x000028, 0x000031, 0x000031,
+	/*  2616 */ 0x000029, 0x000028, 0x000031, 0x000032, 0x000029, 0x000028, 0x000031, 0x000033,
+	/*  2624 */ 0x000029, 0x000028, 0x000031, 0x000034, 0x000029, 0x000028, 0x000031, 0x000035,
+	/*  2632 */ 0x000029, 0x000028, 0x000031, 0x000036, 0x000029, 0x000028, 0x000031, 0x000037,
+	/*  2640 */ 0x000029, 0x000028, 0x000031, 0x000038, 0x000029, 0x000028, 0x000031, 0x000039,
+	/*  2648 */ 0x000029, 0x000028, 0x000032, 0x000030, 0x000029, 0x000031, 0x00002E, 0x000032,
+	/*  2656 */ 0x00002E, 0x000033, 0x00002E, 0x000034, 0x00002E, 0x000035, 0x00002E, 0x000036,
+	/*  2664 */ 0x00002E, 0x000037, 0x00002E, 0x000038, 0x00002E, 0x000039, 0x00002E, 0x000031,
+	/*  2672 */ 0x000030, 0x00002E, 0x000031, 0x000031, 0x00002E, 0x000031, 0x000032, 0x00002E,
+	/*  2680 */ 0x000031, 0x000033, 0x00002E, 0x000031, 0x000034, 0x00002E, 0x000031, 0x000035,
+	/*  2688 */ 0x00002E, 0x000031, 0x000036, 0x00002E, 0x000031, 0x000037, 0x00002E, 0x000031,
+	/*  2696 */ 0x000038, 0x00002E, 0x000031, 0x000039, 0x00002E, 0x000032, 0x000030, 0x00002E,
+	/*  2704 */ 0x000028, 0x000061, 0x000029, 0x000028, 0x000062, 0x000029, 0x000028, 0x000063,
+	/*  2712 */ 0x000029, 0x000028, 0x000064, 0x000029, 0x000028, 0x000065, 0x000029, 0x000028,
+	/*  2720 */ 0x000066, 0x000029, 0x000028, 0x000067, 0x000029, 0x000028, 0x000068, 0x000029,
+	/*  2728 */ 0x000028, 0x000069, 0x000029, 0x000028, 0x00006A, 0x000029, 0x000028, 0x00006B,
+	/*  2736 */ 0x000029, 0x000028, 0x00006C, 0x000029, 0x000028, 0x00006D, 0x000029, 0x000028,
+	/*  2744 */ 0x00006E, 0x000029, 0x000028, 0x00006F, 0x000029, 0x000028, 0x000070, 0x000029,
+	/*  2752 */ 0x000028, 0x000071, 0x000029, 0x000028, 0x000072, 0x000029, 0x000028, 0x000073,
+	/*  2760 */ 0x000029, 0x000028, 0x000074, 0x000029, 0x000028, 0x000075, 0x000029, 0x000028,
+	/*  2768 */ 0x000076, 0x000029, 0x000028, 0x000077, 0x000029, 0x000028, 0x000078, 0x000029,
+	/*  2776 */ 0x000028, 0x000079, 0x000029, 0x000028, 0x00007A, 0x000029, 0x000053, 0x000059,
+	/*  2784 */ 0x000071, 0x00222B, 0x00222B, 0x00222B, 0x00222B, 0x00003A, 0x00003A, 0x00003D,
+	/*  2792 */ 0x00003D, 0x00003D, 0x00003D, 0x00003D, 0x00003D, 0x002ADD, 0x000338, 0x002D61,
+	/*  2800 */ 0x006BCD, 0x009F9F, 0x004E00, 0x004E28, 0x004E36, 0x004E3F, 0x004E59, 0x004E85,
+	/*  2808 */ 0x004E8C, 0x004EA0, 0x004EBA, 0x00513F, 0x005165, 0x00516B, 0x005182, 0x005196,
+	/*  2816 */ 0x0051AB, 0x0051E0, 0x0051F5, 0x005200, 0x00529B, 0x0052F9, 0x005315, 0x00531A,
+	/*  2824 */ 0x005338, 0x005341, 0x00535C, 0x005369, 0x005382, 0x0053B6, 0x0053C8, 0x0053E3,
+	/*  2832 */ 0x0056D7, 0x00571F, 0x0058EB, 0x005902, 0x00590A, 0x005915, 0x005927, 0x005973,
+	/*  2840 */ 0x005B50, 0x005B80, 0x005BF8, 0x005C0F, 0x005C22, 0x005C38, 0x005C6E, 0x005C71,
+	/*  2848 */ 0x005DDB, 0x005DE5, 0x005DF1, 0x005DFE, 0x005E72, 0x005E7A, 0x005E7F, 0x005EF4,
+	/*  2856 */ 0x005EFE, 0x005F0B, 0x005F13, 0x005F50, 0x005F61, 0x005F73, 0x005FC3, 0x006208,
+	/*  2864 */ 0x006236, 0x00624B, 0x00652F, 0x006534, 0x006587, 0x006597, 0x0065A4, 0x0065B9,
+	/*  2872 */ 0x0065E0, 0x0065E5, 0x0066F0, 0x006708, 0x006728, 0x006B20, 0x006B62, 0x006B79,
+	/*  2880 */ 0x006BB3, 0x006BCB, 0x006BD4, 0x006BDB, 0x006C0F, 0x006C14, 0x006C34, 0x00706B,
+	/*  2888 */ 0x00722A, 0x007236, 0x00723B, 0x00723F, 0x007247, 0x007259, 0x00725B, 0x0072AC,
+	/*  2896 */ 0x007384, 0x007389, 0x0074DC, 0x0074E6, 0x007518, 0x00751F, 0x007528, 0x007530,
+	/*  2904 */ 0x00758B, 0x007592, 0x007676, 0x00767D, 0x0076AE, 0x0076BF, 0x0076EE, 0x0077DB,
+	/*  2912 */ 0x0077E2, 0x0077F3, 0x00793A, 0x0079B8, 0x0079BE, 0x007A74, 0x007ACB, 0x007AF9,
+	/*  2920 */ 0x007C73, 0x007CF8, 0x007F36, 0x007F51, 0x007F8A, 0x007FBD, 0x008001, 0x00800C,
+	/*  2928 */ 0x008012, 0x008033, 0x00807F, 0x008089, 0x0081E3, 0x0081EA, 0x0081F3, 0x0081FC,
+	/*  2936 */ 0x00820C, 0x00821B, 0x00821F, 0x00826E, 0x008272, 0x008278, 0x00864D, 0x00866B,
+	/*  2944 */ 0x008840, 0x00884C, 0x008863, 0x00897E, 0x00898B, 0x0089D2, 0x008A00, 0x008C37,
+	/*  2952 */ 0x008C46, 0x008C55, 0x008C78, 0x008C9D, 0x008D64, 0x008D70, 0x008DB3, 0x008EAB,
+	/*  2960 */ 0x008ECA, 0x008F9B, 0x008FB0, 0x008FB5, 0x009091, 0x009149, 0x0091C6, 0x0091CC,
+	/*  2968 */ 0x0091D1, 0x009577, 0x009580, 0x00961C, 0x0096B6, 0x0096B9, 0x0096E8, 0x009751,
+	/*  2976 */ 0x00975E, 0x009762, 0x009769, 0x0097CB, 0x0097ED, 0x0097F3, 0x009801, 0x0098A8,
+	/*  2984 */ 0x0098DB, 0x0098DF, 0x009996, 0x009999, 0x0099AC, 0x009AA8, 0x009AD8, 0x009ADF,
+	/*  2992 */ 0x009B25, 0x009B2F, 0x009B32, 0x009B3C, 0x009B5A, 0x009CE5, 0x009E75, 0x009E7F,
+	/*  3000 */ 0x009EA5, 0x009EBB, 0x009EC3, 0x009ECD, 0x009ED1, 0x009EF9, 0x009EFD, 0x009F0E,
+	/*  3008 */ 0x009F13, 0x009F20, 0x009F3B, 0x009F4A, 0x009F52, 0x009F8D, 0x009F9C, 0x009FA0,
+	/*  3016 */ 0x003012, 0x005344, 0x005345, 0x00304B, 0x003099, 0x00304D, 0x003099, 0x00304F,
+	/*  3024 */ 0x003099, 0x003051, 0x003099, 0x003053, 0x003099, 0x003055, 0x003099, 0x003057,
+	/*  3032 */ 0x003099, 0x003059, 0x003099, 0x00305B, 0x003099, 0x00305D, 0x003099, 0x00305F,
+	/*  3040 */ 0x003099, 0x003061, 0x003099, 0x003064, 0x003099, 0x003066, 0x003099, 0x003068,
+	/*  3048 */ 0x003099, 0x00306F, 0x003099, 0x00306F, 0x00309A, 0x003072, 0x003099, 0x003072,
+	/*  3056 */ 0x00309A, 0x003075, 0x003099, 0x003075, 0x00309A, 0x003078, 0x003099, 0x003078,
+	/*  3064 */ 0x00309A, 0x00307B, 0x003099, 0x00307B, 0x00309A, 0x003046, 0x003099, 0x000020,
+	/*  3072 */ 0x003099, 0x000020, 0x00309A, 0x00309D, 0x003099, 0x003088, 0x00308A, 0x0030AB,
+	/*  3080 */ 0x003099, 0x0030AD, 0x003099, 0x0030AF, 0x003099, 0x0030B1, 0x003099, 0x0030B3,
+	/*  3088 */ 0x003099, 0x0030B5, 0x003099, 0x0030B7, 0x003099, 0x0030B9, 0x003099, 0x0030BB,
+	/*  3096 */ 0x003099, 0x0030BD, 0x003099, 0x0030BF, 0x003099, 0x0030C1, 0x003099, 0x0030C4,
+	/*  3104 */ 0x003099, 0x0030C6, 0x003099, 0x0030C8, 0x003099, 0x0030CF, 0x003099, 0x0030CF,
+	/*  3112 */ 0x00309A, 0x0030D2, 0x003099, 0x0030D2, 0x00309A, 0x0030D5, 0x003099, 0x0030D5,
+	/*  3120 */ 0x00309A, 0x0030D8, 0x003099, 0x0030D8, 0x00309A, 0x0030DB, 0x003099, 0x0030DB,
+	/*  3128 */ 0x00309A, 0x0030A6, 0x003099, 0x0030EF, 0x003099, 0x0030F0, 0x003099, 0x0030F1,
+	/*  3136 */ 0x003099, 0x0030F2, 0x003099, 0x0030FD, 0x003099, 0x0030B3, 0x0030C8, 0x001100,
+	/*  3144 */ 0x001101, 0x0011AA, 0x001102, 0x0011AC, 0x0011AD, 0x001103, 0x001104, 0x001105,
+	/*  3152 */ 0x0011B0, 0x0011B1, 0x0011B2, 0x0011B3, 0x0011B4, 0x0011B5, 0x00111A, 0x001106,
+	/*  3160 */ 0x001107, 0x001108, 0x001121, 0x001109, 0x00110A, 0x00110B, 0x00110C, 0x00110D,
+	/*  3168 */ 0x00110E, 0x00110F, 0x001110, 0x001111, 0x001112, 0x001161, 0x001162, 0x001163,
+	/*  3176 */ 0x001164, 0x001165, 0x001166, 0x001167, 0x001168, 0x001169, 0x00116A, 0x00116B,
+	/*  3184 */ 0x00116C, 0x00116D, 0x00116E, 0x00116F, 0x001170, 0x001171, 0x001172, 0x001173,
+	/*  3192 */ 0x001174, 0x001175, 0x001160, 0x001114, 0x001115, 0x0011C7, 0x0011C8, 0x0011CC,
+	/*  3200 */ 0x0011CE, 0x0011D3, 0x0011D7, 0x0011D9, 0x00111C, 0x0011DD, 0x0011DF, 0x00111D,
+	/*  3208 */ 0x00111E, 0x001120, 0x001122, 0x001123, 0x001127, 0x001129, 0x00112B, 0x00112C,
+	/*  3216 */ 0x00112D, 0x00112E, 0x00112F, 0x001132, 0x001136, 0x001140, 0x001147, 0x00114C,
+	/*  3224 */ 0x0011F1, 0x0011F2, 0x001157, 0x001158, 0x001159, 0x001184, 0x001185, 0x001188,
+	/*  3232 */ 0x001191, 0x001192, 0x001194, 0x00119E, 0x0011A1, 0x004E09, 0x0056DB, 0x004E0A,
+	/*  3240 */ 0x004E2D, 0x004E0B, 0x007532, 0x004E19, 0x004E01, 0x005929, 0x005730, 0x000028,
+	/*  3248 */ 0x001100, 0x000029, 0x000028, 0x001102, 0x000029, 0x000028, 0x001103, 0x000029,
+	/*  3256 */ 0x000028, 0x001105, 0x000029, 0x000028, 0x001106, 0x000029, 0x000028, 0x001107,
+	/*  3264 */ 0x000029, 0x000028, 0x001109, 0x000029, 0x000028, 0x00110B, 0x000029, 0x000028,
+	/*  3272 */ 0x00110C, 0x000029, 0x000028, 0x00110E, 0x000029, 0x000028, 0x00110F, 0x000029,
+	/*  3280 */ 0x000028, 0x001110, 0x000029, 0x000028, 0x001111, 0x000029, 0x000028, 0x001112,
+	/*  3288 */ 0x000029, 0x000028, 0x001100, 0x001161, 0x000029, 0x000028, 0x001102, 0x001161,
+	/*  3296 */ 0x000029, 0x000028, 0x001103, 0x001161, 0x000029, 0x000028, 0x001105, 0x001161,
+	/*  3304 */ 0x000029, 0x000028, 0x001106, 0x001161, 0x000029, 0x000028, 0x001107, 0x001161,
+	/*  3312 */ 0x000029, 0x000028, 0x001109, 0x001161, 0x000029, 0x000028, 0x00110B, 0x001161,
+	/*  3320 */ 0x000029, 0x000028, 0x00110C, 0x001161, 0x000029, 0x000028, 0x00110E, 0x001161,
+	/*  3328 */ 0x000029, 0x000028, 0x00110F, 0x001161, 0x000029, 0x000028, 0x001110, 0x001161,
+	/*  3336 */ 0x000029, 0x000028, 0x001111, 0x001161, 0x000029, 0x000028, 0x001112, 0x001161,
+	/*  3344 */ 0x000029, 0x000028, 0x00110C, 0x00116E, 0x000029, 0x000028, 0x00110B, 0x001169,
+	/*  3352 */ 0x00110C, 0x001165, 0x0011AB, 0x000029, 0x000028, 0x00110B, 0x001169, 0x001112,
+	/*  3360 */ 0x00116E, 0x000029, 0x000028, 0x004E00, 0x000029, 0x000028, 0x004E8C, 0x000029,
+	/*  3368 */ 0x000028, 0x004E09, 0x000029, 0x000028, 0x0056DB, 0x000029, 0x000028, 0x004E94,
+	/*  3376 */ 0x000029, 0x000028, 0x00516D, 0x000029, 0x000028, 0x004E03, 0x000029, 0x000028,
+	/*  3384 */ 0x00516B, 0x000029, 0x000028, 0x004E5D, 0x000029, 0x000028, 0x005341, 0x000029,
+	/*  3392 */ 0x000028, 0x006708, 0x000029, 0x000028, 0x00706B, 0x000029, 0x000028, 0x006C34,
+	/*  3400 */ 0x000029, 0x000028, 0x006728, 0x000029, 0x000028, 0x0091D1, 0x000029, 0x000028,
+	/*  3408 */ 0x00571F, 0x000029, 0x000028, 0x0065E5, 0x000029, 0x000028, 0x00682A, 0x000029,
+	/*  3416 */ 0x000028, 0x006709, 0x000029, 0x000028, 0x00793E, 0x000029, 0x000028, 0x00540D,
+	/*  3424 */ 0x000029, 0x000028, 0x007279, 0x000029, 0x000028, 0x008CA1, 0x000029, 0x000028,
+	/*  3432 */ 0x00795D, 0x000029, 0x000028, 0x0052B4, 0x000029, 0x000028, 0x004EE3, 0x000029,
+	/*  3440 */ 0x000028, 0x00547C, 0x000029, 0x000028, 0x005B66, 0x000029, 0x000028, 0x0076E3,
+	/*  3448 */ 0x000029, 0x000028, 0x004F01, 0x000029, 0x000028, 0x008CC7, 0x000029, 0x000028,
+	/*  3456 */ 0x005354, 0x000029, 0x000028, 0x00796D, 0x000029, 0x000028, 0x004F11, 0x000029,
+	/*  3464 */ 0x000028, 0x0081EA, 0x000029, 0x000028, 0x0081F3, 0x000029, 0x00554F, 0x005E7C,
+	/*  3472 */ 0x007B8F, 0x000050, 0x000054, 0x000045, 0x000032, 0x000031, 0x000032, 0x000032,
+	/*  3480 */ 0x000032, 0x000033, 0x000032, 0x000034, 0x000032, 0x000035, 0x000032, 0x000036,
+	/*  3488 */ 0x000032, 0x000037, 0x000032, 0x000038, 0x000032, 0x000039, 0x000033, 0x000030,
+	/*  3496 */ 0x000033, 0x000031, 0x000033, 0x000032, 0x000033, 0x000033, 0x000033, 0x000034,
+	/*  3504 */ 0x000033, 0x000035, 0x001100, 0x001161, 0x001102, 0x001161, 0x001103, 0x001161,
+	/*  3512 */ 0x001105, 0x001161, 0x001106, 0x001161, 0x001107, 0x001161, 0x001109, 0x001161,
+	/*  3520 */ 0x00110B, 0x001161, 0x00110C, 0x001161, 0x00110E, 0x001161, 0x00110F, 0x001161,
+	/*  3528 */ 0x001110, 0x001161, 0x001111, 0x001161, 0x001112, 0x001161, 0x00110E, 0x001161,
+	/*  3536 */ 0x0011B7, 0x001100, 0x001169, 0x00110C, 0x00116E, 0x00110B, 0x001174, 0x00110B,
+	/*  3544 */ 0x00116E, 0x004E94, 0x00516D, 0x004E03, 0x004E5D, 0x00682A, 0x006709, 0x00793E,
+	/*  3552 */ 0x00540D, 0x007279, 0x008CA1, 0x00795D, 0x0052B4, 0x0079D8, 0x007537, 0x009069,
+	/*  3560 */ 0x00512A, 0x005370, 0x006CE8, 0x009805, 0x004F11, 0x005199, 0x006B63, 0x005DE6,
+	/*  3568 */ 0x0053F3, 0x00533B, 0x005B97, 0x005B66, 0x0076E3, 0x004F01, 0x008CC7, 0x005354,
+	/*  3576 */ 0x00591C, 0x000033, 0x000036, 0x000033, 0x000037, 0x000033, 0x000038, 0x000033,
+	/*  3584 */ 0x000039, 0x000034, 0x000030, 0x000034, 0x000031, 0x000034, 0x000032, 0x000034,
+	/*  3592 */ 0x000033, 0x000034, 0x000034, 0x000034, 0x000035, 0x000034, 0x000036, 0x000034,
+	/*  3600 */ 0x000037, 0x000034, 0x000038, 0x000034, 0x000039, 0x000035, 0x000030, 0x000031,
+	/*  3608 */ 0x006708, 0x000032, 0x006708, 0x000033, 0x006708, 0x000034, 0x006708, 0x000035,
+	/*  3616 */ 0x006708, 0x000036, 0x006708, 0x000037, 0x006708, 0x000038, 0x006708, 0x000039,
+	/*  3624 */ 0x006708, 0x000031, 0x000030, 0x006708, 0x000031, 0x000031, 0x006708, 0x000031,
+	/*  3632 */ 0x000032, 0x006708, 0x000048, 0x000067, 0x000065, 0x000072, 0x000067, 0x000065,
+	/*  3640 */ 0x000056, 0x00004C, 0x000054, 0x000044, 0x0030A2, 0x0030A4, 0x0030A6, 0x0030A8,
+	/*  3648 */ 0x0030AA, 0x0030AB, 0x0030AD, 0x0030AF, 0x0030B1, 0x0030B3, 0x0030B5, 0x0030B7,
+	/*  3656 */ 0x0030B9, 0x0030BB, 0x0030BD, 0x0030BF, 0x0030C1, 0x0030C4, 0x0030C6, 0x0030C8,
+	/*  3664 */ 0x0030CA, 0x0030CB, 0x0030CC, 0x0030CD, 0x0030CE, 0x0030CF, 0x0030D2, 0x0030D5,
+	/*  3672 */ 0x0030D8, 0x0030DB, 0x0030DE, 0x0030DF, 0x0030E0, 0x0030E1, 0x0030E2, 0x0030E4,
+	/*  3680 */ 0x0030E6, 0x0030E8, 0x0030E9, 0x0030EA, 0x0030EB, 0x0030EC, 0x0030ED, 0x0030EF,
+	/*  3688 */ 0x0030F0, 0x0030F1, 0x0030F2, 0x0030A2, 0x0030CF, 0x00309A, 0x0030FC, 0x0030C8,
+	/*  3696 */ 0x0030A2, 0x0030EB, 0x0030D5, 0x0030A1, 0x0030A2, 0x0030F3, 0x0030D8, 0x00309A,
+	/*  3704 */ 0x0030A2, 0x0030A2, 0x0030FC, 0x0030EB, 0x0030A4, 0x0030CB, 0x0030F3, 0x0030AF,
+	/*  3712 */ 0x003099, 0x0030A4, 0x0030F3, 0x0030C1, 0x0030A6, 0x0030A9, 0x0030F3, 0x0030A8,
+	/*  3720 */ 0x0030B9, 0x0030AF, 0x0030FC, 0x0030C8, 0x003099, 0x0030A8, 0x0030FC, 0x0030AB,
+	/*  3728 */ 0x0030FC, 0x0030AA, 0x0030F3, 0x0030B9, 0x0030AA, 0x0030FC, 0x0030E0, 0x0030AB,
+	/*  3736 */ 0x0030A4, 0x0030EA, 0x0030AB, 0x0030E9, 0x0030C3, 0x0030C8, 0x0030AB, 0x0030ED,
+	/*  3744 */ 0x0030EA, 0x0030FC, 0x0030AB, 0x003099, 0x0030ED, 0x0030F3, 0x0030AB, 0x003099,
+	/*  3752 */ 0x0030F3, 0x0030DE, 0x0030AD, 0x003099, 0x0030AB, 0x003099, 0x0030AD, 0x003099,
+	/*  3760 */ 0x0030CB, 0x0030FC, 0x0030AD, 0x0030E5, 0x0030EA, 0x0030FC, 0x0030AD, 0x003099,
+	/*  3768 */ 0x0030EB, 0x0030BF, 0x003099, 0x0030FC, 0x0030AD, 0x0030ED, 0x0030AD, 0x0030ED,
+	/*  3776 */ 0x0030AF, 0x003099, 0x0030E9, 0x0030E0, 0x0030AD, 0x0030ED, 0x0030E1, 0x0030FC,
+	/*  3784 */ 0x0030C8, 0x0030EB, 0x0030AD, 0x0030ED, 0x0030EF, 0x0030C3, 0x0030C8, 0x0030AF,
+	/*  3792 */ 0x003099, 0x0030E9, 0x0030E0, 0x0030AF, 0x003099, 0x0030E9, 0x0030E0, 0x0030C8,
+	/*  3800 */ 0x0030F3, 0x0030AF, 0x0030EB, 0x0030BB, 0x003099, 0x0030A4, 0x0030ED, 0x0030AF,
+	/*  3808 */ 0x0030ED, 0x0030FC, 0x0030CD, 0x0030B1, 0x0030FC, 0x0030B9, 0x0030B3, 0x0030EB,
+	/*  3816 */ 0x0030CA, 0x0030B3, 0x0030FC, 0x0030DB, 0x00309A, 0x0030B5, 0x0030A4, 0x0030AF,
+	/*  3824 */ 0x0030EB, 0x0030B5, 0x0030F3, 0x0030C1, 0x0030FC, 0x0030E0, 0x0030B7, 0x0030EA,
+	/*  3832 */ 0x0030F3, 0x0030AF, 0x003099, 0x0030BB, 0x0030F3, 0x0030C1, 0x0030BB, 0x0030F3,
+	/*  3840 */ 0x0030C8, 0x0030BF, 0x003099, 0x0030FC, 0x0030B9, 0x0030C6, 0x003099, 0x0030B7,
+	/*  3848 */ 0x0030C8, 0x003099, 0x0030EB, 0x0030C8, 0x0030F3, 0x0030CA, 0x0030CE, 0x0030CE,
+	/*  3856 */ 0x0030C3, 0x0030C8, 0x0030CF, 0x0030A4, 0x0030C4, 0x0030CF, 0x00309A, 0x0030FC,
+	/*  3864 */ 0x0030BB, 0x0030F3, 0x0030C8, 0x0030CF, 0x00309A, 0x0030FC, 0x0030C4, 0x0030CF,
+	/*  3872 */ 0x003099, 0x0030FC, 0x0030EC, 0x0030EB, 0x0030D2, 0x00309A, 0x0030A2, 0x0030B9,
+	/*  3880 */ 0x0030C8, 0x0030EB, 0x0030D2, 0x00309A, 0x0030AF, 0x0030EB, 0x0030D2, 0x00309A,
+	/*  3888 */ 0x0030B3, 0x0030D2, 0x003099, 0x0030EB, 0x0030D5, 0x0030A1, 0x0030E9, 0x0030C3,
+	/*  3896 */ 0x0030C8, 0x003099, 0x0030D5, 0x0030A3, 0x0030FC, 0x0030C8, 0x0030D5, 0x003099,
+	/*  3904 */ 0x0030C3, 0x0030B7, 0x0030A7, 0x0030EB, 0x0030D5, 0x0030E9, 0x0030F3, 0x0030D8,
+	/*  3912 */ 0x0030AF, 0x0030BF, 0x0030FC, 0x0030EB, 0x0030D8, 0x00309A, 0x0030BD, 0x0030D8,
+	/*  3920 */ 0x00309A, 0x0030CB, 0x0030D2, 0x0030D8, 0x0030EB, 0x0030C4, 0x0030D8, 0x00309A,
+	/*  3928 */ 0x0030F3, 0x0030B9, 0x0030D8, 0x00309A, 0x0030FC, 0x0030B7, 0x003099, 0x0030D8,
+	/*  3936 */ 0x003099, 0x0030FC, 0x0030BF, 0x0030DB, 0x00309A, 0x0030A4, 0x0030F3, 0x0030C8,
+	/*  3944 */ 0x0030DB, 0x003099, 0x0030EB, 0x0030C8, 0x0030DB, 0x0030F3, 0x0030DB, 0x00309A,
+	/*  3952 */ 0x0030F3, 0x0030C8, 0x003099, 0x0030DB, 0x0030FC, 0x0030EB, 0x0030DB, 0x0030FC,
+	/*  3960 */ 0x0030F3, 0x0030DE, 0x0030A4, 0x0030AF, 0x0030ED, 0x0030DE, 0x0030A4, 0x0030EB,
+	/*  3968 */ 0x0030DE, 0x0030C3, 0x0030CF, 0x0030DE, 0x0030EB, 0x0030AF, 0x0030DE, 0x0030F3,
+	/*  3976 */ 0x0030B7, 0x0030E7, 0x0030F3, 0x0030DF, 0x0030AF, 0x0030ED, 0x0030F3, 0x0030DF,
+	/*  3984 */ 0x0030EA, 0x0030DF, 0x0030EA, 0x0030CF, 0x003099, 0x0030FC, 0x0030EB, 0x0030E1,
+	/*  3992 */ 0x0030AB, 0x003099, 0x0030E1, 0x0030AB, 0x003099, 0x0030C8, 0x0030F3, 0x0030E1,
+	/*  4000 */ 0x0030FC, 0x0030C8, 0x0030EB, 0x0030E4, 0x0030FC, 0x0030C8, 0x003099, 0x0030E4,
+	/*  4008 */ 0x0030FC, 0x0030EB, 0x0030E6, 0x0030A2, 0x0030F3, 0x0030EA, 0x0030C3, 0x0030C8,
+	/*  4016 */ 0x0030EB, 0x0030EA, 0x0030E9, 0x0030EB, 0x0030D2, 0x00309A, 0x0030FC, 0x0030EB,
+	/*  4024 */ 0x0030FC, 0x0030D5, 0x003099, 0x0030EB, 0x0030EC, 0x0030E0, 0x0030EC, 0x0030F3,
+	/*  4032 */ 0x0030C8, 0x0030B1, 0x003099, 0x0030F3, 0x0030EF, 0x0030C3, 0x0030C8, 0x000030,
+	/*  4040 */ 0x0070B9, 0x000031, 0x0070B9, 0x000032, 0x0070B9, 0x000033, 0x0070B9, 0x000034,
+	/*  4048 */ 0x0070B9, 0x000035, 0x0070B9, 0x000036, 0x0070B9, 0x000037, 0x0070B9, 0x000038,
+	/*  4056 */ 0x0070B9, 0x000039, 0x0070B9, 0x000031, 0x000030, 0x0070B9, 0x000031, 0x000031,
+	/*  4064 */ 0x0070B9, 0x000031, 0x000032, 0x0070B9, 0x000031, 0x000033, 0x0070B9, 0x000031,
+	/*  4072 */ 0x000034, 0x0070B9, 0x000031, 0x000035, 0x0070B9, 0x000031, 0x000036, 0x0070B9,
+	/*  4080 */ 0x000031, 0x000037, 0x0070B9, 0x000031, 0x000038, 0x0070B9, 0x000031, 0x000039,
+	/*  4088 */ 0x0070B9, 0x000032, 0x000030, 0x0070B9, 0x000032, 0x000031, 0x0070B9, 0x000032,
+	/*  4096 */ 0x000032, 0x0070B9, 0x000032, 0x000033, 0x0070B9, 0x000032, 0x000034, 0x0070B9,
+	/*  4104 */ 0x000068, 0x000050, 0x000061, 0x000064, 0x000061, 0x000041, 0x000055, 0x000062,
+	/*  4112 */ 0x000061, 0x000072, 0x00006F, 0x000056, 0x000070, 0x000063, 0x000064, 0x00006D,
+	/*  4120 */ 0x000064, 0x00006D, 0x000032, 0x000064, 0x00006D, 0x000033, 0x000049, 0x000055,
+	/*  4128 */ 0x005E73, 0x006210, 0x00662D, 0x00548C, 0x005927, 0x006B63, 0x00660E, 0x006CBB,
+	/*  4136 */ 0x00682A, 0x005F0F, 0x004F1A, 0x00793E, 0x000070, 0x000041, 0x00006E, 0x000041,
+	/*  4144 */ 0x0003BC, 0x000041, 0x00006D, 0x000041, 0x00006B, 0x000041, 0x00004B, 0x000042,
+	/*  4152 */ 0x00004D, 0x000042, 0x000047, 0x000042, 0x000063, 0x000061, 0x00006C, 0x00006B,
+	/*  4160 */ 0x000063, 0x000061, 0x00006C, 0x000070, 0x000046, 0x00006E, 0x000046, 0x0003BC,
+	/*  4168 */ 0x000046, 0x0003BC, 0x000067, 0x00006D, 0x000067, 0x00006B, 0x000067, 0x000048,
+	/*  4176 */ 0x00007A, 0x00006B, 0x000048, 0x00007A, 0x00004D, 0x000048, 0x00007A, 0x000047,
+	/*  4184 */ 0x000048, 0x00007A, 0x000054, 0x000048, 0x00007A, 0x0003BC, 0x00006C, 0x00006D,
+	/*  4192 */ 0x00006C, 0x000064, 0x00006C, 0x00006B, 0x00006C, 0x000066, 0x00006D, 0x00006E,
+	/*  4200 */ 0x00006D, 0x0003BC, 0x00006D, 0x00006D, 0x00006D, 0x000063, 0x00006D, 0x00006B,
+	/*  4208 */ 0x00006D, 0x00006D, 0x00006D, 0x000032, 0x000063, 0x00006D, 0x000032, 0x00006D,
+	/*  4216 */ 0x000032, 0x00006B, 0x00006D, 0x000032, 0x00006D, 0x00006D, 0x000033, 0x000063,
+	/*  4224 */ 0x00006D, 0x000033, 0x00006D, 0x000033, 0x00006B, 0x00006D, 0x000033, 0x00006D,
+	/*  4232 */ 0x002215, 0x000073, 0x00006D, 0x002215, 0x000073, 0x000032, 0x000050, 0x000061,
+	/*  4240 */ 0x00006B, 0x000050, 0x000061, 0x00004D, 0x000050, 0x000061, 0x000047, 0x000050,
+	/*  4248 */ 0x000061, 0x000072, 0x000061, 0x000064, 0x000072, 0x000061, 0x000064, 0x002215,
+	/*  4256 */ 0x000073, 0x000072, 0x000061, 0x000064, 0x002215, 0x000073, 0x000032, 0x000070,
+	/*  4264 */ 0x000073, 0x00006E, 0x000073, 0x0003BC, 0x000073, 0x00006D, 0x000073, 0x000070,
+	/*  4272 */ 0x000056, 0x00006E, 0x000056, 0x0003BC, 0x000056, 0x00006D, 0x000056, 0x00006B,
+	/*  4280 */ 0x000056, 0x00004D, 0x000056, 0x000070, 0x000057, 0x00006E, 0x000057, 0x0003BC,
+	/*  4288 */ 0x000057, 0x00006D, 0x000057, 0x00006B, 0x000057, 0x00004D, 0x000057, 0x00006B,
+	/*  4296 */ 0x0003A9, 0x00004D, 0x0003A9, 0x000061, 0x00002E, 0x00006D, 0x00002E, 0x000042,
+	/*  4304 */ 0x000071, 0x000063, 0x000063, 0x000063, 0x000064, 0x000043, 0x002215, 0x00006B,
+	/*  4312 */ 0x000067, 0x000043, 0x00006F, 0x00002E, 0x000064, 0x000042, 0x000047, 0x000079,
+	/*  4320 */ 0x000068, 0x000061, 0x000048, 0x000050, 0x000069, 0x00006E, 0x00004B, 0x00004B,
+	/*  4328 */ 0x00004B, 0x00004D, 0x00006B, 0x000074, 0x00006C, 0x00006D, 0x00006C, 0x00006E,
+	/*  4336 */ 0x00006C, 0x00006F, 0x000067, 0x00006C, 0x000078, 0x00006D, 0x000062, 0x00006D,
+	/*  4344 */ 0x000069, 0x00006C, 0x00006D, 0x00006F, 0x00006C, 0x000050, 0x000048, 0x000070,
+	/*  4352 */ 0x00002E, 0x00006D, 0x00002E, 0x000050, 0x000050, 0x00004D, 0x000050, 0x000052,
+	/*  4360 */ 0x000073, 0x000072, 0x000053, 0x000076, 0x000057, 0x000062, 0x000056, 0x002215,
+	/*  4368 */ 0x00006D, 0x000041, 0x002215, 0x00006D, 0x000031, 0x0065E5, 0x000032, 0x0065E5,
+	/*  4376 */ 0x000033, 0x0065E5, 0x000034, 0x0065E5, 0x000035, 0x0065E5, 0x000036, 0x0065E5,
+	/*  4384 */ 0x000037, 0x0065E5, 0x000038, 0x0065E5, 0x000039, 0x0065E5, 0x000031, 0x000030,
+	/*  4392 */ 0x0065E5, 0x000031, 0x000031, 0x0065E5, 0x000031, 0x000032, 0x0065E5, 0x000031,
+	/*  4400 */ 0x000033, 0x0065E5, 0x000031, 0x000034, 0x0065E5, 0x000031, 0x000035, 0x0065E5,
+	/*  4408 */ 0x000031, 0x000036, 0x0065E5, 0x000031, 0x000037, 0x0065E5, 0x000031, 0x000038,
+	/*  4416 */ 0x0065E5, 0x000031, 0x000039, 0x0065E5, 0x000032, 0x000030, 0x0065E5, 0x000032,
+	/*  4424 */ 0x000031, 0x0065E5, 0x000032, 0x000032, 0x0065E5, 0x000032, 0x000033, 0x0065E5,
+	/*  4432 */ 0x000032, 0x000034, 0x0065E5, 0x000032, 0x000035, 0x0065E5, 0x000032, 0x000036,
+	/*  4440 */ 0x0065E5, 0x000032, 0x000037, 0x0065E5, 0x000032, 0x000038, 0x0065E5, 0x000032,
+	/*  4448 */ 0x000039, 0x0065E5, 0x000033, 0x000030, 0x0065E5, 0x000033, 0x000031, 0x0065E5,
+	/*  4456 */ 0x000067, 0x000061, 0x00006C, 0x00044A, 0x00044C, 0x00A76F, 0x000126, 0x000153,
+	/*  4464 */ 0x00A727, 0x00AB37, 0x00026B, 0x00AB52, 0x008C48, 0x0066F4, 0x008CC8, 0x006ED1,
+	/*  4472 */ 0x004E32, 0x0053E5, 0x005951, 0x005587, 0x005948, 0x0061F6, 0x007669, 0x007F85,
+	/*  4480 */ 0x00863F, 0x0087BA, 0x0088F8, 0x00908F, 0x006A02, 0x006D1B, 0x0070D9, 0x0073DE,
+	/*  4488 */ 0x00843D, 0x00916A, 0x0099F1, 0x004E82, 0x005375, 0x006B04, 0x00721B, 0x00862D,
+	/*  4496 */ 0x009E1E, 0x005D50, 0x006FEB, 0x0085CD, 0x008964, 0x0062C9, 0x0081D8, 0x00881F,
+	/*  4504 */ 0x005ECA, 0x006717, 0x006D6A, 0x0072FC, 0x0090CE, 0x004F86, 0x0051B7, 0x0052DE,
+	/*  4512 */ 0x0064C4, 0x006AD3, 0x007210, 0x0076E7, 0x008606, 0x00865C, 0x008DEF, 0x009732,
+	/*  4520 */ 0x009B6F, 0x009DFA, 0x00788C, 0x00797F, 0x007DA0, 0x0083C9, 0x009304, 0x008AD6,
+	/*  4528 */ 0x0058DF, 0x005F04, 0x007C60, 0x00807E, 0x007262, 0x0078CA, 0x008CC2, 0x0096F7,
+	/*  4536 */ 0x0058D8, 0x005C62, 0x006A13, 0x006DDA, 0x006F0F, 0x007D2F, 0x007E37, 0x00964B,
+	/*  4544 */ 0x0052D2, 0x00808B, 0x0051DC, 0x0051CC, 0x007A1C, 0x007DBE, 0x0083F1, 0x009675,
+	/*  4552 */ 0x008B80, 0x0062CF, 0x008AFE, 0x004E39, 0x005BE7, 0x006012, 0x007387, 0x007570,
+	/*  4560 */ 0x005317, 0x0078FB, 0x004FBF, 0x005FA9, 0x004E0D, 0x006CCC, 0x006578, 0x007D22,
+	/*  4568 */ 0x0053C3, 0x00585E, 0x007701, 0x008449, 0x008AAA, 0x006BBA, 0x006C88, 0x0062FE,
+	/*  4576 */ 0x0082E5, 0x0063A0, 0x007565, 0x004EAE, 0x005169, 0x0051C9, 0x006881, 0x007CE7,
+	/*  4584 */ 0x00826F, 0x008AD2, 0x0091CF, 0x0052F5, 0x005442, 0x005EEC, 0x0065C5, 0x006FFE,
+	/*  4592 */ 0x00792A, 0x0095AD, 0x009A6A, 0x009E97, 0x009ECE, 0x0066C6, 0x006B77, 0x008F62,
+	/*  4600 */ 0x005E74, 0x006190, 0x006200, 0x00649A, 0x006F23, 0x007149, 0x007489, 0x0079CA,
+	/*  4608 */ 0x007DF4, 0x00806F, 0x008F26, 0x0084EE, 0x009023, 0x00934A, 0x005217, 0x0052A3,
+	/*  4616 */ 0x0054BD, 0x0070C8, 0x0088C2, 0x005EC9, 0x005FF5, 0x00637B, 0x006BAE, 0x007C3E,
+	/*  4624 */ 0x007375, 0x004EE4, 0x0056F9, 0x005DBA, 0x00601C, 0x0073B2, 0x007469, 0x007F9A,
+	/*  4632 */ 0x008046, 0x009234, 0x0096F6, 0x009748, 0x009818, 0x004F8B, 0x0079AE, 0x0091B4,
+	/*  4640 */ 0x0096B8, 0x0060E1, 0x004E86, 0x0050DA, 0x005BEE, 0x005C3F, 0x006599, 0x0071CE,
+	/*  4648 */ 0x007642, 0x0084FC, 0x00907C, 0x006688, 0x00962E, 0x005289, 0x00677B, 0x0067F3,
+	/*  4656 */ 0x006D41, 0x006E9C, 0x007409, 0x007559, 0x00786B, 0x007D10, 0x00985E, 0x00622E,
+	/*  4664 */ 0x009678, 0x00502B, 0x005D19, 0x006DEA, 0x008F2A, 0x005F8B, 0x006144, 0x006817,
+	/*  4672 */ 0x009686, 0x005229, 0x00540F, 0x005C65, 0x006613, 0x00674E, 0x0068A8, 0x006CE5,
+	/*  4680 */ 0x007406, 0x0075E2, 0x007F79, 0x0088CF, 0x0088E1, 0x0096E2, 0x00533F, 0x006EBA,
+	/*  4688 */ 0x00541D, 0x0071D0, 0x007498, 0x0085FA, 0x0096A3, 0x009C57, 0x009E9F, 0x006797,
+	/*  4696 */ 0x006DCB, 0x0081E8, 0x007B20, 0x007C92, 0x0072C0, 0x007099, 0x008B58, 0x004EC0,
+	/*  4704 */ 0x008336, 0x00523A, 0x005207, 0x005EA6, 0x0062D3, 0x007CD6, 0x005B85, 0x006D1E,
+	/*  4712 */ 0x0066B4, 0x008F3B, 0x00964D, 0x005ED3, 0x005140, 0x0055C0, 0x00585A, 0x006674,
+	/*  4720 */ 0x0051DE, 0x00732A, 0x0076CA, 0x00793C, 0x00795E, 0x007965, 0x00798F, 0x009756,
+	/*  4728 */ 0x007CBE, 0x008612, 0x008AF8, 0x009038, 0x0090FD, 0x0098EF, 0x0098FC, 0x009928,
+	/*  4736 */ 0x009DB4, 0x0090DE, 0x0096B7, 0x004FAE, 0x0050E7, 0x00514D, 0x0052C9, 0x0052E4,
+	/*  4744 */ 0x005351, 0x00559D, 0x005606, 0x005668, 0x005840, 0x0058A8, 0x005C64, 0x006094,
+	/*  4752 */ 0x006168, 0x00618E, 0x0061F2, 0x00654F, 0x0065E2, 0x006691, 0x006885, 0x006D77,
+	/*  4760 */ 0x006E1A, 0x006F22, 0x00716E, 0x00722B, 0x007422, 0x007891, 0x007949, 0x007948,
+	/*  4768 */ 0x007950, 0x007956, 0x00798D, 0x00798E, 0x007A40, 0x007A81, 0x007BC0, 0x007E09,
+	/*  4776 */ 0x007E41, 0x007F72, 0x008005, 0x0081ED, 0x008279, 0x008457, 0x008910, 0x008996,
+	/*  4784 */ 0x008B01, 0x008B39, 0x008CD3, 0x008D08, 0x008FB6, 0x0096E3, 0x0097FF, 0x00983B,
+	/*  4792 */ 0x006075, 0x0242EE, 0x008218, 0x004E26, 0x0051B5, 0x005168, 0x004F80, 0x005145,
+	/*  4800 */ 0x005180, 0x0052C7, 0x0052FA, 0x005555, 0x005599, 0x0055E2, 0x0058B3, 0x005944,
+	/*  4808 */ 0x005954, 0x005A62, 0x005B28, 0x005ED2, 0x005ED9, 0x005F69, 0x005FAD, 0x0060D8,
+	/*  4816 */ 0x00614E, 0x006108, 0x006160, 0x006234, 0x0063C4, 0x00641C, 0x006452, 0x006556,
+	/*  4824 */ 0x00671B, 0x006756, 0x006EDB, 0x006ECB, 0x00701E, 0x0077A7, 0x007235, 0x0072AF,
+	/*  4832 */ 0x007471, 0x007506, 0x00753B, 0x00761D, 0x00761F, 0x0076DB, 0x0076F4, 0x00774A,
+	/*  4840 */ 0x007740, 0x0078CC, 0x007AB1, 0x007C7B, 0x007D5B, 0x007F3E, 0x008352, 0x0083EF,
+	/*  4848 */ 0x008779, 0x008941, 0x008986, 0x008ABF, 0x008ACB, 0x008AED, 0x008B8A, 0x008F38,
+	/*  4856 */ 0x009072, 0x009199, 0x009276, 0x00967C, 0x0097DB, 0x00980B, 0x009B12, 0x02284A,
+	/*  4864 */ 0x022844, 0x0233D5, 0x003B9D, 0x004018, 0x004039, 0x025249, 0x025CD0, 0x027ED3,
+	/*  4872 */ 0x009F43, 0x009F8E, 0x000066, 0x000066, 0x000066, 0x000069, 0x000066, 0x00006C,
+	/*  4880 */ 0x000066, 0x000066, 0x000069, 0x000066, 0x000066, 0x00006C, 0x000073, 0x000074,
+	/*  4888 */ 0x000574, 0x000576, 0x000574, 0x000565, 0x000574, 0x00056B, 0x00057E, 0x000576,
+	/*  4896 */ 0x000574, 0x00056D, 0x0005D9, 0x0005B4, 0x0005F2, 0x0005B7, 0x0005E2, 0x0005D4,
+	/*  4904 */ 0x0005DB, 0x0005DC, 0x0005DD, 0x0005E8, 0x0005EA, 0x0005E9, 0x0005C1, 0x0005E9,
+	/*  4912 */ 0x0005C2, 0x0005E9, 0x0005BC, 0x0005C1, 0x0005E9, 0x0005BC, 0x0005C2, 0x0005D0,
+	/*  4920 */ 0x0005B7, 0x0005D0, 0x0005B8, 0x0005D0, 0x0005BC, 0x0005D1, 0x0005BC, 0x0005D2,
+	/*  4928 */ 0x0005BC, 0x0005D3, 0x0005BC, 0x0005D4, 0x0005BC, 0x0005D5, 0x0005BC, 0x0005D6,
+	/*  4936 */ 0x0005BC, 0x0005D8, 0x0005BC, 0x0005D9, 0x0005BC, 0x0005DA, 0x0005BC, 0x0005DB,
+	/*  4944 */ 0x0005BC, 0x0005DC, 0x0005BC, 0x0005DE, 0x0005BC, 0x0005E0, 0x0005BC, 0x0005E1,
+	/*  4952 */ 0x0005BC, 0x0005E3, 0x0005BC, 0x0005E4, 0x0005BC, 0x0005E6, 0x0005BC, 0x0005E7,
+	/*  4960 */ 0x0005BC, 0x0005E8, 0x0005BC, 0x0005E9, 0x0005BC, 0x0005EA, 0x0005BC, 0x0005D5,
+	/*  4968 */ 0x0005B9, 0x0005D1, 0x0005BF, 0x0005DB, 0x0005BF, 0x0005E4, 0x0005BF, 0x0005D0,
+	/*  4976 */ 0x0005DC, 0x000671, 0x00067B, 0x00067E, 0x000680, 0x00067A, 0x00067F, 0x000679,
+	/*  4984 */ 0x0006A4, 0x0006A6, 0x000684, 0x000683, 0x000686, 0x000687, 0x00068D, 0x00068C,
+	/*  4992 */ 0x00068E, 0x000688, 0x000698, 0x000691, 0x0006A9, 0x0006AF, 0x0006B3, 0x0006B1,
+	/*  5000 */ 0x0006BA, 0x0006BB, 0x0006C1, 0x0006BE, 0x0006D2, 0x0006AD, 0x0006C7, 0x0006C6,
+	/*  5008 */ 0x0006C8, 0x0006CB, 0x0006C5, 0x0006C9, 0x0006D0, 0x000649, 0x00064A, 0x000654,
+	/*  5016 */ 0x000627, 0x00064A, 0x000654, 0x0006D5, 0x00064A, 0x000654, 0x000648, 0x00064A,
+	/*  5024 */ 0x000654, 0x0006C7, 0x00064A, 0x000654, 0x0006C6, 0x00064A, 0x000654, 0x0006C8,
+	/*  5032 */ 0x00064A, 0x000654, 0x0006D0, 0x00064A, 0x000654, 0x000649, 0x0006CC, 0x00064A,
+	/*  5040 */ 0x000654, 0x00062C, 0x00064A, 0x000654, 0x00062D, 0x00064A, 0x000654, 0x000645,
+	/*  5048 */ 0x00064A, 0x000654, 0x00064A, 0x000628, 0x00062C, 0x000628, 0x00062D, 0x000628,
+	/*  5056 */ 0x00062E, 0x000628, 0x000645, 0x000628, 0x000649, 0x000628, 0x00064A, 0x00062A,
+	/*  5064 */ 0x00062C, 0x00062A, 0x00062D, 0x00062A, 0x00062E, 0x00062A, 0x000645, 0x00062A,
+	/*  5072 */ 0x000649, 0x00062A, 0x00064A, 0x00062B, 0x00062C, 0x00062B, 0x000645, 0x00062B,
+	/*  5080 */ 0x000649, 0x00062B, 0x00064A, 0x00062C, 0x00062D, 0x00062C, 0x000645, 0x00062D,
+	/*  5088 */ 0x00062C, 0x00062D, 0x000645, 0x00062E, 0x00062C, 0x00062E, 0x00062D, 0x00062E,
+	/*  5096 */ 0x000645, 0x000633, 0x00062C, 0x000633, 0x00062D, 0x000633, 0x00062E, 0x000633,
+	/*  5104 */ 0x000645, 0x000635, 0x00062D, 0x000635, 0x000645, 0x000636, 0x00062C, 0x000636,
+	/*  5112 */ 0x00062D, 0x000636, 0x00062E, 0x000636, 0x000645, 0x000637, 0x00062D, 0x000637,
+	/*  5120 */ 0x000645, 0x000638, 0x000645, 0x000639, 0x00062C, 0x000639, 0x000645, 0x00063A,
+	/*  5128 */ 0x00062C, 0x00063A, 0x000645, 0x000641, 0x00062C, 0x000641, 0x00062D, 0x000641,
+	/*  5136 */ 0x00062E, 0x000641, 0x000645, 0x000641, 0x000649, 0x000641, 0x00064A, 0x000642,
+	/*  5144 */ 0x00062D, 0x000642, 0x000645, 0x000642, 0x000649, 0x000642, 0x00064A, 0x000643,
+	/*  5152 */ 0x000627, 0x000643, 0x00062C, 0x000643, 0x00062D, 0x000643, 0x00062E, 0x000643,
+	/*  5160 */ 0x000644, 0x000643, 0x000645, 0x000643, 0x000649, 0x000643, 0x00064A, 0x000644,
+	/*  5168 */ 0x00062C, 0x000644, 0x00062D, 0x000644, 0x00062E, 0x000644, 0x000645, 0x000644,
+	/*  5176 */ 0x000649, 0x000644, 0x00064A, 0x000645, 0x00062C, 0x000645, 0x00062D, 0x000645,
+	/*  5184 */ 0x00062E, 0x000645, 0x000645, 0x000645, 0x000649, 0x000645, 0x00064A, 0x000646,
+	/*  5192 */ 0x00062C, 0x000646, 0x00062D, 0x000646, 0x00062E, 0x000646, 0x000645, 0x000646,
+	/*  5200 */ 0x000649, 0x000646, 0x00064A, 0x000647, 0x00062C, 0x000647, 0x000645, 0x000647,
+	/*  5208 */ 0x000649, 0x000647, 0x00064A, 0x00064A, 0x00062C, 0x00064A, 0x00062D, 0x00064A,
+	/*  5216 */ 0x00062E, 0x00064A, 0x000645, 0x00064A, 0x000649, 0x00064A, 0x00064A, 0x000630,
+	/*  5224 */ 0x000670, 0x000631, 0x000670, 0x000649, 0x000670, 0x000020, 0x00064C, 0x000651,
+	/*  5232 */ 0x000020, 0x00064D, 0x000651, 0x000020, 0x00064E, 0x000651, 0x000020, 0x00064F,
+	/*  5240 */ 0x000651, 0x000020, 0x000650, 0x000651, 0x000020, 0x000651, 0x000670, 0x00064A,
+	/*  5248 */ 0x000654, 0x000631, 0x00064A, 0x000654, 0x000632, 0x00064A, 0x000654, 0x000646,
+	/*  5256 */ 0x000628, 0x000631, 0x000628, 0x000632, 0x000628, 0x000646, 0x00062A, 0x000631,
+	/*  5264 */ 0x00062A, 0x000632, 0x00062A, 0x000646, 0x00062B, 0x000631, 0x00062B, 0x000632,
+	/*  5272 */ 0x00062B, 0x000646, 0x000645, 0x000627, 0x000646, 0x000631, 0x000646, 0x000632,
+	/*  5280 */ 0x000646, 0x000646, 0x00064A, 0x000631, 0x00064A, 0x000632, 0x00064A, 0x000646,
+	/*  5288 */ 0x00064A, 0x000654, 0x00062E, 0x00064A, 0x000654, 0x000647, 0x000628, 0x000647,
+	/*  5296 */ 0x00062A, 0x000647, 0x000635, 0x00062E, 0x000644, 0x000647, 0x000646, 0x000647,
+	/*  5304 */ 0x000647, 0x000670, 0x00064A, 0x000647, 0x00062B, 0x000647, 0x000633, 0x000647,
+	/*  5312 */ 0x000634, 0x000645, 0x000634, 0x000647, 0x000640, 0x00064E, 0x000651, 0x000640,
+	/*  5320 */ 0x00064F, 0x000651, 0x000640, 0x000650, 0x000651, 0x000637, 0x000649, 0x000637,
+	/*  5328 */ 0x00064A, 0x000639, 0x000649, 0x000639, 0x00064A, 0x00063A, 0x000649, 0x00063A,
+	/*  5336 */ 0x00064A, 0x000633, 0x000649, 0x000633, 0x00064A, 0x000634, 0x000649, 0x000634,
+	/*  5344 */ 0x00064A, 0x00062D, 0x000649, 0x00062D, 0x00064A, 0x00062C, 0x000649, 0x00062C,
+	/*  5352 */ 0x00064A, 0x00062E, 0x000649, 0x00062E, 0x00064A, 0x000635, 0x000649, 0x000635,
+	/*  5360 */ 0x00064A, 0x000636, 0x000649, 0x000636, 0x00064A, 0x000634, 0x00062C, 0x000634,
+	/*  5368 */ 0x00062D, 0x000634, 0x00062E, 0x000634, 0x000631, 0x000633, 0x000631, 0x000635,
+	/*  5376 */ 0x000631, 0x000636, 0x000631, 0x000627, 0x00064B, 0x00062A, 0x00062C, 0x000645,
+	/*  5384 */ 0x00062A, 0x00062D, 0x00062C, 0x00062A, 0x00062D, 0x000645, 0x00062A, 0x00062E,
+	/*  5392 */ 0x000645, 0x00062A, 0x000645, 0x00062C, 0x00062A, 0x000645, 0x00062D, 0x00062A,
+	/*  5400 */ 0x000645, 0x00062E, 0x00062C, 0x000645, 0x00062D, 0x00062D, 0x000645, 0x00064A,
+	/*  5408 */ 0x00062D, 0x000645, 0x000649, 0x000633, 0x00062D, 0x00062C, 0x000633, 0x00062C,
+	/*  5416 */ 0x00062D, 0x000633, 0x00062C, 0x000649, 0x000633, 0x000645, 0x00062D, 0x000633,
+	/*  5424 */ 0x000645, 0x00062C, 0x000633, 0x000645, 0x000645, 0x000635, 0x00062D, 0x00062D,
+	/*  5432 */ 0x000635, 0x000645, 0x000645, 0x000634, 0x00062D, 0x000645, 0x000634, 0x00062C,
+	/*  5440 */ 0x00064A, 0x000634, 0x000645, 0x00062E, 0x000634, 0x000645, 0x000645, 0x000636,
+	/*  5448 */ 0x00062D, 0x000649, 0x000636, 0x00062E, 0x000645, 0x000637, 0x000645, 0x00062D,
+	/*  5456 */ 0x000637, 0x000645, 0x000645, 0x000637, 0x000645, 0x00064A, 0x000639, 0x00062C,
+	/*  5464 */ 0x000645, 0x000639, 0x000645, 0x000645, 0x000639, 0x000645, 0x000649, 0x00063A,
+	/*  5472 */ 0x000645, 0x000645, 0x00063A, 0x000645, 0x00064A, 0x00063A, 0x000645, 0x000649,
+	/*  5480 */ 0x000641, 0x00062E, 0x000645, 0x000642, 0x000645, 0x00062D, 0x000642, 0x000645,
+	/*  5488 */ 0x000645, 0x000644, 0x00062D, 0x000645, 0x000644, 0x00062D, 0x00064A, 0x000644,
+	/*  5496 */ 0x00062D, 0x000649, 0x000644, 0x00062C, 0x00062C, 0x000644, 0x00062E, 0x000645,
+	/*  5504 */ 0x000644, 0x000645, 0x00062D, 0x000645, 0x00062D, 0x00062C, 0x000645, 0x00062D,
+	/*  5512 */ 0x000645, 0x000645, 0x00062D, 0x00064A, 0x000645, 0x00062C, 0x00062D, 0x000645,
+	/*  5520 */ 0x00062C, 0x000645, 0x000645, 0x00062E, 0x00062C, 0x000645, 0x00062E, 0x000645,
+	/*  5528 */ 0x000645, 0x00062C, 0x00062E, 0x000647, 0x000645, 0x00062C, 0x000647, 0x000645,
+	/*  5536 */ 0x000645, 0x000646, 0x00062D, 0x000645, 0x000646, 0x00062D, 0x000649, 0x000646,
+	/*  5544 */ 0x00062C, 0x000645, 0x000646, 0x00062C, 0x000649, 0x000646, 0x000645, 0x00064A,
+	/*  5552 */ 0x000646, 0x000645, 0x000649, 0x00064A, 0x000645, 0x000645, 0x000628, 0x00062E,
+	/*  5560 */ 0x00064A, 0x00062A, 0x00062C, 0x00064A, 0x00062A, 0x00062C, 0x000649, 0x00062A,
+	/*  5568 */ 0x00062E, 0x00064A, 0x00062A, 0x00062E, 0x000649, 0x00062A, 0x000645, 0x00064A,
+	/*  5576 */ 0x00062A, 0x000645, 0x000649, 0x00062C, 0x000645, 0x00064A, 0x00062C, 0x00062D,
+	/*  5584 */ 0x000649, 0x00062C, 0x000645, 0x000649, 0x000633, 0x00062E, 0x000649, 0x000635,
+	/*  5592 */ 0x00062D, 0x00064A, 0x000634, 0x00062D, 0x00064A, 0x000636, 0x00062D, 0x00064A,
+	/*  5600 */ 0x000644, 0x00062C, 0x00064A, 0x000644, 0x000645, 0x00064A, 0x00064A, 0x00062D,
+	/*  5608 */ 0x00064A, 0x00064A, 0x00062C, 0x00064A, 0x00064A, 0x000645, 0x00064A, 0x000645,
+	/*  5616 */ 0x000645, 0x00064A, 0x000642, 0x000645, 0x00064A, 0x000646, 0x00062D, 0x00064A,
+	/*  5624 */ 0x000639, 0x000645, 0x00064A, 0x000643, 0x000645, 0x00064A, 0x000646, 0x00062C,
+	/*  5632 */ 0x00062D, 0x000645, 0x00062E, 0x00064A, 0x000644, 0x00062C, 0x000645, 0x000643,
+	/*  5640 */ 0x000645, 0x000645, 0x00062C, 0x00062D, 0x00064A, 0x00062D, 0x00062C, 0x00064A,
+	/*  5648 */ 0x000645, 0x00062C, 0x00064A, 0x000641, 0x000645, 0x00064A, 0x000628, 0x00062D,
+	/*  5656 */ 0x00064A, 0x000633, 0x00062E, 0x00064A, 0x000646, 0x00062C, 0x00064A, 0x000635,
+	/*  5664 */ 0x000644, 0x0006D2, 0x000642, 0x000644, 0x0006D2, 0x000627, 0x000644, 0x000644,
+	/*  5672 */ 0x000647, 0x000627, 0x000643, 0x000628, 0x000631, 0x000645, 0x00062D, 0x000645,
+	/*  5680 */ 0x00062F, 0x000635, 0x000644, 0x000639, 0x000645, 0x000631, 0x000633, 0x000648,
+	/*  5688 */ 0x000644, 0x000639, 0x000644, 0x00064A, 0x000647, 0x000648, 0x000633, 0x000644,
+	/*  5696 */ 0x000645, 0x000635, 0x000644, 0x000649, 0x000635, 0x000644, 0x000649, 0x000020,
+	/*  5704 */ 0x000627, 0x000644, 0x000644, 0x000647, 0x000020, 0x000639, 0x000644, 0x00064A,
+	/*  5712 */ 0x000647, 0x000020, 0x000648, 0x000633, 0x000644, 0x000645, 0x00062C, 0x000644,
+	/*  5720 */ 0x000020, 0x00062C, 0x000644, 0x000627, 0x000644, 0x000647, 0x000631, 0x0006CC,
+	/*  5728 */ 0x000627, 0x000644, 0x00002C, 0x003001, 0x003002, 0x00003A, 0x000021, 0x00003F,
+	/*  5736 */ 0x003016, 0x003017, 0x002014, 0x002013, 0x00005F, 0x00007B, 0x00007D, 0x003014,
+	/*  5744 */ 0x003015, 0x003010, 0x003011, 0x00300A, 0x00300B, 0x00300C, 0x00300D, 0x00300E,
+	/*  5752 */ 0x00300F, 0x00005B, 0x00005D, 0x000023, 0x000026, 0x00002A, 0x00002D, 0x00003C,
+	/*  5760 */ 0x00003E, 0x00005C, 0x000024, 0x000025, 0x000040, 0x000020, 0x00064B, 0x000640,
+	/*  5768 */ 0x00064B, 0x000020, 0x00064C, 0x000020, 0x00064D, 0x000020, 0x00064E, 0x000640,
+	/*  5776 */ 0x00064E, 0x000020, 0x00064F, 0x000640, 0x00064F, 0x000020, 0x000650, 0x000640,
+	/*  5784 */ 0x000650, 0x000020, 0x000651, 0x000640, 0x000651, 0x000020, 0x000652, 0x000640,
+	/*  5792 */ 0x000652, 0x000621, 0x000627, 0x000628, 0x000629, 0x00062A, 0x00062B, 0x00062C,
+	/*  5800 */ 0x00062D, 0x00062E, 0x00062F, 0x000630, 0x000631, 0x000632, 0x000633, 0x000634,
+	/*  5808 */ 0x000635, 0x000636, 0x000637, 0x000638, 0x000639, 0x00063A, 0x000641, 0x000642,
+	/*  5816 */ 0x000643, 0x000644, 0x000645, 0x000646, 0x000647, 0x000648, 0x00064A, 0x000644,
+	/*  5824 */ 0x000627, 0x000653, 0x000644, 0x000627, 0x000654, 0x000644, 0x000627, 0x000655,
+	/*  5832 */ 0x000644, 0x000627, 0x000022, 0x000027, 0x00002F, 0x00005E, 0x00007C, 0x00007E,
+	/*  5840 */ 0x002985, 0x002986, 0x0030FB, 0x0030A1, 0x0030A3, 0x0030A5, 0x0030A7, 0x0030A9,
+	/*  5848 */ 0x0030E3, 0x0030E5, 0x0030E7, 0x0030C3, 0x0030FC, 0x0030F3, 0x003099, 0x00309A,
+	/*  5856 */ 0x0000A2, 0x0000A3, 0x0000AC, 0x0000A6, 0x0000A5, 0x0020A9, 0x002502, 0x002190,
+	/*  5864 */ 0x002191, 0x002192, 0x002193, 0x0025A0, 0x0025CB, 0x011099, 0x0110BA, 0x01109B,
+	/*  5872 */ 0x0110BA, 0x0110A5, 0x0110BA, 0x011131, 0x011127, 0x011132, 0x011127, 0x011347,
+	/*  5880 */ 0x01133E, 0x011347, 0x011357, 0x0114B9, 0x0114BA, 0x0114B9, 0x0114B0, 0x0114B9,
+	/*  5888 */ 0x0114BD, 0x0115B8, 0x0115AF, 0x0115B9, 0x0115AF, 0x01D157, 0x01D165, 0x01D158,
+	/*  5896 */ 0x01D165, 0x01D158, 0x01D165, 0x01D16E, 0x01D158, 0x01D165, 0x01D16F, 0x01D158,
+	/*  5904 */ 0x01D165, 0x01D170, 0x01D158, 0x01D165, 0x01D171, 0x01D158, 0x01D165, 0x01D172,
+	/*  5912 */ 0x01D1B9, 0x01D165, 0x01D1BA, 0x01D165, 0x01D1B9, 0x01D165, 0x01D16E, 0x01D1BA,
+	/*  5920 */ 0x01D165, 0x01D16E, 0x01D1B9, 0x01D165, 0x01D16F, 0x01D1BA, 0x01D165, 0x01D16F,
+	/*  5928 */ 0x000131, 0x000237, 0x000391, 0x000392, 0x000394, 0x000395, 0x000396, 0x000397,
+	/*  5936 */ 0x000399, 0x00039A, 0x00039B, 0x00039C, 0x00039D, 0x00039E, 0x00039F, 0x0003A1,
+	/*  5944 */ 0x0003A4, 0x0003A6, 0x0003A7, 0x0003A8, 0x002207, 0x0003B1, 0x0003B6, 0x0003B7,
+	/*  5952 */ 0x0003BB, 0x0003BD, 0x0003BE, 0x0003BF, 0x0003C3, 0x0003C4, 0x0003C5, 0x0003C8,
+	/*  5960 */ 0x0003C9, 0x002202, 0x0003DC, 0x0003DD, 0x00066E, 0x0006A1, 0x00066F, 0x000030,
+	/*  5968 */ 0x00002E, 0x000030, 0x00002C, 0x000031, 0x00002C, 0x000032, 0x00002C, 0x000033,
+	/*  5976 */ 0x00002C, 0x000034, 0x00002C, 0x000035, 0x00002C, 0x000036, 0x00002C, 0x000037,
+	/*  5984 */ 0x00002C, 0x000038, 0x00002C, 0x000039, 0x00002C, 0x000028, 0x000041, 0x000029,
+	/*  5992 */ 0x000028, 0x000042, 0x000029, 0x000028, 0x000043, 0x000029, 0x000028, 0x000044,
+	/*  6000 */ 0x000029, 0x000028, 0x000045, 0x000029, 0x000028, 0x000046, 0x000029, 0x000028,
+	/*  6008 */ 0x000047, 0x000029, 0x000028, 0x000048, 0x000029, 0x000028, 0x000049, 0x000029,
+	/*  6016 */ 0x000028, 0x00004A, 0x000029, 0x000028, 0x00004B, 0x000029, 0x000028, 0x00004C,
+	/*  6024 */ 0x000029, 0x000028, 0x00004D, 0x000029, 0x000028, 0x00004E, 0x000029, 0x000028,
+	/*  6032 */ 0x00004F, 0x000029, 0x000028, 0x000050, 0x000029, 0x000028, 0x000051, 0x000029,
+	/*  6040 */ 0x000028, 0x000052, 0x000029, 0x000028, 0x000053, 0x000029, 0x000028, 0x000054,
+	/*  6048 */ 0x000029, 0x000028, 0x000055, 0x000029, 0x000028, 0x000056, 0x000029, 0x000028,
+	/*  6056 */ 0x000057, 0x000029, 0x000028, 0x000058, 0x000029, 0x000028, 0x000059, 0x000029,
+	/*  6064 */ 0x000028, 0x00005A, 0x000029, 0x003014, 0x000053, 0x003015, 0x000043, 0x000044,
+	/*  6072 */ 0x000057, 0x00005A, 0x000048, 0x000056, 0x000053, 0x000044, 0x000053, 0x000053,
+	/*  6080 */ 0x000050, 0x000050, 0x000056, 0x000057, 0x000043, 0x00004D, 0x000043, 0x00004D,
+	/*  6088 */ 0x000044, 0x00004D, 0x000052, 0x000044, 0x00004A, 0x00307B, 0x00304B, 0x0030B3,
+	/*  6096 */ 0x0030B3, 0x005B57, 0x0053CC, 0x00591A, 0x0089E3, 0x004EA4, 0x006620, 0x007121,
+	/*  6104 */ 0x00524D, 0x005F8C, 0x00518D, 0x0065B0, 0x00521D, 0x007D42, 0x008CA9, 0x0058F0,
+	/*  6112 */ 0x005439, 0x006F14, 0x006295, 0x006355, 0x00904A, 0x006307, 0x006253, 0x007981,
+	/*  6120 */ 0x007A7A, 0x005408, 0x006E80, 0x007533, 0x005272, 0x0055B6, 0x00914D, 0x003014,
+	/*  6128 */ 0x00672C, 0x003015, 0x003014, 0x004E09, 0x003015, 0x003014, 0x004E8C, 0x003015,
+	/*  6136 */ 0x003014, 0x005B89, 0x003015, 0x003014, 0x0070B9, 0x003015, 0x003014, 0x006253,
+	/*  6144 */ 0x003015, 0x003014, 0x0076D7, 0x003015, 0x003014, 0x0052DD, 0x003015, 0x003014,
+	/*  6152 */ 0x006557, 0x003015, 0x005F97, 0x0053EF, 0x004E3D, 0x004E38, 0x004E41, 0x020122,
+	/*  6160 */ 0x004F60, 0x004FBB, 0x005002, 0x00507A, 0x005099, 0x0050CF, 0x00349E, 0x02063A,
+	/*  6168 */ 0x005154, 0x005164, 0x005177, 0x02051C, 0x0034B9, 0x005167, 0x02054B, 0x005197,
+	/*  6176 */ 0x0051A4, 0x004ECC, 0x0051AC, 0x0291DF, 0x005203, 0x0034DF, 0x00523B, 0x005246,
+	/*  6184 */ 0x005277, 0x003515, 0x005305, 0x005306, 0x005349, 0x00535A, 0x005373, 0x00537D,
+	/*  6192 */ 0x00537F, 0x020A2C, 0x007070, 0x0053CA, 0x0053DF, 0x020B63, 0x0053EB, 0x0053F1,
+	/*  6200 */ 0x005406, 0x00549E, 0x005438, 0x005448, 0x005468, 0x0054A2, 0x0054F6, 0x005510,
+	/*  6208 */ 0x005553, 0x005563, 0x005584, 0x0055AB, 0x0055B3, 0x0055C2, 0x005716, 0x005717,
+	/*  6216 */ 0x005651, 0x005674, 0x0058EE, 0x0057CE, 0x0057F4, 0x00580D, 0x00578B, 0x005832,
+	/*  6224 */ 0x005831, 0x0058AC, 0x0214E4, 0x0058F2, 0x0058F7, 0x005906, 0x005922, 0x005962,
+	/*  6232 */ 0x0216A8, 0x0216EA, 0x0059EC, 0x005A1B, 0x005A27, 0x0059D8, 0x005A66, 0x0036EE,
+	/*  6240 */ 0x0036FC, 0x005B08, 0x005B3E, 0x0219C8, 0x005BC3, 0x005BD8, 0x005BF3, 0x021B18,
+	/*  6248 */ 0x005BFF, 0x005C06, 0x005F53, 0x003781, 0x005C60, 0x005CC0, 0x005C8D, 0x021DE4,
+	/*  6256 */ 0x005D43, 0x021DE6, 0x005D6E, 0x005D6B, 0x005D7C, 0x005DE1, 0x005DE2, 0x00382F,
+	/*  6264 */ 0x005DFD, 0x005E28, 0x005E3D, 0x005E69, 0x003862, 0x022183, 0x00387C, 0x005EB0,
+	/*  6272 */ 0x005EB3, 0x005EB6, 0x02A392, 0x022331, 0x008201, 0x005F22, 0x0038C7, 0x0232B8,
+	/*  6280 */ 0x0261DA, 0x005F62, 0x005F6B, 0x0038E3, 0x005F9A, 0x005FCD, 0x005FD7, 0x005FF9,
+	/*  6288 */ 0x006081, 0x00393A, 0x00391C, 0x0226D4, 0x0060C7, 0x006148, 0x00614C, 0x00617A,
+	/*  6296 */ 0x0061B2, 0x0061A4, 0x0061AF, 0x0061DE, 0x006210, 0x00621B, 0x00625D, 0x0062B1,
+	/*  6304 */ 0x0062D4, 0x006350, 0x022B0C, 0x00633D, 0x0062FC, 0x006368, 0x006383, 0x0063E4,
+	/*  6312 */ 0x022BF1, 0x006422, 0x0063C5, 0x0063A9, 0x003A2E, 0x006469, 0x00647E, 0x00649D,
+	/*  6320 */ 0x006477, 0x003A6C, 0x00656C, 0x02300A, 0x0065E3, 0x0066F8, 0x006649, 0x003B19,
+	/*  6328 */ 0x003B08, 0x003AE4, 0x005192, 0x005195, 0x006700, 0x00669C, 0x0080AD, 0x0043D9,
+	/*  6336 */ 0x006721, 0x00675E, 0x006753, 0x0233C3, 0x003B49, 0x0067FA, 0x006785, 0x006852,
+	/*  6344 */ 0x02346D, 0x00688E, 0x00681F, 0x006914, 0x006942, 0x0069A3, 0x0069EA, 0x006AA8,
+	/*  6352 */ 0x0236A3, 0x006ADB, 0x003C18, 0x006B21, 0x0238A7, 0x006B54, 0x003C4E, 0x006B72,
+	/*  6360 */ 0x006B9F, 0x006BBB, 0x023A8D, 0x021D0B, 0x023AFA, 0x006C4E, 0x023CBC, 0x006CBF,
+	/*  6368 */ 0x006CCD, 0x006C67, 0x006D16, 0x006D3E, 0x006D69, 0x006D78, 0x006D85, 0x023D1E,
+	/*  6376 */ 0x006D34, 0x006E2F, 0x006E6E, 0x003D33, 0x006EC7, 0x023ED1, 0x006DF9, 0x006F6E,
+	/*  6384 */ 0x023F5E, 0x023F8E, 0x006FC6, 0x007039, 0x00701B, 0x003D96, 0x00704A, 0x00707D,
+	/*  6392 */ 0x007077, 0x0070AD, 0x020525, 0x007145, 0x024263, 0x00719C, 0x0243AB, 0x007228,
+	/*  6400 */ 0x007250, 0x024608, 0x007280, 0x007295, 0x024735, 0x024814, 0x00737A, 0x00738B,
+	/*  6408 */ 0x003EAC, 0x0073A5, 0x003EB8, 0x007447, 0x00745C, 0x007485, 0x0074CA, 0x003F1B,
+	/*  6416 */ 0x007524, 0x024C36, 0x00753E, 0x024C92, 0x02219F, 0x007610, 0x024FA1, 0x024FB8,
+	/*  6424 */ 0x025044, 0x003FFC, 0x004008, 0x0250F3, 0x0250F2, 0x025119, 0x025133, 0x00771E,
+	/*  6432 */ 0x00771F, 0x00778B, 0x004046, 0x004096, 0x02541D, 0x00784E, 0x0040E3, 0x025626,
+	/*  6440 */ 0x02569A, 0x0256C5, 0x0079EB, 0x00412F, 0x007A4A, 0x007A4F, 0x02597C, 0x025AA7,
+	/*  6448 */ 0x007AEE, 0x004202, 0x025BAB, 0x007BC6, 0x007BC9, 0x004227, 0x025C80, 0x007CD2,
+	/*  6456 */ 0x0042A0, 0x007CE8, 0x007CE3, 0x007D00, 0x025F86, 0x007D63, 0x004301, 0x007DC7,
+	/*  6464 */ 0x007E02, 0x007E45, 0x004334, 0x026228, 0x026247, 0x004359, 0x0262D9, 0x007F7A,
+	/*  6472 */ 0x02633E, 0x007F95, 0x007FFA, 0x0264DA, 0x026523, 0x008060, 0x0265A8, 0x008070,
+	/*  6480 */ 0x02335F, 0x0043D5, 0x0080B2, 0x008103, 0x00440B, 0x00813E, 0x005AB5, 0x0267A7,
+	/*  6488 */ 0x0267B5, 0x023393, 0x02339C, 0x008204, 0x008F9E, 0x00446B, 0x008291, 0x00828B,
+	/*  6496 */ 0x00829D, 0x0052B3, 0x0082B1, 0x0082B3, 0x0082BD, 0x0082E6, 0x026B3C, 0x00831D,
+	/*  6504 */ 0x008363, 0x0083AD, 0x008323, 0x0083BD, 0x0083E7, 0x008353, 0x0083CA, 0x0083CC,
+	/*  6512 */ 0x0083DC, 0x026C36, 0x026D6B, 0x026CD5, 0x00452B, 0x0084F1, 0x0084F3, 0x008516,
+	/*  6520 */ 0x0273CA, 0x008564, 0x026F2C, 0x00455D, 0x004561, 0x026FB1, 0x0270D2, 0x00456B,
+	/*  6528 */ 0x008650, 0x008667, 0x008669, 0x0086A9, 0x008688, 0x00870E, 0x0086E2, 0x008728,
+	/*  6536 */ 0x00876B, 0x008786, 0x0045D7, 0x0087E1, 0x008801, 0x0045F9, 0x008860, 0x027667,
+	/*  6544 */ 0x0088D7, 0x0088DE, 0x004635, 0x0088FA, 0x0034BB, 0x0278AE, 0x027966, 0x0046BE,
+	/*  6552 */ 0x0046C7, 0x008AA0, 0x027CA8, 0x008CAB, 0x008CC1, 0x008D1B, 0x008D77, 0x027F2F,
+	/*  6560 */ 0x020804, 0x008DCB, 0x008DBC, 0x008DF0, 0x0208DE, 0x008ED4, 0x0285D2, 0x0285ED,
+	/*  6568 */ 0x009094, 0x0090F1, 0x009111, 0x02872E, 0x00911B, 0x009238, 0x0092D7, 0x0092D8,
+	/*  6576 */ 0x00927C, 0x0093F9, 0x009415, 0x028BFA, 0x00958B, 0x004995, 0x0095B7, 0x028D77,
+	/*  6584 */ 0x0049E6, 0x0096C3, 0x005DB2, 0x009723, 0x029145, 0x02921A, 0x004A6E, 0x004A76,
+	/*  6592 */ 0x0097E0, 0x02940A, 0x004AB2, 0x029496, 0x009829, 0x0295B6, 0x0098E2, 0x004B33,
+	/*  6600 */ 0x009929, 0x0099A7, 0x0099C2, 0x0099FE, 0x004BCE, 0x029B30, 0x009C40, 0x009CFD,
+	/*  6608 */ 0x004CCE, 0x004CED, 0x009D67, 0x02A0CE, 0x004CF8, 0x02A105, 0x02A20E, 0x02A291,
+	/*  6616 */ 0x004D56, 0x009EFE, 0x009F05, 0x009F0F, 0x009F16, 0x02A600,
+};
+
+/* The (second, primary composite) pairs for each first codepoint, in second
+ * codepoint order, and terminated by a { 0, 0 } entry.
+ */
+static const codepoint_t compositions[][2] =
+{
+	/*    0 */ { 0x000000, 0x000000 },
+	/*    1 */ { 0x000338, 0x00226E },
+	/*    2 */ { 0x000000, 0x000000 },
+	/*    3 */ { 0x000338, 0x002260 },
+	/*    4 */ { 0x000000, 0x000000 },
+	/*    5 */ { 0x000338, 0x00226F },
+	/*    6 */ { 0x000000, 0x000000 },
+	/*    7 */ { 0x000300, 0x0000C0 },
+	/*    8 */ { 0x000301, 0x0000C1 },
+	/*    9 */ { 0x000302, 0x0000C2 },
+	/*   10 */ { 0x000303, 0x0000C3 },
+	/*   11 */ { 0x000304, 0x000100 },
+	/*   12 */ { 0x000306, 0x000102 },
+	/*   13 */ { 0x000307, 0x000226 },
+	/*   14 */ { 0x000308, 0x0000C4 },
+	/*   15 */ { 0x000309, 0x001EA2 },
+	/*   16 */ { 0x00030A, 0x0000C5 },
+	/*   17 */ { 0x00030C, 0x0001CD },
+	/*   18 */ { 0x00030F, 0x000200 },
+	/*   19 */ { 0x000311, 0x000202 },
+	/*   20 */ { 0x000323, 0x001EA0 },
+	/*   21 */ { 0x000325, 0x001E00 },
+	/*   22 */ { 0x000328, 0x000104 },
+	/*   23 */ { 0x000000, 0x000000 },
+	/*   24 */ { 0x000307, 0x001E02 },
+	/*   25 */ { 0x000323, 0x001E04 },
+	/*   26 */ { 0x000331, 0x001E06 },
+	/*   27 */ { 0x000000, 0x000000 },
+	/*   28 */ { 0x000301, 0x000106 },
+	/*   29 */ { 0x000302, 0x000108 },
+	/*   30 */ { 0x000307, 0x00010A },
+	/*   31 */ { 0x00030C, 0x00010C },
+	/*   32 */ { 0x000327, 0x0000C7 },
+	/*   33 */ { 0x000000, 0x000000 },
+	/*   34 */ { 0x000307, 0x001E0A },
+	/*   35 */ { 0x00030C, 0x00010E },
+	/*   36 */ { 0x000323, 0x001E0C },
+	/*   37 */ { 0x000327, 0x001E10 },
+	/*   38 */ { 0x00032D, 0x001E12 },
+	/*   39 */ { 0x000331, 0x001E0E },
+	/*   40 */ { 0x000000, 0x000000 },
+	/*   41 */ { 0x000300, 0x0000C8 },
+	/*   42 */ { 0x000301, 0x0000C9 },
+	/*   43 */ { 0x000302, 0x0000CA },
+	/*   44 */ { 0x000303, 0x001EBC },
+	/*   45 */ { 0x000304, 0x000112 },
+	/*   46 */ { 0x000306, 0x000114 },
+	/*   47 */ { 0x000307, 0x000116 },
+	/*   48 */ { 0x000308, 0x0000CB },
+	/*   49 */ { 0x000309, 0x001EBA },
+	/*   50 */ { 0x00030C, 0x00011A },
+	/*   51 */ { 0x00030F, 0x000204 },
+	/*   52 */ { 0x000311, 0x000206 },
+	/*   53 */ { 0x000323, 0x001EB8 },
+	/*   54 */ { 0x000327, 0x000228 },
+	/*   55 */ { 0x000328, 0x000118 },
+	/*   56 */ { 0x00032D, 0x001E18 },
+	/*   57 */ { 0x000330, 0x001E1A },
+	/*   58 */ { 0x000000, 0x000000 },
+	/*   59 */ { 0x000307, 0x001E1E },
+	/*   60 */ { 0x000000, 0x000000 },
+	/*   61 */ { 0x000301, 0x0001F4 },
+	/*   62 */ { 0x000302, 0x00011C },
+	/*   63 */ { 0x000304, 0x001E20 },
+	/*   64 */ { 0x000306, 0x00011E },
+	/*   65 */ { 0x000307, 0x000120 },
+	/*   66 */ { 0x00030C, 0x0001E6 },
+	/*   67 */ { 0x000327, 0x000122 },
+	/*   68 */ { 0x000000, 0x000000 },
+	/*   69 */ { 0x000302, 0x000124 },
+	/*   70 */ { 0x000307, 0x001E22 },
+	/*   71 */ { 0x000308, 0x001E26 },
+	/*   72 */ { 0x00030C, 0x00021E },
+	/*   73 */ { 0x000323, 0x001E24 },
+	/*   74 */ { 0x000327, 0x001E28 },
+	/*   75 */ { 0x00032E, 0x001E2A },
+	/*   76 */ { 0x000000, 0x000000 },
+	/*   77 */ { 0x000300, 0x0000CC },
+	/*   78 */ { 0x000301, 0x0000CD },
+	/*   79 */ { 0x000302, 0x0000CE },
+	/*   80 */ { 0x000303, 0x000128 },
+	/*   81 */ { 0x000304, 0x00012A },
+	/*   82 */ { 0x000306, 0x00012C },
+	/*   83 */ { 0x000307, 0x000130 },
+	/*   84 */ { 0x000308, 0x0000CF },
+	/*   85 */ { 0x000309, 0x001EC8 },
+	/*   86 */ { 0x00030C, 0x0001CF },
+	/*   87 */ { 0x00030F, 0x000208 },
+	/*   88 */ { 0x000311, 0x00020A },
+	/*   89 */ { 0x000323, 0x001ECA },
+	/*   90 */ { 0x000328, 0x00012E },
+	/*   91 */ { 0x000330, 0x001E2C },
+	/*   92 */ { 0x000000, 0x000000 },
+	/*   93 */ { 0x000302, 0x000134 },
+	/*   94 */ { 0x000000, 0x000000 },
+	/*   95 */ { 0x000301, 0x001E30 },
+	/*   96 */ { 0x00030C, 0x0001E8 },
+	/*   97 */ { 0x000323, 0x001E32 },
+	/*   98 */ { 0x000327, 0x000136 },
+	/*   99 */ { 0x000331, 0x001E34 },
+	/*  100 */ { 0x000000, 0x000000 },
+	/*  101 */ { 0x000301, 0x000139 },
+	/*  102 */ { 0x00030C, 0x00013D },
+	/*  103 */ { 0x000323, 0x001E36 },
+	/*  104 */ { 0x000327, 0x00013B },
+	/*  105 */ { 0x00032D, 0x001E3C },
+	/*  106 */ { 0x000331, 0x001E3A },
+	/*  107 */ { 0x000000, 0x000000 },
+	/*  108 */ { 0x000301, 0x001E3E },
+	/*  109 */ { 0x000307, 0x001E40 },
+	/*  110 */ { 0x000323, 0x001E42 },
+	/*  111 */ { 0x000000, 0x000000 },
+	/*  112 */ { 0x000300, 0x0001F8 },
+	/*  113 */ { 0x000301, 0x000143 },
+	/*  114 */ { 0x000303, 0x0000D1 },
+	/*  115 */ { 0x000307, 0x001E44 },
+	/*  116 */ { 0x00030C, 0x000147 },
+	/*  117 */ { 0x000323, 0x001E46 },
+	/*  118 */ { 0x000327, 0x000145 },
+	/*  119 */ { 0x00032D, 0x001E4A },
+	/*  120 */ { 0x000331, 0x001E48 },
+	/*  121 */ { 0x000000, 0x000000 },
+	/*  122 */ { 0x000300, 0x0000D2 },
+	/*  123 */ { 0x000301, 0x0000D3 },
+	/*  124 */ { 0x000302, 0x0000D4 },
+	/*  125 */ { 0x000303, 0x0000D5 },
+	/*  126 */ { 0x000304, 0x00014C },
+	/*  127 */ { 0x000306, 0x00014E },
+	/*  128 */ { 0x000307, 0x00022E },
+	/*  129 */ { 0x000308, 0x0000D6 },
+	/*  130 */ { 0x000309, 0x001ECE },
+	/*  131 */ { 0x00030B, 0x000150 },
+	/*  132 */ { 0x00030C, 0x0001D1 },
+	/*  133 */ { 0x00030F, 0x00020C },
+	/*  134 */ { 0x000311, 0x00020E },
+	/*  135 */ { 0x00031B, 0x0001A0 },
+	/*  136 */ { 0x000323, 0x001ECC },
+	/*  137 */ { 0x000328, 0x0001EA },
+	/*  138 */ { 0x000000, 0x000000 },
+	/*  139 */ { 0x000301, 0x001E54 },
+	/*  140 */ { 0x000307, 0x001E56 },
+	/*  141 */ { 0x000000, 0x000000 },
+	/*  142 */ { 0x000301, 0x000154 },
+	/*  143 */ { 0x000307, 0x001E58 },
+	/*  144 */ { 0x00030C, 0x000158 },
+	/*  145 */ { 0x00030F, 0x000210 },
+	/*  146 */ { 0x000311, 0x000212 },
+	/*  147 */ { 0x000323, 0x001E5A },
+	/*  148 */ { 0x000327, 0x000156 },
+	/*  149 */ { 0x000331, 0x001E5E },
+	/*  150 */ { 0x000000, 0x000000 },
+	/*  151 */ { 0x000301, 0x00015A },
+	/*  152 */ { 0x000302, 0x00015C },
+	/*  153 */ { 0x000307, 0x001E60 },
+	/*  154 */ { 0x00030C, 0x000160 },
+	/*  155 */ { 0x000323, 0x001E62 },
+	/*  156 */ { 0x000326, 0x000218 },
+	/*  157 */ { 0x000327, 0x00015E },
+	/*  158 */ { 0x000000, 0x000000 },
+	/*  159 */ { 0x000307, 0x001E6A },
+	/*  160 */ { 0x00030C, 0x000164 },
+	/*  161 */ { 0x000323, 0x001E6C },
+	/*  162 */ { 0x000326, 0x00021A },
+	/*  163 */ { 0x000327, 0x000162 },
+	/*  164 */ { 0x00032D, 0x001E70 },
+	/*  165 */ { 0x000331, 0x001E6E },
+	/*  166 */ { 0x000000, 0x000000 },
+	/*  167 */ { 0x000300, 0x0000D9 },
+	/*  168 */ { 0x000301, 0x0000DA },
+	/*  169 */ { 0x000302, 0x0000DB },
+	/*  170 */ { 0x000303, 0x000168 },
+	/*  171 */ { 0x000304, 0x00016A },
+	/*  172 */ { 0x000306, 0x00016C },
+	/*  173 */ { 0x000308, 0x0000DC },
+	/*  174 */ { 0x000309, 0x001EE6 },
+	/*  175 */ { 0x00030A, 0x00016E },
+	/*  176 */ { 0x00030B, 0x000170 },
+	/*  177 */ { 0x00030C, 0x0001D3 },
+	/*  178 */ { 0x00030F, 0x000214 },
+	/*  179 */ { 0x000311, 0x000216 },
+	/*  180 */ { 0x00031B, 0x0001AF },
+	/*  181 */ { 0x000323, 0x001EE4 },
+	/*  182 */ { 0x000324, 0x001E72 },
+	/*  183 */ { 0x000328, 0x000172 },
+	/*  184 */ { 0x00032D, 0x001E76 },
+	/*  185 */ { 0x000330, 0x001E74 },
+	/*  186 */ { 0x000000, 0x000000 },
+	/*  187 */ { 0x000303, 0x001E7C },
+	/*  188 */ { 0x000323, 0x001E7E },
+	/*  189 */ { 0x000000, 0x000000 },
+	/*  190 */ { 0x000300, 0x001E80 },
+	/*  191 */ { 0x000301, 0x001E82 },
+	/*  192 */ { 0x000302, 0x000174 },
+	/*  193 */ { 0x000307, 0x001E86 },
+	/*  194 */ { 0x000308, 0x001E84 },
+	/*  195 */ { 0x000323, 0x001E88 },
+	/*  196 */ { 0x000000, 0x000000 },
+	/*  197 */ { 0x000307, 0x001E8A },
+	/*  198 */ { 0x000308, 0x001E8C },
+	/*  199 */ { 0x000000, 0x000000 },
+	/*  200 */ { 0x000300, 0x001EF2 },
+	/*  201 */ { 0x000301, 0x0000DD },
+	/*  202 */ { 0x000302, 0x000176 },
+	/*  203 */ { 0x000303, 0x001EF8 },
+	/*  204 */ { 0x000304, 0x000232 },
+	/*  205 */ { 0x000307, 0x001E8E },
+	/*  206 */ { 0x000308, 0x000178 },
+	/*  207 */ { 0x000309, 0x001EF6 },
+	/*  208 */ { 0x000323, 0x001EF4 },
+	/*  209 */ { 0x000000, 0x000000 },
+	/*  210 */ { 0x000301, 0x000179 },
+	/*  211 */ { 0x000302, 0x001E90 },
+	/*  212 */ { 0x000307, 0x00017B },
+	/*  213 */ { 0x00030C, 0x00017D },
+	/*  214 */ { 0x000323, 0x001E92 },
+	/*  215 */ { 0x000331, 0x001E94 },
+	/*  216 */ { 0x000000, 0x000000 },
+	/*  217 */ { 0x000300, 0x0000E0 },
+	/*  218 */ { 0x000301, 0x0000E1 },
+	/*  219 */ { 0x000302, 0x0000E2 },
+	/*  220 */ { 0x000303, 0x0000E3 },
+	/*  221 */ { 0x000304, 0x000101 },
+	/*  222 */ { 0x000306, 0x000103 },
+	/*  223 */ { 0x000307, 0x000227 },
+	/*  224 */ { 0x000308, 0x0000E4 },
+	/*  225 */ { 0x000309, 0x001EA3 },
+	/*  226 */ { 0x00030A, 0x0000E5 },
+	/*  227 */ { 0x00030C, 0x0001CE },
+	/*  228 */ { 0x00030F, 0x000201 },
+	/*  229 */ { 0x000311, 0x000203 },
+	/*  230 */ { 0x000323, 0x001EA1 },
+	/*  231 */ { 0x000325, 0x001E01 },
+	/*  232 */ { 0x000328, 0x000105 },
+	/*  233 */ { 0x000000, 0x000000 },
+	/*  234 */ { 0x000307, 0x001E03 },
+	/*  235 */ { 0x000323, 0x001E05 },
+	/*  236 */ { 0x000331, 0x001E07 },
+	/*  237 */ { 0x000000, 0x000000 },
+	/*  238 */ { 0x000301, 0x000107 },
+	/*  239 */ { 0x000302, 0x000109 },
+	/*  240 */ { 0x000307, 0x00010B },
+	/*  241 */ { 0x00030C, 0x00010D },
+	/*  242 */ { 0x000327, 0x0000E7 },
+	/*  243 */ { 0x000000, 0x000000 },
+	/*  244 */ { 0x000307, 0x001E0B },
+	/*  245 */ { 0x00030C, 0x00010F },
+	/*  246 */ { 0x000323, 0x001E0D },
+	/*  247 */ { 0x000327, 0x001E11 },
+	/*  248 */ { 0x00032D, 0x001E13 },
+	/*  249 */ { 0x000331, 0x001E0F },
+	/*  250 */ { 0x000000, 0x000000 },
+	/*  251 */ { 0x000300, 0x0000E8 },
+	/*  252 */ { 0x000301, 0x0000E9 },
+	/*  253 */ { 0x000302, 0x0000EA },
+	/*  254 */ { 0x000303, 0x001EBD },
+	/*  255 */ { 0x000304, 0x000113 },
+	/*  256 */ { 0x000306, 0x000115 },
+	/*  257 */ { 0x000307, 0x000117 },
+	/*  258 */ { 0x000308, 0x0000EB },
+	/*  259 */ { 0x000309, 0x001EBB },
+	/*  260 */ { 0x00030C, 0x00011B },
+	/*  261 */ { 0x00030F, 0x000205 },
+	/*  262 */ { 0x000311, 0x000207 },
+	/*  263 */ { 0x000323, 0x001EB9 },
+	/*  264 */ { 0x000327, 0x000229 },
+	/*  265 */ { 0x000328, 0x000119 },
+	/*  266 */ { 0x00032D, 0x001E19 },
+	/*  267 */ { 0x000330, 0x001E1B },
+	/*  268 */ { 0x000000, 0x000000 },
+	/*  269 */ { 0x000307, 0x001E1F },
+	/*  270 */ { 0x000000, 0x000000 },
+	/*  271 */ { 0x000301, 0x0001F5 },
+	/*  272 */ { 0x000302, 0x00011D },
+	/*  273 */ { 0x000304, 0x001E21 },
+	/*  274 */ { 0x000306, 0x00011F },
+	/*  275 */ { 0x000307, 0x000121 },
+	/*  276 */ { 0x00030C, 0x0001E7 },
+	/*  277 */ { 0x000327, 0x000123 },
+	/*  278 */ { 0x000000, 0x000000 },
+	/*  279 */ { 0x000302, 0x000125 },
+	/*  280 */ { 0x000307, 0x001E23 },
+	/*  281 */ { 0x000308, 0x001E27 },
+	/*  282 */ { 0x00030C, 0x00021F },
+	/*  283 */ { 0x000323, 0x001E25 },
+	/*  284 */ { 0x000327, 0x001E29 },
+	/*  285 */ { 0x00032E, 0x001E2B },
+	/*  286 */ { 0x000331, 0x001E96 },
+	/*  287 */ { 0x000000, 0x000000 },
+	/*  288 */ { 0x000300, 0x0000EC },
+	/*  289 */ { 0x000301, 0x0000ED },
+	/*  290 */ { 0x000302, 0x0000EE },
+	/*  291 */ { 0x000303, 0x000129 },
+	/*  292 */ { 0x000304, 0x00012B },
+	/*  293 */ { 0x000306, 0x00012D },
+	/*  294 */ { 0x000308, 0x0000EF },
+	/*  295 */ { 0x000309, 0x001EC9 },
+	/*  296 */ { 0x00030C, 0x0001D0 },
+	/*  297 */ { 0x00030F, 0x000209 },
+	/*  298 */ { 0x000311, 0x00020B },
+	/*  299 */ { 0x000323, 0x001ECB },
+	/*  300 */ { 0x000328, 0x00012F },
+	/*  301 */ { 0x000330, 0x001E2D },
+	/*  302 */ { 0x000000, 0x000000 },
+	/*  303 */ { 0x000302, 0x000135 },
+	/*  304 */ { 0x00030C, 0x0001F0 },
+	/*  305 */ { 0x000000, 0x000000 },
+	/*  306 */ { 0x000301, 0x001E31 },
+	/*  307 */ { 0x00030C, 0x0001E9 },
+	/*  308 */ { 0x000323, 0x001E33 },
+	/*  309 */ { 0x000327, 0x000137 },
+	/*  310 */ { 0x000331, 0x001E35 },
+	/*  311 */ { 0x000000, 0x000000 },
+	/*  312 */ { 0x000301, 0x00013A },
+	/*  313 */ { 0x00030C, 0x00013E },
+	/*  314 */ { 0x000323, 0x001E37 },
+	/*  315 */ { 0x000327, 0x00013C },
+	/*  316 */ { 0x00032D, 0x001E3D },
+	/*  317 */ { 0x000331, 0x001E3B },
+	/*  318 */ { 0x000000, 0x000000 },
+	/*  319 */ { 0x000301, 0x001E3F },
+	/*  320 */ { 0x000307, 0x001E41 },
+	/*  321 */ { 0x000323, 0x001E43 },
+	/*  322 */ { 0x000000, 0x000000 },
+	/*  323 */ { 0x000300, 0x0001F9 },
+	/*  324 */ { 0x000301, 0x000144 },
+	/*  325 */ { 0x000303, 0x0000F1 },
+	/*  326 */ { 0x000307, 0x001E45 },
+	/*  327 */ { 0x00030C, 0x000148 },
+	/*  328 */ { 0x000323, 0x001E47 },
+	/*  329 */ { 0x000327, 0x000146 },
+	/*  330 */ { 0x00032D, 0x001E4B },
+	/*  331 */ { 0x000331, 0x001E49 },
+	/*  332 */ { 0x000000, 0x000000 },
+	/*  333 */ { 0x000300, 0x0000F2 },
+	/*  334 */ { 0x000301, 0x0000F3 },
+	/*  335 */ { 0x000302, 0x0000F4 },
+	/*  336 */ { 0x000303, 0x0000F5 },
+	/*  337 */ { 0x000304, 0x00014D },
+	/*  338 */ { 0x000306, 0x00014F },
+	/*  339 */ { 0x000307, 0x00022F },
+	/*  340 */ { 0x000308, 0x0000F6 },
+	/*  341 */ { 0x000309, 0x001ECF },
+	/*  342 */ { 0x00030B, 0x000151 },
+	/*  343 */ { 0x00030C, 0x0001D2 },
+	/*  344 */ { 0x00030F, 0x00020D },
+	/*  345 */ { 0x000311, 0x00020F },
+	/*  346 */ { 0x00031B, 0x0001A1 },
+	/*  347 */ { 0x000323, 0x001ECD },
+	/*  348 */ { 0x000328, 0x0001EB },
+	/*  349 */ { 0x000000, 0x000000 },
+	/*  350 */ { 0x000301, 0x001E55 },
+	/*  351 */ { 0x000307, 0x001E57 },
+	/*  352 */ { 0x000000, 0x000000 },
+	/*  353 */ { 0x000301, 0x000155 },
+	/*  354 */ { 0x000307, 0x001E59 },
+	/*  355 */ { 0x00030C, 0x000159 },
+	/*  356 */ { 0x00030F, 0x000211 },
+	/*  357 */ { 0x000311, 0x000213 },
+	/*  358 */ { 0x000323, 0x001E5B },
+	/*  359 */ { 0x000327, 0x000157 },
+	/*  360 */ { 0x000331, 0x001E5F },
+	/*  361 */ { 0x000000, 0x000000 },
+	/*  362 */ { 0x000301, 0x00015B },
+	/*  363 */ { 0x000302, 0x00015D },
+	/*  364 */ { 0x000307, 0x001E61 },
+	/*  365 */ { 0x00030C, 0x000161 },
+	/*  366 */ { 0x000323, 0x001E63 },
+	/*  367 */ { 0x000326, 0x000219 },
+	/*  368 */ { 0x000327, 0x00015F },
+	/*  369 */ { 0x000000, 0x000000 },
+	/*  370 */ { 0x000307, 0x001E6B },
+	/*  371 */ { 0x000308, 0x001E97 },
+	/*  372 */ { 0x00030C, 0x000165 },
+	/*  373 */ { 0x000323, 0x001E6D },
+	/*  374 */ { 0x000326, 0x00021B },
+	/*  375 */ { 0x000327, 0x000163 },
+	/*  376 */ { 0x00032D, 0x001E71 },
+	/*  377 */ { 0x000331, 0x001E6F },
+	/*  378 */ { 0x000000, 0x000000 },
+	/*  379 */ { 0x000300, 0x0000F9 },
+	/*  380 */ { 0x000301, 0x0000FA },
+	/*  381 */ { 0x000302, 0x0000FB },
+	/*  382 */ { 0x000303, 0x000169 },
+	/*  383 */ { 0x000304, 0x00016B },
+	/*  384 */ { 0x000306, 0x00016D },
+	/*  385 */ { 0x000308, 0x0000FC },
+	/*  386 */ { 0x000309, 0x001EE7 },
+	/*  387 */ { 0x00030A, 0x00016F },
+	/*  388 */ { 0x00030B, 0x000171 },
+	/*  389 */ { 0x00030C, 0x0001D4 },
+	/*  390 */ { 0x00030F, 0x000215 },
+	/*  391 */ { 0x000311, 0x000217 },
+	/*  392 */ { 0x00031B, 0x0001B0 },
+	/*  393 */ { 0x000323, 0x001EE5 },
+	/*  394 */ { 0x000324, 0x001E73 },
+	/*  395 */ { 0x000328, 0x000173 },
+	/*  396 */ { 0x00032D, 0x001E77 },
+	/*  397 */ { 0x000330, 0x001E75 },
+	/*  398 */ { 0x000000, 0x000000 },
+	/*  399 */ { 0x000303, 0x001E7D },
+	/*  400 */ { 0x000323, 0x001E7F },
+	/*  401 */ { 0x000000, 0x000000 },
+	/*  402 */ { 0x000300, 0x001E81 },
+	/*  403 */ { 0x000301, 0x001E83 },
+	/*  404 */ { 0x000302, 0x000175 },
+	/*  405 */ { 0x000307, 0x001E87 },
+	/*  406 */ { 0x000308, 0x001E85 },
+	/*  407 */ { 0x00030A, 0x001E98 },
+	/*  408 */ { 0x000323, 0x001E89 },
+	/*  409 */ { 0x000000, 0x000000 },
+	/*  410 */ { 0x000307, 0x001E8B },
+	/*  411 */ { 0x000308, 0x001E8D },
+	/*  412 */ { 0x000000, 0x000000 },
+	/*  413 */ { 0x000300, 0x001EF3 },
+	/*  414 */ { 0x000301, 0x0000FD },
+	/*  415 */ { 0x000302, 0x000177 },
+	/*  416 */ { 0x000303, 0x001EF9 },
+	/*  417 */ { 0x000304, 0x000233 },
+	/*  418 */ { 0x000307, 0x001E8F },
+	/*  419 */ { 0x000308, 0x0000FF },
+	/*  420 */ { 0x000309, 0x001EF7 },
+	/*  421 */ { 0x00030A, 0x001E99 },
+	/*  422 */ { 0x000323, 0x001EF5 },
+	/*  423 */ { 0x000000, 0x000000 },
+	/*  424 */ { 0x000301, 0x00017A },
+	/*  425 */ { 0x000302, 0x001E91 },
+	/*  426 */ { 0x000307, 0x00017C },
+	/*  427 */ { 0x00030C, 0x00017E },
+	/*  428 */ { 0x000323, 0x001E93 },
+	/*  429 */ { 0x000331, 0x001E95 },
+	/*  430 */ { 0x000000, 0x000000 },
+	/*  431 */ { 0x000300, 0x001FED },
+	/*  432 */ { 0x000301, 0x000385 },
+	/*  433 */ { 0x000342, 0x001FC1 },
+	/*  434 */ { 0x000000, 0x000000 },
+	/*  435 */ { 0x000300, 0x001EA6 },
+	/*  436 */ { 0x000301, 0x001EA4 },
+	/*  437 */ { 0x000303, 0x001EAA },
+	/*  438 */ { 0x000309, 0x001EA8 },
+	/*  439 */ { 0x000000, 0x000000 },
+	/*  440 */ { 0x000304, 0x0001DE },
+	/*  441 */ { 0x000000, 0x000000 },
+	/*  442 */ { 0x000301, 0x0001FA },
+	/*  443 */ { 0x000000, 0x000000 },
+	/*  444 */ { 0x000301, 0x0001FC },
+	/*  445 */ { 0x000304, 0x0001E2 },
+	/*  446 */ { 0x000000, 0x000000 },
+	/*  447 */ { 0x000301, 0x001E08 },
+	/*  448 */ { 0x000000, 0x000000 },
+	/*  449 */ { 0x000300, 0x001EC0 },
+	/*  450 */ { 0x000301, 0x001EBE },
+	/*  451 */ { 0x000303, 0x001EC4 },
+	/*  452 */ { 0x000309, 0x001EC2 },
+	/*  453 */ { 0x000000, 0x000000 },
+	/*  454 */ { 0x000301, 0x001E2E },
+	/*  455 */ { 0x000000, 0x000000 },
+	/*  456 */ { 0x000300, 0x001ED2 },
+	/*  457 */ { 0x000301, 0x001ED0 },
+	/*  458 */ { 0x000303, 0x001ED6 },
+	/*  459 */ { 0x000309, 0x001ED4 },
+	/*  460 */ { 0x000000, 0x000000 },
+	/*  461 */ { 0x000301, 0x001E4C },
+	/*  462 */ { 0x000304, 0x00022C },
+	/*  463 */ { 0x000308, 0x001E4E },
+	/*  464 */ { 0x000000, 0x000000 },
+	/*  465 */ { 0x000304, 0x00022A },
+	/*  466 */ { 0x000000, 0x000000 },
+	/*  467 */ { 0x000301, 0x0001FE },
+	/*  468 */ { 0x000000, 0x000000 },
+	/*  469 */ { 0x000300, 0x0001DB },
+	/*  470 */ { 0x000301, 0x0001D7 },
+	/*  471 */ { 0x000304, 0x0001D5 },
+	/*  472 */ { 0x00030C, 0x0001D9 },
+	/*  473 */ { 0x000000, 0x000000 },
+	/*  474 */ { 0x000300, 0x001EA7 },
+	/*  475 */ { 0x000301, 0x001EA5 },
+	/*  476 */ { 0x000303, 0x001EAB },
+	/*  477 */ { 0x000309, 0x001EA9 },
+	/*  478 */ { 0x000000, 0x000000 },
+	/*  479 */ { 0x000304, 0x0001DF },
+	/*  480 */ { 0x000000, 0x000000 },
+	/*  481 */ { 0x000301, 0x0001FB },
+	/*  482 */ { 0x000000, 0x000000 },
+	/*  483 */ { 0x000301, 0x0001FD },
+	/*  484 */ { 0x000304, 0x0001E3 },
+	/*  485 */ { 0x000000, 0x000000 },
+	/*  486 */ { 0x000301, 0x001E09 },
+	/*  487 */ { 0x000000, 0x000000 },
+	/*  488 */ { 0x000300, 0x001EC1 },
+	/*  489 */ { 0x000301, 0x001EBF },
+	/*  490 */ { 0x000303, 0x001EC5 },
+	/*  491 */ { 0x000309, 0x001EC3 },
+	/*  492 */ { 0x000000, 0x000000 },
+	/*  493 */ { 0x000301, 0x001E2F },
+	/*  494 */ { 0x000000, 0x000000 },
+	/*  495 */ { 0x000300, 0x001ED3 },
+	/*  496 */ { 0x000301, 0x001ED1 },
+	/*  497 */ { 0x000303, 0x001ED7 },
+	/*  498 */ { 0x000309, 0x001ED5 },
+	/*  499 */ { 0x000000, 0x000000 },
+	/*  500 */ { 0x000301, 0x001E4D },
+	/*  501 */ { 0x000304, 0x00022D },
+	/*  502 */ { 0x000308, 0x001E4F },
+	/*  503 */ { 0x000000, 0x000000 },
+	/*  504 */ { 0x000304, 0x00022B },
+	/*  505 */ { 0x000000, 0x000000 },
+	/*  506 */ { 0x000301, 0x0001FF },
+	/*  507 */ { 0x000000, 0x000000 },
+	/*  508 */ { 0x000300, 0x0001DC },
+	/*  509 */ { 0x000301, 0x0001D8 },
+	/*  510 */ { 0x000304, 0x0001D6 },
+	/*  511 */ { 0x00030C, 0x0001DA },
+	/*  512 */ { 0x000000, 0x000000 },
+	/*  513 */ { 0x000300, 0x001EB0 },
+	/*  514 */ { 0x000301, 0x001EAE },
+	/*  515 */ { 0x000303, 0x001EB4 },
+	/*  516 */ { 0x000309, 0x001EB2 },
+	/*  517 */ { 0x000000, 0x000000 },
+	/*  518 */ { 0x000300, 0x001EB1 },
+	/*  519 */ { 0x000301, 0x001EAF },
+	/*  520 */ { 0x000303, 0x001EB5 },
+	/*  521 */ { 0x000309, 0x001EB3 },
+	/*  522 */ { 0x000000, 0x000000 },
+	/*  523 */ { 0x000300, 0x001E14 },
+	/*  524 */ { 0x000301, 0x001E16 },
+	/*  525 */ { 0x000000, 0x000000 },
+	/*  526 */ { 0x000300, 0x001E15 },
+	/*  527 */ { 0x000301, 0x001E17 },
+	/*  528 */ { 0x000000, 0x000000 },
+	/*  529 */ { 0x000300, 0x001E50 },
+	/*  530 */ { 0x000301, 0x001E52 },
+	/*  531 */ { 0x000000, 0x000000 },
+	/*  532 */ { 0x000300, 0x001E51 },
+	/*  533 */ { 0x000301, 0x001E53 },
+	/*  534 */ { 0x000000, 0x000000 },
+	/*  535 */ { 0x000307, 0x001E64 },
+	/*  536 */ { 0x000000, 0x000000 },
+	/*  537 */ { 0x000307, 0x001E65 },
+	/*  538 */ { 0x000000, 0x000000 },
+	/*  539 */ { 0x000307, 0x001E66 },
+	/*  540 */ { 0x000000, 0x000000 },
+	/*  541 */ { 0x000307, 0x001E67 },
+	/*  542 */ { 0x000000, 0x000000 },
+	/*  543 */ { 0x000301, 0x001E78 },
+	/*  544 */ { 0x000000, 0x000000 },
+	/*  545 */ { 0x000301, 0x001E79 },
+	/*  546 */ { 0x000000, 0x000000 },
+	/*  547 */ { 0x000308, 0x001E7A },
+	/*  548 */ { 0x000000, 0x000000 },
+	/*  549 */ { 0x000308, 0x001E7B },
+	/*  550 */ { 0x000000, 0x000000 },
+	/*  551 */ { 0x000307, 0x001E9B },
+	/*  552 */ { 0x000000, 0x000000 },
+	/*  553 */ { 0x000300, 0x001EDC },
+	/*  554 */ { 0x000301, 0x001EDA },
+	/*  555 */ { 0x000303, 0x001EE0 },
+	/*  556 */ { 0x000309, 0x001EDE },
+	/*  557 */ { 0x000323, 0x001EE2 },
+	/*  558 */ { 0x000000, 0x000000 },
+	/*  559 */ { 0x000300, 0x001EDD },
+	/*  560 */ { 0x000301, 0x001EDB },
+	/*  561 */ { 0x000303, 0x001EE1 },
+	/*  562 */ { 0x000309, 0x001EDF },
+	/*  563 */ { 0x000323, 0x001EE3 },
+	/*  564 */ { 0x000000, 0x000000 },
+	/*  565 */ { 0x000300, 0x001EEA },
+	/*  566 */ { 0x000301, 0x001EE8 },
+	/*  567 */ { 0x000303, 0x001EEE },
+	/*  568 */ { 0x000309, 0x001EEC },
+	/*  569 */ { 0x000323, 0x001EF0 },
+	/*  570 */ { 0x000000, 0x000000 },
+	/*  571 */ { 0x000300, 0x001EEB },
+	/*  572 */ { 0x000301, 0x001EE9 },
+	/*  573 */ { 0x000303, 0x001EEF },
+	/*  574 */ { 0x000309, 0x001EED },
+	/*  575 */ { 0x000323, 0x001EF1 },
+	/*  576 */ { 0x000000, 0x000000 },
+	/*  577 */ { 0x00030C, 0x0001EE },
+	/*  578 */ { 0x000000, 0x000000 },
+	/*  579 */ { 0x000304, 0x0001EC },
+	/*  580 */ { 0x000000, 0x000000 },
+	/*  581 */ { 0x000304, 0x0001ED },
+	/*  582 */ { 0x000000, 0x000000 },
+	/*  583 */ { 0x000304, 0x0001E0 },
+	/*  584 */ { 0x000000, 0x000000 },
+	/*  585 */ { 0x000304, 0x0001E1 },
+	/*  586 */ { 0x000000, 0x000000 },
+	/*  587 */ { 0x000306, 0x001E1C },
+	/*  588 */ { 0x000000, 0x000000 },
+	/*  589 */ { 0x000306, 0x001E1D },
+	/*  590 */ { 0x000000, 0x000000 },
+	/*  591 */ { 0x000304, 0x000230 },
+	/*  592 */ { 0x000000, 0x000000 },
+	/*  593 */ { 0x000304, 0x000231 },
+	/*  594 */ { 0x000000, 0x000000 },
+	/*  595 */ { 0x00030C, 0x0001EF },
+	/*  596 */ { 0x000000, 0x000000 },
+	/*  597 */ { 0x000300, 0x001FBA },
+	/*  598 */ { 0x000301, 0x000386 },
+	/*  599 */ { 0x000304, 0x001FB9 },
+	/*  600 */ { 0x000306, 0x001FB8 },
+	/*  601 */ { 0x000313, 0x001F08 },
+	/*  602 */ { 0x000314, 0x001F09 },
+	/*  603 */ { 0x000345, 0x001FBC },
+	/*  604 */ { 0x000000, 0x000000 },
+	/*  605 */ { 0x000300, 0x001FC8 },
+	/*  606 */ { 0x000301, 0x000388 },
+	/*  607 */ { 0x000313, 0x001F18 },
+	/*  608 */ { 0x000314, 0x001F19 },
+	/*  609 */ { 0x000000, 0x000000 },
+	/*  610 */ { 0x000300, 0x001FCA },
+	/*  611 */ { 0x000301, 0x000389 },
+	/*  612 */ { 0x000313, 0x001F28 },
+	/*  613 */ { 0x000314, 0x001F29 },
+	/*  614 */ { 0x000345, 0x001FCC },
+	/*  615 */ { 0x000000, 0x000000 },
+	/*  616 */ { 0x000300, 0x001FDA },
+	/*  617 */ { 0x000301, 0x00038A },
+	/*  618 */ { 0x000304, 0x001FD9 },
+	/*  619 */ { 0x000306, 0x001FD8 },
+	/*  620 */ { 0x000308, 0x0003AA },
+	/*  621 */ { 0x000313, 0x001F38 },
+	/*  622 */ { 0x000314, 0x001F39 },
+	/*  623 */ { 0x000000, 0x000000 },
+	/*  624 */ { 0x000300, 0x001FF8 },
+	/*  625 */ { 0x000301, 0x00038C },
+	/*  626 */ { 0x000313, 0x001F48 },
+	/*  627 */ { 0x000314, 0x001F49 },
+	/*  628 */ { 0x000000, 0x000000 },
+	/*  629 */ { 0x000314, 0x001FEC },
+	/*  630 */ { 0x000000, 0x000000 },
+	/*  631 */ { 0x000300, 0x001FEA },
+	/*  632 */ { 0x000301, 0x00038E },
+	/*  633 */ { 0x000304, 0x001FE9 },
+	/*  634 */ { 0x000306, 0x001FE8 },
+	/*  635 */ { 0x000308, 0x0003AB },
+	/*  636 */ { 0x000314, 0x001F59 },
+	/*  637 */ { 0x000000, 0x000000 },
+	/*  638 */ { 0x000300, 0x001FFA },
+	/*  639 */ { 0x000301, 0x00038F },
+	/*  640 */ { 0x000313, 0x001F68 },
+	/*  641 */ { 0x000314, 0x001F69 },
+	/*  642 */ { 0x000345, 0x001FFC },
+	/*  643 */ { 0x000000, 0x000000 },
+	/*  644 */ { 0x000345, 0x001FB4 },
+	/*  645 */ { 0x000000, 0x000000 },
+	/*  646 */ { 0x000345, 0x001FC4 },
+	/*  647 */ { 0x000000, 0x000000 },
+	/*  648 */ { 0x000300, 0x001F70 },
+	/*  649 */ { 0x000301, 0x0003AC },
+	/*  650 */ { 0x000304, 0x001FB1 },
+	/*  651 */ { 0x000306, 0x001FB0 },
+	/*  652 */ { 0x000313, 0x001F00 },
+	/*  653 */ { 0x000314, 0x001F01 },
+	/*  654 */ { 0x000342, 0x001FB6 },
+	/*  655 */ { 0x000345, 0x001FB3 },
+	/*  656 */ { 0x000000, 0x000000 },
+	/*  657 */ { 0x000300, 0x001F72 },
+	/*  658 */ { 0x000301, 0x0003AD },
+	/*  659 */ { 0x000313, 0x001F10 },
+	/*  660 */ { 0x000314, 0x001F11 },
+	/*  661 */ { 0x000000, 0x000000 },
+	/*  662 */ { 0x000300, 0x001F74 },
+	/*  663 */ { 0x000301, 0x0003AE },
+	/*  664 */ { 0x000313, 0x001F20 },
+	/*  665 */ { 0x000314, 0x001F21 },
+	/*  666 */ { 0x000342, 0x001FC6 },
+	/*  667 */ { 0x000345, 0x001FC3 },
+	/*  668 */ { 0x000000, 0x000000 },
+	/*  669 */ { 0x000300, 0x001F76 },
+	/*  670 */ { 0x000301, 0x0003AF },
+	/*  671 */ { 0x000304, 0x001FD1 },
+	/*  672 */ { 0x000306, 0x001FD0 },
+	/*  673 */ { 0x000308, 0x0003CA },
+	/*  674 */ { 0x000313, 0x001F30 },
+	/*  675 */ { 0x000314, 0x001F31 },
+	/*  676 */ { 0x000342, 0x001FD6 },
+	/*  677 */ { 0x000000, 0x000000 },
+	/*  678 */ { 0x000300, 0x001F78 },
+	/*  679 */ { 0x000301, 0x0003CC },
+	/*  680 */ { 0x000313, 0x001F40 },
+	/*  681 */ { 0x000314, 0x001F41 },
+	/*  682 */ { 0x000000, 0x000000 },
+	/*  683 */ { 0x000313, 0x001FE4 },
+	/*  684 */ { 0x000314, 0x001FE5 },
+	/*  685 */ { 0x000000, 0x000000 },
+	/*  686 */ { 0x000300, 0x001F7A },
+	/*  687 */ { 0x000301, 0x0003CD },
+	/*  688 */ { 0x000304, 0x001FE1 },
+	/*  689 */ { 0x000306, 0x001FE0 },
+	/*  690 */ { 0x000308, 0x0003CB },
+	/*  691 */ { 0x000313, 0x001F50 },
+	/*  692 */ { 0x000314, 0x001F51 },
+	/*  693 */ { 0x000342, 0x001FE6 },
+	/*  694 */ { 0x000000, 0x000000 },
+	/*  695 */ { 0x000300, 0x001F7C },
+	/*  696 */ { 0x000301, 0x0003CE },
+	/*  697 */ { 0x000313, 0x001F60 },
+	/*  698 */ { 0x000314, 0x001F61 },
+	/*  699 */ { 0x000342, 0x001FF6 },
+	/*  700 */ { 0x000345, 0x001FF3 },
+	/*  701 */ { 0x000000, 0x000000 },
+	/*  702 */ { 0x000300, 0x001FD2 },
+	/*  703 */ { 0x000301, 0x000390 },
+	/*  704 */ { 0x000342, 0x001FD7 },
+	/*  705 */ { 0x000000, 0x000000 },
+	/*  706 */ { 0x000300, 0x001FE2 },
+	/*  707 */ { 0x000301, 0x0003B0 },
+	/*  708 */ { 0x000342, 0x001FE7 },
+	/*  709 */ { 0x000000, 0x000000 },
+	/*  710 */ { 0x000345, 0x001FF4 },
+	/*  711 */ { 0x000000, 0x000000 },
+	/*  712 */ { 0x000301, 0x0003D3 },
+	/*  713 */ { 0x000308, 0x0003D4 },
+	/*  714 */ { 0x000000, 0x000000 },
+	/*  715 */ { 0x000308, 0x000407 },
+	/*  716 */ { 0x000000, 0x000000 },
+	/*  717 */ { 0x000306, 0x0004D0 },
+	/*  718 */ { 0x000308, 0x0004D2 },
+	/*  719 */ { 0x000000, 0x000000 },
+	/*  720 */ { 0x000301, 0x000403 },
+	/*  721 */ { 0x000000, 0x000000 },
+	/*  722 */ { 0x000300, 0x000400 },
+	/*  723 */ { 0x000306, 0x0004D6 },
+	/*  724 */ { 0x000308, 0x000401 },
+	/*  725 */ { 0x000000, 0x000000 },
+	/*  726 */ { 0x000306, 0x0004C1 },
+	/*  727 */ { 0x000308, 0x0004DC },
+	/*  728 */ { 0x000000, 0x000000 },
+	/*  729 */ { 0x000308, 0x0004DE },
+	/*  730 */ { 0x000000, 0x000000 },
+	/*  731 */ { 0x000300, 0x00040D },
+	/*  732 */ { 0x000304, 0x0004E2 },
+	/*  733 */ { 0x000306, 0x000419 },
+	/*  734 */ { 0x000308, 0x0004E4 },
+	/*  735 */ { 0x000000, 0x000000 },
+	/*  736 */ { 0x000301, 0x00040C },
+	/*  737 */ { 0x000000, 0x000000 },
+	/*  738 */ { 0x000308, 0x0004E6 },
+	/*  739 */ { 0x000000, 0x000000 },
+	/*  740 */ { 0x000304, 0x0004EE },
+	/*  741 */ { 0x000306, 0x00040E },
+	/*  742 */ { 0x000308, 0x0004F0 },
+	/*  743 */ { 0x00030B, 0x0004F2 },
+	/*  744 */ { 0x000000, 0x000000 },
+	/*  745 */ { 0x000308, 0x0004F4 },
+	/*  746 */ { 0x000000, 0x000000 },
+	/*  747 */ { 0x000308, 0x0004F8 },
+	/*  748 */ { 0x000000, 0x000000 },
+	/*  749 */ { 0x000308, 0x0004EC },
+	/*  750 */ { 0x000000, 0x000000 },
+	/*  751 */ { 0x000306, 0x0004D1 },
+	/*  752 */ { 0x000308, 0x0004D3 },
+	/*  753 */ { 0x000000, 0x000000 },
+	/*  754 */ { 0x000301, 0x000453 },
+	/*  755 */ { 0x000000, 0x000000 },
+	/*  756 */ { 0x000300, 0x000450 },
+	/*  757 */ { 0x000306, 0x0004D7 },
+	/*  758 */ { 0x000308, 0x000451 },
+	/*  759 */ { 0x000000, 0x000000 },
+	/*  760 */ { 0x000306, 0x0004C2 },
+	/*  761 */ { 0x000308, 0x0004DD },
+	/*  762 */ { 0x000000, 0x000000 },
+	/*  763 */ { 0x000308, 0x0004DF },
+	/*  764 */ { 0x000000, 0x000000 },
+	/*  765 */ { 0x000300, 0x00045D },
+	/*  766 */ { 0x000304, 0x0004E3 },
+	/*  767 */ { 0x000306, 0x000439 },
+	/*  768 */ { 0x000308, 0x0004E5 },
+	/*  769 */ { 0x000000, 0x000000 },
+	/*  770 */ { 0x000301, 0x00045C },
+	/*  771 */ { 0x000000, 0x000000 },
+	/*  772 */ { 0x000308, 0x0004E7 },
+	/*  773 */ { 0x000000, 0x000000 },
+	/*  774 */ { 0x000304, 0x0004EF },
+	/*  775 */ { 0x000306, 0x00045E },
+	/*  776 */ { 0x000308, 0x0004F1 },
+	/*  777 */ { 0x00030B, 0x0004F3 },
+	/*  778 */ { 0x000000, 0x000000 },
+	/*  779 */ { 0x000308, 0x0004F5 },
+	/*  780 */ { 0x000000, 0x000000 },
+	/*  781 */ { 0x000308, 0x0004F9 },
+	/*  782 */ { 0x000000, 0x000000 },
+	/*  783 */ { 0x000308, 0x0004ED },
+	/*  784 */ { 0x000000, 0x000000 },
+	/*  785 */ { 0x000308, 0x000457 },
+	/*  786 */ { 0x000000, 0x000000 },
+	/*  787 */ { 0x00030F, 0x000476 },
+	/*  788 */ { 0x000000, 0x000000 },
+	/*  789 */ { 0x00030F, 0x000477 },
+	/*  790 */ { 0x000000, 0x000000 },
+	/*  791 */ { 0x000308, 0x0004DA },
+	/*  792 */ { 0x000000, 0x000000 },
+	/*  793 */ { 0x000308, 0x0004DB },
+	/*  794 */ { 0x000000, 0x000000 },
+	/*  795 */ { 0x000308, 0x0004EA },
+	/*  796 */ { 0x000000, 0x000000 },
+	/*  797 */ { 0x000308, 0x0004EB },
+	/*  798 */ { 0x000000, 0x000000 },
+	/*  799 */ { 0x000653, 0x000622 },
+	/*  800 */ { 0x000654, 0x000623 },
+	/*  801 */ { 0x000655, 0x000625 },
+	/*  802 */ { 0x000000, 0x000000 },
+	/*  803 */ { 0x000654, 0x000624 },
+	/*  804 */ { 0x000000, 0x000000 },
+	/*  805 */ { 0x000654, 0x000626 },
+	/*  806 */ { 0x000000, 0x000000 },
+	/*  807 */ { 0x000654, 0x0006C2 },
+	/*  808 */ { 0x000000, 0x000000 },
+	/*  809 */ { 0x000654, 0x0006D3 },
+	/*  810 */ { 0x000000, 0x000000 },
+	/*  811 */ { 0x000654, 0x0006C0 },
+	/*  812 */ { 0x000000, 0x000000 },
+	/*  813 */ { 0x00093C, 0x000929 },
+	/*  814 */ { 0x000000, 0x000000 },
+	/*  815 */ { 0x00093C, 0x000931 },
+	/*  816 */ { 0x000000, 0x000000 },
+	/*  817 */ { 0x00093C, 0x000934 },
+	/*  818 */ { 0x000000, 0x000000 },
+	/*  819 */ { 0x0009BE, 0x0009CB },
+	/*  820 */ { 0x0009D7, 0x0009CC },
+	/*  821 */ { 0x000000, 0x000000 },
+	/*  822 */ { 0x000B3E, 0x000B4B },
+	/*  823 */ { 0x000B56, 0x000B48 },
+	/*  824 */ { 0x000B57, 0x000B4C },
+	/*  825 */ { 0x000000, 0x000000 },
+	/*  826 */ { 0x000BD7, 0x000B94 },
+	/*  827 */ { 0x000000, 0x000000 },
+	/*  828 */ { 0x000BBE, 0x000BCA },
+	/*  829 */ { 0x000BD7, 0x000BCC },
+	/*  830 */ { 0x000000, 0x000000 },
+	/*  831 */ { 0x000BBE, 0x000BCB },
+	/*  832 */ { 0x000000, 0x000000 },
+	/*  833 */ { 0x000C56, 0x000C48 },
+	/*  834 */ { 0x000000, 0x000000 },
+	/*  835 */ { 0x000CD5, 0x000CC0 },
+	/*  836 */ { 0x000000, 0x000000 },
+	/*  837 */ { 0x000CC2, 0x000CCA },
+	/*  838 */ { 0x000CD5, 0x000CC7 },
+	/*  839 */ { 0x000CD6, 0x000CC8 },
+	/*  840 */ { 0x000000, 0x000000 },
+	/*  841 */ { 0x000CD5, 0x000CCB },
+	/*  842 */ { 0x000000, 0x000000 },
+	/*  843 */ { 0x000D3E, 0x000D4A },
+	/*  844 */ { 0x000D57, 0x000D4C },
+	/*  845 */ { 0x000000, 0x000000 },
+	/*  846 */ { 0x000D3E, 0x000D4B },
+	/*  847 */ { 0x000000, 0x000000 },
+	/*  848 */ { 0x000DCA, 0x000DDA },
+	/*  849 */ { 0x000DCF, 0x000DDC },
+	/*  850 */ { 0x000DDF, 0x000DDE },
+	/*  851 */ { 0x000000, 0x000000 },
+	/*  852 */ { 0x000DCA, 0x000DDD },
+	/*  853 */ { 0x000000, 0x000000 },
+	/*  854 */ { 0x00102E, 0x001026 },
+	/*  855 */ { 0x000000, 0x000000 },
+	/*  856 */ { 0x001B35, 0x001B06 },
+	/*  857 */ { 0x000000, 0x000000 },
+	/*  858 */ { 0x001B35, 0x001B08 },
+	/*  859 */ { 0x000000, 0x000000 },
+	/*  860 */ { 0x001B35, 0x001B0A },
+	/*  861 */ { 0x000000, 0x000000 },
+	/*  862 */ { 0x001B35, 0x001B0C },
+	/*  863 */ { 0x000000, 0x000000 },
+	/*  864 */ { 0x001B35, 0x001B0E },
+	/*  865 */ { 0x000000, 0x000000 },
+	/*  866 */ { 0x001B35, 0x001B12 },
+	/*  867 */ { 0x000000, 0x000000 },
+	/*  868 */ { 0x001B35, 0x001B3B },
+	/*  869 */ { 0x000000, 0x000000 },
+	/*  870 */ { 0x001B35, 0x001B3D },
+	/*  871 */ { 0x000000, 0x000000 },
+	/*  872 */ { 0x001B35, 0x001B40 },
+	/*  873 */ { 0x000000, 0x000000 },
+	/*  874 */ { 0x001B35, 0x001B41 },
+	/*  875 */ { 0x000000, 0x000000 },
+	/*  876 */ { 0x001B35, 0x001B43 },
+	/*  877 */ { 0x000000, 0x000000 },
+	/*  878 */ { 0x000304, 0x001E38 },
+	/*  879 */ { 0x000000, 0x000000 },
+	/*  880 */ { 0x000304, 0x001E39 },
+	/*  881 */ { 0x000000, 0x000000 },
+	/*  882 */ { 0x000304, 0x001E5C },
+	/*  883 */ { 0x000000, 0x000000 },
+	/*  884 */ { 0x000304, 0x001E5D },
+	/*  885 */ { 0x000000, 0x000000 },
+	/*  886 */ { 0x000307, 0x001E68 },
+	/*  887 */ { 0x000000, 0x000000 },
+	/*  888 */ { 0x000307, 0x001E69 },
+	/*  889 */ { 0x000000, 0x000000 },
+	/*  890 */ { 0x000302, 0x001EAC },
+	/*  891 */ { 0x000306, 0x001EB6 },
+	/*  892 */ { 0x000000, 0x000000 },
+	/*  893 */ { 0x000302, 0x001EAD },
+	/*  894 */ { 0x000306, 0x001EB7 },
+	/*  895 */ { 0x000000, 0x000000 },
+	/*  896 */ { 0x000302, 0x001EC6 },
+	/*  897 */ { 0x000000, 0x000000 },
+	/*  898 */ { 0x000302, 0x001EC7 },
+	/*  899 */ { 0x000000, 0x000000 },
+	/*  900 */ { 0x000302, 0x001ED8 },
+	/*  901 */ { 0x000000, 0x000000 },
+	/*  902 */ { 0x000302, 0x001ED9 },
+	/*  903 */ { 0x000000, 0x000000 },
+	/*  904 */ { 0x000300, 0x001F02 },
+	/*  905 */ { 0x000301, 0x001F04 },
+	/*  906 */ { 0x000342, 0x001F06 },
+	/*  907 */ { 0x000345, 0x001F80 },
+	/*  908 */ { 0x000000, 0x000000 },
+	/*  909 */ { 0x000300, 0x001F03 },
+	/*  910 */ { 0x000301, 0x001F05 },
+	/*  911 */ { 0x000342, 0x001F07 },
+	/*  912 */ { 0x000345, 0x001F81 },
+	/*  913 */ { 0x000000, 0x000000 },
+	/*  914 */ { 0x000345, 0x001F82 },
+	/*  915 */ { 0x000000, 0x000000 },
+	/*  916 */ { 0x000345, 0x001F83 },
+	/*  917 */ { 0x000000, 0x000000 },
+	/*  918 */ { 0x000345, 0x001F84 },
+	/*  919 */ { 0x000000, 0x000000 },
+	/*  920 */ { 0x000345, 0x001F85 },
+	/*  921 */ { 0x000000, 0x000000 },
+	/*  922 */ { 0x000345, 0x001F86 },
+	/*  923 */ { 0x000000, 0x000000 },
+	/*  924 */ { 0x000345, 0x001F87 },
+	/*  925 */ { 0x000000, 0x000000 },
+	/*  926 */ { 0x000300, 0x001F0A },
+	/*  927 */ { 0x000301, 0x001F0C },
+	/*  928 */ { 0x000342, 0x001F0E },
+	/*  929 */ { 0x000345, 0x001F88 },
+	/*  930 */ { 0x000000, 0x000000 },
+	/*  931 */ { 0x000300, 0x001F0B },
+	/*  932 */ { 0x000301, 0x001F0D },
+	/*  933 */ { 0x000342, 0x001F0F },
+	/*  934 */ { 0x000345, 0x001F89 },
+	/*  935 */ { 0x000000, 0x000000 },
+	/*  936 */ { 0x000345, 0x001F8A },
+	/*  937 */ { 0x000000, 0x000000 },
+	/*  938 */ { 0x000345, 0x001F8B },
+	/*  939 */ { 0x000000, 0x000000 },
+	/*  940 */ { 0x000345, 0x001F8C },
+	/*  941 */ { 0x000000, 0x000000 },
+	/*  942 */ { 0x000345, 0x001F8D },
+	/*  943 */ { 0x000000, 0x000000 },
+	/*  944 */ { 0x000345, 0x001F8E },
+	/*  945 */ { 0x000000, 0x000000 },
+	/*  946 */ { 0x000345, 0x001F8F },
+	/*  947 */ { 0x000000, 0x000000 },
+	/*  948 */ { 0x000300, 0x001F12 },
+	/*  949 */ { 0x000301, 0x001F14 },
+	/*  950 */ { 0x000000, 0x000000 },
+	/*  951 */ { 0x000300, 0x001F13 },
+	/*  952 */ { 0x000301, 0x001F15 },
+	/*  953 */ { 0x000000, 0x000000 },
+	/*  954 */ { 0x000300, 0x001F1A },
+	/*  955 */ { 0x000301, 0x001F1C },
+	/*  956 */ { 0x000000, 0x000000 },
+	/*  957 */ { 0x000300, 0x001F1B },
+	/*  958 */ { 0x000301, 0x001F1D },
+	/*  959 */ { 0x000000, 0x000000 },
+	/*  960 */ { 0x000300, 0x001F22 },
+	/*  961 */ { 0x000301, 0x001F24 },
+	/*  962 */ { 0x000342, 0x001F26 },
+	/*  963 */ { 0x000345, 0x001F90 },
+	/*  964 */ { 0x000000, 0x000000 },
+	/*  965 */ { 0x000300, 0x001F23 },
+	/*  966 */ { 0x000301, 0x001F25 },
+	/*  967 */ { 0x000342, 0x001F27 },
+	/*  968 */ { 0x000345, 0x001F91 },
+	/*  969 */ { 0x000000, 0x000000 },
+	/*  970 */ { 0x000345, 0x001F92 },
+	/*  971 */ { 0x000000, 0x000000 },
+	/*  972 */ { 0x000345, 0x001F93 },
+	/*  973 */ { 0x000000, 0x000000 },
+	/*  974 */ { 0x000345, 0x001F94 },
+	/*  975 */ { 0x000000, 0x000000 },
+	/*  976 */ { 0x000345, 0x001F95 },
+	/*  977 */ { 0x000000, 0x000000 },
+	/*  978 */ { 0x000345, 0x001F96 },
+	/*  979 */ { 0x000000, 0x000000 },
+	/*  980 */ { 0x000345, 0x001F97 },
+	/*  981 */ { 0x000000, 0x000000 },
+	/*  982 */ { 0x000300, 0x001F2A },
+	/*  983 */ { 0x000301, 0x001F2C },
+	/*  984 */ { 0x000342, 0x001F2E },
+	/*  985 */ { 0x000345, 0x001F98 },
+	/*  986 */ { 0x000000, 0x000000 },
+	/*  987 */ { 0x000300, 0x001F2B },
+	/*  988 */ { 0x000301, 0x001F2D },
+	/*  989 */ { 0x000342, 0x001F2F },
+	/*  990 */ { 0x000345, 0x001F99 },
+	/*  991 */ { 0x000000, 0x000000 },
+	/*  992 */ { 0x000345, 0x001F9A },
+	/*  993 */ { 0x000000, 0x000000 },
+	/*  994 */ { 0x000345, 0x001F9B },
+	/*  995 */ { 0x000000, 0x000000 },
+	/*  996 */ { 0x000345, 0x001F9C },
+	/*  997 */ { 0x000000, 0x000000 },
+	/*  998 */ { 0x000345, 0x001F9D },
+	/*  999 */ { 0x000000, 0x000000 },
+	/* 1000 */ { 0x000345, 0x001F9E },
+	/* 1001 */ { 0x000000, 0x000000 },
+	/* 1002 */ { 0x000345, 0x001F9F },
+	/* 1003 */ { 0x000000, 0x000000 },
+	/* 1004 */ { 0x000300, 0x001F32 },
+	/* 1005 */ { 0x000301, 0x001F34 },
+	/* 1006 */ { 0x000342, 0x001F36 },
+	/* 1007 */ { 0x000000, 0x000000 },
+	/* 1008 */ { 0x000300, 0x001F33 },
+	/* 1009 */ { 0x000301, 0x001F35 },
+	/* 1010 */ { 0x000342, 0x001F37 },
+	/* 1011 */ { 0x000000, 0x000000 },
+	/* 1012 */ { 0x000300, 0x001F3A },
+	/* 1013 */ { 0x000301, 0x001F3C },
+	/* 1014 */ { 0x000342, 0x001F3E },
+	/* 1015 */ { 0x000000, 0x000000 },
+	/* 1016 */ { 0x000300, 0x001F3B },
+	/* 1017 */ { 0x000301, 0x001F3D },
+	/* 1018 */ { 0x000342, 0x001F3F },
+	/* 1019 */ { 0x000000, 0x000000 },
+	/* 1020 */ { 0x000300, 0x001F42 },
+	/* 1021 */ { 0x000301, 0x001F44 },
+	/* 1022 */ { 0x000000, 0x000000 },
+	/* 1023 */ { 0x000300, 0x001F43 },
+	/* 1024 */ { 0x000301, 0x001F45 },
+	/* 1025 */ { 0x000000, 0x000000 },
+	/* 1026 */ { 0x000300, 0x001F4A },
+	/* 1027 */ { 0x000301, 0x001F4C },
+	/* 1028 */ { 0x000000, 0x000000 },
+	/* 1029 */ { 0x000300, 0x001F4B },
+	/* 1030 */ { 0x000301, 0x001F4D },
+	/* 1031 */ { 0x000000, 0x000000 },
+	/* 1032 */ { 0x000300, 0x001F52 },
+	/* 1033 */ { 0x000301, 0x001F54 },
+	/* 1034 */ { 0x000342, 0x001F56 },
+	/* 1035 */ { 0x000000, 0x000000 },
+	/* 1036 */ { 0x000300, 0x001F53 },
+	/* 1037 */ { 0x000301, 0x001F55 },
+	/* 1038 */ { 0x000342, 0x001F57 },
+	/* 1039 */ { 0x000000, 0x000000 },
+	/* 1040 */ { 0x000300, 0x001F5B },
+	/* 1041 */ { 0x000301, 0x001F5D },
+	/* 1042 */ { 0x000342, 0x001F5F },
+	/* 1043 */ { 0x000000, 0x000000 },
+	/* 1044 */ { 0x000300, 0x001F62 },
+	/* 1045 */ { 0x000301, 0x001F64 },
+	/* 1046 */ { 0x000342, 0x001F66 },
+	/* 1047 */ { 0x000345, 0x001FA0 },
+	/* 1048 */ { 0x000000, 0x000000 },
+	/* 1049 */ { 0x000300, 0x001F63 },
+	/* 1050 */ { 0x000301, 0x001F65 },
+	/* 1051 */ { 0x000342, 0x001F67 },
+	/* 1052 */ { 0x000345, 0x001FA1 },
+	/* 1053 */ { 0x000000, 0x000000 },
+	/* 1054 */ { 0x000345, 0x001FA2 },
+	/* 1055 */ { 0x000000, 0x000000 },
+	/* 1056 */ { 0x000345, 0x001FA3 },
+	/* 1057 */ { 0x000000, 0x000000 },
+	/* 1058 */ { 0x000345, 0x001FA4 },
+	/* 1059 */ { 0x000000, 0x000000 },
+	/* 1060 */ { 0x000345, 0x001FA5 },
+	/* 1061 */ { 0x000000, 0x000000 },
+	/* 1062 */ { 0x000345, 0x001FA6 },
+	/* 1063 */ { 0x000000, 0x000000 },
+	/* 1064 */ { 0x000345, 0x001FA7 },
+	/* 1065 */ { 0x000000, 0x000000 },
+	/* 1066 */ { 0x000300, 0x001F6A },
+	/* 1067 */ { 0x000301, 0x001F6C },
+	/* 1068 */ { 0x000342, 0x001F6E },
+	/* 1069 */ { 0x000345, 0x001FA8 },
+	/* 1070 */ { 0x000000, 0x000000 },
+	/* 1071 */ { 0x000300, 0x001F6B },
+	/* 1072 */ { 0x000301, 0x001F6D },
+	/* 1073 */ { 0x000342, 0x001F6F },
+	/* 1074 */ { 0x000345, 0x001FA9 },
+	/* 1075 */ { 0x000000, 0x000000 },
+	/* 1076 */ { 0x000345, 0x001FAA },
+	/* 1077 */ { 0x000000, 0x000000 },
+	/* 1078 */ { 0x000345, 0x001FAB },
+	/* 1079 */ { 0x000000, 0x000000 },
+	/* 1080 */ { 0x000345, 0x001FAC },
+	/* 1081 */ { 0x000000, 0x000000 },
+	/* 1082 */ { 0x000345, 0x001FAD },
+	/* 1083 */ { 0x000000, 0x000000 },
+	/* 1084 */ { 0x000345, 0x001FAE },
+	/* 1085 */ { 0x000000, 0x000000 },
+	/* 1086 */ { 0x000345, 0x001FAF },
+	/* 1087 */ { 0x000000, 0x000000 },
+	/* 1088 */ { 0x000345, 0x001FB2 },
+	/* 1089 */ { 0x000000, 0x000000 },
+	/* 1090 */ { 0x000345, 0x001FC2 },
+	/* 1091 */ { 0x000000, 0x000000 },
+	/* 1092 */ { 0x000345, 0x001FF2 },
+	/* 1093 */ { 0x000000, 0x000000 },
+	/* 1094 */ { 0x000345, 0x001FB7 },
+	/* 1095 */ { 0x000000, 0x000000 },
+	/* 1096 */ { 0x000300, 0x001FCD },
+	/* 1097 */ { 0x000301, 0x001FCE },
+	/* 1098 */ { 0x000342, 0x001FCF },
+	/* 1099 */ { 0x000000, 0x000000 },
+	/* 1100 */ { 0x000345, 0x001FC7 },
+	/* 1101 */ { 0x000000, 0x000000 },
+	/* 1102 */ { 0x000345, 0x001FF7 },
+	/* 1103 */ { 0x000000, 0x000000 },
+	/* 1104 */ { 0x000300, 0x001FDD },
+	/* 1105 */ { 0x000301, 0x001FDE },
+	/* 1106 */ { 0x000342, 0x001FDF },
+	/* 1107 */ { 0x000000, 0x000000 },
+	/* 1108 */ { 0x000338, 0x00219A },
+	/* 1109 */ { 0x000000, 0x000000 },
+	/* 1110 */ { 0x000338, 0x00219B },
+	/* 1111 */ { 0x000000, 0x000000 },
+	/* 1112 */ { 0x000338, 0x0021AE },
+	/* 1113 */ { 0x000000, 0x000000 },
+	/* 1114 */ { 0x000338, 0x0021CD },
+	/* 1115 */ { 0x000000, 0x000000 },
+	/* 1116 */ { 0x000338, 0x0021CF },
+	/* 1117 */ { 0x000000, 0x000000 },
+	/* 1118 */ { 0x000338, 0x0021CE },
+	/* 1119 */ { 0x000000, 0x000000 },
+	/* 1120 */ { 0x000338, 0x002204 },
+	/* 1121 */ { 0x000000, 0x000000 },
+	/* 1122 */ { 0x000338, 0x002209 },
+	/* 1123 */ { 0x000000, 0x000000 },
+	/* 1124 */ { 0x000338, 0x00220C },
+	/* 1125 */ { 0x000000, 0x000000 },
+	/* 1126 */ { 0x000338, 0x002224 },
+	/* 1127 */ { 0x000000, 0x000000 },
+	/* 1128 */ { 0x000338, 0x002226 },
+	/* 1129 */ { 0x000000, 0x000000 },
+	/* 1130 */ { 0x000338, 0x002241 },
+	/* 1131 */ { 0x000000, 0x000000 },
+	/* 1132 */ { 0x000338, 0x002244 },
+	/* 1133 */ { 0x000000, 0x000000 },
+	/* 1134 */ { 0x000338, 0x002247 },
+	/* 1135 */ { 0x000000, 0x000000 },
+	/* 1136 */ { 0x000338, 0x002249 },
+	/* 1137 */ { 0x000000, 0x000000 },
+	/* 1138 */ { 0x000338, 0x00226D },
+	/* 1139 */ { 0x000000, 0x000000 },
+	/* 1140 */ { 0x000338, 0x002262 },
+	/* 1141 */ { 0x000000, 0x000000 },
+	/* 1142 */ { 0x000338, 0x002270 },
+	/* 1143 */ { 0x000000, 0x000000 },
+	/* 1144 */ { 0x000338, 0x002271 },
+	/* 1145 */ { 0x000000, 0x000000 },
+	/* 1146 */ { 0x000338, 0x002274 },
+	/* 1147 */ { 0x000000, 0x000000 },
+	/* 1148 */ { 0x000338, 0x002275 },
+	/* 1149 */ { 0x000000, 0x000000 },
+	/* 1150 */ { 0x000338, 0x002278 },
+	/* 1151 */ { 0x000000, 0x000000 },
+	/* 1152 */ { 0x000338, 0x002279 },
+	/* 1153 */ { 0x000000, 0x000000 },
+	/* 1154 */ { 0x000338, 0x002280 },
+	/* 1155 */ { 0x000000, 0x000000 },
+	/* 1156 */ { 0x000338, 0x002281 },
+	/* 1157 */ { 0x000000, 0x000000 },
+	/* 1158 */ { 0x000338, 0x0022E0 },
+	/* 1159 */ { 0x000000, 0x000000 },
+	/* 1160 */ { 0x000338, 0x0022E1 },
+	/* 1161 */ { 0x000000, 0x000000 },
+	/* 1162 */ { 0x000338, 0x002284 },
+	/* 1163 */ { 0x000000, 0x000000 },
+	/* 1164 */ { 0x000338, 0x002285 },
+	/* 1165 */ { 0x000000, 0x000000 },
+	/* 1166 */ { 0x000338, 0x002288 },
+	/* 1167 */ { 0x000000, 0x000000 },
+	/* 1168 */ { 0x000338, 0x002289 },
+	/* 1169 */ { 0x000000, 0x000000 },
+	/* 1170 */ { 0x000338, 0x0022E2 },
+	/* 1171 */ { 0x000000, 0x000000 },
+	/* 1172 */ { 0x000338, 0x0022E3 },
+	/* 1173 */ { 0x000000, 0x000000 },
+	/* 1174 */ { 0x000338, 0x0022AC },
+	/* 1175 */ { 0x000000, 0x000000 },
+	/* 1176 */ { 0x000338, 0x0022AD },
+	/* 1177 */ { 0x000000, 0x000000 },
+	/* 1178 */ { 0x000338, 0x0022AE },
+	/* 1179 */ { 0x000000, 0x000000 },
+	/* 1180 */ { 0x000338, 0x0022AF },
+	/* 1181 */ { 0x000000, 0x000000 },
+	/* 1182 */ { 0x000338, 0x0022EA },
+	/* 1183 */ { 0x000000, 0x000000 },
+	/* 1184 */ { 0x000338, 0x0022EB },
+	/* 1185 */ { 0x000000, 0x000000 },
+	/* 1186 */ { 0x000338, 0x0022EC },
+	/* 1187 */ { 0x000000, 0x000000 },
+	/* 1188 */ { 0x000338, 0x0022ED },
+	/* 1189 */ { 0x000000, 0x000000 },
+	/* 1190 */ { 0x003099, 0x003094 },
+	/* 1191 */ { 0x000000, 0x000000 },
+	/* 1192 */ { 0x003099, 0x00304C },
+	/* 1193 */ { 0x000000, 0x000000 },
+	/* 1194 */ { 0x003099, 0x00304E },
+	/* 1195 */ { 0x000000, 0x000000 },
+	/* 1196 */ { 0x003099, 0x003050 },
+	/* 1197 */ { 0x000000, 0x000000 },
+	/* 1198 */ { 0x003099, 0x003052 },
+	/* 1199 */ { 0x000000, 0x000000 },
+	/* 1200 */ { 0x003099, 0x003054 },
+	/* 1201 */ { 0x000000, 0x000000 },
+	/* 1202 */ { 0x003099, 0x003056 },
+	/* 1203 */ { 0x000000, 0x000000 },
+	/* 1204 */ { 0x003099, 0x003058 },
+	/* 1205 */ { 0x000000, 0x000000 },
+	/* 1206 */ { 0x003099, 0x00305A },
+	/* 1207 */ { 0x000000, 0x000000 },
+	/* 1208 */ { 0x003099, 0x00305C },
+	/* 1209 */ { 0x000000, 0x000000 },
+	/* 1210 */ { 0x003099, 0x00305E },
+	/* 1211 */ { 0x000000, 0x000000 },
+	/* 1212 */ { 0x003099, 0x003060 },
+	/* 1213 */ { 0x000000, 0x000000 },
+	/* 1214 */ { 0x003099, 0x003062 },
+	/* 1215 */ { 0x000000, 0x000000 },
+	/* 1216 */ { 0x003099, 0x003065 },
+	/* 1217 */ { 0x000000, 0x000000 },
+	/* 1218 */ { 0x003099, 0x003067 },
+	/* 1219 */ { 0x000000, 0x000000 },
+	/* 1220 */ { 0x003099, 0x003069 },
+	/* 1221 */ { 0x000000, 0x000000 },
+	/* 1222 */ { 0x003099, 0x003070 },
+	/* 1223 */ { 0x00309A, 0x003071 },
+	/* 1224 */ { 0x000000, 0x000000 },
+	/* 1225 */ { 0x003099, 0x003073 },
+	/* 1226 */ { 0x00309A, 0x003074 },
+	/* 1227 */ { 0x000000, 0x000000 },
+	/* 1228 */ { 0x003099, 0x003076 },
+	/* 1229 */ { 0x00309A, 0x003077 },
+	/* 1230 */ { 0x000000, 0x000000 },
+	/* 1231 */ { 0x003099, 0x003079 },
+	/* 1232 */ { 0x00309A, 0x00307A },
+	/* 1233 */ { 0x000000, 0x000000 },
+	/* 1234 */ { 0x003099, 0x00307C },
+	/* 1235 */ { 0x00309A, 0x00307D },
+	/* 1236 */ { 0x000000, 0x000000 },
+	/* 1237 */ { 0x003099, 0x00309E },
+	/* 1238 */ { 0x000000, 0x000000 },
+	/* 1239 */ { 0x003099, 0x0030F4 },
+	/* 1240 */ { 0x000000, 0x000000 },
+	/* 1241 */ { 0x003099, 0x0030AC },
+	/* 1242 */ { 0x000000, 0x000000 },
+	/* 1243 */ { 0x003099, 0x0030AE },
+	/* 1244 */ { 0x000000, 0x000000 },
+	/* 1245 */ { 0x003099, 0x0030B0 },
+	/* 1246 */ { 0x000000, 0x000000 },
+	/* 1247 */ { 0x003099, 0x0030B2 },
+	/* 1248 */ { 0x000000, 0x000000 },
+	/* 1249 */ { 0x003099, 0x0030B4 },
+	/* 1250 */ { 0x000000, 0x000000 },
+	/* 1251 */ { 0x003099, 0x0030B6 },
+	/* 1252 */ { 0x000000, 0x000000 },
+	/* 1253 */ { 0x003099, 0x0030B8 },
+	/* 1254 */ { 0x000000, 0x000000 },
+	/* 1255 */ { 0x003099, 0x0030BA },
+	/* 1256 */ { 0x000000, 0x000000 },
+	/* 1257 */ { 0x003099, 0x0030BC },
+	/* 1258 */ { 0x000000, 0x000000 },
+	/* 1259 */ { 0x003099, 0x0030BE },
+	/* 1260 */ { 0x000000, 0x000000 },
+	/* 1261 */ { 0x003099, 0x0030C0 },
+	/* 1262 */ { 0x000000, 0x000000 },
+	/* 1263 */ { 0x003099, 0x0030C2 },
+	/* 1264 */ { 0x000000, 0x000000 },
+	/* 1265 */ { 0x003099, 0x0030C5 },
+	/* 1266 */ { 0x000000, 0x000000 },
+	/* 1267 */ { 0x003099, 0x0030C7 },
+	/* 1268 */ { 0x000000, 0x000000 },
+	/* 1269 */ { 0x003099, 0x0030C9 },
+	/* 1270 */ { 0x000000, 0x000000 },
+	/* 1271 */ { 0x003099, 0x0030D0 },
+	/* 1272 */ { 0x00309A, 0x0030D1 },
+	/* 1273 */ { 0x000000, 0x000000 },
+	/* 1274 */ { 0x003099, 0x0030D3 },
+	/* 1275 */ { 0x00309A, 0x0030D4 },
+	/* 1276 */ { 0x000000, 0x000000 },
+	/* 1277 */ { 0x003099, 0x0030D6 },
+	/* 1278 */ { 0x00309A, 0x0030D7 },
+	/* 1279 */ { 0x000000, 0x000000 },
+	/* 1280 */ { 0x003099, 0x0030D9 },
+	/* 1281 */ { 0x00309A, 0x0030DA },
+	/* 1282 */ { 0x000000, 0x000000 },
+	/* 1283 */ { 0x003099, 0x0030DC },
+	/* 1284 */ { 0x00309A, 0x0030DD },
+	/* 1285 */ { 0x000000, 0x000000 },
+	/* 1286 */ { 0x003099, 0x0030F7 },
+	/* 1287 */ { 0x000000, 0x000000 },
+	/* 1288 */ { 0x003099, 0x0030F8 },
+	/* 1289 */ { 0x000000, 0x000000 },
+	/* 1290 */ { 0x003099, 0x0030F9 },
+	/* 1291 */ { 0x000000, 0x000000 },
+	/* 1292 */ { 0x003099, 0x0030FA },
+	/* 1293 */ { 0x000000, 0x000000 },
+	/* 1294 */ { 0x003099, 0x0030FE },
+	/* 1295 */ { 0x000000, 0x000000 },
+	/* 1296 */ { 0x0110BA, 0x01109A },
+	/* 1297 */ { 0x000000, 0x000000 },
+	/* 1298 */ { 0x0110BA, 0x01109C },
+	/* 1299 */ { 0x000000, 0x000000 },
+	/* 1300 */ { 0x0110BA, 0x0110AB },
+	/* 1301 */ { 0x000000, 0x000000 },
+	/* 1302 */ { 0x011127, 0x01112E },
+	/* 1303 */ { 0x000000, 0x000000 },
+	/* 1304 */ { 0x011127, 0x01112F },
+	/* 1305 */ { 0x000000, 0x000000 },
+	/* 1306 */ { 0x01133E, 0x01134B },
+	/* 1307 */ { 0x011357, 0x01134C },
+	/* 1308 */ { 0x000000, 0x000000 },
+	/* 1309 */ { 0x0114B0, 0x0114BC },
+	/* 1310 */ { 0x0114BA, 0x0114BB },
+	/* 1311 */ { 0x0114BD, 0x0114BE },
+	/* 1312 */ { 0x000000, 0x000000 },
+	/* 1313 */ { 0x0115AF, 0x0115BA },
+	/* 1314 */ { 0x000000, 0x000000 },
+	/* 1315 */ { 0x0115AF, 0x0115BB },
+	/* 1316 */ { 0x000000, 0x000000 },
+};
+
+static const normalization_record records[] =
+{
+	/*    0 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*    1 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1 },
+	/*    2 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 3 },
+	/*    3 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 5 },
+	/*    4 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 7 },
+	/*    5 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 24 },
+	/*    6 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 28 },
+	/*    7 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 34 },
+	/*    8 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 41 },
+	/*    9 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 59 },
+	/*   10 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 61 },
+	/*   11 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 69 },
+	/*   12 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 77 },
+	/*   13 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 93 },
+	/*   14 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 95 },
+	/*   15 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 101 },
+	/*   16 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 108 },
+	/*   17 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 112 },
+	/*   18 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 122 },
+	/*   19 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 139 },
+	/*   20 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 142 },
+	/*   21 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 151 },
+	/*   22 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 159 },
+	/*   23 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 167 },
+	/*   24 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 187 },
+	/*   25 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 190 },
+	/*   26 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 197 },
+	/*   27 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 200 },
+	/*   28 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 210 },
+	/*   29 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 217 },
+	/*   30 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 234 },
+	/*   31 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 238 },
+	/*   32 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 244 },
+	/*   33 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 251 },
+	/*   34 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 269 },
+	/*   35 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 271 },
+	/*   36 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 279 },
+	/*   37 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 288 },
+	/*   38 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 303 },
+	/*   39 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 306 },
+	/*   40 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 312 },
+	/*   41 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 319 },
+	/*   42 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 323 },
+	/*   43 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 333 },
+	/*   44 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 350 },
+	/*   45 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 353 },
+	/*   46 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 362 },
+	/*   47 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 370 },
+	/*   48 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 379 },
+	/*   49 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 399 },
+	/*   50 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 402 },
+	/*   51 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 410 },
+	/*   52 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 413 },
+	/*   53 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 424 },
+	/*   54 */ { 0, 0x50, { 0, 1 }, { 0, 1 }, 0 },
+	/*   55 */ { 0, 0x50, { 0, 2 }, { 0, 2 }, 431 },
+	/*   56 */ { 0, 0x50, { 0, 1 }, { 0, 4 }, 0 },
+	/*   57 */ { 0, 0x50, { 0, 2 }, { 0, 5 }, 0 },
+	/*   58 */ { 0, 0x50, { 0, 1 }, { 0, 7 }, 0 },
+	/*   59 */ { 0, 0x50, { 0, 1 }, { 0, 8 }, 0 },
+	/*   60 */ { 0, 0x50, { 0, 2 }, { 0, 9 }, 0 },
+	/*   61 */ { 0, 0x50, { 0, 1 }, { 0, 11 }, 0 },
+	/*   62 */ { 0, 0x50, { 0, 2 }, { 0, 12 }, 0 },
+	/*   63 */ { 0, 0x50, { 0, 1 }, { 0, 14 }, 0 },
+	/*   64 */ { 0, 0x50, { 0, 1 }, { 0, 15 }, 0 },
+	/*   65 */ { 0, 0x50, { 0, 3 }, { 0, 16 }, 0 },
+	/*   66 */ { 0, 0x50, { 0, 3 }, { 0, 19 }, 0 },
+	/*   67 */ { 0, 0x50, { 0, 3 }, { 0, 22 }, 0 },
+	/*   68 */ { 0, 0x44, { 2, 2 }, { 25, 25 }, 0 },
+	/*   69 */ { 0, 0x44, { 2, 2 }, { 27, 27 }, 0 },
+	/*   70 */ { 0, 0x44, { 2, 2 }, { 29, 29 }, 435 },
+	/*   71 */ { 0, 0x44, { 2, 2 }, { 31, 31 }, 0 },
+	/*   72 */ { 0, 0x44, { 2, 2 }, { 33, 33 }, 440 },
+	/*   73 */ { 0, 0x44, { 2, 2 }, { 35, 35 }, 442 },
+	/*   74 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 444 },
+	/*   75 */ { 0, 0x44, { 2, 2 }, { 37, 37 }, 447 },
+	/*   76 */ { 0, 0x44, { 2, 2 }, { 39, 39 }, 0 },
+	/*   77 */ { 0, 0x44, { 2, 2 }, { 41, 41 }, 0 },
+	/*   78 */ { 0, 0x44, { 2, 2 }, { 43, 43 }, 449 },
+	/*   79 */ { 0, 0x44, { 2, 2 }, { 45, 45 }, 0 },
+	/*   80 */ { 0, 0x44, { 2, 2 }, { 47, 47 }, 0 },
+	/*   81 */ { 0, 0x44, { 2, 2 }, { 49, 49 }, 0 },
+	/*   82 */ { 0, 0x44, { 2, 2 }, { 51, 51 }, 0 },
+	/*   83 */ { 0, 0x44, { 2, 2 }, { 53, 53 }, 454 },
+	/*   84 */ { 0, 0x44, { 2, 2 }, { 55, 55 }, 0 },
+	/*   85 */ { 0, 0x44, { 2, 2 }, { 57, 57 }, 0 },
+	/*   86 */ { 0, 0x44, { 2, 2 }, { 59, 59 }, 0 },
+	/*   87 */ { 0, 0x44, { 2, 2 }, { 61, 61 }, 456 },
+	/*   88 */ { 0, 0x44, { 2, 2 }, { 63, 63 }, 461 },
+	/*   89 */ { 0, 0x44, { 2, 2 }, { 65, 65 }, 465 },
+	/*   90 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 467 },
+	/*   91 */ { 0, 0x44, { 2, 2 }, { 67, 67 }, 0 },
+	/*   92 */ { 0, 0x44, { 2, 2 }, { 69, 69 }, 0 },
+	/*   93 */ { 0, 0x44, { 2, 2 }, { 71, 71 }, 0 },
+	/*   94 */ { 0, 0x44, { 2, 2 }, { 73, 73 }, 469 },
+	/*   95 */ { 0, 0x44, { 2, 2 }, { 75, 75 }, 0 },
+	/*   96 */ { 0, 0x44, { 2, 2 }, { 77, 77 }, 0 },
+	/*   97 */ { 0, 0x44, { 2, 2 }, { 79, 79 }, 0 },
+	/*   98 */ { 0, 0x44, { 2, 2 }, { 81, 81 }, 474 },
+	/*   99 */ { 0, 0x44, { 2, 2 }, { 83, 83 }, 0 },
+	/*  100 */ { 0, 0x44, { 2, 2 }, { 85, 85 }, 479 },
+	/*  101 */ { 0, 0x44, { 2, 2 }, { 87, 87 }, 481 },
+	/*  102 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 483 },
+	/*  103 */ { 0, 0x44, { 2, 2 }, { 89, 89 }, 486 },
+	/*  104 */ { 0, 0x44, { 2, 2 }, { 91, 91 }, 0 },
+	/*  105 */ { 0, 0x44, { 2, 2 }, { 93, 93 }, 0 },
+	/*  106 */ { 0, 0x44, { 2, 2 }, { 95, 95 }, 488 },
+	/*  107 */ { 0, 0x44, { 2, 2 }, { 97, 97 }, 0 },
+	/*  108 */ { 0, 0x44, { 2, 2 }, { 99, 99 }, 0 },
+	/*  109 */ { 0, 0x44, { 2, 2 }, { 101, 101 }, 0 },
+	/*  110 */ { 0, 0x44, { 2, 2 }, { 103, 103 }, 0 },
+	/*  111 */ { 0, 0x44, { 2, 2 }, { 105, 105 }, 493 },
+	/*  112 */ { 0, 0x44, { 2, 2 }, { 107, 107 }, 0 },
+	/*  113 */ { 0, 0x44, { 2, 2 }, { 109, 109 }, 0 },
+	/*  114 */ { 0, 0x44, { 2, 2 }, { 111, 111 }, 0 },
+	/*  115 */ { 0, 0x44, { 2, 2 }, { 113, 113 }, 495 },
+	/*  116 */ { 0, 0x44, { 2, 2 }, { 115, 115 }, 500 },
+	/*  117 */ { 0, 0x44, { 2, 2 }, { 117, 117 }, 504 },
+	/*  118 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 506 },
+	/*  119 */ { 0, 0x44, { 2, 2 }, { 119, 119 }, 0 },
+	/*  120 */ { 0, 0x44, { 2, 2 }, { 121, 121 }, 0 },
+	/*  121 */ { 0, 0x44, { 2, 2 }, { 123, 123 }, 0 },
+	/*  122 */ { 0, 0x44, { 2, 2 }, { 125, 125 }, 508 },
+	/*  123 */ { 0, 0x44, { 2, 2 }, { 127, 127 }, 0 },
+	/*  124 */ { 0, 0x44, { 2, 2 }, { 129, 129 }, 0 },
+	/*  125 */ { 0, 0x44, { 2, 2 }, { 131, 131 }, 0 },
+	/*  126 */ { 0, 0x44, { 2, 2 }, { 133, 133 }, 0 },
+	/*  127 */ { 0, 0x44, { 2, 2 }, { 135, 135 }, 513 },
+	/*  128 */ { 0, 0x44, { 2, 2 }, { 137, 137 }, 518 },
+	/*  129 */ { 0, 0x44, { 2, 2 }, { 139, 139 }, 0 },
+	/*  130 */ { 0, 0x44, { 2, 2 }, { 141, 141 }, 0 },
+	/*  131 */ { 0, 0x44, { 2, 2 }, { 143, 143 }, 0 },
+	/*  132 */ { 0, 0x44, { 2, 2 }, { 145, 145 }, 0 },
+	/*  133 */ { 0, 0x44, { 2, 2 }, { 147, 147 }, 0 },
+	/*  134 */ { 0, 0x44, { 2, 2 }, { 149, 149 }, 0 },
+	/*  135 */ { 0, 0x44, { 2, 2 }, { 151, 151 }, 0 },
+	/*  136 */ { 0, 0x44, { 2, 2 }, { 153, 153 }, 0 },
+	/*  137 */ { 0, 0x44, { 2, 2 }, { 155, 155 }, 0 },
+	/*  138 */ { 0, 0x44, { 2, 2 }, { 157, 157 }, 0 },
+	/*  139 */ { 0, 0x44, { 2, 2 }, { 159, 159 }, 0 },
+	/*  140 */ { 0, 0x44, { 2, 2 }, { 161, 161 }, 0 },
+	/*  141 */ { 0, 0x44, { 2, 2 }, { 163, 163 }, 523 },
+	/*  142 */ { 0, 0x44, { 2, 2 }, { 165, 165 }, 526 },
+	/*  143 */ { 0, 0x44, { 2, 2 }, { 167, 167 }, 0 },
+	/*  144 */ { 0, 0x44, { 2, 2 }, { 169, 169 }, 0 },
+	/*  145 */ { 0, 0x44, { 2, 2 }, { 171, 171 }, 0 },
+	/*  146 */ { 0, 0x44, { 2, 2 }, { 173, 173 }, 0 },
+	/*  147 */ { 0, 0x44, { 2, 2 }, { 175, 175 }, 0 },
+	/*  148 */ { 0, 0x44, { 2, 2 }, { 177, 177 }, 0 },
+	/*  149 */ { 0, 0x44, { 2, 2 }, { 179, 179 }, 0 },
+	/*  150 */ { 0, 0x44, { 2, 2 }, { 181, 181 }, 0 },
+	/*  151 */ { 0, 0x44, { 2, 2 }, { 183, 183 }, 0 },
+	/*  152 */ { 0, 0x44, { 2, 2 }, { 185, 185 }, 0 },
+	/*  153 */ { 0, 0x44, { 2, 2 }, { 187, 187 }, 0 },
+	/*  154 */ { 0, 0x44, { 2, 2 }, { 189, 189 }, 0 },
+	/*  155 */ { 0, 0x44, { 2, 2 }, { 191, 191 }, 0 },
+	/*  156 */ { 0, 0x44, { 2, 2 }, { 193, 193 }, 0 },
+	/*  157 */ { 0, 0x44, { 2, 2 }, { 195, 195 }, 0 },
+	/*  158 */ { 0, 0x44, { 2, 2 }, { 197, 197 }, 0 },
+	/*  159 */ { 0, 0x44, { 2, 2 }, { 199, 199 }, 0 },
+	/*  160 */ { 0, 0x44, { 2, 2 }, { 201, 201 }, 0 },
+	/*  161 */ { 0, 0x44, { 2, 2 }, { 203, 203 }, 0 },
+	/*  162 */ { 0, 0x44, { 2, 2 }, { 205, 205 }, 0 },
+	/*  163 */ { 0, 0x44, { 2, 2 }, { 207, 207 }, 0 },
+	/*  164 */ { 0, 0x44, { 2, 2 }, { 209, 209 }, 0 },
+	/*  165 */ { 0, 0x44, { 2, 2 }, { 211, 211 }, 0 },
+	/*  166 */ { 0, 0x44, { 2, 2 }, { 213, 213 }, 0 },
+	/*  167 */ { 0, 0x44, { 2, 2 }, { 215, 215 }, 0 },
+	/*  168 */ { 0, 0x44, { 2, 2 }, { 217, 217 }, 0 },
+	/*  169 */ { 0, 0x44, { 2, 2 }, { 219, 219 }, 0 },
+	/*  170 */ { 0, 0x50, { 0, 2 }, { 0, 221 }, 0 },
+	/*  171 */ { 0, 0x50, { 0, 2 }, { 0, 223 }, 0 },
+	/*  172 */ { 0, 0x44, { 2, 2 }, { 225, 225 }, 0 },
+	/*  173 */ { 0, 0x44, { 2, 2 }, { 227, 227 }, 0 },
+	/*  174 */ { 0, 0x44, { 2, 2 }, { 229, 229 }, 0 },
+	/*  175 */ { 0, 0x44, { 2, 2 }, { 231, 231 }, 0 },
+	/*  176 */ { 0, 0x44, { 2, 2 }, { 233, 233 }, 0 },
+	/*  177 */ { 0, 0x44, { 2, 2 }, { 235, 235 }, 0 },
+	/*  178 */ { 0, 0x44, { 2, 2 }, { 237, 237 }, 0 },
+	/*  179 */ { 0, 0x44, { 2, 2 }, { 239, 239 }, 0 },
+	/*  180 */ { 0, 0x44, { 2, 2 }, { 241, 241 }, 0 },
+	/*  181 */ { 0, 0x44, { 2, 2 }, { 243, 243 }, 0 },
+	/*  182 */ { 0, 0x50, { 0, 2 }, { 0, 245 }, 0 },
+	/*  183 */ { 0, 0x50, { 0, 2 }, { 0, 247 }, 0 },
+	/*  184 */ { 0, 0x44, { 2, 2 }, { 249, 249 }, 0 },
+	/*  185 */ { 0, 0x44, { 2, 2 }, { 251, 251 }, 0 },
+	/*  186 */ { 0, 0x44, { 2, 2 }, { 253, 253 }, 0 },
+	/*  187 */ { 0, 0x44, { 2, 2 }, { 255, 255 }, 0 },
+	/*  188 */ { 0, 0x44, { 2, 2 }, { 257, 257 }, 0 },
+	/*  189 */ { 0, 0x44, { 2, 2 }, { 259, 259 }, 0 },
+	/*  190 */ { 0, 0x50, { 0, 2 }, { 0, 261 }, 0 },
+	/*  191 */ { 0, 0x44, { 2, 2 }, { 263, 263 }, 529 },
+	/*  192 */ { 0, 0x44, { 2, 2 }, { 265, 265 }, 532 },
+	/*  193 */ { 0, 0x44, { 2, 2 }, { 267, 267 }, 0 },
+	/*  194 */ { 0, 0x44, { 2, 2 }, { 269, 269 }, 0 },
+	/*  195 */ { 0, 0x44, { 2, 2 }, { 271, 271 }, 0 },
+	/*  196 */ { 0, 0x44, { 2, 2 }, { 273, 273 }, 0 },
+	/*  197 */ { 0, 0x44, { 2, 2 }, { 275, 275 }, 0 },
+	/*  198 */ { 0, 0x44, { 2, 2 }, { 277, 277 }, 0 },
+	/*  199 */ { 0, 0x44, { 2, 2 }, { 279, 279 }, 0 },
+	/*  200 */ { 0, 0x44, { 2, 2 }, { 281, 281 }, 0 },
+	/*  201 */ { 0, 0x44, { 2, 2 }, { 283, 283 }, 0 },
+	/*  202 */ { 0, 0x44, { 2, 2 }, { 285, 285 }, 0 },
+	/*  203 */ { 0, 0x44, { 2, 2 }, { 287, 287 }, 535 },
+	/*  204 */ { 0, 0x44, { 2, 2 }, { 289, 289 }, 537 },
+	/*  205 */ { 0, 0x44, { 2, 2 }, { 291, 291 }, 0 },
+	/*  206 */ { 0, 0x44, { 2, 2 }, { 293, 293 }, 0 },
+	/*  207 */ { 0, 0x44, { 2, 2 }, { 295, 295 }, 0 },
+	/*  208 */ { 0, 0x44, { 2, 2 }, { 297, 297 }, 0 },
+	/*  209 */ { 0, 0x44, { 2, 2 }, { 299, 299 }, 539 },
+	/*  210 */ { 0, 0x44, { 2, 2 }, { 301, 301 }, 541 },
+	/*  211 */ { 0, 0x44, { 2, 2 }, { 303, 303 }, 0 },
+	/*  212 */ { 0, 0x44, { 2, 2 }, { 305, 305 }, 0 },
+	/*  213 */ { 0, 0x44, { 2, 2 }, { 307, 307 }, 0 },
+	/*  214 */ { 0, 0x44, { 2, 2 }, { 309, 309 }, 0 },
+	/*  215 */ { 0, 0x44, { 2, 2 }, { 311, 311 }, 543 },
+	/*  216 */ { 0, 0x44, { 2, 2 }, { 313, 313 }, 545 },
+	/*  217 */ { 0, 0x44, { 2, 2 }, { 315, 315 }, 547 },
+	/*  218 */ { 0, 0x44, { 2, 2 }, { 317, 317 }, 549 },
+	/*  219 */ { 0, 0x44, { 2, 2 }, { 319, 319 }, 0 },
+	/*  220 */ { 0, 0x44, { 2, 2 }, { 321, 321 }, 0 },
+	/*  221 */ { 0, 0x44, { 2, 2 }, { 323, 323 }, 0 },
+	/*  222 */ { 0, 0x44, { 2, 2 }, { 325, 325 }, 0 },
+	/*  223 */ { 0, 0x44, { 2, 2 }, { 327, 327 }, 0 },
+	/*  224 */ { 0, 0x44, { 2, 2 }, { 329, 329 }, 0 },
+	/*  225 */ { 0, 0x44, { 2, 2 }, { 331, 331 }, 0 },
+	/*  226 */ { 0, 0x44, { 2, 2 }, { 333, 333 }, 0 },
+	/*  227 */ { 0, 0x44, { 2, 2 }, { 335, 335 }, 0 },
+	/*  228 */ { 0, 0x44, { 2, 2 }, { 337, 337 }, 0 },
+	/*  229 */ { 0, 0x44, { 2, 2 }, { 339, 339 }, 0 },
+	/*  230 */ { 0, 0x44, { 2, 2 }, { 341, 341 }, 0 },
+	/*  231 */ { 0, 0x44, { 2, 2 }, { 343, 343 }, 0 },
+	/*  232 */ { 0, 0x44, { 2, 2 }, { 345, 345 }, 0 },
+	/*  233 */ { 0, 0x44, { 2, 2 }, { 347, 347 }, 0 },
+	/*  234 */ { 0, 0x44, { 2, 2 }, { 349, 349 }, 0 },
+	/*  235 */ { 0, 0x44, { 2, 2 }, { 351, 351 }, 0 },
+	/*  236 */ { 0, 0x44, { 2, 2 }, { 353, 353 }, 0 },
+	/*  237 */ { 0, 0x44, { 2, 2 }, { 355, 355 }, 0 },
+	/*  238 */ { 0, 0x50, { 0, 1 }, { 0, 357 }, 551 },
+	/*  239 */ { 0, 0x44, { 2, 2 }, { 358, 358 }, 553 },
+	/*  240 */ { 0, 0x44, { 2, 2 }, { 360, 360 }, 559 },
+	/*  241 */ { 0, 0x44, { 2, 2 }, { 362, 362 }, 565 },
+	/*  242 */ { 0, 0x44, { 2, 2 }, { 364, 364 }, 571 },
+	/*  243 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 577 },
+	/*  244 */ { 0, 0x50, { 0, 3 }, { 0, 366 }, 0 },
+	/*  245 */ { 0, 0x50, { 0, 3 }, { 0, 369 }, 0 },
+	/*  246 */ { 0, 0x50, { 0, 3 }, { 0, 372 }, 0 },
+	/*  247 */ { 0, 0x50, { 0, 2 }, { 0, 375 }, 0 },
+	/*  248 */ { 0, 0x50, { 0, 2 }, { 0, 377 }, 0 },
+	/*  249 */ { 0, 0x50, { 0, 2 }, { 0, 379 }, 0 },
+	/*  250 */ { 0, 0x50, { 0, 2 }, { 0, 381 }, 0 },
+	/*  251 */ { 0, 0x50, { 0, 2 }, { 0, 383 }, 0 },
+	/*  252 */ { 0, 0x50, { 0, 2 }, { 0, 385 }, 0 },
+	/*  253 */ { 0, 0x44, { 2, 2 }, { 387, 387 }, 0 },
+	/*  254 */ { 0, 0x44, { 2, 2 }, { 389, 389 }, 0 },
+	/*  255 */ { 0, 0x44, { 2, 2 }, { 391, 391 }, 0 },
+	/*  256 */ { 0, 0x44, { 2, 2 }, { 393, 393 }, 0 },
+	/*  257 */ { 0, 0x44, { 2, 2 }, { 395, 395 }, 0 },
+	/*  258 */ { 0, 0x44, { 2, 2 }, { 397, 397 }, 0 },
+	/*  259 */ { 0, 0x44, { 2, 2 }, { 399, 399 }, 0 },
+	/*  260 */ { 0, 0x44, { 2, 2 }, { 401, 401 }, 0 },
+	/*  261 */ { 0, 0x44, { 3, 3 }, { 403, 403 }, 0 },
+	/*  262 */ { 0, 0x44, { 3, 3 }, { 406, 406 }, 0 },
+	/*  263 */ { 0, 0x44, { 3, 3 }, { 409, 409 }, 0 },
+	/*  264 */ { 0, 0x44, { 3, 3 }, { 412, 412 }, 0 },
+	/*  265 */ { 0, 0x44, { 3, 3 }, { 415, 415 }, 0 },
+	/*  266 */ { 0, 0x44, { 3, 3 }, { 418, 418 }, 0 },
+	/*  267 */ { 0, 0x44, { 3, 3 }, { 421, 421 }, 0 },
+	/*  268 */ { 0, 0x44, { 3, 3 }, { 424, 424 }, 0 },
+	/*  269 */ { 0, 0x44, { 3, 3 }, { 427, 427 }, 0 },
+	/*  270 */ { 0, 0x44, { 3, 3 }, { 430, 430 }, 0 },
+	/*  271 */ { 0, 0x44, { 3, 3 }, { 433, 433 }, 0 },
+	/*  272 */ { 0, 0x44, { 3, 3 }, { 436, 436 }, 0 },
+	/*  273 */ { 0, 0x44, { 2, 2 }, { 439, 439 }, 0 },
+	/*  274 */ { 0, 0x44, { 2, 2 }, { 441, 441 }, 0 },
+	/*  275 */ { 0, 0x44, { 2, 2 }, { 443, 443 }, 0 },
+	/*  276 */ { 0, 0x44, { 2, 2 }, { 445, 445 }, 0 },
+	/*  277 */ { 0, 0x44, { 2, 2 }, { 447, 447 }, 0 },
+	/*  278 */ { 0, 0x44, { 2, 2 }, { 449, 449 }, 0 },
+	/*  279 */ { 0, 0x44, { 2, 2 }, { 451, 451 }, 579 },
+	/*  280 */ { 0, 0x44, { 2, 2 }, { 453, 453 }, 581 },
+	/*  281 */ { 0, 0x44, { 3, 3 }, { 455, 455 }, 0 },
+	/*  282 */ { 0, 0x44, { 3, 3 }, { 458, 458 }, 0 },
+	/*  283 */ { 0, 0x44, { 2, 2 }, { 461, 461 }, 0 },
+	/*  284 */ { 0, 0x44, { 2, 2 }, { 463, 463 }, 0 },
+	/*  285 */ { 0, 0x44, { 2, 2 }, { 465, 465 }, 0 },
+	/*  286 */ { 0, 0x50, { 0, 2 }, { 0, 467 }, 0 },
+	/*  287 */ { 0, 0x50, { 0, 2 }, { 0, 469 }, 0 },
+	/*  288 */ { 0, 0x50, { 0, 2 }, { 0, 471 }, 0 },
+	/*  289 */ { 0, 0x44, { 2, 2 }, { 473, 473 }, 0 },
+	/*  290 */ { 0, 0x44, { 2, 2 }, { 475, 475 }, 0 },
+	/*  291 */ { 0, 0x44, { 2, 2 }, { 477, 477 }, 0 },
+	/*  292 */ { 0, 0x44, { 2, 2 }, { 479, 479 }, 0 },
+	/*  293 */ { 0, 0x44, { 3, 3 }, { 481, 481 }, 0 },
+	/*  294 */ { 0, 0x44, { 3, 3 }, { 484, 484 }, 0 },
+	/*  295 */ { 0, 0x44, { 2, 2 }, { 487, 487 }, 0 },
+	/*  296 */ { 0, 0x44, { 2, 2 }, { 489, 489 }, 0 },
+	/*  297 */ { 0, 0x44, { 2, 2 }, { 491, 491 }, 0 },
+	/*  298 */ { 0, 0x44, { 2, 2 }, { 493, 493 }, 0 },
+	/*  299 */ { 0, 0x44, { 2, 2 }, { 495, 495 }, 0 },
+	/*  300 */ { 0, 0x44, { 2, 2 }, { 497, 497 }, 0 },
+	/*  301 */ { 0, 0x44, { 2, 2 }, { 499, 499 }, 0 },
+	/*  302 */ { 0, 0x44, { 2, 2 }, { 501, 501 }, 0 },
+	/*  303 */ { 0, 0x44, { 2, 2 }, { 503, 503 }, 0 },
+	/*  304 */ { 0, 0x44, { 2, 2 }, { 505, 505 }, 0 },
+	/*  305 */ { 0, 0x44, { 2, 2 }, { 507, 507 }, 0 },
+	/*  306 */ { 0, 0x44, { 2, 2 }, { 509, 509 }, 0 },
+	/*  307 */ { 0, 0x44, { 2, 2 }, { 511, 511 }, 0 },
+	/*  308 */ { 0, 0x44, { 2, 2 }, { 513, 513 }, 0 },
+	/*  309 */ { 0, 0x44, { 2, 2 }, { 515, 515 }, 0 },
+	/*  310 */ { 0, 0x44, { 2, 2 }, { 517, 517 }, 0 },
+	/*  311 */ { 0, 0x44, { 2, 2 }, { 519, 519 }, 0 },
+	/*  312 */ { 0, 0x44, { 2, 2 }, { 521, 521 }, 0 },
+	/*  313 */ { 0, 0x44, { 2, 2 }, { 523, 523 }, 0 },
+	/*  314 */ { 0, 0x44, { 2, 2 }, { 525, 525 }, 0 },
+	/*  315 */ { 0, 0x44, { 2, 2 }, { 527, 527 }, 0 },
+	/*  316 */ { 0, 0x44, { 2, 2 }, { 529, 529 }, 0 },
+	/*  317 */ { 0, 0x44, { 2, 2 }, { 531, 531 }, 0 },
+	/*  318 */ { 0, 0x44, { 2, 2 }, { 533, 533 }, 0 },
+	/*  319 */ { 0, 0x44, { 2, 2 }, { 535, 535 }, 0 },
+	/*  320 */ { 0, 0x44, { 2, 2 }, { 537, 537 }, 0 },
+	/*  321 */ { 0, 0x44, { 2, 2 }, { 539, 539 }, 0 },
+	/*  322 */ { 0, 0x44, { 2, 2 }, { 541, 541 }, 0 },
+	/*  323 */ { 0, 0x44, { 2, 2 }, { 543, 543 }, 0 },
+	/*  324 */ { 0, 0x44, { 2, 2 }, { 545, 545 }, 0 },
+	/*  325 */ { 0, 0x44, { 2, 2 }, { 547, 547 }, 0 },
+	/*  326 */ { 0, 0x44, { 2, 2 }, { 549, 549 }, 0 },
+	/*  327 */ { 0, 0x44, { 2, 2 }, { 551, 551 }, 0 },
+	/*  328 */ { 0, 0x44, { 2, 2 }, { 553, 553 }, 0 },
+	/*  329 */ { 0, 0x44, { 2, 2 }, { 555, 555 }, 583 },
+	/*  330 */ { 0, 0x44, { 2, 2 }, { 557, 557 }, 585 },
+	/*  331 */ { 0, 0x44, { 2, 2 }, { 559, 559 }, 587 },
+	/*  332 */ { 0, 0x44, { 2, 2 }, { 561, 561 }, 589 },
+	/*  333 */ { 0, 0x44, { 3, 3 }, { 563, 563 }, 0 },
+	/*  334 */ { 0, 0x44, { 3, 3 }, { 566, 566 }, 0 },
+	/*  335 */ { 0, 0x44, { 3, 3 }, { 569, 569 }, 0 },
+	/*  336 */ { 0, 0x44, { 3, 3 }, { 572, 572 }, 0 },
+	/*  337 */ { 0, 0x44, { 2, 2 }, { 575, 575 }, 591 },
+	/*  338 */ { 0, 0x44, { 2, 2 }, { 577, 577 }, 593 },
+	/*  339 */ { 0, 0x44, { 3, 3 }, { 579, 579 }, 0 },
+	/*  340 */ { 0, 0x44, { 3, 3 }, { 582, 582 }, 0 },
+	/*  341 */ { 0, 0x44, { 2, 2 }, { 585, 585 }, 0 },
+	/*  342 */ { 0, 0x44, { 2, 2 }, { 587, 587 }, 0 },
+	/*  343 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 595 },
+	/*  344 */ { 0, 0x50, { 0, 1 }, { 0, 589 }, 0 },
+	/*  345 */ { 0, 0x50, { 0, 1 }, { 0, 590 }, 0 },
+	/*  346 */ { 0, 0x50, { 0, 1 }, { 0, 591 }, 0 },
+	/*  347 */ { 0, 0x50, { 0, 1 }, { 0, 592 }, 0 },
+	/*  348 */ { 0, 0x50, { 0, 1 }, { 0, 593 }, 0 },
+	/*  349 */ { 0, 0x50, { 0, 1 }, { 0, 594 }, 0 },
+	/*  350 */ { 0, 0x50, { 0, 1 }, { 0, 595 }, 0 },
+	/*  351 */ { 0, 0x50, { 0, 1 }, { 0, 596 }, 0 },
+	/*  352 */ { 0, 0x50, { 0, 1 }, { 0, 597 }, 0 },
+	/*  353 */ { 0, 0x50, { 0, 2 }, { 0, 598 }, 0 },
+	/*  354 */ { 0, 0x50, { 0, 2 }, { 0, 600 }, 0 },
+	/*  355 */ { 0, 0x50, { 0, 2 }, { 0, 602 }, 0 },
+	/*  356 */ { 0, 0x50, { 0, 2 }, { 0, 604 }, 0 },
+	/*  357 */ { 0, 0x50, { 0, 2 }, { 0, 606 }, 0 },
+	/*  358 */ { 0, 0x50, { 0, 2 }, { 0, 608 }, 0 },
+	/*  359 */ { 0, 0x50, { 0, 1 }, { 0, 610 }, 0 },
+	/*  360 */ { 0, 0x50, { 0, 1 }, { 0, 611 }, 0 },
+	/*  361 */ { 0, 0x50, { 0, 1 }, { 0, 357 }, 0 },
+	/*  362 */ { 0, 0x50, { 0, 1 }, { 0, 612 }, 0 },
+	/*  363 */ { 0, 0x50, { 0, 1 }, { 0, 613 }, 0 },
+	/*  364 */ { 230, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  365 */ { 230, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  366 */ { 232, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  367 */ { 220, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  368 */ { 216, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  369 */ { 202, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  370 */ { 220, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  371 */ { 202, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  372 */ { 1, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  373 */ { 1, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  374 */ { 230, 0x55, { 1, 1 }, { 614, 614 }, 0 },
+	/*  375 */ { 230, 0x55, { 1, 1 }, { 615, 615 }, 0 },
+	/*  376 */ { 230, 0x55, { 1, 1 }, { 616, 616 }, 0 },
+	/*  377 */ { 230, 0x55, { 2, 2 }, { 617, 617 }, 0 },
+	/*  378 */ { 240, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  379 */ { 233, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  380 */ { 234, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  381 */ { 0, 0x55, { 1, 1 }, { 619, 619 }, 0 },
+	/*  382 */ { 0, 0x50, { 0, 2 }, { 0, 620 }, 0 },
+	/*  383 */ { 0, 0x55, { 1, 1 }, { 622, 622 }, 0 },
+	/*  384 */ { 0, 0x54, { 2, 3 }, { 623, 625 }, 0 },
+	/*  385 */ { 0, 0x44, { 2, 2 }, { 628, 628 }, 0 },
+	/*  386 */ { 0, 0x55, { 1, 1 }, { 630, 630 }, 0 },
+	/*  387 */ { 0, 0x44, { 2, 2 }, { 631, 631 }, 0 },
+	/*  388 */ { 0, 0x44, { 2, 2 }, { 633, 633 }, 0 },
+	/*  389 */ { 0, 0x44, { 2, 2 }, { 635, 635 }, 0 },
+	/*  390 */ { 0, 0x44, { 2, 2 }, { 637, 637 }, 0 },
+	/*  391 */ { 0, 0x44, { 2, 2 }, { 639, 639 }, 0 },
+	/*  392 */ { 0, 0x44, { 2, 2 }, { 641, 641 }, 0 },
+	/*  393 */ { 0, 0x44, { 3, 3 }, { 643, 643 }, 0 },
+	/*  394 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 597 },
+	/*  395 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 605 },
+	/*  396 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 610 },
+	/*  397 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 616 },
+	/*  398 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 624 },
+	/*  399 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 629 },
+	/*  400 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 631 },
+	/*  401 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 638 },
+	/*  402 */ { 0, 0x44, { 2, 2 }, { 646, 646 }, 0 },
+	/*  403 */ { 0, 0x44, { 2, 2 }, { 648, 648 }, 0 },
+	/*  404 */ { 0, 0x44, { 2, 2 }, { 650, 650 }, 644 },
+	/*  405 */ { 0, 0x44, { 2, 2 }, { 652, 652 }, 0 },
+	/*  406 */ { 0, 0x44, { 2, 2 }, { 654, 654 }, 646 },
+	/*  407 */ { 0, 0x44, { 2, 2 }, { 656, 656 }, 0 },
+	/*  408 */ { 0, 0x44, { 3, 3 }, { 658, 658 }, 0 },
+	/*  409 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 648 },
+	/*  410 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 657 },
+	/*  411 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 662 },
+	/*  412 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 669 },
+	/*  413 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 678 },
+	/*  414 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 683 },
+	/*  415 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 686 },
+	/*  416 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 695 },
+	/*  417 */ { 0, 0x44, { 2, 2 }, { 661, 661 }, 702 },
+	/*  418 */ { 0, 0x44, { 2, 2 }, { 663, 663 }, 706 },
+	/*  419 */ { 0, 0x44, { 2, 2 }, { 665, 665 }, 0 },
+	/*  420 */ { 0, 0x44, { 2, 2 }, { 667, 667 }, 0 },
+	/*  421 */ { 0, 0x44, { 2, 2 }, { 669, 669 }, 710 },
+	/*  422 */ { 0, 0x50, { 0, 1 }, { 0, 671 }, 0 },
+	/*  423 */ { 0, 0x50, { 0, 1 }, { 0, 672 }, 0 },
+	/*  424 */ { 0, 0x50, { 0, 1 }, { 0, 673 }, 712 },
+	/*  425 */ { 0, 0x54, { 2, 2 }, { 674, 639 }, 0 },
+	/*  426 */ { 0, 0x54, { 2, 2 }, { 676, 648 }, 0 },
+	/*  427 */ { 0, 0x50, { 0, 1 }, { 0, 678 }, 0 },
+	/*  428 */ { 0, 0x50, { 0, 1 }, { 0, 679 }, 0 },
+	/*  429 */ { 0, 0x50, { 0, 1 }, { 0, 680 }, 0 },
+	/*  430 */ { 0, 0x50, { 0, 1 }, { 0, 681 }, 0 },
+	/*  431 */ { 0, 0x50, { 0, 1 }, { 0, 682 }, 0 },
+	/*  432 */ { 0, 0x50, { 0, 1 }, { 0, 683 }, 0 },
+	/*  433 */ { 0, 0x50, { 0, 1 }, { 0, 684 }, 0 },
+	/*  434 */ { 0, 0x50, { 0, 1 }, { 0, 685 }, 0 },
+	/*  435 */ { 0, 0x44, { 2, 2 }, { 686, 686 }, 0 },
+	/*  436 */ { 0, 0x44, { 2, 2 }, { 688, 688 }, 0 },
+	/*  437 */ { 0, 0x44, { 2, 2 }, { 690, 690 }, 0 },
+	/*  438 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 715 },
+	/*  439 */ { 0, 0x44, { 2, 2 }, { 692, 692 }, 0 },
+	/*  440 */ { 0, 0x44, { 2, 2 }, { 694, 694 }, 0 },
+	/*  441 */ { 0, 0x44, { 2, 2 }, { 696, 696 }, 0 },
+	/*  442 */ { 0, 0x44, { 2, 2 }, { 698, 698 }, 0 },
+	/*  443 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 717 },
+	/*  444 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 720 },
+	/*  445 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 722 },
+	/*  446 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 726 },
+	/*  447 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 729 },
+	/*  448 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 731 },
+	/*  449 */ { 0, 0x44, { 2, 2 }, { 700, 700 }, 0 },
+	/*  450 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 736 },
+	/*  451 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 738 },
+	/*  452 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 740 },
+	/*  453 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 745 },
+	/*  454 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 747 },
+	/*  455 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 749 },
+	/*  456 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 751 },
+	/*  457 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 754 },
+	/*  458 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 756 },
+	/*  459 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 760 },
+	/*  460 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 763 },
+	/*  461 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 765 },
+	/*  462 */ { 0, 0x44, { 2, 2 }, { 702, 702 }, 0 },
+	/*  463 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 770 },
+	/*  464 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 772 },
+	/*  465 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 774 },
+	/*  466 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 779 },
+	/*  467 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 781 },
+	/*  468 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 783 },
+	/*  469 */ { 0, 0x44, { 2, 2 }, { 704, 704 }, 0 },
+	/*  470 */ { 0, 0x44, { 2, 2 }, { 706, 706 }, 0 },
+	/*  471 */ { 0, 0x44, { 2, 2 }, { 708, 708 }, 0 },
+	/*  472 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 785 },
+	/*  473 */ { 0, 0x44, { 2, 2 }, { 710, 710 }, 0 },
+	/*  474 */ { 0, 0x44, { 2, 2 }, { 712, 712 }, 0 },
+	/*  475 */ { 0, 0x44, { 2, 2 }, { 714, 714 }, 0 },
+	/*  476 */ { 0, 0x44, { 2, 2 }, { 716, 716 }, 0 },
+	/*  477 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 787 },
+	/*  478 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 789 },
+	/*  479 */ { 0, 0x44, { 2, 2 }, { 718, 718 }, 0 },
+	/*  480 */ { 0, 0x44, { 2, 2 }, { 720, 720 }, 0 },
+	/*  481 */ { 0, 0x44, { 2, 2 }, { 722, 722 }, 0 },
+	/*  482 */ { 0, 0x44, { 2, 2 }, { 724, 724 }, 0 },
+	/*  483 */ { 0, 0x44, { 2, 2 }, { 726, 726 }, 0 },
+	/*  484 */ { 0, 0x44, { 2, 2 }, { 728, 728 }, 0 },
+	/*  485 */ { 0, 0x44, { 2, 2 }, { 730, 730 }, 0 },
+	/*  486 */ { 0, 0x44, { 2, 2 }, { 732, 732 }, 0 },
+	/*  487 */ { 0, 0x44, { 2, 2 }, { 734, 734 }, 0 },
+	/*  488 */ { 0, 0x44, { 2, 2 }, { 736, 736 }, 0 },
+	/*  489 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 791 },
+	/*  490 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 793 },
+	/*  491 */ { 0, 0x44, { 2, 2 }, { 738, 738 }, 0 },
+	/*  492 */ { 0, 0x44, { 2, 2 }, { 740, 740 }, 0 },
+	/*  493 */ { 0, 0x44, { 2, 2 }, { 742, 742 }, 0 },
+	/*  494 */ { 0, 0x44, { 2, 2 }, { 744, 744 }, 0 },
+	/*  495 */ { 0, 0x44, { 2, 2 }, { 746, 746 }, 0 },
+	/*  496 */ { 0, 0x44, { 2, 2 }, { 748, 748 }, 0 },
+	/*  497 */ { 0, 0x44, { 2, 2 }, { 750, 750 }, 0 },
+	/*  498 */ { 0, 0x44, { 2, 2 }, { 752, 752 }, 0 },
+	/*  499 */ { 0, 0x44, { 2, 2 }, { 754, 754 }, 0 },
+	/*  500 */ { 0, 0x44, { 2, 2 }, { 756, 756 }, 0 },
+	/*  501 */ { 0, 0x44, { 2, 2 }, { 758, 758 }, 0 },
+	/*  502 */ { 0, 0x44, { 2, 2 }, { 760, 760 }, 0 },
+	/*  503 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 795 },
+	/*  504 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 797 },
+	/*  505 */ { 0, 0x44, { 2, 2 }, { 762, 762 }, 0 },
+	/*  506 */ { 0, 0x44, { 2, 2 }, { 764, 764 }, 0 },
+	/*  507 */ { 0, 0x44, { 2, 2 }, { 766, 766 }, 0 },
+	/*  508 */ { 0, 0x44, { 2, 2 }, { 768, 768 }, 0 },
+	/*  509 */ { 0, 0x44, { 2, 2 }, { 770, 770 }, 0 },
+	/*  510 */ { 0, 0x44, { 2, 2 }, { 772, 772 }, 0 },
+	/*  511 */ { 0, 0x44, { 2, 2 }, { 774, 774 }, 0 },
+	/*  512 */ { 0, 0x44, { 2, 2 }, { 776, 776 }, 0 },
+	/*  513 */ { 0, 0x44, { 2, 2 }, { 778, 778 }, 0 },
+	/*  514 */ { 0, 0x44, { 2, 2 }, { 780, 780 }, 0 },
+	/*  515 */ { 0, 0x44, { 2, 2 }, { 782, 782 }, 0 },
+	/*  516 */ { 0, 0x44, { 2, 2 }, { 784, 784 }, 0 },
+	/*  517 */ { 0, 0x44, { 2, 2 }, { 786, 786 }, 0 },
+	/*  518 */ { 0, 0x44, { 2, 2 }, { 788, 788 }, 0 },
+	/*  519 */ { 0, 0x50, { 0, 2 }, { 0, 790 }, 0 },
+	/*  520 */ { 222, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  521 */ { 228, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  522 */ { 10, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  523 */ { 11, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  524 */ { 12, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  525 */ { 13, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  526 */ { 14, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  527 */ { 15, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  528 */ { 16, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  529 */ { 17, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  530 */ { 18, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  531 */ { 19, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  532 */ { 20, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  533 */ { 21, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  534 */ { 22, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  535 */ { 23, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  536 */ { 24, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  537 */ { 25, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  538 */ { 30, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  539 */ { 31, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  540 */ { 32, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  541 */ { 0, 0x44, { 2, 2 }, { 792, 792 }, 0 },
+	/*  542 */ { 0, 0x44, { 2, 2 }, { 794, 794 }, 0 },
+	/*  543 */ { 0, 0x44, { 2, 2 }, { 796, 796 }, 0 },
+	/*  544 */ { 0, 0x44, { 2, 2 }, { 798, 798 }, 0 },
+	/*  545 */ { 0, 0x44, { 2, 2 }, { 800, 800 }, 0 },
+	/*  546 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 799 },
+	/*  547 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 803 },
+	/*  548 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 805 },
+	/*  549 */ { 27, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  550 */ { 28, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  551 */ { 29, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  552 */ { 33, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  553 */ { 34, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  554 */ { 35, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  555 */ { 0, 0x50, { 0, 2 }, { 0, 802 }, 0 },
+	/*  556 */ { 0, 0x50, { 0, 2 }, { 0, 804 }, 0 },
+	/*  557 */ { 0, 0x50, { 0, 2 }, { 0, 806 }, 0 },
+	/*  558 */ { 0, 0x50, { 0, 2 }, { 0, 808 }, 0 },
+	/*  559 */ { 0, 0x44, { 2, 2 }, { 810, 810 }, 0 },
+	/*  560 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 807 },
+	/*  561 */ { 0, 0x44, { 2, 2 }, { 812, 812 }, 0 },
+	/*  562 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 809 },
+	/*  563 */ { 0, 0x44, { 2, 2 }, { 814, 814 }, 0 },
+	/*  564 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 811 },
+	/*  565 */ { 36, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  566 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 813 },
+	/*  567 */ { 0, 0x44, { 2, 2 }, { 816, 816 }, 0 },
+	/*  568 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 815 },
+	/*  569 */ { 0, 0x44, { 2, 2 }, { 818, 818 }, 0 },
+	/*  570 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 817 },
+	/*  571 */ { 0, 0x44, { 2, 2 }, { 820, 820 }, 0 },
+	/*  572 */ { 7, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  573 */ { 9, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  574 */ { 0, 0x55, { 2, 2 }, { 822, 822 }, 0 },
+	/*  575 */ { 0, 0x55, { 2, 2 }, { 824, 824 }, 0 },
+	/*  576 */ { 0, 0x55, { 2, 2 }, { 826, 826 }, 0 },
+	/*  577 */ { 0, 0x55, { 2, 2 }, { 828, 828 }, 0 },
+	/*  578 */ { 0, 0x55, { 2, 2 }, { 830, 830 }, 0 },
+	/*  579 */ { 0, 0x55, { 2, 2 }, { 832, 832 }, 0 },
+	/*  580 */ { 0, 0x55, { 2, 2 }, { 834, 834 }, 0 },
+	/*  581 */ { 0, 0x55, { 2, 2 }, { 836, 836 }, 0 },
+	/*  582 */ { 7, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  583 */ { 0, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  584 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 819 },
+	/*  585 */ { 0, 0x44, { 2, 2 }, { 838, 838 }, 0 },
+	/*  586 */ { 0, 0x44, { 2, 2 }, { 840, 840 }, 0 },
+	/*  587 */ { 0, 0x55, { 2, 2 }, { 842, 842 }, 0 },
+	/*  588 */ { 0, 0x55, { 2, 2 }, { 844, 844 }, 0 },
+	/*  589 */ { 0, 0x55, { 2, 2 }, { 846, 846 }, 0 },
+	/*  590 */ { 0, 0x55, { 2, 2 }, { 848, 848 }, 0 },
+	/*  591 */ { 0, 0x55, { 2, 2 }, { 850, 850 }, 0 },
+	/*  592 */ { 0, 0x55, { 2, 2 }, { 852, 852 }, 0 },
+	/*  593 */ { 0, 0x55, { 2, 2 }, { 854, 854 }, 0 },
+	/*  594 */ { 0, 0x55, { 2, 2 }, { 856, 856 }, 0 },
+	/*  595 */ { 0, 0x55, { 2, 2 }, { 858, 858 }, 0 },
+	/*  596 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 822 },
+	/*  597 */ { 0, 0x44, { 2, 2 }, { 860, 860 }, 0 },
+	/*  598 */ { 0, 0x44, { 2, 2 }, { 862, 862 }, 0 },
+	/*  599 */ { 0, 0x44, { 2, 2 }, { 864, 864 }, 0 },
+	/*  600 */ { 0, 0x55, { 2, 2 }, { 866, 866 }, 0 },
+	/*  601 */ { 0, 0x55, { 2, 2 }, { 868, 868 }, 0 },
+	/*  602 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 826 },
+	/*  603 */ { 0, 0x44, { 2, 2 }, { 870, 870 }, 0 },
+	/*  604 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 828 },
+	/*  605 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 831 },
+	/*  606 */ { 0, 0x44, { 2, 2 }, { 872, 872 }, 0 },
+	/*  607 */ { 0, 0x44, { 2, 2 }, { 874, 874 }, 0 },
+	/*  608 */ { 0, 0x44, { 2, 2 }, { 876, 876 }, 0 },
+	/*  609 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 833 },
+	/*  610 */ { 0, 0x44, { 2, 2 }, { 878, 878 }, 0 },
+	/*  611 */ { 84, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  612 */ { 91, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  613 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 835 },
+	/*  614 */ { 0, 0x44, { 2, 2 }, { 880, 880 }, 0 },
+	/*  615 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 837 },
+	/*  616 */ { 0, 0x44, { 2, 2 }, { 882, 882 }, 0 },
+	/*  617 */ { 0, 0x44, { 2, 2 }, { 884, 884 }, 0 },
+	/*  618 */ { 0, 0x44, { 2, 2 }, { 886, 886 }, 841 },
+	/*  619 */ { 0, 0x44, { 3, 3 }, { 888, 888 }, 0 },
+	/*  620 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 843 },
+	/*  621 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 846 },
+	/*  622 */ { 0, 0x44, { 2, 2 }, { 891, 891 }, 0 },
+	/*  623 */ { 0, 0x44, { 2, 2 }, { 893, 893 }, 0 },
+	/*  624 */ { 0, 0x44, { 2, 2 }, { 895, 895 }, 0 },
+	/*  625 */ { 9, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/*  626 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 848 },
+	/*  627 */ { 0, 0x44, { 2, 2 }, { 897, 897 }, 0 },
+	/*  628 */ { 0, 0x44, { 2, 2 }, { 899, 899 }, 852 },
+	/*  629 */ { 0, 0x44, { 3, 3 }, { 901, 901 }, 0 },
+	/*  630 */ { 0, 0x44, { 2, 2 }, { 904, 904 }, 0 },
+	/*  631 */ { 0, 0x50, { 0, 2 }, { 0, 906 }, 0 },
+	/*  632 */ { 103, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  633 */ { 107, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  634 */ { 0, 0x50, { 0, 2 }, { 0, 908 }, 0 },
+	/*  635 */ { 118, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  636 */ { 122, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  637 */ { 0, 0x50, { 0, 2 }, { 0, 910 }, 0 },
+	/*  638 */ { 0, 0x50, { 0, 2 }, { 0, 912 }, 0 },
+	/*  639 */ { 0, 0x50, { 0, 1 }, { 0, 914 }, 0 },
+	/*  640 */ { 216, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  641 */ { 0, 0x55, { 2, 2 }, { 915, 915 }, 0 },
+	/*  642 */ { 0, 0x55, { 2, 2 }, { 917, 917 }, 0 },
+	/*  643 */ { 0, 0x55, { 2, 2 }, { 919, 919 }, 0 },
+	/*  644 */ { 0, 0x55, { 2, 2 }, { 921, 921 }, 0 },
+	/*  645 */ { 0, 0x55, { 2, 2 }, { 923, 923 }, 0 },
+	/*  646 */ { 0, 0x55, { 2, 2 }, { 925, 925 }, 0 },
+	/*  647 */ { 129, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  648 */ { 130, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  649 */ { 0, 0x55, { 2, 2 }, { 927, 927 }, 0 },
+	/*  650 */ { 132, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  651 */ { 0, 0x55, { 2, 2 }, { 929, 929 }, 0 },
+	/*  652 */ { 0, 0x55, { 2, 2 }, { 931, 931 }, 0 },
+	/*  653 */ { 0, 0x50, { 0, 3 }, { 0, 933 }, 0 },
+	/*  654 */ { 0, 0x55, { 2, 2 }, { 936, 936 }, 0 },
+	/*  655 */ { 0, 0x50, { 0, 3 }, { 0, 938 }, 0 },
+	/*  656 */ { 0, 0x55, { 2, 2 }, { 941, 941 }, 0 },
+	/*  657 */ { 0, 0x55, { 2, 2 }, { 943, 943 }, 0 },
+	/*  658 */ { 0, 0x55, { 2, 2 }, { 945, 945 }, 0 },
+	/*  659 */ { 0, 0x55, { 2, 2 }, { 947, 947 }, 0 },
+	/*  660 */ { 0, 0x55, { 2, 2 }, { 949, 949 }, 0 },
+	/*  661 */ { 0, 0x55, { 2, 2 }, { 951, 951 }, 0 },
+	/*  662 */ { 0, 0x55, { 2, 2 }, { 953, 953 }, 0 },
+	/*  663 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 854 },
+	/*  664 */ { 0, 0x44, { 2, 2 }, { 955, 955 }, 0 },
+	/*  665 */ { 0, 0x50, { 0, 1 }, { 0, 957 }, 0 },
+	/*  666 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 856 },
+	/*  667 */ { 0, 0x44, { 2, 2 }, { 958, 958 }, 0 },
+	/*  668 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 858 },
+	/*  669 */ { 0, 0x44, { 2, 2 }, { 960, 960 }, 0 },
+	/*  670 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 860 },
+	/*  671 */ { 0, 0x44, { 2, 2 }, { 962, 962 }, 0 },
+	/*  672 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 862 },
+	/*  673 */ { 0, 0x44, { 2, 2 }, { 964, 964 }, 0 },
+	/*  674 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 864 },
+	/*  675 */ { 0, 0x44, { 2, 2 }, { 966, 966 }, 0 },
+	/*  676 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 866 },
+	/*  677 */ { 0, 0x44, { 2, 2 }, { 968, 968 }, 0 },
+	/*  678 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 868 },
+	/*  679 */ { 0, 0x44, { 2, 2 }, { 970, 970 }, 0 },
+	/*  680 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 870 },
+	/*  681 */ { 0, 0x44, { 2, 2 }, { 972, 972 }, 0 },
+	/*  682 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 872 },
+	/*  683 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 874 },
+	/*  684 */ { 0, 0x44, { 2, 2 }, { 974, 974 }, 0 },
+	/*  685 */ { 0, 0x44, { 2, 2 }, { 976, 976 }, 0 },
+	/*  686 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 876 },
+	/*  687 */ { 0, 0x44, { 2, 2 }, { 978, 978 }, 0 },
+	/*  688 */ { 0, 0x50, { 0, 1 }, { 0, 980 }, 0 },
+	/*  689 */ { 0, 0x50, { 0, 1 }, { 0, 981 }, 0 },
+	/*  690 */ { 0, 0x50, { 0, 1 }, { 0, 982 }, 0 },
+	/*  691 */ { 0, 0x50, { 0, 1 }, { 0, 983 }, 0 },
+	/*  692 */ { 0, 0x50, { 0, 1 }, { 0, 984 }, 0 },
+	/*  693 */ { 0, 0x50, { 0, 1 }, { 0, 985 }, 0 },
+	/*  694 */ { 0, 0x50, { 0, 1 }, { 0, 986 }, 0 },
+	/*  695 */ { 0, 0x50, { 0, 1 }, { 0, 987 }, 0 },
+	/*  696 */ { 0, 0x50, { 0, 1 }, { 0, 988 }, 0 },
+	/*  697 */ { 0, 0x50, { 0, 1 }, { 0, 989 }, 0 },
+	/*  698 */ { 0, 0x50, { 0, 1 }, { 0, 990 }, 0 },
+	/*  699 */ { 0, 0x50, { 0, 1 }, { 0, 991 }, 0 },
+	/*  700 */ { 0, 0x50, { 0, 1 }, { 0, 992 }, 0 },
+	/*  701 */ { 0, 0x50, { 0, 1 }, { 0, 993 }, 0 },
+	/*  702 */ { 0, 0x50, { 0, 1 }, { 0, 994 }, 0 },
+	/*  703 */ { 0, 0x50, { 0, 1 }, { 0, 995 }, 0 },
+	/*  704 */ { 0, 0x50, { 0, 1 }, { 0, 996 }, 0 },
+	/*  705 */ { 0, 0x50, { 0, 1 }, { 0, 997 }, 0 },
+	/*  706 */ { 0, 0x50, { 0, 1 }, { 0, 998 }, 0 },
+	/*  707 */ { 0, 0x50, { 0, 1 }, { 0, 999 }, 0 },
+	/*  708 */ { 0, 0x50, { 0, 1 }, { 0, 1000 }, 0 },
+	/*  709 */ { 0, 0x50, { 0, 1 }, { 0, 1001 }, 0 },
+	/*  710 */ { 0, 0x50, { 0, 1 }, { 0, 1002 }, 0 },
+	/*  711 */ { 0, 0x50, { 0, 1 }, { 0, 1003 }, 0 },
+	/*  712 */ { 0, 0x50, { 0, 1 }, { 0, 1004 }, 0 },
+	/*  713 */ { 0, 0x50, { 0, 1 }, { 0, 1005 }, 0 },
+	/*  714 */ { 0, 0x50, { 0, 1 }, { 0, 1006 }, 0 },
+	/*  715 */ { 0, 0x50, { 0, 1 }, { 0, 1007 }, 0 },
+	/*  716 */ { 0, 0x50, { 0, 1 }, { 0, 1008 }, 0 },
+	/*  717 */ { 0, 0x50, { 0, 1 }, { 0, 1009 }, 0 },
+	/*  718 */ { 0, 0x50, { 0, 1 }, { 0, 1010 }, 0 },
+	/*  719 */ { 0, 0x50, { 0, 1 }, { 0, 1011 }, 0 },
+	/*  720 */ { 0, 0x50, { 0, 1 }, { 0, 1012 }, 0 },
+	/*  721 */ { 0, 0x50, { 0, 1 }, { 0, 1013 }, 0 },
+	/*  722 */ { 0, 0x50, { 0, 1 }, { 0, 1014 }, 0 },
+	/*  723 */ { 0, 0x50, { 0, 1 }, { 0, 1015 }, 0 },
+	/*  724 */ { 0, 0x50, { 0, 1 }, { 0, 1016 }, 0 },
+	/*  725 */ { 0, 0x50, { 0, 1 }, { 0, 1017 }, 0 },
+	/*  726 */ { 0, 0x50, { 0, 1 }, { 0, 1018 }, 0 },
+	/*  727 */ { 0, 0x50, { 0, 1 }, { 0, 1019 }, 0 },
+	/*  728 */ { 0, 0x50, { 0, 1 }, { 0, 1020 }, 0 },
+	/*  729 */ { 0, 0x50, { 0, 1 }, { 0, 1021 }, 0 },
+	/*  730 */ { 0, 0x50, { 0, 1 }, { 0, 1022 }, 0 },
+	/*  731 */ { 0, 0x50, { 0, 1 }, { 0, 1023 }, 0 },
+	/*  732 */ { 0, 0x50, { 0, 1 }, { 0, 1024 }, 0 },
+	/*  733 */ { 0, 0x50, { 0, 1 }, { 0, 1025 }, 0 },
+	/*  734 */ { 0, 0x50, { 0, 1 }, { 0, 1026 }, 0 },
+	/*  735 */ { 0, 0x50, { 0, 1 }, { 0, 1027 }, 0 },
+	/*  736 */ { 0, 0x50, { 0, 1 }, { 0, 1028 }, 0 },
+	/*  737 */ { 0, 0x50, { 0, 1 }, { 0, 1029 }, 0 },
+	/*  738 */ { 0, 0x50, { 0, 1 }, { 0, 1030 }, 0 },
+	/*  739 */ { 0, 0x50, { 0, 1 }, { 0, 1031 }, 0 },
+	/*  740 */ { 0, 0x50, { 0, 1 }, { 0, 1032 }, 0 },
+	/*  741 */ { 0, 0x50, { 0, 1 }, { 0, 1033 }, 0 },
+	/*  742 */ { 0, 0x50, { 0, 1 }, { 0, 1034 }, 0 },
+	/*  743 */ { 0, 0x50, { 0, 1 }, { 0, 1035 }, 0 },
+	/*  744 */ { 0, 0x50, { 0, 1 }, { 0, 1036 }, 0 },
+	/*  745 */ { 0, 0x50, { 0, 1 }, { 0, 1037 }, 0 },
+	/*  746 */ { 0, 0x50, { 0, 1 }, { 0, 1038 }, 0 },
+	/*  747 */ { 0, 0x50, { 0, 1 }, { 0, 1039 }, 0 },
+	/*  748 */ { 0, 0x50, { 0, 1 }, { 0, 1040 }, 0 },
+	/*  749 */ { 0, 0x50, { 0, 1 }, { 0, 1041 }, 0 },
+	/*  750 */ { 0, 0x50, { 0, 1 }, { 0, 1042 }, 0 },
+	/*  751 */ { 0, 0x50, { 0, 1 }, { 0, 1043 }, 0 },
+	/*  752 */ { 0, 0x50, { 0, 1 }, { 0, 1044 }, 0 },
+	/*  753 */ { 0, 0x50, { 0, 1 }, { 0, 1045 }, 0 },
+	/*  754 */ { 0, 0x50, { 0, 1 }, { 0, 1046 }, 0 },
+	/*  755 */ { 0, 0x50, { 0, 1 }, { 0, 1047 }, 0 },
+	/*  756 */ { 0, 0x50, { 0, 1 }, { 0, 1048 }, 0 },
+	/*  757 */ { 0, 0x50, { 0, 1 }, { 0, 1049 }, 0 },
+	/*  758 */ { 0, 0x50, { 0, 1 }, { 0, 1050 }, 0 },
+	/*  759 */ { 0, 0x50, { 0, 1 }, { 0, 1051 }, 0 },
+	/*  760 */ { 0, 0x50, { 0, 1 }, { 0, 1052 }, 0 },
+	/*  761 */ { 0, 0x50, { 0, 1 }, { 0, 1053 }, 0 },
+	/*  762 */ { 0, 0x50, { 0, 1 }, { 0, 1054 }, 0 },
+	/*  763 */ { 0, 0x50, { 0, 1 }, { 0, 1055 }, 0 },
+	/*  764 */ { 0, 0x50, { 0, 1 }, { 0, 1056 }, 0 },
+	/*  765 */ { 0, 0x50, { 0, 1 }, { 0, 1057 }, 0 },
+	/*  766 */ { 0, 0x50, { 0, 1 }, { 0, 1058 }, 0 },
+	/*  767 */ { 0, 0x50, { 0, 1 }, { 0, 1059 }, 0 },
+	/*  768 */ { 0, 0x50, { 0, 1 }, { 0, 1060 }, 0 },
+	/*  769 */ { 0, 0x50, { 0, 1 }, { 0, 1061 }, 0 },
+	/*  770 */ { 0, 0x50, { 0, 1 }, { 0, 1062 }, 0 },
+	/*  771 */ { 0, 0x50, { 0, 1 }, { 0, 1063 }, 0 },
+	/*  772 */ { 214, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/*  773 */ { 0, 0x44, { 2, 2 }, { 1064, 1064 }, 0 },
+	/*  774 */ { 0, 0x44, { 2, 2 }, { 1066, 1066 }, 0 },
+	/*  775 */ { 0, 0x44, { 2, 2 }, { 1068, 1068 }, 0 },
+	/*  776 */ { 0, 0x44, { 2, 2 }, { 1070, 1070 }, 0 },
+	/*  777 */ { 0, 0x44, { 2, 2 }, { 1072, 1072 }, 0 },
+	/*  778 */ { 0, 0x44, { 2, 2 }, { 1074, 1074 }, 0 },
+	/*  779 */ { 0, 0x44, { 2, 2 }, { 1076, 1076 }, 0 },
+	/*  780 */ { 0, 0x44, { 2, 2 }, { 1078, 1078 }, 0 },
+	/*  781 */ { 0, 0x44, { 3, 3 }, { 1080, 1080 }, 0 },
+	/*  782 */ { 0, 0x44, { 3, 3 }, { 1083, 1083 }, 0 },
+	/*  783 */ { 0, 0x44, { 2, 2 }, { 1086, 1086 }, 0 },
+	/*  784 */ { 0, 0x44, { 2, 2 }, { 1088, 1088 }, 0 },
+	/*  785 */ { 0, 0x44, { 2, 2 }, { 1090, 1090 }, 0 },
+	/*  786 */ { 0, 0x44, { 2, 2 }, { 1092, 1092 }, 0 },
+	/*  787 */ { 0, 0x44, { 2, 2 }, { 1094, 1094 }, 0 },
+	/*  788 */ { 0, 0x44, { 2, 2 }, { 1096, 1096 }, 0 },
+	/*  789 */ { 0, 0x44, { 2, 2 }, { 1098, 1098 }, 0 },
+	/*  790 */ { 0, 0x44, { 2, 2 }, { 1100, 1100 }, 0 },
+	/*  791 */ { 0, 0x44, { 2, 2 }, { 1102, 1102 }, 0 },
+	/*  792 */ { 0, 0x44, { 2, 2 }, { 1104, 1104 }, 0 },
+	/*  793 */ { 0, 0x44, { 3, 3 }, { 1106, 1106 }, 0 },
+	/*  794 */ { 0, 0x44, { 3, 3 }, { 1109, 1109 }, 0 },
+	/*  795 */ { 0, 0x44, { 3, 3 }, { 1112, 1112 }, 0 },
+	/*  796 */ { 0, 0x44, { 3, 3 }, { 1115, 1115 }, 0 },
+	/*  797 */ { 0, 0x44, { 2, 2 }, { 1118, 1118 }, 0 },
+	/*  798 */ { 0, 0x44, { 2, 2 }, { 1120, 1120 }, 0 },
+	/*  799 */ { 0, 0x44, { 2, 2 }, { 1122, 1122 }, 0 },
+	/*  800 */ { 0, 0x44, { 2, 2 }, { 1124, 1124 }, 0 },
+	/*  801 */ { 0, 0x44, { 3, 3 }, { 1126, 1126 }, 0 },
+	/*  802 */ { 0, 0x44, { 3, 3 }, { 1129, 1129 }, 0 },
+	/*  803 */ { 0, 0x44, { 2, 2 }, { 1132, 1132 }, 0 },
+	/*  804 */ { 0, 0x44, { 2, 2 }, { 1134, 1134 }, 0 },
+	/*  805 */ { 0, 0x44, { 2, 2 }, { 1136, 1136 }, 0 },
+	/*  806 */ { 0, 0x44, { 2, 2 }, { 1138, 1138 }, 0 },
+	/*  807 */ { 0, 0x44, { 2, 2 }, { 1140, 1140 }, 0 },
+	/*  808 */ { 0, 0x44, { 2, 2 }, { 1142, 1142 }, 0 },
+	/*  809 */ { 0, 0x44, { 2, 2 }, { 1144, 1144 }, 0 },
+	/*  810 */ { 0, 0x44, { 2, 2 }, { 1146, 1146 }, 0 },
+	/*  811 */ { 0, 0x44, { 2, 2 }, { 1148, 1148 }, 0 },
+	/*  812 */ { 0, 0x44, { 2, 2 }, { 1150, 1150 }, 0 },
+	/*  813 */ { 0, 0x44, { 2, 2 }, { 1152, 1152 }, 0 },
+	/*  814 */ { 0, 0x44, { 2, 2 }, { 1154, 1154 }, 0 },
+	/*  815 */ { 0, 0x44, { 2, 2 }, { 1156, 1156 }, 0 },
+	/*  816 */ { 0, 0x44, { 2, 2 }, { 1158, 1158 }, 0 },
+	/*  817 */ { 0, 0x44, { 2, 2 }, { 1160, 1160 }, 0 },
+	/*  818 */ { 0, 0x44, { 2, 2 }, { 1162, 1162 }, 0 },
+	/*  819 */ { 0, 0x44, { 3, 3 }, { 1164, 1164 }, 0 },
+	/*  820 */ { 0, 0x44, { 3, 3 }, { 1167, 1167 }, 0 },
+	/*  821 */ { 0, 0x44, { 2, 2 }, { 1170, 1170 }, 0 },
+	/*  822 */ { 0, 0x44, { 2, 2 }, { 1172, 1172 }, 0 },
+	/*  823 */ { 0, 0x44, { 2, 2 }, { 1174, 1174 }, 0 },
+	/*  824 */ { 0, 0x44, { 2, 2 }, { 1176, 1176 }, 0 },
+	/*  825 */ { 0, 0x44, { 2, 2 }, { 1178, 1178 }, 0 },
+	/*  826 */ { 0, 0x44, { 2, 2 }, { 1180, 1180 }, 0 },
+	/*  827 */ { 0, 0x44, { 2, 2 }, { 1182, 1182 }, 878 },
+	/*  828 */ { 0, 0x44, { 2, 2 }, { 1184, 1184 }, 880 },
+	/*  829 */ { 0, 0x44, { 3, 3 }, { 1186, 1186 }, 0 },
+	/*  830 */ { 0, 0x44, { 3, 3 }, { 1189, 1189 }, 0 },
+	/*  831 */ { 0, 0x44, { 2, 2 }, { 1192, 1192 }, 0 },
+	/*  832 */ { 0, 0x44, { 2, 2 }, { 1194, 1194 }, 0 },
+	/*  833 */ { 0, 0x44, { 2, 2 }, { 1196, 1196 }, 0 },
+	/*  834 */ { 0, 0x44, { 2, 2 }, { 1198, 1198 }, 0 },
+	/*  835 */ { 0, 0x44, { 2, 2 }, { 1200, 1200 }, 0 },
+	/*  836 */ { 0, 0x44, { 2, 2 }, { 1202, 1202 }, 0 },
+	/*  837 */ { 0, 0x44, { 2, 2 }, { 1204, 1204 }, 0 },
+	/*  838 */ { 0, 0x44, { 2, 2 }, { 1206, 1206 }, 0 },
+	/*  839 */ { 0, 0x44, { 2, 2 }, { 1208, 1208 }, 0 },
+	/*  840 */ { 0, 0x44, { 2, 2 }, { 1210, 1210 }, 0 },
+	/*  841 */ { 0, 0x44, { 2, 2 }, { 1212, 1212 }, 0 },
+	/*  842 */ { 0, 0x44, { 2, 2 }, { 1214, 1214 }, 0 },
+	/*  843 */ { 0, 0x44, { 2, 2 }, { 1216, 1216 }, 0 },
+	/*  844 */ { 0, 0x44, { 2, 2 }, { 1218, 1218 }, 0 },
+	/*  845 */ { 0, 0x44, { 2, 2 }, { 1220, 1220 }, 0 },
+	/*  846 */ { 0, 0x44, { 2, 2 }, { 1222, 1222 }, 0 },
+	/*  847 */ { 0, 0x44, { 2, 2 }, { 1224, 1224 }, 0 },
+	/*  848 */ { 0, 0x44, { 2, 2 }, { 1226, 1226 }, 0 },
+	/*  849 */ { 0, 0x44, { 3, 3 }, { 1228, 1228 }, 0 },
+	/*  850 */ { 0, 0x44, { 3, 3 }, { 1231, 1231 }, 0 },
+	/*  851 */ { 0, 0x44, { 3, 3 }, { 1234, 1234 }, 0 },
+	/*  852 */ { 0, 0x44, { 3, 3 }, { 1237, 1237 }, 0 },
+	/*  853 */ { 0, 0x44, { 3, 3 }, { 1240, 1240 }, 0 },
+	/*  854 */ { 0, 0x44, { 3, 3 }, { 1243, 1243 }, 0 },
+	/*  855 */ { 0, 0x44, { 3, 3 }, { 1246, 1246 }, 0 },
+	/*  856 */ { 0, 0x44, { 3, 3 }, { 1249, 1249 }, 0 },
+	/*  857 */ { 0, 0x44, { 2, 2 }, { 1252, 1252 }, 0 },
+	/*  858 */ { 0, 0x44, { 2, 2 }, { 1254, 1254 }, 0 },
+	/*  859 */ { 0, 0x44, { 2, 2 }, { 1256, 1256 }, 0 },
+	/*  860 */ { 0, 0x44, { 2, 2 }, { 1258, 1258 }, 0 },
+	/*  861 */ { 0, 0x44, { 2, 2 }, { 1260, 1260 }, 0 },
+	/*  862 */ { 0, 0x44, { 2, 2 }, { 1262, 1262 }, 0 },
+	/*  863 */ { 0, 0x44, { 2, 2 }, { 1264, 1264 }, 882 },
+	/*  864 */ { 0, 0x44, { 2, 2 }, { 1266, 1266 }, 884 },
+	/*  865 */ { 0, 0x44, { 3, 3 }, { 1268, 1268 }, 0 },
+	/*  866 */ { 0, 0x44, { 3, 3 }, { 1271, 1271 }, 0 },
+	/*  867 */ { 0, 0x44, { 2, 2 }, { 1274, 1274 }, 0 },
+	/*  868 */ { 0, 0x44, { 2, 2 }, { 1276, 1276 }, 0 },
+	/*  869 */ { 0, 0x44, { 2, 2 }, { 1278, 1278 }, 0 },
+	/*  870 */ { 0, 0x44, { 2, 2 }, { 1280, 1280 }, 0 },
+	/*  871 */ { 0, 0x44, { 2, 2 }, { 1282, 1282 }, 886 },
+	/*  872 */ { 0, 0x44, { 2, 2 }, { 1284, 1284 }, 888 },
+	/*  873 */ { 0, 0x44, { 3, 3 }, { 1286, 1286 }, 0 },
+	/*  874 */ { 0, 0x44, { 3, 3 }, { 1289, 1289 }, 0 },
+	/*  875 */ { 0, 0x44, { 3, 3 }, { 1292, 1292 }, 0 },
+	/*  876 */ { 0, 0x44, { 3, 3 }, { 1295, 1295 }, 0 },
+	/*  877 */ { 0, 0x44, { 3, 3 }, { 1298, 1298 }, 0 },
+	/*  878 */ { 0, 0x44, { 3, 3 }, { 1301, 1301 }, 0 },
+	/*  879 */ { 0, 0x44, { 2, 2 }, { 1304, 1304 }, 0 },
+	/*  880 */ { 0, 0x44, { 2, 2 }, { 1306, 1306 }, 0 },
+	/*  881 */ { 0, 0x44, { 2, 2 }, { 1308, 1308 }, 0 },
+	/*  882 */ { 0, 0x44, { 2, 2 }, { 1310, 1310 }, 0 },
+	/*  883 */ { 0, 0x44, { 2, 2 }, { 1312, 1312 }, 0 },
+	/*  884 */ { 0, 0x44, { 2, 2 }, { 1314, 1314 }, 0 },
+	/*  885 */ { 0, 0x44, { 2, 2 }, { 1316, 1316 }, 0 },
+	/*  886 */ { 0, 0x44, { 2, 2 }, { 1318, 1318 }, 0 },
+	/*  887 */ { 0, 0x44, { 2, 2 }, { 1320, 1320 }, 0 },
+	/*  888 */ { 0, 0x44, { 2, 2 }, { 1322, 1322 }, 0 },
+	/*  889 */ { 0, 0x44, { 2, 2 }, { 1324, 1324 }, 0 },
+	/*  890 */ { 0, 0x44, { 2, 2 }, { 1326, 1326 }, 0 },
+	/*  891 */ { 0, 0x44, { 2, 2 }, { 1328, 1328 }, 0 },
+	/*  892 */ { 0, 0x44, { 2, 2 }, { 1330, 1330 }, 0 },
+	/*  893 */ { 0, 0x44, { 3, 3 }, { 1332, 1332 }, 0 },
+	/*  894 */ { 0, 0x44, { 3, 3 }, { 1335, 1335 }, 0 },
+	/*  895 */ { 0, 0x44, { 3, 3 }, { 1338, 1338 }, 0 },
+	/*  896 */ { 0, 0x44, { 3, 3 }, { 1341, 1341 }, 0 },
+	/*  897 */ { 0, 0x44, { 2, 2 }, { 1344, 1344 }, 0 },
+	/*  898 */ { 0, 0x44, { 2, 2 }, { 1346, 1346 }, 0 },
+	/*  899 */ { 0, 0x44, { 2, 2 }, { 1348, 1348 }, 0 },
+	/*  900 */ { 0, 0x44, { 2, 2 }, { 1350, 1350 }, 0 },
+	/*  901 */ { 0, 0x44, { 2, 2 }, { 1352, 1352 }, 0 },
+	/*  902 */ { 0, 0x44, { 2, 2 }, { 1354, 1354 }, 0 },
+	/*  903 */ { 0, 0x44, { 2, 2 }, { 1356, 1356 }, 0 },
+	/*  904 */ { 0, 0x44, { 2, 2 }, { 1358, 1358 }, 0 },
+	/*  905 */ { 0, 0x44, { 2, 2 }, { 1360, 1360 }, 0 },
+	/*  906 */ { 0, 0x44, { 2, 2 }, { 1362, 1362 }, 0 },
+	/*  907 */ { 0, 0x44, { 2, 2 }, { 1364, 1364 }, 0 },
+	/*  908 */ { 0, 0x44, { 2, 2 }, { 1366, 1366 }, 0 },
+	/*  909 */ { 0, 0x44, { 2, 2 }, { 1368, 1368 }, 0 },
+	/*  910 */ { 0, 0x44, { 2, 2 }, { 1370, 1370 }, 0 },
+	/*  911 */ { 0, 0x44, { 2, 2 }, { 1372, 1372 }, 0 },
+	/*  912 */ { 0, 0x44, { 2, 2 }, { 1374, 1374 }, 0 },
+	/*  913 */ { 0, 0x44, { 2, 2 }, { 1376, 1376 }, 0 },
+	/*  914 */ { 0, 0x44, { 2, 2 }, { 1378, 1378 }, 0 },
+	/*  915 */ { 0, 0x44, { 2, 2 }, { 1380, 1380 }, 0 },
+	/*  916 */ { 0, 0x44, { 2, 2 }, { 1382, 1382 }, 0 },
+	/*  917 */ { 0, 0x44, { 2, 2 }, { 1384, 1384 }, 0 },
+	/*  918 */ { 0, 0x44, { 2, 2 }, { 1386, 1386 }, 0 },
+	/*  919 */ { 0, 0x44, { 2, 2 }, { 1388, 1388 }, 0 },
+	/*  920 */ { 0, 0x44, { 2, 2 }, { 1390, 1390 }, 0 },
+	/*  921 */ { 0, 0x44, { 2, 2 }, { 1392, 1392 }, 0 },
+	/*  922 */ { 0, 0x44, { 2, 2 }, { 1394, 1394 }, 0 },
+	/*  923 */ { 0, 0x44, { 2, 2 }, { 1396, 1396 }, 0 },
+	/*  924 */ { 0, 0x44, { 2, 2 }, { 1398, 1398 }, 0 },
+	/*  925 */ { 0, 0x44, { 2, 2 }, { 1400, 1400 }, 0 },
+	/*  926 */ { 0, 0x44, { 2, 2 }, { 1402, 1402 }, 0 },
+	/*  927 */ { 0, 0x50, { 0, 2 }, { 0, 1404 }, 0 },
+	/*  928 */ { 0, 0x54, { 2, 2 }, { 1406, 1280 }, 0 },
+	/*  929 */ { 0, 0x44, { 2, 2 }, { 1408, 1408 }, 890 },
+	/*  930 */ { 0, 0x44, { 2, 2 }, { 1410, 1410 }, 893 },
+	/*  931 */ { 0, 0x44, { 2, 2 }, { 1412, 1412 }, 0 },
+	/*  932 */ { 0, 0x44, { 2, 2 }, { 1414, 1414 }, 0 },
+	/*  933 */ { 0, 0x44, { 3, 3 }, { 1416, 1416 }, 0 },
+	/*  934 */ { 0, 0x44, { 3, 3 }, { 1419, 1419 }, 0 },
+	/*  935 */ { 0, 0x44, { 3, 3 }, { 1422, 1422 }, 0 },
+	/*  936 */ { 0, 0x44, { 3, 3 }, { 1425, 1425 }, 0 },
+	/*  937 */ { 0, 0x44, { 3, 3 }, { 1428, 1428 }, 0 },
+	/*  938 */ { 0, 0x44, { 3, 3 }, { 1431, 1431 }, 0 },
+	/*  939 */ { 0, 0x44, { 3, 3 }, { 1434, 1434 }, 0 },
+	/*  940 */ { 0, 0x44, { 3, 3 }, { 1437, 1437 }, 0 },
+	/*  941 */ { 0, 0x44, { 3, 3 }, { 1440, 1440 }, 0 },
+	/*  942 */ { 0, 0x44, { 3, 3 }, { 1443, 1443 }, 0 },
+	/*  943 */ { 0, 0x44, { 3, 3 }, { 1446, 1446 }, 0 },
+	/*  944 */ { 0, 0x44, { 3, 3 }, { 1449, 1449 }, 0 },
+	/*  945 */ { 0, 0x44, { 3, 3 }, { 1452, 1452 }, 0 },
+	/*  946 */ { 0, 0x44, { 3, 3 }, { 1455, 1455 }, 0 },
+	/*  947 */ { 0, 0x44, { 3, 3 }, { 1458, 1458 }, 0 },
+	/*  948 */ { 0, 0x44, { 3, 3 }, { 1461, 1461 }, 0 },
+	/*  949 */ { 0, 0x44, { 3, 3 }, { 1464, 1464 }, 0 },
+	/*  950 */ { 0, 0x44, { 3, 3 }, { 1467, 1467 }, 0 },
+	/*  951 */ { 0, 0x44, { 3, 3 }, { 1470, 1470 }, 0 },
+	/*  952 */ { 0, 0x44, { 3, 3 }, { 1473, 1473 }, 0 },
+	/*  953 */ { 0, 0x44, { 2, 2 }, { 1476, 1476 }, 896 },
+	/*  954 */ { 0, 0x44, { 2, 2 }, { 1478, 1478 }, 898 },
+	/*  955 */ { 0, 0x44, { 2, 2 }, { 1480, 1480 }, 0 },
+	/*  956 */ { 0, 0x44, { 2, 2 }, { 1482, 1482 }, 0 },
+	/*  957 */ { 0, 0x44, { 2, 2 }, { 1484, 1484 }, 0 },
+	/*  958 */ { 0, 0x44, { 2, 2 }, { 1486, 1486 }, 0 },
+	/*  959 */ { 0, 0x44, { 3, 3 }, { 1488, 1488 }, 0 },
+	/*  960 */ { 0, 0x44, { 3, 3 }, { 1491, 1491 }, 0 },
+	/*  961 */ { 0, 0x44, { 3, 3 }, { 1494, 1494 }, 0 },
+	/*  962 */ { 0, 0x44, { 3, 3 }, { 1497, 1497 }, 0 },
+	/*  963 */ { 0, 0x44, { 3, 3 }, { 1500, 1500 }, 0 },
+	/*  964 */ { 0, 0x44, { 3, 3 }, { 1503, 1503 }, 0 },
+	/*  965 */ { 0, 0x44, { 3, 3 }, { 1506, 1506 }, 0 },
+	/*  966 */ { 0, 0x44, { 3, 3 }, { 1509, 1509 }, 0 },
+	/*  967 */ { 0, 0x44, { 3, 3 }, { 1512, 1512 }, 0 },
+	/*  968 */ { 0, 0x44, { 3, 3 }, { 1515, 1515 }, 0 },
+	/*  969 */ { 0, 0x44, { 2, 2 }, { 1518, 1518 }, 0 },
+	/*  970 */ { 0, 0x44, { 2, 2 }, { 1520, 1520 }, 0 },
+	/*  971 */ { 0, 0x44, { 2, 2 }, { 1522, 1522 }, 0 },
+	/*  972 */ { 0, 0x44, { 2, 2 }, { 1524, 1524 }, 0 },
+	/*  973 */ { 0, 0x44, { 2, 2 }, { 1526, 1526 }, 900 },
+	/*  974 */ { 0, 0x44, { 2, 2 }, { 1528, 1528 }, 902 },
+	/*  975 */ { 0, 0x44, { 2, 2 }, { 1530, 1530 }, 0 },
+	/*  976 */ { 0, 0x44, { 2, 2 }, { 1532, 1532 }, 0 },
+	/*  977 */ { 0, 0x44, { 3, 3 }, { 1534, 1534 }, 0 },
+	/*  978 */ { 0, 0x44, { 3, 3 }, { 1537, 1537 }, 0 },
+	/*  979 */ { 0, 0x44, { 3, 3 }, { 1540, 1540 }, 0 },
+	/*  980 */ { 0, 0x44, { 3, 3 }, { 1543, 1543 }, 0 },
+	/*  981 */ { 0, 0x44, { 3, 3 }, { 1546, 1546 }, 0 },
+	/*  982 */ { 0, 0x44, { 3, 3 }, { 1549, 1549 }, 0 },
+	/*  983 */ { 0, 0x44, { 3, 3 }, { 1552, 1552 }, 0 },
+	/*  984 */ { 0, 0x44, { 3, 3 }, { 1555, 1555 }, 0 },
+	/*  985 */ { 0, 0x44, { 3, 3 }, { 1558, 1558 }, 0 },
+	/*  986 */ { 0, 0x44, { 3, 3 }, { 1561, 1561 }, 0 },
+	/*  987 */ { 0, 0x44, { 3, 3 }, { 1564, 1564 }, 0 },
+	/*  988 */ { 0, 0x44, { 3, 3 }, { 1567, 1567 }, 0 },
+	/*  989 */ { 0, 0x44, { 3, 3 }, { 1570, 1570 }, 0 },
+	/*  990 */ { 0, 0x44, { 3, 3 }, { 1573, 1573 }, 0 },
+	/*  991 */ { 0, 0x44, { 3, 3 }, { 1576, 1576 }, 0 },
+	/*  992 */ { 0, 0x44, { 3, 3 }, { 1579, 1579 }, 0 },
+	/*  993 */ { 0, 0x44, { 3, 3 }, { 1582, 1582 }, 0 },
+	/*  994 */ { 0, 0x44, { 3, 3 }, { 1585, 1585 }, 0 },
+	/*  995 */ { 0, 0x44, { 3, 3 }, { 1588, 1588 }, 0 },
+	/*  996 */ { 0, 0x44, { 3, 3 }, { 1591, 1591 }, 0 },
+	/*  997 */ { 0, 0x44, { 2, 2 }, { 1594, 1594 }, 0 },
+	/*  998 */ { 0, 0x44, { 2, 2 }, { 1596, 1596 }, 0 },
+	/*  999 */ { 0, 0x44, { 2, 2 }, { 1598, 1598 }, 0 },
+	/* 1000 */ { 0, 0x44, { 2, 2 }, { 1600, 1600 }, 0 },
+	/* 1001 */ { 0, 0x44, { 3, 3 }, { 1602, 1602 }, 0 },
+	/* 1002 */ { 0, 0x44, { 3, 3 }, { 1605, 1605 }, 0 },
+	/* 1003 */ { 0, 0x44, { 3, 3 }, { 1608, 1608 }, 0 },
+	/* 1004 */ { 0, 0x44, { 3, 3 }, { 1611, 1611 }, 0 },
+	/* 1005 */ { 0, 0x44, { 3, 3 }, { 1614, 1614 }, 0 },
+	/* 1006 */ { 0, 0x44, { 3, 3 }, { 1617, 1617 }, 0 },
+	/* 1007 */ { 0, 0x44, { 3, 3 }, { 1620, 1620 }, 0 },
+	/* 1008 */ { 0, 0x44, { 3, 3 }, { 1623, 1623 }, 0 },
+	/* 1009 */ { 0, 0x44, { 3, 3 }, { 1626, 1626 }, 0 },
+	/* 1010 */ { 0, 0x44, { 3, 3 }, { 1629, 1629 }, 0 },
+	/* 1011 */ { 0, 0x44, { 2, 2 }, { 1632, 1632 }, 0 },
+	/* 1012 */ { 0, 0x44, { 2, 2 }, { 1634, 1634 }, 0 },
+	/* 1013 */ { 0, 0x44, { 2, 2 }, { 1636, 1636 }, 0 },
+	/* 1014 */ { 0, 0x44, { 2, 2 }, { 1638, 1638 }, 0 },
+	/* 1015 */ { 0, 0x44, { 2, 2 }, { 1640, 1640 }, 0 },
+	/* 1016 */ { 0, 0x44, { 2, 2 }, { 1642, 1642 }, 0 },
+	/* 1017 */ { 0, 0x44, { 2, 2 }, { 1644, 1644 }, 0 },
+	/* 1018 */ { 0, 0x44, { 2, 2 }, { 1646, 1646 }, 0 },
+	/* 1019 */ { 0, 0x44, { 2, 2 }, { 1648, 1648 }, 904 },
+	/* 1020 */ { 0, 0x44, { 2, 2 }, { 1650, 1650 }, 909 },
+	/* 1021 */ { 0, 0x44, { 3, 3 }, { 1652, 1652 }, 914 },
+	/* 1022 */ { 0, 0x44, { 3, 3 }, { 1655, 1655 }, 916 },
+	/* 1023 */ { 0, 0x44, { 3, 3 }, { 1658, 1658 }, 918 },
+	/* 1024 */ { 0, 0x44, { 3, 3 }, { 1661, 1661 }, 920 },
+	/* 1025 */ { 0, 0x44, { 3, 3 }, { 1664, 1664 }, 922 },
+	/* 1026 */ { 0, 0x44, { 3, 3 }, { 1667, 1667 }, 924 },
+	/* 1027 */ { 0, 0x44, { 2, 2 }, { 1670, 1670 }, 926 },
+	/* 1028 */ { 0, 0x44, { 2, 2 }, { 1672, 1672 }, 931 },
+	/* 1029 */ { 0, 0x44, { 3, 3 }, { 1674, 1674 }, 936 },
+	/* 1030 */ { 0, 0x44, { 3, 3 }, { 1677, 1677 }, 938 },
+	/* 1031 */ { 0, 0x44, { 3, 3 }, { 1680, 1680 }, 940 },
+	/* 1032 */ { 0, 0x44, { 3, 3 }, { 1683, 1683 }, 942 },
+	/* 1033 */ { 0, 0x44, { 3, 3 }, { 1686, 1686 }, 944 },
+	/* 1034 */ { 0, 0x44, { 3, 3 }, { 1689, 1689 }, 946 },
+	/* 1035 */ { 0, 0x44, { 2, 2 }, { 1692, 1692 }, 948 },
+	/* 1036 */ { 0, 0x44, { 2, 2 }, { 1694, 1694 }, 951 },
+	/* 1037 */ { 0, 0x44, { 3, 3 }, { 1696, 1696 }, 0 },
+	/* 1038 */ { 0, 0x44, { 3, 3 }, { 1699, 1699 }, 0 },
+	/* 1039 */ { 0, 0x44, { 3, 3 }, { 1702, 1702 }, 0 },
+	/* 1040 */ { 0, 0x44, { 3, 3 }, { 1705, 1705 }, 0 },
+	/* 1041 */ { 0, 0x44, { 2, 2 }, { 1708, 1708 }, 954 },
+	/* 1042 */ { 0, 0x44, { 2, 2 }, { 1710, 1710 }, 957 },
+	/* 1043 */ { 0, 0x44, { 3, 3 }, { 1712, 1712 }, 0 },
+	/* 1044 */ { 0, 0x44, { 3, 3 }, { 1715, 1715 }, 0 },
+	/* 1045 */ { 0, 0x44, { 3, 3 }, { 1718, 1718 }, 0 },
+	/* 1046 */ { 0, 0x44, { 3, 3 }, { 1721, 1721 }, 0 },
+	/* 1047 */ { 0, 0x44, { 2, 2 }, { 1724, 1724 }, 960 },
+	/* 1048 */ { 0, 0x44, { 2, 2 }, { 1726, 1726 }, 965 },
+	/* 1049 */ { 0, 0x44, { 3, 3 }, { 1728, 1728 }, 970 },
+	/* 1050 */ { 0, 0x44, { 3, 3 }, { 1731, 1731 }, 972 },
+	/* 1051 */ { 0, 0x44, { 3, 3 }, { 1734, 1734 }, 974 },
+	/* 1052 */ { 0, 0x44, { 3, 3 }, { 1737, 1737 }, 976 },
+	/* 1053 */ { 0, 0x44, { 3, 3 }, { 1740, 1740 }, 978 },
+	/* 1054 */ { 0, 0x44, { 3, 3 }, { 1743, 1743 }, 980 },
+	/* 1055 */ { 0, 0x44, { 2, 2 }, { 1746, 1746 }, 982 },
+	/* 1056 */ { 0, 0x44, { 2, 2 }, { 1748, 1748 }, 987 },
+	/* 1057 */ { 0, 0x44, { 3, 3 }, { 1750, 1750 }, 992 },
+	/* 1058 */ { 0, 0x44, { 3, 3 }, { 1753, 1753 }, 994 },
+	/* 1059 */ { 0, 0x44, { 3, 3 }, { 1756, 1756 }, 996 },
+	/* 1060 */ { 0, 0x44, { 3, 3 }, { 1759, 1759 }, 998 },
+	/* 1061 */ { 0, 0x44, { 3, 3 }, { 1762, 1762 }, 1000 },
+	/* 1062 */ { 0, 0x44, { 3, 3 }, { 1765, 1765 }, 1002 },
+	/* 1063 */ { 0, 0x44, { 2, 2 }, { 1768, 1768 }, 1004 },
+	/* 1064 */ { 0, 0x44, { 2, 2 }, { 1770, 1770 }, 1008 },
+	/* 1065 */ { 0, 0x44, { 3, 3 }, { 1772, 1772 }, 0 },
+	/* 1066 */ { 0, 0x44, { 3, 3 }, { 1775, 1775 }, 0 },
+	/* 1067 */ { 0, 0x44, { 3, 3 }, { 1778, 1778 }, 0 },
+	/* 1068 */ { 0, 0x44, { 3, 3 }, { 1781, 1781 }, 0 },
+	/* 1069 */ { 0, 0x44, { 3, 3 }, { 1784, 1784 }, 0 },
+	/* 1070 */ { 0, 0x44, { 3, 3 }, { 1787, 1787 }, 0 },
+	/* 1071 */ { 0, 0x44, { 2, 2 }, { 1790, 1790 }, 1012 },
+	/* 1072 */ { 0, 0x44, { 2, 2 }, { 1792, 1792 }, 1016 },
+	/* 1073 */ { 0, 0x44, { 3, 3 }, { 1794, 1794 }, 0 },
+	/* 1074 */ { 0, 0x44, { 3, 3 }, { 1797, 1797 }, 0 },
+	/* 1075 */ { 0, 0x44, { 3, 3 }, { 1800, 1800 }, 0 },
+	/* 1076 */ { 0, 0x44, { 3, 3 }, { 1803, 1803 }, 0 },
+	/* 1077 */ { 0, 0x44, { 3, 3 }, { 1806, 1806 }, 0 },
+	/* 1078 */ { 0, 0x44, { 3, 3 }, { 1809, 1809 }, 0 },
+	/* 1079 */ { 0, 0x44, { 2, 2 }, { 1812, 1812 }, 1020 },
+	/* 1080 */ { 0, 0x44, { 2, 2 }, { 1814, 1814 }, 1023 },
+	/* 1081 */ { 0, 0x44, { 3, 3 }, { 1816, 1816 }, 0 },
+	/* 1082 */ { 0, 0x44, { 3, 3 }, { 1819, 1819 }, 0 },
+	/* 1083 */ { 0, 0x44, { 3, 3 }, { 1822, 1822 }, 0 },
+	/* 1084 */ { 0, 0x44, { 3, 3 }, { 1825, 1825 }, 0 },
+	/* 1085 */ { 0, 0x44, { 2, 2 }, { 1828, 1828 }, 1026 },
+	/* 1086 */ { 0, 0x44, { 2, 2 }, { 1830, 1830 }, 1029 },
+	/* 1087 */ { 0, 0x44, { 3, 3 }, { 1832, 1832 }, 0 },
+	/* 1088 */ { 0, 0x44, { 3, 3 }, { 1835, 1835 }, 0 },
+	/* 1089 */ { 0, 0x44, { 3, 3 }, { 1838, 1838 }, 0 },
+	/* 1090 */ { 0, 0x44, { 3, 3 }, { 1841, 1841 }, 0 },
+	/* 1091 */ { 0, 0x44, { 2, 2 }, { 1844, 1844 }, 1032 },
+	/* 1092 */ { 0, 0x44, { 2, 2 }, { 1846, 1846 }, 1036 },
+	/* 1093 */ { 0, 0x44, { 3, 3 }, { 1848, 1848 }, 0 },
+	/* 1094 */ { 0, 0x44, { 3, 3 }, { 1851, 1851 }, 0 },
+	/* 1095 */ { 0, 0x44, { 3, 3 }, { 1854, 1854 }, 0 },
+	/* 1096 */ { 0, 0x44, { 3, 3 }, { 1857, 1857 }, 0 },
+	/* 1097 */ { 0, 0x44, { 3, 3 }, { 1860, 1860 }, 0 },
+	/* 1098 */ { 0, 0x44, { 3, 3 }, { 1863, 1863 }, 0 },
+	/* 1099 */ { 0, 0x44, { 2, 2 }, { 1866, 1866 }, 1040 },
+	/* 1100 */ { 0, 0x44, { 3, 3 }, { 1868, 1868 }, 0 },
+	/* 1101 */ { 0, 0x44, { 3, 3 }, { 1871, 1871 }, 0 },
+	/* 1102 */ { 0, 0x44, { 3, 3 }, { 1874, 1874 }, 0 },
+	/* 1103 */ { 0, 0x44, { 2, 2 }, { 1877, 1877 }, 1044 },
+	/* 1104 */ { 0, 0x44, { 2, 2 }, { 1879, 1879 }, 1049 },
+	/* 1105 */ { 0, 0x44, { 3, 3 }, { 1881, 1881 }, 1054 },
+	/* 1106 */ { 0, 0x44, { 3, 3 }, { 1884, 1884 }, 1056 },
+	/* 1107 */ { 0, 0x44, { 3, 3 }, { 1887, 1887 }, 1058 },
+	/* 1108 */ { 0, 0x44, { 3, 3 }, { 1890, 1890 }, 1060 },
+	/* 1109 */ { 0, 0x44, { 3, 3 }, { 1893, 1893 }, 1062 },
+	/* 1110 */ { 0, 0x44, { 3, 3 }, { 1896, 1896 }, 1064 },
+	/* 1111 */ { 0, 0x44, { 2, 2 }, { 1899, 1899 }, 1066 },
+	/* 1112 */ { 0, 0x44, { 2, 2 }, { 1901, 1901 }, 1071 },
+	/* 1113 */ { 0, 0x44, { 3, 3 }, { 1903, 1903 }, 1076 },
+	/* 1114 */ { 0, 0x44, { 3, 3 }, { 1906, 1906 }, 1078 },
+	/* 1115 */ { 0, 0x44, { 3, 3 }, { 1909, 1909 }, 1080 },
+	/* 1116 */ { 0, 0x44, { 3, 3 }, { 1912, 1912 }, 1082 },
+	/* 1117 */ { 0, 0x44, { 3, 3 }, { 1915, 1915 }, 1084 },
+	/* 1118 */ { 0, 0x44, { 3, 3 }, { 1918, 1918 }, 1086 },
+	/* 1119 */ { 0, 0x44, { 2, 2 }, { 1921, 1921 }, 1088 },
+	/* 1120 */ { 0, 0x55, { 2, 2 }, { 650, 650 }, 0 },
+	/* 1121 */ { 0, 0x44, { 2, 2 }, { 1923, 1923 }, 0 },
+	/* 1122 */ { 0, 0x55, { 2, 2 }, { 652, 652 }, 0 },
+	/* 1123 */ { 0, 0x44, { 2, 2 }, { 1925, 1925 }, 1090 },
+	/* 1124 */ { 0, 0x55, { 2, 2 }, { 654, 654 }, 0 },
+	/* 1125 */ { 0, 0x44, { 2, 2 }, { 1927, 1927 }, 0 },
+	/* 1126 */ { 0, 0x55, { 2, 2 }, { 656, 656 }, 0 },
+	/* 1127 */ { 0, 0x44, { 2, 2 }, { 1929, 1929 }, 0 },
+	/* 1128 */ { 0, 0x55, { 2, 2 }, { 665, 665 }, 0 },
+	/* 1129 */ { 0, 0x44, { 2, 2 }, { 1931, 1931 }, 0 },
+	/* 1130 */ { 0, 0x55, { 2, 2 }, { 667, 667 }, 0 },
+	/* 1131 */ { 0, 0x44, { 2, 2 }, { 1933, 1933 }, 1092 },
+	/* 1132 */ { 0, 0x55, { 2, 2 }, { 669, 669 }, 0 },
+	/* 1133 */ { 0, 0x44, { 3, 3 }, { 1935, 1935 }, 0 },
+	/* 1134 */ { 0, 0x44, { 3, 3 }, { 1938, 1938 }, 0 },
+	/* 1135 */ { 0, 0x44, { 4, 4 }, { 1941, 1941 }, 0 },
+	/* 1136 */ { 0, 0x44, { 4, 4 }, { 1945, 1945 }, 0 },
+	/* 1137 */ { 0, 0x44, { 4, 4 }, { 1949, 1949 }, 0 },
+	/* 1138 */ { 0, 0x44, { 4, 4 }, { 1953, 1953 }, 0 },
+	/* 1139 */ { 0, 0x44, { 4, 4 }, { 1957, 1957 }, 0 },
+	/* 1140 */ { 0, 0x44, { 4, 4 }, { 1961, 1961 }, 0 },
+	/* 1141 */ { 0, 0x44, { 3, 3 }, { 1965, 1965 }, 0 },
+	/* 1142 */ { 0, 0x44, { 3, 3 }, { 1968, 1968 }, 0 },
+	/* 1143 */ { 0, 0x44, { 4, 4 }, { 1971, 1971 }, 0 },
+	/* 1144 */ { 0, 0x44, { 4, 4 }, { 1975, 1975 }, 0 },
+	/* 1145 */ { 0, 0x44, { 4, 4 }, { 1979, 1979 }, 0 },
+	/* 1146 */ { 0, 0x44, { 4, 4 }, { 1983, 1983 }, 0 },
+	/* 1147 */ { 0, 0x44, { 4, 4 }, { 1987, 1987 }, 0 },
+	/* 1148 */ { 0, 0x44, { 4, 4 }, { 1991, 1991 }, 0 },
+	/* 1149 */ { 0, 0x44, { 3, 3 }, { 1995, 1995 }, 0 },
+	/* 1150 */ { 0, 0x44, { 3, 3 }, { 1998, 1998 }, 0 },
+	/* 1151 */ { 0, 0x44, { 4, 4 }, { 2001, 2001 }, 0 },
+	/* 1152 */ { 0, 0x44, { 4, 4 }, { 2005, 2005 }, 0 },
+	/* 1153 */ { 0, 0x44, { 4, 4 }, { 2009, 2009 }, 0 },
+	/* 1154 */ { 0, 0x44, { 4, 4 }, { 2013, 2013 }, 0 },
+	/* 1155 */ { 0, 0x44, { 4, 4 }, { 2017, 2017 }, 0 },
+	/* 1156 */ { 0, 0x44, { 4, 4 }, { 2021, 2021 }, 0 },
+	/* 1157 */ { 0, 0x44, { 3, 3 }, { 2025, 2025 }, 0 },
+	/* 1158 */ { 0, 0x44, { 3, 3 }, { 2028, 2028 }, 0 },
+	/* 1159 */ { 0, 0x44, { 4, 4 }, { 2031, 2031 }, 0 },
+	/* 1160 */ { 0, 0x44, { 4, 4 }, { 2035, 2035 }, 0 },
+	/* 1161 */ { 0, 0x44, { 4, 4 }, { 2039, 2039 }, 0 },
+	/* 1162 */ { 0, 0x44, { 4, 4 }, { 2043, 2043 }, 0 },
+	/* 1163 */ { 0, 0x44, { 4, 4 }, { 2047, 2047 }, 0 },
+	/* 1164 */ { 0, 0x44, { 4, 4 }, { 2051, 2051 }, 0 },
+	/* 1165 */ { 0, 0x44, { 3, 3 }, { 2055, 2055 }, 0 },
+	/* 1166 */ { 0, 0x44, { 3, 3 }, { 2058, 2058 }, 0 },
+	/* 1167 */ { 0, 0x44, { 4, 4 }, { 2061, 2061 }, 0 },
+	/* 1168 */ { 0, 0x44, { 4, 4 }, { 2065, 2065 }, 0 },
+	/* 1169 */ { 0, 0x44, { 4, 4 }, { 2069, 2069 }, 0 },
+	/* 1170 */ { 0, 0x44, { 4, 4 }, { 2073, 2073 }, 0 },
+	/* 1171 */ { 0, 0x44, { 4, 4 }, { 2077, 2077 }, 0 },
+	/* 1172 */ { 0, 0x44, { 4, 4 }, { 2081, 2081 }, 0 },
+	/* 1173 */ { 0, 0x44, { 3, 3 }, { 2085, 2085 }, 0 },
+	/* 1174 */ { 0, 0x44, { 3, 3 }, { 2088, 2088 }, 0 },
+	/* 1175 */ { 0, 0x44, { 4, 4 }, { 2091, 2091 }, 0 },
+	/* 1176 */ { 0, 0x44, { 4, 4 }, { 2095, 2095 }, 0 },
+	/* 1177 */ { 0, 0x44, { 4, 4 }, { 2099, 2099 }, 0 },
+	/* 1178 */ { 0, 0x44, { 4, 4 }, { 2103, 2103 }, 0 },
+	/* 1179 */ { 0, 0x44, { 4, 4 }, { 2107, 2107 }, 0 },
+	/* 1180 */ { 0, 0x44, { 4, 4 }, { 2111, 2111 }, 0 },
+	/* 1181 */ { 0, 0x44, { 2, 2 }, { 2115, 2115 }, 0 },
+	/* 1182 */ { 0, 0x44, { 2, 2 }, { 2117, 2117 }, 0 },
+	/* 1183 */ { 0, 0x44, { 3, 3 }, { 2119, 2119 }, 0 },
+	/* 1184 */ { 0, 0x44, { 2, 2 }, { 2122, 2122 }, 0 },
+	/* 1185 */ { 0, 0x44, { 3, 3 }, { 2124, 2124 }, 0 },
+	/* 1186 */ { 0, 0x44, { 2, 2 }, { 2127, 2127 }, 1094 },
+	/* 1187 */ { 0, 0x44, { 3, 3 }, { 2129, 2129 }, 0 },
+	/* 1188 */ { 0, 0x44, { 2, 2 }, { 2132, 2132 }, 0 },
+	/* 1189 */ { 0, 0x44, { 2, 2 }, { 2134, 2134 }, 0 },
+	/* 1190 */ { 0, 0x44, { 2, 2 }, { 2136, 2136 }, 0 },
+	/* 1191 */ { 0, 0x55, { 2, 2 }, { 628, 628 }, 0 },
+	/* 1192 */ { 0, 0x44, { 2, 2 }, { 2138, 2138 }, 0 },
+	/* 1193 */ { 0, 0x50, { 0, 2 }, { 0, 2140 }, 0 },
+	/* 1194 */ { 0, 0x55, { 1, 1 }, { 2142, 2142 }, 0 },
+	/* 1195 */ { 0, 0x50, { 0, 2 }, { 0, 2140 }, 1096 },
+	/* 1196 */ { 0, 0x50, { 0, 2 }, { 0, 2143 }, 0 },
+	/* 1197 */ { 0, 0x54, { 2, 3 }, { 2145, 2147 }, 0 },
+	/* 1198 */ { 0, 0x44, { 3, 3 }, { 2150, 2150 }, 0 },
+	/* 1199 */ { 0, 0x44, { 2, 2 }, { 2153, 2153 }, 0 },
+	/* 1200 */ { 0, 0x44, { 3, 3 }, { 2155, 2155 }, 0 },
+	/* 1201 */ { 0, 0x44, { 2, 2 }, { 2158, 2158 }, 1100 },
+	/* 1202 */ { 0, 0x44, { 3, 3 }, { 2160, 2160 }, 0 },
+	/* 1203 */ { 0, 0x44, { 2, 2 }, { 2163, 2163 }, 0 },
+	/* 1204 */ { 0, 0x55, { 2, 2 }, { 631, 631 }, 0 },
+	/* 1205 */ { 0, 0x44, { 2, 2 }, { 2165, 2165 }, 0 },
+	/* 1206 */ { 0, 0x55, { 2, 2 }, { 633, 633 }, 0 },
+	/* 1207 */ { 0, 0x44, { 2, 2 }, { 2167, 2167 }, 0 },
+	/* 1208 */ { 0, 0x54, { 2, 3 }, { 2169, 2171 }, 0 },
+	/* 1209 */ { 0, 0x54, { 2, 3 }, { 2174, 2176 }, 0 },
+	/* 1210 */ { 0, 0x54, { 2, 3 }, { 2179, 2181 }, 0 },
+	/* 1211 */ { 0, 0x44, { 2, 2 }, { 2184, 2184 }, 0 },
+	/* 1212 */ { 0, 0x44, { 2, 2 }, { 2186, 2186 }, 0 },
+	/* 1213 */ { 0, 0x44, { 3, 3 }, { 2188, 2188 }, 0 },
+	/* 1214 */ { 0, 0x55, { 3, 3 }, { 643, 643 }, 0 },
+	/* 1215 */ { 0, 0x44, { 2, 2 }, { 2191, 2191 }, 0 },
+	/* 1216 */ { 0, 0x44, { 3, 3 }, { 2193, 2193 }, 0 },
+	/* 1217 */ { 0, 0x44, { 2, 2 }, { 2196, 2196 }, 0 },
+	/* 1218 */ { 0, 0x44, { 2, 2 }, { 2198, 2198 }, 0 },
+	/* 1219 */ { 0, 0x44, { 2, 2 }, { 2200, 2200 }, 0 },
+	/* 1220 */ { 0, 0x55, { 2, 2 }, { 635, 635 }, 0 },
+	/* 1221 */ { 0, 0x54, { 2, 3 }, { 2202, 2204 }, 0 },
+	/* 1222 */ { 0, 0x54, { 2, 3 }, { 2207, 2209 }, 0 },
+	/* 1223 */ { 0, 0x54, { 2, 3 }, { 2212, 2214 }, 0 },
+	/* 1224 */ { 0, 0x44, { 2, 2 }, { 2217, 2217 }, 0 },
+	/* 1225 */ { 0, 0x44, { 2, 2 }, { 2219, 2219 }, 0 },
+	/* 1226 */ { 0, 0x44, { 3, 3 }, { 2221, 2221 }, 0 },
+	/* 1227 */ { 0, 0x55, { 3, 3 }, { 658, 658 }, 0 },
+	/* 1228 */ { 0, 0x44, { 2, 2 }, { 2224, 2224 }, 0 },
+	/* 1229 */ { 0, 0x44, { 2, 2 }, { 2226, 2226 }, 0 },
+	/* 1230 */ { 0, 0x44, { 2, 2 }, { 2228, 2228 }, 0 },
+	/* 1231 */ { 0, 0x44, { 3, 3 }, { 2230, 2230 }, 0 },
+	/* 1232 */ { 0, 0x44, { 2, 2 }, { 2233, 2233 }, 0 },
+	/* 1233 */ { 0, 0x44, { 2, 2 }, { 2235, 2235 }, 0 },
+	/* 1234 */ { 0, 0x44, { 2, 2 }, { 2237, 2237 }, 0 },
+	/* 1235 */ { 0, 0x55, { 2, 2 }, { 639, 639 }, 0 },
+	/* 1236 */ { 0, 0x44, { 2, 2 }, { 2239, 2239 }, 0 },
+	/* 1237 */ { 0, 0x54, { 2, 3 }, { 2241, 2243 }, 0 },
+	/* 1238 */ { 0, 0x55, { 2, 3 }, { 623, 625 }, 0 },
+	/* 1239 */ { 0, 0x55, { 1, 1 }, { 2246, 2246 }, 0 },
+	/* 1240 */ { 0, 0x44, { 3, 3 }, { 2247, 2247 }, 0 },
+	/* 1241 */ { 0, 0x44, { 2, 2 }, { 2250, 2250 }, 0 },
+	/* 1242 */ { 0, 0x44, { 3, 3 }, { 2252, 2252 }, 0 },
+	/* 1243 */ { 0, 0x44, { 2, 2 }, { 2255, 2255 }, 1102 },
+	/* 1244 */ { 0, 0x44, { 3, 3 }, { 2257, 2257 }, 0 },
+	/* 1245 */ { 0, 0x44, { 2, 2 }, { 2260, 2260 }, 0 },
+	/* 1246 */ { 0, 0x55, { 2, 2 }, { 637, 637 }, 0 },
+	/* 1247 */ { 0, 0x44, { 2, 2 }, { 2262, 2262 }, 0 },
+	/* 1248 */ { 0, 0x55, { 2, 2 }, { 641, 641 }, 0 },
+	/* 1249 */ { 0, 0x44, { 2, 2 }, { 2264, 2264 }, 0 },
+	/* 1250 */ { 0, 0x55, { 1, 2 }, { 2266, 9 }, 0 },
+	/* 1251 */ { 0, 0x50, { 0, 2 }, { 0, 2267 }, 1104 },
+	/* 1252 */ { 0, 0x55, { 1, 1 }, { 2269, 1 }, 0 },
+	/* 1253 */ { 0, 0x55, { 1, 1 }, { 2270, 1 }, 0 },
+	/* 1254 */ { 0, 0x50, { 0, 1 }, { 0, 2271 }, 0 },
+	/* 1255 */ { 0, 0x50, { 0, 2 }, { 0, 2272 }, 0 },
+	/* 1256 */ { 0, 0x50, { 0, 1 }, { 0, 2274 }, 0 },
+	/* 1257 */ { 0, 0x50, { 0, 2 }, { 0, 2275 }, 0 },
+	/* 1258 */ { 0, 0x50, { 0, 3 }, { 0, 2277 }, 0 },
+	/* 1259 */ { 0, 0x50, { 0, 2 }, { 0, 2280 }, 0 },
+	/* 1260 */ { 0, 0x50, { 0, 3 }, { 0, 2282 }, 0 },
+	/* 1261 */ { 0, 0x50, { 0, 2 }, { 0, 2285 }, 0 },
+	/* 1262 */ { 0, 0x50, { 0, 3 }, { 0, 2287 }, 0 },
+	/* 1263 */ { 0, 0x50, { 0, 2 }, { 0, 2290 }, 0 },
+	/* 1264 */ { 0, 0x50, { 0, 2 }, { 0, 2292 }, 0 },
+	/* 1265 */ { 0, 0x50, { 0, 2 }, { 0, 2294 }, 0 },
+	/* 1266 */ { 0, 0x50, { 0, 2 }, { 0, 2296 }, 0 },
+	/* 1267 */ { 0, 0x50, { 0, 2 }, { 0, 2298 }, 0 },
+	/* 1268 */ { 0, 0x50, { 0, 4 }, { 0, 2300 }, 0 },
+	/* 1269 */ { 0, 0x50, { 0, 1 }, { 0, 2304 }, 0 },
+	/* 1270 */ { 0, 0x50, { 0, 1 }, { 0, 2305 }, 0 },
+	/* 1271 */ { 0, 0x50, { 0, 1 }, { 0, 2306 }, 0 },
+	/* 1272 */ { 0, 0x50, { 0, 1 }, { 0, 2307 }, 0 },
+	/* 1273 */ { 0, 0x50, { 0, 1 }, { 0, 2308 }, 0 },
+	/* 1274 */ { 0, 0x50, { 0, 1 }, { 0, 2309 }, 0 },
+	/* 1275 */ { 0, 0x50, { 0, 1 }, { 0, 2310 }, 0 },
+	/* 1276 */ { 0, 0x50, { 0, 1 }, { 0, 2311 }, 0 },
+	/* 1277 */ { 0, 0x50, { 0, 1 }, { 0, 2312 }, 0 },
+	/* 1278 */ { 0, 0x50, { 0, 1 }, { 0, 2313 }, 0 },
+	/* 1279 */ { 0, 0x50, { 0, 1 }, { 0, 2314 }, 0 },
+	/* 1280 */ { 0, 0x50, { 0, 1 }, { 0, 2315 }, 0 },
+	/* 1281 */ { 0, 0x50, { 0, 1 }, { 0, 2316 }, 0 },
+	/* 1282 */ { 0, 0x50, { 0, 2 }, { 0, 2317 }, 0 },
+	/* 1283 */ { 0, 0x50, { 0, 3 }, { 0, 2319 }, 0 },
+	/* 1284 */ { 0, 0x50, { 0, 3 }, { 0, 2322 }, 0 },
+	/* 1285 */ { 0, 0x50, { 0, 1 }, { 0, 2325 }, 0 },
+	/* 1286 */ { 0, 0x50, { 0, 2 }, { 0, 2326 }, 0 },
+	/* 1287 */ { 0, 0x50, { 0, 3 }, { 0, 2328 }, 0 },
+	/* 1288 */ { 0, 0x50, { 0, 3 }, { 0, 2331 }, 0 },
+	/* 1289 */ { 0, 0x50, { 0, 1 }, { 0, 2334 }, 0 },
+	/* 1290 */ { 0, 0x50, { 0, 2 }, { 0, 2335 }, 0 },
+	/* 1291 */ { 0, 0x50, { 0, 1 }, { 0, 2337 }, 0 },
+	/* 1292 */ { 0, 0x50, { 0, 2 }, { 0, 2338 }, 0 },
+	/* 1293 */ { 0, 0x50, { 0, 1 }, { 0, 2340 }, 0 },
+	/* 1294 */ { 0, 0x50, { 0, 2 }, { 0, 2341 }, 0 },
+	/* 1295 */ { 0, 0x50, { 0, 3 }, { 0, 2343 }, 0 },
+	/* 1296 */ { 0, 0x50, { 0, 2 }, { 0, 2346 }, 0 },
+	/* 1297 */ { 0, 0x50, { 0, 1 }, { 0, 2348 }, 0 },
+	/* 1298 */ { 0, 0x55, { 1, 1 }, { 2349, 2349 }, 0 },
+	/* 1299 */ { 0, 0x55, { 1, 1 }, { 990, 990 }, 0 },
+	/* 1300 */ { 0, 0x55, { 2, 2 }, { 35, 35 }, 0 },
+	/* 1301 */ { 0, 0x50, { 0, 1 }, { 0, 2350 }, 0 },
+	/* 1302 */ { 0, 0x50, { 0, 1 }, { 0, 2351 }, 0 },
+	/* 1303 */ { 0, 0x50, { 0, 1 }, { 0, 2352 }, 0 },
+	/* 1304 */ { 0, 0x50, { 0, 1 }, { 0, 2353 }, 0 },
+	/* 1305 */ { 0, 0x50, { 0, 1 }, { 0, 2354 }, 0 },
+	/* 1306 */ { 0, 0x50, { 0, 3 }, { 0, 2355 }, 0 },
+	/* 1307 */ { 0, 0x50, { 0, 1 }, { 0, 2358 }, 0 },
+	/* 1308 */ { 0, 0x50, { 0, 1 }, { 0, 2359 }, 0 },
+	/* 1309 */ { 0, 0x50, { 0, 1 }, { 0, 2360 }, 0 },
+	/* 1310 */ { 0, 0x50, { 0, 3 }, { 0, 2361 }, 0 },
+	/* 1311 */ { 0, 0x50, { 0, 3 }, { 0, 2364 }, 0 },
+	/* 1312 */ { 0, 0x50, { 0, 4 }, { 0, 2367 }, 0 },
+	/* 1313 */ { 0, 0x50, { 0, 3 }, { 0, 2371 }, 0 },
+	/* 1314 */ { 0, 0x50, { 0, 3 }, { 0, 2374 }, 0 },
+	/* 1315 */ { 0, 0x50, { 0, 3 }, { 0, 2377 }, 0 },
+	/* 1316 */ { 0, 0x50, { 0, 3 }, { 0, 2380 }, 0 },
+	/* 1317 */ { 0, 0x50, { 0, 3 }, { 0, 2383 }, 0 },
+	/* 1318 */ { 0, 0x50, { 0, 3 }, { 0, 2386 }, 0 },
+	/* 1319 */ { 0, 0x50, { 0, 3 }, { 0, 2389 }, 0 },
+	/* 1320 */ { 0, 0x50, { 0, 3 }, { 0, 2392 }, 0 },
+	/* 1321 */ { 0, 0x50, { 0, 3 }, { 0, 2395 }, 0 },
+	/* 1322 */ { 0, 0x50, { 0, 3 }, { 0, 2398 }, 0 },
+	/* 1323 */ { 0, 0x50, { 0, 3 }, { 0, 2401 }, 0 },
+	/* 1324 */ { 0, 0x50, { 0, 3 }, { 0, 2404 }, 0 },
+	/* 1325 */ { 0, 0x50, { 0, 2 }, { 0, 2407 }, 0 },
+	/* 1326 */ { 0, 0x50, { 0, 2 }, { 0, 2409 }, 0 },
+	/* 1327 */ { 0, 0x50, { 0, 3 }, { 0, 2411 }, 0 },
+	/* 1328 */ { 0, 0x50, { 0, 2 }, { 0, 2414 }, 0 },
+	/* 1329 */ { 0, 0x50, { 0, 1 }, { 0, 2416 }, 0 },
+	/* 1330 */ { 0, 0x50, { 0, 2 }, { 0, 2417 }, 0 },
+	/* 1331 */ { 0, 0x50, { 0, 3 }, { 0, 2419 }, 0 },
+	/* 1332 */ { 0, 0x50, { 0, 4 }, { 0, 2422 }, 0 },
+	/* 1333 */ { 0, 0x50, { 0, 2 }, { 0, 2426 }, 0 },
+	/* 1334 */ { 0, 0x50, { 0, 1 }, { 0, 2428 }, 0 },
+	/* 1335 */ { 0, 0x50, { 0, 2 }, { 0, 2429 }, 0 },
+	/* 1336 */ { 0, 0x50, { 0, 3 }, { 0, 2431 }, 0 },
+	/* 1337 */ { 0, 0x50, { 0, 2 }, { 0, 2434 }, 0 },
+	/* 1338 */ { 0, 0x50, { 0, 3 }, { 0, 2436 }, 0 },
+	/* 1339 */ { 0, 0x50, { 0, 2 }, { 0, 2439 }, 0 },
+	/* 1340 */ { 0, 0x50, { 0, 2 }, { 0, 2441 }, 0 },
+	/* 1341 */ { 0, 0x50, { 0, 3 }, { 0, 2443 }, 0 },
+	/* 1342 */ { 0, 0x50, { 0, 4 }, { 0, 2446 }, 0 },
+	/* 1343 */ { 0, 0x50, { 0, 2 }, { 0, 2450 }, 0 },
+	/* 1344 */ { 0, 0x50, { 0, 2 }, { 0, 2452 }, 0 },
+	/* 1345 */ { 0, 0x50, { 0, 3 }, { 0, 2454 }, 0 },
+	/* 1346 */ { 0, 0x50, { 0, 3 }, { 0, 2457 }, 0 },
+	/* 1347 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1108 },
+	/* 1348 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1110 },
+	/* 1349 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1112 },
+	/* 1350 */ { 0, 0x44, { 2, 2 }, { 2460, 2460 }, 0 },
+	/* 1351 */ { 0, 0x44, { 2, 2 }, { 2462, 2462 }, 0 },
+	/* 1352 */ { 0, 0x44, { 2, 2 }, { 2464, 2464 }, 0 },
+	/* 1353 */ { 0, 0x44, { 2, 2 }, { 2466, 2466 }, 0 },
+	/* 1354 */ { 0, 0x44, { 2, 2 }, { 2468, 2468 }, 0 },
+	/* 1355 */ { 0, 0x44, { 2, 2 }, { 2470, 2470 }, 0 },
+	/* 1356 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1114 },
+	/* 1357 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1116 },
+	/* 1358 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1118 },
+	/* 1359 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1120 },
+	/* 1360 */ { 0, 0x44, { 2, 2 }, { 2472, 2472 }, 0 },
+	/* 1361 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1122 },
+	/* 1362 */ { 0, 0x44, { 2, 2 }, { 2474, 2474 }, 0 },
+	/* 1363 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1124 },
+	/* 1364 */ { 0, 0x44, { 2, 2 }, { 2476, 2476 }, 0 },
+	/* 1365 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1126 },
+	/* 1366 */ { 0, 0x44, { 2, 2 }, { 2478, 2478 }, 0 },
+	/* 1367 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1128 },
+	/* 1368 */ { 0, 0x44, { 2, 2 }, { 2480, 2480 }, 0 },
+	/* 1369 */ { 0, 0x50, { 0, 2 }, { 0, 2482 }, 0 },
+	/* 1370 */ { 0, 0x50, { 0, 3 }, { 0, 2484 }, 0 },
+	/* 1371 */ { 0, 0x50, { 0, 2 }, { 0, 2487 }, 0 },
+	/* 1372 */ { 0, 0x50, { 0, 3 }, { 0, 2489 }, 0 },
+	/* 1373 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1130 },
+	/* 1374 */ { 0, 0x44, { 2, 2 }, { 2492, 2492 }, 0 },
+	/* 1375 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1132 },
+	/* 1376 */ { 0, 0x44, { 2, 2 }, { 2494, 2494 }, 0 },
+	/* 1377 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1134 },
+	/* 1378 */ { 0, 0x44, { 2, 2 }, { 2496, 2496 }, 0 },
+	/* 1379 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1136 },
+	/* 1380 */ { 0, 0x44, { 2, 2 }, { 2498, 2498 }, 0 },
+	/* 1381 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1138 },
+	/* 1382 */ { 0, 0x44, { 2, 2 }, { 2500, 2500 }, 0 },
+	/* 1383 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1140 },
+	/* 1384 */ { 0, 0x44, { 2, 2 }, { 2502, 2502 }, 0 },
+	/* 1385 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1142 },
+	/* 1386 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1144 },
+	/* 1387 */ { 0, 0x44, { 2, 2 }, { 2504, 2504 }, 0 },
+	/* 1388 */ { 0, 0x44, { 2, 2 }, { 2506, 2506 }, 0 },
+	/* 1389 */ { 0, 0x44, { 2, 2 }, { 2508, 2508 }, 0 },
+	/* 1390 */ { 0, 0x44, { 2, 2 }, { 2510, 2510 }, 0 },
+	/* 1391 */ { 0, 0x44, { 2, 2 }, { 2512, 2512 }, 0 },
+	/* 1392 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1146 },
+	/* 1393 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1148 },
+	/* 1394 */ { 0, 0x44, { 2, 2 }, { 2514, 2514 }, 0 },
+	/* 1395 */ { 0, 0x44, { 2, 2 }, { 2516, 2516 }, 0 },
+	/* 1396 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1150 },
+	/* 1397 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1152 },
+	/* 1398 */ { 0, 0x44, { 2, 2 }, { 2518, 2518 }, 0 },
+	/* 1399 */ { 0, 0x44, { 2, 2 }, { 2520, 2520 }, 0 },
+	/* 1400 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1154 },
+	/* 1401 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1156 },
+	/* 1402 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1158 },
+	/* 1403 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1160 },
+	/* 1404 */ { 0, 0x44, { 2, 2 }, { 2522, 2522 }, 0 },
+	/* 1405 */ { 0, 0x44, { 2, 2 }, { 2524, 2524 }, 0 },
+	/* 1406 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1162 },
+	/* 1407 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1164 },
+	/* 1408 */ { 0, 0x44, { 2, 2 }, { 2526, 2526 }, 0 },
+	/* 1409 */ { 0, 0x44, { 2, 2 }, { 2528, 2528 }, 0 },
+	/* 1410 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1166 },
+	/* 1411 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1168 },
+	/* 1412 */ { 0, 0x44, { 2, 2 }, { 2530, 2530 }, 0 },
+	/* 1413 */ { 0, 0x44, { 2, 2 }, { 2532, 2532 }, 0 },
+	/* 1414 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1170 },
+	/* 1415 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1172 },
+	/* 1416 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1174 },
+	/* 1417 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1176 },
+	/* 1418 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1178 },
+	/* 1419 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1180 },
+	/* 1420 */ { 0, 0x44, { 2, 2 }, { 2534, 2534 }, 0 },
+	/* 1421 */ { 0, 0x44, { 2, 2 }, { 2536, 2536 }, 0 },
+	/* 1422 */ { 0, 0x44, { 2, 2 }, { 2538, 2538 }, 0 },
+	/* 1423 */ { 0, 0x44, { 2, 2 }, { 2540, 2540 }, 0 },
+	/* 1424 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1182 },
+	/* 1425 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1184 },
+	/* 1426 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1186 },
+	/* 1427 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1188 },
+	/* 1428 */ { 0, 0x44, { 2, 2 }, { 2542, 2542 }, 0 },
+	/* 1429 */ { 0, 0x44, { 2, 2 }, { 2544, 2544 }, 0 },
+	/* 1430 */ { 0, 0x44, { 2, 2 }, { 2546, 2546 }, 0 },
+	/* 1431 */ { 0, 0x44, { 2, 2 }, { 2548, 2548 }, 0 },
+	/* 1432 */ { 0, 0x44, { 2, 2 }, { 2550, 2550 }, 0 },
+	/* 1433 */ { 0, 0x44, { 2, 2 }, { 2552, 2552 }, 0 },
+	/* 1434 */ { 0, 0x44, { 2, 2 }, { 2554, 2554 }, 0 },
+	/* 1435 */ { 0, 0x44, { 2, 2 }, { 2556, 2556 }, 0 },
+	/* 1436 */ { 0, 0x55, { 1, 1 }, { 2558, 2558 }, 0 },
+	/* 1437 */ { 0, 0x55, { 1, 1 }, { 2559, 2559 }, 0 },
+	/* 1438 */ { 0, 0x50, { 0, 2 }, { 0, 2560 }, 0 },
+	/* 1439 */ { 0, 0x50, { 0, 2 }, { 0, 2562 }, 0 },
+	/* 1440 */ { 0, 0x50, { 0, 2 }, { 0, 2564 }, 0 },
+	/* 1441 */ { 0, 0x50, { 0, 2 }, { 0, 2566 }, 0 },
+	/* 1442 */ { 0, 0x50, { 0, 2 }, { 0, 2568 }, 0 },
+	/* 1443 */ { 0, 0x50, { 0, 2 }, { 0, 2570 }, 0 },
+	/* 1444 */ { 0, 0x50, { 0, 2 }, { 0, 2572 }, 0 },
+	/* 1445 */ { 0, 0x50, { 0, 2 }, { 0, 2574 }, 0 },
+	/* 1446 */ { 0, 0x50, { 0, 2 }, { 0, 2576 }, 0 },
+	/* 1447 */ { 0, 0x50, { 0, 2 }, { 0, 2578 }, 0 },
+	/* 1448 */ { 0, 0x50, { 0, 2 }, { 0, 2580 }, 0 },
+	/* 1449 */ { 0, 0x50, { 0, 3 }, { 0, 2582 }, 0 },
+	/* 1450 */ { 0, 0x50, { 0, 3 }, { 0, 2585 }, 0 },
+	/* 1451 */ { 0, 0x50, { 0, 3 }, { 0, 2588 }, 0 },
+	/* 1452 */ { 0, 0x50, { 0, 3 }, { 0, 2591 }, 0 },
+	/* 1453 */ { 0, 0x50, { 0, 3 }, { 0, 2594 }, 0 },
+	/* 1454 */ { 0, 0x50, { 0, 3 }, { 0, 2597 }, 0 },
+	/* 1455 */ { 0, 0x50, { 0, 3 }, { 0, 2600 }, 0 },
+	/* 1456 */ { 0, 0x50, { 0, 3 }, { 0, 2603 }, 0 },
+	/* 1457 */ { 0, 0x50, { 0, 3 }, { 0, 2606 }, 0 },
+	/* 1458 */ { 0, 0x50, { 0, 4 }, { 0, 2609 }, 0 },
+	/* 1459 */ { 0, 0x50, { 0, 4 }, { 0, 2613 }, 0 },
+	/* 1460 */ { 0, 0x50, { 0, 4 }, { 0, 2617 }, 0 },
+	/* 1461 */ { 0, 0x50, { 0, 4 }, { 0, 2621 }, 0 },
+	/* 1462 */ { 0, 0x50, { 0, 4 }, { 0, 2625 }, 0 },
+	/* 1463 */ { 0, 0x50, { 0, 4 }, { 0, 2629 }, 0 },
+	/* 1464 */ { 0, 0x50, { 0, 4 }, { 0, 2633 }, 0 },
+	/* 1465 */ { 0, 0x50, { 0, 4 }, { 0, 2637 }, 0 },
+	/* 1466 */ { 0, 0x50, { 0, 4 }, { 0, 2641 }, 0 },
+	/* 1467 */ { 0, 0x50, { 0, 4 }, { 0, 2645 }, 0 },
+	/* 1468 */ { 0, 0x50, { 0, 4 }, { 0, 2649 }, 0 },
+	/* 1469 */ { 0, 0x50, { 0, 2 }, { 0, 2653 }, 0 },
+	/* 1470 */ { 0, 0x50, { 0, 2 }, { 0, 2655 }, 0 },
+	/* 1471 */ { 0, 0x50, { 0, 2 }, { 0, 2657 }, 0 },
+	/* 1472 */ { 0, 0x50, { 0, 2 }, { 0, 2659 }, 0 },
+	/* 1473 */ { 0, 0x50, { 0, 2 }, { 0, 2661 }, 0 },
+	/* 1474 */ { 0, 0x50, { 0, 2 }, { 0, 2663 }, 0 },
+	/* 1475 */ { 0, 0x50, { 0, 2 }, { 0, 2665 }, 0 },
+	/* 1476 */ { 0, 0x50, { 0, 2 }, { 0, 2667 }, 0 },
+	/* 1477 */ { 0, 0x50, { 0, 2 }, { 0, 2669 }, 0 },
+	/* 1478 */ { 0, 0x50, { 0, 3 }, { 0, 2671 }, 0 },
+	/* 1479 */ { 0, 0x50, { 0, 3 }, { 0, 2674 }, 0 },
+	/* 1480 */ { 0, 0x50, { 0, 3 }, { 0, 2677 }, 0 },
+	/* 1481 */ { 0, 0x50, { 0, 3 }, { 0, 2680 }, 0 },
+	/* 1482 */ { 0, 0x50, { 0, 3 }, { 0, 2683 }, 0 },
+	/* 1483 */ { 0, 0x50, { 0, 3 }, { 0, 2686 }, 0 },
+	/* 1484 */ { 0, 0x50, { 0, 3 }, { 0, 2689 }, 0 },
+	/* 1485 */ { 0, 0x50, { 0, 3 }, { 0, 2692 }, 0 },
+	/* 1486 */ { 0, 0x50, { 0, 3 }, { 0, 2695 }, 0 },
+	/* 1487 */ { 0, 0x50, { 0, 3 }, { 0, 2698 }, 0 },
+	/* 1488 */ { 0, 0x50, { 0, 3 }, { 0, 2701 }, 0 },
+	/* 1489 */ { 0, 0x50, { 0, 3 }, { 0, 2704 }, 0 },
+	/* 1490 */ { 0, 0x50, { 0, 3 }, { 0, 2707 }, 0 },
+	/* 1491 */ { 0, 0x50, { 0, 3 }, { 0, 2710 }, 0 },
+	/* 1492 */ { 0, 0x50, { 0, 3 }, { 0, 2713 }, 0 },
+	/* 1493 */ { 0, 0x50, { 0, 3 }, { 0, 2716 }, 0 },
+	/* 1494 */ { 0, 0x50, { 0, 3 }, { 0, 2719 }, 0 },
+	/* 1495 */ { 0, 0x50, { 0, 3 }, { 0, 2722 }, 0 },
+	/* 1496 */ { 0, 0x50, { 0, 3 }, { 0, 2725 }, 0 },
+	/* 1497 */ { 0, 0x50, { 0, 3 }, { 0, 2728 }, 0 },
+	/* 1498 */ { 0, 0x50, { 0, 3 }, { 0, 2731 }, 0 },
+	/* 1499 */ { 0, 0x50, { 0, 3 }, { 0, 2734 }, 0 },
+	/* 1500 */ { 0, 0x50, { 0, 3 }, { 0, 2737 }, 0 },
+	/* 1501 */ { 0, 0x50, { 0, 3 }, { 0, 2740 }, 0 },
+	/* 1502 */ { 0, 0x50, { 0, 3 }, { 0, 2743 }, 0 },
+	/* 1503 */ { 0, 0x50, { 0, 3 }, { 0, 2746 }, 0 },
+	/* 1504 */ { 0, 0x50, { 0, 3 }, { 0, 2749 }, 0 },
+	/* 1505 */ { 0, 0x50, { 0, 3 }, { 0, 2752 }, 0 },
+	/* 1506 */ { 0, 0x50, { 0, 3 }, { 0, 2755 }, 0 },
+	/* 1507 */ { 0, 0x50, { 0, 3 }, { 0, 2758 }, 0 },
+	/* 1508 */ { 0, 0x50, { 0, 3 }, { 0, 2761 }, 0 },
+	/* 1509 */ { 0, 0x50, { 0, 3 }, { 0, 2764 }, 0 },
+	/* 1510 */ { 0, 0x50, { 0, 3 }, { 0, 2767 }, 0 },
+	/* 1511 */ { 0, 0x50, { 0, 3 }, { 0, 2770 }, 0 },
+	/* 1512 */ { 0, 0x50, { 0, 3 }, { 0, 2773 }, 0 },
+	/* 1513 */ { 0, 0x50, { 0, 3 }, { 0, 2776 }, 0 },
+	/* 1514 */ { 0, 0x50, { 0, 3 }, { 0, 2779 }, 0 },
+	/* 1515 */ { 0, 0x50, { 0, 1 }, { 0, 2782 }, 0 },
+	/* 1516 */ { 0, 0x50, { 0, 1 }, { 0, 2783 }, 0 },
+	/* 1517 */ { 0, 0x50, { 0, 1 }, { 0, 2784 }, 0 },
+	/* 1518 */ { 0, 0x50, { 0, 4 }, { 0, 2785 }, 0 },
+	/* 1519 */ { 0, 0x50, { 0, 3 }, { 0, 2789 }, 0 },
+	/* 1520 */ { 0, 0x50, { 0, 2 }, { 0, 2792 }, 0 },
+	/* 1521 */ { 0, 0x50, { 0, 3 }, { 0, 2794 }, 0 },
+	/* 1522 */ { 0, 0x55, { 2, 2 }, { 2797, 2797 }, 0 },
+	/* 1523 */ { 0, 0x50, { 0, 1 }, { 0, 2799 }, 0 },
+	/* 1524 */ { 0, 0x50, { 0, 1 }, { 0, 2800 }, 0 },
+	/* 1525 */ { 0, 0x50, { 0, 1 }, { 0, 2801 }, 0 },
+	/* 1526 */ { 0, 0x50, { 0, 1 }, { 0, 2802 }, 0 },
+	/* 1527 */ { 0, 0x50, { 0, 1 }, { 0, 2803 }, 0 },
+	/* 1528 */ { 0, 0x50, { 0, 1 }, { 0, 2804 }, 0 },
+	/* 1529 */ { 0, 0x50, { 0, 1 }, { 0, 2805 }, 0 },
+	/* 1530 */ { 0, 0x50, { 0, 1 }, { 0, 2806 }, 0 },
+	/* 1531 */ { 0, 0x50, { 0, 1 }, { 0, 2807 }, 0 },
+	/* 1532 */ { 0, 0x50, { 0, 1 }, { 0, 2808 }, 0 },
+	/* 1533 */ { 0, 0x50, { 0, 1 }, { 0, 2809 }, 0 },
+	/* 1534 */ { 0, 0x50, { 0, 1 }, { 0, 2810 }, 0 },
+	/* 1535 */ { 0, 0x50, { 0, 1 }, { 0, 2811 }, 0 },
+	/* 1536 */ { 0, 0x50, { 0, 1 }, { 0, 2812 }, 0 },
+	/* 1537 */ { 0, 0x50, { 0, 1 }, { 0, 2813 }, 0 },
+	/* 1538 */ { 0, 0x50, { 0, 1 }, { 0, 2814 }, 0 },
+	/* 1539 */ { 0, 0x50, { 0, 1 }, { 0, 2815 }, 0 },
+	/* 1540 */ { 0, 0x50, { 0, 1 }, { 0, 2816 }, 0 },
+	/* 1541 */ { 0, 0x50, { 0, 1 }, { 0, 2817 }, 0 },
+	/* 1542 */ { 0, 0x50, { 0, 1 }, { 0, 2818 }, 0 },
+	/* 1543 */ { 0, 0x50, { 0, 1 }, { 0, 2819 }, 0 },
+	/* 1544 */ { 0, 0x50, { 0, 1 }, { 0, 2820 }, 0 },
+	/* 1545 */ { 0, 0x50, { 0, 1 }, { 0, 2821 }, 0 },
+	/* 1546 */ { 0, 0x50, { 0, 1 }, { 0, 2822 }, 0 },
+	/* 1547 */ { 0, 0x50, { 0, 1 }, { 0, 2823 }, 0 },
+	/* 1548 */ { 0, 0x50, { 0, 1 }, { 0, 2824 }, 0 },
+	/* 1549 */ { 0, 0x50, { 0, 1 }, { 0, 2825 }, 0 },
+	/* 1550 */ { 0, 0x50, { 0, 1 }, { 0, 2826 }, 0 },
+	/* 1551 */ { 0, 0x50, { 0, 1 }, { 0, 2827 }, 0 },
+	/* 1552 */ { 0, 0x50, { 0, 1 }, { 0, 2828 }, 0 },
+	/* 1553 */ { 0, 0x50, { 0, 1 }, { 0, 2829 }, 0 },
+	/* 1554 */ { 0, 0x50, { 0, 1 }, { 0, 2830 }, 0 },
+	/* 1555 */ { 0, 0x50, { 0, 1 }, { 0, 2831 }, 0 },
+	/* 1556 */ { 0, 0x50, { 0, 1 }, { 0, 2832 }, 0 },
+	/* 1557 */ { 0, 0x50, { 0, 1 }, { 0, 2833 }, 0 },
+	/* 1558 */ { 0, 0x50, { 0, 1 }, { 0, 2834 }, 0 },
+	/* 1559 */ { 0, 0x50, { 0, 1 }, { 0, 2835 }, 0 },
+	/* 1560 */ { 0, 0x50, { 0, 1 }, { 0, 2836 }, 0 },
+	/* 1561 */ { 0, 0x50, { 0, 1 }, { 0, 2837 }, 0 },
+	/* 1562 */ { 0, 0x50, { 0, 1 }, { 0, 2838 }, 0 },
+	/* 1563 */ { 0, 0x50, { 0, 1 }, { 0, 2839 }, 0 },
+	/* 1564 */ { 0, 0x50, { 0, 1 }, { 0, 2840 }, 0 },
+	/* 1565 */ { 0, 0x50, { 0, 1 }, { 0, 2841 }, 0 },
+	/* 1566 */ { 0, 0x50, { 0, 1 }, { 0, 2842 }, 0 },
+	/* 1567 */ { 0, 0x50, { 0, 1 }, { 0, 2843 }, 0 },
+	/* 1568 */ { 0, 0x50, { 0, 1 }, { 0, 2844 }, 0 },
+	/* 1569 */ { 0, 0x50, { 0, 1 }, { 0, 2845 }, 0 },
+	/* 1570 */ { 0, 0x50, { 0, 1 }, { 0, 2846 }, 0 },
+	/* 1571 */ { 0, 0x50, { 0, 1 }, { 0, 2847 }, 0 },
+	/* 1572 */ { 0, 0x50, { 0, 1 }, { 0, 2848 }, 0 },
+	/* 1573 */ { 0, 0x50, { 0, 1 }, { 0, 2849 }, 0 },
+	/* 1574 */ { 0, 0x50, { 0, 1 }, { 0, 2850 }, 0 },
+	/* 1575 */ { 0, 0x50, { 0, 1 }, { 0, 2851 }, 0 },
+	/* 1576 */ { 0, 0x50, { 0, 1 }, { 0, 2852 }, 0 },
+	/* 1577 */ { 0, 0x50, { 0, 1 }, { 0, 2853 }, 0 },
+	/* 1578 */ { 0, 0x50, { 0, 1 }, { 0, 2854 }, 0 },
+	/* 1579 */ { 0, 0x50, { 0, 1 }, { 0, 2855 }, 0 },
+	/* 1580 */ { 0, 0x50, { 0, 1 }, { 0, 2856 }, 0 },
+	/* 1581 */ { 0, 0x50, { 0, 1 }, { 0, 2857 }, 0 },
+	/* 1582 */ { 0, 0x50, { 0, 1 }, { 0, 2858 }, 0 },
+	/* 1583 */ { 0, 0x50, { 0, 1 }, { 0, 2859 }, 0 },
+	/* 1584 */ { 0, 0x50, { 0, 1 }, { 0, 2860 }, 0 },
+	/* 1585 */ { 0, 0x50, { 0, 1 }, { 0, 2861 }, 0 },
+	/* 1586 */ { 0, 0x50, { 0, 1 }, { 0, 2862 }, 0 },
+	/* 1587 */ { 0, 0x50, { 0, 1 }, { 0, 2863 }, 0 },
+	/* 1588 */ { 0, 0x50, { 0, 1 }, { 0, 2864 }, 0 },
+	/* 1589 */ { 0, 0x50, { 0, 1 }, { 0, 2865 }, 0 },
+	/* 1590 */ { 0, 0x50, { 0, 1 }, { 0, 2866 }, 0 },
+	/* 1591 */ { 0, 0x50, { 0, 1 }, { 0, 2867 }, 0 },
+	/* 1592 */ { 0, 0x50, { 0, 1 }, { 0, 2868 }, 0 },
+	/* 1593 */ { 0, 0x50, { 0, 1 }, { 0, 2869 }, 0 },
+	/* 1594 */ { 0, 0x50, { 0, 1 }, { 0, 2870 }, 0 },
+	/* 1595 */ { 0, 0x50, { 0, 1 }, { 0, 2871 }, 0 },
+	/* 1596 */ { 0, 0x50, { 0, 1 }, { 0, 2872 }, 0 },
+	/* 1597 */ { 0, 0x50, { 0, 1 }, { 0, 2873 }, 0 },
+	/* 1598 */ { 0, 0x50, { 0, 1 }, { 0, 2874 }, 0 },
+	/* 1599 */ { 0, 0x50, { 0, 1 }, { 0, 2875 }, 0 },
+	/* 1600 */ { 0, 0x50, { 0, 1 }, { 0, 2876 }, 0 },
+	/* 1601 */ { 0, 0x50, { 0, 1 }, { 0, 2877 }, 0 },
+	/* 1602 */ { 0, 0x50, { 0, 1 }, { 0, 2878 }, 0 },
+	/* 1603 */ { 0, 0x50, { 0, 1 }, { 0, 2879 }, 0 },
+	/* 1604 */ { 0, 0x50, { 0, 1 }, { 0, 2880 }, 0 },
+	/* 1605 */ { 0, 0x50, { 0, 1 }, { 0, 2881 }, 0 },
+	/* 1606 */ { 0, 0x50, { 0, 1 }, { 0, 2882 }, 0 },
+	/* 1607 */ { 0, 0x50, { 0, 1 }, { 0, 2883 }, 0 },
+	/* 1608 */ { 0, 0x50, { 0, 1 }, { 0, 2884 }, 0 },
+	/* 1609 */ { 0, 0x50, { 0, 1 }, { 0, 2885 }, 0 },
+	/* 1610 */ { 0, 0x50, { 0, 1 }, { 0, 2886 }, 0 },
+	/* 1611 */ { 0, 0x50, { 0, 1 }, { 0, 2887 }, 0 },
+	/* 1612 */ { 0, 0x50, { 0, 1 }, { 0, 2888 }, 0 },
+	/* 1613 */ { 0, 0x50, { 0, 1 }, { 0, 2889 }, 0 },
+	/* 1614 */ { 0, 0x50, { 0, 1 }, { 0, 2890 }, 0 },
+	/* 1615 */ { 0, 0x50, { 0, 1 }, { 0, 2891 }, 0 },
+	/* 1616 */ { 0, 0x50, { 0, 1 }, { 0, 2892 }, 0 },
+	/* 1617 */ { 0, 0x50, { 0, 1 }, { 0, 2893 }, 0 },
+	/* 1618 */ { 0, 0x50, { 0, 1 }, { 0, 2894 }, 0 },
+	/* 1619 */ { 0, 0x50, { 0, 1 }, { 0, 2895 }, 0 },
+	/* 1620 */ { 0, 0x50, { 0, 1 }, { 0, 2896 }, 0 },
+	/* 1621 */ { 0, 0x50, { 0, 1 }, { 0, 2897 }, 0 },
+	/* 1622 */ { 0, 0x50, { 0, 1 }, { 0, 2898 }, 0 },
+	/* 1623 */ { 0, 0x50, { 0, 1 }, { 0, 2899 }, 0 },
+	/* 1624 */ { 0, 0x50, { 0, 1 }, { 0, 2900 }, 0 },
+	/* 1625 */ { 0, 0x50, { 0, 1 }, { 0, 2901 }, 0 },
+	/* 1626 */ { 0, 0x50, { 0, 1 }, { 0, 2902 }, 0 },
+	/* 1627 */ { 0, 0x50, { 0, 1 }, { 0, 2903 }, 0 },
+	/* 1628 */ { 0, 0x50, { 0, 1 }, { 0, 2904 }, 0 },
+	/* 1629 */ { 0, 0x50, { 0, 1 }, { 0, 2905 }, 0 },
+	/* 1630 */ { 0, 0x50, { 0, 1 }, { 0, 2906 }, 0 },
+	/* 1631 */ { 0, 0x50, { 0, 1 }, { 0, 2907 }, 0 },
+	/* 1632 */ { 0, 0x50, { 0, 1 }, { 0, 2908 }, 0 },
+	/* 1633 */ { 0, 0x50, { 0, 1 }, { 0, 2909 }, 0 },
+	/* 1634 */ { 0, 0x50, { 0, 1 }, { 0, 2910 }, 0 },
+	/* 1635 */ { 0, 0x50, { 0, 1 }, { 0, 2911 }, 0 },
+	/* 1636 */ { 0, 0x50, { 0, 1 }, { 0, 2912 }, 0 },
+	/* 1637 */ { 0, 0x50, { 0, 1 }, { 0, 2913 }, 0 },
+	/* 1638 */ { 0, 0x50, { 0, 1 }, { 0, 2914 }, 0 },
+	/* 1639 */ { 0, 0x50, { 0, 1 }, { 0, 2915 }, 0 },
+	/* 1640 */ { 0, 0x50, { 0, 1 }, { 0, 2916 }, 0 },
+	/* 1641 */ { 0, 0x50, { 0, 1 }, { 0, 2917 }, 0 },
+	/* 1642 */ { 0, 0x50, { 0, 1 }, { 0, 2918 }, 0 },
+	/* 1643 */ { 0, 0x50, { 0, 1 }, { 0, 2919 }, 0 },
+	/* 1644 */ { 0, 0x50, { 0, 1 }, { 0, 2920 }, 0 },
+	/* 1645 */ { 0, 0x50, { 0, 1 }, { 0, 2921 }, 0 },
+	/* 1646 */ { 0, 0x50, { 0, 1 }, { 0, 2922 }, 0 },
+	/* 1647 */ { 0, 0x50, { 0, 1 }, { 0, 2923 }, 0 },
+	/* 1648 */ { 0, 0x50, { 0, 1 }, { 0, 2924 }, 0 },
+	/* 1649 */ { 0, 0x50, { 0, 1 }, { 0, 2925 }, 0 },
+	/* 1650 */ { 0, 0x50, { 0, 1 }, { 0, 2926 }, 0 },
+	/* 1651 */ { 0, 0x50, { 0, 1 }, { 0, 2927 }, 0 },
+	/* 1652 */ { 0, 0x50, { 0, 1 }, { 0, 2928 }, 0 },
+	/* 1653 */ { 0, 0x50, { 0, 1 }, { 0, 2929 }, 0 },
+	/* 1654 */ { 0, 0x50, { 0, 1 }, { 0, 2930 }, 0 },
+	/* 1655 */ { 0, 0x50, { 0, 1 }, { 0, 2931 }, 0 },
+	/* 1656 */ { 0, 0x50, { 0, 1 }, { 0, 2932 }, 0 },
+	/* 1657 */ { 0, 0x50, { 0, 1 }, { 0, 2933 }, 0 },
+	/* 1658 */ { 0, 0x50, { 0, 1 }, { 0, 2934 }, 0 },
+	/* 1659 */ { 0, 0x50, { 0, 1 }, { 0, 2935 }, 0 },
+	/* 1660 */ { 0, 0x50, { 0, 1 }, { 0, 2936 }, 0 },
+	/* 1661 */ { 0, 0x50, { 0, 1 }, { 0, 2937 }, 0 },
+	/* 1662 */ { 0, 0x50, { 0, 1 }, { 0, 2938 }, 0 },
+	/* 1663 */ { 0, 0x50, { 0, 1 }, { 0, 2939 }, 0 },
+	/* 1664 */ { 0, 0x50, { 0, 1 }, { 0, 2940 }, 0 },
+	/* 1665 */ { 0, 0x50, { 0, 1 }, { 0, 2941 }, 0 },
+	/* 1666 */ { 0, 0x50, { 0, 1 }, { 0, 2942 }, 0 },
+	/* 1667 */ { 0, 0x50, { 0, 1 }, { 0, 2943 }, 0 },
+	/* 1668 */ { 0, 0x50, { 0, 1 }, { 0, 2944 }, 0 },
+	/* 1669 */ { 0, 0x50, { 0, 1 }, { 0, 2945 }, 0 },
+	/* 1670 */ { 0, 0x50, { 0, 1 }, { 0, 2946 }, 0 },
+	/* 1671 */ { 0, 0x50, { 0, 1 }, { 0, 2947 }, 0 },
+	/* 1672 */ { 0, 0x50, { 0, 1 }, { 0, 2948 }, 0 },
+	/* 1673 */ { 0, 0x50, { 0, 1 }, { 0, 2949 }, 0 },
+	/* 1674 */ { 0, 0x50, { 0, 1 }, { 0, 2950 }, 0 },
+	/* 1675 */ { 0, 0x50, { 0, 1 }, { 0, 2951 }, 0 },
+	/* 1676 */ { 0, 0x50, { 0, 1 }, { 0, 2952 }, 0 },
+	/* 1677 */ { 0, 0x50, { 0, 1 }, { 0, 2953 }, 0 },
+	/* 1678 */ { 0, 0x50, { 0, 1 }, { 0, 2954 }, 0 },
+	/* 1679 */ { 0, 0x50, { 0, 1 }, { 0, 2955 }, 0 },
+	/* 1680 */ { 0, 0x50, { 0, 1 }, { 0, 2956 }, 0 },
+	/* 1681 */ { 0, 0x50, { 0, 1 }, { 0, 2957 }, 0 },
+	/* 1682 */ { 0, 0x50, { 0, 1 }, { 0, 2958 }, 0 },
+	/* 1683 */ { 0, 0x50, { 0, 1 }, { 0, 2959 }, 0 },
+	/* 1684 */ { 0, 0x50, { 0, 1 }, { 0, 2960 }, 0 },
+	/* 1685 */ { 0, 0x50, { 0, 1 }, { 0, 2961 }, 0 },
+	/* 1686 */ { 0, 0x50, { 0, 1 }, { 0, 2962 }, 0 },
+	/* 1687 */ { 0, 0x50, { 0, 1 }, { 0, 2963 }, 0 },
+	/* 1688 */ { 0, 0x50, { 0, 1 }, { 0, 2964 }, 0 },
+	/* 1689 */ { 0, 0x50, { 0, 1 }, { 0, 2965 }, 0 },
+	/* 1690 */ { 0, 0x50, { 0, 1 }, { 0, 2966 }, 0 },
+	/* 1691 */ { 0, 0x50, { 0, 1 }, { 0, 2967 }, 0 },
+	/* 1692 */ { 0, 0x50, { 0, 1 }, { 0, 2968 }, 0 },
+	/* 1693 */ { 0, 0x50, { 0, 1 }, { 0, 2969 }, 0 },
+	/* 1694 */ { 0, 0x50, { 0, 1 }, { 0, 2970 }, 0 },
+	/* 1695 */ { 0, 0x50, { 0, 1 }, { 0, 2971 }, 0 },
+	/* 1696 */ { 0, 0x50, { 0, 1 }, { 0, 2972 }, 0 },
+	/* 1697 */ { 0, 0x50, { 0, 1 }, { 0, 2973 }, 0 },
+	/* 1698 */ { 0, 0x50, { 0, 1 }, { 0, 2974 }, 0 },
+	/* 1699 */ { 0, 0x50, { 0, 1 }, { 0, 2975 }, 0 },
+	/* 1700 */ { 0, 0x50, { 0, 1 }, { 0, 2976 }, 0 },
+	/* 1701 */ { 0, 0x50, { 0, 1 }, { 0, 2977 }, 0 },
+	/* 1702 */ { 0, 0x50, { 0, 1 }, { 0, 2978 }, 0 },
+	/* 1703 */ { 0, 0x50, { 0, 1 }, { 0, 2979 }, 0 },
+	/* 1704 */ { 0, 0x50, { 0, 1 }, { 0, 2980 }, 0 },
+	/* 1705 */ { 0, 0x50, { 0, 1 }, { 0, 2981 }, 0 },
+	/* 1706 */ { 0, 0x50, { 0, 1 }, { 0, 2982 }, 0 },
+	/* 1707 */ { 0, 0x50, { 0, 1 }, { 0, 2983 }, 0 },
+	/* 1708 */ { 0, 0x50, { 0, 1 }, { 0, 2984 }, 0 },
+	/* 1709 */ { 0, 0x50, { 0, 1 }, { 0, 2985 }, 0 },
+	/* 1710 */ { 0, 0x50, { 0, 1 }, { 0, 2986 }, 0 },
+	/* 1711 */ { 0, 0x50, { 0, 1 }, { 0, 2987 }, 0 },
+	/* 1712 */ { 0, 0x50, { 0, 1 }, { 0, 2988 }, 0 },
+	/* 1713 */ { 0, 0x50, { 0, 1 }, { 0, 2989 }, 0 },
+	/* 1714 */ { 0, 0x50, { 0, 1 }, { 0, 2990 }, 0 },
+	/* 1715 */ { 0, 0x50, { 0, 1 }, { 0, 2991 }, 0 },
+	/* 1716 */ { 0, 0x50, { 0, 1 }, { 0, 2992 }, 0 },
+	/* 1717 */ { 0, 0x50, { 0, 1 }, { 0, 2993 }, 0 },
+	/* 1718 */ { 0, 0x50, { 0, 1 }, { 0, 2994 }, 0 },
+	/* 1719 */ { 0, 0x50, { 0, 1 }, { 0, 2995 }, 0 },
+	/* 1720 */ { 0, 0x50, { 0, 1 }, { 0, 2996 }, 0 },
+	/* 1721 */ { 0, 0x50, { 0, 1 }, { 0, 2997 }, 0 },
+	/* 1722 */ { 0, 0x50, { 0, 1 }, { 0, 2998 }, 0 },
+	/* 1723 */ { 0, 0x50, { 0, 1 }, { 0, 2999 }, 0 },
+	/* 1724 */ { 0, 0x50, { 0, 1 }, { 0, 3000 }, 0 },
+	/* 1725 */ { 0, 0x50, { 0, 1 }, { 0, 3001 }, 0 },
+	/* 1726 */ { 0, 0x50, { 0, 1 }, { 0, 3002 }, 0 },
+	/* 1727 */ { 0, 0x50, { 0, 1 }, { 0, 3003 }, 0 },
+	/* 1728 */ { 0, 0x50, { 0, 1 }, { 0, 3004 }, 0 },
+	/* 1729 */ { 0, 0x50, { 0, 1 }, { 0, 3005 }, 0 },
+	/* 1730 */ { 0, 0x50, { 0, 1 }, { 0, 3006 }, 0 },
+	/* 1731 */ { 0, 0x50, { 0, 1 }, { 0, 3007 }, 0 },
+	/* 1732 */ { 0, 0x50, { 0, 1 }, { 0, 3008 }, 0 },
+	/* 1733 */ { 0, 0x50, { 0, 1 }, { 0, 3009 }, 0 },
+	/* 1734 */ { 0, 0x50, { 0, 1 }, { 0, 3010 }, 0 },
+	/* 1735 */ { 0, 0x50, { 0, 1 }, { 0, 3011 }, 0 },
+	/* 1736 */ { 0, 0x50, { 0, 1 }, { 0, 3012 }, 0 },
+	/* 1737 */ { 0, 0x50, { 0, 1 }, { 0, 3013 }, 0 },
+	/* 1738 */ { 0, 0x50, { 0, 1 }, { 0, 3014 }, 0 },
+	/* 1739 */ { 0, 0x50, { 0, 1 }, { 0, 3015 }, 0 },
+	/* 1740 */ { 218, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/* 1741 */ { 224, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/* 1742 */ { 0, 0x50, { 0, 1 }, { 0, 3016 }, 0 },
+	/* 1743 */ { 0, 0x50, { 0, 1 }, { 0, 3017 }, 0 },
+	/* 1744 */ { 0, 0x50, { 0, 1 }, { 0, 3018 }, 0 },
+	/* 1745 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1190 },
+	/* 1746 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1192 },
+	/* 1747 */ { 0, 0x44, { 2, 2 }, { 3019, 3019 }, 0 },
+	/* 1748 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1194 },
+	/* 1749 */ { 0, 0x44, { 2, 2 }, { 3021, 3021 }, 0 },
+	/* 1750 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1196 },
+	/* 1751 */ { 0, 0x44, { 2, 2 }, { 3023, 3023 }, 0 },
+	/* 1752 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1198 },
+	/* 1753 */ { 0, 0x44, { 2, 2 }, { 3025, 3025 }, 0 },
+	/* 1754 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1200 },
+	/* 1755 */ { 0, 0x44, { 2, 2 }, { 3027, 3027 }, 0 },
+	/* 1756 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1202 },
+	/* 1757 */ { 0, 0x44, { 2, 2 }, { 3029, 3029 }, 0 },
+	/* 1758 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1204 },
+	/* 1759 */ { 0, 0x44, { 2, 2 }, { 3031, 3031 }, 0 },
+	/* 1760 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1206 },
+	/* 1761 */ { 0, 0x44, { 2, 2 }, { 3033, 3033 }, 0 },
+	/* 1762 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1208 },
+	/* 1763 */ { 0, 0x44, { 2, 2 }, { 3035, 3035 }, 0 },
+	/* 1764 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1210 },
+	/* 1765 */ { 0, 0x44, { 2, 2 }, { 3037, 3037 }, 0 },
+	/* 1766 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1212 },
+	/* 1767 */ { 0, 0x44, { 2, 2 }, { 3039, 3039 }, 0 },
+	/* 1768 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1214 },
+	/* 1769 */ { 0, 0x44, { 2, 2 }, { 3041, 3041 }, 0 },
+	/* 1770 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1216 },
+	/* 1771 */ { 0, 0x44, { 2, 2 }, { 3043, 3043 }, 0 },
+	/* 1772 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1218 },
+	/* 1773 */ { 0, 0x44, { 2, 2 }, { 3045, 3045 }, 0 },
+	/* 1774 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1220 },
+	/* 1775 */ { 0, 0x44, { 2, 2 }, { 3047, 3047 }, 0 },
+	/* 1776 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1222 },
+	/* 1777 */ { 0, 0x44, { 2, 2 }, { 3049, 3049 }, 0 },
+	/* 1778 */ { 0, 0x44, { 2, 2 }, { 3051, 3051 }, 0 },
+	/* 1779 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1225 },
+	/* 1780 */ { 0, 0x44, { 2, 2 }, { 3053, 3053 }, 0 },
+	/* 1781 */ { 0, 0x44, { 2, 2 }, { 3055, 3055 }, 0 },
+	/* 1782 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1228 },
+	/* 1783 */ { 0, 0x44, { 2, 2 }, { 3057, 3057 }, 0 },
+	/* 1784 */ { 0, 0x44, { 2, 2 }, { 3059, 3059 }, 0 },
+	/* 1785 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1231 },
+	/* 1786 */ { 0, 0x44, { 2, 2 }, { 3061, 3061 }, 0 },
+	/* 1787 */ { 0, 0x44, { 2, 2 }, { 3063, 3063 }, 0 },
+	/* 1788 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1234 },
+	/* 1789 */ { 0, 0x44, { 2, 2 }, { 3065, 3065 }, 0 },
+	/* 1790 */ { 0, 0x44, { 2, 2 }, { 3067, 3067 }, 0 },
+	/* 1791 */ { 0, 0x44, { 2, 2 }, { 3069, 3069 }, 0 },
+	/* 1792 */ { 8, 0x22, { 0, 0 }, { 0, 0 }, 0 },
+	/* 1793 */ { 0, 0x50, { 0, 2 }, { 0, 3071 }, 0 },
+	/* 1794 */ { 0, 0x50, { 0, 2 }, { 0, 3073 }, 0 },
+	/* 1795 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1237 },
+	/* 1796 */ { 0, 0x44, { 2, 2 }, { 3075, 3075 }, 0 },
+	/* 1797 */ { 0, 0x50, { 0, 2 }, { 0, 3077 }, 0 },
+	/* 1798 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1239 },
+	/* 1799 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1241 },
+	/* 1800 */ { 0, 0x44, { 2, 2 }, { 3079, 3079 }, 0 },
+	/* 1801 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1243 },
+	/* 1802 */ { 0, 0x44, { 2, 2 }, { 3081, 3081 }, 0 },
+	/* 1803 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1245 },
+	/* 1804 */ { 0, 0x44, { 2, 2 }, { 3083, 3083 }, 0 },
+	/* 1805 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1247 },
+	/* 1806 */ { 0, 0x44, { 2, 2 }, { 3085, 3085 }, 0 },
+	/* 1807 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1249 },
+	/* 1808 */ { 0, 0x44, { 2, 2 }, { 3087, 3087 }, 0 },
+	/* 1809 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1251 },
+	/* 1810 */ { 0, 0x44, { 2, 2 }, { 3089, 3089 }, 0 },
+	/* 1811 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1253 },
+	/* 1812 */ { 0, 0x44, { 2, 2 }, { 3091, 3091 }, 0 },
+	/* 1813 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1255 },
+	/* 1814 */ { 0, 0x44, { 2, 2 }, { 3093, 3093 }, 0 },
+	/* 1815 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1257 },
+	/* 1816 */ { 0, 0x44, { 2, 2 }, { 3095, 3095 }, 0 },
+	/* 1817 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1259 },
+	/* 1818 */ { 0, 0x44, { 2, 2 }, { 3097, 3097 }, 0 },
+	/* 1819 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1261 },
+	/* 1820 */ { 0, 0x44, { 2, 2 }, { 3099, 3099 }, 0 },
+	/* 1821 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1263 },
+	/* 1822 */ { 0, 0x44, { 2, 2 }, { 3101, 3101 }, 0 },
+	/* 1823 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1265 },
+	/* 1824 */ { 0, 0x44, { 2, 2 }, { 3103, 3103 }, 0 },
+	/* 1825 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1267 },
+	/* 1826 */ { 0, 0x44, { 2, 2 }, { 3105, 3105 }, 0 },
+	/* 1827 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1269 },
+	/* 1828 */ { 0, 0x44, { 2, 2 }, { 3107, 3107 }, 0 },
+	/* 1829 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1271 },
+	/* 1830 */ { 0, 0x44, { 2, 2 }, { 3109, 3109 }, 0 },
+	/* 1831 */ { 0, 0x44, { 2, 2 }, { 3111, 3111 }, 0 },
+	/* 1832 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1274 },
+	/* 1833 */ { 0, 0x44, { 2, 2 }, { 3113, 3113 }, 0 },
+	/* 1834 */ { 0, 0x44, { 2, 2 }, { 3115, 3115 }, 0 },
+	/* 1835 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1277 },
+	/* 1836 */ { 0, 0x44, { 2, 2 }, { 3117, 3117 }, 0 },
+	/* 1837 */ { 0, 0x44, { 2, 2 }, { 3119, 3119 }, 0 },
+	/* 1838 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1280 },
+	/* 1839 */ { 0, 0x44, { 2, 2 }, { 3121, 3121 }, 0 },
+	/* 1840 */ { 0, 0x44, { 2, 2 }, { 3123, 3123 }, 0 },
+	/* 1841 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1283 },
+	/* 1842 */ { 0, 0x44, { 2, 2 }, { 3125, 3125 }, 0 },
+	/* 1843 */ { 0, 0x44, { 2, 2 }, { 3127, 3127 }, 0 },
+	/* 1844 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1286 },
+	/* 1845 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1288 },
+	/* 1846 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1290 },
+	/* 1847 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1292 },
+	/* 1848 */ { 0, 0x44, { 2, 2 }, { 3129, 3129 }, 0 },
+	/* 1849 */ { 0, 0x44, { 2, 2 }, { 3131, 3131 }, 0 },
+	/* 1850 */ { 0, 0x44, { 2, 2 }, { 3133, 3133 }, 0 },
+	/* 1851 */ { 0, 0x44, { 2, 2 }, { 3135, 3135 }, 0 },
+	/* 1852 */ { 0, 0x44, { 2, 2 }, { 3137, 3137 }, 0 },
+	/* 1853 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1294 },
+	/* 1854 */ { 0, 0x44, { 2, 2 }, { 3139, 3139 }, 0 },
+	/* 1855 */ { 0, 0x50, { 0, 2 }, { 0, 3141 }, 0 },
+	/* 1856 */ { 0, 0x50, { 0, 1 }, { 0, 3143 }, 0 },
+	/* 1857 */ { 0, 0x50, { 0, 1 }, { 0, 3144 }, 0 },
+	/* 1858 */ { 0, 0x50, { 0, 1 }, { 0, 3145 }, 0 },
+	/* 1859 */ { 0, 0x50, { 0, 1 }, { 0, 3146 }, 0 },
+	/* 1860 */ { 0, 0x50, { 0, 1 }, { 0, 3147 }, 0 },
+	/* 1861 */ { 0, 0x50, { 0, 1 }, { 0, 3148 }, 0 },
+	/* 1862 */ { 0, 0x50, { 0, 1 }, { 0, 3149 }, 0 },
+	/* 1863 */ { 0, 0x50, { 0, 1 }, { 0, 3150 }, 0 },
+	/* 1864 */ { 0, 0x50, { 0, 1 }, { 0, 3151 }, 0 },
+	/* 1865 */ { 0, 0x50, { 0, 1 }, { 0, 3152 }, 0 },
+	/* 1866 */ { 0, 0x50, { 0, 1 }, { 0, 3153 }, 0 },
+	/* 1867 */ { 0, 0x50, { 0, 1 }, { 0, 3154 }, 0 },
+	/* 1868 */ { 0, 0x50, { 0, 1 }, { 0, 3155 }, 0 },
+	/* 1869 */ { 0, 0x50, { 0, 1 }, { 0, 3156 }, 0 },
+	/* 1870 */ { 0, 0x50, { 0, 1 }, { 0, 3157 }, 0 },
+	/* 1871 */ { 0, 0x50, { 0, 1 }, { 0, 3158 }, 0 },
+	/* 1872 */ { 0, 0x50, { 0, 1 }, { 0, 3159 }, 0 },
+	/* 1873 */ { 0, 0x50, { 0, 1 }, { 0, 3160 }, 0 },
+	/* 1874 */ { 0, 0x50, { 0, 1 }, { 0, 3161 }, 0 },
+	/* 1875 */ { 0, 0x50, { 0, 1 }, { 0, 3162 }, 0 },
+	/* 1876 */ { 0, 0x50, { 0, 1 }, { 0, 3163 }, 0 },
+	/* 1877 */ { 0, 0x50, { 0, 1 }, { 0, 3164 }, 0 },
+	/* 1878 */ { 0, 0x50, { 0, 1 }, { 0, 3165 }, 0 },
+	/* 1879 */ { 0, 0x50, { 0, 1 }, { 0, 3166 }, 0 },
+	/* 1880 */ { 0, 0x50, { 0, 1 }, { 0, 3167 }, 0 },
+	/* 1881 */ { 0, 0x50, { 0, 1 }, { 0, 3168 }, 0 },
+	/* 1882 */ { 0, 0x50, { 0, 1 }, { 0, 3169 }, 0 },
+	/* 1883 */ { 0, 0x50, { 0, 1 }, { 0, 3170 }, 0 },
+	/* 1884 */ { 0, 0x50, { 0, 1 }, { 0, 3171 }, 0 },
+	/* 1885 */ { 0, 0x50, { 0, 1 }, { 0, 3172 }, 0 },
+	/* 1886 */ { 0, 0x50, { 0, 1 }, { 0, 3173 }, 0 },
+	/* 1887 */ { 0, 0x50, { 0, 1 }, { 0, 3174 }, 0 },
+	/* 1888 */ { 0, 0x50, { 0, 1 }, { 0, 3175 }, 0 },
+	/* 1889 */ { 0, 0x50, { 0, 1 }, { 0, 3176 }, 0 },
+	/* 1890 */ { 0, 0x50, { 0, 1 }, { 0, 3177 }, 0 },
+	/* 1891 */ { 0, 0x50, { 0, 1 }, { 0, 3178 }, 0 },
+	/* 1892 */ { 0, 0x50, { 0, 1 }, { 0, 3179 }, 0 },
+	/* 1893 */ { 0, 0x50, { 0, 1 }, { 0, 3180 }, 0 },
+	/* 1894 */ { 0, 0x50, { 0, 1 }, { 0, 3181 }, 0 },
+	/* 1895 */ { 0, 0x50, { 0, 1 }, { 0, 3182 }, 0 },
+	/* 1896 */ { 0, 0x50, { 0, 1 }, { 0, 3183 }, 0 },
+	/* 1897 */ { 0, 0x50, { 0, 1 }, { 0, 3184 }, 0 },
+	/* 1898 */ { 0, 0x50, { 0, 1 }, { 0, 3185 }, 0 },
+	/* 1899 */ { 0, 0x50, { 0, 1 }, { 0, 3186 }, 0 },
+	/* 1900 */ { 0, 0x50, { 0, 1 }, { 0, 3187 }, 0 },
+	/* 1901 */ { 0, 0x50, { 0, 1 }, { 0, 3188 }, 0 },
+	/* 1902 */ { 0, 0x50, { 0, 1 }, { 0, 3189 }, 0 },
+	/* 1903 */ { 0, 0x50, { 0, 1 }, { 0, 3190 }, 0 },
+	/* 1904 */ { 0, 0x50, { 0, 1 }, { 0, 3191 }, 0 },
+	/* 1905 */ { 0, 0x50, { 0, 1 }, { 0, 3192 }, 0 },
+	/* 1906 */ { 0, 0x50, { 0, 1 }, { 0, 3193 }, 0 },
+	/* 1907 */ { 0, 0x50, { 0, 1 }, { 0, 3194 }, 0 },
+	/* 1908 */ { 0, 0x50, { 0, 1 }, { 0, 3195 }, 0 },
+	/* 1909 */ { 0, 0x50, { 0, 1 }, { 0, 3196 }, 0 },
+	/* 1910 */ { 0, 0x50, { 0, 1 }, { 0, 3197 }, 0 },
+	/* 1911 */ { 0, 0x50, { 0, 1 }, { 0, 3198 }, 0 },
+	/* 1912 */ { 0, 0x50, { 0, 1 }, { 0, 3199 }, 0 },
+	/* 1913 */ { 0, 0x50, { 0, 1 }, { 0, 3200 }, 0 },
+	/* 1914 */ { 0, 0x50, { 0, 1 }, { 0, 3201 }, 0 },
+	/* 1915 */ { 0, 0x50, { 0, 1 }, { 0, 3202 }, 0 },
+	/* 1916 */ { 0, 0x50, { 0, 1 }, { 0, 3203 }, 0 },
+	/* 1917 */ { 0, 0x50, { 0, 1 }, { 0, 3204 }, 0 },
+	/* 1918 */ { 0, 0x50, { 0, 1 }, { 0, 3205 }, 0 },
+	/* 1919 */ { 0, 0x50, { 0, 1 }, { 0, 3206 }, 0 },
+	/* 1920 */ { 0, 0x50, { 0, 1 }, { 0, 3207 }, 0 },
+	/* 1921 */ { 0, 0x50, { 0, 1 }, { 0, 3208 }, 0 },
+	/* 1922 */ { 0, 0x50, { 0, 1 }, { 0, 3209 }, 0 },
+	/* 1923 */ { 0, 0x50, { 0, 1 }, { 0, 3210 }, 0 },
+	/* 1924 */ { 0, 0x50, { 0, 1 }, { 0, 3211 }, 0 },
+	/* 1925 */ { 0, 0x50, { 0, 1 }, { 0, 3212 }, 0 },
+	/* 1926 */ { 0, 0x50, { 0, 1 }, { 0, 3213 }, 0 },
+	/* 1927 */ { 0, 0x50, { 0, 1 }, { 0, 3214 }, 0 },
+	/* 1928 */ { 0, 0x50, { 0, 1 }, { 0, 3215 }, 0 },
+	/* 1929 */ { 0, 0x50, { 0, 1 }, { 0, 3216 }, 0 },
+	/* 1930 */ { 0, 0x50, { 0, 1 }, { 0, 3217 }, 0 },
+	/* 1931 */ { 0, 0x50, { 0, 1 }, { 0, 3218 }, 0 },
+	/* 1932 */ { 0, 0x50, { 0, 1 }, { 0, 3219 }, 0 },
+	/* 1933 */ { 0, 0x50, { 0, 1 }, { 0, 3220 }, 0 },
+	/* 1934 */ { 0, 0x50, { 0, 1 }, { 0, 3221 }, 0 },
+	/* 1935 */ { 0, 0x50, { 0, 1 }, { 0, 3222 }, 0 },
+	/* 1936 */ { 0, 0x50, { 0, 1 }, { 0, 3223 }, 0 },
+	/* 1937 */ { 0, 0x50, { 0, 1 }, { 0, 3224 }, 0 },
+	/* 1938 */ { 0, 0x50, { 0, 1 }, { 0, 3225 }, 0 },
+	/* 1939 */ { 0, 0x50, { 0, 1 }, { 0, 3226 }, 0 },
+	/* 1940 */ { 0, 0x50, { 0, 1 }, { 0, 3227 }, 0 },
+	/* 1941 */ { 0, 0x50, { 0, 1 }, { 0, 3228 }, 0 },
+	/* 1942 */ { 0, 0x50, { 0, 1 }, { 0, 3229 }, 0 },
+	/* 1943 */ { 0, 0x50, { 0, 1 }, { 0, 3230 }, 0 },
+	/* 1944 */ { 0, 0x50, { 0, 1 }, { 0, 3231 }, 0 },
+	/* 1945 */ { 0, 0x50, { 0, 1 }, { 0, 3232 }, 0 },
+	/* 1946 */ { 0, 0x50, { 0, 1 }, { 0, 3233 }, 0 },
+	/* 1947 */ { 0, 0x50, { 0, 1 }, { 0, 3234 }, 0 },
+	/* 1948 */ { 0, 0x50, { 0, 1 }, { 0, 3235 }, 0 },
+	/* 1949 */ { 0, 0x50, { 0, 1 }, { 0, 3236 }, 0 },
+	/* 1950 */ { 0, 0x50, { 0, 1 }, { 0, 3237 }, 0 },
+	/* 1951 */ { 0, 0x50, { 0, 1 }, { 0, 3238 }, 0 },
+	/* 1952 */ { 0, 0x50, { 0, 1 }, { 0, 3239 }, 0 },
+	/* 1953 */ { 0, 0x50, { 0, 1 }, { 0, 3240 }, 0 },
+	/* 1954 */ { 0, 0x50, { 0, 1 }, { 0, 3241 }, 0 },
+	/* 1955 */ { 0, 0x50, { 0, 1 }, { 0, 3242 }, 0 },
+	/* 1956 */ { 0, 0x50, { 0, 1 }, { 0, 3243 }, 0 },
+	/* 1957 */ { 0, 0x50, { 0, 1 }, { 0, 3244 }, 0 },
+	/* 1958 */ { 0, 0x50, { 0, 1 }, { 0, 3245 }, 0 },
+	/* 1959 */ { 0, 0x50, { 0, 1 }, { 0, 3246 }, 0 },
+	/* 1960 */ { 0, 0x50, { 0, 3 }, { 0, 3247 }, 0 },
+	/* 1961 */ { 0, 0x50, { 0, 3 }, { 0, 3250 }, 0 },
+	/* 1962 */ { 0, 0x50, { 0, 3 }, { 0, 3253 }, 0 },
+	/* 1963 */ { 0, 0x50, { 0, 3 }, { 0, 3256 }, 0 },
+	/* 1964 */ { 0, 0x50, { 0, 3 }, { 0, 3259 }, 0 },
+	/* 1965 */ { 0, 0x50, { 0, 3 }, { 0, 3262 }, 0 },
+	/* 1966 */ { 0, 0x50, { 0, 3 }, { 0, 3265 }, 0 },
+	/* 1967 */ { 0, 0x50, { 0, 3 }, { 0, 3268 }, 0 },
+	/* 1968 */ { 0, 0x50, { 0, 3 }, { 0, 3271 }, 0 },
+	/* 1969 */ { 0, 0x50, { 0, 3 }, { 0, 3274 }, 0 },
+	/* 1970 */ { 0, 0x50, { 0, 3 }, { 0, 3277 }, 0 },
+	/* 1971 */ { 0, 0x50, { 0, 3 }, { 0, 3280 }, 0 },
+	/* 1972 */ { 0, 0x50, { 0, 3 }, { 0, 3283 }, 0 },
+	/* 1973 */ { 0, 0x50, { 0, 3 }, { 0, 3286 }, 0 },
+	/* 1974 */ { 0, 0x50, { 0, 4 }, { 0, 3289 }, 0 },
+	/* 1975 */ { 0, 0x50, { 0, 4 }, { 0, 3293 }, 0 },
+	/* 1976 */ { 0, 0x50, { 0, 4 }, { 0, 3297 }, 0 },
+	/* 1977 */ { 0, 0x50, { 0, 4 }, { 0, 3301 }, 0 },
+	/* 1978 */ { 0, 0x50, { 0, 4 }, { 0, 3305 }, 0 },
+	/* 1979 */ { 0, 0x50, { 0, 4 }, { 0, 3309 }, 0 },
+	/* 1980 */ { 0, 0x50, { 0, 4 }, { 0, 3313 }, 0 },
+	/* 1981 */ { 0, 0x50, { 0, 4 }, { 0, 3317 }, 0 },
+	/* 1982 */ { 0, 0x50, { 0, 4 }, { 0, 3321 }, 0 },
+	/* 1983 */ { 0, 0x50, { 0, 4 }, { 0, 3325 }, 0 },
+	/* 1984 */ { 0, 0x50, { 0, 4 }, { 0, 3329 }, 0 },
+	/* 1985 */ { 0, 0x50, { 0, 4 }, { 0, 3333 }, 0 },
+	/* 1986 */ { 0, 0x50, { 0, 4 }, { 0, 3337 }, 0 },
+	/* 1987 */ { 0, 0x50, { 0, 4 }, { 0, 3341 }, 0 },
+	/* 1988 */ { 0, 0x50, { 0, 4 }, { 0, 3345 }, 0 },
+	/* 1989 */ { 0, 0x50, { 0, 7 }, { 0, 3349 }, 0 },
+	/* 1990 */ { 0, 0x50, { 0, 6 }, { 0, 3356 }, 0 },
+	/* 1991 */ { 0, 0x50, { 0, 3 }, { 0, 3362 }, 0 },
+	/* 1992 */ { 0, 0x50, { 0, 3 }, { 0, 3365 }, 0 },
+	/* 1993 */ { 0, 0x50, { 0, 3 }, { 0, 3368 }, 0 },
+	/* 1994 */ { 0, 0x50, { 0, 3 }, { 0, 3371 }, 0 },
+	/* 1995 */ { 0, 0x50, { 0, 3 }, { 0, 3374 }, 0 },
+	/* 1996 */ { 0, 0x50, { 0, 3 }, { 0, 3377 }, 0 },
+	/* 1997 */ { 0, 0x50, { 0, 3 }, { 0, 3380 }, 0 },
+	/* 1998 */ { 0, 0x50, { 0, 3 }, { 0, 3383 }, 0 },
+	/* 1999 */ { 0, 0x50, { 0, 3 }, { 0, 3386 }, 0 },
+	/* 2000 */ { 0, 0x50, { 0, 3 }, { 0, 3389 }, 0 },
+	/* 2001 */ { 0, 0x50, { 0, 3 }, { 0, 3392 }, 0 },
+	/* 2002 */ { 0, 0x50, { 0, 3 }, { 0, 3395 }, 0 },
+	/* 2003 */ { 0, 0x50, { 0, 3 }, { 0, 3398 }, 0 },
+	/* 2004 */ { 0, 0x50, { 0, 3 }, { 0, 3401 }, 0 },
+	/* 2005 */ { 0, 0x50, { 0, 3 }, { 0, 3404 }, 0 },
+	/* 2006 */ { 0, 0x50, { 0, 3 }, { 0, 3407 }, 0 },
+	/* 2007 */ { 0, 0x50, { 0, 3 }, { 0, 3410 }, 0 },
+	/* 2008 */ { 0, 0x50, { 0, 3 }, { 0, 3413 }, 0 },
+	/* 2009 */ { 0, 0x50, { 0, 3 }, { 0, 3416 }, 0 },
+	/* 2010 */ { 0, 0x50, { 0, 3 }, { 0, 3419 }, 0 },
+	/* 2011 */ { 0, 0x50, { 0, 3 }, { 0, 3422 }, 0 },
+	/* 2012 */ { 0, 0x50, { 0, 3 }, { 0, 3425 }, 0 },
+	/* 2013 */ { 0, 0x50, { 0, 3 }, { 0, 3428 }, 0 },
+	/* 2014 */ { 0, 0x50, { 0, 3 }, { 0, 3431 }, 0 },
+	/* 2015 */ { 0, 0x50, { 0, 3 }, { 0, 3434 }, 0 },
+	/* 2016 */ { 0, 0x50, { 0, 3 }, { 0, 3437 }, 0 },
+	/* 2017 */ { 0, 0x50, { 0, 3 }, { 0, 3440 }, 0 },
+	/* 2018 */ { 0, 0x50, { 0, 3 }, { 0, 3443 }, 0 },
+	/* 2019 */ { 0, 0x50, { 0, 3 }, { 0, 3446 }, 0 },
+	/* 2020 */ { 0, 0x50, { 0, 3 }, { 0, 3449 }, 0 },
+	/* 2021 */ { 0, 0x50, { 0, 3 }, { 0, 3452 }, 0 },
+	/* 2022 */ { 0, 0x50, { 0, 3 }, { 0, 3455 }, 0 },
+	/* 2023 */ { 0, 0x50, { 0, 3 }, { 0, 3458 }, 0 },
+	/* 2024 */ { 0, 0x50, { 0, 3 }, { 0, 3461 }, 0 },
+	/* 2025 */ { 0, 0x50, { 0, 3 }, { 0, 3464 }, 0 },
+	/* 2026 */ { 0, 0x50, { 0, 3 }, { 0, 3467 }, 0 },
+	/* 2027 */ { 0, 0x50, { 0, 1 }, { 0, 3470 }, 0 },
+	/* 2028 */ { 0, 0x50, { 0, 1 }, { 0, 3471 }, 0 },
+	/* 2029 */ { 0, 0x50, { 0, 1 }, { 0, 3472 }, 0 },
+	/* 2030 */ { 0, 0x50, { 0, 3 }, { 0, 3473 }, 0 },
+	/* 2031 */ { 0, 0x50, { 0, 2 }, { 0, 3476 }, 0 },
+	/* 2032 */ { 0, 0x50, { 0, 2 }, { 0, 3478 }, 0 },
+	/* 2033 */ { 0, 0x50, { 0, 2 }, { 0, 3480 }, 0 },
+	/* 2034 */ { 0, 0x50, { 0, 2 }, { 0, 3482 }, 0 },
+	/* 2035 */ { 0, 0x50, { 0, 2 }, { 0, 3484 }, 0 },
+	/* 2036 */ { 0, 0x50, { 0, 2 }, { 0, 3486 }, 0 },
+	/* 2037 */ { 0, 0x50, { 0, 2 }, { 0, 3488 }, 0 },
+	/* 2038 */ { 0, 0x50, { 0, 2 }, { 0, 3490 }, 0 },
+	/* 2039 */ { 0, 0x50, { 0, 2 }, { 0, 3492 }, 0 },
+	/* 2040 */ { 0, 0x50, { 0, 2 }, { 0, 3494 }, 0 },
+	/* 2041 */ { 0, 0x50, { 0, 2 }, { 0, 3496 }, 0 },
+	/* 2042 */ { 0, 0x50, { 0, 2 }, { 0, 3498 }, 0 },
+	/* 2043 */ { 0, 0x50, { 0, 2 }, { 0, 3500 }, 0 },
+	/* 2044 */ { 0, 0x50, { 0, 2 }, { 0, 3502 }, 0 },
+	/* 2045 */ { 0, 0x50, { 0, 2 }, { 0, 3504 }, 0 },
+	/* 2046 */ { 0, 0x50, { 0, 2 }, { 0, 3506 }, 0 },
+	/* 2047 */ { 0, 0x50, { 0, 2 }, { 0, 3508 }, 0 },
+	/* 2048 */ { 0, 0x50, { 0, 2 }, { 0, 3510 }, 0 },
+	/* 2049 */ { 0, 0x50, { 0, 2 }, { 0, 3512 }, 0 },
+	/* 2050 */ { 0, 0x50, { 0, 2 }, { 0, 3514 }, 0 },
+	/* 2051 */ { 0, 0x50, { 0, 2 }, { 0, 3516 }, 0 },
+	/* 2052 */ { 0, 0x50, { 0, 2 }, { 0, 3518 }, 0 },
+	/* 2053 */ { 0, 0x50, { 0, 2 }, { 0, 3520 }, 0 },
+	/* 2054 */ { 0, 0x50, { 0, 2 }, { 0, 3522 }, 0 },
+	/* 2055 */ { 0, 0x50, { 0, 2 }, { 0, 3524 }, 0 },
+	/* 2056 */ { 0, 0x50, { 0, 2 }, { 0, 3526 }, 0 },
+	/* 2057 */ { 0, 0x50, { 0, 2 }, { 0, 3528 }, 0 },
+	/* 2058 */ { 0, 0x50, { 0, 2 }, { 0, 3530 }, 0 },
+	/* 2059 */ { 0, 0x50, { 0, 2 }, { 0, 3532 }, 0 },
+	/* 2060 */ { 0, 0x50, { 0, 5 }, { 0, 3534 }, 0 },
+	/* 2061 */ { 0, 0x50, { 0, 4 }, { 0, 3539 }, 0 },
+	/* 2062 */ { 0, 0x50, { 0, 2 }, { 0, 3543 }, 0 },
+	/* 2063 */ { 0, 0x50, { 0, 1 }, { 0, 3545 }, 0 },
+	/* 2064 */ { 0, 0x50, { 0, 1 }, { 0, 3546 }, 0 },
+	/* 2065 */ { 0, 0x50, { 0, 1 }, { 0, 3547 }, 0 },
+	/* 2066 */ { 0, 0x50, { 0, 1 }, { 0, 3548 }, 0 },
+	/* 2067 */ { 0, 0x50, { 0, 1 }, { 0, 3549 }, 0 },
+	/* 2068 */ { 0, 0x50, { 0, 1 }, { 0, 3550 }, 0 },
+	/* 2069 */ { 0, 0x50, { 0, 1 }, { 0, 3551 }, 0 },
+	/* 2070 */ { 0, 0x50, { 0, 1 }, { 0, 3552 }, 0 },
+	/* 2071 */ { 0, 0x50, { 0, 1 }, { 0, 3553 }, 0 },
+	/* 2072 */ { 0, 0x50, { 0, 1 }, { 0, 3554 }, 0 },
+	/* 2073 */ { 0, 0x50, { 0, 1 }, { 0, 3555 }, 0 },
+	/* 2074 */ { 0, 0x50, { 0, 1 }, { 0, 3556 }, 0 },
+	/* 2075 */ { 0, 0x50, { 0, 1 }, { 0, 3557 }, 0 },
+	/* 2076 */ { 0, 0x50, { 0, 1 }, { 0, 3558 }, 0 },
+	/* 2077 */ { 0, 0x50, { 0, 1 }, { 0, 3559 }, 0 },
+	/* 2078 */ { 0, 0x50, { 0, 1 }, { 0, 3560 }, 0 },
+	/* 2079 */ { 0, 0x50, { 0, 1 }, { 0, 3561 }, 0 },
+	/* 2080 */ { 0, 0x50, { 0, 1 }, { 0, 3562 }, 0 },
+	/* 2081 */ { 0, 0x50, { 0, 1 }, { 0, 3563 }, 0 },
+	/* 2082 */ { 0, 0x50, { 0, 1 }, { 0, 3564 }, 0 },
+	/* 2083 */ { 0, 0x50, { 0, 1 }, { 0, 3565 }, 0 },
+	/* 2084 */ { 0, 0x50, { 0, 1 }, { 0, 3566 }, 0 },
+	/* 2085 */ { 0, 0x50, { 0, 1 }, { 0, 3567 }, 0 },
+	/* 2086 */ { 0, 0x50, { 0, 1 }, { 0, 3568 }, 0 },
+	/* 2087 */ { 0, 0x50, { 0, 1 }, { 0, 3569 }, 0 },
+	/* 2088 */ { 0, 0x50, { 0, 1 }, { 0, 3570 }, 0 },
+	/* 2089 */ { 0, 0x50, { 0, 1 }, { 0, 3571 }, 0 },
+	/* 2090 */ { 0, 0x50, { 0, 1 }, { 0, 3572 }, 0 },
+	/* 2091 */ { 0, 0x50, { 0, 1 }, { 0, 3573 }, 0 },
+	/* 2092 */ { 0, 0x50, { 0, 1 }, { 0, 3574 }, 0 },
+	/* 2093 */ { 0, 0x50, { 0, 1 }, { 0, 3575 }, 0 },
+	/* 2094 */ { 0, 0x50, { 0, 1 }, { 0, 3576 }, 0 },
+	/* 2095 */ { 0, 0x50, { 0, 2 }, { 0, 3577 }, 0 },
+	/* 2096 */ { 0, 0x50, { 0, 2 }, { 0, 3579 }, 0 },
+	/* 2097 */ { 0, 0x50, { 0, 2 }, { 0, 3581 }, 0 },
+	/* 2098 */ { 0, 0x50, { 0, 2 }, { 0, 3583 }, 0 },
+	/* 2099 */ { 0, 0x50, { 0, 2 }, { 0, 3585 }, 0 },
+	/* 2100 */ { 0, 0x50, { 0, 2 }, { 0, 3587 }, 0 },
+	/* 2101 */ { 0, 0x50, { 0, 2 }, { 0, 3589 }, 0 },
+	/* 2102 */ { 0, 0x50, { 0, 2 }, { 0, 3591 }, 0 },
+	/* 2103 */ { 0, 0x50, { 0, 2 }, { 0, 3593 }, 0 },
+	/* 2104 */ { 0, 0x50, { 0, 2 }, { 0, 3595 }, 0 },
+	/* 2105 */ { 0, 0x50, { 0, 2 }, { 0, 3597 }, 0 },
+	/* 2106 */ { 0, 0x50, { 0, 2 }, { 0, 3599 }, 0 },
+	/* 2107 */ { 0, 0x50, { 0, 2 }, { 0, 3601 }, 0 },
+	/* 2108 */ { 0, 0x50, { 0, 2 }, { 0, 3603 }, 0 },
+	/* 2109 */ { 0, 0x50, { 0, 2 }, { 0, 3605 }, 0 },
+	/* 2110 */ { 0, 0x50, { 0, 2 }, { 0, 3607 }, 0 },
+	/* 2111 */ { 0, 0x50, { 0, 2 }, { 0, 3609 }, 0 },
+	/* 2112 */ { 0, 0x50, { 0, 2 }, { 0, 3611 }, 0 },
+	/* 2113 */ { 0, 0x50, { 0, 2 }, { 0, 3613 }, 0 },
+	/* 2114 */ { 0, 0x50, { 0, 2 }, { 0, 3615 }, 0 },
+	/* 2115 */ { 0, 0x50, { 0, 2 }, { 0, 3617 }, 0 },
+	/* 2116 */ { 0, 0x50, { 0, 2 }, { 0, 3619 }, 0 },
+	/* 2117 */ { 0, 0x50, { 0, 2 }, { 0, 3621 }, 0 },
+	/* 2118 */ { 0, 0x50, { 0, 2 }, { 0, 3623 }, 0 },
+	/* 2119 */ { 0, 0x50, { 0, 3 }, { 0, 3625 }, 0 },
+	/* 2120 */ { 0, 0x50, { 0, 3 }, { 0, 3628 }, 0 },
+	/* 2121 */ { 0, 0x50, { 0, 3 }, { 0, 3631 }, 0 },
+	/* 2122 */ { 0, 0x50, { 0, 2 }, { 0, 3634 }, 0 },
+	/* 2123 */ { 0, 0x50, { 0, 3 }, { 0, 3636 }, 0 },
+	/* 2124 */ { 0, 0x50, { 0, 2 }, { 0, 3639 }, 0 },
+	/* 2125 */ { 0, 0x50, { 0, 3 }, { 0, 3641 }, 0 },
+	/* 2126 */ { 0, 0x50, { 0, 1 }, { 0, 3644 }, 0 },
+	/* 2127 */ { 0, 0x50, { 0, 1 }, { 0, 3645 }, 0 },
+	/* 2128 */ { 0, 0x50, { 0, 1 }, { 0, 3646 }, 0 },
+	/* 2129 */ { 0, 0x50, { 0, 1 }, { 0, 3647 }, 0 },
+	/* 2130 */ { 0, 0x50, { 0, 1 }, { 0, 3648 }, 0 },
+	/* 2131 */ { 0, 0x50, { 0, 1 }, { 0, 3649 }, 0 },
+	/* 2132 */ { 0, 0x50, { 0, 1 }, { 0, 3650 }, 0 },
+	/* 2133 */ { 0, 0x50, { 0, 1 }, { 0, 3651 }, 0 },
+	/* 2134 */ { 0, 0x50, { 0, 1 }, { 0, 3652 }, 0 },
+	/* 2135 */ { 0, 0x50, { 0, 1 }, { 0, 3653 }, 0 },
+	/* 2136 */ { 0, 0x50, { 0, 1 }, { 0, 3654 }, 0 },
+	/* 2137 */ { 0, 0x50, { 0, 1 }, { 0, 3655 }, 0 },
+	/* 2138 */ { 0, 0x50, { 0, 1 }, { 0, 3656 }, 0 },
+	/* 2139 */ { 0, 0x50, { 0, 1 }, { 0, 3657 }, 0 },
+	/* 2140 */ { 0, 0x50, { 0, 1 }, { 0, 3658 }, 0 },
+	/* 2141 */ { 0, 0x50, { 0, 1 }, { 0, 3659 }, 0 },
+	/* 2142 */ { 0, 0x50, { 0, 1 }, { 0, 3660 }, 0 },
+	/* 2143 */ { 0, 0x50, { 0, 1 }, { 0, 3661 }, 0 },
+	/* 2144 */ { 0, 0x50, { 0, 1 }, { 0, 3662 }, 0 },
+	/* 2145 */ { 0, 0x50, { 0, 1 }, { 0, 3663 }, 0 },
+	/* 2146 */ { 0, 0x50, { 0, 1 }, { 0, 3664 }, 0 },
+	/* 2147 */ { 0, 0x50, { 0, 1 }, { 0, 3665 }, 0 },
+	/* 2148 */ { 0, 0x50, { 0, 1 }, { 0, 3666 }, 0 },
+	/* 2149 */ { 0, 0x50, { 0, 1 }, { 0, 3667 }, 0 },
+	/* 2150 */ { 0, 0x50, { 0, 1 }, { 0, 3668 }, 0 },
+	/* 2151 */ { 0, 0x50, { 0, 1 }, { 0, 3669 }, 0 },
+	/* 2152 */ { 0, 0x50, { 0, 1 }, { 0, 3670 }, 0 },
+	/* 2153 */ { 0, 0x50, { 0, 1 }, { 0, 3671 }, 0 },
+	/* 2154 */ { 0, 0x50, { 0, 1 }, { 0, 3672 }, 0 },
+	/* 2155 */ { 0, 0x50, { 0, 1 }, { 0, 3673 }, 0 },
+	/* 2156 */ { 0, 0x50, { 0, 1 }, { 0, 3674 }, 0 },
+	/* 2157 */ { 0, 0x50, { 0, 1 }, { 0, 3675 }, 0 },
+	/* 2158 */ { 0, 0x50, { 0, 1 }, { 0, 3676 }, 0 },
+	/* 2159 */ { 0, 0x50, { 0, 1 }, { 0, 3677 }, 0 },
+	/* 2160 */ { 0, 0x50, { 0, 1 }, { 0, 3678 }, 0 },
+	/* 2161 */ { 0, 0x50, { 0, 1 }, { 0, 3679 }, 0 },
+	/* 2162 */ { 0, 0x50, { 0, 1 }, { 0, 3680 }, 0 },
+	/* 2163 */ { 0, 0x50, { 0, 1 }, { 0, 3681 }, 0 },
+	/* 2164 */ { 0, 0x50, { 0, 1 }, { 0, 3682 }, 0 },
+	/* 2165 */ { 0, 0x50, { 0, 1 }, { 0, 3683 }, 0 },
+	/* 2166 */ { 0, 0x50, { 0, 1 }, { 0, 3684 }, 0 },
+	/* 2167 */ { 0, 0x50, { 0, 1 }, { 0, 3685 }, 0 },
+	/* 2168 */ { 0, 0x50, { 0, 1 }, { 0, 3686 }, 0 },
+	/* 2169 */ { 0, 0x50, { 0, 1 }, { 0, 3687 }, 0 },
+	/* 2170 */ { 0, 0x50, { 0, 1 }, { 0, 3688 }, 0 },
+	/* 2171 */ { 0, 0x50, { 0, 1 }, { 0, 3689 }, 0 },
+	/* 2172 */ { 0, 0x50, { 0, 1 }, { 0, 3690 }, 0 },
+	/* 2173 */ { 0, 0x50, { 0, 5 }, { 0, 3691 }, 0 },
+	/* 2174 */ { 0, 0x50, { 0, 4 }, { 0, 3696 }, 0 },
+	/* 2175 */ { 0, 0x50, { 0, 5 }, { 0, 3700 }, 0 },
+	/* 2176 */ { 0, 0x50, { 0, 3 }, { 0, 3705 }, 0 },
+	/* 2177 */ { 0, 0x50, { 0, 5 }, { 0, 3708 }, 0 },
+	/* 2178 */ { 0, 0x50, { 0, 3 }, { 0, 3713 }, 0 },
+	/* 2179 */ { 0, 0x50, { 0, 3 }, { 0, 3716 }, 0 },
+	/* 2180 */ { 0, 0x50, { 0, 6 }, { 0, 3719 }, 0 },
+	/* 2181 */ { 0, 0x50, { 0, 4 }, { 0, 3725 }, 0 },
+	/* 2182 */ { 0, 0x50, { 0, 3 }, { 0, 3729 }, 0 },
+	/* 2183 */ { 0, 0x50, { 0, 3 }, { 0, 3732 }, 0 },
+	/* 2184 */ { 0, 0x50, { 0, 3 }, { 0, 3735 }, 0 },
+	/* 2185 */ { 0, 0x50, { 0, 4 }, { 0, 3738 }, 0 },
+	/* 2186 */ { 0, 0x50, { 0, 4 }, { 0, 3742 }, 0 },
+	/* 2187 */ { 0, 0x50, { 0, 4 }, { 0, 3746 }, 0 },
+	/* 2188 */ { 0, 0x50, { 0, 4 }, { 0, 3750 }, 0 },
+	/* 2189 */ { 0, 0x50, { 0, 4 }, { 0, 3754 }, 0 },
+	/* 2190 */ { 0, 0x50, { 0, 4 }, { 0, 3758 }, 0 },
+	/* 2191 */ { 0, 0x50, { 0, 4 }, { 0, 3762 }, 0 },
+	/* 2192 */ { 0, 0x50, { 0, 6 }, { 0, 3766 }, 0 },
+	/* 2193 */ { 0, 0x50, { 0, 2 }, { 0, 3772 }, 0 },
+	/* 2194 */ { 0, 0x50, { 0, 6 }, { 0, 3774 }, 0 },
+	/* 2195 */ { 0, 0x50, { 0, 6 }, { 0, 3780 }, 0 },
+	/* 2196 */ { 0, 0x50, { 0, 5 }, { 0, 3786 }, 0 },
+	/* 2197 */ { 0, 0x50, { 0, 4 }, { 0, 3791 }, 0 },
+	/* 2198 */ { 0, 0x50, { 0, 6 }, { 0, 3795 }, 0 },
+	/* 2199 */ { 0, 0x50, { 0, 6 }, { 0, 3801 }, 0 },
+	/* 2200 */ { 0, 0x50, { 0, 4 }, { 0, 3807 }, 0 },
+	/* 2201 */ { 0, 0x50, { 0, 3 }, { 0, 3811 }, 0 },
+	/* 2202 */ { 0, 0x50, { 0, 3 }, { 0, 3814 }, 0 },
+	/* 2203 */ { 0, 0x50, { 0, 4 }, { 0, 3817 }, 0 },
+	/* 2204 */ { 0, 0x50, { 0, 4 }, { 0, 3821 }, 0 },
+	/* 2205 */ { 0, 0x50, { 0, 5 }, { 0, 3825 }, 0 },
+	/* 2206 */ { 0, 0x50, { 0, 5 }, { 0, 3830 }, 0 },
+	/* 2207 */ { 0, 0x50, { 0, 3 }, { 0, 3835 }, 0 },
+	/* 2208 */ { 0, 0x50, { 0, 3 }, { 0, 3838 }, 0 },
+	/* 2209 */ { 0, 0x50, { 0, 4 }, { 0, 3841 }, 0 },
+	/* 2210 */ { 0, 0x50, { 0, 3 }, { 0, 3845 }, 0 },
+	/* 2211 */ { 0, 0x50, { 0, 3 }, { 0, 3848 }, 0 },
+	/* 2212 */ { 0, 0x50, { 0, 2 }, { 0, 3851 }, 0 },
+	/* 2213 */ { 0, 0x50, { 0, 2 }, { 0, 3853 }, 0 },
+	/* 2214 */ { 0, 0x50, { 0, 3 }, { 0, 3855 }, 0 },
+	/* 2215 */ { 0, 0x50, { 0, 3 }, { 0, 3858 }, 0 },
+	/* 2216 */ { 0, 0x50, { 0, 6 }, { 0, 3861 }, 0 },
+	/* 2217 */ { 0, 0x50, { 0, 4 }, { 0, 3867 }, 0 },
+	/* 2218 */ { 0, 0x50, { 0, 5 }, { 0, 3871 }, 0 },
+	/* 2219 */ { 0, 0x50, { 0, 6 }, { 0, 3876 }, 0 },
+	/* 2220 */ { 0, 0x50, { 0, 4 }, { 0, 3882 }, 0 },
+	/* 2221 */ { 0, 0x50, { 0, 3 }, { 0, 3886 }, 0 },
+	/* 2222 */ { 0, 0x50, { 0, 3 }, { 0, 3889 }, 0 },
+	/* 2223 */ { 0, 0x50, { 0, 6 }, { 0, 3892 }, 0 },
+	/* 2224 */ { 0, 0x50, { 0, 4 }, { 0, 3898 }, 0 },
+	/* 2225 */ { 0, 0x50, { 0, 6 }, { 0, 3902 }, 0 },
+	/* 2226 */ { 0, 0x50, { 0, 3 }, { 0, 3908 }, 0 },
+	/* 2227 */ { 0, 0x50, { 0, 5 }, { 0, 3911 }, 0 },
+	/* 2228 */ { 0, 0x50, { 0, 3 }, { 0, 3916 }, 0 },
+	/* 2229 */ { 0, 0x50, { 0, 4 }, { 0, 3919 }, 0 },
+	/* 2230 */ { 0, 0x50, { 0, 3 }, { 0, 3923 }, 0 },
+	/* 2231 */ { 0, 0x50, { 0, 4 }, { 0, 3926 }, 0 },
+	/* 2232 */ { 0, 0x50, { 0, 5 }, { 0, 3930 }, 0 },
+	/* 2233 */ { 0, 0x50, { 0, 4 }, { 0, 3935 }, 0 },
+	/* 2234 */ { 0, 0x50, { 0, 5 }, { 0, 3939 }, 0 },
+	/* 2235 */ { 0, 0x50, { 0, 4 }, { 0, 3944 }, 0 },
+	/* 2236 */ { 0, 0x50, { 0, 2 }, { 0, 3948 }, 0 },
+	/* 2237 */ { 0, 0x50, { 0, 5 }, { 0, 3950 }, 0 },
+	/* 2238 */ { 0, 0x50, { 0, 3 }, { 0, 3955 }, 0 },
+	/* 2239 */ { 0, 0x50, { 0, 3 }, { 0, 3958 }, 0 },
+	/* 2240 */ { 0, 0x50, { 0, 4 }, { 0, 3961 }, 0 },
+	/* 2241 */ { 0, 0x50, { 0, 3 }, { 0, 3965 }, 0 },
+	/* 2242 */ { 0, 0x50, { 0, 3 }, { 0, 3968 }, 0 },
+	/* 2243 */ { 0, 0x50, { 0, 3 }, { 0, 3971 }, 0 },
+	/* 2244 */ { 0, 0x50, { 0, 5 }, { 0, 3974 }, 0 },
+	/* 2245 */ { 0, 0x50, { 0, 4 }, { 0, 3979 }, 0 },
+	/* 2246 */ { 0, 0x50, { 0, 2 }, { 0, 3983 }, 0 },
+	/* 2247 */ { 0, 0x50, { 0, 6 }, { 0, 3985 }, 0 },
+	/* 2248 */ { 0, 0x50, { 0, 3 }, { 0, 3991 }, 0 },
+	/* 2249 */ { 0, 0x50, { 0, 5 }, { 0, 3994 }, 0 },
+	/* 2250 */ { 0, 0x50, { 0, 4 }, { 0, 3999 }, 0 },
+	/* 2251 */ { 0, 0x50, { 0, 4 }, { 0, 4003 }, 0 },
+	/* 2252 */ { 0, 0x50, { 0, 3 }, { 0, 4007 }, 0 },
+	/* 2253 */ { 0, 0x50, { 0, 3 }, { 0, 4010 }, 0 },
+	/* 2254 */ { 0, 0x50, { 0, 4 }, { 0, 4013 }, 0 },
+	/* 2255 */ { 0, 0x50, { 0, 2 }, { 0, 4017 }, 0 },
+	/* 2256 */ { 0, 0x50, { 0, 4 }, { 0, 4019 }, 0 },
+	/* 2257 */ { 0, 0x50, { 0, 5 }, { 0, 4023 }, 0 },
+	/* 2258 */ { 0, 0x50, { 0, 2 }, { 0, 4028 }, 0 },
+	/* 2259 */ { 0, 0x50, { 0, 6 }, { 0, 4030 }, 0 },
+	/* 2260 */ { 0, 0x50, { 0, 3 }, { 0, 4036 }, 0 },
+	/* 2261 */ { 0, 0x50, { 0, 2 }, { 0, 4039 }, 0 },
+	/* 2262 */ { 0, 0x50, { 0, 2 }, { 0, 4041 }, 0 },
+	/* 2263 */ { 0, 0x50, { 0, 2 }, { 0, 4043 }, 0 },
+	/* 2264 */ { 0, 0x50, { 0, 2 }, { 0, 4045 }, 0 },
+	/* 2265 */ { 0, 0x50, { 0, 2 }, { 0, 4047 }, 0 },
+	/* 2266 */ { 0, 0x50, { 0, 2 }, { 0, 4049 }, 0 },
+	/* 2267 */ { 0, 0x50, { 0, 2 }, { 0, 4051 }, 0 },
+	/* 2268 */ { 0, 0x50, { 0, 2 }, { 0, 4053 }, 0 },
+	/* 2269 */ { 0, 0x50, { 0, 2 }, { 0, 4055 }, 0 },
+	/* 2270 */ { 0, 0x50, { 0, 2 }, { 0, 4057 }, 0 },
+	/* 2271 */ { 0, 0x50, { 0, 3 }, { 0, 4059 }, 0 },
+	/* 2272 */ { 0, 0x50, { 0, 3 }, { 0, 4062 }, 0 },
+	/* 2273 */ { 0, 0x50, { 0, 3 }, { 0, 4065 }, 0 },
+	/* 2274 */ { 0, 0x50, { 0, 3 }, { 0, 4068 }, 0 },
+	/* 2275 */ { 0, 0x50, { 0, 3 }, { 0, 4071 }, 0 },
+	/* 2276 */ { 0, 0x50, { 0, 3 }, { 0, 4074 }, 0 },
+	/* 2277 */ { 0, 0x50, { 0, 3 }, { 0, 4077 }, 0 },
+	/* 2278 */ { 0, 0x50, { 0, 3 }, { 0, 4080 }, 0 },
+	/* 2279 */ { 0, 0x50, { 0, 3 }, { 0, 4083 }, 0 },
+	/* 2280 */ { 0, 0x50, { 0, 3 }, { 0, 4086 }, 0 },
+	/* 2281 */ { 0, 0x50, { 0, 3 }, { 0, 4089 }, 0 },
+	/* 2282 */ { 0, 0x50, { 0, 3 }, { 0, 4092 }, 0 },
+	/* 2283 */ { 0, 0x50, { 0, 3 }, { 0, 4095 }, 0 },
+	/* 2284 */ { 0, 0x50, { 0, 3 }, { 0, 4098 }, 0 },
+	/* 2285 */ { 0, 0x50, { 0, 3 }, { 0, 4101 }, 0 },
+	/* 2286 */ { 0, 0x50, { 0, 3 }, { 0, 4104 }, 0 },
+	/* 2287 */ { 0, 0x50, { 0, 2 }, { 0, 4107 }, 0 },
+	/* 2288 */ { 0, 0x50, { 0, 2 }, { 0, 4109 }, 0 },
+	/* 2289 */ { 0, 0x50, { 0, 3 }, { 0, 4111 }, 0 },
+	/* 2290 */ { 0, 0x50, { 0, 2 }, { 0, 4114 }, 0 },
+	/* 2291 */ { 0, 0x50, { 0, 2 }, { 0, 4116 }, 0 },
+	/* 2292 */ { 0, 0x50, { 0, 2 }, { 0, 4118 }, 0 },
+	/* 2293 */ { 0, 0x50, { 0, 3 }, { 0, 4120 }, 0 },
+	/* 2294 */ { 0, 0x50, { 0, 3 }, { 0, 4123 }, 0 },
+	/* 2295 */ { 0, 0x50, { 0, 2 }, { 0, 4126 }, 0 },
+	/* 2296 */ { 0, 0x50, { 0, 2 }, { 0, 4128 }, 0 },
+	/* 2297 */ { 0, 0x50, { 0, 2 }, { 0, 4130 }, 0 },
+	/* 2298 */ { 0, 0x50, { 0, 2 }, { 0, 4132 }, 0 },
+	/* 2299 */ { 0, 0x50, { 0, 2 }, { 0, 4134 }, 0 },
+	/* 2300 */ { 0, 0x50, { 0, 4 }, { 0, 4136 }, 0 },
+	/* 2301 */ { 0, 0x50, { 0, 2 }, { 0, 4140 }, 0 },
+	/* 2302 */ { 0, 0x50, { 0, 2 }, { 0, 4142 }, 0 },
+	/* 2303 */ { 0, 0x50, { 0, 2 }, { 0, 4144 }, 0 },
+	/* 2304 */ { 0, 0x50, { 0, 2 }, { 0, 4146 }, 0 },
+	/* 2305 */ { 0, 0x50, { 0, 2 }, { 0, 4148 }, 0 },
+	/* 2306 */ { 0, 0x50, { 0, 2 }, { 0, 4150 }, 0 },
+	/* 2307 */ { 0, 0x50, { 0, 2 }, { 0, 4152 }, 0 },
+	/* 2308 */ { 0, 0x50, { 0, 2 }, { 0, 4154 }, 0 },
+	/* 2309 */ { 0, 0x50, { 0, 3 }, { 0, 4156 }, 0 },
+	/* 2310 */ { 0, 0x50, { 0, 4 }, { 0, 4159 }, 0 },
+	/* 2311 */ { 0, 0x50, { 0, 2 }, { 0, 4163 }, 0 },
+	/* 2312 */ { 0, 0x50, { 0, 2 }, { 0, 4165 }, 0 },
+	/* 2313 */ { 0, 0x50, { 0, 2 }, { 0, 4167 }, 0 },
+	/* 2314 */ { 0, 0x50, { 0, 2 }, { 0, 4169 }, 0 },
+	/* 2315 */ { 0, 0x50, { 0, 2 }, { 0, 4171 }, 0 },
+	/* 2316 */ { 0, 0x50, { 0, 2 }, { 0, 4173 }, 0 },
+	/* 2317 */ { 0, 0x50, { 0, 2 }, { 0, 4175 }, 0 },
+	/* 2318 */ { 0, 0x50, { 0, 3 }, { 0, 4177 }, 0 },
+	/* 2319 */ { 0, 0x50, { 0, 3 }, { 0, 4180 }, 0 },
+	/* 2320 */ { 0, 0x50, { 0, 3 }, { 0, 4183 }, 0 },
+	/* 2321 */ { 0, 0x50, { 0, 3 }, { 0, 4186 }, 0 },
+	/* 2322 */ { 0, 0x50, { 0, 2 }, { 0, 4189 }, 0 },
+	/* 2323 */ { 0, 0x50, { 0, 2 }, { 0, 4191 }, 0 },
+	/* 2324 */ { 0, 0x50, { 0, 2 }, { 0, 4193 }, 0 },
+	/* 2325 */ { 0, 0x50, { 0, 2 }, { 0, 4195 }, 0 },
+	/* 2326 */ { 0, 0x50, { 0, 2 }, { 0, 4197 }, 0 },
+	/* 2327 */ { 0, 0x50, { 0, 2 }, { 0, 4199 }, 0 },
+	/* 2328 */ { 0, 0x50, { 0, 2 }, { 0, 4201 }, 0 },
+	/* 2329 */ { 0, 0x50, { 0, 2 }, { 0, 4203 }, 0 },
+	/* 2330 */ { 0, 0x50, { 0, 2 }, { 0, 4205 }, 0 },
+	/* 2331 */ { 0, 0x50, { 0, 2 }, { 0, 4207 }, 0 },
+	/* 2332 */ { 0, 0x50, { 0, 3 }, { 0, 4209 }, 0 },
+	/* 2333 */ { 0, 0x50, { 0, 3 }, { 0, 4212 }, 0 },
+	/* 2334 */ { 0, 0x50, { 0, 2 }, { 0, 4215 }, 0 },
+	/* 2335 */ { 0, 0x50, { 0, 3 }, { 0, 4217 }, 0 },
+	/* 2336 */ { 0, 0x50, { 0, 3 }, { 0, 4220 }, 0 },
+	/* 2337 */ { 0, 0x50, { 0, 3 }, { 0, 4223 }, 0 },
+	/* 2338 */ { 0, 0x50, { 0, 2 }, { 0, 4226 }, 0 },
+	/* 2339 */ { 0, 0x50, { 0, 3 }, { 0, 4228 }, 0 },
+	/* 2340 */ { 0, 0x50, { 0, 3 }, { 0, 4231 }, 0 },
+	/* 2341 */ { 0, 0x50, { 0, 4 }, { 0, 4234 }, 0 },
+	/* 2342 */ { 0, 0x50, { 0, 2 }, { 0, 4238 }, 0 },
+	/* 2343 */ { 0, 0x50, { 0, 3 }, { 0, 4240 }, 0 },
+	/* 2344 */ { 0, 0x50, { 0, 3 }, { 0, 4243 }, 0 },
+	/* 2345 */ { 0, 0x50, { 0, 3 }, { 0, 4246 }, 0 },
+	/* 2346 */ { 0, 0x50, { 0, 3 }, { 0, 4249 }, 0 },
+	/* 2347 */ { 0, 0x50, { 0, 5 }, { 0, 4252 }, 0 },
+	/* 2348 */ { 0, 0x50, { 0, 6 }, { 0, 4257 }, 0 },
+	/* 2349 */ { 0, 0x50, { 0, 2 }, { 0, 4263 }, 0 },
+	/* 2350 */ { 0, 0x50, { 0, 2 }, { 0, 4265 }, 0 },
+	/* 2351 */ { 0, 0x50, { 0, 2 }, { 0, 4267 }, 0 },
+	/* 2352 */ { 0, 0x50, { 0, 2 }, { 0, 4269 }, 0 },
+	/* 2353 */ { 0, 0x50, { 0, 2 }, { 0, 4271 }, 0 },
+	/* 2354 */ { 0, 0x50, { 0, 2 }, { 0, 4273 }, 0 },
+	/* 2355 */ { 0, 0x50, { 0, 2 }, { 0, 4275 }, 0 },
+	/* 2356 */ { 0, 0x50, { 0, 2 }, { 0, 4277 }, 0 },
+	/* 2357 */ { 0, 0x50, { 0, 2 }, { 0, 4279 }, 0 },
+	/* 2358 */ { 0, 0x50, { 0, 2 }, { 0, 4281 }, 0 },
+	/* 2359 */ { 0, 0x50, { 0, 2 }, { 0, 4283 }, 0 },
+	/* 2360 */ { 0, 0x50, { 0, 2 }, { 0, 4285 }, 0 },
+	/* 2361 */ { 0, 0x50, { 0, 2 }, { 0, 4287 }, 0 },
+	/* 2362 */ { 0, 0x50, { 0, 2 }, { 0, 4289 }, 0 },
+	/* 2363 */ { 0, 0x50, { 0, 2 }, { 0, 4291 }, 0 },
+	/* 2364 */ { 0, 0x50, { 0, 2 }, { 0, 4293 }, 0 },
+	/* 2365 */ { 0, 0x50, { 0, 2 }, { 0, 4295 }, 0 },
+	/* 2366 */ { 0, 0x50, { 0, 2 }, { 0, 4297 }, 0 },
+	/* 2367 */ { 0, 0x50, { 0, 4 }, { 0, 4299 }, 0 },
+	/* 2368 */ { 0, 0x50, { 0, 2 }, { 0, 4303 }, 0 },
+	/* 2369 */ { 0, 0x50, { 0, 2 }, { 0, 4305 }, 0 },
+	/* 2370 */ { 0, 0x50, { 0, 2 }, { 0, 4307 }, 0 },
+	/* 2371 */ { 0, 0x50, { 0, 4 }, { 0, 4309 }, 0 },
+	/* 2372 */ { 0, 0x50, { 0, 3 }, { 0, 4313 }, 0 },
+	/* 2373 */ { 0, 0x50, { 0, 2 }, { 0, 4316 }, 0 },
+	/* 2374 */ { 0, 0x50, { 0, 2 }, { 0, 4318 }, 0 },
+	/* 2375 */ { 0, 0x50, { 0, 2 }, { 0, 4320 }, 0 },
+	/* 2376 */ { 0, 0x50, { 0, 2 }, { 0, 4322 }, 0 },
+	/* 2377 */ { 0, 0x50, { 0, 2 }, { 0, 4324 }, 0 },
+	/* 2378 */ { 0, 0x50, { 0, 2 }, { 0, 4326 }, 0 },
+	/* 2379 */ { 0, 0x50, { 0, 2 }, { 0, 4328 }, 0 },
+	/* 2380 */ { 0, 0x50, { 0, 2 }, { 0, 4330 }, 0 },
+	/* 2381 */ { 0, 0x50, { 0, 2 }, { 0, 4332 }, 0 },
+	/* 2382 */ { 0, 0x50, { 0, 2 }, { 0, 4334 }, 0 },
+	/* 2383 */ { 0, 0x50, { 0, 3 }, { 0, 4336 }, 0 },
+	/* 2384 */ { 0, 0x50, { 0, 2 }, { 0, 4339 }, 0 },
+	/* 2385 */ { 0, 0x50, { 0, 2 }, { 0, 4341 }, 0 },
+	/* 2386 */ { 0, 0x50, { 0, 3 }, { 0, 4343 }, 0 },
+	/* 2387 */ { 0, 0x50, { 0, 3 }, { 0, 4346 }, 0 },
+	/* 2388 */ { 0, 0x50, { 0, 2 }, { 0, 4349 }, 0 },
+	/* 2389 */ { 0, 0x50, { 0, 4 }, { 0, 4351 }, 0 },
+	/* 2390 */ { 0, 0x50, { 0, 3 }, { 0, 4355 }, 0 },
+	/* 2391 */ { 0, 0x50, { 0, 2 }, { 0, 4358 }, 0 },
+	/* 2392 */ { 0, 0x50, { 0, 2 }, { 0, 4360 }, 0 },
+	/* 2393 */ { 0, 0x50, { 0, 2 }, { 0, 4362 }, 0 },
+	/* 2394 */ { 0, 0x50, { 0, 2 }, { 0, 4364 }, 0 },
+	/* 2395 */ { 0, 0x50, { 0, 3 }, { 0, 4366 }, 0 },
+	/* 2396 */ { 0, 0x50, { 0, 3 }, { 0, 4369 }, 0 },
+	/* 2397 */ { 0, 0x50, { 0, 2 }, { 0, 4372 }, 0 },
+	/* 2398 */ { 0, 0x50, { 0, 2 }, { 0, 4374 }, 0 },
+	/* 2399 */ { 0, 0x50, { 0, 2 }, { 0, 4376 }, 0 },
+	/* 2400 */ { 0, 0x50, { 0, 2 }, { 0, 4378 }, 0 },
+	/* 2401 */ { 0, 0x50, { 0, 2 }, { 0, 4380 }, 0 },
+	/* 2402 */ { 0, 0x50, { 0, 2 }, { 0, 4382 }, 0 },
+	/* 2403 */ { 0, 0x50, { 0, 2 }, { 0, 4384 }, 0 },
+	/* 2404 */ { 0, 0x50, { 0, 2 }, { 0, 4386 }, 0 },
+	/* 2405 */ { 0, 0x50, { 0, 2 }, { 0, 4388 }, 0 },
+	/* 2406 */ { 0, 0x50, { 0, 3 }, { 0, 4390 }, 0 },
+	/* 2407 */ { 0, 0x50, { 0, 3 }, { 0, 4393 }, 0 },
+	/* 2408 */ { 0, 0x50, { 0, 3 }, { 0, 4396 }, 0 },
+	/* 2409 */ { 0, 0x50, { 0, 3 }, { 0, 4399 }, 0 },
+	/* 2410 */ { 0, 0x50, { 0, 3 }, { 0, 4402 }, 0 },
+	/* 2411 */ { 0, 0x50, { 0, 3 }, { 0, 4405 }, 0 },
+	/* 2412 */ { 0, 0x50, { 0, 3 }, { 0, 4408 }, 0 },
+	/* 2413 */ { 0, 0x50, { 0, 3 }, { 0, 4411 }, 0 },
+	/* 2414 */ { 0, 0x50, { 0, 3 }, { 0, 4414 }, 0 },
+	/* 2415 */ { 0, 0x50, { 0, 3 }, { 0, 4417 }, 0 },
+	/* 2416 */ { 0, 0x50, { 0, 3 }, { 0, 4420 }, 0 },
+	/* 2417 */ { 0, 0x50, { 0, 3 }, { 0, 4423 }, 0 },
+	/* 2418 */ { 0, 0x50, { 0, 3 }, { 0, 4426 }, 0 },
+	/* 2419 */ { 0, 0x50, { 0, 3 }, { 0, 4429 }, 0 },
+	/* 2420 */ { 0, 0x50, { 0, 3 }, { 0, 4432 }, 0 },
+	/* 2421 */ { 0, 0x50, { 0, 3 }, { 0, 4435 }, 0 },
+	/* 2422 */ { 0, 0x50, { 0, 3 }, { 0, 4438 }, 0 },
+	/* 2423 */ { 0, 0x50, { 0, 3 }, { 0, 4441 }, 0 },
+	/* 2424 */ { 0, 0x50, { 0, 3 }, { 0, 4444 }, 0 },
+	/* 2425 */ { 0, 0x50, { 0, 3 }, { 0, 4447 }, 0 },
+	/* 2426 */ { 0, 0x50, { 0, 3 }, { 0, 4450 }, 0 },
+	/* 2427 */ { 0, 0x50, { 0, 3 }, { 0, 4453 }, 0 },
+	/* 2428 */ { 0, 0x50, { 0, 3 }, { 0, 4456 }, 0 },
+	/* 2429 */ { 0, 0x50, { 0, 1 }, { 0, 4459 }, 0 },
+	/* 2430 */ { 0, 0x50, { 0, 1 }, { 0, 4460 }, 0 },
+	/* 2431 */ { 0, 0x50, { 0, 1 }, { 0, 4461 }, 0 },
+	/* 2432 */ { 0, 0x50, { 0, 1 }, { 0, 4462 }, 0 },
+	/* 2433 */ { 0, 0x50, { 0, 1 }, { 0, 4463 }, 0 },
+	/* 2434 */ { 0, 0x50, { 0, 1 }, { 0, 4464 }, 0 },
+	/* 2435 */ { 0, 0x50, { 0, 1 }, { 0, 4465 }, 0 },
+	/* 2436 */ { 0, 0x50, { 0, 1 }, { 0, 4466 }, 0 },
+	/* 2437 */ { 0, 0x50, { 0, 1 }, { 0, 4467 }, 0 },
+	/* 2438 */ { 0, 0x44, { 0, 0 }, { 0, 0 }, 0 },
+	/* 2439 */ { 0, 0x55, { 1, 1 }, { 4468, 4468 }, 0 },
+	/* 2440 */ { 0, 0x55, { 1, 1 }, { 4469, 4469 }, 0 },
+	/* 2441 */ { 0, 0x55, { 1, 1 }, { 2960, 2960 }, 0 },
+	/* 2442 */ { 0, 0x55, { 1, 1 }, { 4470, 4470 }, 0 },
+	/* 2443 */ { 0, 0x55, { 1, 1 }, { 4471, 4471 }, 0 },
+	/* 2444 */ { 0, 0x55, { 1, 1 }, { 4472, 4472 }, 0 },
+	/* 2445 */ { 0, 0x55, { 1, 1 }, { 4473, 4473 }, 0 },
+	/* 2446 */ { 0, 0x55, { 1, 1 }, { 3014, 3014 }, 0 },
+	/* 2447 */ { 0, 0x55, { 1, 1 }, { 4474, 4474 }, 0 },
+	/* 2448 */ { 0, 0x55, { 1, 1 }, { 2968, 2968 }, 0 },
+	/* 2449 */ { 0, 0x55, { 1, 1 }, { 4475, 4475 }, 0 },
+	/* 2450 */ { 0, 0x55, { 1, 1 }, { 4476, 4476 }, 0 },
+	/* 2451 */ { 0, 0x55, { 1, 1 }, { 4477, 4477 }, 0 },
+	/* 2452 */ { 0, 0x55, { 1, 1 }, { 4478, 4478 }, 0 },
+	/* 2453 */ { 0, 0x55, { 1, 1 }, { 4479, 4479 }, 0 },
+	/* 2454 */ { 0, 0x55, { 1, 1 }, { 4480, 4480 }, 0 },
+	/* 2455 */ { 0, 0x55, { 1, 1 }, { 4481, 4481 }, 0 },
+	/* 2456 */ { 0, 0x55, { 1, 1 }, { 4482, 4482 }, 0 },
+	/* 2457 */ { 0, 0x55, { 1, 1 }, { 4483, 4483 }, 0 },
+	/* 2458 */ { 0, 0x55, { 1, 1 }, { 4484, 4484 }, 0 },
+	/* 2459 */ { 0, 0x55, { 1, 1 }, { 4485, 4485 }, 0 },
+	/* 2460 */ { 0, 0x55, { 1, 1 }, { 4486, 4486 }, 0 },
+	/* 2461 */ { 0, 0x55, { 1, 1 }, { 4487, 4487 }, 0 },
+	/* 2462 */ { 0, 0x55, { 1, 1 }, { 4488, 4488 }, 0 },
+	/* 2463 */ { 0, 0x55, { 1, 1 }, { 4489, 4489 }, 0 },
+	/* 2464 */ { 0, 0x55, { 1, 1 }, { 4490, 4490 }, 0 },
+	/* 2465 */ { 0, 0x55, { 1, 1 }, { 4491, 4491 }, 0 },
+	/* 2466 */ { 0, 0x55, { 1, 1 }, { 4492, 4492 }, 0 },
+	/* 2467 */ { 0, 0x55, { 1, 1 }, { 4493, 4493 }, 0 },
+	/* 2468 */ { 0, 0x55, { 1, 1 }, { 4494, 4494 }, 0 },
+	/* 2469 */ { 0, 0x55, { 1, 1 }, { 4495, 4495 }, 0 },
+	/* 2470 */ { 0, 0x55, { 1, 1 }, { 4496, 4496 }, 0 },
+	/* 2471 */ { 0, 0x55, { 1, 1 }, { 4497, 4497 }, 0 },
+	/* 2472 */ { 0, 0x55, { 1, 1 }, { 4498, 4498 }, 0 },
+	/* 2473 */ { 0, 0x55, { 1, 1 }, { 4499, 4499 }, 0 },
+	/* 2474 */ { 0, 0x55, { 1, 1 }, { 4500, 4500 }, 0 },
+	/* 2475 */ { 0, 0x55, { 1, 1 }, { 4501, 4501 }, 0 },
+	/* 2476 */ { 0, 0x55, { 1, 1 }, { 4502, 4502 }, 0 },
+	/* 2477 */ { 0, 0x55, { 1, 1 }, { 4503, 4503 }, 0 },
+	/* 2478 */ { 0, 0x55, { 1, 1 }, { 4504, 4504 }, 0 },
+	/* 2479 */ { 0, 0x55, { 1, 1 }, { 4505, 4505 }, 0 },
+	/* 2480 */ { 0, 0x55, { 1, 1 }, { 4506, 4506 }, 0 },
+	/* 2481 */ { 0, 0x55, { 1, 1 }, { 4507, 4507 }, 0 },
+	/* 2482 */ { 0, 0x55, { 1, 1 }, { 4508, 4508 }, 0 },
+	/* 2483 */ { 0, 0x55, { 1, 1 }, { 4509, 4509 }, 0 },
+	/* 2484 */ { 0, 0x55, { 1, 1 }, { 4510, 4510 }, 0 },
+	/* 2485 */ { 0, 0x55, { 1, 1 }, { 4511, 4511 }, 0 },
+	/* 2486 */ { 0, 0x55, { 1, 1 }, { 4512, 4512 }, 0 },
+	/* 2487 */ { 0, 0x55, { 1, 1 }, { 4513, 4513 }, 0 },
+	/* 2488 */ { 0, 0x55, { 1, 1 }, { 4514, 4514 }, 0 },
+	/* 2489 */ { 0, 0x55, { 1, 1 }, { 4515, 4515 }, 0 },
+	/* 2490 */ { 0, 0x55, { 1, 1 }, { 2926, 2926 }, 0 },
+	/* 2491 */ { 0, 0x55, { 1, 1 }, { 4516, 4516 }, 0 },
+	/* 2492 */ { 0, 0x55, { 1, 1 }, { 4517, 4517 }, 0 },
+	/* 2493 */ { 0, 0x55, { 1, 1 }, { 4518, 4518 }, 0 },
+	/* 2494 */ { 0, 0x55, { 1, 1 }, { 4519, 4519 }, 0 },
+	/* 2495 */ { 0, 0x55, { 1, 1 }, { 4520, 4520 }, 0 },
+	/* 2496 */ { 0, 0x55, { 1, 1 }, { 4521, 4521 }, 0 },
+	/* 2497 */ { 0, 0x55, { 1, 1 }, { 4522, 4522 }, 0 },
+	/* 2498 */ { 0, 0x55, { 1, 1 }, { 4523, 4523 }, 0 },
+	/* 2499 */ { 0, 0x55, { 1, 1 }, { 4524, 4524 }, 0 },
+	/* 2500 */ { 0, 0x55, { 1, 1 }, { 4525, 4525 }, 0 },
+	/* 2501 */ { 0, 0x55, { 1, 1 }, { 4526, 4526 }, 0 },
+	/* 2502 */ { 0, 0x55, { 1, 1 }, { 2999, 2999 }, 0 },
+	/* 2503 */ { 0, 0x55, { 1, 1 }, { 4527, 4527 }, 0 },
+	/* 2504 */ { 0, 0x55, { 1, 1 }, { 4528, 4528 }, 0 },
+	/* 2505 */ { 0, 0x55, { 1, 1 }, { 4529, 4529 }, 0 },
+	/* 2506 */ { 0, 0x55, { 1, 1 }, { 4530, 4530 }, 0 },
+	/* 2507 */ { 0, 0x55, { 1, 1 }, { 4531, 4531 }, 0 },
+	/* 2508 */ { 0, 0x55, { 1, 1 }, { 4532, 4532 }, 0 },
+	/* 2509 */ { 0, 0x55, { 1, 1 }, { 4533, 4533 }, 0 },
+	/* 2510 */ { 0, 0x55, { 1, 1 }, { 4534, 4534 }, 0 },
+	/* 2511 */ { 0, 0x55, { 1, 1 }, { 4535, 4535 }, 0 },
+	/* 2512 */ { 0, 0x55, { 1, 1 }, { 4536, 4536 }, 0 },
+	/* 2513 */ { 0, 0x55, { 1, 1 }, { 4537, 4537 }, 0 },
+	/* 2514 */ { 0, 0x55, { 1, 1 }, { 4538, 4538 }, 0 },
+	/* 2515 */ { 0, 0x55, { 1, 1 }, { 4539, 4539 }, 0 },
+	/* 2516 */ { 0, 0x55, { 1, 1 }, { 4540, 4540 }, 0 },
+	/* 2517 */ { 0, 0x55, { 1, 1 }, { 4541, 4541 }, 0 },
+	/* 2518 */ { 0, 0x55, { 1, 1 }, { 4542, 4542 }, 0 },
+	/* 2519 */ { 0, 0x55, { 1, 1 }, { 4543, 4543 }, 0 },
+	/* 2520 */ { 0, 0x55, { 1, 1 }, { 4544, 4544 }, 0 },
+	/* 2521 */ { 0, 0x55, { 1, 1 }, { 4545, 4545 }, 0 },
+	/* 2522 */ { 0, 0x55, { 1, 1 }, { 4546, 4546 }, 0 },
+	/* 2523 */ { 0, 0x55, { 1, 1 }, { 4547, 4547 }, 0 },
+	/* 2524 */ { 0, 0x55, { 1, 1 }, { 4548, 4548 }, 0 },
+	/* 2525 */ { 0, 0x55, { 1, 1 }, { 4549, 4549 }, 0 },
+	/* 2526 */ { 0, 0x55, { 1, 1 }, { 4550, 4550 }, 0 },
+	/* 2527 */ { 0, 0x55, { 1, 1 }, { 4551, 4551 }, 0 },
+	/* 2528 */ { 0, 0x55, { 1, 1 }, { 4552, 4552 }, 0 },
+	/* 2529 */ { 0, 0x55, { 1, 1 }, { 4553, 4553 }, 0 },
+	/* 2530 */ { 0, 0x55, { 1, 1 }, { 4554, 4554 }, 0 },
+	/* 2531 */ { 0, 0x55, { 1, 1 }, { 4555, 4555 }, 0 },
+	/* 2532 */ { 0, 0x55, { 1, 1 }, { 4556, 4556 }, 0 },
+	/* 2533 */ { 0, 0x55, { 1, 1 }, { 4557, 4557 }, 0 },
+	/* 2534 */ { 0, 0x55, { 1, 1 }, { 4558, 4558 }, 0 },
+	/* 2535 */ { 0, 0x55, { 1, 1 }, { 4559, 4559 }, 0 },
+	/* 2536 */ { 0, 0x55, { 1, 1 }, { 4560, 4560 }, 0 },
+	/* 2537 */ { 0, 0x55, { 1, 1 }, { 4561, 4561 }, 0 },
+	/* 2538 */ { 0, 0x55, { 1, 1 }, { 4562, 4562 }, 0 },
+	/* 2539 */ { 0, 0x55, { 1, 1 }, { 4563, 4563 }, 0 },
+	/* 2540 */ { 0, 0x55, { 1, 1 }, { 4564, 4564 }, 0 },
+	/* 2541 */ { 0, 0x55, { 1, 1 }, { 4565, 4565 }, 0 },
+	/* 2542 */ { 0, 0x55, { 1, 1 }, { 4566, 4566 }, 0 },
+	/* 2543 */ { 0, 0x55, { 1, 1 }, { 4567, 4567 }, 0 },
+	/* 2544 */ { 0, 0x55, { 1, 1 }, { 4568, 4568 }, 0 },
+	/* 2545 */ { 0, 0x55, { 1, 1 }, { 4569, 4569 }, 0 },
+	/* 2546 */ { 0, 0x55, { 1, 1 }, { 4570, 4570 }, 0 },
+	/* 2547 */ { 0, 0x55, { 1, 1 }, { 4571, 4571 }, 0 },
+	/* 2548 */ { 0, 0x55, { 1, 1 }, { 4572, 4572 }, 0 },
+	/* 2549 */ { 0, 0x55, { 1, 1 }, { 4573, 4573 }, 0 },
+	/* 2550 */ { 0, 0x55, { 1, 1 }, { 2962, 2962 }, 0 },
+	/* 2551 */ { 0, 0x55, { 1, 1 }, { 4574, 4574 }, 0 },
+	/* 2552 */ { 0, 0x55, { 1, 1 }, { 4575, 4575 }, 0 },
+	/* 2553 */ { 0, 0x55, { 1, 1 }, { 4576, 4576 }, 0 },
+	/* 2554 */ { 0, 0x55, { 1, 1 }, { 4577, 4577 }, 0 },
+	/* 2555 */ { 0, 0x55, { 1, 1 }, { 4578, 4578 }, 0 },
+	/* 2556 */ { 0, 0x55, { 1, 1 }, { 4579, 4579 }, 0 },
+	/* 2557 */ { 0, 0x55, { 1, 1 }, { 4580, 4580 }, 0 },
+	/* 2558 */ { 0, 0x55, { 1, 1 }, { 4581, 4581 }, 0 },
+	/* 2559 */ { 0, 0x55, { 1, 1 }, { 4582, 4582 }, 0 },
+	/* 2560 */ { 0, 0x55, { 1, 1 }, { 4583, 4583 }, 0 },
+	/* 2561 */ { 0, 0x55, { 1, 1 }, { 4584, 4584 }, 0 },
+	/* 2562 */ { 0, 0x55, { 1, 1 }, { 4585, 4585 }, 0 },
+	/* 2563 */ { 0, 0x55, { 1, 1 }, { 4586, 4586 }, 0 },
+	/* 2564 */ { 0, 0x55, { 1, 1 }, { 4587, 4587 }, 0 },
+	/* 2565 */ { 0, 0x55, { 1, 1 }, { 4588, 4588 }, 0 },
+	/* 2566 */ { 0, 0x55, { 1, 1 }, { 2839, 2839 }, 0 },
+	/* 2567 */ { 0, 0x55, { 1, 1 }, { 4589, 4589 }, 0 },
+	/* 2568 */ { 0, 0x55, { 1, 1 }, { 4590, 4590 }, 0 },
+	/* 2569 */ { 0, 0x55, { 1, 1 }, { 4591, 4591 }, 0 },
+	/* 2570 */ { 0, 0x55, { 1, 1 }, { 4592, 4592 }, 0 },
+	/* 2571 */ { 0, 0x55, { 1, 1 }, { 4593, 4593 }, 0 },
+	/* 2572 */ { 0, 0x55, { 1, 1 }, { 4594, 4594 }, 0 },
+	/* 2573 */ { 0, 0x55, { 1, 1 }, { 4595, 4595 }, 0 },
+	/* 2574 */ { 0, 0x55, { 1, 1 }, { 4596, 4596 }, 0 },
+	/* 2575 */ { 0, 0x55, { 1, 1 }, { 2820, 2820 }, 0 },
+	/* 2576 */ { 0, 0x55, { 1, 1 }, { 4597, 4597 }, 0 },
+	/* 2577 */ { 0, 0x55, { 1, 1 }, { 4598, 4598 }, 0 },
+	/* 2578 */ { 0, 0x55, { 1, 1 }, { 4599, 4599 }, 0 },
+	/* 2579 */ { 0, 0x55, { 1, 1 }, { 4600, 4600 }, 0 },
+	/* 2580 */ { 0, 0x55, { 1, 1 }, { 4601, 4601 }, 0 },
+	/* 2581 */ { 0, 0x55, { 1, 1 }, { 4602, 4602 }, 0 },
+	/* 2582 */ { 0, 0x55, { 1, 1 }, { 4603, 4603 }, 0 },
+	/* 2583 */ { 0, 0x55, { 1, 1 }, { 4604, 4604 }, 0 },
+	/* 2584 */ { 0, 0x55, { 1, 1 }, { 4605, 4605 }, 0 },
+	/* 2585 */ { 0, 0x55, { 1, 1 }, { 4606, 4606 }, 0 },
+	/* 2586 */ { 0, 0x55, { 1, 1 }, { 4607, 4607 }, 0 },
+	/* 2587 */ { 0, 0x55, { 1, 1 }, { 4608, 4608 }, 0 },
+	/* 2588 */ { 0, 0x55, { 1, 1 }, { 4609, 4609 }, 0 },
+	/* 2589 */ { 0, 0x55, { 1, 1 }, { 4610, 4610 }, 0 },
+	/* 2590 */ { 0, 0x55, { 1, 1 }, { 4611, 4611 }, 0 },
+	/* 2591 */ { 0, 0x55, { 1, 1 }, { 4612, 4612 }, 0 },
+	/* 2592 */ { 0, 0x55, { 1, 1 }, { 4613, 4613 }, 0 },
+	/* 2593 */ { 0, 0x55, { 1, 1 }, { 4614, 4614 }, 0 },
+	/* 2594 */ { 0, 0x55, { 1, 1 }, { 4615, 4615 }, 0 },
+	/* 2595 */ { 0, 0x55, { 1, 1 }, { 4616, 4616 }, 0 },
+	/* 2596 */ { 0, 0x55, { 1, 1 }, { 4617, 4617 }, 0 },
+	/* 2597 */ { 0, 0x55, { 1, 1 }, { 4618, 4618 }, 0 },
+	/* 2598 */ { 0, 0x55, { 1, 1 }, { 4619, 4619 }, 0 },
+	/* 2599 */ { 0, 0x55, { 1, 1 }, { 4620, 4620 }, 0 },
+	/* 2600 */ { 0, 0x55, { 1, 1 }, { 4621, 4621 }, 0 },
+	/* 2601 */ { 0, 0x55, { 1, 1 }, { 4622, 4622 }, 0 },
+	/* 2602 */ { 0, 0x55, { 1, 1 }, { 4623, 4623 }, 0 },
+	/* 2603 */ { 0, 0x55, { 1, 1 }, { 4624, 4624 }, 0 },
+	/* 2604 */ { 0, 0x55, { 1, 1 }, { 4625, 4625 }, 0 },
+	/* 2605 */ { 0, 0x55, { 1, 1 }, { 4626, 4626 }, 0 },
+	/* 2606 */ { 0, 0x55, { 1, 1 }, { 4627, 4627 }, 0 },
+	/* 2607 */ { 0, 0x55, { 1, 1 }, { 4628, 4628 }, 0 },
+	/* 2608 */ { 0, 0x55, { 1, 1 }, { 4629, 4629 }, 0 },
+	/* 2609 */ { 0, 0x55, { 1, 1 }, { 4630, 4630 }, 0 },
+	/* 2610 */ { 0, 0x55, { 1, 1 }, { 4631, 4631 }, 0 },
+	/* 2611 */ { 0, 0x55, { 1, 1 }, { 4632, 4632 }, 0 },
+	/* 2612 */ { 0, 0x55, { 1, 1 }, { 4633, 4633 }, 0 },
+	/* 2613 */ { 0, 0x55, { 1, 1 }, { 4634, 4634 }, 0 },
+	/* 2614 */ { 0, 0x55, { 1, 1 }, { 4635, 4635 }, 0 },
+	/* 2615 */ { 0, 0x55, { 1, 1 }, { 4636, 4636 }, 0 },
+	/* 2616 */ { 0, 0x55, { 1, 1 }, { 4637, 4637 }, 0 },
+	/* 2617 */ { 0, 0x55, { 1, 1 }, { 4638, 4638 }, 0 },
+	/* 2618 */ { 0, 0x55, { 1, 1 }, { 4639, 4639 }, 0 },
+	/* 2619 */ { 0, 0x55, { 1, 1 }, { 4640, 4640 }, 0 },
+	/* 2620 */ { 0, 0x55, { 1, 1 }, { 4641, 4641 }, 0 },
+	/* 2621 */ { 0, 0x55, { 1, 1 }, { 4642, 4642 }, 0 },
+	/* 2622 */ { 0, 0x55, { 1, 1 }, { 4643, 4643 }, 0 },
+	/* 2623 */ { 0, 0x55, { 1, 1 }, { 4644, 4644 }, 0 },
+	/* 2624 */ { 0, 0x55, { 1, 1 }, { 4645, 4645 }, 0 },
+	/* 2625 */ { 0, 0x55, { 1, 1 }, { 4646, 4646 }, 0 },
+	/* 2626 */ { 0, 0x55, { 1, 1 }, { 4647, 4647 }, 0 },
+	/* 2627 */ { 0, 0x55, { 1, 1 }, { 4648, 4648 }, 0 },
+	/* 2628 */ { 0, 0x55, { 1, 1 }, { 4649, 4649 }, 0 },
+	/* 2629 */ { 0, 0x55, { 1, 1 }, { 4650, 4650 }, 0 },
+	/* 2630 */ { 0, 0x55, { 1, 1 }, { 3013, 3013 }, 0 },
+	/* 2631 */ { 0, 0x55, { 1, 1 }, { 4651, 4651 }, 0 },
+	/* 2632 */ { 0, 0x55, { 1, 1 }, { 4652, 4652 }, 0 },
+	/* 2633 */ { 0, 0x55, { 1, 1 }, { 4653, 4653 }, 0 },
+	/* 2634 */ { 0, 0x55, { 1, 1 }, { 4654, 4654 }, 0 },
+	/* 2635 */ { 0, 0x55, { 1, 1 }, { 4655, 4655 }, 0 },
+	/* 2636 */ { 0, 0x55, { 1, 1 }, { 4656, 4656 }, 0 },
+	/* 2637 */ { 0, 0x55, { 1, 1 }, { 4657, 4657 }, 0 },
+	/* 2638 */ { 0, 0x55, { 1, 1 }, { 4658, 4658 }, 0 },
+	/* 2639 */ { 0, 0x55, { 1, 1 }, { 4659, 4659 }, 0 },
+	/* 2640 */ { 0, 0x55, { 1, 1 }, { 4660, 4660 }, 0 },
+	/* 2641 */ { 0, 0x55, { 1, 1 }, { 4661, 4661 }, 0 },
+	/* 2642 */ { 0, 0x55, { 1, 1 }, { 4662, 4662 }, 0 },
+	/* 2643 */ { 0, 0x55, { 1, 1 }, { 3546, 3546 }, 0 },
+	/* 2644 */ { 0, 0x55, { 1, 1 }, { 4663, 4663 }, 0 },
+	/* 2645 */ { 0, 0x55, { 1, 1 }, { 4664, 4664 }, 0 },
+	/* 2646 */ { 0, 0x55, { 1, 1 }, { 4665, 4665 }, 0 },
+	/* 2647 */ { 0, 0x55, { 1, 1 }, { 4666, 4666 }, 0 },
+	/* 2648 */ { 0, 0x55, { 1, 1 }, { 4667, 4667 }, 0 },
+	/* 2649 */ { 0, 0x55, { 1, 1 }, { 4668, 4668 }, 0 },
+	/* 2650 */ { 0, 0x55, { 1, 1 }, { 4669, 4669 }, 0 },
+	/* 2651 */ { 0, 0x55, { 1, 1 }, { 4670, 4670 }, 0 },
+	/* 2652 */ { 0, 0x55, { 1, 1 }, { 4671, 4671 }, 0 },
+	/* 2653 */ { 0, 0x55, { 1, 1 }, { 4672, 4672 }, 0 },
+	/* 2654 */ { 0, 0x55, { 1, 1 }, { 4673, 4673 }, 0 },
+	/* 2655 */ { 0, 0x55, { 1, 1 }, { 4674, 4674 }, 0 },
+	/* 2656 */ { 0, 0x55, { 1, 1 }, { 4675, 4675 }, 0 },
+	/* 2657 */ { 0, 0x55, { 1, 1 }, { 4676, 4676 }, 0 },
+	/* 2658 */ { 0, 0x55, { 1, 1 }, { 4677, 4677 }, 0 },
+	/* 2659 */ { 0, 0x55, { 1, 1 }, { 4678, 4678 }, 0 },
+	/* 2660 */ { 0, 0x55, { 1, 1 }, { 4679, 4679 }, 0 },
+	/* 2661 */ { 0, 0x55, { 1, 1 }, { 4680, 4680 }, 0 },
+	/* 2662 */ { 0, 0x55, { 1, 1 }, { 4681, 4681 }, 0 },
+	/* 2663 */ { 0, 0x55, { 1, 1 }, { 4682, 4682 }, 0 },
+	/* 2664 */ { 0, 0x55, { 1, 1 }, { 4683, 4683 }, 0 },
+	/* 2665 */ { 0, 0x55, { 1, 1 }, { 4684, 4684 }, 0 },
+	/* 2666 */ { 0, 0x55, { 1, 1 }, { 2967, 2967 }, 0 },
+	/* 2667 */ { 0, 0x55, { 1, 1 }, { 4685, 4685 }, 0 },
+	/* 2668 */ { 0, 0x55, { 1, 1 }, { 4686, 4686 }, 0 },
+	/* 2669 */ { 0, 0x55, { 1, 1 }, { 4687, 4687 }, 0 },
+	/* 2670 */ { 0, 0x55, { 1, 1 }, { 4688, 4688 }, 0 },
+	/* 2671 */ { 0, 0x55, { 1, 1 }, { 4689, 4689 }, 0 },
+	/* 2672 */ { 0, 0x55, { 1, 1 }, { 4690, 4690 }, 0 },
+	/* 2673 */ { 0, 0x55, { 1, 1 }, { 4691, 4691 }, 0 },
+	/* 2674 */ { 0, 0x55, { 1, 1 }, { 4692, 4692 }, 0 },
+	/* 2675 */ { 0, 0x55, { 1, 1 }, { 4693, 4693 }, 0 },
+	/* 2676 */ { 0, 0x55, { 1, 1 }, { 4694, 4694 }, 0 },
+	/* 2677 */ { 0, 0x55, { 1, 1 }, { 4695, 4695 }, 0 },
+	/* 2678 */ { 0, 0x55, { 1, 1 }, { 4696, 4696 }, 0 },
+	/* 2679 */ { 0, 0x55, { 1, 1 }, { 4697, 4697 }, 0 },
+	/* 2680 */ { 0, 0x55, { 1, 1 }, { 2918, 2918 }, 0 },
+	/* 2681 */ { 0, 0x55, { 1, 1 }, { 4698, 4698 }, 0 },
+	/* 2682 */ { 0, 0x55, { 1, 1 }, { 4699, 4699 }, 0 },
+	/* 2683 */ { 0, 0x55, { 1, 1 }, { 4700, 4700 }, 0 },
+	/* 2684 */ { 0, 0x55, { 1, 1 }, { 4701, 4701 }, 0 },
+	/* 2685 */ { 0, 0x55, { 1, 1 }, { 4702, 4702 }, 0 },
+	/* 2686 */ { 0, 0x55, { 1, 1 }, { 4703, 4703 }, 0 },
+	/* 2687 */ { 0, 0x55, { 1, 1 }, { 4704, 4704 }, 0 },
+	/* 2688 */ { 0, 0x55, { 1, 1 }, { 4705, 4705 }, 0 },
+	/* 2689 */ { 0, 0x55, { 1, 1 }, { 4706, 4706 }, 0 },
+	/* 2690 */ { 0, 0x55, { 1, 1 }, { 4707, 4707 }, 0 },
+	/* 2691 */ { 0, 0x55, { 1, 1 }, { 4708, 4708 }, 0 },
+	/* 2692 */ { 0, 0x55, { 1, 1 }, { 4709, 4709 }, 0 },
+	/* 2693 */ { 0, 0x55, { 1, 1 }, { 4710, 4710 }, 0 },
+	/* 2694 */ { 0, 0x55, { 1, 1 }, { 4711, 4711 }, 0 },
+	/* 2695 */ { 0, 0x55, { 1, 1 }, { 4712, 4712 }, 0 },
+	/* 2696 */ { 0, 0x55, { 1, 1 }, { 4713, 4713 }, 0 },
+	/* 2697 */ { 0, 0x55, { 1, 1 }, { 2945, 2945 }, 0 },
+	/* 2698 */ { 0, 0x55, { 1, 1 }, { 4714, 4714 }, 0 },
+	/* 2699 */ { 0, 0x55, { 1, 1 }, { 2948, 2948 }, 0 },
+	/* 2700 */ { 0, 0x55, { 1, 1 }, { 4715, 4715 }, 0 },
+	/* 2701 */ { 0, 0x55, { 1, 1 }, { 4716, 4716 }, 0 },
+	/* 2702 */ { 0, 0x55, { 1, 1 }, { 4717, 4717 }, 0 },
+	/* 2703 */ { 0, 0x55, { 1, 1 }, { 4718, 4718 }, 0 },
+	/* 2704 */ { 0, 0x55, { 1, 1 }, { 4719, 4719 }, 0 },
+	/* 2705 */ { 0, 0x55, { 1, 1 }, { 4720, 4720 }, 0 },
+	/* 2706 */ { 0, 0x55, { 1, 1 }, { 4721, 4721 }, 0 },
+	/* 2707 */ { 0, 0x55, { 1, 1 }, { 4722, 4722 }, 0 },
+	/* 2708 */ { 0, 0x55, { 1, 1 }, { 4723, 4723 }, 0 },
+	/* 2709 */ { 0, 0x55, { 1, 1 }, { 4724, 4724 }, 0 },
+	/* 2710 */ { 0, 0x55, { 1, 1 }, { 4725, 4725 }, 0 },
+	/* 2711 */ { 0, 0x55, { 1, 1 }, { 4726, 4726 }, 0 },
+	/* 2712 */ { 0, 0x55, { 1, 1 }, { 4727, 4727 }, 0 },
+	/* 2713 */ { 0, 0x55, { 1, 1 }, { 4728, 4728 }, 0 },
+	/* 2714 */ { 0, 0x55, { 1, 1 }, { 2925, 2925 }, 0 },
+	/* 2715 */ { 0, 0x55, { 1, 1 }, { 4729, 4729 }, 0 },
+	/* 2716 */ { 0, 0x55, { 1, 1 }, { 4730, 4730 }, 0 },
+	/* 2717 */ { 0, 0x55, { 1, 1 }, { 4731, 4731 }, 0 },
+	/* 2718 */ { 0, 0x55, { 1, 1 }, { 4732, 4732 }, 0 },
+	/* 2719 */ { 0, 0x55, { 1, 1 }, { 4733, 4733 }, 0 },
+	/* 2720 */ { 0, 0x55, { 1, 1 }, { 4734, 4734 }, 0 },
+	/* 2721 */ { 0, 0x55, { 1, 1 }, { 4735, 4735 }, 0 },
+	/* 2722 */ { 0, 0x55, { 1, 1 }, { 4736, 4736 }, 0 },
+	/* 2723 */ { 0, 0x55, { 1, 1 }, { 4737, 4737 }, 0 },
+	/* 2724 */ { 0, 0x55, { 1, 1 }, { 4738, 4738 }, 0 },
+	/* 2725 */ { 0, 0x55, { 1, 1 }, { 4739, 4739 }, 0 },
+	/* 2726 */ { 0, 0x55, { 1, 1 }, { 4740, 4740 }, 0 },
+	/* 2727 */ { 0, 0x55, { 1, 1 }, { 4741, 4741 }, 0 },
+	/* 2728 */ { 0, 0x55, { 1, 1 }, { 4742, 4742 }, 0 },
+	/* 2729 */ { 0, 0x55, { 1, 1 }, { 4743, 4743 }, 0 },
+	/* 2730 */ { 0, 0x55, { 1, 1 }, { 4744, 4744 }, 0 },
+	/* 2731 */ { 0, 0x55, { 1, 1 }, { 4745, 4745 }, 0 },
+	/* 2732 */ { 0, 0x55, { 1, 1 }, { 4746, 4746 }, 0 },
+	/* 2733 */ { 0, 0x55, { 1, 1 }, { 4747, 4747 }, 0 },
+	/* 2734 */ { 0, 0x55, { 1, 1 }, { 4748, 4748 }, 0 },
+	/* 2735 */ { 0, 0x55, { 1, 1 }, { 4749, 4749 }, 0 },
+	/* 2736 */ { 0, 0x55, { 1, 1 }, { 4750, 4750 }, 0 },
+	/* 2737 */ { 0, 0x55, { 1, 1 }, { 2846, 2846 }, 0 },
+	/* 2738 */ { 0, 0x55, { 1, 1 }, { 4751, 4751 }, 0 },
+	/* 2739 */ { 0, 0x55, { 1, 1 }, { 4752, 4752 }, 0 },
+	/* 2740 */ { 0, 0x55, { 1, 1 }, { 4753, 4753 }, 0 },
+	/* 2741 */ { 0, 0x55, { 1, 1 }, { 4754, 4754 }, 0 },
+	/* 2742 */ { 0, 0x55, { 1, 1 }, { 4755, 4755 }, 0 },
+	/* 2743 */ { 0, 0x55, { 1, 1 }, { 4756, 4756 }, 0 },
+	/* 2744 */ { 0, 0x55, { 1, 1 }, { 4757, 4757 }, 0 },
+	/* 2745 */ { 0, 0x55, { 1, 1 }, { 4758, 4758 }, 0 },
+	/* 2746 */ { 0, 0x55, { 1, 1 }, { 4759, 4759 }, 0 },
+	/* 2747 */ { 0, 0x55, { 1, 1 }, { 4760, 4760 }, 0 },
+	/* 2748 */ { 0, 0x55, { 1, 1 }, { 4761, 4761 }, 0 },
+	/* 2749 */ { 0, 0x55, { 1, 1 }, { 4762, 4762 }, 0 },
+	/* 2750 */ { 0, 0x55, { 1, 1 }, { 4763, 4763 }, 0 },
+	/* 2751 */ { 0, 0x55, { 1, 1 }, { 4764, 4764 }, 0 },
+	/* 2752 */ { 0, 0x55, { 1, 1 }, { 4765, 4765 }, 0 },
+	/* 2753 */ { 0, 0x55, { 1, 1 }, { 3551, 3551 }, 0 },
+	/* 2754 */ { 0, 0x55, { 1, 1 }, { 4766, 4766 }, 0 },
+	/* 2755 */ { 0, 0x55, { 1, 1 }, { 4767, 4767 }, 0 },
+	/* 2756 */ { 0, 0x55, { 1, 1 }, { 4768, 4768 }, 0 },
+	/* 2757 */ { 0, 0x55, { 1, 1 }, { 4769, 4769 }, 0 },
+	/* 2758 */ { 0, 0x55, { 1, 1 }, { 3555, 3555 }, 0 },
+	/* 2759 */ { 0, 0x55, { 1, 1 }, { 4770, 4770 }, 0 },
+	/* 2760 */ { 0, 0x55, { 1, 1 }, { 4771, 4771 }, 0 },
+	/* 2761 */ { 0, 0x55, { 1, 1 }, { 4772, 4772 }, 0 },
+	/* 2762 */ { 0, 0x55, { 1, 1 }, { 4773, 4773 }, 0 },
+	/* 2763 */ { 0, 0x55, { 1, 1 }, { 4774, 4774 }, 0 },
+	/* 2764 */ { 0, 0x55, { 1, 1 }, { 4775, 4775 }, 0 },
+	/* 2765 */ { 0, 0x55, { 1, 1 }, { 4776, 4776 }, 0 },
+	/* 2766 */ { 0, 0x55, { 1, 1 }, { 4777, 4777 }, 0 },
+	/* 2767 */ { 0, 0x55, { 1, 1 }, { 4778, 4778 }, 0 },
+	/* 2768 */ { 0, 0x55, { 1, 1 }, { 4779, 4779 }, 0 },
+	/* 2769 */ { 0, 0x55, { 1, 1 }, { 4780, 4780 }, 0 },
+	/* 2770 */ { 0, 0x55, { 1, 1 }, { 4781, 4781 }, 0 },
+	/* 2771 */ { 0, 0x55, { 1, 1 }, { 4782, 4782 }, 0 },
+	/* 2772 */ { 0, 0x55, { 1, 1 }, { 4783, 4783 }, 0 },
+	/* 2773 */ { 0, 0x55, { 1, 1 }, { 4784, 4784 }, 0 },
+	/* 2774 */ { 0, 0x55, { 1, 1 }, { 4785, 4785 }, 0 },
+	/* 2775 */ { 0, 0x55, { 1, 1 }, { 4786, 4786 }, 0 },
+	/* 2776 */ { 0, 0x55, { 1, 1 }, { 4787, 4787 }, 0 },
+	/* 2777 */ { 0, 0x55, { 1, 1 }, { 4788, 4788 }, 0 },
+	/* 2778 */ { 0, 0x55, { 1, 1 }, { 4789, 4789 }, 0 },
+	/* 2779 */ { 0, 0x55, { 1, 1 }, { 4790, 4790 }, 0 },
+	/* 2780 */ { 0, 0x55, { 1, 1 }, { 4791, 4791 }, 0 },
+	/* 2781 */ { 0, 0x55, { 1, 1 }, { 4792, 4792 }, 0 },
+	/* 2782 */ { 0, 0x55, { 1, 1 }, { 4793, 4793 }, 0 },
+	/* 2783 */ { 0, 0x55, { 1, 1 }, { 4794, 4794 }, 0 },
+	/* 2784 */ { 0, 0x55, { 1, 1 }, { 4795, 4795 }, 0 },
+	/* 2785 */ { 0, 0x55, { 1, 1 }, { 4796, 4796 }, 0 },
+	/* 2786 */ { 0, 0x55, { 1, 1 }, { 4797, 4797 }, 0 },
+	/* 2787 */ { 0, 0x55, { 1, 1 }, { 4798, 4798 }, 0 },
+	/* 2788 */ { 0, 0x55, { 1, 1 }, { 4799, 4799 }, 0 },
+	/* 2789 */ { 0, 0x55, { 1, 1 }, { 4800, 4800 }, 0 },
+	/* 2790 */ { 0, 0x55, { 1, 1 }, { 4801, 4801 }, 0 },
+	/* 2791 */ { 0, 0x55, { 1, 1 }, { 4802, 4802 }, 0 },
+	/* 2792 */ { 0, 0x55, { 1, 1 }, { 4803, 4803 }, 0 },
+	/* 2793 */ { 0, 0x55, { 1, 1 }, { 4804, 4804 }, 0 },
+	/* 2794 */ { 0, 0x55, { 1, 1 }, { 4805, 4805 }, 0 },
+	/* 2795 */ { 0, 0x55, { 1, 1 }, { 4806, 4806 }, 0 },
+	/* 2796 */ { 0, 0x55, { 1, 1 }, { 4807, 4807 }, 0 },
+	/* 2797 */ { 0, 0x55, { 1, 1 }, { 4808, 4808 }, 0 },
+	/* 2798 */ { 0, 0x55, { 1, 1 }, { 4809, 4809 }, 0 },
+	/* 2799 */ { 0, 0x55, { 1, 1 }, { 4810, 4810 }, 0 },
+	/* 2800 */ { 0, 0x55, { 1, 1 }, { 4811, 4811 }, 0 },
+	/* 2801 */ { 0, 0x55, { 1, 1 }, { 4812, 4812 }, 0 },
+	/* 2802 */ { 0, 0x55, { 1, 1 }, { 4813, 4813 }, 0 },
+	/* 2803 */ { 0, 0x55, { 1, 1 }, { 4814, 4814 }, 0 },
+	/* 2804 */ { 0, 0x55, { 1, 1 }, { 4815, 4815 }, 0 },
+	/* 2805 */ { 0, 0x55, { 1, 1 }, { 4816, 4816 }, 0 },
+	/* 2806 */ { 0, 0x55, { 1, 1 }, { 4817, 4817 }, 0 },
+	/* 2807 */ { 0, 0x55, { 1, 1 }, { 4818, 4818 }, 0 },
+	/* 2808 */ { 0, 0x55, { 1, 1 }, { 4819, 4819 }, 0 },
+	/* 2809 */ { 0, 0x55, { 1, 1 }, { 4820, 4820 }, 0 },
+	/* 2810 */ { 0, 0x55, { 1, 1 }, { 4821, 4821 }, 0 },
+	/* 2811 */ { 0, 0x55, { 1, 1 }, { 4822, 4822 }, 0 },
+	/* 2812 */ { 0, 0x55, { 1, 1 }, { 4823, 4823 }, 0 },
+	/* 2813 */ { 0, 0x55, { 1, 1 }, { 4824, 4824 }, 0 },
+	/* 2814 */ { 0, 0x55, { 1, 1 }, { 4825, 4825 }, 0 },
+	/* 2815 */ { 0, 0x55, { 1, 1 }, { 2879, 2879 }, 0 },
+	/* 2816 */ { 0, 0x55, { 1, 1 }, { 4826, 4826 }, 0 },
+	/* 2817 */ { 0, 0x55, { 1, 1 }, { 4827, 4827 }, 0 },
+	/* 2818 */ { 0, 0x55, { 1, 1 }, { 4828, 4828 }, 0 },
+	/* 2819 */ { 0, 0x55, { 1, 1 }, { 4829, 4829 }, 0 },
+	/* 2820 */ { 0, 0x55, { 1, 1 }, { 4830, 4830 }, 0 },
+	/* 2821 */ { 0, 0x55, { 1, 1 }, { 4831, 4831 }, 0 },
+	/* 2822 */ { 0, 0x55, { 1, 1 }, { 4832, 4832 }, 0 },
+	/* 2823 */ { 0, 0x55, { 1, 1 }, { 4833, 4833 }, 0 },
+	/* 2824 */ { 0, 0x55, { 1, 1 }, { 4834, 4834 }, 0 },
+	/* 2825 */ { 0, 0x55, { 1, 1 }, { 4835, 4835 }, 0 },
+	/* 2826 */ { 0, 0x55, { 1, 1 }, { 4836, 4836 }, 0 },
+	/* 2827 */ { 0, 0x55, { 1, 1 }, { 4837, 4837 }, 0 },
+	/* 2828 */ { 0, 0x55, { 1, 1 }, { 4838, 4838 }, 0 },
+	/* 2829 */ { 0, 0x55, { 1, 1 }, { 4839, 4839 }, 0 },
+	/* 2830 */ { 0, 0x55, { 1, 1 }, { 4840, 4840 }, 0 },
+	/* 2831 */ { 0, 0x55, { 1, 1 }, { 4841, 4841 }, 0 },
+	/* 2832 */ { 0, 0x55, { 1, 1 }, { 4842, 4842 }, 0 },
+	/* 2833 */ { 0, 0x55, { 1, 1 }, { 4843, 4843 }, 0 },
+	/* 2834 */ { 0, 0x55, { 1, 1 }, { 4844, 4844 }, 0 },
+	/* 2835 */ { 0, 0x55, { 1, 1 }, { 4845, 4845 }, 0 },
+	/* 2836 */ { 0, 0x55, { 1, 1 }, { 4846, 4846 }, 0 },
+	/* 2837 */ { 0, 0x55, { 1, 1 }, { 4847, 4847 }, 0 },
+	/* 2838 */ { 0, 0x55, { 1, 1 }, { 4848, 4848 }, 0 },
+	/* 2839 */ { 0, 0x55, { 1, 1 }, { 4849, 4849 }, 0 },
+	/* 2840 */ { 0, 0x55, { 1, 1 }, { 4850, 4850 }, 0 },
+	/* 2841 */ { 0, 0x55, { 1, 1 }, { 4851, 4851 }, 0 },
+	/* 2842 */ { 0, 0x55, { 1, 1 }, { 4852, 4852 }, 0 },
+	/* 2843 */ { 0, 0x55, { 1, 1 }, { 4853, 4853 }, 0 },
+	/* 2844 */ { 0, 0x55, { 1, 1 }, { 4854, 4854 }, 0 },
+	/* 2845 */ { 0, 0x55, { 1, 1 }, { 4855, 4855 }, 0 },
+	/* 2846 */ { 0, 0x55, { 1, 1 }, { 4856, 4856 }, 0 },
+	/* 2847 */ { 0, 0x55, { 1, 1 }, { 4857, 4857 }, 0 },
+	/* 2848 */ { 0, 0x55, { 1, 1 }, { 4858, 4858 }, 0 },
+	/* 2849 */ { 0, 0x55, { 1, 1 }, { 4859, 4859 }, 0 },
+	/* 2850 */ { 0, 0x55, { 1, 1 }, { 4860, 4860 }, 0 },
+	/* 2851 */ { 0, 0x55, { 1, 1 }, { 4861, 4861 }, 0 },
+	/* 2852 */ { 0, 0x55, { 1, 1 }, { 4862, 4862 }, 0 },
+	/* 2853 */ { 0, 0x55, { 1, 1 }, { 4863, 4863 }, 0 },
+	/* 2854 */ { 0, 0x55, { 1, 1 }, { 4864, 4864 }, 0 },
+	/* 2855 */ { 0, 0x55, { 1, 1 }, { 4865, 4865 }, 0 },
+	/* 2856 */ { 0, 0x55, { 1, 1 }, { 4866, 4866 }, 0 },
+	/* 2857 */ { 0, 0x55, { 1, 1 }, { 4867, 4867 }, 0 },
+	/* 2858 */ { 0, 0x55, { 1, 1 }, { 4868, 4868 }, 0 },
+	/* 2859 */ { 0, 0x55, { 1, 1 }, { 4869, 4869 }, 0 },
+	/* 2860 */ { 0, 0x55, { 1, 1 }, { 4870, 4870 }, 0 },
+	/* 2861 */ { 0, 0x55, { 1, 1 }, { 4871, 4871 }, 0 },
+	/* 2862 */ { 0, 0x55, { 1, 1 }, { 4872, 4872 }, 0 },
+	/* 2863 */ { 0, 0x55, { 1, 1 }, { 4873, 4873 }, 0 },
+	/* 2864 */ { 0, 0x50, { 0, 2 }, { 0, 4874 }, 0 },
+	/* 2865 */ { 0, 0x50, { 0, 2 }, { 0, 4876 }, 0 },
+	/* 2866 */ { 0, 0x50, { 0, 2 }, { 0, 4878 }, 0 },
+	/* 2867 */ { 0, 0x50, { 0, 3 }, { 0, 4880 }, 0 },
+	/* 2868 */ { 0, 0x50, { 0, 3 }, { 0, 4883 }, 0 },
+	/* 2869 */ { 0, 0x50, { 0, 2 }, { 0, 4886 }, 0 },
+	/* 2870 */ { 0, 0x50, { 0, 2 }, { 0, 4888 }, 0 },
+	/* 2871 */ { 0, 0x50, { 0, 2 }, { 0, 4890 }, 0 },
+	/* 2872 */ { 0, 0x50, { 0, 2 }, { 0, 4892 }, 0 },
+	/* 2873 */ { 0, 0x50, { 0, 2 }, { 0, 4894 }, 0 },
+	/* 2874 */ { 0, 0x50, { 0, 2 }, { 0, 4896 }, 0 },
+	/* 2875 */ { 0, 0x55, { 2, 2 }, { 4898, 4898 }, 0 },
+	/* 2876 */ { 26, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/* 2877 */ { 0, 0x55, { 2, 2 }, { 4900, 4900 }, 0 },
+	/* 2878 */ { 0, 0x50, { 0, 1 }, { 0, 4902 }, 0 },
+	/* 2879 */ { 0, 0x50, { 0, 1 }, { 0, 4903 }, 0 },
+	/* 2880 */ { 0, 0x50, { 0, 1 }, { 0, 4904 }, 0 },
+	/* 2881 */ { 0, 0x50, { 0, 1 }, { 0, 4905 }, 0 },
+	/* 2882 */ { 0, 0x50, { 0, 1 }, { 0, 4906 }, 0 },
+	/* 2883 */ { 0, 0x50, { 0, 1 }, { 0, 4907 }, 0 },
+	/* 2884 */ { 0, 0x50, { 0, 1 }, { 0, 4908 }, 0 },
+	/* 2885 */ { 0, 0x55, { 2, 2 }, { 4909, 4909 }, 0 },
+	/* 2886 */ { 0, 0x55, { 2, 2 }, { 4911, 4911 }, 0 },
+	/* 2887 */ { 0, 0x55, { 3, 3 }, { 4913, 4913 }, 0 },
+	/* 2888 */ { 0, 0x55, { 3, 3 }, { 4916, 4916 }, 0 },
+	/* 2889 */ { 0, 0x55, { 2, 2 }, { 4919, 4919 }, 0 },
+	/* 2890 */ { 0, 0x55, { 2, 2 }, { 4921, 4921 }, 0 },
+	/* 2891 */ { 0, 0x55, { 2, 2 }, { 4923, 4923 }, 0 },
+	/* 2892 */ { 0, 0x55, { 2, 2 }, { 4925, 4925 }, 0 },
+	/* 2893 */ { 0, 0x55, { 2, 2 }, { 4927, 4927 }, 0 },
+	/* 2894 */ { 0, 0x55, { 2, 2 }, { 4929, 4929 }, 0 },
+	/* 2895 */ { 0, 0x55, { 2, 2 }, { 4931, 4931 }, 0 },
+	/* 2896 */ { 0, 0x55, { 2, 2 }, { 4933, 4933 }, 0 },
+	/* 2897 */ { 0, 0x55, { 2, 2 }, { 4935, 4935 }, 0 },
+	/* 2898 */ { 0, 0x55, { 2, 2 }, { 4937, 4937 }, 0 },
+	/* 2899 */ { 0, 0x55, { 2, 2 }, { 4939, 4939 }, 0 },
+	/* 2900 */ { 0, 0x55, { 2, 2 }, { 4941, 4941 }, 0 },
+	/* 2901 */ { 0, 0x55, { 2, 2 }, { 4943, 4943 }, 0 },
+	/* 2902 */ { 0, 0x55, { 2, 2 }, { 4945, 4945 }, 0 },
+	/* 2903 */ { 0, 0x55, { 2, 2 }, { 4947, 4947 }, 0 },
+	/* 2904 */ { 0, 0x55, { 2, 2 }, { 4949, 4949 }, 0 },
+	/* 2905 */ { 0, 0x55, { 2, 2 }, { 4951, 4951 }, 0 },
+	/* 2906 */ { 0, 0x55, { 2, 2 }, { 4953, 4953 }, 0 },
+	/* 2907 */ { 0, 0x55, { 2, 2 }, { 4955, 4955 }, 0 },
+	/* 2908 */ { 0, 0x55, { 2, 2 }, { 4957, 4957 }, 0 },
+	/* 2909 */ { 0, 0x55, { 2, 2 }, { 4959, 4959 }, 0 },
+	/* 2910 */ { 0, 0x55, { 2, 2 }, { 4961, 4961 }, 0 },
+	/* 2911 */ { 0, 0x55, { 2, 2 }, { 4963, 4963 }, 0 },
+	/* 2912 */ { 0, 0x55, { 2, 2 }, { 4965, 4965 }, 0 },
+	/* 2913 */ { 0, 0x55, { 2, 2 }, { 4967, 4967 }, 0 },
+	/* 2914 */ { 0, 0x55, { 2, 2 }, { 4969, 4969 }, 0 },
+	/* 2915 */ { 0, 0x55, { 2, 2 }, { 4971, 4971 }, 0 },
+	/* 2916 */ { 0, 0x55, { 2, 2 }, { 4973, 4973 }, 0 },
+	/* 2917 */ { 0, 0x50, { 0, 2 }, { 0, 4975 }, 0 },
+	/* 2918 */ { 0, 0x50, { 0, 1 }, { 0, 4977 }, 0 },
+	/* 2919 */ { 0, 0x50, { 0, 1 }, { 0, 4978 }, 0 },
+	/* 2920 */ { 0, 0x50, { 0, 1 }, { 0, 4979 }, 0 },
+	/* 2921 */ { 0, 0x50, { 0, 1 }, { 0, 4980 }, 0 },
+	/* 2922 */ { 0, 0x50, { 0, 1 }, { 0, 4981 }, 0 },
+	/* 2923 */ { 0, 0x50, { 0, 1 }, { 0, 4982 }, 0 },
+	/* 2924 */ { 0, 0x50, { 0, 1 }, { 0, 4983 }, 0 },
+	/* 2925 */ { 0, 0x50, { 0, 1 }, { 0, 4984 }, 0 },
+	/* 2926 */ { 0, 0x50, { 0, 1 }, { 0, 4985 }, 0 },
+	/* 2927 */ { 0, 0x50, { 0, 1 }, { 0, 4986 }, 0 },
+	/* 2928 */ { 0, 0x50, { 0, 1 }, { 0, 4987 }, 0 },
+	/* 2929 */ { 0, 0x50, { 0, 1 }, { 0, 4988 }, 0 },
+	/* 2930 */ { 0, 0x50, { 0, 1 }, { 0, 4989 }, 0 },
+	/* 2931 */ { 0, 0x50, { 0, 1 }, { 0, 4990 }, 0 },
+	/* 2932 */ { 0, 0x50, { 0, 1 }, { 0, 4991 }, 0 },
+	/* 2933 */ { 0, 0x50, { 0, 1 }, { 0, 4992 }, 0 },
+	/* 2934 */ { 0, 0x50, { 0, 1 }, { 0, 4993 }, 0 },
+	/* 2935 */ { 0, 0x50, { 0, 1 }, { 0, 4994 }, 0 },
+	/* 2936 */ { 0, 0x50, { 0, 1 }, { 0, 4995 }, 0 },
+	/* 2937 */ { 0, 0x50, { 0, 1 }, { 0, 4996 }, 0 },
+	/* 2938 */ { 0, 0x50, { 0, 1 }, { 0, 4997 }, 0 },
+	/* 2939 */ { 0, 0x50, { 0, 1 }, { 0, 4998 }, 0 },
+	/* 2940 */ { 0, 0x50, { 0, 1 }, { 0, 4999 }, 0 },
+	/* 2941 */ { 0, 0x50, { 0, 1 }, { 0, 5000 }, 0 },
+	/* 2942 */ { 0, 0x50, { 0, 1 }, { 0, 5001 }, 0 },
+	/* 2943 */ { 0, 0x50, { 0, 2 }, { 0, 810 }, 0 },
+	/* 2944 */ { 0, 0x50, { 0, 1 }, { 0, 5002 }, 0 },
+	/* 2945 */ { 0, 0x50, { 0, 1 }, { 0, 5003 }, 0 },
+	/* 2946 */ { 0, 0x50, { 0, 1 }, { 0, 5004 }, 0 },
+	/* 2947 */ { 0, 0x50, { 0, 2 }, { 0, 814 }, 0 },
+	/* 2948 */ { 0, 0x50, { 0, 1 }, { 0, 5005 }, 0 },
+	/* 2949 */ { 0, 0x50, { 0, 1 }, { 0, 5006 }, 0 },
+	/* 2950 */ { 0, 0x50, { 0, 1 }, { 0, 5007 }, 0 },
+	/* 2951 */ { 0, 0x50, { 0, 1 }, { 0, 5008 }, 0 },
+	/* 2952 */ { 0, 0x50, { 0, 1 }, { 0, 5009 }, 0 },
+	/* 2953 */ { 0, 0x50, { 0, 1 }, { 0, 5010 }, 0 },
+	/* 2954 */ { 0, 0x50, { 0, 1 }, { 0, 5011 }, 0 },
+	/* 2955 */ { 0, 0x50, { 0, 1 }, { 0, 5012 }, 0 },
+	/* 2956 */ { 0, 0x50, { 0, 1 }, { 0, 5013 }, 0 },
+	/* 2957 */ { 0, 0x50, { 0, 3 }, { 0, 5014 }, 0 },
+	/* 2958 */ { 0, 0x50, { 0, 3 }, { 0, 5017 }, 0 },
+	/* 2959 */ { 0, 0x50, { 0, 3 }, { 0, 5020 }, 0 },
+	/* 2960 */ { 0, 0x50, { 0, 3 }, { 0, 5023 }, 0 },
+	/* 2961 */ { 0, 0x50, { 0, 3 }, { 0, 5026 }, 0 },
+	/* 2962 */ { 0, 0x50, { 0, 3 }, { 0, 5029 }, 0 },
+	/* 2963 */ { 0, 0x50, { 0, 3 }, { 0, 5032 }, 0 },
+	/* 2964 */ { 0, 0x50, { 0, 3 }, { 0, 5035 }, 0 },
+	/* 2965 */ { 0, 0x50, { 0, 1 }, { 0, 5038 }, 0 },
+	/* 2966 */ { 0, 0x50, { 0, 3 }, { 0, 5039 }, 0 },
+	/* 2967 */ { 0, 0x50, { 0, 3 }, { 0, 5042 }, 0 },
+	/* 2968 */ { 0, 0x50, { 0, 3 }, { 0, 5045 }, 0 },
+	/* 2969 */ { 0, 0x50, { 0, 3 }, { 0, 5048 }, 0 },
+	/* 2970 */ { 0, 0x50, { 0, 2 }, { 0, 5051 }, 0 },
+	/* 2971 */ { 0, 0x50, { 0, 2 }, { 0, 5053 }, 0 },
+	/* 2972 */ { 0, 0x50, { 0, 2 }, { 0, 5055 }, 0 },
+	/* 2973 */ { 0, 0x50, { 0, 2 }, { 0, 5057 }, 0 },
+	/* 2974 */ { 0, 0x50, { 0, 2 }, { 0, 5059 }, 0 },
+	/* 2975 */ { 0, 0x50, { 0, 2 }, { 0, 5061 }, 0 },
+	/* 2976 */ { 0, 0x50, { 0, 2 }, { 0, 5063 }, 0 },
+	/* 2977 */ { 0, 0x50, { 0, 2 }, { 0, 5065 }, 0 },
+	/* 2978 */ { 0, 0x50, { 0, 2 }, { 0, 5067 }, 0 },
+	/* 2979 */ { 0, 0x50, { 0, 2 }, { 0, 5069 }, 0 },
+	/* 2980 */ { 0, 0x50, { 0, 2 }, { 0, 5071 }, 0 },
+	/* 2981 */ { 0, 0x50, { 0, 2 }, { 0, 5073 }, 0 },
+	/* 2982 */ { 0, 0x50, { 0, 2 }, { 0, 5075 }, 0 },
+	/* 2983 */ { 0, 0x50, { 0, 2 }, { 0, 5077 }, 0 },
+	/* 2984 */ { 0, 0x50, { 0, 2 }, { 0, 5079 }, 0 },
+	/* 2985 */ { 0, 0x50, { 0, 2 }, { 0, 5081 }, 0 },
+	/* 2986 */ { 0, 0x50, { 0, 2 }, { 0, 5083 }, 0 },
+	/* 2987 */ { 0, 0x50, { 0, 2 }, { 0, 5085 }, 0 },
+	/* 2988 */ { 0, 0x50, { 0, 2 }, { 0, 5087 }, 0 },
+	/* 2989 */ { 0, 0x50, { 0, 2 }, { 0, 5089 }, 0 },
+	/* 2990 */ { 0, 0x50, { 0, 2 }, { 0, 5091 }, 0 },
+	/* 2991 */ { 0, 0x50, { 0, 2 }, { 0, 5093 }, 0 },
+	/* 2992 */ { 0, 0x50, { 0, 2 }, { 0, 5095 }, 0 },
+	/* 2993 */ { 0, 0x50, { 0, 2 }, { 0, 5097 }, 0 },
+	/* 2994 */ { 0, 0x50, { 0, 2 }, { 0, 5099 }, 0 },
+	/* 2995 */ { 0, 0x50, { 0, 2 }, { 0, 5101 }, 0 },
+	/* 2996 */ { 0, 0x50, { 0, 2 }, { 0, 5103 }, 0 },
+	/* 2997 */ { 0, 0x50, { 0, 2 }, { 0, 5105 }, 0 },
+	/* 2998 */ { 0, 0x50, { 0, 2 }, { 0, 5107 }, 0 },
+	/* 2999 */ { 0, 0x50, { 0, 2 }, { 0, 5109 }, 0 },
+	/* 3000 */ { 0, 0x50, { 0, 2 }, { 0, 5111 }, 0 },
+	/* 3001 */ { 0, 0x50, { 0, 2 }, { 0, 5113 }, 0 },
+	/* 3002 */ { 0, 0x50, { 0, 2 }, { 0, 5115 }, 0 },
+	/* 3003 */ { 0, 0x50, { 0, 2 }, { 0, 5117 }, 0 },
+	/* 3004 */ { 0, 0x50, { 0, 2 }, { 0, 5119 }, 0 },
+	/* 3005 */ { 0, 0x50, { 0, 2 }, { 0, 5121 }, 0 },
+	/* 3006 */ { 0, 0x50, { 0, 2 }, { 0, 5123 }, 0 },
+	/* 3007 */ { 0, 0x50, { 0, 2 }, { 0, 5125 }, 0 },
+	/* 3008 */ { 0, 0x50, { 0, 2 }, { 0, 5127 }, 0 },
+	/* 3009 */ { 0, 0x50, { 0, 2 }, { 0, 5129 }, 0 },
+	/* 3010 */ { 0, 0x50, { 0, 2 }, { 0, 5131 }, 0 },
+	/* 3011 */ { 0, 0x50, { 0, 2 }, { 0, 5133 }, 0 },
+	/* 3012 */ { 0, 0x50, { 0, 2 }, { 0, 5135 }, 0 },
+	/* 3013 */ { 0, 0x50, { 0, 2 }, { 0, 5137 }, 0 },
+	/* 3014 */ { 0, 0x50, { 0, 2 }, { 0, 5139 }, 0 },
+	/* 3015 */ { 0, 0x50, { 0, 2 }, { 0, 5141 }, 0 },
+	/* 3016 */ { 0, 0x50, { 0, 2 }, { 0, 5143 }, 0 },
+	/* 3017 */ { 0, 0x50, { 0, 2 }, { 0, 5145 }, 0 },
+	/* 3018 */ { 0, 0x50, { 0, 2 }, { 0, 5147 }, 0 },
+	/* 3019 */ { 0, 0x50, { 0, 2 }, { 0, 5149 }, 0 },
+	/* 3020 */ { 0, 0x50, { 0, 2 }, { 0, 5151 }, 0 },
+	/* 3021 */ { 0, 0x50, { 0, 2 }, { 0, 5153 }, 0 },
+	/* 3022 */ { 0, 0x50, { 0, 2 }, { 0, 5155 }, 0 },
+	/* 3023 */ { 0, 0x50, { 0, 2 }, { 0, 5157 }, 0 },
+	/* 3024 */ { 0, 0x50, { 0, 2 }, { 0, 5159 }, 0 },
+	/* 3025 */ { 0, 0x50, { 0, 2 }, { 0, 5161 }, 0 },
+	/* 3026 */ { 0, 0x50, { 0, 2 }, { 0, 5163 }, 0 },
+	/* 3027 */ { 0, 0x50, { 0, 2 }, { 0, 5165 }, 0 },
+	/* 3028 */ { 0, 0x50, { 0, 2 }, { 0, 5167 }, 0 },
+	/* 3029 */ { 0, 0x50, { 0, 2 }, { 0, 5169 }, 0 },
+	/* 3030 */ { 0, 0x50, { 0, 2 }, { 0, 5171 }, 0 },
+	/* 3031 */ { 0, 0x50, { 0, 2 }, { 0, 5173 }, 0 },
+	/* 3032 */ { 0, 0x50, { 0, 2 }, { 0, 5175 }, 0 },
+	/* 3033 */ { 0, 0x50, { 0, 2 }, { 0, 5177 }, 0 },
+	/* 3034 */ { 0, 0x50, { 0, 2 }, { 0, 5179 }, 0 },
+	/* 3035 */ { 0, 0x50, { 0, 2 }, { 0, 5181 }, 0 },
+	/* 3036 */ { 0, 0x50, { 0, 2 }, { 0, 5183 }, 0 },
+	/* 3037 */ { 0, 0x50, { 0, 2 }, { 0, 5185 }, 0 },
+	/* 3038 */ { 0, 0x50, { 0, 2 }, { 0, 5187 }, 0 },
+	/* 3039 */ { 0, 0x50, { 0, 2 }, { 0, 5189 }, 0 },
+	/* 3040 */ { 0, 0x50, { 0, 2 }, { 0, 5191 }, 0 },
+	/* 3041 */ { 0, 0x50, { 0, 2 }, { 0, 5193 }, 0 },
+	/* 3042 */ { 0, 0x50, { 0, 2 }, { 0, 5195 }, 0 },
+	/* 3043 */ { 0, 0x50, { 0, 2 }, { 0, 5197 }, 0 },
+	/* 3044 */ { 0, 0x50, { 0, 2 }, { 0, 5199 }, 0 },
+	/* 3045 */ { 0, 0x50, { 0, 2 }, { 0, 5201 }, 0 },
+	/* 3046 */ { 0, 0x50, { 0, 2 }, { 0, 5203 }, 0 },
+	/* 3047 */ { 0, 0x50, { 0, 2 }, { 0, 5205 }, 0 },
+	/* 3048 */ { 0, 0x50, { 0, 2 }, { 0, 5207 }, 0 },
+	/* 3049 */ { 0, 0x50, { 0, 2 }, { 0, 5209 }, 0 },
+	/* 3050 */ { 0, 0x50, { 0, 2 }, { 0, 5211 }, 0 },
+	/* 3051 */ { 0, 0x50, { 0, 2 }, { 0, 5213 }, 0 },
+	/* 3052 */ { 0, 0x50, { 0, 2 }, { 0, 5215 }, 0 },
+	/* 3053 */ { 0, 0x50, { 0, 2 }, { 0, 5217 }, 0 },
+	/* 3054 */ { 0, 0x50, { 0, 2 }, { 0, 5219 }, 0 },
+	/* 3055 */ { 0, 0x50, { 0, 2 }, { 0, 5221 }, 0 },
+	/* 3056 */ { 0, 0x50, { 0, 2 }, { 0, 5223 }, 0 },
+	/* 3057 */ { 0, 0x50, { 0, 2 }, { 0, 5225 }, 0 },
+	/* 3058 */ { 0, 0x50, { 0, 2 }, { 0, 5227 }, 0 },
+	/* 3059 */ { 0, 0x50, { 0, 3 }, { 0, 5229 }, 0 },
+	/* 3060 */ { 0, 0x50, { 0, 3 }, { 0, 5232 }, 0 },
+	/* 3061 */ { 0, 0x50, { 0, 3 }, { 0, 5235 }, 0 },
+	/* 3062 */ { 0, 0x50, { 0, 3 }, { 0, 5238 }, 0 },
+	/* 3063 */ { 0, 0x50, { 0, 3 }, { 0, 5241 }, 0 },
+	/* 3064 */ { 0, 0x50, { 0, 3 }, { 0, 5244 }, 0 },
+	/* 3065 */ { 0, 0x50, { 0, 3 }, { 0, 5247 }, 0 },
+	/* 3066 */ { 0, 0x50, { 0, 3 }, { 0, 5250 }, 0 },
+	/* 3067 */ { 0, 0x50, { 0, 3 }, { 0, 5253 }, 0 },
+	/* 3068 */ { 0, 0x50, { 0, 2 }, { 0, 5256 }, 0 },
+	/* 3069 */ { 0, 0x50, { 0, 2 }, { 0, 5258 }, 0 },
+	/* 3070 */ { 0, 0x50, { 0, 2 }, { 0, 5260 }, 0 },
+	/* 3071 */ { 0, 0x50, { 0, 2 }, { 0, 5262 }, 0 },
+	/* 3072 */ { 0, 0x50, { 0, 2 }, { 0, 5264 }, 0 },
+	/* 3073 */ { 0, 0x50, { 0, 2 }, { 0, 5266 }, 0 },
+	/* 3074 */ { 0, 0x50, { 0, 2 }, { 0, 5268 }, 0 },
+	/* 3075 */ { 0, 0x50, { 0, 2 }, { 0, 5270 }, 0 },
+	/* 3076 */ { 0, 0x50, { 0, 2 }, { 0, 5272 }, 0 },
+	/* 3077 */ { 0, 0x50, { 0, 2 }, { 0, 5274 }, 0 },
+	/* 3078 */ { 0, 0x50, { 0, 2 }, { 0, 5276 }, 0 },
+	/* 3079 */ { 0, 0x50, { 0, 2 }, { 0, 5278 }, 0 },
+	/* 3080 */ { 0, 0x50, { 0, 2 }, { 0, 5280 }, 0 },
+	/* 3081 */ { 0, 0x50, { 0, 2 }, { 0, 5282 }, 0 },
+	/* 3082 */ { 0, 0x50, { 0, 2 }, { 0, 5284 }, 0 },
+	/* 3083 */ { 0, 0x50, { 0, 2 }, { 0, 5286 }, 0 },
+	/* 3084 */ { 0, 0x50, { 0, 3 }, { 0, 5288 }, 0 },
+	/* 3085 */ { 0, 0x50, { 0, 3 }, { 0, 5291 }, 0 },
+	/* 3086 */ { 0, 0x50, { 0, 2 }, { 0, 5294 }, 0 },
+	/* 3087 */ { 0, 0x50, { 0, 2 }, { 0, 5296 }, 0 },
+	/* 3088 */ { 0, 0x50, { 0, 2 }, { 0, 5298 }, 0 },
+	/* 3089 */ { 0, 0x50, { 0, 2 }, { 0, 5300 }, 0 },
+	/* 3090 */ { 0, 0x50, { 0, 2 }, { 0, 5302 }, 0 },
+	/* 3091 */ { 0, 0x50, { 0, 2 }, { 0, 5304 }, 0 },
+	/* 3092 */ { 0, 0x50, { 0, 2 }, { 0, 5306 }, 0 },
+	/* 3093 */ { 0, 0x50, { 0, 2 }, { 0, 5308 }, 0 },
+	/* 3094 */ { 0, 0x50, { 0, 2 }, { 0, 5310 }, 0 },
+	/* 3095 */ { 0, 0x50, { 0, 2 }, { 0, 5312 }, 0 },
+	/* 3096 */ { 0, 0x50, { 0, 2 }, { 0, 5314 }, 0 },
+	/* 3097 */ { 0, 0x50, { 0, 3 }, { 0, 5316 }, 0 },
+	/* 3098 */ { 0, 0x50, { 0, 3 }, { 0, 5319 }, 0 },
+	/* 3099 */ { 0, 0x50, { 0, 3 }, { 0, 5322 }, 0 },
+	/* 3100 */ { 0, 0x50, { 0, 2 }, { 0, 5325 }, 0 },
+	/* 3101 */ { 0, 0x50, { 0, 2 }, { 0, 5327 }, 0 },
+	/* 3102 */ { 0, 0x50, { 0, 2 }, { 0, 5329 }, 0 },
+	/* 3103 */ { 0, 0x50, { 0, 2 }, { 0, 5331 }, 0 },
+	/* 3104 */ { 0, 0x50, { 0, 2 }, { 0, 5333 }, 0 },
+	/* 3105 */ { 0, 0x50, { 0, 2 }, { 0, 5335 }, 0 },
+	/* 3106 */ { 0, 0x50, { 0, 2 }, { 0, 5337 }, 0 },
+	/* 3107 */ { 0, 0x50, { 0, 2 }, { 0, 5339 }, 0 },
+	/* 3108 */ { 0, 0x50, { 0, 2 }, { 0, 5341 }, 0 },
+	/* 3109 */ { 0, 0x50, { 0, 2 }, { 0, 5343 }, 0 },
+	/* 3110 */ { 0, 0x50, { 0, 2 }, { 0, 5345 }, 0 },
+	/* 3111 */ { 0, 0x50, { 0, 2 }, { 0, 5347 }, 0 },
+	/* 3112 */ { 0, 0x50, { 0, 2 }, { 0, 5349 }, 0 },
+	/* 3113 */ { 0, 0x50, { 0, 2 }, { 0, 5351 }, 0 },
+	/* 3114 */ { 0, 0x50, { 0, 2 }, { 0, 5353 }, 0 },
+	/* 3115 */ { 0, 0x50, { 0, 2 }, { 0, 5355 }, 0 },
+	/* 3116 */ { 0, 0x50, { 0, 2 }, { 0, 5357 }, 0 },
+	/* 3117 */ { 0, 0x50, { 0, 2 }, { 0, 5359 }, 0 },
+	/* 3118 */ { 0, 0x50, { 0, 2 }, { 0, 5361 }, 0 },
+	/* 3119 */ { 0, 0x50, { 0, 2 }, { 0, 5363 }, 0 },
+	/* 3120 */ { 0, 0x50, { 0, 2 }, { 0, 5365 }, 0 },
+	/* 3121 */ { 0, 0x50, { 0, 2 }, { 0, 5367 }, 0 },
+	/* 3122 */ { 0, 0x50, { 0, 2 }, { 0, 5369 }, 0 },
+	/* 3123 */ { 0, 0x50, { 0, 2 }, { 0, 5371 }, 0 },
+	/* 3124 */ { 0, 0x50, { 0, 2 }, { 0, 5373 }, 0 },
+	/* 3125 */ { 0, 0x50, { 0, 2 }, { 0, 5375 }, 0 },
+	/* 3126 */ { 0, 0x50, { 0, 2 }, { 0, 5377 }, 0 },
+	/* 3127 */ { 0, 0x50, { 0, 2 }, { 0, 5379 }, 0 },
+	/* 3128 */ { 0, 0x50, { 0, 3 }, { 0, 5381 }, 0 },
+	/* 3129 */ { 0, 0x50, { 0, 3 }, { 0, 5384 }, 0 },
+	/* 3130 */ { 0, 0x50, { 0, 3 }, { 0, 5387 }, 0 },
+	/* 3131 */ { 0, 0x50, { 0, 3 }, { 0, 5390 }, 0 },
+	/* 3132 */ { 0, 0x50, { 0, 3 }, { 0, 5393 }, 0 },
+	/* 3133 */ { 0, 0x50, { 0, 3 }, { 0, 5396 }, 0 },
+	/* 3134 */ { 0, 0x50, { 0, 3 }, { 0, 5399 }, 0 },
+	/* 3135 */ { 0, 0x50, { 0, 3 }, { 0, 5402 }, 0 },
+	/* 3136 */ { 0, 0x50, { 0, 3 }, { 0, 5405 }, 0 },
+	/* 3137 */ { 0, 0x50, { 0, 3 }, { 0, 5408 }, 0 },
+	/* 3138 */ { 0, 0x50, { 0, 3 }, { 0, 5411 }, 0 },
+	/* 3139 */ { 0, 0x50, { 0, 3 }, { 0, 5414 }, 0 },
+	/* 3140 */ { 0, 0x50, { 0, 3 }, { 0, 5417 }, 0 },
+	/* 3141 */ { 0, 0x50, { 0, 3 }, { 0, 5420 }, 0 },
+	/* 3142 */ { 0, 0x50, { 0, 3 }, { 0, 5423 }, 0 },
+	/* 3143 */ { 0, 0x50, { 0, 3 }, { 0, 5426 }, 0 },
+	/* 3144 */ { 0, 0x50, { 0, 3 }, { 0, 5429 }, 0 },
+	/* 3145 */ { 0, 0x50, { 0, 3 }, { 0, 5432 }, 0 },
+	/* 3146 */ { 0, 0x50, { 0, 3 }, { 0, 5435 }, 0 },
+	/* 3147 */ { 0, 0x50, { 0, 3 }, { 0, 5438 }, 0 },
+	/* 3148 */ { 0, 0x50, { 0, 3 }, { 0, 5441 }, 0 },
+	/* 3149 */ { 0, 0x50, { 0, 3 }, { 0, 5444 }, 0 },
+	/* 3150 */ { 0, 0x50, { 0, 3 }, { 0, 5447 }, 0 },
+	/* 3151 */ { 0, 0x50, { 0, 3 }, { 0, 5450 }, 0 },
+	/* 3152 */ { 0, 0x50, { 0, 3 }, { 0, 5453 }, 0 },
+	/* 3153 */ { 0, 0x50, { 0, 3 }, { 0, 5456 }, 0 },
+	/* 3154 */ { 0, 0x50, { 0, 3 }, { 0, 5459 }, 0 },
+	/* 3155 */ { 0, 0x50, { 0, 3 }, { 0, 5462 }, 0 },
+	/* 3156 */ { 0, 0x50, { 0, 3 }, { 0, 5465 }, 0 },
+	/* 3157 */ { 0, 0x50, { 0, 3 }, { 0, 5468 }, 0 },
+	/* 3158 */ { 0, 0x50, { 0, 3 }, { 0, 5471 }, 0 },
+	/* 3159 */ { 0, 0x50, { 0, 3 }, { 0, 5474 }, 0 },
+	/* 3160 */ { 0, 0x50, { 0, 3 }, { 0, 5477 }, 0 },
+	/* 3161 */ { 0, 0x50, { 0, 3 }, { 0, 5480 }, 0 },
+	/* 3162 */ { 0, 0x50, { 0, 3 }, { 0, 5483 }, 0 },
+	/* 3163 */ { 0, 0x50, { 0, 3 }, { 0, 5486 }, 0 },
+	/* 3164 */ { 0, 0x50, { 0, 3 }, { 0, 5489 }, 0 },
+	/* 3165 */ { 0, 0x50, { 0, 3 }, { 0, 5492 }, 0 },
+	/* 3166 */ { 0, 0x50, { 0, 3 }, { 0, 5495 }, 0 },
+	/* 3167 */ { 0, 0x50, { 0, 3 }, { 0, 5498 }, 0 },
+	/* 3168 */ { 0, 0x50, { 0, 3 }, { 0, 5501 }, 0 },
+	/* 3169 */ { 0, 0x50, { 0, 3 }, { 0, 5504 }, 0 },
+	/* 3170 */ { 0, 0x50, { 0, 3 }, { 0, 5507 }, 0 },
+	/* 3171 */ { 0, 0x50, { 0, 3 }, { 0, 5510 }, 0 },
+	/* 3172 */ { 0, 0x50, { 0, 3 }, { 0, 5513 }, 0 },
+	/* 3173 */ { 0, 0x50, { 0, 3 }, { 0, 5516 }, 0 },
+	/* 3174 */ { 0, 0x50, { 0, 3 }, { 0, 5519 }, 0 },
+	/* 3175 */ { 0, 0x50, { 0, 3 }, { 0, 5522 }, 0 },
+	/* 3176 */ { 0, 0x50, { 0, 3 }, { 0, 5525 }, 0 },
+	/* 3177 */ { 0, 0x50, { 0, 3 }, { 0, 5528 }, 0 },
+	/* 3178 */ { 0, 0x50, { 0, 3 }, { 0, 5531 }, 0 },
+	/* 3179 */ { 0, 0x50, { 0, 3 }, { 0, 5534 }, 0 },
+	/* 3180 */ { 0, 0x50, { 0, 3 }, { 0, 5537 }, 0 },
+	/* 3181 */ { 0, 0x50, { 0, 3 }, { 0, 5540 }, 0 },
+	/* 3182 */ { 0, 0x50, { 0, 3 }, { 0, 5543 }, 0 },
+	/* 3183 */ { 0, 0x50, { 0, 3 }, { 0, 5546 }, 0 },
+	/* 3184 */ { 0, 0x50, { 0, 3 }, { 0, 5549 }, 0 },
+	/* 3185 */ { 0, 0x50, { 0, 3 }, { 0, 5552 }, 0 },
+	/* 3186 */ { 0, 0x50, { 0, 3 }, { 0, 5555 }, 0 },
+	/* 3187 */ { 0, 0x50, { 0, 3 }, { 0, 5558 }, 0 },
+	/* 3188 */ { 0, 0x50, { 0, 3 }, { 0, 5561 }, 0 },
+	/* 3189 */ { 0, 0x50, { 0, 3 }, { 0, 5564 }, 0 },
+	/* 3190 */ { 0, 0x50, { 0, 3 }, { 0, 5567 }, 0 },
+	/* 3191 */ { 0, 0x50, { 0, 3 }, { 0, 5570 }, 0 },
+	/* 3192 */ { 0, 0x50, { 0, 3 }, { 0, 5573 }, 0 },
+	/* 3193 */ { 0, 0x50, { 0, 3 }, { 0, 5576 }, 0 },
+	/* 3194 */ { 0, 0x50, { 0, 3 }, { 0, 5579 }, 0 },
+	/* 3195 */ { 0, 0x50, { 0, 3 }, { 0, 5582 }, 0 },
+	/* 3196 */ { 0, 0x50, { 0, 3 }, { 0, 5585 }, 0 },
+	/* 3197 */ { 0, 0x50, { 0, 3 }, { 0, 5588 }, 0 },
+	/* 3198 */ { 0, 0x50, { 0, 3 }, { 0, 5591 }, 0 },
+	/* 3199 */ { 0, 0x50, { 0, 3 }, { 0, 5594 }, 0 },
+	/* 3200 */ { 0, 0x50, { 0, 3 }, { 0, 5597 }, 0 },
+	/* 3201 */ { 0, 0x50, { 0, 3 }, { 0, 5600 }, 0 },
+	/* 3202 */ { 0, 0x50, { 0, 3 }, { 0, 5603 }, 0 },
+	/* 3203 */ { 0, 0x50, { 0, 3 }, { 0, 5606 }, 0 },
+	/* 3204 */ { 0, 0x50, { 0, 3 }, { 0, 5609 }, 0 },
+	/* 3205 */ { 0, 0x50, { 0, 3 }, { 0, 5612 }, 0 },
+	/* 3206 */ { 0, 0x50, { 0, 3 }, { 0, 5615 }, 0 },
+	/* 3207 */ { 0, 0x50, { 0, 3 }, { 0, 5618 }, 0 },
+	/* 3208 */ { 0, 0x50, { 0, 3 }, { 0, 5621 }, 0 },
+	/* 3209 */ { 0, 0x50, { 0, 3 }, { 0, 5624 }, 0 },
+	/* 3210 */ { 0, 0x50, { 0, 3 }, { 0, 5627 }, 0 },
+	/* 3211 */ { 0, 0x50, { 0, 3 }, { 0, 5630 }, 0 },
+	/* 3212 */ { 0, 0x50, { 0, 3 }, { 0, 5633 }, 0 },
+	/* 3213 */ { 0, 0x50, { 0, 3 }, { 0, 5636 }, 0 },
+	/* 3214 */ { 0, 0x50, { 0, 3 }, { 0, 5639 }, 0 },
+	/* 3215 */ { 0, 0x50, { 0, 3 }, { 0, 5642 }, 0 },
+	/* 3216 */ { 0, 0x50, { 0, 3 }, { 0, 5645 }, 0 },
+	/* 3217 */ { 0, 0x50, { 0, 3 }, { 0, 5648 }, 0 },
+	/* 3218 */ { 0, 0x50, { 0, 3 }, { 0, 5651 }, 0 },
+	/* 3219 */ { 0, 0x50, { 0, 3 }, { 0, 5654 }, 0 },
+	/* 3220 */ { 0, 0x50, { 0, 3 }, { 0, 5657 }, 0 },
+	/* 3221 */ { 0, 0x50, { 0, 3 }, { 0, 5660 }, 0 },
+	/* 3222 */ { 0, 0x50, { 0, 3 }, { 0, 5663 }, 0 },
+	/* 3223 */ { 0, 0x50, { 0, 3 }, { 0, 5666 }, 0 },
+	/* 3224 */ { 0, 0x50, { 0, 4 }, { 0, 5669 }, 0 },
+	/* 3225 */ { 0, 0x50, { 0, 4 }, { 0, 5673 }, 0 },
+	/* 3226 */ { 0, 0x50, { 0, 4 }, { 0, 5677 }, 0 },
+	/* 3227 */ { 0, 0x50, { 0, 4 }, { 0, 5681 }, 0 },
+	/* 3228 */ { 0, 0x50, { 0, 4 }, { 0, 5685 }, 0 },
+	/* 3229 */ { 0, 0x50, { 0, 4 }, { 0, 5689 }, 0 },
+	/* 3230 */ { 0, 0x50, { 0, 4 }, { 0, 5693 }, 0 },
+	/* 3231 */ { 0, 0x50, { 0, 3 }, { 0, 5697 }, 0 },
+	/* 3232 */ { 0, 0x50, { 0, 18 }, { 0, 5700 }, 0 },
+	/* 3233 */ { 0, 0x50, { 0, 8 }, { 0, 5718 }, 0 },
+	/* 3234 */ { 0, 0x50, { 0, 4 }, { 0, 5726 }, 0 },
+	/* 3235 */ { 0, 0x50, { 0, 1 }, { 0, 5730 }, 0 },
+	/* 3236 */ { 0, 0x50, { 0, 1 }, { 0, 5731 }, 0 },
+	/* 3237 */ { 0, 0x50, { 0, 1 }, { 0, 5732 }, 0 },
+	/* 3238 */ { 0, 0x50, { 0, 1 }, { 0, 5733 }, 0 },
+	/* 3239 */ { 0, 0x50, { 0, 1 }, { 0, 622 }, 0 },
+	/* 3240 */ { 0, 0x50, { 0, 1 }, { 0, 5734 }, 0 },
+	/* 3241 */ { 0, 0x50, { 0, 1 }, { 0, 5735 }, 0 },
+	/* 3242 */ { 0, 0x50, { 0, 1 }, { 0, 5736 }, 0 },
+	/* 3243 */ { 0, 0x50, { 0, 1 }, { 0, 5737 }, 0 },
+	/* 3244 */ { 0, 0x50, { 0, 1 }, { 0, 5738 }, 0 },
+	/* 3245 */ { 0, 0x50, { 0, 1 }, { 0, 5739 }, 0 },
+	/* 3246 */ { 0, 0x50, { 0, 1 }, { 0, 5740 }, 0 },
+	/* 3247 */ { 0, 0x50, { 0, 1 }, { 0, 5741 }, 0 },
+	/* 3248 */ { 0, 0x50, { 0, 1 }, { 0, 5742 }, 0 },
+	/* 3249 */ { 0, 0x50, { 0, 1 }, { 0, 5743 }, 0 },
+	/* 3250 */ { 0, 0x50, { 0, 1 }, { 0, 5744 }, 0 },
+	/* 3251 */ { 0, 0x50, { 0, 1 }, { 0, 5745 }, 0 },
+	/* 3252 */ { 0, 0x50, { 0, 1 }, { 0, 5746 }, 0 },
+	/* 3253 */ { 0, 0x50, { 0, 1 }, { 0, 5747 }, 0 },
+	/* 3254 */ { 0, 0x50, { 0, 1 }, { 0, 5748 }, 0 },
+	/* 3255 */ { 0, 0x50, { 0, 1 }, { 0, 2558 }, 0 },
+	/* 3256 */ { 0, 0x50, { 0, 1 }, { 0, 2559 }, 0 },
+	/* 3257 */ { 0, 0x50, { 0, 1 }, { 0, 5749 }, 0 },
+	/* 3258 */ { 0, 0x50, { 0, 1 }, { 0, 5750 }, 0 },
+	/* 3259 */ { 0, 0x50, { 0, 1 }, { 0, 5751 }, 0 },
+	/* 3260 */ { 0, 0x50, { 0, 1 }, { 0, 5752 }, 0 },
+	/* 3261 */ { 0, 0x50, { 0, 1 }, { 0, 5753 }, 0 },
+	/* 3262 */ { 0, 0x50, { 0, 1 }, { 0, 5754 }, 0 },
+	/* 3263 */ { 0, 0x50, { 0, 1 }, { 0, 5755 }, 0 },
+	/* 3264 */ { 0, 0x50, { 0, 1 }, { 0, 5756 }, 0 },
+	/* 3265 */ { 0, 0x50, { 0, 1 }, { 0, 5757 }, 0 },
+	/* 3266 */ { 0, 0x50, { 0, 1 }, { 0, 5758 }, 0 },
+	/* 3267 */ { 0, 0x50, { 0, 1 }, { 0, 5759 }, 0 },
+	/* 3268 */ { 0, 0x50, { 0, 1 }, { 0, 5760 }, 0 },
+	/* 3269 */ { 0, 0x50, { 0, 1 }, { 0, 5761 }, 0 },
+	/* 3270 */ { 0, 0x50, { 0, 1 }, { 0, 5762 }, 0 },
+	/* 3271 */ { 0, 0x50, { 0, 1 }, { 0, 5763 }, 0 },
+	/* 3272 */ { 0, 0x50, { 0, 1 }, { 0, 5764 }, 0 },
+	/* 3273 */ { 0, 0x50, { 0, 2 }, { 0, 5765 }, 0 },
+	/* 3274 */ { 0, 0x50, { 0, 2 }, { 0, 5767 }, 0 },
+	/* 3275 */ { 0, 0x50, { 0, 2 }, { 0, 5769 }, 0 },
+	/* 3276 */ { 0, 0x50, { 0, 2 }, { 0, 5771 }, 0 },
+	/* 3277 */ { 0, 0x50, { 0, 2 }, { 0, 5773 }, 0 },
+	/* 3278 */ { 0, 0x50, { 0, 2 }, { 0, 5775 }, 0 },
+	/* 3279 */ { 0, 0x50, { 0, 2 }, { 0, 5777 }, 0 },
+	/* 3280 */ { 0, 0x50, { 0, 2 }, { 0, 5779 }, 0 },
+	/* 3281 */ { 0, 0x50, { 0, 2 }, { 0, 5781 }, 0 },
+	/* 3282 */ { 0, 0x50, { 0, 2 }, { 0, 5783 }, 0 },
+	/* 3283 */ { 0, 0x50, { 0, 2 }, { 0, 5785 }, 0 },
+	/* 3284 */ { 0, 0x50, { 0, 2 }, { 0, 5787 }, 0 },
+	/* 3285 */ { 0, 0x50, { 0, 2 }, { 0, 5789 }, 0 },
+	/* 3286 */ { 0, 0x50, { 0, 2 }, { 0, 5791 }, 0 },
+	/* 3287 */ { 0, 0x50, { 0, 1 }, { 0, 5793 }, 0 },
+	/* 3288 */ { 0, 0x50, { 0, 2 }, { 0, 792 }, 0 },
+	/* 3289 */ { 0, 0x50, { 0, 2 }, { 0, 794 }, 0 },
+	/* 3290 */ { 0, 0x50, { 0, 2 }, { 0, 796 }, 0 },
+	/* 3291 */ { 0, 0x50, { 0, 2 }, { 0, 798 }, 0 },
+	/* 3292 */ { 0, 0x50, { 0, 2 }, { 0, 800 }, 0 },
+	/* 3293 */ { 0, 0x50, { 0, 1 }, { 0, 5794 }, 0 },
+	/* 3294 */ { 0, 0x50, { 0, 1 }, { 0, 5795 }, 0 },
+	/* 3295 */ { 0, 0x50, { 0, 1 }, { 0, 5796 }, 0 },
+	/* 3296 */ { 0, 0x50, { 0, 1 }, { 0, 5797 }, 0 },
+	/* 3297 */ { 0, 0x50, { 0, 1 }, { 0, 5798 }, 0 },
+	/* 3298 */ { 0, 0x50, { 0, 1 }, { 0, 5799 }, 0 },
+	/* 3299 */ { 0, 0x50, { 0, 1 }, { 0, 5800 }, 0 },
+	/* 3300 */ { 0, 0x50, { 0, 1 }, { 0, 5801 }, 0 },
+	/* 3301 */ { 0, 0x50, { 0, 1 }, { 0, 5802 }, 0 },
+	/* 3302 */ { 0, 0x50, { 0, 1 }, { 0, 5803 }, 0 },
+	/* 3303 */ { 0, 0x50, { 0, 1 }, { 0, 5804 }, 0 },
+	/* 3304 */ { 0, 0x50, { 0, 1 }, { 0, 5805 }, 0 },
+	/* 3305 */ { 0, 0x50, { 0, 1 }, { 0, 5806 }, 0 },
+	/* 3306 */ { 0, 0x50, { 0, 1 }, { 0, 5807 }, 0 },
+	/* 3307 */ { 0, 0x50, { 0, 1 }, { 0, 5808 }, 0 },
+	/* 3308 */ { 0, 0x50, { 0, 1 }, { 0, 5809 }, 0 },
+	/* 3309 */ { 0, 0x50, { 0, 1 }, { 0, 5810 }, 0 },
+	/* 3310 */ { 0, 0x50, { 0, 1 }, { 0, 5811 }, 0 },
+	/* 3311 */ { 0, 0x50, { 0, 1 }, { 0, 5812 }, 0 },
+	/* 3312 */ { 0, 0x50, { 0, 1 }, { 0, 5813 }, 0 },
+	/* 3313 */ { 0, 0x50, { 0, 1 }, { 0, 5814 }, 0 },
+	/* 3314 */ { 0, 0x50, { 0, 1 }, { 0, 5815 }, 0 },
+	/* 3315 */ { 0, 0x50, { 0, 1 }, { 0, 5816 }, 0 },
+	/* 3316 */ { 0, 0x50, { 0, 1 }, { 0, 5817 }, 0 },
+	/* 3317 */ { 0, 0x50, { 0, 1 }, { 0, 5818 }, 0 },
+	/* 3318 */ { 0, 0x50, { 0, 1 }, { 0, 5819 }, 0 },
+	/* 3319 */ { 0, 0x50, { 0, 1 }, { 0, 5820 }, 0 },
+	/* 3320 */ { 0, 0x50, { 0, 1 }, { 0, 5821 }, 0 },
+	/* 3321 */ { 0, 0x50, { 0, 1 }, { 0, 5822 }, 0 },
+	/* 3322 */ { 0, 0x50, { 0, 3 }, { 0, 5823 }, 0 },
+	/* 3323 */ { 0, 0x50, { 0, 3 }, { 0, 5826 }, 0 },
+	/* 3324 */ { 0, 0x50, { 0, 3 }, { 0, 5829 }, 0 },
+	/* 3325 */ { 0, 0x50, { 0, 2 }, { 0, 5832 }, 0 },
+	/* 3326 */ { 0, 0x50, { 0, 1 }, { 0, 5834 }, 0 },
+	/* 3327 */ { 0, 0x50, { 0, 1 }, { 0, 5835 }, 0 },
+	/* 3328 */ { 0, 0x50, { 0, 1 }, { 0, 5836 }, 0 },
+	/* 3329 */ { 0, 0x50, { 0, 1 }, { 0, 5837 }, 0 },
+	/* 3330 */ { 0, 0x50, { 0, 1 }, { 0, 2246 }, 0 },
+	/* 3331 */ { 0, 0x50, { 0, 1 }, { 0, 5838 }, 0 },
+	/* 3332 */ { 0, 0x50, { 0, 1 }, { 0, 5839 }, 0 },
+	/* 3333 */ { 0, 0x50, { 0, 1 }, { 0, 5840 }, 0 },
+	/* 3334 */ { 0, 0x50, { 0, 1 }, { 0, 5841 }, 0 },
+	/* 3335 */ { 0, 0x50, { 0, 1 }, { 0, 5842 }, 0 },
+	/* 3336 */ { 0, 0x50, { 0, 1 }, { 0, 5843 }, 0 },
+	/* 3337 */ { 0, 0x50, { 0, 1 }, { 0, 5844 }, 0 },
+	/* 3338 */ { 0, 0x50, { 0, 1 }, { 0, 5845 }, 0 },
+	/* 3339 */ { 0, 0x50, { 0, 1 }, { 0, 5846 }, 0 },
+	/* 3340 */ { 0, 0x50, { 0, 1 }, { 0, 5847 }, 0 },
+	/* 3341 */ { 0, 0x50, { 0, 1 }, { 0, 5848 }, 0 },
+	/* 3342 */ { 0, 0x50, { 0, 1 }, { 0, 5849 }, 0 },
+	/* 3343 */ { 0, 0x50, { 0, 1 }, { 0, 5850 }, 0 },
+	/* 3344 */ { 0, 0x50, { 0, 1 }, { 0, 5851 }, 0 },
+	/* 3345 */ { 0, 0x50, { 0, 1 }, { 0, 5852 }, 0 },
+	/* 3346 */ { 0, 0x50, { 0, 1 }, { 0, 5853 }, 0 },
+	/* 3347 */ { 0, 0x50, { 0, 1 }, { 0, 5854 }, 0 },
+	/* 3348 */ { 0, 0x50, { 0, 1 }, { 0, 5855 }, 0 },
+	/* 3349 */ { 0, 0x50, { 0, 1 }, { 0, 5856 }, 0 },
+	/* 3350 */ { 0, 0x50, { 0, 1 }, { 0, 5857 }, 0 },
+	/* 3351 */ { 0, 0x50, { 0, 1 }, { 0, 5858 }, 0 },
+	/* 3352 */ { 0, 0x50, { 0, 1 }, { 0, 5859 }, 0 },
+	/* 3353 */ { 0, 0x50, { 0, 1 }, { 0, 5860 }, 0 },
+	/* 3354 */ { 0, 0x50, { 0, 1 }, { 0, 5861 }, 0 },
+	/* 3355 */ { 0, 0x50, { 0, 1 }, { 0, 5862 }, 0 },
+	/* 3356 */ { 0, 0x50, { 0, 1 }, { 0, 5863 }, 0 },
+	/* 3357 */ { 0, 0x50, { 0, 1 }, { 0, 5864 }, 0 },
+	/* 3358 */ { 0, 0x50, { 0, 1 }, { 0, 5865 }, 0 },
+	/* 3359 */ { 0, 0x50, { 0, 1 }, { 0, 5866 }, 0 },
+	/* 3360 */ { 0, 0x50, { 0, 1 }, { 0, 5867 }, 0 },
+	/* 3361 */ { 0, 0x50, { 0, 1 }, { 0, 5868 }, 0 },
+	/* 3362 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1296 },
+	/* 3363 */ { 0, 0x44, { 2, 2 }, { 5869, 5869 }, 0 },
+	/* 3364 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1298 },
+	/* 3365 */ { 0, 0x44, { 2, 2 }, { 5871, 5871 }, 0 },
+	/* 3366 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1300 },
+	/* 3367 */ { 0, 0x44, { 2, 2 }, { 5873, 5873 }, 0 },
+	/* 3368 */ { 0, 0x44, { 2, 2 }, { 5875, 5875 }, 0 },
+	/* 3369 */ { 0, 0x44, { 2, 2 }, { 5877, 5877 }, 0 },
+	/* 3370 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1302 },
+	/* 3371 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1304 },
+	/* 3372 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1306 },
+	/* 3373 */ { 0, 0x44, { 2, 2 }, { 5879, 5879 }, 0 },
+	/* 3374 */ { 0, 0x44, { 2, 2 }, { 5881, 5881 }, 0 },
+	/* 3375 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1309 },
+	/* 3376 */ { 0, 0x44, { 2, 2 }, { 5883, 5883 }, 0 },
+	/* 3377 */ { 0, 0x44, { 2, 2 }, { 5885, 5885 }, 0 },
+	/* 3378 */ { 0, 0x44, { 2, 2 }, { 5887, 5887 }, 0 },
+	/* 3379 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1313 },
+	/* 3380 */ { 0, 0x00, { 0, 0 }, { 0, 0 }, 1315 },
+	/* 3381 */ { 0, 0x44, { 2, 2 }, { 5889, 5889 }, 0 },
+	/* 3382 */ { 0, 0x44, { 2, 2 }, { 5891, 5891 }, 0 },
+	/* 3383 */ { 0, 0x55, { 2, 2 }, { 5893, 5893 }, 0 },
+	/* 3384 */ { 0, 0x55, { 2, 2 }, { 5895, 5895 }, 0 },
+	/* 3385 */ { 0, 0x55, { 3, 3 }, { 5897, 5897 }, 0 },
+	/* 3386 */ { 0, 0x55, { 3, 3 }, { 5900, 5900 }, 0 },
+	/* 3387 */ { 0, 0x55, { 3, 3 }, { 5903, 5903 }, 0 },
+	/* 3388 */ { 0, 0x55, { 3, 3 }, { 5906, 5906 }, 0 },
+	/* 3389 */ { 0, 0x55, { 3, 3 }, { 5909, 5909 }, 0 },
+	/* 3390 */ { 226, 0x00, { 0, 0 }, { 0, 0 }, 0 },
+	/* 3391 */ { 0, 0x55, { 2, 2 }, { 5912, 5912 }, 0 },
+	/* 3392 */ { 0, 0x55, { 2, 2 }, { 5914, 5914 }, 0 },
+	/* 3393 */ { 0, 0x55, { 3, 3 }, { 5916, 5916 }, 0 },
+	/* 3394 */ { 0, 0x55, { 3, 3 }, { 5919, 5919 }, 0 },
+	/* 3395 */ { 0, 0x55, { 3, 3 }, { 5922, 5922 }, 0 },
+	/* 3396 */ { 0, 0x55, { 3, 3 }, { 5925, 5925 }, 0 },
+	/* 3397 */ { 0, 0x50, { 0, 1 }, { 0, 5928 }, 0 },
+	/* 3398 */ { 0, 0x50, { 0, 1 }, { 0, 5929 }, 0 },
+	/* 3399 */ { 0, 0x50, { 0, 1 }, { 0, 5930 }, 0 },
+	/* 3400 */ { 0, 0x50, { 0, 1 }, { 0, 5931 }, 0 },
+	/* 3401 */ { 0, 0x50, { 0, 1 }, { 0, 5932 }, 0 },
+	/* 3402 */ { 0, 0x50, { 0, 1 }, { 0, 5933 }, 0 },
+	/* 3403 */ { 0, 0x50, { 0, 1 }, { 0, 5934 }, 0 },
+	/* 3404 */ { 0, 0x50, { 0, 1 }, { 0, 5935 }, 0 },
+	/* 3405 */ { 0, 0x50, { 0, 1 }, { 0, 5936 }, 0 },
+	/* 3406 */ { 0, 0x50, { 0, 1 }, { 0, 5937 }, 0 },
+	/* 3407 */ { 0, 0x50, { 0, 1 }, { 0, 5938 }, 0 },
+	/* 3408 */ { 0, 0x50, { 0, 1 }, { 0, 5939 }, 0 },
+	/* 3409 */ { 0, 0x50, { 0, 1 }, { 0, 5940 }, 0 },
+	/* 3410 */ { 0, 0x50, { 0, 1 }, { 0, 5941 }, 0 },
+	/* 3411 */ { 0, 0x50, { 0, 1 }, { 0, 5942 }, 0 },
+	/* 3412 */ { 0, 0x50, { 0, 1 }, { 0, 5943 }, 0 },
+	/* 3413 */ { 0, 0x50, { 0, 1 }, { 0, 5944 }, 0 },
+	/* 3414 */ { 0, 0x50, { 0, 1 }, { 0, 673 }, 0 },
+	/* 3415 */ { 0, 0x50, { 0, 1 }, { 0, 5945 }, 0 },
+	/* 3416 */ { 0, 0x50, { 0, 1 }, { 0, 5946 }, 0 },
+	/* 3417 */ { 0, 0x50, { 0, 1 }, { 0, 5947 }, 0 },
+	/* 3418 */ { 0, 0x50, { 0, 1 }, { 0, 2349 }, 0 },
+	/* 3419 */ { 0, 0x50, { 0, 1 }, { 0, 5948 }, 0 },
+	/* 3420 */ { 0, 0x50, { 0, 1 }, { 0, 5949 }, 0 },
+	/* 3421 */ { 0, 0x50, { 0, 1 }, { 0, 5950 }, 0 },
+	/* 3422 */ { 0, 0x50, { 0, 1 }, { 0, 5951 }, 0 },
+	/* 3423 */ { 0, 0x50, { 0, 1 }, { 0, 2142 }, 0 },
+	/* 3424 */ { 0, 0x50, { 0, 1 }, { 0, 5952 }, 0 },
+	/* 3425 */ { 0, 0x50, { 0, 1 }, { 0, 5953 }, 0 },
+	/* 3426 */ { 0, 0x50, { 0, 1 }, { 0, 5954 }, 0 },
+	/* 3427 */ { 0, 0x50, { 0, 1 }, { 0, 5955 }, 0 },
+	/* 3428 */ { 0, 0x50, { 0, 1 }, { 0, 5956 }, 0 },
+	/* 3429 */ { 0, 0x50, { 0, 1 }, { 0, 5957 }, 0 },
+	/* 3430 */ { 0, 0x50, { 0, 1 }, { 0, 5958 }, 0 },
+	/* 3431 */ { 0, 0x50, { 0, 1 }, { 0, 5959 }, 0 },
+	/* 3432 */ { 0, 0x50, { 0, 1 }, { 0, 5960 }, 0 },
+	/* 3433 */ { 0, 0x50, { 0, 1 }, { 0, 5961 }, 0 },
+	/* 3434 */ { 0, 0x50, { 0, 1 }, { 0, 5962 }, 0 },
+	/* 3435 */ { 0, 0x50, { 0, 1 }, { 0, 5963 }, 0 },
+	/* 3436 */ { 0, 0x50, { 0, 1 }, { 0, 5964 }, 0 },
+	/* 3437 */ { 0, 0x50, { 0, 1 }, { 0, 5965 }, 0 },
+	/* 3438 */ { 0, 0x50, { 0, 1 }, { 0, 5966 }, 0 },
+	/* 3439 */ { 0, 0x50, { 0, 2 }, { 0, 5967 }, 0 },
+	/* 3440 */ { 0, 0x50, { 0, 2 }, { 0, 5969 }, 0 },
+	/* 3441 */ { 0, 0x50, { 0, 2 }, { 0, 5971 }, 0 },
+	/* 3442 */ { 0, 0x50, { 0, 2 }, { 0, 5973 }, 0 },
+	/* 3443 */ { 0, 0x50, { 0, 2 }, { 0, 5975 }, 0 },
+	/* 3444 */ { 0, 0x50, { 0, 2 }, { 0, 5977 }, 0 },
+	/* 3445 */ { 0, 0x50, { 0, 2 }, { 0, 5979 }, 0 },
+	/* 3446 */ { 0, 0x50, { 0, 2 }, { 0, 5981 }, 0 },
+	/* 3447 */ { 0, 0x50, { 0, 2 }, { 0, 5983 }, 0 },
+	/* 3448 */ { 0, 0x50, { 0, 2 }, { 0, 5985 }, 0 },
+	/* 3449 */ { 0, 0x50, { 0, 2 }, { 0, 5987 }, 0 },
+	/* 3450 */ { 0, 0x50, { 0, 3 }, { 0, 5989 }, 0 },
+	/* 3451 */ { 0, 0x50, { 0, 3 }, { 0, 5992 }, 0 },
+	/* 3452 */ { 0, 0x50, { 0, 3 }, { 0, 5995 }, 0 },
+	/* 3453 */ { 0, 0x50, { 0, 3 }, { 0, 5998 }, 0 },
+	/* 3454 */ { 0, 0x50, { 0, 3 }, { 0, 6001 }, 0 },
+	/* 3455 */ { 0, 0x50, { 0, 3 }, { 0, 6004 }, 0 },
+	/* 3456 */ { 0, 0x50, { 0, 3 }, { 0, 6007 }, 0 },
+	/* 3457 */ { 0, 0x50, { 0, 3 }, { 0, 6010 }, 0 },
+	/* 3458 */ { 0, 0x50, { 0, 3 }, { 0, 6013 }, 0 },
+	/* 3459 */ { 0, 0x50, { 0, 3 }, { 0, 6016 }, 0 },
+	/* 3460 */ { 0, 0x50, { 0, 3 }, { 0, 6019 }, 0 },
+	/* 3461 */ { 0, 0x50, { 0, 3 }, { 0, 6022 }, 0 },
+	/* 3462 */ { 0, 0x50, { 0, 3 }, { 0, 6025 }, 0 },
+	/* 3463 */ { 0, 0x50, { 0, 3 }, { 0, 6028 }, 0 },
+	/* 3464 */ { 0, 0x50, { 0, 3 }, { 0, 6031 }, 0 },
+	/* 3465 */ { 0, 0x50, { 0, 3 }, { 0, 6034 }, 0 },
+	/* 3466 */ { 0, 0x50, { 0, 3 }, { 0, 6037 }, 0 },
+	/* 3467 */ { 0, 0x50, { 0, 3 }, { 0, 6040 }, 0 },
+	/* 3468 */ { 0, 0x50, { 0, 3 }, { 0, 6043 }, 0 },
+	/* 3469 */ { 0, 0x50, { 0, 3 }, { 0, 6046 }, 0 },
+	/* 3470 */ { 0, 0x50, { 0, 3 }, { 0, 6049 }, 0 },
+	/* 3471 */ { 0, 0x50, { 0, 3 }, { 0, 6052 }, 0 },
+	/* 3472 */ { 0, 0x50, { 0, 3 }, { 0, 6055 }, 0 },
+	/* 3473 */ { 0, 0x50, { 0, 3 }, { 0, 6058 }, 0 },
+	/* 3474 */ { 0, 0x50, { 0, 3 }, { 0, 6061 }, 0 },
+	/* 3475 */ { 0, 0x50, { 0, 3 }, { 0, 6064 }, 0 },
+	/* 3476 */ { 0, 0x50, { 0, 3 }, { 0, 6067 }, 0 },
+	/* 3477 */ { 0, 0x50, { 0, 2 }, { 0, 6070 }, 0 },
+	/* 3478 */ { 0, 0x50, { 0, 2 }, { 0, 6072 }, 0 },
+	/* 3479 */ { 0, 0x50, { 0, 2 }, { 0, 6074 }, 0 },
+	/* 3480 */ { 0, 0x50, { 0, 2 }, { 0, 6076 }, 0 },
+	/* 3481 */ { 0, 0x50, { 0, 2 }, { 0, 6078 }, 0 },
+	/* 3482 */ { 0, 0x50, { 0, 3 }, { 0, 6080 }, 0 },
+	/* 3483 */ { 0, 0x50, { 0, 2 }, { 0, 6083 }, 0 },
+	/* 3484 */ { 0, 0x50, { 0, 2 }, { 0, 6085 }, 0 },
+	/* 3485 */ { 0, 0x50, { 0, 2 }, { 0, 6087 }, 0 },
+	/* 3486 */ { 0, 0x50, { 0, 2 }, { 0, 6089 }, 0 },
+	/* 3487 */ { 0, 0x50, { 0, 2 }, { 0, 6091 }, 0 },
+	/* 3488 */ { 0, 0x50, { 0, 2 }, { 0, 6093 }, 0 },
+	/* 3489 */ { 0, 0x50, { 0, 2 }, { 0, 6095 }, 0 },
+	/* 3490 */ { 0, 0x50, { 0, 1 }, { 0, 6097 }, 0 },
+	/* 3491 */ { 0, 0x50, { 0, 1 }, { 0, 6098 }, 0 },
+	/* 3492 */ { 0, 0x50, { 0, 2 }, { 0, 3105 }, 0 },
+	/* 3493 */ { 0, 0x50, { 0, 1 }, { 0, 6099 }, 0 },
+	/* 3494 */ { 0, 0x50, { 0, 1 }, { 0, 6100 }, 0 },
+	/* 3495 */ { 0, 0x50, { 0, 1 }, { 0, 6101 }, 0 },
+	/* 3496 */ { 0, 0x50, { 0, 1 }, { 0, 6102 }, 0 },
+	/* 3497 */ { 0, 0x50, { 0, 1 }, { 0, 6103 }, 0 },
+	/* 3498 */ { 0, 0x50, { 0, 1 }, { 0, 4646 }, 0 },
+	/* 3499 */ { 0, 0x50, { 0, 1 }, { 0, 6104 }, 0 },
+	/* 3500 */ { 0, 0x50, { 0, 1 }, { 0, 6105 }, 0 },
+	/* 3501 */ { 0, 0x50, { 0, 1 }, { 0, 6106 }, 0 },
+	/* 3502 */ { 0, 0x50, { 0, 1 }, { 0, 6107 }, 0 },
+	/* 3503 */ { 0, 0x50, { 0, 1 }, { 0, 6108 }, 0 },
+	/* 3504 */ { 0, 0x50, { 0, 1 }, { 0, 6109 }, 0 },
+	/* 3505 */ { 0, 0x50, { 0, 1 }, { 0, 6110 }, 0 },
+	/* 3506 */ { 0, 0x50, { 0, 1 }, { 0, 6111 }, 0 },
+	/* 3507 */ { 0, 0x50, { 0, 1 }, { 0, 6112 }, 0 },
+	/* 3508 */ { 0, 0x50, { 0, 1 }, { 0, 6113 }, 0 },
+	/* 3509 */ { 0, 0x50, { 0, 1 }, { 0, 6114 }, 0 },
+	/* 3510 */ { 0, 0x50, { 0, 1 }, { 0, 6115 }, 0 },
+	/* 3511 */ { 0, 0x50, { 0, 1 }, { 0, 6116 }, 0 },
+	/* 3512 */ { 0, 0x50, { 0, 1 }, { 0, 6117 }, 0 },
+	/* 3513 */ { 0, 0x50, { 0, 1 }, { 0, 6118 }, 0 },
+	/* 3514 */ { 0, 0x50, { 0, 1 }, { 0, 6119 }, 0 },
+	/* 3515 */ { 0, 0x50, { 0, 1 }, { 0, 6120 }, 0 },
+	/* 3516 */ { 0, 0x50, { 0, 1 }, { 0, 6121 }, 0 },
+	/* 3517 */ { 0, 0x50, { 0, 1 }, { 0, 6122 }, 0 },
+	/* 3518 */ { 0, 0x50, { 0, 1 }, { 0, 6123 }, 0 },
+	/* 3519 */ { 0, 0x50, { 0, 1 }, { 0, 6124 }, 0 },
+	/* 3520 */ { 0, 0x50, { 0, 1 }, { 0, 6125 }, 0 },
+	/* 3521 */ { 0, 0x50, { 0, 1 }, { 0, 6126 }, 0 },
+	/* 3522 */ { 0, 0x50, { 0, 3 }, { 0, 6127 }, 0 },
+	/* 3523 */ { 0, 0x50, { 0, 3 }, { 0, 6130 }, 0 },
+	/* 3524 */ { 0, 0x50, { 0, 3 }, { 0, 6133 }, 0 },
+	/* 3525 */ { 0, 0x50, { 0, 3 }, { 0, 6136 }, 0 },
+	/* 3526 */ { 0, 0x50, { 0, 3 }, { 0, 6139 }, 0 },
+	/* 3527 */ { 0, 0x50, { 0, 3 }, { 0, 6142 }, 0 },
+	/* 3528 */ { 0, 0x50, { 0, 3 }, { 0, 6145 }, 0 },
+	/* 3529 */ { 0, 0x50, { 0, 3 }, { 0, 6148 }, 0 },
+	/* 3530 */ { 0, 0x50, { 0, 3 }, { 0, 6151 }, 0 },
+	/* 3531 */ { 0, 0x50, { 0, 1 }, { 0, 6154 }, 0 },
+	/* 3532 */ { 0, 0x50, { 0, 1 }, { 0, 6155 }, 0 },
+	/* 3533 */ { 0, 0x55, { 1, 1 }, { 6156, 6156 }, 0 },
+	/* 3534 */ { 0, 0x55, { 1, 1 }, { 6157, 6157 }, 0 },
+	/* 3535 */ { 0, 0x55, { 1, 1 }, { 6158, 6158 }, 0 },
+	/* 3536 */ { 0, 0x55, { 1, 1 }, { 6159, 6159 }, 0 },
+	/* 3537 */ { 0, 0x55, { 1, 1 }, { 6160, 6160 }, 0 },
+	/* 3538 */ { 0, 0x55, { 1, 1 }, { 6161, 6161 }, 0 },
+	/* 3539 */ { 0, 0x55, { 1, 1 }, { 6162, 6162 }, 0 },
+	/* 3540 */ { 0, 0x55, { 1, 1 }, { 6163, 6163 }, 0 },
+	/* 3541 */ { 0, 0x55, { 1, 1 }, { 6164, 6164 }, 0 },
+	/* 3542 */ { 0, 0x55, { 1, 1 }, { 6165, 6165 }, 0 },
+	/* 3543 */ { 0, 0x55, { 1, 1 }, { 6166, 6166 }, 0 },
+	/* 3544 */ { 0, 0x55, { 1, 1 }, { 6167, 6167 }, 0 },
+	/* 3545 */ { 0, 0x55, { 1, 1 }, { 6168, 6168 }, 0 },
+	/* 3546 */ { 0, 0x55, { 1, 1 }, { 6169, 6169 }, 0 },
+	/* 3547 */ { 0, 0x55, { 1, 1 }, { 6170, 6170 }, 0 },
+	/* 3548 */ { 0, 0x55, { 1, 1 }, { 6171, 6171 }, 0 },
+	/* 3549 */ { 0, 0x55, { 1, 1 }, { 6172, 6172 }, 0 },
+	/* 3550 */ { 0, 0x55, { 1, 1 }, { 6173, 6173 }, 0 },
+	/* 3551 */ { 0, 0x55, { 1, 1 }, { 6106, 6106 }, 0 },
+	/* 3552 */ { 0, 0x55, { 1, 1 }, { 6174, 6174 }, 0 },
+	/* 3553 */ { 0, 0x55, { 1, 1 }, { 6175, 6175 }, 0 },
+	/* 3554 */ { 0, 0x55, { 1, 1 }, { 6176, 6176 }, 0 },
+	/* 3555 */ { 0, 0x55, { 1, 1 }, { 6177, 6177 }, 0 },
+	/* 3556 */ { 0, 0x55, { 1, 1 }, { 6178, 6178 }, 0 },
+	/* 3557 */ { 0, 0x55, { 1, 1 }, { 6179, 6179 }, 0 },
+	/* 3558 */ { 0, 0x55, { 1, 1 }, { 2818, 2818 }, 0 },
+	/* 3559 */ { 0, 0x55, { 1, 1 }, { 6180, 6180 }, 0 },
+	/* 3560 */ { 0, 0x55, { 1, 1 }, { 6181, 6181 }, 0 },
+	/* 3561 */ { 0, 0x55, { 1, 1 }, { 6182, 6182 }, 0 },
+	/* 3562 */ { 0, 0x55, { 1, 1 }, { 6183, 6183 }, 0 },
+	/* 3563 */ { 0, 0x55, { 1, 1 }, { 6124, 6124 }, 0 },
+	/* 3564 */ { 0, 0x55, { 1, 1 }, { 6184, 6184 }, 0 },
+	/* 3565 */ { 0, 0x55, { 1, 1 }, { 6185, 6185 }, 0 },
+	/* 3566 */ { 0, 0x55, { 1, 1 }, { 6186, 6186 }, 0 },
+	/* 3567 */ { 0, 0x55, { 1, 1 }, { 6187, 6187 }, 0 },
+	/* 3568 */ { 0, 0x55, { 1, 1 }, { 6188, 6188 }, 0 },
+	/* 3569 */ { 0, 0x55, { 1, 1 }, { 6189, 6189 }, 0 },
+	/* 3570 */ { 0, 0x55, { 1, 1 }, { 6190, 6190 }, 0 },
+	/* 3571 */ { 0, 0x55, { 1, 1 }, { 6191, 6191 }, 0 },
+	/* 3572 */ { 0, 0x55, { 1, 1 }, { 6192, 6192 }, 0 },
+	/* 3573 */ { 0, 0x55, { 1, 1 }, { 6193, 6193 }, 0 },
+	/* 3574 */ { 0, 0x55, { 1, 1 }, { 6194, 6194 }, 0 },
+	/* 3575 */ { 0, 0x55, { 1, 1 }, { 6195, 6195 }, 0 },
+	/* 3576 */ { 0, 0x55, { 1, 1 }, { 6196, 6196 }, 0 },
+	/* 3577 */ { 0, 0x55, { 1, 1 }, { 6197, 6197 }, 0 },
+	/* 3578 */ { 0, 0x55, { 1, 1 }, { 6198, 6198 }, 0 },
+	/* 3579 */ { 0, 0x55, { 1, 1 }, { 6199, 6199 }, 0 },
+	/* 3580 */ { 0, 0x55, { 1, 1 }, { 6200, 6200 }, 0 },
+	/* 3581 */ { 0, 0x55, { 1, 1 }, { 6201, 6201 }, 0 },
+	/* 3582 */ { 0, 0x55, { 1, 1 }, { 6202, 6202 }, 0 },
+	/* 3583 */ { 0, 0x55, { 1, 1 }, { 6203, 6203 }, 0 },
+	/* 3584 */ { 0, 0x55, { 1, 1 }, { 6204, 6204 }, 0 },
+	/* 3585 */ { 0, 0x55, { 1, 1 }, { 6205, 6205 }, 0 },
+	/* 3586 */ { 0, 0x55, { 1, 1 }, { 6206, 6206 }, 0 },
+	/* 3587 */ { 0, 0x55, { 1, 1 }, { 6207, 6207 }, 0 },
+	/* 3588 */ { 0, 0x55, { 1, 1 }, { 6208, 6208 }, 0 },
+	/* 3589 */ { 0, 0x55, { 1, 1 }, { 6209, 6209 }, 0 },
+	/* 3590 */ { 0, 0x55, { 1, 1 }, { 6210, 6210 }, 0 },
+	/* 3591 */ { 0, 0x55, { 1, 1 }, { 6211, 6211 }, 0 },
+	/* 3592 */ { 0, 0x55, { 1, 1 }, { 6212, 6212 }, 0 },
+	/* 3593 */ { 0, 0x55, { 1, 1 }, { 6213, 6213 }, 0 },
+	/* 3594 */ { 0, 0x55, { 1, 1 }, { 6214, 6214 }, 0 },
+	/* 3595 */ { 0, 0x55, { 1, 1 }, { 6215, 6215 }, 0 },
+	/* 3596 */ { 0, 0x55, { 1, 1 }, { 6216, 6216 }, 0 },
+	/* 3597 */ { 0, 0x55, { 1, 1 }, { 6217, 6217 }, 0 },
+	/* 3598 */ { 0, 0x55, { 1, 1 }, { 6218, 6218 }, 0 },
+	/* 3599 */ { 0, 0x55, { 1, 1 }, { 6219, 6219 }, 0 },
+	/* 3600 */ { 0, 0x55, { 1, 1 }, { 6220, 6220 }, 0 },
+	/* 3601 */ { 0, 0x55, { 1, 1 }, { 6221, 6221 }, 0 },
+	/* 3602 */ { 0, 0x55, { 1, 1 }, { 6222, 6222 }, 0 },
+	/* 3603 */ { 0, 0x55, { 1, 1 }, { 6223, 6223 }, 0 },
+	/* 3604 */ { 0, 0x55, { 1, 1 }, { 6224, 6224 }, 0 },
+	/* 3605 */ { 0, 0x55, { 1, 1 }, { 6225, 6225 }, 0 },
+	/* 3606 */ { 0, 0x55, { 1, 1 }, { 6226, 6226 }, 0 },
+	/* 3607 */ { 0, 0x55, { 1, 1 }, { 6227, 6227 }, 0 },
+	/* 3608 */ { 0, 0x55, { 1, 1 }, { 6228, 6228 }, 0 },
+	/* 3609 */ { 0, 0x55, { 1, 1 }, { 6229, 6229 }, 0 },
+	/* 3610 */ { 0, 0x55, { 1, 1 }, { 6099, 6099 }, 0 },
+	/* 3611 */ { 0, 0x55, { 1, 1 }, { 6230, 6230 }, 0 },
+	/* 3612 */ { 0, 0x55, { 1, 1 }, { 6231, 6231 }, 0 },
+	/* 3613 */ { 0, 0x55, { 1, 1 }, { 6232, 6232 }, 0 },
+	/* 3614 */ { 0, 0x55, { 1, 1 }, { 6233, 6233 }, 0 },
+	/* 3615 */ { 0, 0x55, { 1, 1 }, { 6234, 6234 }, 0 },
+	/* 3616 */ { 0, 0x55, { 1, 1 }, { 6235, 6235 }, 0 },
+	/* 3617 */ { 0, 0x55, { 1, 1 }, { 6236, 6236 }, 0 },
+	/* 3618 */ { 0, 0x55, { 1, 1 }, { 6237, 6237 }, 0 },
+	/* 3619 */ { 0, 0x55, { 1, 1 }, { 6238, 6238 }, 0 },
+	/* 3620 */ { 0, 0x55, { 1, 1 }, { 6239, 6239 }, 0 },
+	/* 3621 */ { 0, 0x55, { 1, 1 }, { 6240, 6240 }, 0 },
+	/* 3622 */ { 0, 0x55, { 1, 1 }, { 6241, 6241 }, 0 },
+	/* 3623 */ { 0, 0x55, { 1, 1 }, { 6242, 6242 }, 0 },
+	/* 3624 */ { 0, 0x55, { 1, 1 }, { 6243, 6243 }, 0 },
+	/* 3625 */ { 0, 0x55, { 1, 1 }, { 6244, 6244 }, 0 },
+	/* 3626 */ { 0, 0x55, { 1, 1 }, { 6245, 6245 }, 0 },
+	/* 3627 */ { 0, 0x55, { 1, 1 }, { 6246, 6246 }, 0 },
+	/* 3628 */ { 0, 0x55, { 1, 1 }, { 6247, 6247 }, 0 },
+	/* 3629 */ { 0, 0x55, { 1, 1 }, { 6248, 6248 }, 0 },
+	/* 3630 */ { 0, 0x55, { 1, 1 }, { 6249, 6249 }, 0 },
+	/* 3631 */ { 0, 0x55, { 1, 1 }, { 6250, 6250 }, 0 },
+	/* 3632 */ { 0, 0x55, { 1, 1 }, { 2844, 2844 }, 0 },
+	/* 3633 */ { 0, 0x55, { 1, 1 }, { 6251, 6251 }, 0 },
+	/* 3634 */ { 0, 0x55, { 1, 1 }, { 6252, 6252 }, 0 },
+	/* 3635 */ { 0, 0x55, { 1, 1 }, { 6253, 6253 }, 0 },
+	/* 3636 */ { 0, 0x55, { 1, 1 }, { 6254, 6254 }, 0 },
+	/* 3637 */ { 0, 0x55, { 1, 1 }, { 6255, 6255 }, 0 },
+	/* 3638 */ { 0, 0x55, { 1, 1 }, { 6256, 6256 }, 0 },
+	/* 3639 */ { 0, 0x55, { 1, 1 }, { 6257, 6257 }, 0 },
+	/* 3640 */ { 0, 0x55, { 1, 1 }, { 6258, 6258 }, 0 },
+	/* 3641 */ { 0, 0x55, { 1, 1 }, { 6259, 6259 }, 0 },
+	/* 3642 */ { 0, 0x55, { 1, 1 }, { 6260, 6260 }, 0 },
+	/* 3643 */ { 0, 0x55, { 1, 1 }, { 6261, 6261 }, 0 },
+	/* 3644 */ { 0, 0x55, { 1, 1 }, { 6262, 6262 }, 0 },
+	/* 3645 */ { 0, 0x55, { 1, 1 }, { 6263, 6263 }, 0 },
+	/* 3646 */ { 0, 0x55, { 1, 1 }, { 6264, 6264 }, 0 },
+	/* 3647 */ { 0, 0x55, { 1, 1 }, { 6265, 6265 }, 0 },
+	/* 3648 */ { 0, 0x55, { 1, 1 }, { 6266, 6266 }, 0 },
+	/* 3649 */ { 0, 0x55, { 1, 1 }, { 6267, 6267 }, 0 },
+	/* 3650 */ { 0, 0x55, { 1, 1 }, { 6268, 6268 }, 0 },
+	/* 3651 */ { 0, 0x55, { 1, 1 }, { 6269, 6269 }, 0 },
+	/* 3652 */ { 0, 0x55, { 1, 1 }, { 6270, 6270 }, 0 },
+	/* 3653 */ { 0, 0x55, { 1, 1 }, { 6271, 6271 }, 0 },
+	/* 3654 */ { 0, 0x55, { 1, 1 }, { 6272, 6272 }, 0 },
+	/* 3655 */ { 0, 0x55, { 1, 1 }, { 6273, 6273 }, 0 },
+	/* 3656 */ { 0, 0x55, { 1, 1 }, { 6274, 6274 }, 0 },
+	/* 3657 */ { 0, 0x55, { 1, 1 }, { 2856, 2856 }, 0 },
+	/* 3658 */ { 0, 0x55, { 1, 1 }, { 6275, 6275 }, 0 },
+	/* 3659 */ { 0, 0x55, { 1, 1 }, { 6276, 6276 }, 0 },
+	/* 3660 */ { 0, 0x55, { 1, 1 }, { 6277, 6277 }, 0 },
+	/* 3661 */ { 0, 0x55, { 1, 1 }, { 6278, 6278 }, 0 },
+	/* 3662 */ { 0, 0x55, { 1, 1 }, { 6279, 6279 }, 0 },
+	/* 3663 */ { 0, 0x55, { 1, 1 }, { 6280, 6280 }, 0 },
+	/* 3664 */ { 0, 0x55, { 1, 1 }, { 6281, 6281 }, 0 },
+	/* 3665 */ { 0, 0x55, { 1, 1 }, { 6282, 6282 }, 0 },
+	/* 3666 */ { 0, 0x55, { 1, 1 }, { 6283, 6283 }, 0 },
+	/* 3667 */ { 0, 0x55, { 1, 1 }, { 6284, 6284 }, 0 },
+	/* 3668 */ { 0, 0x55, { 1, 1 }, { 6285, 6285 }, 0 },
+	/* 3669 */ { 0, 0x55, { 1, 1 }, { 6286, 6286 }, 0 },
+	/* 3670 */ { 0, 0x55, { 1, 1 }, { 6287, 6287 }, 0 },
+	/* 3671 */ { 0, 0x55, { 1, 1 }, { 6288, 6288 }, 0 },
+	/* 3672 */ { 0, 0x55, { 1, 1 }, { 6289, 6289 }, 0 },
+	/* 3673 */ { 0, 0x55, { 1, 1 }, { 6290, 6290 }, 0 },
+	/* 3674 */ { 0, 0x55, { 1, 1 }, { 6291, 6291 }, 0 },
+	/* 3675 */ { 0, 0x55, { 1, 1 }, { 6292, 6292 }, 0 },
+	/* 3676 */ { 0, 0x55, { 1, 1 }, { 6293, 6293 }, 0 },
+	/* 3677 */ { 0, 0x55, { 1, 1 }, { 6294, 6294 }, 0 },
+	/* 3678 */ { 0, 0x55, { 1, 1 }, { 6295, 6295 }, 0 },
+	/* 3679 */ { 0, 0x55, { 1, 1 }, { 6296, 6296 }, 0 },
+	/* 3680 */ { 0, 0x55, { 1, 1 }, { 6297, 6297 }, 0 },
+	/* 3681 */ { 0, 0x55, { 1, 1 }, { 6298, 6298 }, 0 },
+	/* 3682 */ { 0, 0x55, { 1, 1 }, { 6299, 6299 }, 0 },
+	/* 3683 */ { 0, 0x55, { 1, 1 }, { 6300, 6300 }, 0 },
+	/* 3684 */ { 0, 0x55, { 1, 1 }, { 6301, 6301 }, 0 },
+	/* 3685 */ { 0, 0x55, { 1, 1 }, { 6302, 6302 }, 0 },
+	/* 3686 */ { 0, 0x55, { 1, 1 }, { 6303, 6303 }, 0 },
+	/* 3687 */ { 0, 0x55, { 1, 1 }, { 6304, 6304 }, 0 },
+	/* 3688 */ { 0, 0x55, { 1, 1 }, { 6305, 6305 }, 0 },
+	/* 3689 */ { 0, 0x55, { 1, 1 }, { 6306, 6306 }, 0 },
+	/* 3690 */ { 0, 0x55, { 1, 1 }, { 6307, 6307 }, 0 },
+	/* 3691 */ { 0, 0x55, { 1, 1 }, { 6308, 6308 }, 0 },
+	/* 3692 */ { 0, 0x55, { 1, 1 }, { 6309, 6309 }, 0 },
+	/* 3693 */ { 0, 0x55, { 1, 1 }, { 6310, 6310 }, 0 },
+	/* 3694 */ { 0, 0x55, { 1, 1 }, { 6311, 6311 }, 0 },
+	/* 3695 */ { 0, 0x55, { 1, 1 }, { 6312, 6312 }, 0 },
+	/* 3696 */ { 0, 0x55, { 1, 1 }, { 6313, 6313 }, 0 },
+	/* 3697 */ { 0, 0x55, { 1, 1 }, { 6314, 6314 }, 0 },
+	/* 3698 */ { 0, 0x55, { 1, 1 }, { 6315, 6315 }, 0 },
+	/* 3699 */ { 0, 0x55, { 1, 1 }, { 6316, 6316 }, 0 },
+	/* 3700 */ { 0, 0x55, { 1, 1 }, { 6317, 6317 }, 0 },
+	/* 3701 */ { 0, 0x55, { 1, 1 }, { 6318, 6318 }, 0 },
+	/* 3702 */ { 0, 0x55, { 1, 1 }, { 6319, 6319 }, 0 },
+	/* 3703 */ { 0, 0x55, { 1, 1 }, { 6320, 6320 }, 0 },
+	/* 3704 */ { 0, 0x55, { 1, 1 }, { 6321, 6321 }, 0 },
+	/* 3705 */ { 0, 0x55, { 1, 1 }, { 6322, 6322 }, 0 },
+	/* 3706 */ { 0, 0x55, { 1, 1 }, { 6323, 6323 }, 0 },
+	/* 3707 */ { 0, 0x55, { 1, 1 }, { 6324, 6324 }, 0 },
+	/* 3708 */ { 0, 0x55, { 1, 1 }, { 6325, 6325 }, 0 },
+	/* 3709 */ { 0, 0x55, { 1, 1 }, { 6326, 6326 }, 0 },
+	/* 3710 */ { 0, 0x55, { 1, 1 }, { 6327, 6327 }, 0 },
+	/* 3711 */ { 0, 0x55, { 1, 1 }, { 6328, 6328 }, 0 },
+	/* 3712 */ { 0, 0x55, { 1, 1 }, { 6329, 6329 }, 0 },
+	/* 3713 */ { 0, 0x55, { 1, 1 }, { 6330, 6330 }, 0 },
+	/* 3714 */ { 0, 0x55, { 1, 1 }, { 6331, 6331 }, 0 },
+	/* 3715 */ { 0, 0x55, { 1, 1 }, { 6332, 6332 }, 0 },
+	/* 3716 */ { 0, 0x55, { 1, 1 }, { 6333, 6333 }, 0 },
+	/* 3717 */ { 0, 0x55, { 1, 1 }, { 6334, 6334 }, 0 },
+	/* 3718 */ { 0, 0x55, { 1, 1 }, { 6335, 6335 }, 0 },
+	/* 3719 */ { 0, 0x55, { 1, 1 }, { 6336, 6336 }, 0 },
+	/* 3720 */ { 0, 0x55, { 1, 1 }, { 6337, 6337 }, 0 },
+	/* 3721 */ { 0, 0x55, { 1, 1 }, { 6338, 6338 }, 0 },
+	/* 3722 */ { 0, 0x55, { 1, 1 }, { 6339, 6339 }, 0 },
+	/* 3723 */ { 0, 0x55, { 1, 1 }, { 6340, 6340 }, 0 },
+	/* 3724 */ { 0, 0x55, { 1, 1 }, { 6341, 6341 }, 0 },
+	/* 3725 */ { 0, 0x55, { 1, 1 }, { 6342, 6342 }, 0 },
+	/* 3726 */ { 0, 0x55, { 1, 1 }, { 6343, 6343 }, 0 },
+	/* 3727 */ { 0, 0x55, { 1, 1 }, { 6344, 6344 }, 0 },
+	/* 3728 */ { 0, 0x55, { 1, 1 }, { 6345, 6345 }, 0 },
+	/* 3729 */ { 0, 0x55, { 1, 1 }, { 6346, 6346 }, 0 },
+	/* 3730 */ { 0, 0x55, { 1, 1 }, { 6347, 6347 }, 0 },
+	/* 3731 */ { 0, 0x55, { 1, 1 }, { 6348, 6348 }, 0 },
+	/* 3732 */ { 0, 0x55, { 1, 1 }, { 6349, 6349 }, 0 },
+	/* 3733 */ { 0, 0x55, { 1, 1 }, { 6350, 6350 }, 0 },
+	/* 3734 */ { 0, 0x55, { 1, 1 }, { 6351, 6351 }, 0 },
+	/* 3735 */ { 0, 0x55, { 1, 1 }, { 6352, 6352 }, 0 },
+	/* 3736 */ { 0, 0x55, { 1, 1 }, { 6353, 6353 }, 0 },
+	/* 3737 */ { 0, 0x55, { 1, 1 }, { 6354, 6354 }, 0 },
+	/* 3738 */ { 0, 0x55, { 1, 1 }, { 6355, 6355 }, 0 },
+	/* 3739 */ { 0, 0x55, { 1, 1 }, { 6356, 6356 }, 0 },
+	/* 3740 */ { 0, 0x55, { 1, 1 }, { 6357, 6357 }, 0 },
+	/* 3741 */ { 0, 0x55, { 1, 1 }, { 6358, 6358 }, 0 },
+	/* 3742 */ { 0, 0x55, { 1, 1 }, { 6359, 6359 }, 0 },
+	/* 3743 */ { 0, 0x55, { 1, 1 }, { 6360, 6360 }, 0 },
+	/* 3744 */ { 0, 0x55, { 1, 1 }, { 6361, 6361 }, 0 },
+	/* 3745 */ { 0, 0x55, { 1, 1 }, { 6362, 6362 }, 0 },
+	/* 3746 */ { 0, 0x55, { 1, 1 }, { 6363, 6363 }, 0 },
+	/* 3747 */ { 0, 0x55, { 1, 1 }, { 6364, 6364 }, 0 },
+	/* 3748 */ { 0, 0x55, { 1, 1 }, { 6365, 6365 }, 0 },
+	/* 3749 */ { 0, 0x55, { 1, 1 }, { 6366, 6366 }, 0 },
+	/* 3750 */ { 0, 0x55, { 1, 1 }, { 6367, 6367 }, 0 },
+	/* 3751 */ { 0, 0x55, { 1, 1 }, { 6368, 6368 }, 0 },
+	/* 3752 */ { 0, 0x55, { 1, 1 }, { 6369, 6369 }, 0 },
+	/* 3753 */ { 0, 0x55, { 1, 1 }, { 6370, 6370 }, 0 },
+	/* 3754 */ { 0, 0x55, { 1, 1 }, { 6371, 6371 }, 0 },
+	/* 3755 */ { 0, 0x55, { 1, 1 }, { 6372, 6372 }, 0 },
+	/* 3756 */ { 0, 0x55, { 1, 1 }, { 6373, 6373 }, 0 },
+	/* 3757 */ { 0, 0x55, { 1, 1 }, { 6374, 6374 }, 0 },
+	/* 3758 */ { 0, 0x55, { 1, 1 }, { 6375, 6375 }, 0 },
+	/* 3759 */ { 0, 0x55, { 1, 1 }, { 6376, 6376 }, 0 },
+	/* 3760 */ { 0, 0x55, { 1, 1 }, { 6377, 6377 }, 0 },
+	/* 3761 */ { 0, 0x55, { 1, 1 }, { 6378, 6378 }, 0 },
+	/* 3762 */ { 0, 0x55, { 1, 1 }, { 6379, 6379 }, 0 },
+	/* 3763 */ { 0, 0x55, { 1, 1 }, { 6380, 6380 }, 0 },
+	/* 3764 */ { 0, 0x55, { 1, 1 }, { 6381, 6381 }, 0 },
+	/* 3765 */ { 0, 0x55, { 1, 1 }, { 6382, 6382 }, 0 },
+	/* 3766 */ { 0, 0x55, { 1, 1 }, { 6383, 6383 }, 0 },
+	/* 3767 */ { 0, 0x55, { 1, 1 }, { 6384, 6384 }, 0 },
+	/* 3768 */ { 0, 0x55, { 1, 1 }, { 6385, 6385 }, 0 },
+	/* 3769 */ { 0, 0x55, { 1, 1 }, { 6386, 6386 }, 0 },
+	/* 3770 */ { 0, 0x55, { 1, 1 }, { 6387, 6387 }, 0 },
+	/* 3771 */ { 0, 0x55, { 1, 1 }, { 6388, 6388 }, 0 },
+	/* 3772 */ { 0, 0x55, { 1, 1 }, { 6389, 6389 }, 0 },
+	/* 3773 */ { 0, 0x55, { 1, 1 }, { 6390, 6390 }, 0 },
+	/* 3774 */ { 0, 0x55, { 1, 1 }, { 6391, 6391 }, 0 },
+	/* 3775 */ { 0, 0x55, { 1, 1 }, { 6392, 6392 }, 0 },
+	/* 3776 */ { 0, 0x55, { 1, 1 }, { 6393, 6393 }, 0 },
+	/* 3777 */ { 0, 0x55, { 1, 1 }, { 6394, 6394 }, 0 },
+	/* 3778 */ { 0, 0x55, { 1, 1 }, { 6395, 6395 }, 0 },
+	/* 3779 */ { 0, 0x55, { 1, 1 }, { 6396, 6396 }, 0 },
+	/* 3780 */ { 0, 0x55, { 1, 1 }, { 6397, 6397 }, 0 },
+	/* 3781 */ { 0, 0x55, { 1, 1 }, { 6398, 6398 }, 0 },
+	/* 3782 */ { 0, 0x55, { 1, 1 }, { 6399, 6399 }, 0 },
+	/* 3783 */ { 0, 0x55, { 1, 1 }, { 6400, 6400 }, 0 },
+	/* 3784 */ { 0, 0x55, { 1, 1 }, { 6401, 6401 }, 0 },
+	/* 3785 */ { 0, 0x55, { 1, 1 }, { 6402, 6402 }, 0 },
+	/* 3786 */ { 0, 0x55, { 1, 1 }, { 6403, 6403 }, 0 },
+	/* 3787 */ { 0, 0x55, { 1, 1 }, { 6404, 6404 }, 0 },
+	/* 3788 */ { 0, 0x55, { 1, 1 }, { 6405, 6405 }, 0 },
+	/* 3789 */ { 0, 0x55, { 1, 1 }, { 6406, 6406 }, 0 },
+	/* 3790 */ { 0, 0x55, { 1, 1 }, { 6407, 6407 }, 0 },
+	/* 3791 */ { 0, 0x55, { 1, 1 }, { 6408, 6408 }, 0 },
+	/* 3792 */ { 0, 0x55, { 1, 1 }, { 6409, 6409 }, 0 },
+	/* 3793 */ { 0, 0x55, { 1, 1 }, { 6410, 6410 }, 0 },
+	/* 3794 */ { 0, 0x55, { 1, 1 }, { 6411, 6411 }, 0 },
+	/* 3795 */ { 0, 0x55, { 1, 1 }, { 6412, 6412 }, 0 },
+	/* 3796 */ { 0, 0x55, { 1, 1 }, { 6413, 6413 }, 0 },
+	/* 3797 */ { 0, 0x55, { 1, 1 }, { 6414, 6414 }, 0 },
+	/* 3798 */ { 0, 0x55, { 1, 1 }, { 6415, 6415 }, 0 },
+	/* 3799 */ { 0, 0x55, { 1, 1 }, { 6416, 6416 }, 0 },
+	/* 3800 */ { 0, 0x55, { 1, 1 }, { 6417, 6417 }, 0 },
+	/* 3801 */ { 0, 0x55, { 1, 1 }, { 6418, 6418 }, 0 },
+	/* 3802 */ { 0, 0x55, { 1, 1 }, { 6419, 6419 }, 0 },
+	/* 3803 */ { 0, 0x55, { 1, 1 }, { 6420, 6420 }, 0 },
+	/* 3804 */ { 0, 0x55, { 1, 1 }, { 6421, 6421 }, 0 },
+	/* 3805 */ { 0, 0x55, { 1, 1 }, { 6422, 6422 }, 0 },
+	/* 3806 */ { 0, 0x55, { 1, 1 }, { 6423, 6423 }, 0 },
+	/* 3807 */ { 0, 0x55, { 1, 1 }, { 6424, 6424 }, 0 },
+	/* 3808 */ { 0, 0x55, { 1, 1 }, { 6425, 6425 }, 0 },
+	/* 3809 */ { 0, 0x55, { 1, 1 }, { 6426, 6426 }, 0 },
+	/* 3810 */ { 0, 0x55, { 1, 1 }, { 6427, 6427 }, 0 },
+	/* 3811 */ { 0, 0x55, { 1, 1 }, { 6428, 6428 }, 0 },
+	/* 3812 */ { 0, 0x55, { 1, 1 }, { 6429, 6429 }, 0 },
+	/* 3813 */ { 0, 0x55, { 1, 1 }, { 6430, 6430 }, 0 },
+	/* 3814 */ { 0, 0x55, { 1, 1 }, { 6431, 6431 }, 0 },
+	/* 3815 */ { 0, 0x55, { 1, 1 }, { 6432, 6432 }, 0 },
+	/* 3816 */ { 0, 0x55, { 1, 1 }, { 6433, 6433 }, 0 },
+	/* 3817 */ { 0, 0x55, { 1, 1 }, { 6434, 6434 }, 0 },
+	/* 3818 */ { 0, 0x55, { 1, 1 }, { 6435, 6435 }, 0 },
+	/* 3819 */ { 0, 0x55, { 1, 1 }, { 6436, 6436 }, 0 },
+	/* 3820 */ { 0, 0x55, { 1, 1 }, { 6437, 6437 }, 0 },
+	/* 3821 */ { 0, 0x55, { 1, 1 }, { 6438, 6438 }, 0 },
+	/* 3822 */ { 0, 0x55, { 1, 1 }, { 6439, 6439 }, 0 },
+	/* 3823 */ { 0, 0x55, { 1, 1 }, { 6440, 6440 }, 0 },
+	/* 3824 */ { 0, 0x55, { 1, 1 }, { 6441, 6441 }, 0 },
+	/* 3825 */ { 0, 0x55, { 1, 1 }, { 6442, 6442 }, 0 },
+	/* 3826 */ { 0, 0x55, { 1, 1 }, { 6443, 6443 }, 0 },
+	/* 3827 */ { 0, 0x55, { 1, 1 }, { 6444, 6444 }, 0 },
+	/* 3828 */ { 0, 0x55, { 1, 1 }, { 6445, 6445 }, 0 },
+	/* 3829 */ { 0, 0x55, { 1, 1 }, { 6446, 6446 }, 0 },
+	/* 3830 */ { 0, 0x55, { 1, 1 }, { 6447, 6447 }, 0 },
+	/* 3831 */ { 0, 0x55, { 1, 1 }, { 6448, 6448 }, 0 },
+	/* 3832 */ { 0, 0x55, { 1, 1 }, { 6449, 6449 }, 0 },
+	/* 3833 */ { 0, 0x55, { 1, 1 }, { 6450, 6450 }, 0 },
+	/* 3834 */ { 0, 0x55, { 1, 1 }, { 6451, 6451 }, 0 },
+	/* 3835 */ { 0, 0x55, { 1, 1 }, { 6452, 6452 }, 0 },
+	/* 3836 */ { 0, 0x55, { 1, 1 }, { 6453, 6453 }, 0 },
+	/* 3837 */ { 0, 0x55, { 1, 1 }, { 6454, 6454 }, 0 },
+	/* 3838 */ { 0, 0x55, { 1, 1 }, { 6455, 6455 }, 0 },
+	/* 3839 */ { 0, 0x55, { 1, 1 }, { 6456, 6456 }, 0 },
+	/* 3840 */ { 0, 0x55, { 1, 1 }, { 6457, 6457 }, 0 },
+	/* 3841 */ { 0, 0x55, { 1, 1 }, { 6458, 6458 }, 0 },
+	/* 3842 */ { 0, 0x55, { 1, 1 }, { 6459, 6459 }, 0 },
+	/* 3843 */ { 0, 0x55, { 1, 1 }, { 6460, 6460 }, 0 },
+	/* 3844 */ { 0, 0x55, { 1, 1 }, { 6461, 6461 }, 0 },
+	/* 3845 */ { 0, 0x55, { 1, 1 }, { 6462, 6462 }, 0 },
+	/* 3846 */ { 0, 0x55, { 1, 1 }, { 6463, 6463 }, 0 },
+	/* 3847 */ { 0, 0x55, { 1, 1 }, { 6464, 6464 }, 0 },
+	/* 3848 */ { 0, 0x55, { 1, 1 }, { 6465, 6465 }, 0 },
+	/* 3849 */ { 0, 0x55, { 1, 1 }, { 6466, 6466 }, 0 },
+	/* 3850 */ { 0, 0x55, { 1, 1 }, { 6467, 6467 }, 0 },
+	/* 3851 */ { 0, 0x55, { 1, 1 }, { 6468, 6468 }, 0 },
+	/* 3852 */ { 0, 0x55, { 1, 1 }, { 6469, 6469 }, 0 },
+	/* 3853 */ { 0, 0x55, { 1, 1 }, { 6470, 6470 }, 0 },
+	/* 3854 */ { 0, 0x55, { 1, 1 }, { 6471, 6471 }, 0 },
+	/* 3855 */ { 0, 0x55, { 1, 1 }, { 6472, 6472 }, 0 },
+	/* 3856 */ { 0, 0x55, { 1, 1 }, { 6473, 6473 }, 0 },
+	/* 3857 */ { 0, 0x55, { 1, 1 }, { 6474, 6474 }, 0 },
+	/* 3858 */ { 0, 0x55, { 1, 1 }, { 6475, 6475 }, 0 },
+	/* 3859 */ { 0, 0x55, { 1, 1 }, { 6476, 6476 }, 0 },
+	/* 3860 */ { 0, 0x55, { 1, 1 }, { 6477, 6477 }, 0 },
+	/* 3861 */ { 0, 0x55, { 1, 1 }, { 6478, 6478 }, 0 },
+	/* 3862 */ { 0, 0x55, { 1, 1 }, { 6479, 6479 }, 0 },
+	/* 3863 */ { 0, 0x55, { 1, 1 }, { 6480, 6480 }, 0 },
+	/* 3864 */ { 0, 0x55, { 1, 1 }, { 6481, 6481 }, 0 },
+	/* 3865 */ { 0, 0x55, { 1, 1 }, { 6482, 6482 }, 0 },
+	/* 3866 */ { 0, 0x55, { 1, 1 }, { 6483, 6483 }, 0 },
+	/* 3867 */ { 0, 0x55, { 1, 1 }, { 6484, 6484 }, 0 },
+	/* 3868 */ { 0, 0x55, { 1, 1 }, { 6485, 6485 }, 0 },
+	/* 3869 */ { 0, 0x55, { 1, 1 }, { 6486, 6486 }, 0 },
+	/* 3870 */ { 0, 0x55, { 1, 1 }, { 6487, 6487 }, 0 },
+	/* 3871 */ { 0, 0x55, { 1, 1 }, { 6488, 6488 }, 0 },
+	/* 3872 */ { 0, 0x55, { 1, 1 }, { 6489, 6489 }, 0 },
+	/* 3873 */ { 0, 0x55, { 1, 1 }, { 6490, 6490 }, 0 },
+	/* 3874 */ { 0, 0x55, { 1, 1 }, { 6491, 6491 }, 0 },
+	/* 3875 */ { 0, 0x55, { 1, 1 }, { 6492, 6492 }, 0 },
+	/* 3876 */ { 0, 0x55, { 1, 1 }, { 6493, 6493 }, 0 },
+	/* 3877 */ { 0, 0x55, { 1, 1 }, { 6494, 6494 }, 0 },
+	/* 3878 */ { 0, 0x55, { 1, 1 }, { 6495, 6495 }, 0 },
+	/* 3879 */ { 0, 0x55, { 1, 1 }, { 6496, 6496 }, 0 },
+	/* 3880 */ { 0, 0x55, { 1, 1 }, { 6497, 6497 }, 0 },
+	/* 3881 */ { 0, 0x55, { 1, 1 }, { 6498, 6498 }, 0 },
+	/* 3882 */ { 0, 0x55, { 1, 1 }, { 6499, 6499 }, 0 },
+	/* 3883 */ { 0, 0x55, { 1, 1 }, { 6500, 6500 }, 0 },
+	/* 3884 */ { 0, 0x55, { 1, 1 }, { 6501, 6501 }, 0 },
+	/* 3885 */ { 0, 0x55, { 1, 1 }, { 6502, 6502 }, 0 },
+	/* 3886 */ { 0, 0x55, { 1, 1 }, { 6503, 6503 }, 0 },
+	/* 3887 */ { 0, 0x55, { 1, 1 }, { 6504, 6504 }, 0 },
+	/* 3888 */ { 0, 0x55, { 1, 1 }, { 6505, 6505 }, 0 },
+	/* 3889 */ { 0, 0x55, { 1, 1 }, { 6506, 6506 }, 0 },
+	/* 3890 */ { 0, 0x55, { 1, 1 }, { 6507, 6507 }, 0 },
+	/* 3891 */ { 0, 0x55, { 1, 1 }, { 6508, 6508 }, 0 },
+	/* 3892 */ { 0, 0x55, { 1, 1 }, { 6509, 6509 }, 0 },
+	/* 3893 */ { 0, 0x55, { 1, 1 }, { 6510, 6510 }, 0 },
+	/* 3894 */ { 0, 0x55, { 1, 1 }, { 6511, 6511 }, 0 },
+	/* 3895 */ { 0, 0x55, { 1, 1 }, { 6512, 6512 }, 0 },
+	/* 3896 */ { 0, 0x55, { 1, 1 }, { 6513, 6513 }, 0 },
+	/* 3897 */ { 0, 0x55, { 1, 1 }, { 6514, 6514 }, 0 },
+	/* 3898 */ { 0, 0x55, { 1, 1 }, { 6515, 6515 }, 0 },
+	/* 3899 */ { 0, 0x55, { 1, 1 }, { 6516, 6516 }, 0 },
+	/* 3900 */ { 0, 0x55, { 1, 1 }, { 6517, 6517 }, 0 },
+	/* 3901 */ { 0, 0x55, { 1, 1 }, { 6518, 6518 }, 0 },
+	/* 3902 */ { 0, 0x55, { 1, 1 }, { 6519, 6519 }, 0 },
+	/* 3903 */ { 0, 0x55, { 1, 1 }, { 6520, 6520 }, 0 },
+	/* 3904 */ { 0, 0x55, { 1, 1 }, { 6521, 6521 }, 0 },
+	/* 3905 */ { 0, 0x55, { 1, 1 }, { 6522, 6522 }, 0 },
+	/* 3906 */ { 0, 0x55, { 1, 1 }, { 6523, 6523 }, 0 },
+	/* 3907 */ { 0, 0x55, { 1, 1 }, { 6524, 6524 }, 0 },
+	/* 3908 */ { 0, 0x55, { 1, 1 }, { 6525, 6525 }, 0 },
+	/* 3909 */ { 0, 0x55, { 1, 1 }, { 6526, 6526 }, 0 },
+	/* 3910 */ { 0, 0x55, { 1, 1 }, { 6527, 6527 }, 0 },
+	/* 3911 */ { 0, 0x55, { 1, 1 }, { 6528, 6528 }, 0 },
+	/* 3912 */ { 0, 0x55, { 1, 1 }, { 6529, 6529 }, 0 },
+	/* 3913 */ { 0, 0x55, { 1, 1 }, { 6530, 6530 }, 0 },
+	/* 3914 */ { 0, 0x55, { 1, 1 }, { 6531, 6531 }, 0 },
+	/* 3915 */ { 0, 0x55, { 1, 1 }, { 6532, 6532 }, 0 },
+	/* 3916 */ { 0, 0x55, { 1, 1 }, { 6533, 6533 }, 0 },
+	/* 3917 */ { 0, 0x55, { 1, 1 }, { 6534, 6534 }, 0 },
+	/* 3918 */ { 0, 0x55, { 1, 1 }, { 6535, 6535 }, 0 },
+	/* 3919 */ { 0, 0x55, { 1, 1 }, { 6536, 6536 }, 0 },
+	/* 3920 */ { 0, 0x55, { 1, 1 }, { 6537, 6537 }, 0 },
+	/* 3921 */ { 0, 0x55, { 1, 1 }, { 6538, 6538 }, 0 },
+	/* 3922 */ { 0, 0x55, { 1, 1 }, { 6539, 6539 }, 0 },
+	/* 3923 */ { 0, 0x55, { 1, 1 }, { 6540, 6540 }, 0 },
+	/* 3924 */ { 0, 0x55, { 1, 1 }, { 6541, 6541 }, 0 },
+	/* 3925 */ { 0, 0x55, { 1, 1 }, { 6542, 6542 }, 0 },
+	/* 3926 */ { 0, 0x55, { 1, 1 }, { 2946, 2946 }, 0 },
+	/* 3927 */ { 0, 0x55, { 1, 1 }, { 6543, 6543 }, 0 },
+	/* 3928 */ { 0, 0x55, { 1, 1 }, { 6544, 6544 }, 0 },
+	/* 3929 */ { 0, 0x55, { 1, 1 }, { 6545, 6545 }, 0 },
+	/* 3930 */ { 0, 0x55, { 1, 1 }, { 6546, 6546 }, 0 },
+	/* 3931 */ { 0, 0x55, { 1, 1 }, { 6547, 6547 }, 0 },
+	/* 3932 */ { 0, 0x55, { 1, 1 }, { 6548, 6548 }, 0 },
+	/* 3933 */ { 0, 0x55, { 1, 1 }, { 6549, 6549 }, 0 },
+	/* 3934 */ { 0, 0x55, { 1, 1 }, { 6550, 6550 }, 0 },
+	/* 3935 */ { 0, 0x55, { 1, 1 }, { 6551, 6551 }, 0 },
+	/* 3936 */ { 0, 0x55, { 1, 1 }, { 6552, 6552 }, 0 },
+	/* 3937 */ { 0, 0x55, { 1, 1 }, { 6553, 6553 }, 0 },
+	/* 3938 */ { 0, 0x55, { 1, 1 }, { 2953, 2953 }, 0 },
+	/* 3939 */ { 0, 0x55, { 1, 1 }, { 6554, 6554 }, 0 },
+	/* 3940 */ { 0, 0x55, { 1, 1 }, { 6555, 6555 }, 0 },
+	/* 3941 */ { 0, 0x55, { 1, 1 }, { 6556, 6556 }, 0 },
+	/* 3942 */ { 0, 0x55, { 1, 1 }, { 6557, 6557 }, 0 },
+	/* 3943 */ { 0, 0x55, { 1, 1 }, { 6558, 6558 }, 0 },
+	/* 3944 */ { 0, 0x55, { 1, 1 }, { 6559, 6559 }, 0 },
+	/* 3945 */ { 0, 0x55, { 1, 1 }, { 6560, 6560 }, 0 },
+	/* 3946 */ { 0, 0x55, { 1, 1 }, { 6561, 6561 }, 0 },
+	/* 3947 */ { 0, 0x55, { 1, 1 }, { 6562, 6562 }, 0 },
+	/* 3948 */ { 0, 0x55, { 1, 1 }, { 6563, 6563 }, 0 },
+	/* 3949 */ { 0, 0x55, { 1, 1 }, { 6564, 6564 }, 0 },
+	/* 3950 */ { 0, 0x55, { 1, 1 }, { 6565, 6565 }, 0 },
+	/* 3951 */ { 0, 0x55, { 1, 1 }, { 6566, 6566 }, 0 },
+	/* 3952 */ { 0, 0x55, { 1, 1 }, { 6567, 6567 }, 0 },
+	/* 3953 */ { 0, 0x55, { 1, 1 }, { 6568, 6568 }, 0 },
+	/* 3954 */ { 0, 0x55, { 1, 1 }, { 6569, 6569 }, 0 },
+	/* 3955 */ { 0, 0x55, { 1, 1 }, { 6570, 6570 }, 0 },
+	/* 3956 */ { 0, 0x55, { 1, 1 }, { 6571, 6571 }, 0 },
+	/* 3957 */ { 0, 0x55, { 1, 1 }, { 6572, 6572 }, 0 },
+	/* 3958 */ { 0, 0x55, { 1, 1 }, { 6573, 6573 }, 0 },
+	/* 3959 */ { 0, 0x55, { 1, 1 }, { 6574, 6574 }, 0 },
+	/* 3960 */ { 0, 0x55, { 1, 1 }, { 6575, 6575 }, 0 },
+	/* 3961 */ { 0, 0x55, { 1, 1 }, { 6576, 6576 }, 0 },
+	/* 3962 */ { 0, 0x55, { 1, 1 }, { 6577, 6577 }, 0 },
+	/* 3963 */ { 0, 0x55, { 1, 1 }, { 6578, 6578 }, 0 },
+	/* 3964 */ { 0, 0x55, { 1, 1 }, { 6579, 6579 }, 0 },
+	/* 3965 */ { 0, 0x55, { 1, 1 }, { 6580, 6580 }, 0 },
+	/* 3966 */ { 0, 0x55, { 1, 1 }, { 6581, 6581 }, 0 },
+	/* 3967 */ { 0, 0x55, { 1, 1 }, { 6582, 6582 }, 0 },
+	/* 3968 */ { 0, 0x55, { 1, 1 }, { 6583, 6583 }, 0 },
+	/* 3969 */ { 0, 0x55, { 1, 1 }, { 6584, 6584 }, 0 },
+	/* 3970 */ { 0, 0x55, { 1, 1 }, { 6585, 6585 }, 0 },
+	/* 3971 */ { 0, 0x55, { 1, 1 }, { 6586, 6586 }, 0 },
+	/* 3972 */ { 0, 0x55, { 1, 1 }, { 6587, 6587 }, 0 },
+	/* 3973 */ { 0, 0x55, { 1, 1 }, { 6588, 6588 }, 0 },
+	/* 3974 */ { 0, 0x55, { 1, 1 }, { 6589, 6589 }, 0 },
+	/* 3975 */ { 0, 0x55, { 1, 1 }, { 6590, 6590 }, 0 },
+	/* 3976 */ { 0, 0x55, { 1, 1 }, { 6591, 6591 }, 0 },
+	/* 3977 */ { 0, 0x55, { 1, 1 }, { 6592, 6592 }, 0 },
+	/* 3978 */ { 0, 0x55, { 1, 1 }, { 6593, 6593 }, 0 },
+	/* 3979 */ { 0, 0x55, { 1, 1 }, { 6594, 6594 }, 0 },
+	/* 3980 */ { 0, 0x55, { 1, 1 }, { 6595, 6595 }, 0 },
+	/* 3981 */ { 0, 0x55, { 1, 1 }, { 6596, 6596 }, 0 },
+	/* 3982 */ { 0, 0x55, { 1, 1 }, { 6597, 6597 }, 0 },
+	/* 3983 */ { 0, 0x55, { 1, 1 }, { 6598, 6598 }, 0 },
+	/* 3984 */ { 0, 0x55, { 1, 1 }, { 6599, 6599 }, 0 },
+	/* 3985 */ { 0, 0x55, { 1, 1 }, { 6600, 6600 }, 0 },
+	/* 3986 */ { 0, 0x55, { 1, 1 }, { 6601, 6601 }, 0 },
+	/* 3987 */ { 0, 0x55, { 1, 1 }, { 6602, 6602 }, 0 },
+	/* 3988 */ { 0, 0x55, { 1, 1 }, { 6603, 6603 }, 0 },
+	/* 3989 */ { 0, 0x55, { 1, 1 }, { 6604, 6604 }, 0 },
+	/* 3990 */ { 0, 0x55, { 1, 1 }, { 6605, 6605 }, 0 },
+	/* 3991 */ { 0, 0x55, { 1, 1 }, { 6606, 6606 }, 0 },
+	/* 3992 */ { 0, 0x55, { 1, 1 }, { 6607, 6607 }, 0 },
+	/* 3993 */ { 0, 0x55, { 1, 1 }, { 6608, 6608 }, 0 },
+	/* 3994 */ { 0, 0x55, { 1, 1 }, { 6609, 6609 }, 0 },
+	/* 3995 */ { 0, 0x55, { 1, 1 }, { 6610, 6610 }, 0 },
+	/* 3996 */ { 0, 0x55, { 1, 1 }, { 6611, 6611 }, 0 },
+	/* 3997 */ { 0, 0x55, { 1, 1 }, { 6612, 6612 }, 0 },
+	/* 3998 */ { 0, 0x55, { 1, 1 }, { 6613, 6613 }, 0 },
+	/* 3999 */ { 0, 0x55, { 1, 1 }, { 6614, 6614 }, 0 },
+	/* 4000 */ { 0, 0x55, { 1, 1 }, { 6615, 6615 }, 0 },
+	/* 4001 */ { 0, 0x55, { 1, 1 }, { 3001, 3001 }, 0 },
+	/* 4002 */ { 0, 0x55, { 1, 1 }, { 6616, 6616 }, 0 },
+	/* 4003 */ { 0, 0x55, { 1, 1 }, { 3005, 3005 }, 0 },
+	/* 4004 */ { 0, 0x55, { 1, 1 }, { 6617, 6617 }, 0 },
+	/* 4005 */ { 0, 0x55, { 1, 1 }, { 6618, 6618 }, 0 },
+	/* 4006 */ { 0, 0x55, { 1, 1 }, { 6619, 6619 }, 0 },
+	/* 4007 */ { 0, 0x55, { 1, 1 }, { 6620, 6620 }, 0 },
+	/* 4008 */ { 0, 0x55, { 1, 1 }, { 3010, 3010 }, 0 },
+	/* 4009 */ { 0, 0x55, { 1, 1 }, { 6621, 6621 }, 0 },
+};
+
+static const uint16_t record_pages[][256] =
+{
+	{ /* 0 : 000000 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 0,
+		/* 40 */ 0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18,
+		/* 50 */ 19, 0, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+		/* 70 */ 44, 0, 45, 46, 47, 48, 49, 50, 51, 52, 53, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 54, 0, 0, 0, 0, 0, 0, 0, 55, 0, 56, 0, 0, 0, 0, 57,
+		/* B0 */ 0, 0, 58, 59, 60, 61, 0, 0, 62, 63, 64, 0, 65, 66, 67, 0,
+		/* C0 */ 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+		/* D0 */ 0, 84, 85, 86, 87, 88, 89, 0, 90, 91, 92, 93, 94, 95, 0, 0,
+		/* E0 */ 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+		/* F0 */ 0, 112, 113, 114, 115, 116, 117, 0, 118, 119, 120, 121, 122, 123, 0, 124,
+	},
+	{ /* 1 : 000100 */
+		/* 00 */ 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
+		/* 10 */ 0, 0, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154,
+		/* 20 */ 155, 156, 157, 158, 159, 160, 0, 0, 161, 162, 163, 164, 165, 166, 167, 168,
+		/* 30 */ 169, 0, 170, 171, 172, 173, 174, 175, 0, 176, 177, 178, 179, 180, 181, 182,
+		/* 40 */ 183, 0, 0, 184, 185, 186, 187, 188, 189, 190, 0, 0, 191, 192, 193, 194,
+		/* 50 */ 195, 196, 0, 0, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208,
+		/* 60 */ 209, 210, 211, 212, 213, 214, 0, 0, 215, 216, 217, 218, 219, 220, 221, 222,
+		/* 70 */ 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 239, 240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 241,
+		/* B0 */ 242, 0, 0, 0, 0, 0, 0, 243, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+		/* D0 */ 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 0, 269, 270,
+		/* E0 */ 271, 272, 273, 274, 0, 0, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284,
+		/* F0 */ 285, 286, 287, 288, 289, 290, 0, 0, 291, 292, 293, 294, 295, 296, 297, 298,
+	},
+	{ /* 2 : 000200 */
+		/* 00 */ 299, 300, 301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314,
+		/* 10 */ 315, 316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 0, 0, 327, 328,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 329, 330, 331, 332, 333, 334, 335, 336, 337, 338,
+		/* 30 */ 339, 340, 341, 342, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 343, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 344, 345, 346, 347, 348, 349, 350, 351, 352, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 353, 354, 355, 356, 357, 358, 0, 0,
+		/* E0 */ 359, 360, 361, 362, 363, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 3 : 000300 */
+		/* 00 */ 364, 364, 364, 364, 364, 365, 364, 364, 364, 364, 364, 364, 364, 365, 365, 364,
+		/* 10 */ 365, 364, 365, 364, 364, 366, 367, 367, 367, 367, 366, 368, 367, 367, 367, 367,
+		/* 20 */ 367, 369, 369, 370, 370, 370, 370, 371, 371, 367, 367, 367, 367, 370, 370, 367,
+		/* 30 */ 370, 370, 367, 367, 372, 372, 372, 372, 373, 367, 367, 367, 367, 365, 365, 365,
+		/* 40 */ 374, 375, 364, 376, 377, 378, 365, 367, 367, 367, 365, 365, 365, 367, 367, 0,
+		/* 50 */ 365, 365, 365, 367, 367, 367, 367, 365, 366, 367, 367, 365, 379, 380, 380, 379,
+		/* 60 */ 380, 380, 379, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+		/* 70 */ 0, 0, 0, 0, 381, 0, 0, 0, 0, 0, 382, 0, 0, 0, 383, 0,
+		/* 80 */ 0, 0, 0, 0, 60, 384, 385, 386, 387, 388, 389, 0, 390, 0, 391, 392,
+		/* 90 */ 393, 394, 0, 0, 0, 395, 0, 396, 0, 397, 0, 0, 0, 0, 0, 398,
+		/* A0 */ 0, 399, 0, 0, 0, 400, 0, 0, 0, 401, 402, 403, 404, 405, 406, 407,
+		/* B0 */ 408, 409, 0, 0, 0, 410, 0, 411, 0, 412, 0, 0, 0, 0, 0, 413,
+		/* C0 */ 0, 414, 0, 0, 0, 415, 0, 0, 0, 416, 417, 418, 419, 420, 421, 0,
+		/* D0 */ 422, 423, 424, 425, 426, 427, 428, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 429, 430, 431, 0, 432, 433, 0, 0, 0, 434, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 4 : 000400 */
+		/* 00 */ 435, 436, 0, 437, 0, 0, 438, 439, 0, 0, 0, 0, 440, 441, 442, 0,
+		/* 10 */ 443, 0, 0, 444, 0, 445, 446, 447, 448, 449, 450, 0, 0, 0, 451, 0,
+		/* 20 */ 0, 0, 0, 452, 0, 0, 0, 453, 0, 0, 0, 454, 0, 455, 0, 0,
+		/* 30 */ 456, 0, 0, 457, 0, 458, 459, 460, 461, 462, 463, 0, 0, 0, 464, 0,
+		/* 40 */ 0, 0, 0, 465, 0, 0, 0, 466, 0, 0, 0, 467, 0, 468, 0, 0,
+		/* 50 */ 469, 470, 0, 471, 0, 0, 472, 473, 0, 0, 0, 0, 474, 475, 476, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 477, 478, 479, 480, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 481, 482, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 483, 484, 485, 486, 0, 0, 487, 488, 489, 490, 491, 492, 493, 494, 495, 496,
+		/* E0 */ 0, 0, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510,
+		/* F0 */ 511, 512, 513, 514, 515, 516, 0, 0, 517, 518, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 5 : 000500 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 519, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 367, 365, 365, 365, 365, 367, 365, 365, 365, 520, 367, 365, 365, 365, 365,
+		/* A0 */ 365, 365, 367, 367, 367, 367, 367, 367, 365, 365, 367, 365, 365, 520, 521, 365,
+		/* B0 */ 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 531, 532, 533, 534, 0, 535,
+		/* C0 */ 0, 536, 537, 0, 365, 367, 0, 530, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 6 : 000600 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 365, 365, 365, 365, 365, 365, 365, 365, 538, 539, 540, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 541, 542, 543, 544, 545, 546, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 547, 0, 548, 549, 550, 551, 538, 539,
+		/* 50 */ 540, 552, 553, 364, 364, 370, 367, 365, 365, 365, 365, 365, 367, 365, 365, 367,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 554, 0, 0, 0, 0, 555, 556, 557, 558, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 559, 560, 561, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 562, 563, 0, 564, 365, 365, 365, 365, 365, 365, 365, 0, 0, 365,
+		/* E0 */ 365, 365, 365, 367, 365, 0, 0, 365, 365, 0, 367, 365, 365, 367, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 7 : 000700 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 565, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 365, 367, 365, 365, 367, 365, 365, 367, 367, 367, 365, 367, 367, 365, 367, 365,
+		/* 40 */ 365, 365, 367, 365, 367, 365, 367, 365, 367, 365, 365, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365,
+		/* F0 */ 365, 365, 367, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0,
+	},
+	{ /* 8 : 000800 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 0, 365, 365, 365, 365, 365,
+		/* 20 */ 365, 365, 365, 365, 0, 365, 365, 365, 0, 365, 365, 365, 365, 365, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 367, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 367, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+		/* E0 */ 365, 365, 0, 367, 365, 365, 367, 365, 365, 367, 365, 365, 365, 367, 367, 367,
+		/* F0 */ 549, 550, 551, 365, 365, 365, 367, 365, 365, 367, 367, 365, 365, 365, 365, 365,
+	},
+	{ /* 9 : 000900 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 566, 567, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 568, 569, 0, 570, 571, 0, 0, 0, 0, 0, 0, 0, 572, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0,
+		/* 50 */ 0, 365, 367, 365, 365, 0, 0, 0, 574, 575, 576, 577, 578, 579, 580, 581,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 583, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 584, 0, 0, 0, 585, 586, 573, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 587, 588, 0, 589,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0,
+	},
+	{ /* 10 : 000A00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 590, 0, 0, 591, 0, 0, 0, 0, 0, 582, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 592, 593, 594, 0, 0, 595, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 11 : 000B00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 583, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 596, 597, 0, 0, 598, 599, 573, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 583, 583, 0, 0, 0, 0, 600, 601, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 602, 0, 603, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 604, 605, 0, 0, 606, 607, 608, 573, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 12 : 000C00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 609, 0, 610, 0, 0, 0, 0, 573, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 611, 612, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 613,
+		/* C0 */ 614, 0, 583, 0, 0, 0, 615, 616, 617, 0, 618, 619, 0, 573, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 583, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 13 : 000D00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 573, 0, 583, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 620, 621, 0, 0, 622, 623, 624, 573, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 625, 0, 0, 0, 0, 583,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 626, 627, 0, 628, 629, 630, 583,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 14 : 000E00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 631, 0, 0, 0, 0, 632, 632, 573, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 633, 633, 633, 633, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 634, 0, 0, 0, 0, 635, 635, 573, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 636, 636, 636, 636, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 637, 638, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 15 : 000F00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 639, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 367, 0, 367, 0, 640, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 641, 0, 0, 0, 0, 0, 0, 0, 0, 0, 642, 0, 0,
+		/* 50 */ 0, 0, 643, 0, 0, 0, 0, 644, 0, 0, 0, 0, 645, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 646, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 647, 648, 649, 650, 651, 652, 653, 654, 655, 648, 648, 648, 648, 0, 0,
+		/* 80 */ 648, 656, 365, 365, 573, 0, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 657, 0, 0, 0, 0, 0, 0, 0, 0, 0, 658, 0, 0,
+		/* A0 */ 0, 0, 659, 0, 0, 0, 0, 660, 0, 0, 0, 0, 661, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 662, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 16 : 001000 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 663, 664, 0, 0, 0, 0, 0, 0, 0, 583, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 582, 0, 573, 573, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 665, 0, 0, 0,
+	},
+	{ /* 17 : 001100 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 70 */ 583, 583, 583, 583, 583, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* B0 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* C0 */ 583, 583, 583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 18 : 001200 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 19 : 001300 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 20 : 001700 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 21 : 001800 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 521, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 22 : 001900 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 520, 365, 367, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 23 : 001A00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 365, 367, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 365, 365, 0, 0, 367,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 365, 365, 365, 365, 365, 367, 367, 367, 367, 367, 367, 365, 365, 367, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 24 : 001B00 */
+		/* 00 */ 0, 0, 0, 0, 0, 666, 667, 668, 669, 670, 671, 672, 673, 674, 675, 0,
+		/* 10 */ 0, 676, 677, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 582, 583, 0, 0, 0, 0, 678, 679, 680, 681, 682, 683,
+		/* 40 */ 684, 685, 686, 687, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 367, 365, 365, 365,
+		/* 70 */ 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 573, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 25 : 001C00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 365, 365, 365, 0, 372, 367, 367, 367, 367, 367, 365, 365, 367, 367, 367, 367,
+		/* E0 */ 365, 0, 372, 372, 372, 372, 372, 372, 372, 0, 0, 0, 0, 367, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 365, 0, 0, 0, 365, 365, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 26 : 001D00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 688, 689, 690, 0,
+		/* 30 */ 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 0, 702, 703, 704, 705,
+		/* 40 */ 706, 707, 708, 56, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 0, 719,
+		/* 50 */ 720, 721, 64, 722, 723, 724, 725, 726, 727, 728, 729, 730, 731, 422, 732, 733,
+		/* 60 */ 427, 734, 735, 347, 727, 730, 422, 732, 430, 427, 734, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 736, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 737, 738, 739, 740, 717,
+		/* A0 */ 741, 742, 743, 744, 745, 746, 747, 748, 749, 750, 751, 752, 753, 754, 755, 756,
+		/* B0 */ 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 423,
+		/* C0 */ 365, 365, 367, 365, 365, 365, 365, 365, 365, 365, 367, 365, 365, 380, 772, 367,
+		/* D0 */ 369, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+		/* E0 */ 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+		/* F0 */ 365, 365, 365, 365, 365, 365, 366, 521, 521, 367, 0, 365, 379, 367, 365, 367,
+	},
+	{ /* 27 : 001E00 */
+		/* 00 */ 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788,
+		/* 10 */ 789, 790, 791, 792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804,
+		/* 20 */ 805, 806, 807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820,
+		/* 30 */ 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836,
+		/* 40 */ 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852,
+		/* 50 */ 853, 854, 855, 856, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868,
+		/* 60 */ 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 883, 884,
+		/* 70 */ 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896, 897, 898, 899, 900,
+		/* 80 */ 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912, 913, 914, 915, 916,
+		/* 90 */ 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 0, 0, 0, 0,
+		/* A0 */ 929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944,
+		/* B0 */ 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960,
+		/* C0 */ 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976,
+		/* D0 */ 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992,
+		/* E0 */ 993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008,
+		/* F0 */ 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 28 : 001F00 */
+		/* 00 */ 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034,
+		/* 10 */ 1035, 1036, 1037, 1038, 1039, 1040, 0, 0, 1041, 1042, 1043, 1044, 1045, 1046, 0, 0,
+		/* 20 */ 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062,
+		/* 30 */ 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078,
+		/* 40 */ 1079, 1080, 1081, 1082, 1083, 1084, 0, 0, 1085, 1086, 1087, 1088, 1089, 1090, 0, 0,
+		/* 50 */ 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 0, 1099, 0, 1100, 0, 1101, 0, 1102,
+		/* 60 */ 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118,
+		/* 70 */ 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 0, 0,
+		/* 80 */ 1133, 1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148,
+		/* 90 */ 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
+		/* A0 */ 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180,
+		/* B0 */ 1181, 1182, 1183, 1184, 1185, 0, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
+		/* C0 */ 1196, 1197, 1198, 1199, 1200, 0, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210,
+		/* D0 */ 1211, 1212, 1213, 1214, 0, 0, 1215, 1216, 1217, 1218, 1219, 1220, 0, 1221, 1222, 1223,
+		/* E0 */ 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239,
+		/* F0 */ 0, 0, 1240, 1241, 1242, 0, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 0,
+	},
+	{ /* 29 : 002000 */
+		/* 00 */ 1252, 1253, 54, 54, 54, 54, 54, 54, 54, 54, 54, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 1254, 0, 0, 0, 0, 0, 1255, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 1256, 1257, 1258, 0, 0, 0, 0, 0, 0, 0, 0, 54,
+		/* 30 */ 0, 0, 0, 1259, 1260, 0, 1261, 1262, 0, 0, 0, 0, 1263, 0, 1264, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 1265, 1266, 1267, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 1268, 0, 0, 0, 0, 0, 0, 0, 54,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 1269, 735, 0, 0, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281,
+		/* 80 */ 1269, 63, 58, 59, 1270, 1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 0,
+		/* 90 */ 56, 714, 64, 362, 715, 344, 719, 360, 720, 1281, 725, 361, 726, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 1282, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 365, 365, 372, 372, 365, 365, 365, 365, 372, 372, 372, 365, 365, 0, 0, 0,
+		/* E0 */ 0, 365, 0, 0, 0, 372, 372, 365, 367, 365, 372, 372, 367, 367, 367, 367,
+		/* F0 */ 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 30 : 002100 */
+		/* 00 */ 1283, 1284, 1285, 1286, 0, 1287, 1288, 1289, 0, 1290, 718, 695, 695, 695, 344, 1291,
+		/* 10 */ 696, 696, 699, 360, 0, 701, 1292, 0, 0, 704, 1293, 705, 705, 705, 0, 0,
+		/* 20 */ 1294, 1295, 1296, 0, 1297, 0, 1298, 0, 1297, 0, 1299, 1300, 690, 1285, 0, 714,
+		/* 30 */ 692, 1301, 0, 700, 64, 1302, 1303, 1304, 1305, 735, 0, 1306, 428, 732, 1307, 1308,
+		/* 40 */ 1309, 0, 0, 0, 0, 691, 713, 714, 735, 346, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
+		/* 60 */ 696, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 699, 1285, 691, 700,
+		/* 70 */ 735, 1337, 1338, 1339, 730, 1340, 1341, 1342, 1343, 362, 1344, 1345, 360, 738, 713, 720,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 1346, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 1347, 0, 1348, 0, 1349, 0, 0, 0, 0, 0, 1350, 1351, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1352, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1353, 1354, 1355,
+		/* D0 */ 1356, 0, 1357, 0, 1358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 31 : 002200 */
+		/* 00 */ 0, 0, 0, 1359, 1360, 0, 0, 0, 1361, 1362, 0, 1363, 1364, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 1365, 1366, 1367, 1368, 0, 0, 0, 0, 0, 1369, 1370, 0, 1371,
+		/* 30 */ 1372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1373, 0, 0, 0,
+		/* 40 */ 0, 1374, 0, 1375, 1376, 1377, 0, 1378, 1379, 1380, 0, 0, 0, 1381, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 1382, 1383, 1384, 0, 1385, 1386, 0, 0, 0, 0, 0, 0, 0, 1387, 1388, 1389,
+		/* 70 */ 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 0, 0,
+		/* 80 */ 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 1414, 1415, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 1416, 0, 0, 0, 0, 0, 1417, 1418, 0, 1419, 1420, 1421, 1422, 1423,
+		/* B0 */ 0, 0, 1424, 1425, 1426, 1427, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 1428, 1429, 1430, 1431, 0, 0, 0, 0, 0, 0, 1432, 1433, 1434, 1435, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 32 : 002300 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 1436, 1437, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 33 : 002400 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 63, 58, 59, 1270, 1271, 1272, 1273, 1274, 1275, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
+		/* 70 */ 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460,
+		/* 80 */ 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476,
+		/* 90 */ 1477, 1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492,
+		/* A0 */ 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508,
+		/* B0 */ 1509, 1510, 1511, 1512, 1513, 1514, 688, 690, 1285, 691, 692, 1301, 694, 695, 696, 697,
+		/* C0 */ 698, 699, 700, 701, 702, 704, 1293, 705, 1515, 706, 707, 1329, 708, 1334, 1516, 1297,
+		/* D0 */ 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1281, 64, 725,
+		/* E0 */ 1517, 347, 361, 726, 727, 730, 351, 362, 352, 768, 1269, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 34 : 002A00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1518, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 1519, 1520, 1521, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1522, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 35 : 002C00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 346, 1329, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365,
+		/* F0 */ 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 36 : 002D00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1523,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+		/* F0 */ 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+	},
+	{ /* 37 : 002E00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1524,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 1525, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 38 : 002F00 */
+		/* 00 */ 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1533, 1534, 1535, 1536, 1537, 1538, 1539, 1540, 1541,
+		/* 10 */ 1542, 1543, 1544, 1545, 1546, 1547, 1548, 1549, 1550, 1551, 1552, 1553, 1554, 1555, 1556, 1557,
+		/* 20 */ 1558, 1559, 1560, 1561, 1562, 1563, 1564, 1565, 1566, 1567, 1568, 1569, 1570, 1571, 1572, 1573,
+		/* 30 */ 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583, 1584, 1585, 1586, 1587, 1588, 1589,
+		/* 40 */ 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599, 1600, 1601, 1602, 1603, 1604, 1605,
+		/* 50 */ 1606, 1607, 1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617, 1618, 1619, 1620, 1621,
+		/* 60 */ 1622, 1623, 1624, 1625, 1626, 1627, 1628, 1629, 1630, 1631, 1632, 1633, 1634, 1635, 1636, 1637,
+		/* 70 */ 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652, 1653,
+		/* 80 */ 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663, 1664, 1665, 1666, 1667, 1668, 1669,
+		/* 90 */ 1670, 1671, 1672, 1673, 1674, 1675, 1676, 1677, 1678, 1679, 1680, 1681, 1682, 1683, 1684, 1685,
+		/* A0 */ 1686, 1687, 1688, 1689, 1690, 1691, 1692, 1693, 1694, 1695, 1696, 1697, 1698, 1699, 1700, 1701,
+		/* B0 */ 1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1713, 1714, 1715, 1716, 1717,
+		/* C0 */ 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733,
+		/* D0 */ 1734, 1735, 1736, 1737, 1738, 1739, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 39 : 003000 */
+		/* 00 */ 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1740, 521, 366, 520, 1741, 1741,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 1742, 0, 1549, 1743, 1744, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 1745, 0, 0, 0, 0, 1746, 1747, 1748, 1749, 1750,
+		/* 50 */ 1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766,
+		/* 60 */ 1767, 1768, 1769, 0, 1770, 1771, 1772, 1773, 1774, 1775, 0, 0, 0, 0, 0, 1776,
+		/* 70 */ 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 1791, 0, 0, 0, 0, 1792, 1792, 1793, 1794, 1795, 1796, 1797,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 1798, 0, 0, 0, 0, 1799, 1800, 1801, 1802, 1803,
+		/* B0 */ 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813, 1814, 1815, 1816, 1817, 1818, 1819,
+		/* C0 */ 1820, 1821, 1822, 0, 1823, 1824, 1825, 1826, 1827, 1828, 0, 0, 0, 0, 0, 1829,
+		/* D0 */ 1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1844,
+		/* F0 */ 1845, 1846, 1847, 0, 1848, 0, 0, 1849, 1850, 1851, 1852, 0, 0, 1853, 1854, 1855,
+	},
+	{ /* 40 : 003100 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870,
+		/* 40 */ 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886,
+		/* 50 */ 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902,
+		/* 60 */ 1903, 1904, 1905, 1906, 1907, 1908, 1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918,
+		/* 70 */ 1919, 1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
+		/* 80 */ 1935, 1936, 1937, 1938, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 0,
+		/* 90 */ 0, 0, 1526, 1532, 1950, 1951, 1952, 1953, 1954, 1955, 1530, 1956, 1957, 1958, 1959, 1534,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 41 : 003200 */
+		/* 00 */ 1960, 1961, 1962, 1963, 1964, 1965, 1966, 1967, 1968, 1969, 1970, 1971, 1972, 1973, 1974, 1975,
+		/* 10 */ 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1986, 1987, 1988, 1989, 1990, 0,
+		/* 20 */ 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003, 2004, 2005, 2006,
+		/* 30 */ 2007, 2008, 2009, 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019, 2020, 2021, 2022,
+		/* 40 */ 2023, 2024, 2025, 2026, 2027, 2028, 1592, 2029, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 2030, 2031, 2032, 2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045,
+		/* 60 */ 1856, 1859, 1862, 1864, 1872, 1873, 1876, 1878, 1879, 1881, 1882, 1883, 1884, 1885, 2046, 2047,
+		/* 70 */ 2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 0,
+		/* 80 */ 1526, 1532, 1950, 1951, 2063, 2064, 2065, 1537, 2066, 1549, 1599, 1611, 1610, 1600, 1692, 1557,
+		/* 90 */ 1597, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 2075, 2076, 1563, 2077, 2078, 2079, 2080,
+		/* A0 */ 2081, 2082, 2083, 2084, 1952, 1953, 1954, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093,
+		/* B0 */ 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109,
+		/* C0 */ 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122, 2123, 2124, 2125,
+		/* D0 */ 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140, 2141,
+		/* E0 */ 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156, 2157,
+		/* F0 */ 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 2170, 2171, 2172, 0,
+	},
+	{ /* 42 : 003300 */
+		/* 00 */ 2173, 2174, 2175, 2176, 2177, 2178, 2179, 2180, 2181, 2182, 2183, 2184, 2185, 2186, 2187, 2188,
+		/* 10 */ 2189, 2190, 2191, 2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204,
+		/* 20 */ 2205, 2206, 2207, 2208, 2209, 2210, 2211, 2212, 2213, 2214, 2215, 2216, 2217, 2218, 2219, 2220,
+		/* 30 */ 2221, 2222, 2223, 2224, 2225, 2226, 2227, 2228, 2229, 2230, 2231, 2232, 2233, 2234, 2235, 2236,
+		/* 40 */ 2237, 2238, 2239, 2240, 2241, 2242, 2243, 2244, 2245, 2246, 2247, 2248, 2249, 2250, 2251, 2252,
+		/* 50 */ 2253, 2254, 2255, 2256, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268,
+		/* 60 */ 2269, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284,
+		/* 70 */ 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 2296, 2297, 2298, 2299, 2300,
+		/* 80 */ 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313, 2314, 2315, 2316,
+		/* 90 */ 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332,
+		/* A0 */ 2333, 2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348,
+		/* B0 */ 2349, 2350, 2351, 2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364,
+		/* C0 */ 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380,
+		/* D0 */ 2381, 2382, 2383, 2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396,
+		/* E0 */ 2397, 2398, 2399, 2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412,
+		/* F0 */ 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423, 2424, 2425, 2426, 2427, 2428,
+	},
+	{ /* 43 : 00A600 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365,
+		/* 70 */ 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2429, 2430, 365, 365,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 44 : 00A700 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 2431, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 2432, 2433, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 45 : 00A800 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365, 365,
+		/* F0 */ 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 46 : 00A900 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 367, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 47 : 00AA00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 365, 0, 365, 365, 367, 0, 0, 365, 365, 0, 0, 0, 0, 0, 365, 365,
+		/* C0 */ 0, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 48 : 00AB00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2434, 2435, 2436, 2437,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 49 : 00AC00 */
+		/* 00 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 10 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 20 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 30 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 40 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 50 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 60 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 70 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 80 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 90 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* A0 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* B0 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* C0 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* D0 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* E0 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* F0 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+	},
+	{ /* 50 : 00D700 */
+		/* 00 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 10 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 20 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 30 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 40 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 50 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 60 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 70 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 80 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* 90 */ 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438, 2438,
+		/* A0 */ 2438, 2438, 2438, 2438, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 51 : 00F900 */
+		/* 00 */ 2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453,
+		/* 10 */ 2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463, 2464, 2465, 2466, 2467, 2468, 2469,
+		/* 20 */ 2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485,
+		/* 30 */ 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501,
+		/* 40 */ 2502, 2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517,
+		/* 50 */ 2518, 2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2458, 2530, 2531, 2532,
+		/* 60 */ 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543, 2544, 2545, 2546, 2547, 2548,
+		/* 70 */ 2549, 2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564,
+		/* 80 */ 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580,
+		/* 90 */ 2581, 2582, 2583, 2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593, 2594, 2595, 2596,
+		/* A0 */ 2597, 2548, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2532, 2606, 2607, 2608, 2609, 2610,
+		/* B0 */ 2611, 2612, 2613, 2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623, 2624, 2625, 2458,
+		/* C0 */ 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641,
+		/* D0 */ 2642, 2643, 2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2534, 2653, 2654, 2655, 2656,
+		/* E0 */ 2657, 2658, 2659, 2660, 2661, 2662, 2663, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672,
+		/* F0 */ 2673, 2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2686, 2687, 2688,
+	},
+	{ /* 52 : 00FA00 */
+		/* 00 */ 2689, 2690, 2691, 2692, 2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 0, 0,
+		/* 10 */ 2703, 0, 2704, 0, 0, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713, 2714, 0,
+		/* 20 */ 2715, 0, 2716, 0, 0, 2717, 2718, 0, 0, 0, 2719, 2720, 2721, 2722, 2723, 2724,
+		/* 30 */ 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733, 2734, 2735, 2736, 2737, 2738, 2739, 2740,
+		/* 40 */ 2741, 2742, 2743, 2744, 2745, 2746, 2747, 2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2756,
+		/* 50 */ 2757, 2758, 2759, 2760, 2761, 2762, 2763, 2587, 2764, 2765, 2766, 2767, 2768, 2769, 2769, 2770,
+		/* 60 */ 2771, 2772, 2773, 2774, 2775, 2776, 2777, 2717, 2778, 2779, 2780, 2781, 2782, 2783, 0, 0,
+		/* 70 */ 2784, 2785, 2786, 2787, 2788, 2789, 2790, 2791, 2731, 2792, 2793, 2794, 2703, 2795, 2796, 2797,
+		/* 80 */ 2798, 2799, 2800, 2801, 2802, 2803, 2804, 2805, 2806, 2740, 2807, 2741, 2808, 2809, 2810, 2811,
+		/* 90 */ 2812, 2704, 2479, 2813, 2814, 2815, 2549, 2636, 2816, 2817, 2748, 2818, 2749, 2819, 2820, 2821,
+		/* A0 */ 2706, 2822, 2823, 2824, 2825, 2826, 2707, 2827, 2828, 2829, 2830, 2831, 2832, 2763, 2833, 2834,
+		/* B0 */ 2587, 2835, 2767, 2836, 2837, 2838, 2839, 2840, 2772, 2841, 2716, 2842, 2773, 2530, 2843, 2774,
+		/* C0 */ 2844, 2776, 2845, 2846, 2847, 2848, 2849, 2778, 2712, 2850, 2779, 2851, 2780, 2852, 2446, 2853,
+		/* D0 */ 2854, 2855, 2856, 2857, 2858, 2859, 2860, 2861, 2862, 2863, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 53 : 00FB00 */
+		/* 00 */ 2864, 2865, 2866, 2867, 2868, 2869, 2869, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 2870, 2871, 2872, 2873, 2874, 0, 0, 0, 0, 0, 2875, 2876, 2877,
+		/* 20 */ 2878, 1302, 1305, 2879, 2880, 2881, 2882, 2883, 2884, 1276, 2885, 2886, 2887, 2888, 2889, 2890,
+		/* 30 */ 2891, 2892, 2893, 2894, 2895, 2896, 2897, 0, 2898, 2899, 2900, 2901, 2902, 0, 2903, 0,
+		/* 40 */ 2904, 2905, 0, 2906, 2907, 0, 2908, 2909, 2910, 2911, 2912, 2913, 2914, 2915, 2916, 2917,
+		/* 50 */ 2918, 2918, 2919, 2919, 2919, 2919, 2920, 2920, 2920, 2920, 2921, 2921, 2921, 2921, 2922, 2922,
+		/* 60 */ 2922, 2922, 2923, 2923, 2923, 2923, 2924, 2924, 2924, 2924, 2925, 2925, 2925, 2925, 2926, 2926,
+		/* 70 */ 2926, 2926, 2927, 2927, 2927, 2927, 2928, 2928, 2928, 2928, 2929, 2929, 2929, 2929, 2930, 2930,
+		/* 80 */ 2930, 2930, 2931, 2931, 2932, 2932, 2933, 2933, 2934, 2934, 2935, 2935, 2936, 2936, 2937, 2937,
+		/* 90 */ 2937, 2937, 2938, 2938, 2938, 2938, 2939, 2939, 2939, 2939, 2940, 2940, 2940, 2940, 2941, 2941,
+		/* A0 */ 2942, 2942, 2942, 2942, 2943, 2943, 2944, 2944, 2944, 2944, 2945, 2945, 2945, 2945, 2946, 2946,
+		/* B0 */ 2947, 2947, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 2948, 2948, 2948, 2948, 2949, 2949, 2950, 2950, 2951, 2951, 557, 2952, 2952,
+		/* E0 */ 2953, 2953, 2954, 2954, 2955, 2955, 2955, 2955, 2956, 2956, 2957, 2957, 2958, 2958, 2959, 2959,
+		/* F0 */ 2960, 2960, 2961, 2961, 2962, 2962, 2963, 2963, 2963, 2964, 2964, 2964, 2965, 2965, 2965, 2965,
+	},
+	{ /* 54 : 00FC00 */
+		/* 00 */ 2966, 2967, 2968, 2964, 2969, 2970, 2971, 2972, 2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980,
+		/* 10 */ 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996,
+		/* 20 */ 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012,
+		/* 30 */ 3013, 3014, 3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028,
+		/* 40 */ 3029, 3030, 3031, 3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044,
+		/* 50 */ 3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060,
+		/* 60 */ 3061, 3062, 3063, 3064, 3065, 3066, 2968, 3067, 2964, 2969, 3068, 3069, 2973, 3070, 2974, 2975,
+		/* 70 */ 3071, 3072, 2979, 3073, 2980, 2981, 3074, 3075, 2983, 3076, 2984, 2985, 3014, 3015, 3018, 3019,
+		/* 80 */ 3020, 3024, 3025, 3026, 3027, 3031, 3032, 3033, 3077, 3037, 3078, 3079, 3043, 3080, 3044, 3045,
+		/* 90 */ 3058, 3081, 3082, 3053, 3083, 3054, 3055, 2966, 2967, 3084, 2968, 3085, 2970, 2971, 2972, 2973,
+		/* A0 */ 3086, 2976, 2977, 2978, 2979, 3087, 2983, 2986, 2987, 2988, 2989, 2990, 2992, 2993, 2994, 2995,
+		/* B0 */ 2996, 2997, 3088, 2998, 2999, 3000, 3001, 3002, 3003, 3005, 3006, 3007, 3008, 3009, 3010, 3011,
+		/* C0 */ 3012, 3013, 3016, 3017, 3021, 3022, 3023, 3024, 3025, 3028, 3029, 3030, 3031, 3089, 3034, 3035,
+		/* D0 */ 3036, 3037, 3040, 3041, 3042, 3043, 3090, 3046, 3047, 3091, 3050, 3051, 3052, 3053, 3092, 2968,
+		/* E0 */ 3085, 2973, 3086, 2979, 3087, 2983, 3093, 2996, 3094, 3095, 3096, 3024, 3025, 3031, 3043, 3090,
+		/* F0 */ 3053, 3092, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110,
+	},
+	{ /* 55 : 00FD00 */
+		/* 00 */ 3111, 3112, 3113, 3114, 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3095, 3123, 3124, 3125,
+		/* 10 */ 3126, 3100, 3101, 3102, 3103, 3104, 3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114,
+		/* 20 */ 3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3095, 3123, 3124, 3125, 3126, 3120, 3121, 3122,
+		/* 30 */ 3095, 3094, 3096, 3004, 2993, 2994, 2995, 3120, 3121, 3122, 3004, 3005, 3127, 3127, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 3128, 3129, 3129, 3130, 3131, 3132, 3133, 3134, 3135, 3135, 3136, 3137, 3138, 3139, 3140, 3141,
+		/* 60 */ 3141, 3142, 3143, 3143, 3144, 3144, 3145, 3146, 3146, 3147, 3148, 3148, 3149, 3149, 3150, 3151,
+		/* 70 */ 3151, 3152, 3152, 3153, 3154, 3155, 3156, 3156, 3157, 3158, 3159, 3160, 3161, 3161, 3162, 3163,
+		/* 80 */ 3164, 3165, 3166, 3167, 3167, 3168, 3168, 3169, 3169, 3170, 3171, 3172, 3173, 3174, 3175, 3176,
+		/* 90 */ 0, 0, 3177, 3178, 3179, 3180, 3181, 3182, 3182, 3183, 3184, 3185, 3186, 3186, 3187, 3188,
+		/* A0 */ 3189, 3190, 3191, 3192, 3193, 3194, 3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204,
+		/* B0 */ 3205, 3206, 3207, 3208, 3162, 3164, 3209, 3210, 3211, 3212, 3213, 3214, 3213, 3211, 3215, 3216,
+		/* C0 */ 3217, 3218, 3219, 3214, 3155, 3145, 3220, 3221, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 3222, 3223, 3224, 3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234, 0, 0, 0,
+	},
+	{ /* 56 : 00FE00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 1258, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 365, 365, 365, 365, 365, 365, 365, 367, 367, 367, 367, 367, 367, 367, 365, 365,
+		/* 30 */ 1257, 3244, 3245, 3246, 3246, 1279, 1280, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254, 3255,
+		/* 40 */ 3256, 3257, 3258, 3259, 3260, 0, 0, 3261, 3262, 1264, 1264, 1264, 1264, 3246, 3246, 3246,
+		/* 50 */ 3235, 3236, 1256, 0, 3239, 3238, 3241, 3240, 3244, 1279, 1280, 3247, 3248, 3249, 3250, 3263,
+		/* 60 */ 3264, 3265, 1276, 3266, 3267, 3268, 1278, 0, 3269, 3270, 3271, 3272, 0, 0, 0, 0,
+		/* 70 */ 3273, 3274, 3275, 0, 3276, 0, 3277, 3278, 3279, 3280, 3281, 3282, 3283, 3284, 3285, 3286,
+		/* 80 */ 3287, 3288, 3288, 3289, 3289, 3290, 3290, 3291, 3291, 3292, 3292, 3292, 3292, 3293, 3293, 3294,
+		/* 90 */ 3294, 3294, 3294, 3295, 3295, 3296, 3296, 3296, 3296, 3297, 3297, 3297, 3297, 3298, 3298, 3298,
+		/* A0 */ 3298, 3299, 3299, 3299, 3299, 3300, 3300, 3300, 3300, 3301, 3301, 3302, 3302, 3303, 3303, 3304,
+		/* B0 */ 3304, 3305, 3305, 3305, 3305, 3306, 3306, 3306, 3306, 3307, 3307, 3307, 3307, 3308, 3308, 3308,
+		/* C0 */ 3308, 3309, 3309, 3309, 3309, 3310, 3310, 3310, 3310, 3311, 3311, 3311, 3311, 3312, 3312, 3312,
+		/* D0 */ 3312, 3313, 3313, 3313, 3313, 3314, 3314, 3314, 3314, 3315, 3315, 3315, 3315, 3316, 3316, 3316,
+		/* E0 */ 3316, 3317, 3317, 3317, 3317, 3318, 3318, 3318, 3318, 3319, 3319, 3319, 3319, 3320, 3320, 2956,
+		/* F0 */ 2956, 3321, 3321, 3321, 3321, 3322, 3322, 3323, 3323, 3324, 3324, 3325, 3325, 0, 0, 0,
+	},
+	{ /* 57 : 00FF00 */
+		/* 00 */ 0, 3240, 3326, 3263, 3270, 3271, 3264, 3327, 1279, 1280, 3265, 1276, 3235, 3266, 1256, 3328,
+		/* 10 */ 1269, 63, 58, 59, 1270, 1271, 1272, 1273, 1274, 1275, 3238, 3239, 3267, 1278, 3268, 3241,
+		/* 20 */ 3272, 688, 690, 1285, 691, 692, 1301, 694, 695, 696, 697, 698, 699, 700, 701, 702,
+		/* 30 */ 704, 1293, 705, 1515, 706, 707, 1329, 708, 1334, 1516, 1297, 3261, 3269, 3262, 3329, 3246,
+		/* 40 */ 3330, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1281, 64,
+		/* 50 */ 725, 1517, 347, 361, 726, 727, 730, 351, 362, 352, 768, 3247, 3331, 3248, 3332, 3333,
+		/* 60 */ 3334, 3237, 3257, 3258, 3236, 3335, 2172, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344,
+		/* 70 */ 3345, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2140,
+		/* 80 */ 2141, 2142, 2143, 2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2152, 2153, 2154, 2155, 2156,
+		/* 90 */ 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2167, 2168, 2169, 3346, 3347, 3348,
+		/* A0 */ 1907, 1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870,
+		/* B0 */ 1871, 1872, 1873, 1874, 1875, 1876, 1877, 1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 0,
+		/* C0 */ 0, 0, 1886, 1887, 1888, 1889, 1890, 1891, 0, 0, 1892, 1893, 1894, 1895, 1896, 1897,
+		/* D0 */ 0, 0, 1898, 1899, 1900, 1901, 1902, 1903, 0, 0, 1904, 1905, 1906, 0, 0, 0,
+		/* E0 */ 3349, 3350, 3351, 57, 3352, 3353, 3354, 0, 3355, 3356, 3357, 3358, 3359, 3360, 3361, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 58 : 010100 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 0,
+	},
+	{ /* 59 : 010200 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 60 : 010300 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 61 : 010A00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 367, 0, 365,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 365, 372, 367, 0, 0, 0, 0, 573,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 365, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 62 : 010D00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 63 : 010F00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 367, 367, 365, 365, 365, 367, 365, 367, 367, 367,
+		/* 50 */ 367, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 64 : 011000 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 3362, 3363, 3364, 3365, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 3366, 0, 0, 0, 0, 0, 3367, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 572, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 65 : 011100 */
+		/* 00 */ 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 3368, 3369,
+		/* 30 */ 0, 3370, 3371, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 66 : 011200 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 573, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 573, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 67 : 011300 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 582, 582, 0, 583, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 3372, 0, 0, 0, 3373, 3374, 573, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 583, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 365, 0, 0, 0,
+		/* 70 */ 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 68 : 011400 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 573, 0, 0, 0, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 583, 0, 0, 0, 0, 0, 0, 0, 0, 3375, 583, 3376, 3377, 583, 3378, 0,
+		/* C0 */ 0, 0, 573, 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 69 : 011500 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 583,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 3379, 3380, 3381, 3382, 0, 0, 0, 573,
+		/* C0 */ 582, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 70 : 011600 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 573, 582, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 71 : 011700 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 72 : 011800 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 582, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 73 : 011900 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 74 : 011A00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 75 : 011C00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 573,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 76 : 011D00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 582, 0, 573, 573, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 573, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 77 : 016A00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 372, 372, 372, 372, 372, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 78 : 016B00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 365, 365, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 79 : 01BC00 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 372, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 80 : 01D100 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3383, 3384,
+		/* 60 */ 3385, 3386, 3387, 3388, 3389, 640, 640, 372, 372, 372, 0, 0, 0, 3390, 640, 640,
+		/* 70 */ 640, 640, 640, 0, 0, 0, 0, 0, 0, 0, 0, 367, 367, 367, 367, 367,
+		/* 80 */ 367, 367, 367, 0, 0, 365, 365, 365, 365, 365, 367, 367, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3391, 3392, 3393, 3394, 3395,
+		/* C0 */ 3396, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 81 : 01D200 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 365, 365, 365, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 82 : 01D400 */
+		/* 00 */ 688, 690, 1285, 691, 692, 1301, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704,
+		/* 10 */ 1293, 705, 1515, 706, 707, 1329, 708, 1334, 1516, 1297, 56, 712, 738, 713, 714, 741,
+		/* 20 */ 718, 344, 735, 346, 719, 360, 720, 1281, 64, 725, 1517, 347, 361, 726, 727, 730,
+		/* 30 */ 351, 362, 352, 768, 688, 690, 1285, 691, 692, 1301, 694, 695, 696, 697, 698, 699,
+		/* 40 */ 700, 701, 702, 704, 1293, 705, 1515, 706, 707, 1329, 708, 1334, 1516, 1297, 56, 712,
+		/* 50 */ 738, 713, 714, 741, 718, 0, 735, 346, 719, 360, 720, 1281, 64, 725, 1517, 347,
+		/* 60 */ 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1285, 691, 692, 1301, 694, 695,
+		/* 70 */ 696, 697, 698, 699, 700, 701, 702, 704, 1293, 705, 1515, 706, 707, 1329, 708, 1334,
+		/* 80 */ 1516, 1297, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1281,
+		/* 90 */ 64, 725, 1517, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 0, 1285, 691,
+		/* A0 */ 0, 0, 694, 0, 0, 697, 698, 0, 0, 701, 702, 704, 1293, 0, 1515, 706,
+		/* B0 */ 707, 1329, 708, 1334, 1516, 1297, 56, 712, 738, 713, 0, 741, 0, 344, 735, 346,
+		/* C0 */ 719, 360, 720, 1281, 0, 725, 1517, 347, 361, 726, 727, 730, 351, 362, 352, 768,
+		/* D0 */ 688, 690, 1285, 691, 692, 1301, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704,
+		/* E0 */ 1293, 705, 1515, 706, 707, 1329, 708, 1334, 1516, 1297, 56, 712, 738, 713, 714, 741,
+		/* F0 */ 718, 344, 735, 346, 719, 360, 720, 1281, 64, 725, 1517, 347, 361, 726, 727, 730,
+	},
+	{ /* 83 : 01D500 */
+		/* 00 */ 351, 362, 352, 768, 688, 690, 0, 691, 692, 1301, 694, 0, 0, 697, 698, 699,
+		/* 10 */ 700, 701, 702, 704, 1293, 0, 1515, 706, 707, 1329, 708, 1334, 1516, 0, 56, 712,
+		/* 20 */ 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1281, 64, 725, 1517, 347,
+		/* 30 */ 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 0, 691, 692, 1301, 694, 0,
+		/* 40 */ 696, 697, 698, 699, 700, 0, 702, 0, 0, 0, 1515, 706, 707, 1329, 708, 1334,
+		/* 50 */ 1516, 0, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1281,
+		/* 60 */ 64, 725, 1517, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1285, 691,
+		/* 70 */ 692, 1301, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704, 1293, 705, 1515, 706,
+		/* 80 */ 707, 1329, 708, 1334, 1516, 1297, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346,
+		/* 90 */ 719, 360, 720, 1281, 64, 725, 1517, 347, 361, 726, 727, 730, 351, 362, 352, 768,
+		/* A0 */ 688, 690, 1285, 691, 692, 1301, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704,
+		/* B0 */ 1293, 705, 1515, 706, 707, 1329, 708, 1334, 1516, 1297, 56, 712, 738, 713, 714, 741,
+		/* C0 */ 718, 344, 735, 346, 719, 360, 720, 1281, 64, 725, 1517, 347, 361, 726, 727, 730,
+		/* D0 */ 351, 362, 352, 768, 688, 690, 1285, 691, 692, 1301, 694, 695, 696, 697, 698, 699,
+		/* E0 */ 700, 701, 702, 704, 1293, 705, 1515, 706, 707, 1329, 708, 1334, 1516, 1297, 56, 712,
+		/* F0 */ 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1281, 64, 725, 1517, 347,
+	},
+	{ /* 84 : 01D600 */
+		/* 00 */ 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1285, 691, 692, 1301, 694, 695,
+		/* 10 */ 696, 697, 698, 699, 700, 701, 702, 704, 1293, 705, 1515, 706, 707, 1329, 708, 1334,
+		/* 20 */ 1516, 1297, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346, 719, 360, 720, 1281,
+		/* 30 */ 64, 725, 1517, 347, 361, 726, 727, 730, 351, 362, 352, 768, 688, 690, 1285, 691,
+		/* 40 */ 692, 1301, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704, 1293, 705, 1515, 706,
+		/* 50 */ 707, 1329, 708, 1334, 1516, 1297, 56, 712, 738, 713, 714, 741, 718, 344, 735, 346,
+		/* 60 */ 719, 360, 720, 1281, 64, 725, 1517, 347, 361, 726, 727, 730, 351, 362, 352, 768,
+		/* 70 */ 688, 690, 1285, 691, 692, 1301, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704,
+		/* 80 */ 1293, 705, 1515, 706, 707, 1329, 708, 1334, 1516, 1297, 56, 712, 738, 713, 714, 741,
+		/* 90 */ 718, 344, 735, 346, 719, 360, 720, 1281, 64, 725, 1517, 347, 361, 726, 727, 730,
+		/* A0 */ 351, 362, 352, 768, 3397, 3398, 0, 0, 3399, 3400, 1307, 3401, 3402, 3403, 3404, 432,
+		/* B0 */ 3405, 3406, 3407, 3408, 3409, 3410, 3411, 1308, 3412, 432, 434, 3413, 3414, 3415, 3416, 3417,
+		/* C0 */ 3418, 3419, 3420, 422, 732, 733, 433, 3421, 3422, 423, 3423, 429, 3424, 61, 3425, 3426,
+		/* D0 */ 3427, 428, 430, 431, 3428, 3429, 3430, 427, 734, 3431, 3432, 3433, 433, 423, 429, 427,
+		/* E0 */ 430, 428, 3399, 3400, 1307, 3401, 3402, 3403, 3404, 432, 3405, 3406, 3407, 3408, 3409, 3410,
+		/* F0 */ 3411, 1308, 3412, 432, 434, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 422, 732, 733,
+	},
+	{ /* 85 : 01D700 */
+		/* 00 */ 433, 3421, 3422, 423, 3423, 429, 3424, 61, 3425, 3426, 3427, 428, 430, 431, 3428, 3429,
+		/* 10 */ 3430, 427, 734, 3431, 3432, 3433, 433, 423, 429, 427, 430, 428, 3399, 3400, 1307, 3401,
+		/* 20 */ 3402, 3403, 3404, 432, 3405, 3406, 3407, 3408, 3409, 3410, 3411, 1308, 3412, 432, 434, 3413,
+		/* 30 */ 3414, 3415, 3416, 3417, 3418, 3419, 3420, 422, 732, 733, 433, 3421, 3422, 423, 3423, 429,
+		/* 40 */ 3424, 61, 3425, 3426, 3427, 428, 430, 431, 3428, 3429, 3430, 427, 734, 3431, 3432, 3433,
+		/* 50 */ 433, 423, 429, 427, 430, 428, 3399, 3400, 1307, 3401, 3402, 3403, 3404, 432, 3405, 3406,
+		/* 60 */ 3407, 3408, 3409, 3410, 3411, 1308, 3412, 432, 434, 3413, 3414, 3415, 3416, 3417, 3418, 3419,
+		/* 70 */ 3420, 422, 732, 733, 433, 3421, 3422, 423, 3423, 429, 3424, 61, 3425, 3426, 3427, 428,
+		/* 80 */ 430, 431, 3428, 3429, 3430, 427, 734, 3431, 3432, 3433, 433, 423, 429, 427, 430, 428,
+		/* 90 */ 3399, 3400, 1307, 3401, 3402, 3403, 3404, 432, 3405, 3406, 3407, 3408, 3409, 3410, 3411, 1308,
+		/* A0 */ 3412, 432, 434, 3413, 3414, 3415, 3416, 3417, 3418, 3419, 3420, 422, 732, 733, 433, 3421,
+		/* B0 */ 3422, 423, 3423, 429, 3424, 61, 3425, 3426, 3427, 428, 430, 431, 3428, 3429, 3430, 427,
+		/* C0 */ 734, 3431, 3432, 3433, 433, 423, 429, 427, 430, 428, 3434, 3435, 0, 0, 1269, 63,
+		/* D0 */ 58, 59, 1270, 1271, 1272, 1273, 1274, 1275, 1269, 63, 58, 59, 1270, 1271, 1272, 1273,
+		/* E0 */ 1274, 1275, 1269, 63, 58, 59, 1270, 1271, 1272, 1273, 1274, 1275, 1269, 63, 58, 59,
+		/* F0 */ 1270, 1271, 1272, 1273, 1274, 1275, 1269, 63, 58, 59, 1270, 1271, 1272, 1273, 1274, 1275,
+	},
+	{ /* 86 : 01E000 */
+		/* 00 */ 365, 365, 365, 365, 365, 365, 365, 0, 365, 365, 365, 365, 365, 365, 365, 365,
+		/* 10 */ 365, 365, 365, 365, 365, 365, 365, 365, 365, 0, 0, 365, 365, 365, 365, 365,
+		/* 20 */ 365, 365, 0, 365, 365, 0, 365, 365, 365, 365, 365, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 87 : 01E200 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 365, 365, 365, 365,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 88 : 01E800 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 367, 367, 367, 367, 367, 367, 367, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 89 : 01E900 */
+		/* 00 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 365, 365, 365, 365, 365, 365, 582, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 90 : 01EE00 */
+		/* 00 */ 3293, 3294, 3298, 3301, 0, 3320, 3304, 3299, 3309, 3321, 3315, 3316, 3317, 3318, 3305, 3311,
+		/* 10 */ 3313, 3307, 3314, 3303, 3306, 3296, 3297, 3300, 3302, 3308, 3310, 3312, 3436, 2941, 3437, 3438,
+		/* 20 */ 0, 3294, 3298, 0, 3319, 0, 0, 3299, 0, 3321, 3315, 3316, 3317, 3318, 3305, 3311,
+		/* 30 */ 3313, 3307, 3314, 0, 3306, 3296, 3297, 3300, 0, 3308, 0, 3312, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 3298, 0, 0, 0, 0, 3299, 0, 3321, 0, 3316, 0, 3318, 3305, 3311,
+		/* 50 */ 0, 3307, 3314, 0, 3306, 0, 0, 3300, 0, 3308, 0, 3312, 0, 2941, 0, 3438,
+		/* 60 */ 0, 3294, 3298, 0, 3319, 0, 0, 3299, 3309, 3321, 3315, 0, 3317, 3318, 3305, 3311,
+		/* 70 */ 3313, 3307, 3314, 0, 3306, 3296, 3297, 3300, 0, 3308, 3310, 3312, 3436, 0, 3437, 0,
+		/* 80 */ 3293, 3294, 3298, 3301, 3319, 3320, 3304, 3299, 3309, 3321, 0, 3316, 3317, 3318, 3305, 3311,
+		/* 90 */ 3313, 3307, 3314, 3303, 3306, 3296, 3297, 3300, 3302, 3308, 3310, 3312, 0, 0, 0, 0,
+		/* A0 */ 0, 3294, 3298, 3301, 0, 3320, 3304, 3299, 3309, 3321, 0, 3316, 3317, 3318, 3305, 3311,
+		/* B0 */ 3313, 3307, 3314, 3303, 3306, 3296, 3297, 3300, 3302, 3308, 3310, 3312, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 91 : 01F100 */
+		/* 00 */ 3439, 3440, 3441, 3442, 3443, 3444, 3445, 3446, 3447, 3448, 3449, 0, 0, 0, 0, 0,
+		/* 10 */ 3450, 3451, 3452, 3453, 3454, 3455, 3456, 3457, 3458, 3459, 3460, 3461, 3462, 3463, 3464, 3465,
+		/* 20 */ 3466, 3467, 3468, 3469, 3470, 3471, 3472, 3473, 3474, 3475, 3476, 1285, 705, 3477, 3478, 0,
+		/* 30 */ 688, 690, 1285, 691, 692, 1301, 694, 695, 696, 697, 698, 699, 700, 701, 702, 704,
+		/* 40 */ 1293, 705, 1515, 706, 707, 1329, 708, 1334, 1516, 1297, 3479, 2358, 3480, 3481, 3482, 3483,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3484, 3485, 3486, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 3487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 92 : 01F200 */
+		/* 00 */ 3488, 3489, 2136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 10 */ 1589, 3490, 3491, 3492, 1532, 3493, 3494, 1958, 3495, 3496, 3497, 3498, 3499, 3500, 3501, 3502,
+		/* 20 */ 3503, 3504, 1625, 3505, 3506, 3507, 3508, 3509, 3510, 1526, 1950, 3511, 2085, 1953, 2086, 3512,
+		/* 30 */ 1681, 3513, 3514, 3515, 3516, 3517, 2068, 1599, 3518, 3519, 3520, 3521, 0, 0, 0, 0,
+		/* 40 */ 3522, 3523, 3524, 3525, 3526, 3527, 3528, 3529, 3530, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 3531, 3532, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{ /* 93 : 02F800 */
+		/* 00 */ 3533, 3534, 3535, 3536, 3537, 2725, 3538, 3539, 3540, 3541, 2726, 3542, 3543, 3544, 2727, 3545,
+		/* 10 */ 3546, 3547, 3548, 3549, 3550, 3551, 3552, 3553, 3554, 3555, 3556, 2785, 3557, 3558, 3559, 3560,
+		/* 20 */ 3561, 3562, 3563, 3564, 3565, 2790, 2728, 2729, 2791, 3566, 3567, 2536, 3568, 2730, 3569, 3570,
+		/* 30 */ 3571, 3572, 3572, 3572, 3573, 3574, 3575, 3576, 3577, 3578, 3579, 3580, 3581, 3582, 3583, 3584,
+		/* 40 */ 3585, 3586, 3587, 3588, 3589, 3590, 3590, 2793, 3591, 3592, 3593, 3594, 2732, 3595, 3596, 3597,
+		/* 50 */ 2689, 3598, 3599, 3600, 3601, 3602, 3603, 3604, 3605, 3606, 3607, 3608, 3609, 3610, 3611, 3612,
+		/* 60 */ 3613, 3614, 3615, 3616, 3617, 3618, 3619, 3620, 3621, 3622, 3623, 3623, 3624, 3625, 3626, 2532,
+		/* 70 */ 3627, 3628, 3629, 3630, 3631, 3632, 3633, 3634, 2737, 3635, 3636, 3637, 3638, 3639, 3640, 3641,
+		/* 80 */ 3642, 3643, 3644, 3645, 3646, 3647, 3648, 3649, 3650, 3651, 3652, 3653, 3654, 3655, 2478, 3656,
+		/* 90 */ 3657, 3658, 3658, 3659, 3660, 3660, 3661, 3662, 3663, 3664, 3665, 3666, 3667, 3668, 3669, 3670,
+		/* A0 */ 3671, 3672, 3673, 2738, 3674, 3675, 3676, 3677, 2805, 3677, 3678, 2740, 3679, 3680, 3681, 3682,
+		/* B0 */ 2741, 2451, 3683, 3684, 3685, 3686, 3687, 3688, 3689, 3690, 3691, 3692, 3693, 3694, 3695, 3696,
+		/* C0 */ 3697, 3698, 3699, 3700, 3701, 3702, 3703, 3704, 2742, 3705, 3706, 3707, 3708, 3709, 3710, 2744,
+		/* D0 */ 3711, 3712, 3713, 3714, 3715, 3716, 3717, 3718, 2479, 2813, 3719, 3720, 3721, 3722, 3723, 3724,
+		/* E0 */ 3725, 3726, 2745, 3727, 3728, 3729, 3730, 2856, 3731, 3732, 3733, 3734, 3735, 3736, 3737, 3738,
+		/* F0 */ 3739, 3740, 3741, 3742, 3743, 2549, 3744, 3745, 3746, 3747, 3748, 3749, 3750, 3751, 3752, 3753,
+	},
+	{ /* 94 : 02F900 */
+		/* 00 */ 3754, 2746, 2636, 3755, 3756, 3757, 3758, 3759, 3760, 3761, 3762, 2817, 3763, 3764, 3765, 3766,
+		/* 10 */ 3767, 3768, 3769, 3770, 2818, 3771, 3772, 3773, 3774, 3775, 3776, 3777, 3778, 3779, 3780, 3781,
+		/* 20 */ 3782, 2820, 3783, 3784, 3785, 3786, 3787, 3788, 3789, 3790, 3791, 3792, 3793, 3793, 3794, 3795,
+		/* 30 */ 2822, 3796, 3797, 3798, 3799, 3800, 3801, 3802, 2535, 3803, 3804, 3805, 3806, 3807, 3808, 3809,
+		/* 40 */ 2828, 3810, 3811, 3812, 3813, 3814, 3815, 3815, 2829, 2858, 3816, 3817, 3818, 3819, 3820, 2497,
+		/* 50 */ 2831, 3821, 3822, 2757, 3823, 3824, 2711, 3825, 3826, 2761, 3827, 3828, 3829, 3830, 3830, 3831,
+		/* 60 */ 3832, 3833, 3834, 3835, 3836, 3837, 3838, 3839, 3840, 3841, 3842, 3843, 3844, 3845, 3846, 3847,
+		/* 70 */ 3848, 3849, 3850, 3851, 3852, 3853, 3854, 3855, 3856, 3857, 2767, 3858, 3859, 3860, 3861, 3862,
+		/* 80 */ 3863, 3864, 3865, 3866, 3867, 3868, 3869, 3870, 3871, 3872, 3873, 3659, 3874, 3875, 3876, 3877,
+		/* 90 */ 3878, 3879, 3880, 3881, 3882, 3883, 3884, 3885, 2553, 3886, 3887, 3888, 3889, 3890, 3891, 2770,
+		/* A0 */ 3892, 3893, 3894, 3895, 3896, 3897, 3898, 3899, 3900, 3901, 3902, 3903, 3904, 3905, 3906, 3907,
+		/* B0 */ 3908, 3909, 3910, 3911, 2492, 3912, 3913, 3914, 3915, 3916, 3917, 2838, 3918, 3919, 3920, 3921,
+		/* C0 */ 3922, 3923, 3924, 3925, 3926, 3927, 3928, 3929, 3930, 3931, 3932, 3933, 3934, 3935, 3936, 3937,
+		/* D0 */ 2843, 2844, 3938, 3939, 3940, 3941, 3942, 3943, 3944, 3945, 3946, 3947, 3948, 3949, 3950, 2845,
+		/* E0 */ 3951, 3952, 3953, 3954, 3955, 3956, 3957, 3958, 3959, 3960, 3961, 3962, 3963, 3964, 3965, 3966,
+		/* F0 */ 3967, 3968, 3969, 3970, 3971, 3972, 3973, 3974, 3975, 3976, 3977, 3978, 3979, 3980, 2851, 2851,
+	},
+	{ /* 95 : 02FA00 */
+		/* 00 */ 3981, 3982, 3983, 3984, 3985, 3986, 3987, 3988, 3989, 3990, 2852, 3991, 3992, 3993, 3994, 3995,
+		/* 10 */ 3996, 3997, 3998, 3999, 4000, 4001, 4002, 4003, 4004, 4005, 4006, 4007, 4008, 4009, 0, 0,
+		/* 20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 80 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* 90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* A0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* B0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* C0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* D0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* E0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		/* F0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+};
+
+static const uint8_t record_index[] =
+{
+	/* 000000 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	/* 001000 */ 16, 17, 18, 19, 18, 18, 18, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+	/* 002000 */ 29, 30, 31, 32, 33, 18, 18, 18, 18, 18, 34, 18, 35, 36, 37, 38,
+	/* 003000 */ 39, 40, 41, 42, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 004000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 005000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 006000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 007000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 008000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 009000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 00A000 */ 18, 18, 18, 18, 18, 18, 43, 44, 45, 46, 47, 48, 49, 49, 49, 49,
+	/* 00B000 */ 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+	/* 00C000 */ 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49, 49,
+	/* 00D000 */ 49, 49, 49, 49, 49, 49, 49, 50, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 00E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 00F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 51, 52, 53, 54, 55, 56, 57,
+	/* 010000 */ 18, 58, 59, 60, 18, 18, 18, 18, 18, 18, 61, 18, 18, 62, 18, 63,
+	/* 011000 */ 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 18, 75, 76, 18, 18,
+	/* 012000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 013000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 014000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 015000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 016000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 77, 78, 18, 18, 18, 18,
+	/* 017000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 018000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 019000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 01A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 01B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 79, 18, 18, 18,
+	/* 01C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 01D000 */ 18, 80, 81, 18, 82, 83, 84, 85, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 01E000 */ 86, 78, 87, 18, 18, 18, 18, 18, 88, 89, 18, 18, 18, 18, 90, 18,
+	/* 01F000 */ 18, 91, 92, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 020000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 021000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 022000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 023000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 024000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 025000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 026000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 027000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 028000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 029000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 02A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 02B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 02C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 02D000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 02E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 02F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 93, 94, 95, 18, 18, 18, 18, 18,
+	/* 030000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 031000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 032000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 033000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 034000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 035000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 036000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 037000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 038000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 039000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 03A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 03B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 03C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 03D000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 03E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 03F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 040000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 041000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 042000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 043000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 044000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 045000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 046000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 047000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 048000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 049000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 04A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 04B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 04C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 04D000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 04E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 04F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 050000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 051000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 052000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 053000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 054000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 055000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 056000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 057000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 058000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 059000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 05A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 05B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 05C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 05D000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 05E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 05F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 060000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 061000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 062000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 063000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 064000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 065000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 066000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 067000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 068000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 069000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 06A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 06B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 06C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 06D000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 06E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 06F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 070000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 071000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 072000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 073000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 074000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 075000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 076000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 077000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 078000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 079000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 07A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 07B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 07C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 07D000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 07E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 07F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 080000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 081000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 082000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 083000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 084000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 085000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 086000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 087000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 088000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 089000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 08A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 08B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 08C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 08D000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 08E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 08F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 090000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 091000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 092000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 093000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 094000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 095000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 096000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 097000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 098000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 099000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 09A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 09B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 09C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 09D000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 09E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 09F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A0000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A1000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A2000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A3000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A4000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A5000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A6000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A7000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A8000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0A9000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0AA000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0AB000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0AC000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0AD000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0AE000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0AF000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B0000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B1000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B2000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B3000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B4000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B5000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B6000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B7000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B8000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0B9000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0BA000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0BB000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0BC000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0BD000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0BE000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0BF000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C0000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C1000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C2000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C3000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C4000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C5000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C6000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C7000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C8000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0C9000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0CA000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0CB000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0CC000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0CD000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0CE000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0CF000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D0000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D1000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D2000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D3000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D4000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D5000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D6000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D7000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D8000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0D9000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0DA000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0DB000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0DC000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0DD000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0DE000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0DF000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E0000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E1000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E2000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E3000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E4000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E5000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E6000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E7000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E8000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0E9000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0EA000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0EB000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0EC000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0ED000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0EE000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0EF000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F0000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F1000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F2000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F3000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F4000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F5000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F6000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F7000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F8000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0F9000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0FA000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0FB000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0FC000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0FD000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0FE000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 0FF000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 100000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 101000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 102000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 103000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 104000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 105000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 106000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 107000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 108000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 109000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 10A000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 10B000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 10C000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 10D000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 10E000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+	/* 10F000 */ 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+};
+
+#define SBase 0xAC00
+#define LBase 0x1100
+#define VBase 0x1161
+#define TBase 0x11A7
+#define LCount 19
+#define VCount 21
+#define TCount 28
+#define NCount (VCount * TCount)
+#define SCount (LCount * NCount)
+
+const normalization_record *ucd_lookup_normalization(codepoint_t c)
+{
+	if (c > 0x10FFFF) return records; /* Invalid Unicode Codepoint */
+	return records + record_pages[record_index[c / 256]][c % 256];
+}
+
+ucd_quick_check ucd_lookup_quick_check(codepoint_t c, ucd_normalization_form form)
+{
+	return (ucd_quick_check)((ucd_lookup_normalization(c)->quick_check >> (form * 2)) & 3);
+}
+
+size_t ucd_decompose(codepoint_t c, ucd_normalization_form form, codepoint_t *out)
+{
+	const normalization_record *record = ucd_lookup_normalization(c);
+	int compatibility = form == UCD_NFKC || form == UCD_NFKD;
+	size_t i, n = record->decomposition_length[compatibility];
+	codepoint_t s = c - SBase;
+	if (n != 0)
+	{
+		for (i = 0; i < n; ++i)
+			out[i] = decompositions[record->decomposition[compatibility] + i];
+		return n;
+	}
+	if (s < SCount)
+	{
+		out[0] = LBase + s / NCount;
+		out[1] = VBase + (s % NCount) / TCount;
+		if ((s % TCount) == 0)
+			return 2;
+		out[2] = TBase + (s % TCount);
+		return 3;
+	}
+	out[0] = c;
+	return 1;
+}
+
+codepoint_t ucd_compose(codepoint_t a, codepoint_t b)
+{
+	const codepoint_t *pair;
+	if (a - LBase < LCount && b - VBase < VCount)
+		return SBase + ((a - LBase) * VCount + (b - VBase)) * TCount;
+	if (a - SBase < SCount && ((a - SBase) % TCount) == 0 && b - TBase - 1 < TCount - 1)
+		return a + (b - TBase);
+	for (pair = compositions[ucd_lookup_normalization(a)->composition]; pair[0] != 0; pair += 2)
+	{
+		if (pair[0] == b)
+			return pair[1];
+		if (pair[0] > b)
+			break;
+	}
+	return 0;
+}
@@ -0,0 +1,47 @@
+/* Unicode Normalization Data
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UNICODE_CHARACTER_DATA_NORMALIZATION_H
+#define UNICODE_CHARACTER_DATA_NORMALIZATION_H
+
+#include "ucd/ucd.h"
+
+/* The normalization data for a codepoint. The decompositions are the full
+ * canonical ([0]) and compatibility ([1]) decompositions, with a length of 0
+ * if the codepoint does not decompose, or is a Hangul syllable.
+ */
+typedef struct normalization_record_
+{
+	uint8_t ccc;                        /* Canonical_Combining_Class */
+	uint8_t quick_check;                /* ucd_quick_check values for each form, 2 bits each */
+	uint8_t decomposition_length[2];
+	uint16_t decomposition[2];
+	uint16_t composition;               /* The (second, primary composite) pairs. */
+} normalization_record;
+
+/* Return the normalization data for the codepoint. This is not exported from
+ * the shared library.
+ */
+#if defined(__GNUC__) && !defined(_WIN32)
+__attribute__((visibility("hidden")))
+#endif
+const normalization_record *ucd_lookup_normalization(codepoint_t c);
+
+#endif
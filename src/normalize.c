@@ -0,0 +1,580 @@
+/* Unicode Normalization
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "ucd/ucd.h"
+#include "normalization.h"
+#include "utf8.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define QUICK_CHECK(record, form) ((ucd_quick_check)(((record)->quick_check >> ((form) * 2)) & 3))
+
+#define IS_COMPOSED(form) ((form) == UCD_NFC || (form) == UCD_NFKC)
+
+/* The number of decomposed codepoints that a segment holds without allocating
+ * memory. This has space for the decomposition of the next codepoint.
+ */
+#define SEGMENT_SIZE (UCD_MAX_NORMALIZATION_SEGMENT + UCD_MAX_DECOMPOSITION)
+
+/* A normalization segment. This holds the decomposed codepoints of the input
+ * codepoints since the start of the segment, and the quick check result of
+ * those input codepoints. The decomposition of the next codepoint is stored
+ * after the segment until it is added to the segment.
+ *
+ * A segment only ends before a starter, so a run of non-starters is kept in
+ * a single segment. The codepoints are held in the buffer arrays until they
+ * do not fit, then in allocated arrays that grow as needed.
+ */
+typedef struct segment_
+{
+	codepoint_t *codepoints;           /* The buffer array, or an allocated array. */
+	uint8_t *ccc;
+	size_t size;                       /* The number of codepoints the arrays can hold. */
+	size_t n;                          /* The number of decomposed codepoints in the segment. */
+	size_t start;                      /* The offset of the segment in the input data. */
+	ucd_quick_check check;
+	uint8_t last_ccc;
+	const normalization_record *next;  /* The normalization data of the next codepoint. */
+	size_t next_n;                     /* The number of codepoints the next codepoint decomposes to. */
+	codepoint_t buffer[SEGMENT_SIZE];
+	uint8_t buffer_ccc[SEGMENT_SIZE];
+} segment;
+
+static void segment_init(segment *s, size_t start)
+{
+	s->n = 0;
+	s->start = start;
+	s->check = UCD_QUICK_CHECK_YES;
+	s->last_ccc = 0;
+	s->next_n = 0;
+}
+
+static void segment_create(segment *s)
+{
+	s->codepoints = s->buffer;
+	s->ccc = s->buffer_ccc;
+	s->size = SEGMENT_SIZE;
+	segment_init(s, 0);
+}
+
+static void segment_destroy(segment *s)
+{
+	if (s->codepoints != s->buffer)
+	{
+		free(s->codepoints);
+		free(s->ccc);
+	}
+}
+
+/* Make space for the decomposition of the next codepoint. Returns zero if
+ * there is not enough memory.
+ */
+static int segment_reserve(segment *s)
+{
+	codepoint_t *codepoints;
+	uint8_t *ccc;
+	size_t size;
+	if (s->n + UCD_MAX_DECOMPOSITION <= s->size)
+		return 1;
+
+	size = s->size * 2;
+	if (s->codepoints == s->buffer)
+	{
+		codepoints = malloc(size * sizeof(codepoint_t));
+		ccc = malloc(size);
+		if (!codepoints || !ccc)
+		{
+			free(codepoints);
+			free(ccc);
+			return 0;
+		}
+		memcpy(codepoints, s->codepoints, s->n * sizeof(codepoint_t));
+		memcpy(ccc, s->ccc, s->n);
+	}
+	else
+	{
+		codepoints = realloc(s->codepoints, size * sizeof(codepoint_t));
+		if (!codepoints)
+			return 0;
+		s->codepoints = codepoints;
+		ccc = realloc(s->ccc, size);
+		if (!ccc)
+			return 0;
+	}
+	s->codepoints = codepoints;
+	s->ccc = ccc;
+	s->size = size;
+	return 1;
+}
+
+/* Start a new segment at the next codepoint, moving its decomposition to the
+ * start of the segment.
+ */
+static void segment_restart(segment *s, size_t start)
+{
+	memmove(s->codepoints, s->codepoints + s->n, s->next_n * sizeof(codepoint_t));
+	memmove(s->ccc, s->ccc + s->n, s->next_n);
+	s->n = 0;
+	s->start = start;
+	s->check = UCD_QUICK_CHECK_YES;
+}
+
+/* Decompose the next codepoint after the codepoints in the segment. Returns
+ * 1 if the segment ends before this codepoint, 0 if it does not, or -1 if
+ * there is not enough memory to hold the decomposition. The segment ends if
+ * the codepoint decomposes to a starter that does not compose with the
+ * previous codepoint.
+ */
+static int segment_decompose(segment *s, codepoint_t c, const normalization_record *record, ucd_normalization_form form)
+{
+	const normalization_record *first = record;
+	codepoint_t *out;
+	uint8_t *ccc;
+	size_t i;
+	if (!segment_reserve(s))
+		return -1;
+	out = s->codepoints + s->n;
+	ccc = s->ccc + s->n;
+	/* The quick check for the decomposed form is YES if c does not decompose. */
+	if (QUICK_CHECK(record, form | 1) == UCD_QUICK_CHECK_YES)
+	{
+		out[0] = c;
+		ccc[0] = record->ccc;
+		s->next_n = 1;
+	}
+	else
+	{
+		s->next_n = ucd_decompose(c, form, out);
+		for (i = 0; i < s->next_n; ++i)
+		{
+			const normalization_record *r = ucd_lookup_normalization(out[i]);
+			if (i == 0)
+				first = r;
+			ccc[i] = r->ccc;
+		}
+	}
+	s->next = record;
+	return first->ccc == 0 && !(IS_COMPOSED(form) && QUICK_CHECK(first, form) == UCD_QUICK_CHECK_MAYBE);
+}
+
+/* Add the decomposed next codepoint to the segment, updating the quick check
+ * result using the algorithm in UAX #15.
+ */
+static void segment_add(segment *s, ucd_normalization_form form)
+{
+	ucd_quick_check check = QUICK_CHECK(s->next, form);
+	if (check == UCD_QUICK_CHECK_NO || (s->next->ccc != 0 && s->last_ccc > s->next->ccc))
+		s->check = UCD_QUICK_CHECK_NO;
+	else if (check == UCD_QUICK_CHECK_MAYBE && s->check == UCD_QUICK_CHECK_YES)
+		s->check = UCD_QUICK_CHECK_MAYBE;
+	s->last_ccc = s->next->ccc;
+	s->n += s->next_n;
+	s->next_n = 0;
+}
+
+/* Normalize the decomposed codepoints in the segment, returning the number of
+ * normalized codepoints. The combining marks are put in canonical order, then
+ * the codepoints are composed using the canonical composition algorithm if
+ * the normalization form is NFC or NFKC.
+ */
+static size_t segment_normalize(segment *s, ucd_normalization_form form)
+{
+	codepoint_t *cp = s->codepoints;
+	uint8_t *ccc = s->ccc;
+	codepoint_t c, composite;
+	size_t i, j, o, starter = 0;
+	uint8_t k;
+	int last_ccc;
+
+	for (i = 1; i < s->n; ++i)
+	{
+		c = cp[i];
+		k = ccc[i];
+		if (k == 0)
+			continue; /* starters are not reordered */
+		for (j = i; j > 0 && ccc[j - 1] > k; --j)
+		{
+			cp[j] = cp[j - 1];
+			ccc[j] = ccc[j - 1];
+		}
+		cp[j] = c;
+		ccc[j] = k;
+	}
+
+	if (!IS_COMPOSED(form) || s->n == 0)
+		return s->n;
+
+	/* A non-starter at the start of the segment is not composed with. */
+	last_ccc = ccc[0] == 0 ? 0 : 256;
+	for (i = 1, o = 1; i < s->n; ++i)
+	{
+		if (last_ccc == 0 || last_ccc < ccc[i])
+		{
+			composite = ucd_compose(cp[starter], cp[i]);
+			if (composite != 0)
+			{
+				cp[starter] = composite;
+				continue;
+			}
+		}
+		if (ccc[i] == 0)
+			starter = o;
+		last_ccc = ccc[i];
+		cp[o] = cp[i];
+		ccc[o] = ccc[i];
+		++o;
+	}
+	return o;
+}
+
+uint8_t ucd_lookup_ccc(codepoint_t c)
+{
+	return ucd_lookup_normalization(c)->ccc;
+}
+
+void ucd_lookup_ccc_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = ucd_lookup_normalization(in[i])->ccc;
+}
+
+ucd_quick_check ucd_utf32_quick_check(const codepoint_t *in, size_t n, ucd_normalization_form form)
+{
+	ucd_quick_check result = UCD_QUICK_CHECK_YES;
+	ucd_quick_check check;
+	const normalization_record *record;
+	uint8_t last_ccc = 0;
+	size_t i;
+	for (i = 0; i < n; ++i)
+	{
+		record = ucd_lookup_normalization(in[i]);
+		check = QUICK_CHECK(record, form);
+		if (check == UCD_QUICK_CHECK_NO || (record->ccc != 0 && last_ccc > record->ccc))
+			return UCD_QUICK_CHECK_NO;
+		if (check == UCD_QUICK_CHECK_MAYBE)
+			result = UCD_QUICK_CHECK_MAYBE;
+		last_ccc = record->ccc;
+	}
+	return result;
+}
+
+ucd_quick_check ucd_utf8_quick_check(const char *in, size_t len, ucd_normalization_form form)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	ucd_quick_check result = UCD_QUICK_CHECK_YES;
+	ucd_quick_check check;
+	const normalization_record *record;
+	uint8_t last_ccc = 0;
+	size_t i = 0, ascii;
+	codepoint_t c;
+	while (i < len)
+	{
+		ascii = utf8_ascii_length(p + i, len - i);
+		if (ascii != 0)
+		{
+			/* ASCII characters are starters that are in all normalization forms. */
+			last_ccc = 0;
+			i += ascii;
+			continue;
+		}
+		i += utf8_decode(p + i, len - i, &c);
+		record = ucd_lookup_normalization(c);
+		check = QUICK_CHECK(record, form);
+		if (check == UCD_QUICK_CHECK_NO || (record->ccc != 0 && last_ccc > record->ccc))
+			return UCD_QUICK_CHECK_NO;
+		if (check == UCD_QUICK_CHECK_MAYBE)
+			result = UCD_QUICK_CHECK_MAYBE;
+		last_ccc = record->ccc;
+	}
+	return result;
+}
+
+/* Check that the normalized segment is the same as the input codepoints. */
+static int utf32_segment_matches(segment *s, const codepoint_t *in, size_t end, ucd_normalization_form form)
+{
+	size_t n;
+	switch (s->check)
+	{
+	case UCD_QUICK_CHECK_YES:
+		return 1;
+	case UCD_QUICK_CHECK_NO:
+		return 0;
+	default:
+		n = segment_normalize(s, form);
+		return n == end - s->start && memcmp(s->codepoints, in + s->start, n * sizeof(codepoint_t)) == 0;
+	}
+}
+
+int ucd_utf32_is_normalized(const codepoint_t *in, size_t n, ucd_normalization_form form)
+{
+	const normalization_record *record;
+	segment s;
+	size_t i;
+	int ret = 1, split;
+	segment_create(&s);
+	for (i = 0; i < n && ret == 1; ++i)
+	{
+		record = ucd_lookup_normalization(in[i]);
+		split = segment_decompose(&s, in[i], record, form);
+		if (split < 0)
+			ret = -1;
+		else
+		{
+			if (split && s.n != 0)
+			{
+				ret = utf32_segment_matches(&s, in, i, form);
+				segment_restart(&s, i);
+			}
+			segment_add(&s, form);
+			if (s.check == UCD_QUICK_CHECK_NO)
+				ret = 0;
+		}
+	}
+	if (ret == 1)
+		ret = utf32_segment_matches(&s, in, n, form);
+	segment_destroy(&s);
+	return ret;
+}
+
+/* Write the normalized segment to the out buffer. The segments that pass the
+ * quick check are copied from the input data.
+ */
+static size_t utf32_segment_write(segment *s, const codepoint_t *in, size_t end, ucd_normalization_form form,
+                                  codepoint_t *out, size_t o, size_t *outlen)
+{
+	const codepoint_t *src = in + s->start;
+	size_t n = end - s->start;
+	if (s->check != UCD_QUICK_CHECK_YES)
+	{
+		src = s->codepoints;
+		n = segment_normalize(s, form);
+	}
+	if (o + n <= *outlen)
+		memcpy(out + o, src, n * sizeof(codepoint_t));
+	else
+		*outlen = o; /* stop writing to the out buffer */
+	return o + n;
+}
+
+size_t ucd_utf32_normalize(const codepoint_t *in, size_t n, ucd_normalization_form form, codepoint_t *out, size_t outlen)
+{
+	const normalization_record *record;
+	segment s;
+	size_t i, o = 0;
+	int split;
+	segment_create(&s);
+	for (i = 0; i < n; ++i)
+	{
+		record = ucd_lookup_normalization(in[i]);
+		split = segment_decompose(&s, in[i], record, form);
+		if (split < 0)
+		{
+			o = (size_t)-1;
+			break;
+		}
+		if (split && s.n != 0)
+		{
+			o = utf32_segment_write(&s, in, i, form, out, o, &outlen);
+			segment_restart(&s, i);
+		}
+		segment_add(&s, form);
+	}
+	if (i == n && s.n != 0)
+		o = utf32_segment_write(&s, in, n, form, out, o, &outlen);
+	segment_destroy(&s);
+	return o;
+}
+
+/* Check that the normalized segment is the same as the input UTF-8 data. */
+static int utf8_segment_matches(segment *s, const uint8_t *in, size_t end, ucd_normalization_form form)
+{
+	size_t i, j, n;
+	codepoint_t c;
+	switch (s->check)
+	{
+	case UCD_QUICK_CHECK_YES:
+		return 1;
+	case UCD_QUICK_CHECK_NO:
+		return 0;
+	default:
+		n = segment_normalize(s, form);
+		for (i = s->start, j = 0; i < end && j < n; ++j)
+		{
+			i += utf8_decode(in + i, end - i, &c);
+			if (c != s->codepoints[j])
+				return 0;
+		}
+		return i == end && j == n;
+	}
+}
+
+int ucd_utf8_is_normalized(const char *in, size_t len, ucd_normalization_form form)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	const normalization_record *record;
+	segment s;
+	size_t i = 0, used, ascii;
+	int ret = 1, split;
+	codepoint_t c;
+	segment_create(&s);
+	while (i < len && ret == 1)
+	{
+		ascii = utf8_ascii_length(p + i, len - i);
+		if (ascii != 0)
+		{
+			/* ASCII characters start a new segment, but the last one may
+			 * compose with the codepoint after it.
+			 */
+			if (s.n != 0 && !utf8_segment_matches(&s, p, i, form))
+			{
+				ret = 0;
+				break;
+			}
+			i += ascii - 1;
+			segment_init(&s, i);
+		}
+		used = utf8_decode(p + i, len - i, &c);
+		if (c == UTF8_INVALID_CODEPOINT)
+		{
+			if (s.n != 0)
+				ret = utf8_segment_matches(&s, p, i, form);
+			i += used;
+			segment_init(&s, i);
+			continue;
+		}
+		record = ucd_lookup_normalization(c);
+		split = segment_decompose(&s, c, record, form);
+		if (split < 0)
+		{
+			ret = -1;
+			break;
+		}
+		if (split && s.n != 0)
+		{
+			ret = utf8_segment_matches(&s, p, i, form);
+			segment_restart(&s, i);
+		}
+		segment_add(&s, form);
+		if (s.check == UCD_QUICK_CHECK_NO)
+			ret = 0;
+		i += used;
+	}
+	if (ret == 1)
+		ret = utf8_segment_matches(&s, p, len, form);
+	segment_destroy(&s);
+	return ret;
+}
+
+/* Write the normalized segment to the out buffer as UTF-8. The segments that
+ * pass the quick check are copied from the input data.
+ */
+static size_t utf8_segment_write(segment *s, const uint8_t *in, size_t end, ucd_normalization_form form,
+                                 uint8_t *out, size_t o, size_t *outlen)
+{
+	size_t i, n, m;
+	if (s->check == UCD_QUICK_CHECK_YES)
+	{
+		m = end - s->start;
+		if (o + m <= *outlen)
+			memcpy(out + o, in + s->start, m);
+		else
+			*outlen = o; /* stop writing to the out buffer */
+		return o + m;
+	}
+	n = segment_normalize(s, form);
+	for (i = 0, m = 0; i < n; ++i)
+		m += utf8_length(s->codepoints[i]);
+	if (o + m <= *outlen)
+	{
+		for (i = 0, m = 0; i < n; ++i)
+			m += utf8_encode(s->codepoints[i], out + o + m);
+	}
+	else
+		*outlen = o; /* stop writing to the out buffer */
+	return o + m;
+}
+
+size_t ucd_utf8_normalize(const char *in, size_t len, ucd_normalization_form form, char *out, size_t outlen)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	uint8_t *q = (uint8_t *)out;
+	const normalization_record *record;
+	segment s;
+	size_t i = 0, o = 0, used, ascii;
+	int split;
+	codepoint_t c;
+	segment_create(&s);
+	while (i < len)
+	{
+		ascii = utf8_ascii_length(p + i, len - i);
+		if (ascii != 0)
+		{
+			/* ASCII characters start a new segment, but the last one may
+			 * compose with the codepoint after it.
+			 */
+			if (s.n != 0)
+				o = utf8_segment_write(&s, p, i, form, q, o, &outlen);
+			--ascii;
+			if (o + ascii <= outlen)
+				memcpy(q + o, p + i, ascii);
+			else
+				outlen = o;
+			i += ascii;
+			o += ascii;
+			segment_init(&s, i);
+		}
+		used = utf8_decode(p + i, len - i, &c);
+		if (c == UTF8_INVALID_CODEPOINT)
+		{
+			/* Copy ill-formed sequences unchanged. */
+			if (s.n != 0)
+				o = utf8_segment_write(&s, p, i, form, q, o, &outlen);
+			if (o + used <= outlen)
+				memcpy(q + o, p + i, used);
+			else
+				outlen = o;
+			i += used;
+			o += used;
+			segment_init(&s, i);
+			continue;
+		}
+		record = ucd_lookup_normalization(c);
+		split = segment_decompose(&s, c, record, form);
+		if (split < 0)
+		{
+			o = (size_t)-1;
+			break;
+		}
+		if (split && s.n != 0)
+		{
+			o = utf8_segment_write(&s, p, i, form, q, o, &outlen);
+			segment_restart(&s, i);
+		}
+		segment_add(&s, form);
+		i += used;
+	}
+	if (i == len && s.n != 0)
+		o = utf8_segment_write(&s, p, len, form, q, o, &outlen);
+	segment_destroy(&s);
+	return o;
+}
@@ -0,0 +1,4888 @@
+/* Unicode Character Records
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the UnicodeData.txt,
+ * Scripts.txt, PropList.txt, DerivedCoreProperties.txt and emoji-data.txt
+ * files in the Unicode Character database by the ucd-tools/tools/records.py
+ * script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+#define Cc UCD_CATEGORY_Cc
+#define Cf UCD_CATEGORY_Cf
+#define Cn UCD_CATEGORY_Cn
+#define Co UCD_CATEGORY_Co
+#define Cs UCD_CATEGORY_Cs
+#define Ll UCD_CATEGORY_Ll
+#define Lm UCD_CATEGORY_Lm
+#define Lo UCD_CATEGORY_Lo
+#define Lt UCD_CATEGORY_Lt
+#define Lu UCD_CATEGORY_Lu
+#define Mc UCD_CATEGORY_Mc
+#define Me UCD_CATEGORY_Me
+#define Mn UCD_CATEGORY_Mn
+#define Nd UCD_CATEGORY_Nd
+#define Nl UCD_CATEGORY_Nl
+#define No UCD_CATEGORY_No
+#define Pc UCD_CATEGORY_Pc
+#define Pd UCD_CATEGORY_Pd
+#define Pe UCD_CATEGORY_Pe
+#define Pf UCD_CATEGORY_Pf
+#define Pi UCD_CATEGORY_Pi
+#define Po UCD_CATEGORY_Po
+#define Ps UCD_CATEGORY_Ps
+#define Sc UCD_CATEGORY_Sc
+#define Sk UCD_CATEGORY_Sk
+#define Sm UCD_CATEGORY_Sm
+#define So UCD_CATEGORY_So
+#define Zl UCD_CATEGORY_Zl
+#define Zp UCD_CATEGORY_Zp
+#define Zs UCD_CATEGORY_Zs
+#define Ii UCD_CATEGORY_Ii
+
+#define Adlm UCD_SCRIPT_Adlm
+#define Afak UCD_SCRIPT_Afak
+#define Aghb UCD_SCRIPT_Aghb
+#define Ahom UCD_SCRIPT_Ahom
+#define Arab UCD_SCRIPT_Arab
+#define Armi UCD_SCRIPT_Armi
+#define Armn UCD_SCRIPT_Armn
+#define Avst UCD_SCRIPT_Avst
+#define Bali UCD_SCRIPT_Bali
+#define Bamu UCD_SCRIPT_Bamu
+#define Bass UCD_SCRIPT_Bass
+#define Batk UCD_SCRIPT_Batk
+#define Beng UCD_SCRIPT_Beng
+#define Bhks UCD_SCRIPT_Bhks
+#define Blis UCD_SCRIPT_Blis
+#define Bopo UCD_SCRIPT_Bopo
+#define Brah UCD_SCRIPT_Brah
+#define Brai UCD_SCRIPT_Brai
+#define Bugi UCD_SCRIPT_Bugi
+#define Buhd UCD_SCRIPT_Buhd
+#define Cakm UCD_SCRIPT_Cakm
+#define Cans UCD_SCRIPT_Cans
+#define Cari UCD_SCRIPT_Cari
+#define Cham UCD_SCRIPT_Cham
+#define Cher UCD_SCRIPT_Cher
+#define Cirt UCD_SCRIPT_Cirt
+#define Copt UCD_SCRIPT_Copt
+#define Cprt UCD_SCRIPT_Cprt
+#define Cyrl UCD_SCRIPT_Cyrl
+#define Cyrs UCD_SCRIPT_Cyrs
+#define Deva UCD_SCRIPT_Deva
+#define Dogr UCD_SCRIPT_Dogr
+#define Dsrt UCD_SCRIPT_Dsrt
+#define Dupl UCD_SCRIPT_Dupl
+#define Egyd UCD_SCRIPT_Egyd
+#define Egyh UCD_SCRIPT_Egyh
+#define Egyp UCD_SCRIPT_Egyp
+#define Elba UCD_SCRIPT_Elba
+#define Elym UCD_SCRIPT_Elym
+#define Ethi UCD_SCRIPT_Ethi
+#define Geok UCD_SCRIPT_Geok
+#define Geor UCD_SCRIPT_Geor
+#define Glag UCD_SCRIPT_Glag
+#define Gong UCD_SCRIPT_Gong
+#define Gonm UCD_SCRIPT_Gonm
+#define Goth UCD_SCRIPT_Goth
+#define Gran UCD_SCRIPT_Gran
+#define Grek UCD_SCRIPT_Grek
+#define Gujr UCD_SCRIPT_Gujr
+#define Guru UCD_SCRIPT_Guru
+#define Hang UCD_SCRIPT_Hang
+#define Hani UCD_SCRIPT_Hani
+#define Hano UCD_SCRIPT_Hano
+#define Hans UCD_SCRIPT_Hans
+#define Hant UCD_SCRIPT_Hant
+#define Hatr UCD_SCRIPT_Hatr
+#define Hebr UCD_SCRIPT_Hebr
+#define Hira UCD_SCRIPT_Hira
+#define Hluw UCD_SCRIPT_Hluw
+#define Hmng UCD_SCRIPT_Hmng
+#define Hmnp UCD_SCRIPT_Hmnp
+#define Hrkt UCD_SCRIPT_Hrkt
+#define Hung UCD_SCRIPT_Hung
+#define Inds UCD_SCRIPT_Inds
+#define Ital UCD_SCRIPT_Ital
+#define Java UCD_SCRIPT_Java
+#define Jpan UCD_SCRIPT_Jpan
+#define Jurc UCD_SCRIPT_Jurc
+#define Kali UCD_SCRIPT_Kali
+#define Kana UCD_SCRIPT_Kana
+#define Khar UCD_SCRIPT_Khar
+#define Khmr UCD_SCRIPT_Khmr
+#define Khoj UCD_SCRIPT_Khoj
+#define Knda UCD_SCRIPT_Knda
+#define Kore UCD_SCRIPT_Kore
+#define Kpel UCD_SCRIPT_Kpel
+#define Kthi UCD_SCRIPT_Kthi
+#define Lana UCD_SCRIPT_Lana
+#define Laoo UCD_SCRIPT_Laoo
+#define Latf UCD_SCRIPT_Latf
+#define Latg UCD_SCRIPT_Latg
+#define Latn UCD_SCRIPT_Latn
+#define Lepc UCD_SCRIPT_Lepc
+#define Limb UCD_SCRIPT_Limb
+#define Lina UCD_SCRIPT_Lina
+#define Linb UCD_SCRIPT_Linb
+#define Lisu UCD_SCRIPT_Lisu
+#define Loma UCD_SCRIPT_Loma
+#define Lyci UCD_SCRIPT_Lyci
+#define Lydi UCD_SCRIPT_Lydi
+#define Mahj UCD_SCRIPT_Mahj
+#define Maka UCD_SCRIPT_Maka
+#define Mand UCD_SCRIPT_Mand
+#define Mani UCD_SCRIPT_Mani
+#define Marc UCD_SCRIPT_Marc
+#define Maya UCD_SCRIPT_Maya
+#define Medf UCD_SCRIPT_Medf
+#define Mend UCD_SCRIPT_Mend
+#define Merc UCD_SCRIPT_Merc
+#define Mero UCD_SCRIPT_Mero
+#define Mlym UCD_SCRIPT_Mlym
+#define Modi UCD_SCRIPT_Modi
+#define Mong UCD_SCRIPT_Mong
+#define Moon UCD_SCRIPT_Moon
+#define Mroo UCD_SCRIPT_Mroo
+#define Mtei UCD_SCRIPT_Mtei
+#define Mult UCD_SCRIPT_Mult
+#define Mymr UCD_SCRIPT_Mymr
+#define Nand UCD_SCRIPT_Nand
+#define Narb UCD_SCRIPT_Narb
+#define Nbat UCD_SCRIPT_Nbat
+#define Newa UCD_SCRIPT_Newa
+#define Nkgb UCD_SCRIPT_Nkgb
+#define Nkoo UCD_SCRIPT_Nkoo
+#define Nshu UCD_SCRIPT_Nshu
+#define Ogam UCD_SCRIPT_Ogam
+#define Olck UCD_SCRIPT_Olck
+#define Orkh UCD_SCRIPT_Orkh
+#define Orya UCD_SCRIPT_Orya
+#define Osge UCD_SCRIPT_Osge
+#define Osma UCD_SCRIPT_Osma
+#define Palm UCD_SCRIPT_Palm
+#define Pauc UCD_SCRIPT_Pauc
+#define Perm UCD_SCRIPT_Perm
+#define Phag UCD_SCRIPT_Phag
+#define Phli UCD_SCRIPT_Phli
+#define Phlp UCD_SCRIPT_Phlp
+#define Phlv UCD_SCRIPT_Phlv
+#define Phnx UCD_SCRIPT_Phnx
+#define Plrd UCD_SCRIPT_Plrd
+#define Prti UCD_SCRIPT_Prti
+#define Qaak UCD_SCRIPT_Qaak
+#define Rjng UCD_SCRIPT_Rjng
+#define Rohg UCD_SCRIPT_Rohg
+#define Roro UCD_SCRIPT_Roro
+#define Runr UCD_SCRIPT_Runr
+#define Samr UCD_SCRIPT_Samr
+#define Sara UCD_SCRIPT_Sara
+#define Sarb UCD_SCRIPT_Sarb
+#define Saur UCD_SCRIPT_Saur
+#define Sgnw UCD_SCRIPT_Sgnw
+#define Shaw UCD_SCRIPT_Shaw
+#define Shrd UCD_SCRIPT_Shrd
+#define Sidd UCD_SCRIPT_Sidd
+#define Sind UCD_SCRIPT_Sind
+#define Sinh UCD_SCRIPT_Sinh
+#define Sogd UCD_SCRIPT_Sogd
+#define Sogo UCD_SCRIPT_Sogo
+#define Sora UCD_SCRIPT_Sora
+#define Soyo UCD_SCRIPT_Soyo
+#define Sund UCD_SCRIPT_Sund
+#define Sylo UCD_SCRIPT_Sylo
+#define Syrc UCD_SCRIPT_Syrc
+#define Syre UCD_SCRIPT_Syre
+#define Syrj UCD_SCRIPT_Syrj
+#define Syrn UCD_SCRIPT_Syrn
+#define Tagb UCD_SCRIPT_Tagb
+#define Takr UCD_SCRIPT_Takr
+#define Tale UCD_SCRIPT_Tale
+#define Talu UCD_SCRIPT_Talu
+#define Taml UCD_SCRIPT_Taml
+#define Tang UCD_SCRIPT_Tang
+#define Tavt UCD_SCRIPT_Tavt
+#define Telu UCD_SCRIPT_Telu
+#define Teng UCD_SCRIPT_Teng
+#define Tfng UCD_SCRIPT_Tfng
+#define Tglg UCD_SCRIPT_Tglg
+#define Thaa UCD_SCRIPT_Thaa
+#define Thai UCD_SCRIPT_Thai
+#define Tibt UCD_SCRIPT_Tibt
+#define Tirh UCD_SCRIPT_Tirh
+#define Ugar UCD_SCRIPT_Ugar
+#define Vaii UCD_SCRIPT_Vaii
+#define Visp UCD_SCRIPT_Visp
+#define Wara UCD_SCRIPT_Wara
+#define Wcho UCD_SCRIPT_Wcho
+#define Wole UCD_SCRIPT_Wole
+#define Xpeo UCD_SCRIPT_Xpeo
+#define Xsux UCD_SCRIPT_Xsux
+#define Yiii UCD_SCRIPT_Yiii
+#define Zanb UCD_SCRIPT_Zanb
+#define Zinh UCD_SCRIPT_Zinh
+#define Zmth UCD_SCRIPT_Zmth
+#define Zsym UCD_SCRIPT_Zsym
+#define Zxxx UCD_SCRIPT_Zxxx
+#define Zyyy UCD_SCRIPT_Zyyy
+#define Zzzz UCD_SCRIPT_Zzzz
+
+
+/* Unicode Character Data 12.0.0 */
+
+static const int32_t case_deltas[][3] = /* upper, lower, title */
+{
+	/*   0 */ { 0, 0, 0 },
+	/*   1 */ { 0, 32, 0 },
+	/*   2 */ { -32, 0, -32 },
+	/*   3 */ { 743, 0, 743 },
+	/*   4 */ { 121, 0, 121 },
+	/*   5 */ { 0, 1, 0 },
+	/*   6 */ { -1, 0, -1 },
+	/*   7 */ { 0, -199, 0 },
+	/*   8 */ { -232, 0, -232 },
+	/*   9 */ { 0, -121, 0 },
+	/*  10 */ { -300, 0, -300 },
+	/*  11 */ { 195, 0, 195 },
+	/*  12 */ { 0, 210, 0 },
+	/*  13 */ { 0, 206, 0 },
+	/*  14 */ { 0, 205, 0 },
+	/*  15 */ { 0, 79, 0 },
+	/*  16 */ { 0, 202, 0 },
+	/*  17 */ { 0, 203, 0 },
+	/*  18 */ { 0, 207, 0 },
+	/*  19 */ { 97, 0, 97 },
+	/*  20 */ { 0, 211, 0 },
+	/*  21 */ { 0, 209, 0 },
+	/*  22 */ { 163, 0, 163 },
+	/*  23 */ { 0, 213, 0 },
+	/*  24 */ { 130, 0, 130 },
+	/*  25 */ { 0, 214, 0 },
+	/*  26 */ { 0, 218, 0 },
+	/*  27 */ { 0, 217, 0 },
+	/*  28 */ { 0, 219, 0 },
+	/*  29 */ { 56, 0, 56 },
+	/*  30 */ { 0, 2, 1 },
+	/*  31 */ { -1, 1, 0 },
+	/*  32 */ { -2, 0, -1 },
+	/*  33 */ { -79, 0, -79 },
+	/*  34 */ { 0, -97, 0 },
+	/*  35 */ { 0, -56, 0 },
+	/*  36 */ { 0, -130, 0 },
+	/*  37 */ { 0, 10795, 0 },
+	/*  38 */ { 0, -163, 0 },
+	/*  39 */ { 0, 10792, 0 },
+	/*  40 */ { 10815, 0, 10815 },
+	/*  41 */ { 0, -195, 0 },
+	/*  42 */ { 0, 69, 0 },
+	/*  43 */ { 0, 71, 0 },
+	/*  44 */ { 10783, 0, 10783 },
+	/*  45 */ { 10780, 0, 10780 },
+	/*  46 */ { 10782, 0, 10782 },
+	/*  47 */ { -210, 0, -210 },
+	/*  48 */ { -206, 0, -206 },
+	/*  49 */ { -205, 0, -205 },
+	/*  50 */ { -202, 0, -202 },
+	/*  51 */ { -203, 0, -203 },
+	/*  52 */ { 42319, 0, 42319 },
+	/*  53 */ { 42315, 0, 42315 },
+	/*  54 */ { -207, 0, -207 },
+	/*  55 */ { 42280, 0, 42280 },
+	/*  56 */ { 42308, 0, 42308 },
+	/*  57 */ { -209, 0, -209 },
+	/*  58 */ { -211, 0, -211 },
+	/*  59 */ { 10743, 0, 10743 },
+	/*  60 */ { 42305, 0, 42305 },
+	/*  61 */ { 10749, 0, 10749 },
+	/*  62 */ { -213, 0, -213 },
+	/*  63 */ { -214, 0, -214 },
+	/*  64 */ { 10727, 0, 10727 },
+	/*  65 */ { -218, 0, -218 },
+	/*  66 */ { 42307, 0, 42307 },
+	/*  67 */ { 42282, 0, 42282 },
+	/*  68 */ { -69, 0, -69 },
+	/*  69 */ { -217, 0, -217 },
+	/*  70 */ { -71, 0, -71 },
+	/*  71 */ { -219, 0, -219 },
+	/*  72 */ { 42261, 0, 42261 },
+	/*  73 */ { 42258, 0, 42258 },
+	/*  74 */ { 84, 0, 84 },
+	/*  75 */ { 0, 116, 0 },
+	/*  76 */ { 0, 38, 0 },
+	/*  77 */ { 0, 37, 0 },
+	/*  78 */ { 0, 64, 0 },
+	/*  79 */ { 0, 63, 0 },
+	/*  80 */ { -38, 0, -38 },
+	/*  81 */ { -37, 0, -37 },
+	/*  82 */ { -31, 0, -31 },
+	/*  83 */ { -64, 0, -64 },
+	/*  84 */ { -63, 0, -63 },
+	/*  85 */ { 0, 8, 0 },
+	/*  86 */ { -62, 0, -62 },
+	/*  87 */ { -57, 0, -57 },
+	/*  88 */ { -47, 0, -47 },
+	/*  89 */ { -54, 0, -54 },
+	/*  90 */ { -8, 0, -8 },
+	/*  91 */ { -86, 0, -86 },
+	/*  92 */ { -80, 0, -80 },
+	/*  93 */ { 7, 0, 7 },
+	/*  94 */ { -116, 0, -116 },
+	/*  95 */ { 0, -60, 0 },
+	/*  96 */ { -96, 0, -96 },
+	/*  97 */ { 0, -7, 0 },
+	/*  98 */ { 0, 80, 0 },
+	/*  99 */ { 0, 15, 0 },
+	/* 100 */ { -15, 0, -15 },
+	/* 101 */ { 0, 48, 0 },
+	/* 102 */ { -48, 0, -48 },
+	/* 103 */ { 0, 7264, 0 },
+	/* 104 */ { 3008, 0, 0 },
+	/* 105 */ { 0, 38864, 0 },
+	/* 106 */ { -6254, 0, -6254 },
+	/* 107 */ { -6253, 0, -6253 },
+	/* 108 */ { -6244, 0, -6244 },
+	/* 109 */ { -6242, 0, -6242 },
+	/* 110 */ { -6243, 0, -6243 },
+	/* 111 */ { -6236, 0, -6236 },
+	/* 112 */ { -6181, 0, -6181 },
+	/* 113 */ { 35266, 0, 35266 },
+	/* 114 */ { 0, -3008, 0 },
+	/* 115 */ { 35332, 0, 35332 },
+	/* 116 */ { 3814, 0, 3814 },
+	/* 117 */ { 35384, 0, 35384 },
+	/* 118 */ { -59, 0, -59 },
+	/* 119 */ { 0, -7615, 0 },
+	/* 120 */ { 8, 0, 8 },
+	/* 121 */ { 0, -8, 0 },
+	/* 122 */ { 74, 0, 74 },
+	/* 123 */ { 86, 0, 86 },
+	/* 124 */ { 100, 0, 100 },
+	/* 125 */ { 128, 0, 128 },
+	/* 126 */ { 112, 0, 112 },
+	/* 127 */ { 126, 0, 126 },
+	/* 128 */ { 9, 0, 9 },
+	/* 129 */ { 0, -74, 0 },
+	/* 130 */ { 0, -9, 0 },
+	/* 131 */ { -7205, 0, -7205 },
+	/* 132 */ { 0, -86, 0 },
+	/* 133 */ { 0, -100, 0 },
+	/* 134 */ { 0, -112, 0 },
+	/* 135 */ { 0, -128, 0 },
+	/* 136 */ { 0, -126, 0 },
+	/* 137 */ { 0, -7517, 0 },
+	/* 138 */ { 0, -8383, 0 },
+	/* 139 */ { 0, -8262, 0 },
+	/* 140 */ { 0, 28, 0 },
+	/* 141 */ { -28, 0, -28 },
+	/* 142 */ { 0, 16, 0 },
+	/* 143 */ { -16, 0, -16 },
+	/* 144 */ { 0, 26, 0 },
+	/* 145 */ { -26, 0, -26 },
+	/* 146 */ { 0, -10743, 0 },
+	/* 147 */ { 0, -3814, 0 },
+	/* 148 */ { 0, -10727, 0 },
+	/* 149 */ { -10795, 0, -10795 },
+	/* 150 */ { -10792, 0, -10792 },
+	/* 151 */ { 0, -10780, 0 },
+	/* 152 */ { 0, -10749, 0 },
+	/* 153 */ { 0, -10783, 0 },
+	/* 154 */ { 0, -10782, 0 },
+	/* 155 */ { 0, -10815, 0 },
+	/* 156 */ { -7264, 0, -7264 },
+	/* 157 */ { 0, -35332, 0 },
+	/* 158 */ { 0, -42280, 0 },
+	/* 159 */ { 48, 0, 48 },
+	/* 160 */ { 0, -42308, 0 },
+	/* 161 */ { 0, -42319, 0 },
+	/* 162 */ { 0, -42315, 0 },
+	/* 163 */ { 0, -42305, 0 },
+	/* 164 */ { 0, -42258, 0 },
+	/* 165 */ { 0, -42282, 0 },
+	/* 166 */ { 0, -42261, 0 },
+	/* 167 */ { 0, 928, 0 },
+	/* 168 */ { 0, -48, 0 },
+	/* 169 */ { 0, -42307, 0 },
+	/* 170 */ { 0, -35384, 0 },
+	/* 171 */ { -928, 0, -928 },
+	/* 172 */ { -38864, 0, -38864 },
+	/* 173 */ { 0, 40, 0 },
+	/* 174 */ { -40, 0, -40 },
+	/* 175 */ { 0, 34, 0 },
+	/* 176 */ { -34, 0, -34 },
+};
+
+static const ucd_record records[] =
+{
+	/*    0 */ { 0x0000000000000000ull, Ii, Zzzz, 0 },
+	/*    1 */ { 0x0000000000000000ull, Cc, Zyyy, 0 },
+	/*    2 */ { 0x0000000040000001ull, Cc, Zyyy, 0 },
+	/*    3 */ { 0x0000000040000001ull, Zs, Zyyy, 0 },
+	/*    4 */ { 0x0000000090000040ull, Po, Zyyy, 0 },
+	/*    5 */ { 0x0000000080000020ull, Po, Zyyy, 0 },
+	/*    6 */ { 0x0000004280000000ull, Po, Zyyy, 0 },
+	/*    7 */ { 0x0000000080000000ull, Sc, Zyyy, 0 },
+	/*    8 */ { 0x0000000080000000ull, Po, Zyyy, 0 },
+	/*    9 */ { 0x0000000080000000ull, Ps, Zyyy, 0 },
+	/*   10 */ { 0x0000000080000000ull, Pe, Zyyy, 0 },
+	/*   11 */ { 0x0000000080000000ull, Sm, Zyyy, 0 },
+	/*   12 */ { 0x0000000080000040ull, Po, Zyyy, 0 },
+	/*   13 */ { 0x0000000080000018ull, Pd, Zyyy, 0 },
+	/*   14 */ { 0x0000024200000300ull, Nd, Zyyy, 0 },
+	/*   15 */ { 0x0000030000000300ull, Lu, Latn, 1 },
+	/*   16 */ { 0x0000030000000000ull, Lu, Latn, 1 },
+	/*   17 */ { 0x0000000080001080ull, Sk, Zyyy, 0 },
+	/*   18 */ { 0x0000020000000000ull, Pc, Zyyy, 0 },
+	/*   19 */ { 0x0000000080001000ull, Sk, Zyyy, 0 },
+	/*   20 */ { 0x0000030000000300ull, Ll, Latn, 2 },
+	/*   21 */ { 0x0000030000000000ull, Ll, Latn, 2 },
+	/*   22 */ { 0x0000030001000000ull, Ll, Latn, 2 },
+	/*   23 */ { 0x0000000000000001ull, Zs, Zyyy, 0 },
+	/*   24 */ { 0x0000000080000000ull, So, Zyyy, 0 },
+	/*   25 */ { 0x0000000000001000ull, Sk, Zyyy, 0 },
+	/*   26 */ { 0x0000008280000000ull, So, Zyyy, 0 },
+	/*   27 */ { 0x0000030000004000ull, Lo, Latn, 0 },
+	/*   28 */ { 0x0000000080000020ull, Pi, Zyyy, 0 },
+	/*   29 */ { 0x0000000000000010ull, Cf, Zyyy, 0 },
+	/*   30 */ { 0x0000000000000000ull, No, Zyyy, 0 },
+	/*   31 */ { 0x0000030000000000ull, Ll, Zyyy, 3 },
+	/*   32 */ { 0x0000020008003000ull, Po, Zyyy, 0 },
+	/*   33 */ { 0x0000000080000020ull, Pf, Zyyy, 0 },
+	/*   34 */ { 0x0000030000000000ull, Ll, Latn, 0 },
+	/*   35 */ { 0x0000030000000000ull, Ll, Latn, 4 },
+	/*   36 */ { 0x0000030000000000ull, Lu, Latn, 5 },
+	/*   37 */ { 0x0000030000000000ull, Ll, Latn, 6 },
+	/*   38 */ { 0x0000030001000000ull, Ll, Latn, 6 },
+	/*   39 */ { 0x0000030000000000ull, Lu, Latn, 7 },
+	/*   40 */ { 0x0000030000000000ull, Ll, Latn, 8 },
+	/*   41 */ { 0x0000030000800000ull, Ll, Latn, 0 },
+	/*   42 */ { 0x0000030000000000ull, Lu, Latn, 9 },
+	/*   43 */ { 0x0000030000000000ull, Ll, Latn, 10 },
+	/*   44 */ { 0x0000030000000000ull, Ll, Latn, 11 },
+	/*   45 */ { 0x0000030000000000ull, Lu, Latn, 12 },
+	/*   46 */ { 0x0000030000000000ull, Lu, Latn, 13 },
+	/*   47 */ { 0x0000030000000000ull, Lu, Latn, 14 },
+	/*   48 */ { 0x0000030000000000ull, Lu, Latn, 15 },
+	/*   49 */ { 0x0000030000000000ull, Lu, Latn, 16 },
+	/*   50 */ { 0x0000030000000000ull, Lu, Latn, 17 },
+	/*   51 */ { 0x0000030000000000ull, Lu, Latn, 18 },
+	/*   52 */ { 0x0000030000000000ull, Ll, Latn, 19 },
+	/*   53 */ { 0x0000030000000000ull, Lu, Latn, 20 },
+	/*   54 */ { 0x0000030000000000ull, Lu, Latn, 21 },
+	/*   55 */ { 0x0000030000000000ull, Ll, Latn, 22 },
+	/*   56 */ { 0x0000030000000000ull, Lu, Latn, 23 },
+	/*   57 */ { 0x0000030000000000ull, Ll, Latn, 24 },
+	/*   58 */ { 0x0000030000000000ull, Lu, Latn, 25 },
+	/*   59 */ { 0x0000030000000000ull, Lu, Latn, 26 },
+	/*   60 */ { 0x0000030000000000ull, Lu, Latn, 27 },
+	/*   61 */ { 0x0000030000000000ull, Lu, Latn, 28 },
+	/*   62 */ { 0x0000030000000000ull, Lo, Latn, 0 },
+	/*   63 */ { 0x0000030000000000ull, Ll, Latn, 29 },
+	/*   64 */ { 0x0000030000000000ull, Lu, Latn, 30 },
+	/*   65 */ { 0x0000030000000000ull, Lt, Latn, 31 },
+	/*   66 */ { 0x0000030000000000ull, Ll, Latn, 32 },
+	/*   67 */ { 0x0000030000000000ull, Ll, Latn, 33 },
+	/*   68 */ { 0x0000030000000000ull, Lu, Latn, 34 },
+	/*   69 */ { 0x0000030000000000ull, Lu, Latn, 35 },
+	/*   70 */ { 0x0000030000000000ull, Lu, Latn, 36 },
+	/*   71 */ { 0x0000030000000000ull, Lu, Latn, 37 },
+	/*   72 */ { 0x0000030000000000ull, Lu, Latn, 38 },
+	/*   73 */ { 0x0000030000000000ull, Lu, Latn, 39 },
+	/*   74 */ { 0x0000030000000000ull, Ll, Latn, 40 },
+	/*   75 */ { 0x0000030000000000ull, Lu, Latn, 41 },
+	/*   76 */ { 0x0000030000000000ull, Lu, Latn, 42 },
+	/*   77 */ { 0x0000030000000000ull, Lu, Latn, 43 },
+	/*   78 */ { 0x0000030000000000ull, Ll, Latn, 44 },
+	/*   79 */ { 0x0000030000000000ull, Ll, Latn, 45 },
+	/*   80 */ { 0x0000030000000000ull, Ll, Latn, 46 },
+	/*   81 */ { 0x0000030000000000ull, Ll, Latn, 47 },
+	/*   82 */ { 0x0000030000000000ull, Ll, Latn, 48 },
+	/*   83 */ { 0x0000030000000000ull, Ll, Latn, 49 },
+	/*   84 */ { 0x0000030000000000ull, Ll, Latn, 50 },
+	/*   85 */ { 0x0000030000000000ull, Ll, Latn, 51 },
+	/*   86 */ { 0x0000030000000000ull, Ll, Latn, 52 },
+	/*   87 */ { 0x0000030000000000ull, Ll, Latn, 53 },
+	/*   88 */ { 0x0000030000000000ull, Ll, Latn, 54 },
+	/*   89 */ { 0x0000030000000000ull, Ll, Latn, 55 },
+	/*   90 */ { 0x0000030000000000ull, Ll, Latn, 56 },
+	/*   91 */ { 0x0000030001000000ull, Ll, Latn, 57 },
+	/*   92 */ { 0x0000030000000000ull, Ll, Latn, 58 },
+	/*   93 */ { 0x0000030000000000ull, Ll, Latn, 59 },
+	/*   94 */ { 0x0000030000000000ull, Ll, Latn, 60 },
+	/*   95 */ { 0x0000030000000000ull, Ll, Latn, 61 },
+	/*   96 */ { 0x0000030000000000ull, Ll, Latn, 62 },
+	/*   97 */ { 0x0000030000000000ull, Ll, Latn, 63 },
+	/*   98 */ { 0x0000030000000000ull, Ll, Latn, 64 },
+	/*   99 */ { 0x0000030000000000ull, Ll, Latn, 65 },
+	/*  100 */ { 0x0000030000000000ull, Ll, Latn, 66 },
+	/*  101 */ { 0x0000030000000000ull, Ll, Latn, 67 },
+	/*  102 */ { 0x0000030000000000ull, Ll, Latn, 68 },
+	/*  103 */ { 0x0000030000000000ull, Ll, Latn, 69 },
+	/*  104 */ { 0x0000030000000000ull, Ll, Latn, 70 },
+	/*  105 */ { 0x0000030000000000ull, Ll, Latn, 71 },
+	/*  106 */ { 0x0000030001000000ull, Ll, Latn, 72 },
+	/*  107 */ { 0x0000030000000000ull, Ll, Latn, 73 },
+	/*  108 */ { 0x0000030000005000ull, Lm, Latn, 0 },
+	/*  109 */ { 0x0000030001005000ull, Lm, Latn, 0 },
+	/*  110 */ { 0x0000030000001000ull, Lm, Zyyy, 0 },
+	/*  111 */ { 0x0000030000005000ull, Lm, Zyyy, 0 },
+	/*  112 */ { 0x0000030000003000ull, Lm, Zyyy, 0 },
+	/*  113 */ { 0x0000000000001000ull, Sk, Bopo, 0 },
+	/*  114 */ { 0x0000020000001000ull, Mn, Zinh, 0 },
+	/*  115 */ { 0x0000020000005400ull, Mn, Zinh, 74 },
+	/*  116 */ { 0x0000020000400000ull, Mn, Zinh, 0 },
+	/*  117 */ { 0x0000020000000000ull, Mn, Zinh, 0 },
+	/*  118 */ { 0x0000030000000000ull, Lu, Grek, 5 },
+	/*  119 */ { 0x0000030000000000ull, Ll, Grek, 6 },
+	/*  120 */ { 0x0000000000001000ull, Sk, Grek, 0 },
+	/*  121 */ { 0x0000000000000000ull, Cn, Zzzz, 0 },
+	/*  122 */ { 0x0000000000005000ull, Lm, Grek, 0 },
+	/*  123 */ { 0x0000030000000000ull, Ll, Grek, 24 },
+	/*  124 */ { 0x0000000000000040ull, Po, Zyyy, 0 },
+	/*  125 */ { 0x0000030000000000ull, Lu, Grek, 75 },
+	/*  126 */ { 0x0000030000000000ull, Lu, Grek, 76 },
+	/*  127 */ { 0x0000020008000040ull, Po, Zyyy, 0 },
+	/*  128 */ { 0x0000030000000000ull, Lu, Grek, 77 },
+	/*  129 */ { 0x0000030000000000ull, Lu, Grek, 78 },
+	/*  130 */ { 0x0000030000000000ull, Lu, Grek, 79 },
+	/*  131 */ { 0x0000030000000000ull, Ll, Grek, 0 },
+	/*  132 */ { 0x0000030000000000ull, Lu, Grek, 1 },
+	/*  133 */ { 0x0000030000000000ull, Ll, Grek, 80 },
+	/*  134 */ { 0x0000030000000000ull, Ll, Grek, 81 },
+	/*  135 */ { 0x0000030000000000ull, Ll, Grek, 2 },
+	/*  136 */ { 0x0000030000000000ull, Ll, Grek, 82 },
+	/*  137 */ { 0x0000030000000000ull, Ll, Grek, 83 },
+	/*  138 */ { 0x0000030000000000ull, Ll, Grek, 84 },
+	/*  139 */ { 0x0000030000000000ull, Lu, Grek, 85 },
+	/*  140 */ { 0x0000030000000080ull, Ll, Grek, 86 },
+	/*  141 */ { 0x0000030000000080ull, Ll, Grek, 87 },
+	/*  142 */ { 0x0000030000000080ull, Lu, Grek, 0 },
+	/*  143 */ { 0x0000030000000000ull, Lu, Grek, 0 },
+	/*  144 */ { 0x0000030000000080ull, Ll, Grek, 88 },
+	/*  145 */ { 0x0000030000000000ull, Ll, Grek, 89 },
+	/*  146 */ { 0x0000030000000000ull, Ll, Grek, 90 },
+	/*  147 */ { 0x0000030000000000ull, Lu, Copt, 5 },
+	/*  148 */ { 0x0000030000000000ull, Ll, Copt, 6 },
+	/*  149 */ { 0x0000030000000080ull, Ll, Grek, 91 },
+	/*  150 */ { 0x0000030000000080ull, Ll, Grek, 92 },
+	/*  151 */ { 0x0000030000000000ull, Ll, Grek, 93 },
+	/*  152 */ { 0x0000030001000000ull, Ll, Grek, 94 },
+	/*  153 */ { 0x0000030000000080ull, Lu, Grek, 95 },
+	/*  154 */ { 0x0000030000000080ull, Ll, Grek, 96 },
+	/*  155 */ { 0x0000000000000000ull, Sm, Grek, 0 },
+	/*  156 */ { 0x0000030000000000ull, Lu, Grek, 97 },
+	/*  157 */ { 0x0000030000000000ull, Lu, Grek, 36 },
+	/*  158 */ { 0x0000030000000000ull, Lu, Cyrl, 98 },
+	/*  159 */ { 0x0000030000000000ull, Lu, Cyrl, 1 },
+	/*  160 */ { 0x0000030000000000ull, Ll, Cyrl, 2 },
+	/*  161 */ { 0x0000030000000000ull, Ll, Cyrl, 92 },
+	/*  162 */ { 0x0000030001000000ull, Ll, Cyrl, 92 },
+	/*  163 */ { 0x0000030000000000ull, Lu, Cyrl, 5 },
+	/*  164 */ { 0x0000030000000000ull, Ll, Cyrl, 6 },
+	/*  165 */ { 0x0000000000000000ull, So, Cyrl, 0 },
+	/*  166 */ { 0x0000020000001000ull, Mn, Cyrl, 0 },
+	/*  167 */ { 0x0000000000000000ull, Me, Cyrl, 0 },
+	/*  168 */ { 0x0000030000000000ull, Lu, Cyrl, 99 },
+	/*  169 */ { 0x0000030000000000ull, Ll, Cyrl, 100 },
+	/*  170 */ { 0x0000030000000000ull, Lu, Armn, 101 },
+	/*  171 */ { 0x0000030000001000ull, Lm, Armn, 0 },
+	/*  172 */ { 0x0000000000000000ull, Po, Armn, 0 },
+	/*  173 */ { 0x0000030000000000ull, Ll, Armn, 0 },
+	/*  174 */ { 0x0000030000000000ull, Ll, Armn, 102 },
+	/*  175 */ { 0x0000000010000040ull, Po, Zyyy, 0 },
+	/*  176 */ { 0x0000000000000018ull, Pd, Armn, 0 },
+	/*  177 */ { 0x0000000000000000ull, So, Armn, 0 },
+	/*  178 */ { 0x0000000000000000ull, Sc, Armn, 0 },
+	/*  179 */ { 0x0000020000001000ull, Mn, Hebr, 0 },
+	/*  180 */ { 0x0000020000000000ull, Mn, Hebr, 0 },
+	/*  181 */ { 0x0000020000001400ull, Mn, Hebr, 0 },
+	/*  182 */ { 0x0000000000000008ull, Pd, Hebr, 0 },
+	/*  183 */ { 0x0000000000000000ull, Po, Hebr, 0 },
+	/*  184 */ { 0x0000000000000040ull, Po, Hebr, 0 },
+	/*  185 */ { 0x0000020000000400ull, Mn, Hebr, 0 },
+	/*  186 */ { 0x0000030000000000ull, Lo, Hebr, 0 },
+	/*  187 */ { 0x0000000100000000ull, Cf, Arab, 0 },
+	/*  188 */ { 0x0000000100000000ull, Cf, Zyyy, 0 },
+	/*  189 */ { 0x0000000000000000ull, Sm, Arab, 0 },
+	/*  190 */ { 0x0000000000000000ull, Po, Arab, 0 },
+	/*  191 */ { 0x0000000000000000ull, Sc, Arab, 0 },
+	/*  192 */ { 0x0000000000000000ull, So, Arab, 0 },
+	/*  193 */ { 0x0000020000000400ull, Mn, Arab, 0 },
+	/*  194 */ { 0x0000000000000002ull, Cf, Arab, 0 },
+	/*  195 */ { 0x0000000010000040ull, Po, Arab, 0 },
+	/*  196 */ { 0x0000030000000000ull, Lo, Arab, 0 },
+	/*  197 */ { 0x0000030000002000ull, Lm, Zyyy, 0 },
+	/*  198 */ { 0x0000020000001400ull, Mn, Zinh, 0 },
+	/*  199 */ { 0x0000020000000400ull, Mn, Zinh, 0 },
+	/*  200 */ { 0x0000020000001400ull, Mn, Arab, 0 },
+	/*  201 */ { 0x0000020000001000ull, Mn, Arab, 0 },
+	/*  202 */ { 0x0000020000000000ull, Nd, Arab, 0 },
+	/*  203 */ { 0x0000030000800000ull, Lo, Arab, 0 },
+	/*  204 */ { 0x0000030000001000ull, Lm, Arab, 0 },
+	/*  205 */ { 0x0000000010000040ull, Po, Syrc, 0 },
+	/*  206 */ { 0x0000000000000040ull, Po, Syrc, 0 },
+	/*  207 */ { 0x0000000000000000ull, Po, Syrc, 0 },
+	/*  208 */ { 0x0000000100000000ull, Cf, Syrc, 0 },
+	/*  209 */ { 0x0000030000000000ull, Lo, Syrc, 0 },
+	/*  210 */ { 0x0000020000000400ull, Mn, Syrc, 0 },
+	/*  211 */ { 0x0000020000001400ull, Mn, Syrc, 0 },
+	/*  212 */ { 0x0000020000001000ull, Mn, Syrc, 0 },
+	/*  213 */ { 0x0000030000000000ull, Lo, Thaa, 0 },
+	/*  214 */ { 0x0000020000001400ull, Mn, Thaa, 0 },
+	/*  215 */ { 0x0000020000000000ull, Nd, Nkoo, 0 },
+	/*  216 */ { 0x0000030000000000ull, Lo, Nkoo, 0 },
+	/*  217 */ { 0x0000020000001000ull, Mn, Nkoo, 0 },
+	/*  218 */ { 0x0000030000001000ull, Lm, Nkoo, 0 },
+	/*  219 */ { 0x0000000000000000ull, So, Nkoo, 0 },
+	/*  220 */ { 0x0000000000000000ull, Po, Nkoo, 0 },
+	/*  221 */ { 0x0000000000000040ull, Po, Nkoo, 0 },
+	/*  222 */ { 0x0000000010000040ull, Po, Nkoo, 0 },
+	/*  223 */ { 0x0000030000002000ull, Lm, Nkoo, 0 },
+	/*  224 */ { 0x0000020000000000ull, Mn, Nkoo, 0 },
+	/*  225 */ { 0x0000000000000000ull, Sc, Nkoo, 0 },
+	/*  226 */ { 0x0000030000000000ull, Lo, Samr, 0 },
+	/*  227 */ { 0x0000020000000400ull, Mn, Samr, 0 },
+	/*  228 */ { 0x0000020000001000ull, Mn, Samr, 0 },
+	/*  229 */ { 0x0000030000000000ull, Lm, Samr, 0 },
+	/*  230 */ { 0x0000020000000000ull, Mn, Samr, 0 },
+	/*  231 */ { 0x0000000000000040ull, Po, Samr, 0 },
+	/*  232 */ { 0x0000000010000040ull, Po, Samr, 0 },
+	/*  233 */ { 0x0000030000000000ull, Lo, Mand, 0 },
+	/*  234 */ { 0x0000020000000000ull, Mn, Mand, 0 },
+	/*  235 */ { 0x0000000000000040ull, Po, Mand, 0 },
+	/*  236 */ { 0x0000020000000000ull, Mn, Arab, 0 },
+	/*  237 */ { 0x0000020000000400ull, Mn, Deva, 0 },
+	/*  238 */ { 0x0000020000000400ull, Mc, Deva, 0 },
+	/*  239 */ { 0x0000030000000000ull, Lo, Deva, 0 },
+	/*  240 */ { 0x0000020000001000ull, Mn, Deva, 0 },
+	/*  241 */ { 0x0000020000000000ull, Nd, Deva, 0 },
+	/*  242 */ { 0x0000000000000000ull, Po, Deva, 0 },
+	/*  243 */ { 0x0000030000001000ull, Lm, Deva, 0 },
+	/*  244 */ { 0x0000030000000000ull, Lo, Beng, 0 },
+	/*  245 */ { 0x0000020000000400ull, Mn, Beng, 0 },
+	/*  246 */ { 0x0000020000000400ull, Mc, Beng, 0 },
+	/*  247 */ { 0x0000020000001000ull, Mn, Beng, 0 },
+	/*  248 */ { 0x0000020000020400ull, Mc, Beng, 0 },
+	/*  249 */ { 0x0000020000000000ull, Nd, Beng, 0 },
+	/*  250 */ { 0x0000000000000000ull, Sc, Beng, 0 },
+	/*  251 */ { 0x0000000000000000ull, No, Beng, 0 },
+	/*  252 */ { 0x0000000000000000ull, So, Beng, 0 },
+	/*  253 */ { 0x0000000000000000ull, Po, Beng, 0 },
+	/*  254 */ { 0x0000020000000000ull, Mn, Beng, 0 },
+	/*  255 */ { 0x0000020000000400ull, Mn, Guru, 0 },
+	/*  256 */ { 0x0000020000000400ull, Mc, Guru, 0 },
+	/*  257 */ { 0x0000030000000000ull, Lo, Guru, 0 },
+	/*  258 */ { 0x0000020000001000ull, Mn, Guru, 0 },
+	/*  259 */ { 0x0000020000000000ull, Nd, Guru, 0 },
+	/*  260 */ { 0x0000000000000000ull, Po, Guru, 0 },
+	/*  261 */ { 0x0000020000000400ull, Mn, Gujr, 0 },
+	/*  262 */ { 0x0000020000000400ull, Mc, Gujr, 0 },
+	/*  263 */ { 0x0000030000000000ull, Lo, Gujr, 0 },
+	/*  264 */ { 0x0000020000001000ull, Mn, Gujr, 0 },
+	/*  265 */ { 0x0000020000000000ull, Nd, Gujr, 0 },
+	/*  266 */ { 0x0000000000000000ull, Po, Gujr, 0 },
+	/*  267 */ { 0x0000000000000000ull, Sc, Gujr, 0 },
+	/*  268 */ { 0x0000020000000400ull, Mn, Orya, 0 },
+	/*  269 */ { 0x0000020000000400ull, Mc, Orya, 0 },
+	/*  270 */ { 0x0000030000000000ull, Lo, Orya, 0 },
+	/*  271 */ { 0x0000020000001000ull, Mn, Orya, 0 },
+	/*  272 */ { 0x0000020000020400ull, Mc, Orya, 0 },
+	/*  273 */ { 0x0000020000000000ull, Nd, Orya, 0 },
+	/*  274 */ { 0x0000000000000000ull, So, Orya, 0 },
+	/*  275 */ { 0x0000000000000000ull, No, Orya, 0 },
+	/*  276 */ { 0x0000020000000400ull, Mn, Taml, 0 },
+	/*  277 */ { 0x0000030000000000ull, Lo, Taml, 0 },
+	/*  278 */ { 0x0000020000020400ull, Mc, Taml, 0 },
+	/*  279 */ { 0x0000020000000400ull, Mc, Taml, 0 },
+	/*  280 */ { 0x0000020000001000ull, Mn, Taml, 0 },
+	/*  281 */ { 0x0000020000000000ull, Nd, Taml, 0 },
+	/*  282 */ { 0x0000000000000000ull, No, Taml, 0 },
+	/*  283 */ { 0x0000000000000000ull, So, Taml, 0 },
+	/*  284 */ { 0x0000000000000000ull, Sc, Taml, 0 },
+	/*  285 */ { 0x0000020000000400ull, Mn, Telu, 0 },
+	/*  286 */ { 0x0000020000000400ull, Mc, Telu, 0 },
+	/*  287 */ { 0x0000020000000000ull, Mn, Telu, 0 },
+	/*  288 */ { 0x0000030000000000ull, Lo, Telu, 0 },
+	/*  289 */ { 0x0000020000001000ull, Mn, Telu, 0 },
+	/*  290 */ { 0x0000020000000000ull, Nd, Telu, 0 },
+	/*  291 */ { 0x0000000000000000ull, Po, Telu, 0 },
+	/*  292 */ { 0x0000000000000000ull, No, Telu, 0 },
+	/*  293 */ { 0x0000000000000000ull, So, Telu, 0 },
+	/*  294 */ { 0x0000030000000000ull, Lo, Knda, 0 },
+	/*  295 */ { 0x0000020000000400ull, Mn, Knda, 0 },
+	/*  296 */ { 0x0000020000000400ull, Mc, Knda, 0 },
+	/*  297 */ { 0x0000000000000000ull, Po, Knda, 0 },
+	/*  298 */ { 0x0000020000001000ull, Mn, Knda, 0 },
+	/*  299 */ { 0x0000020000020400ull, Mc, Knda, 0 },
+	/*  300 */ { 0x0000020000000000ull, Nd, Knda, 0 },
+	/*  301 */ { 0x0000020000000400ull, Mn, Mlym, 0 },
+	/*  302 */ { 0x0000020000000400ull, Mc, Mlym, 0 },
+	/*  303 */ { 0x0000030000000000ull, Lo, Mlym, 0 },
+	/*  304 */ { 0x0000020000001000ull, Mn, Mlym, 0 },
+	/*  305 */ { 0x0000020000020400ull, Mc, Mlym, 0 },
+	/*  306 */ { 0x0000000000000000ull, So, Mlym, 0 },
+	/*  307 */ { 0x0000000000000000ull, No, Mlym, 0 },
+	/*  308 */ { 0x0000020000000000ull, Nd, Mlym, 0 },
+	/*  309 */ { 0x0000020000000400ull, Mc, Sinh, 0 },
+	/*  310 */ { 0x0000030000000000ull, Lo, Sinh, 0 },
+	/*  311 */ { 0x0000020000001000ull, Mn, Sinh, 0 },
+	/*  312 */ { 0x0000020000020400ull, Mc, Sinh, 0 },
+	/*  313 */ { 0x0000020000000400ull, Mn, Sinh, 0 },
+	/*  314 */ { 0x0000020000000000ull, Nd, Sinh, 0 },
+	/*  315 */ { 0x0000000000000000ull, Po, Sinh, 0 },
+	/*  316 */ { 0x0000030000000000ull, Lo, Thai, 0 },
+	/*  317 */ { 0x0000020000000400ull, Mn, Thai, 0 },
+	/*  318 */ { 0x0000020000000000ull, Lo, Thai, 0 },
+	/*  319 */ { 0x0000000000000000ull, Sc, Zyyy, 0 },
+	/*  320 */ { 0x0000030002000000ull, Lo, Thai, 0 },
+	/*  321 */ { 0x0000030000002000ull, Lm, Thai, 0 },
+	/*  322 */ { 0x0000020000001000ull, Mn, Thai, 0 },
+	/*  323 */ { 0x0000000000000000ull, Po, Thai, 0 },
+	/*  324 */ { 0x0000020000000000ull, Nd, Thai, 0 },
+	/*  325 */ { 0x0000000000000040ull, Po, Thai, 0 },
+	/*  326 */ { 0x0000030000000000ull, Lo, Laoo, 0 },
+	/*  327 */ { 0x0000020000000400ull, Mn, Laoo, 0 },
+	/*  328 */ { 0x0000020000000000ull, Lo, Laoo, 0 },
+	/*  329 */ { 0x0000020000001000ull, Mn, Laoo, 0 },
+	/*  330 */ { 0x0000030002000000ull, Lo, Laoo, 0 },
+	/*  331 */ { 0x0000030000002000ull, Lm, Laoo, 0 },
+	/*  332 */ { 0x0000020000000000ull, Nd, Laoo, 0 },
+	/*  333 */ { 0x0000030000000000ull, Lo, Tibt, 0 },
+	/*  334 */ { 0x0000000000000000ull, So, Tibt, 0 },
+	/*  335 */ { 0x0000000000000000ull, Po, Tibt, 0 },
+	/*  336 */ { 0x0000000000000040ull, Po, Tibt, 0 },
+	/*  337 */ { 0x0000020000001000ull, Mn, Tibt, 0 },
+	/*  338 */ { 0x0000020000000000ull, Nd, Tibt, 0 },
+	/*  339 */ { 0x0000000000000000ull, No, Tibt, 0 },
+	/*  340 */ { 0x0000000000000000ull, Ps, Tibt, 0 },
+	/*  341 */ { 0x0000000000000000ull, Pe, Tibt, 0 },
+	/*  342 */ { 0x0000020000001000ull, Mc, Tibt, 0 },
+	/*  343 */ { 0x0000020000000400ull, Mn, Tibt, 0 },
+	/*  344 */ { 0x0000020000800400ull, Mn, Tibt, 0 },
+	/*  345 */ { 0x0000020000000400ull, Mc, Tibt, 0 },
+	/*  346 */ { 0x0000000000000000ull, So, Zyyy, 0 },
+	/*  347 */ { 0x0000030000000000ull, Lo, Mymr, 0 },
+	/*  348 */ { 0x0000020000000400ull, Mc, Mymr, 0 },
+	/*  349 */ { 0x0000020000000400ull, Mn, Mymr, 0 },
+	/*  350 */ { 0x0000020000001000ull, Mn, Mymr, 0 },
+	/*  351 */ { 0x0000020000000000ull, Nd, Mymr, 0 },
+	/*  352 */ { 0x0000000010000040ull, Po, Mymr, 0 },
+	/*  353 */ { 0x0000000000000000ull, Po, Mymr, 0 },
+	/*  354 */ { 0x0000020000001400ull, Mc, Mymr, 0 },
+	/*  355 */ { 0x0000020000001400ull, Mn, Mymr, 0 },
+	/*  356 */ { 0x0000000000000000ull, So, Mymr, 0 },
+	/*  357 */ { 0x0000030000000000ull, Lu, Geor, 103 },
+	/*  358 */ { 0x0000030000000000ull, Ll, Geor, 104 },
+	/*  359 */ { 0x0000000000000000ull, Po, Zyyy, 0 },
+	/*  360 */ { 0x0000030000000000ull, Lm, Geor, 0 },
+	/*  361 */ { 0x0000030000000000ull, Lo, Hang, 0 },
+	/*  362 */ { 0x0000030000400000ull, Lo, Hang, 0 },
+	/*  363 */ { 0x0000030000000000ull, Lo, Ethi, 0 },
+	/*  364 */ { 0x0000020000001000ull, Mn, Ethi, 0 },
+	/*  365 */ { 0x0000000000000000ull, Po, Ethi, 0 },
+	/*  366 */ { 0x0000000000000040ull, Po, Ethi, 0 },
+	/*  367 */ { 0x0000000010000040ull, Po, Ethi, 0 },
+	/*  368 */ { 0x0000020008000000ull, No, Ethi, 0 },
+	/*  369 */ { 0x0000000000000000ull, No, Ethi, 0 },
+	/*  370 */ { 0x0000000000000000ull, So, Ethi, 0 },
+	/*  371 */ { 0x0000030000000000ull, Lu, Cher, 105 },
+	/*  372 */ { 0x0000030000000000ull, Lu, Cher, 85 },
+	/*  373 */ { 0x0000030000000000ull, Ll, Cher, 90 },
+	/*  374 */ { 0x0000000000000008ull, Pd, Cans, 0 },
+	/*  375 */ { 0x0000030000000000ull, Lo, Cans, 0 },
+	/*  376 */ { 0x0000000000000000ull, So, Cans, 0 },
+	/*  377 */ { 0x0000000010000040ull, Po, Cans, 0 },
+	/*  378 */ { 0x0000000000000001ull, Zs, Ogam, 0 },
+	/*  379 */ { 0x0000030000000000ull, Lo, Ogam, 0 },
+	/*  380 */ { 0x0000000000000000ull, Ps, Ogam, 0 },
+	/*  381 */ { 0x0000000000000000ull, Pe, Ogam, 0 },
+	/*  382 */ { 0x0000030000000000ull, Lo, Runr, 0 },
+	/*  383 */ { 0x0000030000000000ull, Nl, Runr, 0 },
+	/*  384 */ { 0x0000030000000000ull, Lo, Tglg, 0 },
+	/*  385 */ { 0x0000020000000400ull, Mn, Tglg, 0 },
+	/*  386 */ { 0x0000020000000000ull, Mn, Tglg, 0 },
+	/*  387 */ { 0x0000030000000000ull, Lo, Hano, 0 },
+	/*  388 */ { 0x0000020000000400ull, Mn, Hano, 0 },
+	/*  389 */ { 0x0000020000000000ull, Mn, Hano, 0 },
+	/*  390 */ { 0x0000030000000000ull, Lo, Buhd, 0 },
+	/*  391 */ { 0x0000020000000400ull, Mn, Buhd, 0 },
+	/*  392 */ { 0x0000030000000000ull, Lo, Tagb, 0 },
+	/*  393 */ { 0x0000020000000400ull, Mn, Tagb, 0 },
+	/*  394 */ { 0x0000030000000000ull, Lo, Khmr, 0 },
+	/*  395 */ { 0x0000030000800000ull, Lo, Khmr, 0 },
+	/*  396 */ { 0x0000020000400000ull, Mn, Khmr, 0 },
+	/*  397 */ { 0x0000020000000400ull, Mc, Khmr, 0 },
+	/*  398 */ { 0x0000020000000400ull, Mn, Khmr, 0 },
+	/*  399 */ { 0x0000020000001000ull, Mn, Khmr, 0 },
+	/*  400 */ { 0x0000000000000040ull, Po, Khmr, 0 },
+	/*  401 */ { 0x0000030000000000ull, Lm, Khmr, 0 },
+	/*  402 */ { 0x0000000000000000ull, Po, Khmr, 0 },
+	/*  403 */ { 0x0000000000000000ull, Sc, Khmr, 0 },
+	/*  404 */ { 0x0000020000000000ull, Nd, Khmr, 0 },
+	/*  405 */ { 0x0000000000000000ull, No, Khmr, 0 },
+	/*  406 */ { 0x0000000000000000ull, Po, Mong, 0 },
+	/*  407 */ { 0x0000000000000040ull, Po, Mong, 0 },
+	/*  408 */ { 0x0000000000000018ull, Pd, Mong, 0 },
+	/*  409 */ { 0x0000000010000040ull, Po, Mong, 0 },
+	/*  410 */ { 0x0000000000002000ull, Po, Mong, 0 },
+	/*  411 */ { 0x0000020020000000ull, Mn, Mong, 0 },
+	/*  412 */ { 0x0000000000000000ull, Cf, Mong, 0 },
+	/*  413 */ { 0x0000020000000000ull, Nd, Mong, 0 },
+	/*  414 */ { 0x0000030000000000ull, Lo, Mong, 0 },
+	/*  415 */ { 0x0000030000002000ull, Lm, Mong, 0 },
+	/*  416 */ { 0x0000030004000400ull, Mn, Mong, 0 },
+	/*  417 */ { 0x0000020000000400ull, Mn, Mong, 0 },
+	/*  418 */ { 0x0000030000000000ull, Lo, Limb, 0 },
+	/*  419 */ { 0x0000020000000400ull, Mn, Limb, 0 },
+	/*  420 */ { 0x0000020000000400ull, Mc, Limb, 0 },
+	/*  421 */ { 0x0000020000001000ull, Mn, Limb, 0 },
+	/*  422 */ { 0x0000000000000000ull, So, Limb, 0 },
+	/*  423 */ { 0x0000000010000040ull, Po, Limb, 0 },
+	/*  424 */ { 0x0000020000000000ull, Nd, Limb, 0 },
+	/*  425 */ { 0x0000030000000000ull, Lo, Tale, 0 },
+	/*  426 */ { 0x0000030000000000ull, Lo, Talu, 0 },
+	/*  427 */ { 0x0000030002000000ull, Lo, Talu, 0 },
+	/*  428 */ { 0x0000020000000000ull, Nd, Talu, 0 },
+	/*  429 */ { 0x0000020008000000ull, No, Talu, 0 },
+	/*  430 */ { 0x0000000000000000ull, So, Talu, 0 },
+	/*  431 */ { 0x0000000000000000ull, So, Khmr, 0 },
+	/*  432 */ { 0x0000030000000000ull, Lo, Bugi, 0 },
+	/*  433 */ { 0x0000020000000400ull, Mn, Bugi, 0 },
+	/*  434 */ { 0x0000020000000400ull, Mc, Bugi, 0 },
+	/*  435 */ { 0x0000000000000000ull, Po, Bugi, 0 },
+	/*  436 */ { 0x0000030000000000ull, Lo, Lana, 0 },
+	/*  437 */ { 0x0000020000000400ull, Mc, Lana, 0 },
+	/*  438 */ { 0x0000020000000400ull, Mn, Lana, 0 },
+	/*  439 */ { 0x0000020000000000ull, Mn, Lana, 0 },
+	/*  440 */ { 0x0000020000001000ull, Mn, Lana, 0 },
+	/*  441 */ { 0x0000020000000000ull, Nd, Lana, 0 },
+	/*  442 */ { 0x0000000000000000ull, Po, Lana, 0 },
+	/*  443 */ { 0x0000030000002000ull, Lm, Lana, 0 },
+	/*  444 */ { 0x0000000010000040ull, Po, Lana, 0 },
+	/*  445 */ { 0x0000000000000000ull, Me, Zinh, 0 },
+	/*  446 */ { 0x0000020000000400ull, Mn, Bali, 0 },
+	/*  447 */ { 0x0000020000000400ull, Mc, Bali, 0 },
+	/*  448 */ { 0x0000030000000000ull, Lo, Bali, 0 },
+	/*  449 */ { 0x0000020000001000ull, Mn, Bali, 0 },
+	/*  450 */ { 0x0000020000020400ull, Mc, Bali, 0 },
+	/*  451 */ { 0x0000020000001000ull, Mc, Bali, 0 },
+	/*  452 */ { 0x0000020000000000ull, Nd, Bali, 0 },
+	/*  453 */ { 0x0000000010000040ull, Po, Bali, 0 },
+	/*  454 */ { 0x0000000000000000ull, Po, Bali, 0 },
+	/*  455 */ { 0x0000000000000040ull, Po, Bali, 0 },
+	/*  456 */ { 0x0000000000000000ull, So, Bali, 0 },
+	/*  457 */ { 0x0000020000000400ull, Mn, Sund, 0 },
+	/*  458 */ { 0x0000020000000400ull, Mc, Sund, 0 },
+	/*  459 */ { 0x0000030000000000ull, Lo, Sund, 0 },
+	/*  460 */ { 0x0000020000001000ull, Mc, Sund, 0 },
+	/*  461 */ { 0x0000020000001000ull, Mn, Sund, 0 },
+	/*  462 */ { 0x0000020000000000ull, Nd, Sund, 0 },
+	/*  463 */ { 0x0000030000000000ull, Lo, Batk, 0 },
+	/*  464 */ { 0x0000020000000000ull, Mn, Batk, 0 },
+	/*  465 */ { 0x0000020000000400ull, Mc, Batk, 0 },
+	/*  466 */ { 0x0000020000000400ull, Mn, Batk, 0 },
+	/*  467 */ { 0x0000020000000000ull, Mc, Batk, 0 },
+	/*  468 */ { 0x0000000000000000ull, Po, Batk, 0 },
+	/*  469 */ { 0x0000030000000000ull, Lo, Lepc, 0 },
+	/*  470 */ { 0x0000020000000400ull, Mc, Lepc, 0 },
+	/*  471 */ { 0x0000020000000400ull, Mn, Lepc, 0 },
+	/*  472 */ { 0x0000020000003400ull, Mn, Lepc, 0 },
+	/*  473 */ { 0x0000020000001000ull, Mn, Lepc, 0 },
+	/*  474 */ { 0x0000000010000040ull, Po, Lepc, 0 },
+	/*  475 */ { 0x0000000000000040ull, Po, Lepc, 0 },
+	/*  476 */ { 0x0000020000000000ull, Nd, Lepc, 0 },
+	/*  477 */ { 0x0000020000000000ull, Nd, Olck, 0 },
+	/*  478 */ { 0x0000030000000000ull, Lo, Olck, 0 },
+	/*  479 */ { 0x0000030000001000ull, Lm, Olck, 0 },
+	/*  480 */ { 0x0000030000003000ull, Lm, Olck, 0 },
+	/*  481 */ { 0x0000000010000040ull, Po, Olck, 0 },
+	/*  482 */ { 0x0000030000000000ull, Ll, Cyrl, 106 },
+	/*  483 */ { 0x0000030000000000ull, Ll, Cyrl, 107 },
+	/*  484 */ { 0x0000030000000000ull, Ll, Cyrl, 108 },
+	/*  485 */ { 0x0000030000000000ull, Ll, Cyrl, 109 },
+	/*  486 */ { 0x0000030000000000ull, Ll, Cyrl, 110 },
+	/*  487 */ { 0x0000030000000000ull, Ll, Cyrl, 111 },
+	/*  488 */ { 0x0000030000000000ull, Ll, Cyrl, 112 },
+	/*  489 */ { 0x0000030000000000ull, Ll, Cyrl, 113 },
+	/*  490 */ { 0x0000030000000000ull, Lu, Geor, 114 },
+	/*  491 */ { 0x0000000000000000ull, Po, Sund, 0 },
+	/*  492 */ { 0x0000000000001000ull, Po, Zyyy, 0 },
+	/*  493 */ { 0x0000020000001000ull, Mc, Zyyy, 0 },
+	/*  494 */ { 0x0000030000000000ull, Lo, Zyyy, 0 },
+	/*  495 */ { 0x0000030000000000ull, Ll, Cyrl, 0 },
+	/*  496 */ { 0x0000030000005000ull, Lm, Grek, 0 },
+	/*  497 */ { 0x0000030000004000ull, Lm, Cyrl, 0 },
+	/*  498 */ { 0x0000030000000000ull, Ll, Latn, 115 },
+	/*  499 */ { 0x0000030000000000ull, Ll, Latn, 116 },
+	/*  500 */ { 0x0000030000000000ull, Ll, Latn, 117 },
+	/*  501 */ { 0x0000030001000000ull, Ll, Latn, 0 },
+	/*  502 */ { 0x0000030000004000ull, Lm, Latn, 0 },
+	/*  503 */ { 0x0000030001004000ull, Lm, Latn, 0 },
+	/*  504 */ { 0x0000030000004000ull, Lm, Grek, 0 },
+	/*  505 */ { 0x0000030000000000ull, Ll, Latn, 118 },
+	/*  506 */ { 0x0000030000000000ull, Lu, Latn, 119 },
+	/*  507 */ { 0x0000030000000000ull, Ll, Grek, 120 },
+	/*  508 */ { 0x0000030000000000ull, Lu, Grek, 121 },
+	/*  509 */ { 0x0000030000000000ull, Ll, Grek, 122 },
+	/*  510 */ { 0x0000030000000000ull, Ll, Grek, 123 },
+	/*  511 */ { 0x0000030000000000ull, Ll, Grek, 124 },
+	/*  512 */ { 0x0000030000000000ull, Ll, Grek, 125 },
+	/*  513 */ { 0x0000030000000000ull, Ll, Grek, 126 },
+	/*  514 */ { 0x0000030000000000ull, Ll, Grek, 127 },
+	/*  515 */ { 0x0000030000000000ull, Lt, Grek, 121 },
+	/*  516 */ { 0x0000030000000000ull, Ll, Grek, 128 },
+	/*  517 */ { 0x0000030000000000ull, Lu, Grek, 129 },
+	/*  518 */ { 0x0000030000000000ull, Lt, Grek, 130 },
+	/*  519 */ { 0x0000030000000000ull, Ll, Grek, 131 },
+	/*  520 */ { 0x0000030000000000ull, Lu, Grek, 132 },
+	/*  521 */ { 0x0000030000000000ull, Lu, Grek, 133 },
+	/*  522 */ { 0x0000030000000000ull, Lu, Grek, 134 },
+	/*  523 */ { 0x0000030000000000ull, Lu, Grek, 135 },
+	/*  524 */ { 0x0000030000000000ull, Lu, Grek, 136 },
+	/*  525 */ { 0x0000000000000000ull, Cf, Zyyy, 0 },
+	/*  526 */ { 0x0000000000020004ull, Cf, Zinh, 0 },
+	/*  527 */ { 0x0000004000000004ull, Cf, Zinh, 0 },
+	/*  528 */ { 0x0000000040000002ull, Cf, Zyyy, 0 },
+	/*  529 */ { 0x0000000080000008ull, Pd, Zyyy, 0 },
+	/*  530 */ { 0x0000000080000080ull, Po, Zyyy, 0 },
+	/*  531 */ { 0x0000000080000020ull, Ps, Zyyy, 0 },
+	/*  532 */ { 0x0000000040000001ull, Zl, Zyyy, 0 },
+	/*  533 */ { 0x0000000040000001ull, Zp, Zyyy, 0 },
+	/*  534 */ { 0x0000000000000002ull, Cf, Zyyy, 0 },
+	/*  535 */ { 0x0000008290000040ull, Po, Zyyy, 0 },
+	/*  536 */ { 0x0000020000000080ull, Pc, Zyyy, 0 },
+	/*  537 */ { 0x0000000080000008ull, Po, Zyyy, 0 },
+	/*  538 */ { 0x0000000000000080ull, Cf, Zyyy, 0 },
+	/*  539 */ { 0x0000000000400000ull, Cn, Zzzz, 0 },
+	/*  540 */ { 0x0000000000800000ull, Cf, Zyyy, 0 },
+	/*  541 */ { 0x0000000000000000ull, Sm, Zyyy, 0 },
+	/*  542 */ { 0x0000000000000008ull, Sm, Zyyy, 0 },
+	/*  543 */ { 0x0000000000000080ull, Ps, Zyyy, 0 },
+	/*  544 */ { 0x0000000000000080ull, Pe, Zyyy, 0 },
+	/*  545 */ { 0x0000020000000080ull, Mn, Zinh, 0 },
+	/*  546 */ { 0x0000004000000000ull, Me, Zinh, 0 },
+	/*  547 */ { 0x0000030000000080ull, Lu, Zyyy, 0 },
+	/*  548 */ { 0x0000030000000080ull, Ll, Zyyy, 0 },
+	/*  549 */ { 0x0000030004000000ull, Sm, Zyyy, 0 },
+	/*  550 */ { 0x0000008200000000ull, So, Zyyy, 0 },
+	/*  551 */ { 0x0000030000000000ull, Lu, Grek, 137 },
+	/*  552 */ { 0x0000000000000080ull, So, Zyyy, 0 },
+	/*  553 */ { 0x0000030000000000ull, Lu, Latn, 138 },
+	/*  554 */ { 0x0000030000000000ull, Lu, Latn, 139 },
+	/*  555 */ { 0x0000030004000000ull, So, Zyyy, 0 },
+	/*  556 */ { 0x0000030000000000ull, Lu, Latn, 140 },
+	/*  557 */ { 0x0000030000000080ull, Lo, Zyyy, 0 },
+	/*  558 */ { 0x0000038200000000ull, Ll, Zyyy, 0 },
+	/*  559 */ { 0x0000030001000080ull, Ll, Zyyy, 0 },
+	/*  560 */ { 0x0000030000000000ull, Ll, Latn, 141 },
+	/*  561 */ { 0x0000030000008000ull, Nl, Latn, 142 },
+	/*  562 */ { 0x0000030000004000ull, Nl, Latn, 143 },
+	/*  563 */ { 0x0000030000000000ull, Nl, Latn, 0 },
+	/*  564 */ { 0x0000008280000000ull, Sm, Zyyy, 0 },
+	/*  565 */ { 0x0000008280000080ull, So, Zyyy, 0 },
+	/*  566 */ { 0x0000000080000080ull, So, Zyyy, 0 },
+	/*  567 */ { 0x0000000080000008ull, Sm, Zyyy, 0 },
+	/*  568 */ { 0x0000000080000080ull, Ps, Zyyy, 0 },
+	/*  569 */ { 0x0000000080000080ull, Pe, Zyyy, 0 },
+	/*  570 */ { 0x0000008680000000ull, So, Zyyy, 0 },
+	/*  571 */ { 0x0000000080800000ull, Ps, Zyyy, 0 },
+	/*  572 */ { 0x0000000080800000ull, Pe, Zyyy, 0 },
+	/*  573 */ { 0x0000008080000000ull, So, Zyyy, 0 },
+	/*  574 */ { 0x0000000080000000ull, Cn, Zzzz, 0 },
+	/*  575 */ { 0x0000000000008400ull, So, Zyyy, 144 },
+	/*  576 */ { 0x0000008200008400ull, So, Zyyy, 144 },
+	/*  577 */ { 0x0000000000004400ull, So, Zyyy, 145 },
+	/*  578 */ { 0x0000008680000000ull, Sm, Zyyy, 0 },
+	/*  579 */ { 0x0000008080000080ull, So, Zyyy, 0 },
+	/*  580 */ { 0x0000009280000000ull, So, Zyyy, 0 },
+	/*  581 */ { 0x0000008080000000ull, Sm, Zyyy, 0 },
+	/*  582 */ { 0x0000009680000000ull, So, Zyyy, 0 },
+	/*  583 */ { 0x0000000080000000ull, So, Brai, 0 },
+	/*  584 */ { 0x0000030000000000ull, Lu, Glag, 101 },
+	/*  585 */ { 0x0000030000000000ull, Ll, Glag, 102 },
+	/*  586 */ { 0x0000030000000000ull, Lu, Latn, 146 },
+	/*  587 */ { 0x0000030000000000ull, Lu, Latn, 147 },
+	/*  588 */ { 0x0000030000000000ull, Lu, Latn, 148 },
+	/*  589 */ { 0x0000030000000000ull, Ll, Latn, 149 },
+	/*  590 */ { 0x0000030000000000ull, Ll, Latn, 150 },
+	/*  591 */ { 0x0000030000000000ull, Lu, Latn, 151 },
+	/*  592 */ { 0x0000030000000000ull, Lu, Latn, 152 },
+	/*  593 */ { 0x0000030000000000ull, Lu, Latn, 153 },
+	/*  594 */ { 0x0000030000000000ull, Lu, Latn, 154 },
+	/*  595 */ { 0x0000030000000000ull, Lu, Latn, 155 },
+	/*  596 */ { 0x0000030000000000ull, Ll, Copt, 0 },
+	/*  597 */ { 0x0000000000000000ull, So, Copt, 0 },
+	/*  598 */ { 0x0000020000001000ull, Mn, Copt, 0 },
+	/*  599 */ { 0x0000000000000000ull, Po, Copt, 0 },
+	/*  600 */ { 0x0000000000000000ull, No, Copt, 0 },
+	/*  601 */ { 0x0000030000000000ull, Ll, Geor, 156 },
+	/*  602 */ { 0x0000030000000000ull, Lo, Tfng, 0 },
+	/*  603 */ { 0x0000030000000000ull, Lm, Tfng, 0 },
+	/*  604 */ { 0x0000000000000000ull, Po, Tfng, 0 },
+	/*  605 */ { 0x0000020000000000ull, Mn, Tfng, 0 },
+	/*  606 */ { 0x0000020000000400ull, Mn, Cyrl, 0 },
+	/*  607 */ { 0x0000000080000000ull, Pi, Zyyy, 0 },
+	/*  608 */ { 0x0000000080000000ull, Pf, Zyyy, 0 },
+	/*  609 */ { 0x0000000080001000ull, Lm, Zyyy, 0 },
+	/*  610 */ { 0x0000000000100000ull, So, Hani, 0 },
+	/*  611 */ { 0x0000000000040000ull, So, Zyyy, 0 },
+	/*  612 */ { 0x0000000000080000ull, So, Zyyy, 0 },
+	/*  613 */ { 0x0000030000002000ull, Lm, Hani, 0 },
+	/*  614 */ { 0x0000030000000800ull, Lo, Zyyy, 0 },
+	/*  615 */ { 0x0000030000000800ull, Nl, Hani, 0 },
+	/*  616 */ { 0x0000000080000020ull, Pe, Zyyy, 0 },
+	/*  617 */ { 0x0000020000021000ull, Mc, Hang, 0 },
+	/*  618 */ { 0x0000008280000008ull, Pd, Zyyy, 0 },
+	/*  619 */ { 0x0000030000000000ull, Lm, Hani, 0 },
+	/*  620 */ { 0x0000008200000000ull, Po, Zyyy, 0 },
+	/*  621 */ { 0x0000030000000000ull, Lo, Hira, 0 },
+	/*  622 */ { 0x0000000004001000ull, Sk, Zyyy, 0 },
+	/*  623 */ { 0x0000030000002000ull, Lm, Hira, 0 },
+	/*  624 */ { 0x0000000000000008ull, Pd, Zyyy, 0 },
+	/*  625 */ { 0x0000030000000000ull, Lo, Kana, 0 },
+	/*  626 */ { 0x0000000000000010ull, Po, Zyyy, 0 },
+	/*  627 */ { 0x0000030000002000ull, Lm, Kana, 0 },
+	/*  628 */ { 0x0000030000000000ull, Lo, Bopo, 0 },
+	/*  629 */ { 0x0000000000000000ull, So, Hang, 0 },
+	/*  630 */ { 0x0000000000000000ull, So, Kana, 0 },
+	/*  631 */ { 0x0000030000200800ull, Lo, Hani, 0 },
+	/*  632 */ { 0x0000030000000000ull, Lo, Yiii, 0 },
+	/*  633 */ { 0x0000030000002000ull, Lm, Yiii, 0 },
+	/*  634 */ { 0x0000000000000000ull, So, Yiii, 0 },
+	/*  635 */ { 0x0000030000000000ull, Lo, Lisu, 0 },
+	/*  636 */ { 0x0000030000000000ull, Lm, Lisu, 0 },
+	/*  637 */ { 0x0000000000000040ull, Po, Lisu, 0 },
+	/*  638 */ { 0x0000000010000040ull, Po, Lisu, 0 },
+	/*  639 */ { 0x0000030000000000ull, Lo, Vaii, 0 },
+	/*  640 */ { 0x0000030000002000ull, Lm, Vaii, 0 },
+	/*  641 */ { 0x0000000000000040ull, Po, Vaii, 0 },
+	/*  642 */ { 0x0000000010000040ull, Po, Vaii, 0 },
+	/*  643 */ { 0x0000020000000000ull, Nd, Vaii, 0 },
+	/*  644 */ { 0x0000030000000000ull, Lo, Cyrl, 0 },
+	/*  645 */ { 0x0000000000000000ull, Po, Cyrl, 0 },
+	/*  646 */ { 0x0000030000001000ull, Lm, Cyrl, 0 },
+	/*  647 */ { 0x0000030000005000ull, Lm, Cyrl, 0 },
+	/*  648 */ { 0x0000030000000000ull, Lo, Bamu, 0 },
+	/*  649 */ { 0x0000030000000000ull, Nl, Bamu, 0 },
+	/*  650 */ { 0x0000020000001000ull, Mn, Bamu, 0 },
+	/*  651 */ { 0x0000000000000000ull, Po, Bamu, 0 },
+	/*  652 */ { 0x0000000010000040ull, Po, Bamu, 0 },
+	/*  653 */ { 0x0000000000000040ull, Po, Bamu, 0 },
+	/*  654 */ { 0x0000030000000000ull, Lu, Latn, 157 },
+	/*  655 */ { 0x0000030000000000ull, Lu, Latn, 158 },
+	/*  656 */ { 0x0000030000000000ull, Ll, Latn, 159 },
+	/*  657 */ { 0x0000030000000000ull, Lu, Latn, 160 },
+	/*  658 */ { 0x0000030000000000ull, Lu, Latn, 161 },
+	/*  659 */ { 0x0000030000000000ull, Lu, Latn, 162 },
+	/*  660 */ { 0x0000030000000000ull, Lu, Latn, 163 },
+	/*  661 */ { 0x0000030000000000ull, Lu, Latn, 164 },
+	/*  662 */ { 0x0000030000000000ull, Lu, Latn, 165 },
+	/*  663 */ { 0x0000030000000000ull, Lu, Latn, 166 },
+	/*  664 */ { 0x0000030000000000ull, Lu, Latn, 167 },
+	/*  665 */ { 0x0000030000000000ull, Lu, Latn, 168 },
+	/*  666 */ { 0x0000030000000000ull, Lu, Latn, 169 },
+	/*  667 */ { 0x0000030000000000ull, Lu, Latn, 170 },
+	/*  668 */ { 0x0000030000000000ull, Lo, Sylo, 0 },
+	/*  669 */ { 0x0000020000000400ull, Mn, Sylo, 0 },
+	/*  670 */ { 0x0000020000000000ull, Mn, Sylo, 0 },
+	/*  671 */ { 0x0000020000000400ull, Mc, Sylo, 0 },
+	/*  672 */ { 0x0000000000000000ull, So, Sylo, 0 },
+	/*  673 */ { 0x0000030000000000ull, Lo, Phag, 0 },
+	/*  674 */ { 0x0000000000000000ull, Po, Phag, 0 },
+	/*  675 */ { 0x0000000010000040ull, Po, Phag, 0 },
+	/*  676 */ { 0x0000020000000400ull, Mc, Saur, 0 },
+	/*  677 */ { 0x0000030000000000ull, Lo, Saur, 0 },
+	/*  678 */ { 0x0000020000001000ull, Mn, Saur, 0 },
+	/*  679 */ { 0x0000020000000400ull, Mn, Saur, 0 },
+	/*  680 */ { 0x0000000010000040ull, Po, Saur, 0 },
+	/*  681 */ { 0x0000020000000000ull, Nd, Saur, 0 },
+	/*  682 */ { 0x0000020000000000ull, Nd, Kali, 0 },
+	/*  683 */ { 0x0000030000000000ull, Lo, Kali, 0 },
+	/*  684 */ { 0x0000020000000400ull, Mn, Kali, 0 },
+	/*  685 */ { 0x0000020000001000ull, Mn, Kali, 0 },
+	/*  686 */ { 0x0000000010000040ull, Po, Kali, 0 },
+	/*  687 */ { 0x0000030000000000ull, Lo, Rjng, 0 },
+	/*  688 */ { 0x0000020000000400ull, Mn, Rjng, 0 },
+	/*  689 */ { 0x0000020000000400ull, Mc, Rjng, 0 },
+	/*  690 */ { 0x0000020000001000ull, Mc, Rjng, 0 },
+	/*  691 */ { 0x0000000000000000ull, Po, Rjng, 0 },
+	/*  692 */ { 0x0000020000000400ull, Mn, Java, 0 },
+	/*  693 */ { 0x0000020000000400ull, Mc, Java, 0 },
+	/*  694 */ { 0x0000030000000000ull, Lo, Java, 0 },
+	/*  695 */ { 0x0000020000001000ull, Mn, Java, 0 },
+	/*  696 */ { 0x0000020000001000ull, Mc, Java, 0 },
+	/*  697 */ { 0x0000000000000000ull, Po, Java, 0 },
+	/*  698 */ { 0x0000000000000040ull, Po, Java, 0 },
+	/*  699 */ { 0x0000000010000040ull, Po, Java, 0 },
+	/*  700 */ { 0x0000020000000000ull, Nd, Java, 0 },
+	/*  701 */ { 0x0000030000002000ull, Lm, Mymr, 0 },
+	/*  702 */ { 0x0000030000000000ull, Lo, Cham, 0 },
+	/*  703 */ { 0x0000020000000400ull, Mn, Cham, 0 },
+	/*  704 */ { 0x0000020000000400ull, Mc, Cham, 0 },
+	/*  705 */ { 0x0000020000000000ull, Nd, Cham, 0 },
+	/*  706 */ { 0x0000000000000000ull, Po, Cham, 0 },
+	/*  707 */ { 0x0000000010000040ull, Po, Cham, 0 },
+	/*  708 */ { 0x0000030000000000ull, Lo, Tavt, 0 },
+	/*  709 */ { 0x0000020000000400ull, Mn, Tavt, 0 },
+	/*  710 */ { 0x0000030002000000ull, Lo, Tavt, 0 },
+	/*  711 */ { 0x0000020000001000ull, Mn, Tavt, 0 },
+	/*  712 */ { 0x0000030000001000ull, Lo, Tavt, 0 },
+	/*  713 */ { 0x0000030000002000ull, Lm, Tavt, 0 },
+	/*  714 */ { 0x0000000000000000ull, Po, Tavt, 0 },
+	/*  715 */ { 0x0000000000000040ull, Po, Tavt, 0 },
+	/*  716 */ { 0x0000030000000000ull, Lo, Mtei, 0 },
+	/*  717 */ { 0x0000020000000400ull, Mc, Mtei, 0 },
+	/*  718 */ { 0x0000020000000400ull, Mn, Mtei, 0 },
+	/*  719 */ { 0x0000000010000040ull, Po, Mtei, 0 },
+	/*  720 */ { 0x0000030000002000ull, Lm, Mtei, 0 },
+	/*  721 */ { 0x0000020000001000ull, Mn, Mtei, 0 },
+	/*  722 */ { 0x0000030000000000ull, Ll, Latn, 171 },
+	/*  723 */ { 0x0000030000000000ull, Ll, Cher, 172 },
+	/*  724 */ { 0x0000020000001000ull, Mc, Mtei, 0 },
+	/*  725 */ { 0x0000020000000000ull, Nd, Mtei, 0 },
+	/*  726 */ { 0x0000000000000000ull, Cs, Zzzz, 0 },
+	/*  727 */ { 0x0000000000000000ull, Co, Zzzz, 0 },
+	/*  728 */ { 0x0000030000000800ull, Lo, Hani, 0 },
+	/*  729 */ { 0x0000000000000000ull, Sm, Hebr, 0 },
+	/*  730 */ { 0x0000000000000000ull, Sk, Arab, 0 },
+	/*  731 */ { 0x0000000000000000ull, Lo, Arab, 0 },
+	/*  732 */ { 0x0000000000010000ull, Cn, Zzzz, 0 },
+	/*  733 */ { 0x0000020020000000ull, Mn, Zinh, 0 },
+	/*  734 */ { 0x0000024020000000ull, Mn, Zinh, 0 },
+	/*  735 */ { 0x0000000000000000ull, Ps, Zyyy, 0 },
+	/*  736 */ { 0x0000000000000000ull, Pe, Zyyy, 0 },
+	/*  737 */ { 0x0000000000000020ull, Ps, Zyyy, 0 },
+	/*  738 */ { 0x0000000000000020ull, Pe, Zyyy, 0 },
+	/*  739 */ { 0x0000000000000080ull, Po, Zyyy, 0 },
+	/*  740 */ { 0x0000000000000098ull, Pd, Zyyy, 0 },
+	/*  741 */ { 0x0000000000000020ull, Po, Zyyy, 0 },
+	/*  742 */ { 0x0000000000000018ull, Pd, Zyyy, 0 },
+	/*  743 */ { 0x0000020000000100ull, Nd, Zyyy, 0 },
+	/*  744 */ { 0x0000030000000100ull, Lu, Latn, 1 },
+	/*  745 */ { 0x0000000000001080ull, Sk, Zyyy, 0 },
+	/*  746 */ { 0x0000030000000100ull, Ll, Latn, 2 },
+	/*  747 */ { 0x0000020000021000ull, Lm, Zyyy, 0 },
+	/*  748 */ { 0x0000030000000000ull, Lo, Linb, 0 },
+	/*  749 */ { 0x0000030000000000ull, Nl, Grek, 0 },
+	/*  750 */ { 0x0000000000000000ull, No, Grek, 0 },
+	/*  751 */ { 0x0000000000000000ull, So, Grek, 0 },
+	/*  752 */ { 0x0000030000000000ull, Lo, Lyci, 0 },
+	/*  753 */ { 0x0000030000000000ull, Lo, Cari, 0 },
+	/*  754 */ { 0x0000030000000000ull, Lo, Ital, 0 },
+	/*  755 */ { 0x0000000000000000ull, No, Ital, 0 },
+	/*  756 */ { 0x0000030000000000ull, Lo, Goth, 0 },
+	/*  757 */ { 0x0000030000000000ull, Nl, Goth, 0 },
+	/*  758 */ { 0x0000030000000000ull, Lo, Perm, 0 },
+	/*  759 */ { 0x0000020000000400ull, Mn, Perm, 0 },
+	/*  760 */ { 0x0000030000000000ull, Lo, Ugar, 0 },
+	/*  761 */ { 0x0000000000000040ull, Po, Ugar, 0 },
+	/*  762 */ { 0x0000030000000000ull, Lo, Xpeo, 0 },
+	/*  763 */ { 0x0000000000000040ull, Po, Xpeo, 0 },
+	/*  764 */ { 0x0000030000000000ull, Nl, Xpeo, 0 },
+	/*  765 */ { 0x0000030000000000ull, Lu, Dsrt, 173 },
+	/*  766 */ { 0x0000030000000000ull, Ll, Dsrt, 174 },
+	/*  767 */ { 0x0000030000000000ull, Lo, Shaw, 0 },
+	/*  768 */ { 0x0000030000000000ull, Lo, Osma, 0 },
+	/*  769 */ { 0x0000020000000000ull, Nd, Osma, 0 },
+	/*  770 */ { 0x0000030000000000ull, Lu, Osge, 173 },
+	/*  771 */ { 0x0000030000000000ull, Ll, Osge, 174 },
+	/*  772 */ { 0x0000030000000000ull, Lo, Elba, 0 },
+	/*  773 */ { 0x0000030000000000ull, Lo, Aghb, 0 },
+	/*  774 */ { 0x0000000000000000ull, Po, Aghb, 0 },
+	/*  775 */ { 0x0000030000000000ull, Lo, Lina, 0 },
+	/*  776 */ { 0x0000030000000000ull, Lo, Cprt, 0 },
+	/*  777 */ { 0x0000030000000000ull, Lo, Armi, 0 },
+	/*  778 */ { 0x0000000000000040ull, Po, Armi, 0 },
+	/*  779 */ { 0x0000000000000000ull, No, Armi, 0 },
+	/*  780 */ { 0x0000030000000000ull, Lo, Palm, 0 },
+	/*  781 */ { 0x0000000000000000ull, So, Palm, 0 },
+	/*  782 */ { 0x0000000000000000ull, No, Palm, 0 },
+	/*  783 */ { 0x0000030000000000ull, Lo, Nbat, 0 },
+	/*  784 */ { 0x0000000000000000ull, No, Nbat, 0 },
+	/*  785 */ { 0x0000030000000000ull, Lo, Hatr, 0 },
+	/*  786 */ { 0x0000000000000000ull, No, Hatr, 0 },
+	/*  787 */ { 0x0000030000000000ull, Lo, Phnx, 0 },
+	/*  788 */ { 0x0000000000000000ull, No, Phnx, 0 },
+	/*  789 */ { 0x0000000000000040ull, Po, Phnx, 0 },
+	/*  790 */ { 0x0000030000000000ull, Lo, Lydi, 0 },
+	/*  791 */ { 0x0000000000000000ull, Po, Lydi, 0 },
+	/*  792 */ { 0x0000030000000000ull, Lo, Mero, 0 },
+	/*  793 */ { 0x0000030000000000ull, Lo, Merc, 0 },
+	/*  794 */ { 0x0000000000000000ull, No, Merc, 0 },
+	/*  795 */ { 0x0000030000000000ull, Lo, Khar, 0 },
+	/*  796 */ { 0x0000020000000400ull, Mn, Khar, 0 },
+	/*  797 */ { 0x0000020000000000ull, Mn, Khar, 0 },
+	/*  798 */ { 0x0000000000000000ull, No, Khar, 0 },
+	/*  799 */ { 0x0000000000000000ull, Po, Khar, 0 },
+	/*  800 */ { 0x0000000010000040ull, Po, Khar, 0 },
+	/*  801 */ { 0x0000030000000000ull, Lo, Sarb, 0 },
+	/*  802 */ { 0x0000000000000000ull, No, Sarb, 0 },
+	/*  803 */ { 0x0000000000000000ull, Po, Sarb, 0 },
+	/*  804 */ { 0x0000030000000000ull, Lo, Narb, 0 },
+	/*  805 */ { 0x0000000000000000ull, No, Narb, 0 },
+	/*  806 */ { 0x0000030000000000ull, Lo, Mani, 0 },
+	/*  807 */ { 0x0000000000000000ull, So, Mani, 0 },
+	/*  808 */ { 0x0000020000001000ull, Mn, Mani, 0 },
+	/*  809 */ { 0x0000000000000000ull, No, Mani, 0 },
+	/*  810 */ { 0x0000000000000040ull, Po, Mani, 0 },
+	/*  811 */ { 0x0000000000000000ull, Po, Mani, 0 },
+	/*  812 */ { 0x0000030000000000ull, Lo, Avst, 0 },
+	/*  813 */ { 0x0000000000000000ull, Po, Avst, 0 },
+	/*  814 */ { 0x0000000000000040ull, Po, Avst, 0 },
+	/*  815 */ { 0x0000030000000000ull, Lo, Prti, 0 },
+	/*  816 */ { 0x0000000000000000ull, No, Prti, 0 },
+	/*  817 */ { 0x0000030000000000ull, Lo, Phli, 0 },
+	/*  818 */ { 0x0000000000000000ull, No, Phli, 0 },
+	/*  819 */ { 0x0000030000000000ull, Lo, Phlp, 0 },
+	/*  820 */ { 0x0000000000000040ull, Po, Phlp, 0 },
+	/*  821 */ { 0x0000000000000000ull, No, Phlp, 0 },
+	/*  822 */ { 0x0000030000000000ull, Lo, Orkh, 0 },
+	/*  823 */ { 0x0000030000000000ull, Lu, Hung, 78 },
+	/*  824 */ { 0x0000030000000000ull, Ll, Hung, 83 },
+	/*  825 */ { 0x0000000000000000ull, No, Hung, 0 },
+	/*  826 */ { 0x0000030000000000ull, Lo, Rohg, 0 },
+	/*  827 */ { 0x0000030000001000ull, Lo, Rohg, 0 },
+	/*  828 */ { 0x0000020000001400ull, Mn, Rohg, 0 },
+	/*  829 */ { 0x0000020000000000ull, Nd, Rohg, 0 },
+	/*  830 */ { 0x0000000000000000ull, No, Arab, 0 },
+	/*  831 */ { 0x0000030000000000ull, Lo, Sogo, 0 },
+	/*  832 */ { 0x0000000000000000ull, No, Sogo, 0 },
+	/*  833 */ { 0x0000030000000000ull, Lo, Sogd, 0 },
+	/*  834 */ { 0x0000020000001000ull, Mn, Sogd, 0 },
+	/*  835 */ { 0x0000000000000000ull, No, Sogd, 0 },
+	/*  836 */ { 0x0000000010000040ull, Po, Sogd, 0 },
+	/*  837 */ { 0x0000030000000000ull, Lo, Elym, 0 },
+	/*  838 */ { 0x0000020000000400ull, Mc, Brah, 0 },
+	/*  839 */ { 0x0000020000000400ull, Mn, Brah, 0 },
+	/*  840 */ { 0x0000030000000000ull, Lo, Brah, 0 },
+	/*  841 */ { 0x0000020000000000ull, Mn, Brah, 0 },
+	/*  842 */ { 0x0000000010000040ull, Po, Brah, 0 },
+	/*  843 */ { 0x0000000000000040ull, Po, Brah, 0 },
+	/*  844 */ { 0x0000000000000000ull, No, Brah, 0 },
+	/*  845 */ { 0x0000020000000000ull, Nd, Brah, 0 },
+	/*  846 */ { 0x0000020000000000ull, Mn, Kthi, 0 },
+	/*  847 */ { 0x0000020000000400ull, Mc, Kthi, 0 },
+	/*  848 */ { 0x0000030000000000ull, Lo, Kthi, 0 },
+	/*  849 */ { 0x0000020000000400ull, Mn, Kthi, 0 },
+	/*  850 */ { 0x0000020000001000ull, Mn, Kthi, 0 },
+	/*  851 */ { 0x0000000000000000ull, Po, Kthi, 0 },
+	/*  852 */ { 0x0000000100000000ull, Cf, Kthi, 0 },
+	/*  853 */ { 0x0000000010000040ull, Po, Kthi, 0 },
+	/*  854 */ { 0x0000030000000000ull, Lo, Sora, 0 },
+	/*  855 */ { 0x0000020000000000ull, Nd, Sora, 0 },
+	/*  856 */ { 0x0000020000000400ull, Mn, Cakm, 0 },
+	/*  857 */ { 0x0000030000000000ull, Lo, Cakm, 0 },
+	/*  858 */ { 0x0000020000000400ull, Mc, Cakm, 0 },
+	/*  859 */ { 0x0000020000001000ull, Mn, Cakm, 0 },
+	/*  860 */ { 0x0000020000000000ull, Nd, Cakm, 0 },
+	/*  861 */ { 0x0000000000000000ull, Po, Cakm, 0 },
+	/*  862 */ { 0x0000000010000040ull, Po, Cakm, 0 },
+	/*  863 */ { 0x0000030000000000ull, Lo, Mahj, 0 },
+	/*  864 */ { 0x0000020000001000ull, Mn, Mahj, 0 },
+	/*  865 */ { 0x0000000000000000ull, Po, Mahj, 0 },
+	/*  866 */ { 0x0000020000000400ull, Mn, Shrd, 0 },
+	/*  867 */ { 0x0000020000000400ull, Mc, Shrd, 0 },
+	/*  868 */ { 0x0000030000000000ull, Lo, Shrd, 0 },
+	/*  869 */ { 0x0000020000001000ull, Mc, Shrd, 0 },
+	/*  870 */ { 0x0000000010000040ull, Po, Shrd, 0 },
+	/*  871 */ { 0x0000000000000000ull, Po, Shrd, 0 },
+	/*  872 */ { 0x0000020000000000ull, Mn, Shrd, 0 },
+	/*  873 */ { 0x0000020000001000ull, Mn, Shrd, 0 },
+	/*  874 */ { 0x0000020000000000ull, Nd, Shrd, 0 },
+	/*  875 */ { 0x0000000000000000ull, No, Sinh, 0 },
+	/*  876 */ { 0x0000030000000000ull, Lo, Khoj, 0 },
+	/*  877 */ { 0x0000020000000400ull, Mc, Khoj, 0 },
+	/*  878 */ { 0x0000020000000400ull, Mn, Khoj, 0 },
+	/*  879 */ { 0x0000020000001000ull, Mc, Khoj, 0 },
+	/*  880 */ { 0x0000020000001000ull, Mn, Khoj, 0 },
+	/*  881 */ { 0x0000000010000040ull, Po, Khoj, 0 },
+	/*  882 */ { 0x0000000000000040ull, Po, Khoj, 0 },
+	/*  883 */ { 0x0000000000000000ull, Po, Khoj, 0 },
+	/*  884 */ { 0x0000030000000000ull, Lo, Mult, 0 },
+	/*  885 */ { 0x0000000010000040ull, Po, Mult, 0 },
+	/*  886 */ { 0x0000030000000000ull, Lo, Sind, 0 },
+	/*  887 */ { 0x0000020000000400ull, Mn, Sind, 0 },
+	/*  888 */ { 0x0000020000000400ull, Mc, Sind, 0 },
+	/*  889 */ { 0x0000020000001000ull, Mn, Sind, 0 },
+	/*  890 */ { 0x0000020000000000ull, Nd, Sind, 0 },
+	/*  891 */ { 0x0000020000000400ull, Mn, Gran, 0 },
+	/*  892 */ { 0x0000020000000400ull, Mc, Gran, 0 },
+	/*  893 */ { 0x0000030000000000ull, Lo, Gran, 0 },
+	/*  894 */ { 0x0000020000001000ull, Mn, Gran, 0 },
+	/*  895 */ { 0x0000020000020400ull, Mc, Gran, 0 },
+	/*  896 */ { 0x0000020000001000ull, Mc, Gran, 0 },
+	/*  897 */ { 0x0000030000002000ull, Lo, Gran, 0 },
+	/*  898 */ { 0x0000030000000000ull, Lo, Newa, 0 },
+	/*  899 */ { 0x0000020000000400ull, Mc, Newa, 0 },
+	/*  900 */ { 0x0000020000000400ull, Mn, Newa, 0 },
+	/*  901 */ { 0x0000020000001000ull, Mn, Newa, 0 },
+	/*  902 */ { 0x0000000010000040ull, Po, Newa, 0 },
+	/*  903 */ { 0x0000000000000040ull, Po, Newa, 0 },
+	/*  904 */ { 0x0000000000000000ull, Po, Newa, 0 },
+	/*  905 */ { 0x0000020000000000ull, Nd, Newa, 0 },
+	/*  906 */ { 0x0000020000000000ull, Mn, Newa, 0 },
+	/*  907 */ { 0x0000030000000000ull, Lo, Tirh, 0 },
+	/*  908 */ { 0x0000020000020400ull, Mc, Tirh, 0 },
+	/*  909 */ { 0x0000020000000400ull, Mc, Tirh, 0 },
+	/*  910 */ { 0x0000020000000400ull, Mn, Tirh, 0 },
+	/*  911 */ { 0x0000020000001000ull, Mn, Tirh, 0 },
+	/*  912 */ { 0x0000000000000000ull, Po, Tirh, 0 },
+	/*  913 */ { 0x0000020000000000ull, Nd, Tirh, 0 },
+	/*  914 */ { 0x0000030000000000ull, Lo, Sidd, 0 },
+	/*  915 */ { 0x0000020000020400ull, Mc, Sidd, 0 },
+	/*  916 */ { 0x0000020000000400ull, Mc, Sidd, 0 },
+	/*  917 */ { 0x0000020000000400ull, Mn, Sidd, 0 },
+	/*  918 */ { 0x0000020000001000ull, Mn, Sidd, 0 },
+	/*  919 */ { 0x0000000000000000ull, Po, Sidd, 0 },
+	/*  920 */ { 0x0000000010000040ull, Po, Sidd, 0 },
+	/*  921 */ { 0x0000000000000040ull, Po, Sidd, 0 },
+	/*  922 */ { 0x0000000000002000ull, Po, Sidd, 0 },
+	/*  923 */ { 0x0000030000000000ull, Lo, Modi, 0 },
+	/*  924 */ { 0x0000020000000400ull, Mc, Modi, 0 },
+	/*  925 */ { 0x0000020000000400ull, Mn, Modi, 0 },
+	/*  926 */ { 0x0000020000001000ull, Mn, Modi, 0 },
+	/*  927 */ { 0x0000000010000040ull, Po, Modi, 0 },
+	/*  928 */ { 0x0000000000000000ull, Po, Modi, 0 },
+	/*  929 */ { 0x0000020000000000ull, Nd, Modi, 0 },
+	/*  930 */ { 0x0000030000000000ull, Lo, Takr, 0 },
+	/*  931 */ { 0x0000020000000400ull, Mn, Takr, 0 },
+	/*  932 */ { 0x0000020000000400ull, Mc, Takr, 0 },
+	/*  933 */ { 0x0000020000001000ull, Mc, Takr, 0 },
+	/*  934 */ { 0x0000020000001000ull, Mn, Takr, 0 },
+	/*  935 */ { 0x0000020000000000ull, Nd, Takr, 0 },
+	/*  936 */ { 0x0000030000000000ull, Lo, Ahom, 0 },
+	/*  937 */ { 0x0000020000000400ull, Mn, Ahom, 0 },
+	/*  938 */ { 0x0000020000000400ull, Mc, Ahom, 0 },
+	/*  939 */ { 0x0000020000001000ull, Mn, Ahom, 0 },
+	/*  940 */ { 0x0000020000000000ull, Nd, Ahom, 0 },
+	/*  941 */ { 0x0000000000000000ull, No, Ahom, 0 },
+	/*  942 */ { 0x0000000010000040ull, Po, Ahom, 0 },
+	/*  943 */ { 0x0000000000000000ull, So, Ahom, 0 },
+	/*  944 */ { 0x0000030000000000ull, Lo, Dogr, 0 },
+	/*  945 */ { 0x0000020000000400ull, Mc, Dogr, 0 },
+	/*  946 */ { 0x0000020000000400ull, Mn, Dogr, 0 },
+	/*  947 */ { 0x0000020000001000ull, Mn, Dogr, 0 },
+	/*  948 */ { 0x0000000000000000ull, Po, Dogr, 0 },
+	/*  949 */ { 0x0000030000000000ull, Lu, Wara, 1 },
+	/*  950 */ { 0x0000030000000000ull, Ll, Wara, 2 },
+	/*  951 */ { 0x0000020000000000ull, Nd, Wara, 0 },
+	/*  952 */ { 0x0000000000000000ull, No, Wara, 0 },
+	/*  953 */ { 0x0000030000000000ull, Lo, Wara, 0 },
+	/*  954 */ { 0x0000030000000000ull, Lo, Nand, 0 },
+	/*  955 */ { 0x0000020000000400ull, Mc, Nand, 0 },
+	/*  956 */ { 0x0000020000000400ull, Mn, Nand, 0 },
+	/*  957 */ { 0x0000020000001000ull, Mn, Nand, 0 },
+	/*  958 */ { 0x0000000000000000ull, Po, Nand, 0 },
+	/*  959 */ { 0x0000030000000000ull, Lo, Zanb, 0 },
+	/*  960 */ { 0x0000020000000400ull, Mn, Zanb, 0 },
+	/*  961 */ { 0x0000020000000000ull, Mn, Zanb, 0 },
+	/*  962 */ { 0x0000020000001000ull, Mn, Zanb, 0 },
+	/*  963 */ { 0x0000020000000400ull, Mc, Zanb, 0 },
+	/*  964 */ { 0x0000000000000000ull, Po, Zanb, 0 },
+	/*  965 */ { 0x0000000010000040ull, Po, Zanb, 0 },
+	/*  966 */ { 0x0000030000000000ull, Lo, Soyo, 0 },
+	/*  967 */ { 0x0000020000000400ull, Mn, Soyo, 0 },
+	/*  968 */ { 0x0000020000000400ull, Mc, Soyo, 0 },
+	/*  969 */ { 0x0000020000002000ull, Mn, Soyo, 0 },
+	/*  970 */ { 0x0000020000001000ull, Mn, Soyo, 0 },
+	/*  971 */ { 0x0000000000000000ull, Po, Soyo, 0 },
+	/*  972 */ { 0x0000000010000040ull, Po, Soyo, 0 },
+	/*  973 */ { 0x0000000000000040ull, Po, Soyo, 0 },
+	/*  974 */ { 0x0000030000000000ull, Lo, Pauc, 0 },
+	/*  975 */ { 0x0000030000000000ull, Lo, Bhks, 0 },
+	/*  976 */ { 0x0000020000000400ull, Mc, Bhks, 0 },
+	/*  977 */ { 0x0000020000000400ull, Mn, Bhks, 0 },
+	/*  978 */ { 0x0000020000001000ull, Mn, Bhks, 0 },
+	/*  979 */ { 0x0000000010000040ull, Po, Bhks, 0 },
+	/*  980 */ { 0x0000000000000040ull, Po, Bhks, 0 },
+	/*  981 */ { 0x0000000000000000ull, Po, Bhks, 0 },
+	/*  982 */ { 0x0000020000000000ull, Nd, Bhks, 0 },
+	/*  983 */ { 0x0000000000000000ull, No, Bhks, 0 },
+	/*  984 */ { 0x0000000000000000ull, Po, Marc, 0 },
+	/*  985 */ { 0x0000000000000040ull, Po, Marc, 0 },
+	/*  986 */ { 0x0000030000000000ull, Lo, Marc, 0 },
+	/*  987 */ { 0x0000020000000400ull, Mn, Marc, 0 },
+	/*  988 */ { 0x0000020000000400ull, Mc, Marc, 0 },
+	/*  989 */ { 0x0000030000000000ull, Lo, Gonm, 0 },
+	/*  990 */ { 0x0000020000000400ull, Mn, Gonm, 0 },
+	/*  991 */ { 0x0000020000001000ull, Mn, Gonm, 0 },
+	/*  992 */ { 0x0000020000000000ull, Nd, Gonm, 0 },
+	/*  993 */ { 0x0000030000000000ull, Lo, Gong, 0 },
+	/*  994 */ { 0x0000020000000400ull, Mc, Gong, 0 },
+	/*  995 */ { 0x0000020000000400ull, Mn, Gong, 0 },
+	/*  996 */ { 0x0000020000001000ull, Mn, Gong, 0 },
+	/*  997 */ { 0x0000020000000000ull, Nd, Gong, 0 },
+	/*  998 */ { 0x0000030000000000ull, Lo, Maka, 0 },
+	/*  999 */ { 0x0000020000000400ull, Mn, Maka, 0 },
+	/* 1000 */ { 0x0000020000000400ull, Mc, Maka, 0 },
+	/* 1001 */ { 0x0000000010000040ull, Po, Maka, 0 },
+	/* 1002 */ { 0x0000000000000000ull, Po, Taml, 0 },
+	/* 1003 */ { 0x0000030000000000ull, Lo, Xsux, 0 },
+	/* 1004 */ { 0x0000030000000000ull, Nl, Xsux, 0 },
+	/* 1005 */ { 0x0000000000000040ull, Po, Xsux, 0 },
+	/* 1006 */ { 0x0000030000000000ull, Lo, Egyp, 0 },
+	/* 1007 */ { 0x0000000000000000ull, Cf, Egyp, 0 },
+	/* 1008 */ { 0x0000030000000000ull, Lo, Hluw, 0 },
+	/* 1009 */ { 0x0000030000000000ull, Lo, Mroo, 0 },
+	/* 1010 */ { 0x0000020000000000ull, Nd, Mroo, 0 },
+	/* 1011 */ { 0x0000000010000040ull, Po, Mroo, 0 },
+	/* 1012 */ { 0x0000030000000000ull, Lo, Bass, 0 },
+	/* 1013 */ { 0x0000020000001000ull, Mn, Bass, 0 },
+	/* 1014 */ { 0x0000000010000040ull, Po, Bass, 0 },
+	/* 1015 */ { 0x0000030000000000ull, Lo, Hmng, 0 },
+	/* 1016 */ { 0x0000020000001000ull, Mn, Hmng, 0 },
+	/* 1017 */ { 0x0000000010000040ull, Po, Hmng, 0 },
+	/* 1018 */ { 0x0000000000000040ull, Po, Hmng, 0 },
+	/* 1019 */ { 0x0000000000000000ull, Po, Hmng, 0 },
+	/* 1020 */ { 0x0000000000000000ull, So, Hmng, 0 },
+	/* 1021 */ { 0x0000030000000000ull, Lm, Hmng, 0 },
+	/* 1022 */ { 0x0000030000002000ull, Lm, Hmng, 0 },
+	/* 1023 */ { 0x0000020000000000ull, Nd, Hmng, 0 },
+	/* 1024 */ { 0x0000000000000000ull, No, Hmng, 0 },
+	/* 1025 */ { 0x0000030000000000ull, Lu, Medf, 1 },
+	/* 1026 */ { 0x0000030000000000ull, Ll, Medf, 2 },
+	/* 1027 */ { 0x0000000000000000ull, No, Medf, 0 },
+	/* 1028 */ { 0x0000000000000040ull, Po, Medf, 0 },
+	/* 1029 */ { 0x0000000010000040ull, Po, Medf, 0 },
+	/* 1030 */ { 0x0000000000000000ull, Po, Medf, 0 },
+	/* 1031 */ { 0x0000030000000000ull, Lo, Plrd, 0 },
+	/* 1032 */ { 0x0000020000000400ull, Mn, Plrd, 0 },
+	/* 1033 */ { 0x0000020000000400ull, Mc, Plrd, 0 },
+	/* 1034 */ { 0x0000020000001400ull, Mn, Plrd, 0 },
+	/* 1035 */ { 0x0000030000001000ull, Lm, Plrd, 0 },
+	/* 1036 */ { 0x0000030000002000ull, Lm, Tang, 0 },
+	/* 1037 */ { 0x0000030000002000ull, Lm, Nshu, 0 },
+	/* 1038 */ { 0x0000030000000800ull, Lo, Tang, 0 },
+	/* 1039 */ { 0x0000030000000800ull, Lo, Nshu, 0 },
+	/* 1040 */ { 0x0000030000000000ull, Lo, Dupl, 0 },
+	/* 1041 */ { 0x0000000000000000ull, So, Dupl, 0 },
+	/* 1042 */ { 0x0000020000000000ull, Mn, Dupl, 0 },
+	/* 1043 */ { 0x0000020000000400ull, Mn, Dupl, 0 },
+	/* 1044 */ { 0x0000000010000040ull, Po, Dupl, 0 },
+	/* 1045 */ { 0x0000020000020000ull, Mc, Zyyy, 0 },
+	/* 1046 */ { 0x0000020000000000ull, Mc, Zyyy, 0 },
+	/* 1047 */ { 0x0000020000021000ull, Mc, Zyyy, 0 },
+	/* 1048 */ { 0x0000020000000000ull, Mn, Grek, 0 },
+	/* 1049 */ { 0x0000020000000080ull, Nd, Zyyy, 0 },
+	/* 1050 */ { 0x0000000000000000ull, So, Sgnw, 0 },
+	/* 1051 */ { 0x0000020000000000ull, Mn, Sgnw, 0 },
+	/* 1052 */ { 0x0000000000000040ull, Po, Sgnw, 0 },
+	/* 1053 */ { 0x0000000010000040ull, Po, Sgnw, 0 },
+	/* 1054 */ { 0x0000000000000000ull, Po, Sgnw, 0 },
+	/* 1055 */ { 0x0000020000000400ull, Mn, Glag, 0 },
+	/* 1056 */ { 0x0000030000000000ull, Lo, Hmnp, 0 },
+	/* 1057 */ { 0x0000020000001000ull, Mn, Hmnp, 0 },
+	/* 1058 */ { 0x0000030000000000ull, Lm, Hmnp, 0 },
+	/* 1059 */ { 0x0000030000002000ull, Lm, Hmnp, 0 },
+	/* 1060 */ { 0x0000020000000000ull, Nd, Hmnp, 0 },
+	/* 1061 */ { 0x0000000000000000ull, So, Hmnp, 0 },
+	/* 1062 */ { 0x0000030000000000ull, Lo, Wcho, 0 },
+	/* 1063 */ { 0x0000020000001000ull, Mn, Wcho, 0 },
+	/* 1064 */ { 0x0000020000000000ull, Nd, Wcho, 0 },
+	/* 1065 */ { 0x0000000000000000ull, Sc, Wcho, 0 },
+	/* 1066 */ { 0x0000030000000000ull, Lo, Mend, 0 },
+	/* 1067 */ { 0x0000000000000000ull, No, Mend, 0 },
+	/* 1068 */ { 0x0000020000001000ull, Mn, Mend, 0 },
+	/* 1069 */ { 0x0000030000000000ull, Lu, Adlm, 175 },
+	/* 1070 */ { 0x0000030000000000ull, Ll, Adlm, 176 },
+	/* 1071 */ { 0x0000020000003000ull, Mn, Adlm, 0 },
+	/* 1072 */ { 0x0000020000000400ull, Mn, Adlm, 0 },
+	/* 1073 */ { 0x0000020000001000ull, Mn, Adlm, 0 },
+	/* 1074 */ { 0x0000030000000000ull, Lm, Adlm, 0 },
+	/* 1075 */ { 0x0000020000000000ull, Nd, Adlm, 0 },
+	/* 1076 */ { 0x0000000000000000ull, Po, Adlm, 0 },
+	/* 1077 */ { 0x0000030000000080ull, Lo, Arab, 0 },
+	/* 1078 */ { 0x0000008000000000ull, So, Zyyy, 0 },
+	/* 1079 */ { 0x0000008600000000ull, So, Zyyy, 0 },
+	/* 1080 */ { 0x0000008000000000ull, Cn, Zzzz, 0 },
+	/* 1081 */ { 0x0000000000008400ull, So, Zyyy, 0 },
+	/* 1082 */ { 0x0000008200008400ull, So, Zyyy, 0 },
+	/* 1083 */ { 0x0000006600000000ull, So, Zyyy, 0 },
+	/* 1084 */ { 0x0000000000000000ull, So, Hira, 0 },
+	/* 1085 */ { 0x0000009600000000ull, So, Zyyy, 0 },
+	/* 1086 */ { 0x0000009200000000ull, So, Zyyy, 0 },
+	/* 1087 */ { 0x0000004e00000000ull, Sk, Zyyy, 0 },
+	/* 1088 */ { 0x000000c600000000ull, So, Zyyy, 0 },
+	/* 1089 */ { 0x0000004000020000ull, Cf, Zyyy, 0 },
+};
+
+static const uint16_t record_pages[][256] =
+{
+	{ /* 0 : 000000 */
+		/* 00 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 1, 1,
+		/* 10 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		/* 20 */ 3, 4, 5, 6, 7, 8, 8, 5, 9, 10, 6, 11, 12, 13, 4, 8,
+		/* 30 */ 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 12, 12, 11, 11, 11, 4,
+		/* 40 */ 8, 15, 15, 15, 15, 15, 15, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		/* 50 */ 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 9, 8, 10, 17, 18,
+		/* 60 */ 19, 20, 20, 20, 20, 20, 20, 21, 21, 22, 22, 21, 21, 21, 21, 21,
+		/* 70 */ 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 9, 11, 10, 11, 1,
+		/* 80 */ 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		/* 90 */ 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+		/* A0 */ 23, 8, 7, 7, 7, 7, 24, 8, 25, 26, 27, 28, 11, 29, 26, 25,
+		/* B0 */ 24, 11, 30, 30, 25, 31, 8, 32, 25, 30, 27, 33, 30, 30, 30, 8,
+		/* C0 */ 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		/* D0 */ 16, 16, 16, 16, 16, 16, 16, 11, 16, 16, 16, 16, 16, 16, 16, 34,
+		/* E0 */ 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+		/* F0 */ 21, 21, 21, 21, 21, 21, 21, 11, 21, 21, 21, 21, 21, 21, 21, 35,
+	},
+	{ /* 1 : 000100 */
+		/* 00 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 10 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 20 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 38,
+		/* 30 */ 39, 40, 36, 37, 36, 37, 36, 37, 34, 36, 37, 36, 37, 36, 37, 36,
+		/* 40 */ 37, 36, 37, 36, 37, 36, 37, 36, 37, 41, 36, 37, 36, 37, 36, 37,
+		/* 50 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 60 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 70 */ 36, 37, 36, 37, 36, 37, 36, 37, 42, 36, 37, 36, 37, 36, 37, 43,
+		/* 80 */ 44, 45, 36, 37, 36, 37, 46, 36, 37, 47, 47, 36, 37, 34, 48, 49,
+		/* 90 */ 50, 36, 37, 47, 51, 52, 53, 54, 36, 37, 55, 34, 53, 56, 57, 58,
+		/* A0 */ 36, 37, 36, 37, 36, 37, 59, 36, 37, 59, 34, 34, 36, 37, 59, 36,
+		/* B0 */ 37, 60, 60, 36, 37, 36, 37, 61, 36, 37, 34, 62, 36, 37, 34, 63,
+		/* C0 */ 62, 62, 62, 62, 64, 65, 66, 64, 65, 66, 64, 65, 66, 36, 37, 36,
+		/* D0 */ 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 67, 36, 37,
+		/* E0 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* F0 */ 34, 64, 65, 66, 36, 37, 68, 69, 36, 37, 36, 37, 36, 37, 36, 37,
+	},
+	{ /* 2 : 000200 */
+		/* 00 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 10 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 20 */ 70, 34, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 30 */ 36, 37, 36, 37, 34, 34, 34, 34, 34, 34, 71, 36, 37, 72, 73, 74,
+		/* 40 */ 74, 36, 37, 75, 76, 77, 36, 37, 36, 38, 36, 37, 36, 37, 36, 37,
+		/* 50 */ 78, 79, 80, 81, 82, 34, 83, 83, 34, 84, 34, 85, 86, 34, 34, 34,
+		/* 60 */ 83, 87, 34, 88, 34, 89, 90, 34, 91, 92, 90, 93, 94, 34, 34, 92,
+		/* 70 */ 34, 95, 96, 34, 34, 97, 34, 34, 34, 34, 34, 34, 34, 98, 34, 34,
+		/* 80 */ 99, 34, 100, 99, 34, 34, 34, 101, 99, 102, 103, 103, 104, 34, 34, 34,
+		/* 90 */ 34, 34, 105, 34, 62, 34, 34, 34, 34, 34, 34, 34, 34, 106, 107, 34,
+		/* A0 */ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		/* B0 */ 108, 108, 109, 108, 108, 108, 108, 108, 108, 110, 110, 110, 110, 110, 110, 110,
+		/* C0 */ 111, 111, 25, 25, 25, 25, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+		/* D0 */ 112, 112, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+		/* E0 */ 108, 108, 108, 108, 108, 25, 25, 25, 25, 25, 113, 113, 110, 25, 110, 25,
+		/* F0 */ 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+	},
+	{ /* 3 : 000300 */
+		/* 00 */ 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+		/* 10 */ 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+		/* 20 */ 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+		/* 30 */ 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+		/* 40 */ 114, 114, 114, 114, 114, 115, 114, 114, 114, 114, 114, 114, 114, 114, 114, 116,
+		/* 50 */ 114, 114, 114, 114, 114, 114, 114, 114, 117, 117, 117, 117, 117, 114, 114, 114,
+		/* 60 */ 114, 114, 114, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		/* 70 */ 118, 119, 118, 119, 110, 120, 118, 119, 121, 121, 122, 123, 123, 123, 124, 125,
+		/* 80 */ 121, 121, 121, 121, 120, 25, 126, 127, 128, 128, 128, 121, 129, 121, 130, 130,
+		/* 90 */ 131, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
+		/* A0 */ 132, 132, 121, 132, 132, 132, 132, 132, 132, 132, 132, 132, 133, 134, 134, 134,
+		/* B0 */ 131, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
+		/* C0 */ 135, 135, 136, 135, 135, 135, 135, 135, 135, 135, 135, 135, 137, 138, 138, 139,
+		/* D0 */ 140, 141, 142, 143, 143, 144, 145, 146, 118, 119, 118, 119, 118, 119, 118, 119,
+		/* E0 */ 118, 119, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148,
+		/* F0 */ 149, 150, 151, 152, 153, 154, 155, 118, 119, 156, 118, 119, 131, 157, 157, 157,
+	},
+	{ /* 4 : 000400 */
+		/* 00 */ 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158, 158,
+		/* 10 */ 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+		/* 20 */ 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159, 159,
+		/* 30 */ 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+		/* 40 */ 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160, 160,
+		/* 50 */ 161, 161, 161, 161, 161, 161, 162, 161, 162, 161, 161, 161, 161, 161, 161, 161,
+		/* 60 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* 70 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* 80 */ 163, 164, 165, 166, 166, 114, 114, 166, 167, 167, 163, 164, 163, 164, 163, 164,
+		/* 90 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* A0 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* B0 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* C0 */ 168, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 169,
+		/* D0 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* E0 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* F0 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+	},
+	{ /* 5 : 000500 */
+		/* 00 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* 10 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* 20 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* 30 */ 121, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		/* 40 */ 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170, 170,
+		/* 50 */ 170, 170, 170, 170, 170, 170, 170, 121, 121, 171, 172, 172, 172, 172, 172, 172,
+		/* 60 */ 173, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+		/* 70 */ 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174, 174,
+		/* 80 */ 174, 174, 174, 174, 174, 174, 174, 173, 173, 175, 176, 121, 121, 177, 177, 178,
+		/* 90 */ 121, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+		/* A0 */ 179, 179, 180, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179, 179,
+		/* B0 */ 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 181, 182, 181,
+		/* C0 */ 183, 181, 181, 184, 181, 185, 183, 185, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+		/* E0 */ 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186, 121, 121, 121, 121, 186,
+		/* F0 */ 186, 186, 186, 183, 183, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 6 : 000600 */
+		/* 00 */ 187, 187, 187, 187, 187, 188, 189, 189, 189, 190, 190, 191, 124, 190, 192, 192,
+		/* 10 */ 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 124, 194, 121, 195, 175,
+		/* 20 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 30 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 40 */ 197, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 198, 198, 198, 198, 198,
+		/* 50 */ 198, 198, 198, 199, 199, 199, 193, 200, 201, 193, 193, 193, 193, 193, 193, 193,
+		/* 60 */ 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 190, 190, 190, 190, 196, 196,
+		/* 70 */ 199, 196, 196, 203, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 80 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 90 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* A0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* B0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* C0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* D0 */ 196, 196, 196, 196, 195, 196, 193, 193, 193, 193, 193, 193, 193, 188, 192, 201,
+		/* E0 */ 201, 193, 193, 193, 193, 204, 204, 193, 193, 192, 201, 201, 201, 193, 196, 196,
+		/* F0 */ 202, 202, 202, 202, 202, 202, 202, 202, 202, 202, 196, 196, 196, 192, 192, 196,
+	},
+	{ /* 7 : 000700 */
+		/* 00 */ 205, 205, 205, 206, 206, 206, 206, 206, 206, 206, 206, 207, 206, 207, 121, 208,
+		/* 10 */ 209, 210, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+		/* 20 */ 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209,
+		/* 30 */ 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211, 211,
+		/* 40 */ 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 212, 121, 121, 209, 209, 209,
+		/* 50 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 60 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 70 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 80 */ 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+		/* 90 */ 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213, 213,
+		/* A0 */ 213, 213, 213, 213, 213, 213, 214, 214, 214, 214, 214, 214, 214, 214, 214, 214,
+		/* B0 */ 214, 213, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 216, 216, 216, 216, 216, 216,
+		/* D0 */ 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216,
+		/* E0 */ 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 216, 217, 217, 217, 217, 217,
+		/* F0 */ 217, 217, 217, 217, 218, 218, 219, 220, 221, 222, 223, 121, 121, 224, 225, 225,
+	},
+	{ /* 8 : 000800 */
+		/* 00 */ 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226, 226,
+		/* 10 */ 226, 226, 226, 226, 226, 226, 227, 227, 228, 228, 229, 227, 227, 227, 227, 227,
+		/* 20 */ 227, 227, 227, 227, 229, 227, 227, 227, 229, 227, 227, 227, 227, 230, 121, 121,
+		/* 30 */ 231, 231, 231, 231, 231, 231, 231, 232, 231, 232, 231, 231, 231, 232, 232, 121,
+		/* 40 */ 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233, 233,
+		/* 50 */ 233, 233, 233, 233, 233, 233, 233, 233, 233, 234, 234, 234, 121, 121, 235, 121,
+		/* 60 */ 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 209, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* B0 */ 196, 196, 196, 196, 196, 121, 196, 196, 196, 196, 196, 196, 196, 196, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 236, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193, 193,
+		/* E0 */ 236, 236, 188, 200, 200, 200, 200, 200, 200, 200, 201, 201, 201, 201, 201, 201,
+		/* F0 */ 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 193,
+	},
+	{ /* 9 : 000900 */
+		/* 00 */ 237, 237, 237, 238, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+		/* 10 */ 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+		/* 20 */ 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+		/* 30 */ 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 237, 238, 240, 239, 238, 238,
+		/* 40 */ 238, 237, 237, 237, 237, 237, 237, 237, 237, 238, 238, 238, 238, 240, 238, 238,
+		/* 50 */ 239, 114, 114, 114, 114, 237, 237, 237, 239, 239, 239, 239, 239, 239, 239, 239,
+		/* 60 */ 239, 239, 237, 237, 175, 175, 241, 241, 241, 241, 241, 241, 241, 241, 241, 241,
+		/* 70 */ 242, 243, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239, 239,
+		/* 80 */ 244, 245, 246, 246, 121, 244, 244, 244, 244, 244, 244, 244, 244, 121, 121, 244,
+		/* 90 */ 244, 121, 121, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244, 244,
+		/* A0 */ 244, 244, 244, 244, 244, 244, 244, 244, 244, 121, 244, 244, 244, 244, 244, 244,
+		/* B0 */ 244, 121, 244, 121, 121, 121, 244, 244, 244, 244, 121, 121, 247, 244, 248, 246,
+		/* C0 */ 246, 245, 245, 245, 245, 121, 121, 246, 246, 121, 121, 246, 246, 247, 244, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 248, 121, 121, 121, 121, 244, 244, 121, 244,
+		/* E0 */ 244, 244, 245, 245, 121, 121, 249, 249, 249, 249, 249, 249, 249, 249, 249, 249,
+		/* F0 */ 244, 244, 250, 250, 251, 251, 251, 251, 251, 251, 252, 250, 244, 253, 254, 121,
+	},
+	{ /* 10 : 000A00 */
+		/* 00 */ 121, 255, 255, 256, 121, 257, 257, 257, 257, 257, 257, 121, 121, 121, 121, 257,
+		/* 10 */ 257, 121, 121, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257, 257,
+		/* 20 */ 257, 257, 257, 257, 257, 257, 257, 257, 257, 121, 257, 257, 257, 257, 257, 257,
+		/* 30 */ 257, 121, 257, 257, 121, 257, 257, 121, 257, 257, 121, 121, 258, 121, 256, 256,
+		/* 40 */ 256, 255, 255, 121, 121, 121, 121, 255, 255, 121, 121, 255, 255, 258, 121, 121,
+		/* 50 */ 121, 255, 121, 121, 121, 121, 121, 121, 121, 257, 257, 257, 257, 121, 257, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 259, 259, 259, 259, 259, 259, 259, 259, 259, 259,
+		/* 70 */ 255, 255, 257, 257, 257, 255, 260, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 261, 261, 262, 121, 263, 263, 263, 263, 263, 263, 263, 263, 263, 121, 263,
+		/* 90 */ 263, 263, 121, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263, 263,
+		/* A0 */ 263, 263, 263, 263, 263, 263, 263, 263, 263, 121, 263, 263, 263, 263, 263, 263,
+		/* B0 */ 263, 121, 263, 263, 121, 263, 263, 263, 263, 263, 121, 121, 264, 263, 262, 262,
+		/* C0 */ 262, 261, 261, 261, 261, 261, 121, 261, 261, 262, 121, 262, 262, 264, 121, 121,
+		/* D0 */ 263, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 263, 263, 261, 261, 121, 121, 265, 265, 265, 265, 265, 265, 265, 265, 265, 265,
+		/* F0 */ 266, 267, 121, 121, 121, 121, 121, 121, 121, 263, 261, 261, 261, 264, 264, 264,
+	},
+	{ /* 11 : 000B00 */
+		/* 00 */ 121, 268, 269, 269, 121, 270, 270, 270, 270, 270, 270, 270, 270, 121, 121, 270,
+		/* 10 */ 270, 121, 121, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270, 270,
+		/* 20 */ 270, 270, 270, 270, 270, 270, 270, 270, 270, 121, 270, 270, 270, 270, 270, 270,
+		/* 30 */ 270, 121, 270, 270, 121, 270, 270, 270, 270, 270, 121, 121, 271, 270, 272, 268,
+		/* 40 */ 269, 268, 268, 268, 268, 121, 121, 269, 269, 121, 121, 269, 269, 271, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 268, 272, 121, 121, 121, 121, 270, 270, 121, 270,
+		/* 60 */ 270, 270, 268, 268, 121, 121, 273, 273, 273, 273, 273, 273, 273, 273, 273, 273,
+		/* 70 */ 274, 270, 275, 275, 275, 275, 275, 275, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 276, 277, 121, 277, 277, 277, 277, 277, 277, 121, 121, 121, 277, 277,
+		/* 90 */ 277, 121, 277, 277, 277, 277, 121, 121, 121, 277, 277, 121, 277, 121, 277, 277,
+		/* A0 */ 121, 121, 121, 277, 277, 121, 121, 121, 277, 277, 277, 121, 121, 121, 277, 277,
+		/* B0 */ 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 121, 121, 121, 121, 278, 279,
+		/* C0 */ 276, 279, 279, 121, 121, 121, 279, 279, 279, 121, 279, 279, 279, 280, 121, 121,
+		/* D0 */ 277, 121, 121, 121, 121, 121, 121, 278, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281,
+		/* F0 */ 282, 282, 282, 283, 283, 283, 283, 283, 283, 284, 283, 121, 121, 121, 121, 121,
+	},
+	{ /* 12 : 000C00 */
+		/* 00 */ 285, 286, 286, 286, 287, 288, 288, 288, 288, 288, 288, 288, 288, 121, 288, 288,
+		/* 10 */ 288, 121, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 288,
+		/* 20 */ 288, 288, 288, 288, 288, 288, 288, 288, 288, 121, 288, 288, 288, 288, 288, 288,
+		/* 30 */ 288, 288, 288, 288, 288, 288, 288, 288, 288, 288, 121, 121, 121, 288, 285, 285,
+		/* 40 */ 285, 286, 286, 286, 286, 121, 285, 285, 285, 121, 285, 285, 285, 289, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 285, 285, 121, 288, 288, 288, 121, 121, 121, 121, 121,
+		/* 60 */ 288, 288, 285, 285, 121, 121, 290, 290, 290, 290, 290, 290, 290, 290, 290, 290,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 291, 292, 292, 292, 292, 292, 292, 292, 293,
+		/* 80 */ 294, 295, 296, 296, 297, 294, 294, 294, 294, 294, 294, 294, 294, 121, 294, 294,
+		/* 90 */ 294, 121, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294, 294,
+		/* A0 */ 294, 294, 294, 294, 294, 294, 294, 294, 294, 121, 294, 294, 294, 294, 294, 294,
+		/* B0 */ 294, 294, 294, 294, 121, 294, 294, 294, 294, 294, 121, 121, 298, 294, 296, 295,
+		/* C0 */ 296, 296, 299, 296, 296, 121, 295, 296, 296, 121, 296, 296, 295, 298, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 299, 299, 121, 121, 121, 121, 121, 121, 121, 294, 121,
+		/* E0 */ 294, 294, 295, 295, 121, 121, 300, 300, 300, 300, 300, 300, 300, 300, 300, 300,
+		/* F0 */ 121, 294, 294, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 13 : 000D00 */
+		/* 00 */ 301, 301, 302, 302, 121, 303, 303, 303, 303, 303, 303, 303, 303, 121, 303, 303,
+		/* 10 */ 303, 121, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303,
+		/* 20 */ 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303,
+		/* 30 */ 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 303, 304, 304, 303, 305, 302,
+		/* 40 */ 302, 301, 301, 301, 301, 121, 302, 302, 302, 121, 302, 302, 302, 304, 303, 306,
+		/* 50 */ 121, 121, 121, 121, 303, 303, 303, 305, 307, 307, 307, 307, 307, 307, 307, 303,
+		/* 60 */ 303, 303, 301, 301, 121, 121, 308, 308, 308, 308, 308, 308, 308, 308, 308, 308,
+		/* 70 */ 307, 307, 307, 307, 307, 307, 307, 307, 307, 306, 303, 303, 303, 303, 303, 303,
+		/* 80 */ 121, 121, 309, 309, 121, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+		/* 90 */ 310, 310, 310, 310, 310, 310, 310, 121, 121, 121, 310, 310, 310, 310, 310, 310,
+		/* A0 */ 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310, 310,
+		/* B0 */ 310, 310, 121, 310, 310, 310, 310, 310, 310, 310, 310, 310, 121, 310, 121, 121,
+		/* C0 */ 310, 310, 310, 310, 310, 310, 310, 121, 121, 121, 311, 121, 121, 121, 121, 312,
+		/* D0 */ 309, 309, 313, 313, 313, 121, 313, 121, 309, 309, 309, 309, 309, 309, 309, 312,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 314, 314, 314, 314, 314, 314, 314, 314, 314, 314,
+		/* F0 */ 121, 121, 309, 309, 315, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 14 : 000E00 */
+		/* 00 */ 121, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316,
+		/* 10 */ 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316,
+		/* 20 */ 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316, 316,
+		/* 30 */ 316, 317, 316, 318, 317, 317, 317, 317, 317, 317, 317, 121, 121, 121, 121, 319,
+		/* 40 */ 320, 320, 320, 320, 320, 316, 321, 322, 322, 322, 322, 322, 322, 317, 322, 323,
+		/* 50 */ 324, 324, 324, 324, 324, 324, 324, 324, 324, 324, 325, 325, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 326, 326, 121, 326, 121, 326, 326, 326, 326, 326, 121, 326, 326, 326, 326,
+		/* 90 */ 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326, 326,
+		/* A0 */ 326, 326, 326, 326, 121, 326, 121, 326, 326, 326, 326, 326, 326, 326, 326, 326,
+		/* B0 */ 326, 327, 326, 328, 327, 327, 327, 327, 327, 327, 329, 327, 327, 326, 121, 121,
+		/* C0 */ 330, 330, 330, 330, 330, 121, 331, 121, 329, 329, 329, 329, 329, 327, 121, 121,
+		/* D0 */ 332, 332, 332, 332, 332, 332, 332, 332, 332, 332, 121, 121, 326, 326, 326, 326,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 15 : 000F00 */
+		/* 00 */ 333, 334, 334, 334, 335, 335, 335, 335, 336, 335, 335, 335, 335, 336, 336, 336,
+		/* 10 */ 336, 336, 336, 334, 335, 334, 334, 334, 337, 337, 334, 334, 334, 334, 334, 334,
+		/* 20 */ 338, 338, 338, 338, 338, 338, 338, 338, 338, 338, 339, 339, 339, 339, 339, 339,
+		/* 30 */ 339, 339, 339, 339, 334, 337, 334, 337, 334, 337, 340, 341, 340, 341, 342, 342,
+		/* 40 */ 333, 333, 333, 333, 333, 333, 333, 333, 121, 333, 333, 333, 333, 333, 333, 333,
+		/* 50 */ 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333,
+		/* 60 */ 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 333, 121, 121, 121,
+		/* 70 */ 121, 343, 343, 343, 343, 343, 343, 344, 343, 344, 343, 343, 343, 343, 343, 345,
+		/* 80 */ 343, 343, 337, 337, 337, 335, 337, 337, 333, 333, 333, 333, 333, 343, 343, 343,
+		/* 90 */ 343, 343, 343, 343, 343, 343, 343, 343, 121, 343, 343, 343, 343, 343, 343, 343,
+		/* A0 */ 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343,
+		/* B0 */ 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 343, 121, 334, 334,
+		/* C0 */ 334, 334, 334, 334, 334, 334, 337, 334, 334, 334, 334, 334, 334, 121, 334, 334,
+		/* D0 */ 335, 335, 335, 335, 335, 346, 346, 346, 346, 335, 335, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 16 : 001000 */
+		/* 00 */ 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347,
+		/* 10 */ 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347,
+		/* 20 */ 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 348, 348, 349, 349, 349,
+		/* 30 */ 349, 348, 349, 349, 349, 349, 349, 350, 348, 350, 350, 348, 348, 349, 349, 347,
+		/* 40 */ 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 352, 352, 353, 353, 353, 353,
+		/* 50 */ 347, 347, 347, 347, 347, 347, 348, 348, 349, 349, 347, 347, 347, 347, 349, 349,
+		/* 60 */ 349, 347, 348, 354, 354, 347, 347, 348, 348, 354, 354, 354, 354, 354, 347, 347,
+		/* 70 */ 347, 349, 349, 349, 349, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347,
+		/* 80 */ 347, 347, 349, 348, 348, 349, 349, 354, 354, 354, 354, 354, 354, 355, 347, 354,
+		/* 90 */ 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 354, 354, 348, 349, 356, 356,
+		/* A0 */ 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+		/* B0 */ 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357, 357,
+		/* C0 */ 357, 357, 357, 357, 357, 357, 121, 357, 121, 121, 121, 121, 121, 357, 121, 121,
+		/* D0 */ 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+		/* E0 */ 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358,
+		/* F0 */ 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 358, 359, 360, 358, 358, 358,
+	},
+	{ /* 17 : 001100 */
+		/* 00 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 10 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 20 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 30 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 40 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 50 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 362,
+		/* 60 */ 362, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 70 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 80 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 90 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* A0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* B0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* C0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* D0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* E0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* F0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+	},
+	{ /* 18 : 001200 */
+		/* 00 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 10 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 20 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 30 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 40 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 121, 363, 363, 363, 363, 121, 121,
+		/* 50 */ 363, 363, 363, 363, 363, 363, 363, 121, 363, 121, 363, 363, 363, 363, 121, 121,
+		/* 60 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 70 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 80 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 121, 363, 363, 363, 363, 121, 121,
+		/* 90 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* A0 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* B0 */ 363, 121, 363, 363, 363, 363, 121, 121, 363, 363, 363, 363, 363, 363, 363, 121,
+		/* C0 */ 363, 121, 363, 363, 363, 363, 121, 121, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* D0 */ 363, 363, 363, 363, 363, 363, 363, 121, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* E0 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* F0 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+	},
+	{ /* 19 : 001300 */
+		/* 00 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 10 */ 363, 121, 363, 363, 363, 363, 121, 121, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 20 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 30 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 40 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 50 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 121, 121, 364, 364, 364,
+		/* 60 */ 365, 366, 367, 366, 366, 366, 366, 367, 367, 368, 368, 368, 368, 368, 368, 368,
+		/* 70 */ 368, 368, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 369, 121, 121, 121,
+		/* 80 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 90 */ 370, 370, 370, 370, 370, 370, 370, 370, 370, 370, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371,
+		/* B0 */ 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371,
+		/* C0 */ 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371,
+		/* D0 */ 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371,
+		/* E0 */ 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371, 371,
+		/* F0 */ 372, 372, 372, 372, 372, 372, 121, 121, 373, 373, 373, 373, 373, 373, 121, 121,
+	},
+	{ /* 20 : 001400 */
+		/* 00 */ 374, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 10 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 20 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 30 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 40 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 50 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 60 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 70 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 80 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 90 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* A0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* B0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* C0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* D0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* E0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* F0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+	},
+	{ /* 21 : 001500 */
+		/* 00 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 10 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 20 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 30 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 40 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 50 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 60 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 70 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 80 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 90 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* A0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* B0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* C0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* D0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* E0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* F0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+	},
+	{ /* 22 : 001600 */
+		/* 00 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 10 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 20 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 30 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 40 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 50 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 60 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 376, 377, 375,
+		/* 70 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* 80 */ 378, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379,
+		/* 90 */ 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 379, 380, 381, 121, 121, 121,
+		/* A0 */ 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+		/* B0 */ 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+		/* C0 */ 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+		/* D0 */ 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382,
+		/* E0 */ 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 382, 124, 124, 124, 383, 383,
+		/* F0 */ 383, 382, 382, 382, 382, 382, 382, 382, 382, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 23 : 001700 */
+		/* 00 */ 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 384, 121, 384, 384,
+		/* 10 */ 384, 384, 385, 385, 386, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387, 387,
+		/* 30 */ 387, 387, 388, 388, 389, 175, 175, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390, 390,
+		/* 50 */ 390, 390, 391, 391, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 392, 121, 392, 392,
+		/* 70 */ 392, 121, 393, 393, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+		/* 90 */ 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+		/* A0 */ 394, 394, 394, 395, 395, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394, 394,
+		/* B0 */ 394, 394, 394, 394, 396, 396, 397, 398, 398, 398, 398, 398, 398, 398, 397, 397,
+		/* C0 */ 397, 397, 397, 397, 397, 397, 398, 397, 397, 399, 399, 399, 399, 399, 399, 399,
+		/* D0 */ 399, 399, 399, 399, 400, 400, 400, 401, 402, 402, 400, 403, 394, 399, 121, 121,
+		/* E0 */ 404, 404, 404, 404, 404, 404, 404, 404, 404, 404, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 405, 405, 405, 405, 405, 405, 405, 405, 405, 405, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 24 : 001800 */
+		/* 00 */ 406, 406, 124, 175, 407, 124, 408, 406, 407, 409, 410, 411, 411, 411, 412, 121,
+		/* 10 */ 413, 413, 413, 413, 413, 413, 413, 413, 413, 413, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+		/* 30 */ 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+		/* 40 */ 414, 414, 414, 415, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+		/* 50 */ 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+		/* 60 */ 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+		/* 70 */ 414, 414, 414, 414, 414, 414, 414, 414, 414, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 414, 414, 414, 414, 414, 416, 416, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+		/* 90 */ 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414, 414,
+		/* A0 */ 414, 414, 414, 414, 414, 414, 414, 414, 414, 417, 414, 121, 121, 121, 121, 121,
+		/* B0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* C0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* D0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* E0 */ 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375, 375,
+		/* F0 */ 375, 375, 375, 375, 375, 375, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 25 : 001900 */
+		/* 00 */ 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418,
+		/* 10 */ 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 418, 121,
+		/* 20 */ 419, 419, 419, 420, 420, 420, 420, 419, 419, 420, 420, 420, 121, 121, 121, 121,
+		/* 30 */ 420, 420, 419, 420, 420, 420, 420, 420, 420, 421, 421, 421, 121, 121, 121, 121,
+		/* 40 */ 422, 121, 121, 121, 423, 423, 424, 424, 424, 424, 424, 424, 424, 424, 424, 424,
+		/* 50 */ 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425,
+		/* 60 */ 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 425, 121, 121,
+		/* 70 */ 425, 425, 425, 425, 425, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426,
+		/* 90 */ 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426,
+		/* A0 */ 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 121, 121, 121, 121,
+		/* B0 */ 426, 426, 426, 426, 426, 427, 427, 427, 426, 426, 427, 426, 426, 426, 426, 426,
+		/* C0 */ 426, 426, 426, 426, 426, 426, 426, 426, 426, 426, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 428, 428, 428, 428, 428, 428, 428, 428, 428, 428, 429, 121, 121, 121, 430, 430,
+		/* E0 */ 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431,
+		/* F0 */ 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431, 431,
+	},
+	{ /* 26 : 001A00 */
+		/* 00 */ 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432, 432,
+		/* 10 */ 432, 432, 432, 432, 432, 432, 432, 433, 433, 434, 434, 433, 121, 121, 435, 435,
+		/* 20 */ 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436,
+		/* 30 */ 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436,
+		/* 40 */ 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436, 436,
+		/* 50 */ 436, 436, 436, 436, 436, 437, 438, 437, 438, 438, 438, 438, 438, 438, 438, 121,
+		/* 60 */ 439, 437, 438, 437, 437, 438, 438, 438, 438, 438, 438, 438, 438, 437, 437, 437,
+		/* 70 */ 437, 437, 437, 438, 438, 440, 440, 440, 440, 440, 440, 440, 440, 121, 121, 440,
+		/* 80 */ 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 441, 441, 441, 441, 441, 441, 441, 441, 441, 441, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 442, 442, 442, 442, 442, 442, 442, 443, 444, 444, 444, 444, 442, 442, 121, 121,
+		/* B0 */ 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 445, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 27 : 001B00 */
+		/* 00 */ 446, 446, 446, 446, 447, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448,
+		/* 10 */ 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448,
+		/* 20 */ 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448, 448,
+		/* 30 */ 448, 448, 448, 448, 449, 450, 446, 446, 446, 446, 446, 447, 446, 447, 447, 447,
+		/* 40 */ 447, 447, 446, 447, 451, 448, 448, 448, 448, 448, 448, 448, 121, 121, 121, 121,
+		/* 50 */ 452, 452, 452, 452, 452, 452, 452, 452, 452, 452, 453, 453, 454, 455, 453, 453,
+		/* 60 */ 454, 456, 456, 456, 456, 456, 456, 456, 456, 456, 456, 449, 449, 449, 449, 449,
+		/* 70 */ 449, 449, 449, 449, 456, 456, 456, 456, 456, 456, 456, 456, 456, 121, 121, 121,
+		/* 80 */ 457, 457, 458, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+		/* 90 */ 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459, 459,
+		/* A0 */ 459, 458, 457, 457, 457, 457, 458, 458, 457, 457, 460, 461, 457, 457, 459, 459,
+		/* B0 */ 462, 462, 462, 462, 462, 462, 462, 462, 462, 462, 459, 459, 459, 459, 459, 459,
+		/* C0 */ 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463,
+		/* D0 */ 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463, 463,
+		/* E0 */ 463, 463, 463, 463, 463, 463, 464, 465, 466, 466, 465, 465, 465, 466, 465, 466,
+		/* F0 */ 466, 466, 467, 467, 121, 121, 121, 121, 121, 121, 121, 121, 468, 468, 468, 468,
+	},
+	{ /* 28 : 001C00 */
+		/* 00 */ 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469,
+		/* 10 */ 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469, 469,
+		/* 20 */ 469, 469, 469, 469, 470, 470, 470, 470, 470, 470, 470, 470, 471, 471, 471, 471,
+		/* 30 */ 471, 471, 471, 471, 470, 470, 472, 473, 121, 121, 121, 474, 474, 475, 475, 475,
+		/* 40 */ 476, 476, 476, 476, 476, 476, 476, 476, 476, 476, 121, 121, 121, 469, 469, 469,
+		/* 50 */ 477, 477, 477, 477, 477, 477, 477, 477, 477, 477, 478, 478, 478, 478, 478, 478,
+		/* 60 */ 478, 478, 478, 478, 478, 478, 478, 478, 478, 478, 478, 478, 478, 478, 478, 478,
+		/* 70 */ 478, 478, 478, 478, 478, 478, 478, 478, 479, 479, 479, 480, 479, 479, 481, 481,
+		/* 80 */ 482, 483, 484, 485, 485, 486, 487, 488, 489, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490,
+		/* A0 */ 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490,
+		/* B0 */ 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 490, 121, 121, 490, 490, 490,
+		/* C0 */ 491, 491, 491, 491, 491, 491, 491, 491, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 114, 114, 114, 492, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+		/* E0 */ 114, 493, 114, 114, 114, 114, 114, 114, 114, 494, 494, 494, 494, 114, 494, 494,
+		/* F0 */ 494, 494, 494, 494, 114, 494, 494, 493, 114, 114, 494, 121, 121, 121, 121, 121,
+	},
+	{ /* 29 : 001D00 */
+		/* 00 */ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		/* 10 */ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		/* 20 */ 34, 34, 34, 34, 34, 34, 131, 131, 131, 131, 131, 495, 108, 108, 108, 108,
+		/* 30 */ 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+		/* 40 */ 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108,
+		/* 50 */ 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 108, 496, 496, 496,
+		/* 60 */ 496, 496, 109, 108, 108, 108, 496, 496, 496, 496, 496, 34, 34, 34, 34, 34,
+		/* 70 */ 34, 34, 34, 34, 34, 34, 34, 34, 497, 498, 34, 34, 34, 499, 34, 34,
+		/* 80 */ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 500, 34,
+		/* 90 */ 34, 34, 34, 34, 34, 34, 501, 34, 34, 34, 34, 502, 502, 502, 502, 502,
+		/* A0 */ 502, 502, 502, 502, 503, 502, 502, 502, 503, 502, 502, 502, 502, 502, 502, 502,
+		/* B0 */ 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 504,
+		/* C0 */ 117, 117, 117, 117, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+		/* D0 */ 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117,
+		/* E0 */ 117, 117, 117, 117, 117, 117, 117, 199, 199, 199, 199, 199, 199, 199, 199, 199,
+		/* F0 */ 199, 199, 199, 199, 199, 114, 114, 114, 114, 114, 121, 117, 117, 114, 114, 114,
+	},
+	{ /* 30 : 001E00 */
+		/* 00 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 10 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 20 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 38, 36, 37,
+		/* 30 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 40 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 50 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 60 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 70 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 80 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 90 */ 36, 37, 36, 37, 36, 37, 34, 34, 34, 34, 34, 505, 34, 34, 506, 34,
+		/* A0 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* B0 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* C0 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 38, 36, 37, 36, 37,
+		/* D0 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* E0 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* F0 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+	},
+	{ /* 31 : 001F00 */
+		/* 00 */ 507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+		/* 10 */ 507, 507, 507, 507, 507, 507, 121, 121, 508, 508, 508, 508, 508, 508, 121, 121,
+		/* 20 */ 507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+		/* 30 */ 507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+		/* 40 */ 507, 507, 507, 507, 507, 507, 121, 121, 508, 508, 508, 508, 508, 508, 121, 121,
+		/* 50 */ 131, 507, 131, 507, 131, 507, 131, 507, 121, 508, 121, 508, 121, 508, 121, 508,
+		/* 60 */ 507, 507, 507, 507, 507, 507, 507, 507, 508, 508, 508, 508, 508, 508, 508, 508,
+		/* 70 */ 509, 509, 510, 510, 510, 510, 511, 511, 512, 512, 513, 513, 514, 514, 121, 121,
+		/* 80 */ 507, 507, 507, 507, 507, 507, 507, 507, 515, 515, 515, 515, 515, 515, 515, 515,
+		/* 90 */ 507, 507, 507, 507, 507, 507, 507, 507, 515, 515, 515, 515, 515, 515, 515, 515,
+		/* A0 */ 507, 507, 507, 507, 507, 507, 507, 507, 515, 515, 515, 515, 515, 515, 515, 515,
+		/* B0 */ 507, 507, 131, 516, 131, 121, 131, 131, 508, 508, 517, 517, 518, 120, 519, 120,
+		/* C0 */ 120, 120, 131, 516, 131, 121, 131, 131, 520, 520, 520, 520, 518, 120, 120, 120,
+		/* D0 */ 507, 507, 131, 131, 121, 121, 131, 131, 508, 508, 521, 521, 121, 120, 120, 120,
+		/* E0 */ 507, 507, 131, 131, 131, 151, 131, 131, 508, 508, 522, 522, 156, 120, 120, 120,
+		/* F0 */ 121, 121, 131, 516, 131, 121, 131, 131, 523, 523, 524, 524, 518, 120, 120, 121,
+	},
+	{ /* 32 : 002000 */
+		/* 00 */ 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 23, 525, 526, 527, 528, 528,
+		/* 10 */ 13, 13, 529, 529, 529, 529, 530, 8, 28, 33, 531, 28, 28, 33, 531, 28,
+		/* 20 */ 8, 8, 8, 8, 8, 8, 8, 8, 532, 533, 534, 534, 534, 534, 534, 23,
+		/* 30 */ 8, 8, 530, 530, 530, 8, 8, 8, 8, 28, 33, 8, 535, 4, 8, 18,
+		/* 40 */ 536, 8, 8, 8, 11, 9, 10, 4, 4, 535, 8, 8, 8, 8, 8, 8,
+		/* 50 */ 8, 8, 11, 537, 18, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 23,
+		/* 60 */ 525, 538, 538, 538, 538, 539, 534, 534, 534, 534, 540, 540, 540, 540, 540, 540,
+		/* 70 */ 30, 503, 121, 121, 30, 30, 30, 30, 30, 30, 541, 542, 541, 543, 544, 502,
+		/* 80 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 541, 542, 541, 543, 544, 121,
+		/* 90 */ 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 502, 121, 121, 121,
+		/* A0 */ 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319,
+		/* B0 */ 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319, 319,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 545, 445, 445, 445,
+		/* E0 */ 445, 545, 445, 546, 445, 545, 545, 117, 117, 117, 117, 545, 545, 545, 545, 545,
+		/* F0 */ 117, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 33 : 002100 */
+		/* 00 */ 346, 346, 547, 346, 346, 346, 346, 547, 346, 346, 548, 547, 547, 547, 548, 548,
+		/* 10 */ 547, 547, 547, 548, 346, 547, 346, 346, 549, 547, 547, 547, 547, 547, 346, 346,
+		/* 20 */ 346, 346, 550, 346, 547, 346, 551, 346, 547, 552, 553, 554, 547, 547, 555, 548,
+		/* 30 */ 547, 547, 556, 547, 548, 557, 557, 557, 557, 558, 346, 346, 548, 548, 547, 547,
+		/* 40 */ 541, 541, 541, 541, 541, 547, 548, 548, 559, 559, 346, 541, 346, 346, 560, 346,
+		/* 50 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 60 */ 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561, 561,
+		/* 70 */ 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562, 562,
+		/* 80 */ 563, 563, 563, 36, 37, 563, 563, 563, 563, 30, 346, 346, 121, 121, 121, 121,
+		/* 90 */ 11, 11, 11, 11, 564, 565, 565, 565, 565, 565, 11, 11, 566, 566, 566, 566,
+		/* A0 */ 11, 566, 566, 11, 566, 566, 11, 566, 24, 565, 565, 566, 566, 566, 11, 24,
+		/* B0 */ 566, 566, 24, 24, 24, 24, 566, 566, 24, 24, 24, 24, 566, 566, 566, 566,
+		/* C0 */ 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 566, 11, 11,
+		/* D0 */ 566, 566, 11, 566, 11, 566, 566, 566, 566, 566, 566, 566, 24, 566, 24, 24,
+		/* E0 */ 24, 24, 24, 24, 566, 566, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* F0 */ 24, 24, 24, 24, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	},
+	{ /* 34 : 002200 */
+		/* 00 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 10 */ 11, 11, 567, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 20 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 30 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 40 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 50 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 60 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 70 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 80 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 90 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* A0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* B0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* C0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* D0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* E0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* F0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	},
+	{ /* 35 : 002300 */
+		/* 00 */ 24, 24, 24, 24, 24, 24, 24, 24, 568, 569, 568, 569, 24, 24, 24, 24,
+		/* 10 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 570, 570, 24, 24, 24, 24,
+		/* 20 */ 11, 11, 24, 24, 24, 24, 24, 24, 26, 571, 572, 24, 24, 24, 24, 24,
+		/* 30 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 40 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 50 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 60 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 70 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 11, 24, 24, 24,
+		/* 80 */ 24, 24, 24, 24, 24, 24, 24, 24, 573, 24, 24, 24, 24, 24, 24, 24,
+		/* 90 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 11, 11, 11, 11, 11,
+		/* A0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* B0 */ 11, 11, 11, 11, 566, 566, 24, 566, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* C0 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 26,
+		/* D0 */ 566, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 11, 11, 11, 11,
+		/* E0 */ 11, 11, 566, 24, 24, 24, 24, 24, 24, 570, 570, 570, 570, 26, 26, 26,
+		/* F0 */ 570, 26, 26, 570, 24, 24, 24, 24, 26, 26, 26, 24, 24, 24, 24, 24,
+	},
+	{ /* 36 : 002400 */
+		/* 00 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 10 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 20 */ 24, 24, 24, 24, 24, 24, 24, 574, 574, 574, 574, 574, 574, 574, 574, 574,
+		/* 30 */ 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574,
+		/* 40 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 574, 574, 574, 574, 574,
+		/* 50 */ 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574,
+		/* 60 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 70 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 80 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 90 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 346, 346, 346, 346,
+		/* A0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* B0 */ 346, 346, 346, 346, 346, 346, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575,
+		/* C0 */ 575, 575, 576, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575, 575,
+		/* D0 */ 577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 577,
+		/* E0 */ 577, 577, 577, 577, 577, 577, 577, 577, 577, 577, 30, 30, 30, 30, 30, 30,
+		/* F0 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+	},
+	{ /* 37 : 002500 */
+		/* 00 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 10 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 20 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 30 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 40 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 50 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 60 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 70 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 80 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 90 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* A0 */ 566, 566, 24, 24, 24, 24, 24, 24, 24, 24, 26, 26, 24, 24, 566, 566,
+		/* B0 */ 566, 566, 566, 566, 566, 566, 565, 11, 24, 24, 24, 24, 566, 566, 566, 566,
+		/* C0 */ 565, 11, 24, 24, 24, 24, 566, 566, 24, 24, 566, 566, 24, 24, 24, 566,
+		/* D0 */ 566, 566, 566, 566, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* E0 */ 24, 24, 566, 24, 566, 24, 24, 566, 566, 566, 566, 566, 566, 24, 24, 24,
+		/* F0 */ 24, 24, 24, 24, 24, 24, 24, 24, 11, 11, 11, 564, 564, 578, 578, 11,
+	},
+	{ /* 38 : 002600 */
+		/* 00 */ 26, 26, 26, 26, 26, 579, 566, 573, 573, 573, 573, 573, 573, 573, 26, 573,
+		/* 10 */ 573, 26, 573, 24, 570, 570, 573, 573, 26, 573, 573, 573, 573, 580, 573, 573,
+		/* 20 */ 26, 573, 26, 26, 573, 573, 26, 573, 573, 573, 26, 573, 573, 573, 26, 26,
+		/* 30 */ 573, 573, 573, 573, 573, 573, 573, 573, 26, 26, 26, 573, 573, 573, 573, 573,
+		/* 40 */ 565, 573, 565, 573, 573, 573, 573, 573, 570, 570, 570, 570, 570, 570, 570, 570,
+		/* 50 */ 570, 570, 570, 570, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 26,
+		/* 60 */ 565, 579, 579, 565, 573, 26, 26, 573, 26, 573, 573, 573, 573, 579, 579, 581,
+		/* 70 */ 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 26, 573, 573, 26, 570,
+		/* 80 */ 573, 573, 573, 573, 573, 573, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 90 */ 573, 573, 26, 570, 26, 26, 26, 26, 573, 26, 573, 26, 26, 573, 573, 573,
+		/* A0 */ 26, 570, 573, 573, 573, 573, 573, 573, 573, 573, 570, 570, 573, 573, 573, 573,
+		/* B0 */ 26, 26, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 570, 570, 573,
+		/* C0 */ 573, 573, 573, 573, 570, 570, 573, 573, 26, 573, 573, 573, 573, 573, 570, 26,
+		/* D0 */ 573, 26, 573, 26, 570, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573, 573,
+		/* E0 */ 573, 573, 573, 573, 573, 573, 573, 573, 573, 26, 570, 573, 573, 573, 573, 573,
+		/* F0 */ 26, 26, 570, 570, 26, 570, 573, 26, 26, 580, 570, 573, 573, 570, 573, 573,
+	},
+	{ /* 39 : 002700 */
+		/* 00 */ 573, 573, 26, 573, 573, 570, 24, 24, 26, 26, 582, 582, 580, 580, 573, 26,
+		/* 10 */ 573, 573, 26, 24, 26, 24, 26, 24, 24, 24, 24, 24, 24, 26, 24, 24,
+		/* 20 */ 24, 26, 24, 24, 24, 24, 24, 24, 570, 24, 24, 24, 24, 24, 24, 24,
+		/* 30 */ 24, 24, 24, 26, 26, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 40 */ 24, 24, 24, 24, 26, 24, 24, 26, 24, 24, 24, 24, 570, 24, 570, 24,
+		/* 50 */ 24, 24, 24, 570, 570, 570, 24, 570, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 60 */ 24, 24, 24, 26, 26, 573, 573, 573, 9, 10, 9, 10, 9, 10, 9, 10,
+		/* 70 */ 9, 10, 9, 10, 9, 10, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 80 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 90 */ 30, 30, 30, 30, 24, 570, 570, 570, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* A0 */ 24, 26, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* B0 */ 570, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 570,
+		/* C0 */ 11, 11, 11, 11, 11, 568, 569, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* D0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* E0 */ 11, 11, 11, 11, 11, 11, 568, 569, 568, 569, 568, 569, 568, 569, 568, 569,
+		/* F0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	},
+	{ /* 40 : 002800 */
+		/* 00 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 10 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 20 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 30 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 40 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 50 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 60 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 70 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 80 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* 90 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* A0 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* B0 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* C0 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* D0 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* E0 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+		/* F0 */ 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583, 583,
+	},
+	{ /* 41 : 002900 */
+		/* 00 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 10 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 20 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 30 */ 11, 11, 11, 11, 564, 564, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 40 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 50 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 60 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 70 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 80 */ 11, 11, 11, 568, 569, 568, 569, 568, 569, 568, 569, 568, 569, 568, 569, 568,
+		/* 90 */ 569, 568, 569, 568, 569, 568, 569, 568, 569, 11, 11, 11, 11, 11, 11, 11,
+		/* A0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* B0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* C0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* D0 */ 11, 11, 11, 11, 11, 11, 11, 11, 568, 569, 568, 569, 11, 11, 11, 11,
+		/* E0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* F0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 568, 569, 11, 11,
+	},
+	{ /* 42 : 002A00 */
+		/* 00 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 10 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 20 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 30 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 40 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 50 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 60 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 70 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 80 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 90 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* A0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* B0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* C0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* D0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* E0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* F0 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+	},
+	{ /* 43 : 002B00 */
+		/* 00 */ 24, 24, 24, 24, 24, 26, 26, 26, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 10 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 570, 570, 24, 24, 24,
+		/* 20 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 30 */ 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+		/* 40 */ 11, 11, 11, 11, 11, 24, 24, 11, 11, 11, 11, 11, 11, 24, 24, 24,
+		/* 50 */ 570, 24, 24, 24, 24, 570, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 60 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 70 */ 24, 24, 24, 24, 574, 574, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 80 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* 90 */ 24, 24, 24, 24, 24, 24, 574, 574, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* A0 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* B0 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* C0 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* D0 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* E0 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+		/* F0 */ 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+	},
+	{ /* 44 : 002C00 */
+		/* 00 */ 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584,
+		/* 10 */ 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584,
+		/* 20 */ 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 584, 121,
+		/* 30 */ 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585,
+		/* 40 */ 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585,
+		/* 50 */ 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 585, 121,
+		/* 60 */ 36, 37, 586, 587, 588, 589, 590, 36, 37, 36, 37, 36, 37, 591, 592, 593,
+		/* 70 */ 594, 34, 36, 37, 34, 36, 37, 34, 34, 34, 34, 34, 503, 502, 595, 595,
+		/* 80 */ 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148,
+		/* 90 */ 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148,
+		/* A0 */ 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148,
+		/* B0 */ 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148,
+		/* C0 */ 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148,
+		/* D0 */ 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148, 147, 148,
+		/* E0 */ 147, 148, 147, 148, 596, 597, 597, 597, 597, 597, 597, 147, 148, 147, 148, 598,
+		/* F0 */ 598, 598, 147, 148, 121, 121, 121, 121, 121, 599, 599, 599, 599, 600, 599, 599,
+	},
+	{ /* 45 : 002D00 */
+		/* 00 */ 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+		/* 10 */ 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601, 601,
+		/* 20 */ 601, 601, 601, 601, 601, 601, 121, 601, 121, 121, 121, 121, 121, 601, 121, 121,
+		/* 30 */ 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+		/* 40 */ 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+		/* 50 */ 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602, 602,
+		/* 60 */ 602, 602, 602, 602, 602, 602, 602, 602, 121, 121, 121, 121, 121, 121, 121, 603,
+		/* 70 */ 604, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 605,
+		/* 80 */ 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363, 363,
+		/* 90 */ 363, 363, 363, 363, 363, 363, 363, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 363, 363, 363, 363, 363, 363, 363, 121, 363, 363, 363, 363, 363, 363, 363, 121,
+		/* B0 */ 363, 363, 363, 363, 363, 363, 363, 121, 363, 363, 363, 363, 363, 363, 363, 121,
+		/* C0 */ 363, 363, 363, 363, 363, 363, 363, 121, 363, 363, 363, 363, 363, 363, 363, 121,
+		/* D0 */ 363, 363, 363, 363, 363, 363, 363, 121, 363, 363, 363, 363, 363, 363, 363, 121,
+		/* E0 */ 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606,
+		/* F0 */ 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606, 606,
+	},
+	{ /* 46 : 002E00 */
+		/* 00 */ 8, 8, 607, 608, 607, 608, 8, 8, 8, 607, 608, 8, 607, 608, 8, 8,
+		/* 10 */ 8, 8, 8, 8, 8, 8, 8, 13, 8, 8, 529, 8, 607, 608, 8, 8,
+		/* 20 */ 607, 608, 9, 10, 9, 10, 9, 10, 9, 10, 8, 8, 8, 8, 4, 609,
+		/* 30 */ 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 529, 529, 4, 8, 8, 8,
+		/* 40 */ 529, 12, 531, 8, 8, 8, 8, 8, 8, 8, 8, 8, 12, 8, 12, 12,
+		/* 50 */ 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574,
+		/* 60 */ 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574,
+		/* 70 */ 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574, 574,
+		/* 80 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 90 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 121, 610, 610, 610, 610, 610,
+		/* A0 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* B0 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* C0 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* D0 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* E0 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* F0 */ 610, 610, 610, 610, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 47 : 002F00 */
+		/* 00 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 10 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 20 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 30 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 40 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 50 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 60 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 70 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 80 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* 90 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* A0 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* B0 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* C0 */ 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610, 610,
+		/* D0 */ 610, 610, 610, 610, 610, 610, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 611, 611, 612, 612, 611, 611, 611, 611, 611, 611, 611, 611, 121, 121, 121, 121,
+	},
+	{ /* 48 : 003000 */
+		/* 00 */ 23, 12, 4, 8, 346, 613, 614, 615, 9, 10, 9, 10, 531, 616, 531, 616,
+		/* 10 */ 9, 10, 24, 24, 9, 10, 9, 10, 9, 10, 9, 10, 529, 531, 616, 616,
+		/* 20 */ 24, 615, 615, 615, 615, 615, 615, 615, 615, 615, 114, 114, 114, 114, 617, 617,
+		/* 30 */ 618, 197, 197, 197, 197, 197, 346, 346, 615, 615, 615, 619, 494, 620, 346, 346,
+		/* 40 */ 121, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 50 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 60 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 70 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 80 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 90 */ 621, 621, 621, 621, 621, 621, 621, 121, 121, 114, 114, 622, 622, 623, 623, 621,
+		/* A0 */ 624, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+		/* B0 */ 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+		/* C0 */ 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+		/* D0 */ 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+		/* E0 */ 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+		/* F0 */ 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 626, 112, 627, 627, 625,
+	},
+	{ /* 49 : 003100 */
+		/* 00 */ 121, 121, 121, 121, 121, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+		/* 10 */ 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+		/* 20 */ 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+		/* 30 */ 121, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 40 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 50 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 60 */ 361, 361, 361, 361, 362, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 70 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 80 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 121,
+		/* 90 */ 346, 346, 30, 30, 30, 30, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* A0 */ 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628,
+		/* B0 */ 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 628, 121, 121, 121, 121, 121,
+		/* C0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* D0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* E0 */ 346, 346, 346, 346, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+	},
+	{ /* 50 : 003200 */
+		/* 00 */ 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+		/* 10 */ 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 121,
+		/* 20 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 346, 346, 346, 346, 346, 346,
+		/* 30 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 40 */ 346, 346, 346, 346, 346, 346, 346, 346, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 50 */ 346, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 60 */ 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629,
+		/* 70 */ 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 629, 346,
+		/* 80 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 346, 346, 346, 346, 346, 346,
+		/* 90 */ 346, 346, 346, 346, 346, 346, 346, 550, 346, 550, 346, 346, 346, 346, 346, 346,
+		/* A0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* B0 */ 346, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* C0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* D0 */ 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		/* E0 */ 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		/* F0 */ 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 121,
+	},
+	{ /* 51 : 003300 */
+		/* 00 */ 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		/* 10 */ 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		/* 20 */ 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		/* 30 */ 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		/* 40 */ 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630, 630,
+		/* 50 */ 630, 630, 630, 630, 630, 630, 630, 630, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 60 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 70 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 80 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 90 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* A0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* B0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* C0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* D0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* E0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* F0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+	},
+	{ /* 52 : 003400 */
+		/* 00 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 10 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 20 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 30 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 40 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 50 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 60 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 70 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 80 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 90 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* A0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* B0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* C0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* D0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* E0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* F0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+	},
+	{ /* 53 : 004D00 */
+		/* 00 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 10 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 20 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 30 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 40 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 50 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 60 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 70 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 80 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 90 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* A0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* B0 */ 631, 631, 631, 631, 631, 631, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* D0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* E0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* F0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+	},
+	{ /* 54 : 009F00 */
+		/* 00 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 10 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 20 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 30 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 40 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 50 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 60 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 70 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 80 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 90 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* A0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* B0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* C0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* D0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* E0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 55 : 00A000 */
+		/* 00 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 10 */ 632, 632, 632, 632, 632, 633, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 20 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 30 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 40 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 50 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 60 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 70 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 80 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 90 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* A0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* B0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* C0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* D0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* E0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* F0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+	},
+	{ /* 56 : 00A100 */
+		/* 00 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 10 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 20 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 30 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 40 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 50 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 60 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 70 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 80 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 90 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* A0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* B0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* C0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* D0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* E0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* F0 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+	},
+	{ /* 57 : 00A400 */
+		/* 00 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 10 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 20 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 30 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 40 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 50 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 60 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 70 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632,
+		/* 80 */ 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 632, 121, 121, 121,
+		/* 90 */ 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634,
+		/* A0 */ 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634,
+		/* B0 */ 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634, 634,
+		/* C0 */ 634, 634, 634, 634, 634, 634, 634, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635,
+		/* E0 */ 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635, 635,
+		/* F0 */ 635, 635, 635, 635, 635, 635, 635, 635, 636, 636, 636, 636, 636, 636, 637, 638,
+	},
+	{ /* 58 : 00A500 */
+		/* 00 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 10 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 20 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 30 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 40 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 50 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 60 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 70 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 80 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 90 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* A0 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* B0 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* C0 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* D0 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* E0 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* F0 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+	},
+	{ /* 59 : 00A600 */
+		/* 00 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 640, 641, 642, 642,
+		/* 10 */ 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639, 639,
+		/* 20 */ 643, 643, 643, 643, 643, 643, 643, 643, 643, 643, 639, 639, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* 50 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* 60 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 644, 166,
+		/* 70 */ 167, 167, 167, 645, 606, 606, 606, 606, 606, 606, 606, 606, 166, 166, 645, 646,
+		/* 80 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164,
+		/* 90 */ 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 163, 164, 647, 647, 606, 606,
+		/* A0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* B0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* C0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* D0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* E0 */ 648, 648, 648, 648, 648, 648, 649, 649, 649, 649, 649, 649, 649, 649, 649, 649,
+		/* F0 */ 650, 650, 651, 652, 653, 653, 653, 652, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 60 : 00A700 */
+		/* 00 */ 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25, 25,
+		/* 10 */ 25, 25, 25, 25, 25, 25, 25, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+		/* 20 */ 25, 25, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 30 */ 34, 34, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 40 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 50 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 60 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* 70 */ 502, 34, 34, 34, 34, 34, 34, 34, 34, 36, 37, 36, 37, 654, 36, 37,
+		/* 80 */ 36, 37, 36, 37, 36, 37, 36, 37, 110, 25, 25, 36, 37, 655, 34, 62,
+		/* 90 */ 36, 37, 36, 37, 656, 34, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* A0 */ 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 657, 658, 659, 660, 657, 34,
+		/* B0 */ 661, 662, 663, 664, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 37,
+		/* C0 */ 121, 121, 36, 37, 665, 666, 667, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 62, 108, 108, 34, 62, 62, 62, 62, 62,
+	},
+	{ /* 61 : 00A800 */
+		/* 00 */ 668, 668, 669, 668, 668, 668, 670, 668, 668, 668, 668, 669, 668, 668, 668, 668,
+		/* 10 */ 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668, 668,
+		/* 20 */ 668, 668, 668, 671, 671, 669, 669, 671, 672, 672, 672, 672, 121, 121, 121, 121,
+		/* 30 */ 30, 30, 30, 30, 30, 30, 346, 346, 319, 346, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673,
+		/* 50 */ 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673,
+		/* 60 */ 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673, 673,
+		/* 70 */ 673, 673, 673, 673, 674, 674, 675, 675, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 676, 676, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677,
+		/* 90 */ 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677,
+		/* A0 */ 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677, 677,
+		/* B0 */ 677, 677, 677, 677, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676, 676,
+		/* C0 */ 676, 676, 676, 676, 678, 679, 121, 121, 121, 121, 121, 121, 121, 121, 680, 680,
+		/* D0 */ 681, 681, 681, 681, 681, 681, 681, 681, 681, 681, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240, 240,
+		/* F0 */ 240, 240, 239, 239, 239, 239, 239, 239, 242, 242, 242, 239, 242, 239, 239, 237,
+	},
+	{ /* 62 : 00A900 */
+		/* 00 */ 682, 682, 682, 682, 682, 682, 682, 682, 682, 682, 683, 683, 683, 683, 683, 683,
+		/* 10 */ 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683,
+		/* 20 */ 683, 683, 683, 683, 683, 683, 684, 684, 684, 684, 684, 685, 685, 685, 492, 686,
+		/* 30 */ 687, 687, 687, 687, 687, 687, 687, 687, 687, 687, 687, 687, 687, 687, 687, 687,
+		/* 40 */ 687, 687, 687, 687, 687, 687, 687, 688, 688, 688, 688, 688, 688, 688, 688, 688,
+		/* 50 */ 688, 688, 689, 690, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 691,
+		/* 60 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 70 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 121, 121, 121,
+		/* 80 */ 692, 692, 692, 693, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694,
+		/* 90 */ 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694,
+		/* A0 */ 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694, 694,
+		/* B0 */ 694, 694, 694, 695, 693, 693, 692, 692, 692, 692, 693, 693, 692, 692, 693, 693,
+		/* C0 */ 696, 697, 697, 697, 697, 697, 697, 698, 699, 699, 697, 697, 697, 697, 121, 197,
+		/* D0 */ 700, 700, 700, 700, 700, 700, 700, 700, 700, 700, 121, 121, 121, 121, 697, 697,
+		/* E0 */ 347, 347, 347, 347, 347, 355, 701, 347, 347, 347, 347, 347, 347, 347, 347, 347,
+		/* F0 */ 351, 351, 351, 351, 351, 351, 351, 351, 351, 351, 347, 347, 347, 347, 347, 121,
+	},
+	{ /* 63 : 00AA00 */
+		/* 00 */ 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702,
+		/* 10 */ 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702, 702,
+		/* 20 */ 702, 702, 702, 702, 702, 702, 702, 702, 702, 703, 703, 703, 703, 703, 703, 704,
+		/* 30 */ 704, 703, 703, 704, 704, 703, 703, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 702, 702, 702, 703, 702, 702, 702, 702, 702, 702, 702, 702, 703, 704, 121, 121,
+		/* 50 */ 705, 705, 705, 705, 705, 705, 705, 705, 705, 705, 121, 121, 706, 707, 707, 707,
+		/* 60 */ 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347, 347,
+		/* 70 */ 701, 347, 347, 347, 347, 347, 347, 356, 356, 356, 347, 354, 355, 354, 347, 347,
+		/* 80 */ 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708,
+		/* 90 */ 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708,
+		/* A0 */ 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708, 708,
+		/* B0 */ 709, 708, 709, 709, 709, 710, 710, 709, 709, 710, 708, 710, 710, 708, 709, 711,
+		/* C0 */ 712, 711, 712, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 708, 708, 713, 714, 715,
+		/* E0 */ 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 717, 718, 718, 717, 717,
+		/* F0 */ 719, 719, 716, 720, 720, 717, 721, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 64 : 00AB00 */
+		/* 00 */ 121, 363, 363, 363, 363, 363, 363, 121, 121, 363, 363, 363, 363, 363, 363, 121,
+		/* 10 */ 121, 363, 363, 363, 363, 363, 363, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 363, 363, 363, 363, 363, 363, 363, 121, 363, 363, 363, 363, 363, 363, 363, 121,
+		/* 30 */ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		/* 40 */ 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+		/* 50 */ 34, 34, 34, 722, 34, 34, 34, 34, 34, 34, 34, 25, 108, 108, 108, 108,
+		/* 60 */ 34, 34, 34, 34, 34, 131, 34, 34, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723,
+		/* 80 */ 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723,
+		/* 90 */ 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723,
+		/* A0 */ 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723,
+		/* B0 */ 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723, 723,
+		/* C0 */ 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716,
+		/* D0 */ 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716, 716,
+		/* E0 */ 716, 716, 716, 717, 717, 718, 717, 717, 718, 717, 717, 719, 724, 721, 121, 121,
+		/* F0 */ 725, 725, 725, 725, 725, 725, 725, 725, 725, 725, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 65 : 00AC00 */
+		/* 00 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 10 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 20 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 30 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 40 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 50 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 60 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 70 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 80 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 90 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* A0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* B0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* C0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* D0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* E0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* F0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+	},
+	{ /* 66 : 00D700 */
+		/* 00 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 10 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 20 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 30 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 40 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 50 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 60 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 70 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 80 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* 90 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* A0 */ 361, 361, 361, 361, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* C0 */ 361, 361, 361, 361, 361, 361, 361, 121, 121, 121, 121, 361, 361, 361, 361, 361,
+		/* D0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* E0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* F0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 121, 121, 121, 121,
+	},
+	{ /* 67 : 00D800 */
+		/* 00 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* 10 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* 20 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* 30 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* 40 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* 50 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* 60 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* 70 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* 80 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* 90 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* A0 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* B0 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* C0 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* D0 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* E0 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+		/* F0 */ 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726, 726,
+	},
+	{ /* 68 : 00E000 */
+		/* 00 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 10 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 20 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 30 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 40 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 50 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 60 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 70 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 80 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 90 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* A0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* B0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* C0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* D0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* E0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* F0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+	},
+	{ /* 69 : 00F900 */
+		/* 00 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 10 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 20 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 30 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 40 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 50 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 60 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 70 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 80 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 90 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* A0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* B0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* C0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* D0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* E0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* F0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+	},
+	{ /* 70 : 00FA00 */
+		/* 00 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 631, 631,
+		/* 10 */ 728, 631, 728, 631, 631, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 631,
+		/* 20 */ 728, 631, 728, 631, 631, 728, 728, 631, 631, 631, 728, 728, 728, 728, 728, 728,
+		/* 30 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 40 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 50 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 60 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 121, 121,
+		/* 70 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 80 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 90 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* A0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* B0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* C0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* D0 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 71 : 00FB00 */
+		/* 00 */ 34, 34, 34, 34, 34, 34, 34, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 173, 173, 173, 173, 173, 121, 121, 121, 121, 121, 186, 181, 186,
+		/* 20 */ 186, 186, 186, 186, 186, 186, 186, 186, 186, 729, 186, 186, 186, 186, 186, 186,
+		/* 30 */ 186, 186, 186, 186, 186, 186, 186, 121, 186, 186, 186, 186, 186, 121, 186, 121,
+		/* 40 */ 186, 186, 121, 186, 186, 121, 186, 186, 186, 186, 186, 186, 186, 186, 186, 186,
+		/* 50 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 60 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 70 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 80 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 90 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* A0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* B0 */ 196, 196, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730, 730,
+		/* C0 */ 730, 730, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* E0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* F0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+	},
+	{ /* 72 : 00FC00 */
+		/* 00 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 10 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 20 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 30 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 40 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 50 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 731, 731,
+		/* 60 */ 731, 731, 731, 731, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 70 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 80 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 90 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* A0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* B0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* C0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* D0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* E0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* F0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+	},
+	{ /* 73 : 00FD00 */
+		/* 00 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 10 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 20 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 30 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 10, 9,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 60 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 70 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 80 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 90 */ 121, 121, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* A0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* B0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* C0 */ 196, 196, 196, 196, 196, 196, 196, 196, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+		/* E0 */ 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732, 732,
+		/* F0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 731, 731, 191, 192, 121, 121,
+	},
+	{ /* 74 : 00FE00 */
+		/* 00 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 734,
+		/* 10 */ 359, 359, 359, 359, 359, 359, 359, 735, 736, 359, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 166, 166,
+		/* 30 */ 359, 624, 624, 18, 18, 735, 736, 735, 736, 735, 736, 735, 736, 735, 736, 735,
+		/* 40 */ 736, 737, 738, 737, 738, 8, 8, 735, 736, 359, 359, 359, 359, 18, 18, 18,
+		/* 50 */ 124, 124, 175, 121, 124, 124, 175, 175, 624, 735, 736, 735, 736, 735, 736, 359,
+		/* 60 */ 359, 739, 541, 740, 541, 541, 541, 121, 739, 319, 359, 359, 121, 121, 121, 121,
+		/* 70 */ 731, 196, 731, 196, 731, 121, 731, 196, 731, 196, 731, 196, 731, 196, 731, 196,
+		/* 80 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* 90 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* A0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* B0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* C0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* D0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* E0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196,
+		/* F0 */ 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 196, 121, 121, 525,
+	},
+	{ /* 75 : 00FF00 */
+		/* 00 */ 121, 175, 741, 359, 319, 359, 359, 741, 735, 736, 359, 541, 124, 742, 175, 359,
+		/* 10 */ 743, 743, 743, 743, 743, 743, 743, 743, 743, 743, 124, 124, 541, 541, 541, 175,
+		/* 20 */ 359, 744, 744, 744, 744, 744, 744, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+		/* 30 */ 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 735, 739, 736, 745, 18,
+		/* 40 */ 25, 746, 746, 746, 746, 746, 746, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+		/* 50 */ 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 735, 541, 736, 541, 735,
+		/* 60 */ 736, 175, 737, 738, 124, 626, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+		/* 70 */ 112, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+		/* 80 */ 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625,
+		/* 90 */ 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 625, 747, 747,
+		/* A0 */ 362, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361,
+		/* B0 */ 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 361, 121,
+		/* C0 */ 121, 121, 361, 361, 361, 361, 361, 361, 121, 121, 361, 361, 361, 361, 361, 361,
+		/* D0 */ 121, 121, 361, 361, 361, 361, 361, 361, 121, 121, 361, 361, 361, 121, 121, 121,
+		/* E0 */ 319, 319, 541, 25, 346, 319, 319, 121, 346, 541, 541, 541, 541, 346, 346, 121,
+		/* F0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 525, 525, 525, 346, 346, 732, 732,
+	},
+	{ /* 76 : 010000 */
+		/* 00 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 121, 748, 748, 748,
+		/* 10 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+		/* 20 */ 748, 748, 748, 748, 748, 748, 748, 121, 748, 748, 748, 748, 748, 748, 748, 748,
+		/* 30 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 121, 748, 748, 121, 748,
+		/* 40 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 121, 121,
+		/* 50 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+		/* 90 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+		/* A0 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+		/* B0 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+		/* C0 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+		/* D0 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+		/* E0 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748,
+		/* F0 */ 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 748, 121, 121, 121, 121, 121,
+	},
+	{ /* 77 : 010100 */
+		/* 00 */ 359, 359, 359, 121, 121, 121, 121, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 10 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 20 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 30 */ 30, 30, 30, 30, 121, 121, 121, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 40 */ 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749,
+		/* 50 */ 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749,
+		/* 60 */ 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749, 749,
+		/* 70 */ 749, 749, 749, 749, 749, 750, 750, 750, 750, 751, 751, 751, 751, 751, 751, 751,
+		/* 80 */ 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 750, 750, 751, 751, 751, 121,
+		/* 90 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 121, 121, 121, 121,
+		/* A0 */ 751, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* E0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* F0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 117, 121, 121,
+	},
+	{ /* 78 : 010200 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752,
+		/* 90 */ 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 752, 121, 121, 121,
+		/* A0 */ 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753,
+		/* B0 */ 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753,
+		/* C0 */ 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753, 753,
+		/* D0 */ 753, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 114, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* F0 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 121, 121, 121, 121,
+	},
+	{ /* 79 : 010300 */
+		/* 00 */ 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754,
+		/* 10 */ 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754, 754,
+		/* 20 */ 755, 755, 755, 755, 121, 121, 121, 121, 121, 121, 121, 121, 121, 754, 754, 754,
+		/* 30 */ 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756, 756,
+		/* 40 */ 756, 757, 756, 756, 756, 756, 756, 756, 756, 756, 757, 121, 121, 121, 121, 121,
+		/* 50 */ 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758,
+		/* 60 */ 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758, 758,
+		/* 70 */ 758, 758, 758, 758, 758, 758, 759, 759, 759, 759, 759, 121, 121, 121, 121, 121,
+		/* 80 */ 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760,
+		/* 90 */ 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 760, 121, 761,
+		/* A0 */ 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762,
+		/* B0 */ 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762, 762,
+		/* C0 */ 762, 762, 762, 762, 121, 121, 121, 121, 762, 762, 762, 762, 762, 762, 762, 762,
+		/* D0 */ 763, 764, 764, 764, 764, 764, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 80 : 010400 */
+		/* 00 */ 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765,
+		/* 10 */ 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765, 765,
+		/* 20 */ 765, 765, 765, 765, 765, 765, 765, 765, 766, 766, 766, 766, 766, 766, 766, 766,
+		/* 30 */ 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766,
+		/* 40 */ 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766, 766,
+		/* 50 */ 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+		/* 60 */ 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+		/* 70 */ 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767, 767,
+		/* 80 */ 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768,
+		/* 90 */ 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 768, 121, 121,
+		/* A0 */ 769, 769, 769, 769, 769, 769, 769, 769, 769, 769, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+		/* C0 */ 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770, 770,
+		/* D0 */ 770, 770, 770, 770, 121, 121, 121, 121, 771, 771, 771, 771, 771, 771, 771, 771,
+		/* E0 */ 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771,
+		/* F0 */ 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 771, 121, 121, 121, 121,
+	},
+	{ /* 81 : 010500 */
+		/* 00 */ 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772,
+		/* 10 */ 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772, 772,
+		/* 20 */ 772, 772, 772, 772, 772, 772, 772, 772, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773,
+		/* 40 */ 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773,
+		/* 50 */ 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773, 773,
+		/* 60 */ 773, 773, 773, 773, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 774,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 82 : 010600 */
+		/* 00 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 10 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 20 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 30 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 40 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 50 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 60 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 70 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 80 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 90 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* A0 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* B0 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* C0 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* D0 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* E0 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* F0 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+	},
+	{ /* 83 : 010700 */
+		/* 00 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 10 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 20 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 30 */ 775, 775, 775, 775, 775, 775, 775, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775, 775,
+		/* 50 */ 775, 775, 775, 775, 775, 775, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 775, 775, 775, 775, 775, 775, 775, 775, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 84 : 010800 */
+		/* 00 */ 776, 776, 776, 776, 776, 776, 121, 121, 776, 121, 776, 776, 776, 776, 776, 776,
+		/* 10 */ 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776,
+		/* 20 */ 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776, 776,
+		/* 30 */ 776, 776, 776, 776, 776, 776, 121, 776, 776, 121, 121, 121, 776, 121, 121, 776,
+		/* 40 */ 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777, 777,
+		/* 50 */ 777, 777, 777, 777, 777, 777, 121, 778, 779, 779, 779, 779, 779, 779, 779, 779,
+		/* 60 */ 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780, 780,
+		/* 70 */ 780, 780, 780, 780, 780, 780, 780, 781, 781, 782, 782, 782, 782, 782, 782, 782,
+		/* 80 */ 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783,
+		/* 90 */ 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 783, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 784, 784, 784, 784, 784, 784, 784, 784, 784,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785, 785,
+		/* F0 */ 785, 785, 785, 121, 785, 785, 121, 121, 121, 121, 121, 786, 786, 786, 786, 786,
+	},
+	{ /* 85 : 010900 */
+		/* 00 */ 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787, 787,
+		/* 10 */ 787, 787, 787, 787, 787, 787, 788, 788, 788, 788, 788, 788, 121, 121, 121, 789,
+		/* 20 */ 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 790,
+		/* 30 */ 790, 790, 790, 790, 790, 790, 790, 790, 790, 790, 121, 121, 121, 121, 121, 791,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+		/* 90 */ 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792, 792,
+		/* A0 */ 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793, 793,
+		/* B0 */ 793, 793, 793, 793, 793, 793, 793, 793, 121, 121, 121, 121, 794, 794, 793, 793,
+		/* C0 */ 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794,
+		/* D0 */ 121, 121, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794,
+		/* E0 */ 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794,
+		/* F0 */ 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794, 794,
+	},
+	{ /* 86 : 010A00 */
+		/* 00 */ 795, 796, 796, 796, 121, 796, 796, 121, 121, 121, 121, 121, 796, 796, 796, 796,
+		/* 10 */ 795, 795, 795, 795, 121, 795, 795, 795, 121, 795, 795, 795, 795, 795, 795, 795,
+		/* 20 */ 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795, 795,
+		/* 30 */ 795, 795, 795, 795, 795, 795, 121, 121, 797, 797, 797, 121, 121, 121, 121, 797,
+		/* 40 */ 798, 798, 798, 798, 798, 798, 798, 798, 798, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 799, 799, 799, 799, 799, 799, 800, 800, 799, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801,
+		/* 70 */ 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 801, 802, 802, 803,
+		/* 80 */ 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 804,
+		/* 90 */ 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 804, 805, 805, 805,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 806, 806, 806, 806, 806, 806, 806, 806, 807, 806, 806, 806, 806, 806, 806, 806,
+		/* D0 */ 806, 806, 806, 806, 806, 806, 806, 806, 806, 806, 806, 806, 806, 806, 806, 806,
+		/* E0 */ 806, 806, 806, 806, 806, 808, 808, 121, 121, 121, 121, 809, 809, 809, 809, 809,
+		/* F0 */ 810, 810, 810, 810, 810, 810, 811, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 87 : 010B00 */
+		/* 00 */ 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812,
+		/* 10 */ 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812,
+		/* 20 */ 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812, 812,
+		/* 30 */ 812, 812, 812, 812, 812, 812, 121, 121, 121, 813, 814, 814, 814, 814, 814, 814,
+		/* 40 */ 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815, 815,
+		/* 50 */ 815, 815, 815, 815, 815, 815, 121, 121, 816, 816, 816, 816, 816, 816, 816, 816,
+		/* 60 */ 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817,
+		/* 70 */ 817, 817, 817, 121, 121, 121, 121, 121, 818, 818, 818, 818, 818, 818, 818, 818,
+		/* 80 */ 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819, 819,
+		/* 90 */ 819, 819, 121, 121, 121, 121, 121, 121, 121, 820, 820, 820, 820, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 821, 821, 821, 821, 821, 821, 821,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 88 : 010C00 */
+		/* 00 */ 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822,
+		/* 10 */ 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822,
+		/* 20 */ 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822,
+		/* 30 */ 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822, 822,
+		/* 40 */ 822, 822, 822, 822, 822, 822, 822, 822, 822, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823,
+		/* 90 */ 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823,
+		/* A0 */ 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823, 823,
+		/* B0 */ 823, 823, 823, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824,
+		/* D0 */ 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824,
+		/* E0 */ 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824, 824,
+		/* F0 */ 824, 824, 824, 121, 121, 121, 121, 121, 121, 121, 825, 825, 825, 825, 825, 825,
+	},
+	{ /* 89 : 010D00 */
+		/* 00 */ 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826,
+		/* 10 */ 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826, 826,
+		/* 20 */ 826, 826, 827, 827, 828, 828, 828, 828, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 829, 829, 829, 829, 829, 829, 829, 829, 829, 829, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 90 : 010E00 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830,
+		/* 70 */ 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 830, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 91 : 010F00 */
+		/* 00 */ 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 831,
+		/* 10 */ 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 831, 832, 832, 832,
+		/* 20 */ 832, 832, 832, 832, 832, 832, 832, 831, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 833, 833, 833, 833, 833, 833, 833, 833, 833, 833, 833, 833, 833, 833, 833, 833,
+		/* 40 */ 833, 833, 833, 833, 833, 833, 834, 834, 834, 834, 834, 834, 834, 834, 834, 834,
+		/* 50 */ 834, 835, 835, 835, 835, 836, 836, 836, 836, 836, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837, 837,
+		/* F0 */ 837, 837, 837, 837, 837, 837, 837, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 92 : 011000 */
+		/* 00 */ 838, 839, 838, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840,
+		/* 10 */ 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840,
+		/* 20 */ 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840, 840,
+		/* 30 */ 840, 840, 840, 840, 840, 840, 840, 840, 839, 839, 839, 839, 839, 839, 839, 839,
+		/* 40 */ 839, 839, 839, 839, 839, 839, 841, 842, 842, 843, 843, 843, 843, 843, 121, 121,
+		/* 50 */ 121, 121, 844, 844, 844, 844, 844, 844, 844, 844, 844, 844, 844, 844, 844, 844,
+		/* 60 */ 844, 844, 844, 844, 844, 844, 845, 845, 845, 845, 845, 845, 845, 845, 845, 845,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 841,
+		/* 80 */ 846, 846, 847, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848,
+		/* 90 */ 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848,
+		/* A0 */ 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848, 848,
+		/* B0 */ 847, 847, 847, 849, 849, 849, 849, 847, 847, 850, 850, 851, 851, 852, 853, 853,
+		/* C0 */ 853, 853, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 852, 121, 121,
+		/* D0 */ 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854, 854,
+		/* E0 */ 854, 854, 854, 854, 854, 854, 854, 854, 854, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 855, 855, 855, 855, 855, 855, 855, 855, 855, 855, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 93 : 011100 */
+		/* 00 */ 856, 856, 856, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857,
+		/* 10 */ 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857, 857,
+		/* 20 */ 857, 857, 857, 857, 857, 857, 857, 856, 856, 856, 856, 856, 858, 856, 856, 856,
+		/* 30 */ 856, 856, 856, 859, 859, 121, 860, 860, 860, 860, 860, 860, 860, 860, 860, 860,
+		/* 40 */ 861, 862, 862, 862, 857, 858, 858, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863,
+		/* 60 */ 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863, 863,
+		/* 70 */ 863, 863, 863, 864, 865, 865, 863, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 866, 866, 867, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868,
+		/* 90 */ 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868,
+		/* A0 */ 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868, 868,
+		/* B0 */ 868, 868, 868, 867, 867, 867, 866, 866, 866, 866, 866, 866, 866, 866, 866, 867,
+		/* C0 */ 869, 868, 868, 868, 868, 870, 870, 871, 871, 872, 873, 873, 873, 870, 121, 121,
+		/* D0 */ 874, 874, 874, 874, 874, 874, 874, 874, 874, 874, 868, 871, 868, 871, 870, 870,
+		/* E0 */ 121, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875, 875,
+		/* F0 */ 875, 875, 875, 875, 875, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 94 : 011200 */
+		/* 00 */ 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876,
+		/* 10 */ 876, 876, 121, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876,
+		/* 20 */ 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 876, 877, 877, 877, 878,
+		/* 30 */ 878, 878, 877, 877, 878, 879, 880, 878, 881, 881, 882, 881, 881, 883, 878, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 884, 884, 884, 884, 884, 884, 884, 121, 884, 121, 884, 884, 884, 884, 121, 884,
+		/* 90 */ 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 884, 121, 884,
+		/* A0 */ 884, 884, 884, 884, 884, 884, 884, 884, 884, 885, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886,
+		/* C0 */ 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886,
+		/* D0 */ 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 886, 887,
+		/* E0 */ 888, 888, 888, 887, 887, 887, 887, 887, 887, 889, 889, 121, 121, 121, 121, 121,
+		/* F0 */ 890, 890, 890, 890, 890, 890, 890, 890, 890, 890, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 95 : 011300 */
+		/* 00 */ 891, 891, 892, 892, 121, 893, 893, 893, 893, 893, 893, 893, 893, 121, 121, 893,
+		/* 10 */ 893, 121, 121, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893, 893,
+		/* 20 */ 893, 893, 893, 893, 893, 893, 893, 893, 893, 121, 893, 893, 893, 893, 893, 893,
+		/* 30 */ 893, 121, 893, 893, 121, 893, 893, 893, 893, 893, 121, 117, 894, 893, 895, 892,
+		/* 40 */ 891, 892, 892, 892, 892, 121, 121, 892, 892, 121, 121, 892, 892, 896, 121, 121,
+		/* 50 */ 893, 121, 121, 121, 121, 121, 121, 895, 121, 121, 121, 121, 121, 897, 893, 893,
+		/* 60 */ 893, 893, 892, 892, 121, 121, 894, 894, 894, 894, 894, 894, 894, 121, 121, 121,
+		/* 70 */ 894, 894, 894, 894, 894, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 96 : 011400 */
+		/* 00 */ 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898,
+		/* 10 */ 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898,
+		/* 20 */ 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898, 898,
+		/* 30 */ 898, 898, 898, 898, 898, 899, 899, 899, 900, 900, 900, 900, 900, 900, 900, 900,
+		/* 40 */ 899, 899, 901, 900, 900, 899, 901, 898, 898, 898, 898, 902, 902, 903, 904, 904,
+		/* 50 */ 905, 905, 905, 905, 905, 905, 905, 905, 905, 905, 121, 903, 121, 904, 906, 898,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907,
+		/* 90 */ 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907,
+		/* A0 */ 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907, 907,
+		/* B0 */ 908, 909, 909, 910, 910, 910, 910, 910, 910, 909, 910, 909, 909, 908, 909, 910,
+		/* C0 */ 910, 909, 911, 911, 907, 907, 912, 907, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 913, 913, 913, 913, 913, 913, 913, 913, 913, 913, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 97 : 011500 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914,
+		/* 90 */ 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914,
+		/* A0 */ 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 914, 915,
+		/* B0 */ 916, 916, 917, 917, 917, 917, 121, 121, 916, 916, 916, 916, 917, 917, 916, 918,
+		/* C0 */ 918, 919, 920, 920, 921, 921, 922, 922, 922, 920, 920, 920, 920, 920, 920, 920,
+		/* D0 */ 920, 920, 920, 920, 920, 920, 920, 920, 914, 914, 914, 914, 917, 917, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 98 : 011600 */
+		/* 00 */ 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923,
+		/* 10 */ 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923,
+		/* 20 */ 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923, 923,
+		/* 30 */ 924, 924, 924, 925, 925, 925, 925, 925, 925, 925, 925, 924, 924, 925, 924, 926,
+		/* 40 */ 925, 927, 927, 928, 923, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 929, 929, 929, 929, 929, 929, 929, 929, 929, 929, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 406, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+		/* 90 */ 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930,
+		/* A0 */ 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 930, 931, 932, 931, 932, 932,
+		/* B0 */ 931, 931, 931, 931, 931, 931, 933, 934, 930, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 935, 935, 935, 935, 935, 935, 935, 935, 935, 935, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 99 : 011700 */
+		/* 00 */ 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936,
+		/* 10 */ 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 936, 121, 121, 937, 937, 937,
+		/* 20 */ 938, 938, 937, 937, 937, 937, 938, 937, 937, 937, 937, 939, 121, 121, 121, 121,
+		/* 30 */ 940, 940, 940, 940, 940, 940, 940, 940, 940, 940, 941, 941, 942, 942, 942, 943,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 100 : 011800 */
+		/* 00 */ 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944,
+		/* 10 */ 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944,
+		/* 20 */ 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 944, 945, 945, 945, 946,
+		/* 30 */ 946, 946, 946, 946, 946, 946, 946, 946, 945, 947, 947, 948, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949,
+		/* B0 */ 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949, 949,
+		/* C0 */ 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950,
+		/* D0 */ 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950, 950,
+		/* E0 */ 951, 951, 951, 951, 951, 951, 951, 951, 951, 951, 952, 952, 952, 952, 952, 952,
+		/* F0 */ 952, 952, 952, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 953,
+	},
+	{ /* 101 : 011900 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 954, 954, 954, 954, 954, 954, 954, 954, 121, 121, 954, 954, 954, 954, 954, 954,
+		/* B0 */ 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+		/* C0 */ 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954, 954,
+		/* D0 */ 954, 955, 955, 955, 956, 956, 956, 956, 121, 121, 956, 956, 955, 955, 955, 955,
+		/* E0 */ 957, 954, 958, 954, 955, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 102 : 011A00 */
+		/* 00 */ 959, 960, 960, 960, 960, 960, 960, 960, 960, 960, 960, 959, 959, 959, 959, 959,
+		/* 10 */ 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959,
+		/* 20 */ 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959, 959,
+		/* 30 */ 959, 959, 959, 961, 962, 960, 960, 960, 960, 963, 959, 960, 960, 960, 960, 964,
+		/* 40 */ 964, 964, 965, 965, 964, 964, 964, 962, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 966, 967, 967, 967, 967, 967, 967, 968, 968, 967, 967, 967, 966, 966, 966, 966,
+		/* 60 */ 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966,
+		/* 70 */ 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 966,
+		/* 80 */ 966, 966, 966, 966, 966, 966, 966, 966, 966, 966, 967, 967, 967, 967, 967, 967,
+		/* 90 */ 967, 967, 967, 967, 967, 967, 967, 968, 969, 970, 971, 972, 972, 966, 971, 971,
+		/* A0 */ 971, 973, 973, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974,
+		/* D0 */ 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974,
+		/* E0 */ 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974, 974,
+		/* F0 */ 974, 974, 974, 974, 974, 974, 974, 974, 974, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 103 : 011B00 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 104 : 011C00 */
+		/* 00 */ 975, 975, 975, 975, 975, 975, 975, 975, 975, 121, 975, 975, 975, 975, 975, 975,
+		/* 10 */ 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975,
+		/* 20 */ 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 975, 976,
+		/* 30 */ 977, 977, 977, 977, 977, 977, 977, 121, 977, 977, 977, 977, 977, 977, 976, 978,
+		/* 40 */ 975, 979, 979, 980, 981, 981, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 982, 982, 982, 982, 982, 982, 982, 982, 982, 982, 983, 983, 983, 983, 983, 983,
+		/* 60 */ 983, 983, 983, 983, 983, 983, 983, 983, 983, 983, 983, 983, 983, 121, 121, 121,
+		/* 70 */ 984, 985, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986,
+		/* 80 */ 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986, 986,
+		/* 90 */ 121, 121, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987, 987,
+		/* A0 */ 987, 987, 987, 987, 987, 987, 987, 987, 121, 988, 987, 987, 987, 987, 987, 987,
+		/* B0 */ 987, 988, 987, 987, 988, 987, 987, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 105 : 011D00 */
+		/* 00 */ 989, 989, 989, 989, 989, 989, 989, 121, 989, 989, 121, 989, 989, 989, 989, 989,
+		/* 10 */ 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989,
+		/* 20 */ 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989, 989,
+		/* 30 */ 989, 990, 990, 990, 990, 990, 990, 121, 121, 121, 990, 121, 990, 990, 121, 990,
+		/* 40 */ 990, 990, 991, 990, 991, 991, 989, 990, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 992, 992, 992, 992, 992, 992, 992, 992, 992, 992, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 993, 993, 993, 993, 993, 993, 121, 993, 993, 121, 993, 993, 993, 993, 993, 993,
+		/* 70 */ 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 993,
+		/* 80 */ 993, 993, 993, 993, 993, 993, 993, 993, 993, 993, 994, 994, 994, 994, 994, 121,
+		/* 90 */ 995, 995, 121, 994, 994, 995, 994, 996, 993, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 997, 997, 997, 997, 997, 997, 997, 997, 997, 997, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 106 : 011E00 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998, 998,
+		/* F0 */ 998, 998, 998, 999, 999, 1000, 1000, 1001, 1001, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 107 : 011F00 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282, 282,
+		/* D0 */ 282, 282, 282, 282, 282, 283, 283, 283, 283, 283, 283, 283, 283, 284, 284, 284,
+		/* E0 */ 284, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283, 283,
+		/* F0 */ 283, 283, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 1002,
+	},
+	{ /* 108 : 012000 */
+		/* 00 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 10 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 20 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 30 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 40 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 50 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 60 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 70 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 80 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 90 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* A0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* B0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* C0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* D0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* E0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* F0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+	},
+	{ /* 109 : 012300 */
+		/* 00 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 10 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 20 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 30 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 40 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 50 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 60 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 70 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 80 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 90 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 110 : 012400 */
+		/* 00 */ 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004,
+		/* 10 */ 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004,
+		/* 20 */ 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004,
+		/* 30 */ 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004,
+		/* 40 */ 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004,
+		/* 50 */ 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004,
+		/* 60 */ 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 1004, 121,
+		/* 70 */ 1005, 1005, 1005, 1005, 1005, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 90 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* A0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* B0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* C0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* D0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* E0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* F0 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+	},
+	{ /* 111 : 012500 */
+		/* 00 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 10 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 20 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 30 */ 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003,
+		/* 40 */ 1003, 1003, 1003, 1003, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 112 : 013000 */
+		/* 00 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 10 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 20 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 30 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 40 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 50 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 60 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 70 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 80 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 90 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* A0 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* B0 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* C0 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* D0 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* E0 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* F0 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+	},
+	{ /* 113 : 013400 */
+		/* 00 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 10 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006,
+		/* 20 */ 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 121,
+		/* 30 */ 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 114 : 014400 */
+		/* 00 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 10 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 20 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 30 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 40 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 50 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 60 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 70 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 80 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 90 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* A0 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* B0 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* C0 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* D0 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* E0 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* F0 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+	},
+	{ /* 115 : 014600 */
+		/* 00 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 10 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 20 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 30 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008,
+		/* 40 */ 1008, 1008, 1008, 1008, 1008, 1008, 1008, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 116 : 016800 */
+		/* 00 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 10 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 20 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 30 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 40 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 50 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 60 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 70 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 80 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 90 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* A0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* B0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* C0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* D0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* E0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* F0 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+	},
+	{ /* 117 : 016A00 */
+		/* 00 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 10 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 20 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648, 648,
+		/* 30 */ 648, 648, 648, 648, 648, 648, 648, 648, 648, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009,
+		/* 50 */ 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 121,
+		/* 60 */ 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 1010, 121, 121, 121, 121, 1011, 1011,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012,
+		/* E0 */ 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 1012, 121, 121,
+		/* F0 */ 1013, 1013, 1013, 1013, 1013, 1014, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 118 : 016B00 */
+		/* 00 */ 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+		/* 10 */ 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+		/* 20 */ 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+		/* 30 */ 1016, 1016, 1016, 1016, 1016, 1016, 1016, 1017, 1017, 1018, 1019, 1019, 1020, 1020, 1020, 1020,
+		/* 40 */ 1021, 1021, 1022, 1022, 1017, 1020, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 121, 1024, 1024, 1024, 1024, 1024,
+		/* 60 */ 1024, 1024, 121, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+		/* 70 */ 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 121, 121, 121, 121, 121, 1015, 1015, 1015,
+		/* 80 */ 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015, 1015,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 119 : 016E00 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025,
+		/* 50 */ 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025,
+		/* 60 */ 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026,
+		/* 70 */ 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026, 1026,
+		/* 80 */ 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1027,
+		/* 90 */ 1027, 1027, 1027, 1027, 1027, 1027, 1027, 1028, 1029, 1030, 1030, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 120 : 016F00 */
+		/* 00 */ 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+		/* 10 */ 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+		/* 20 */ 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+		/* 30 */ 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031,
+		/* 40 */ 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 121, 121, 121, 121, 1032,
+		/* 50 */ 1031, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+		/* 60 */ 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+		/* 70 */ 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033,
+		/* 80 */ 1033, 1033, 1033, 1033, 1033, 1033, 1033, 1033, 121, 121, 121, 121, 121, 121, 121, 1034,
+		/* 90 */ 1034, 1034, 1034, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 1036, 1037, 359, 197, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 121 : 017000 */
+		/* 00 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 10 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 20 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 30 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 40 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 50 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 60 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 70 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 80 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 90 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* A0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* B0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* C0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* D0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* E0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* F0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+	},
+	{ /* 122 : 018700 */
+		/* 00 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 10 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 20 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 30 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 40 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 50 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 60 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 70 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 80 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 90 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* A0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* B0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* C0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* D0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* E0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* F0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 123 : 018A00 */
+		/* 00 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 10 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 20 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 30 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 40 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 50 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 60 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 70 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 80 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* 90 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* A0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* B0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* C0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* D0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* E0 */ 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038, 1038,
+		/* F0 */ 1038, 1038, 1038, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 124 : 01B000 */
+		/* 00 */ 625, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 10 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 20 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 30 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 40 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 50 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 60 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 70 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 80 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 90 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* A0 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* B0 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* C0 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* D0 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* E0 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* F0 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+	},
+	{ /* 125 : 01B100 */
+		/* 00 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621,
+		/* 10 */ 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 621, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 621, 621, 621, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 625, 625, 625, 625, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 80 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 90 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* A0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* B0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* C0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* D0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* E0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* F0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+	},
+	{ /* 126 : 01B200 */
+		/* 00 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 10 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 20 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 30 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 40 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 50 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 60 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 70 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 80 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* 90 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* A0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* B0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* C0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* D0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* E0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039,
+		/* F0 */ 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 121, 121, 121, 121,
+	},
+	{ /* 127 : 01BC00 */
+		/* 00 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040,
+		/* 10 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040,
+		/* 20 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040,
+		/* 30 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040,
+		/* 40 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040,
+		/* 50 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040,
+		/* 60 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 121, 121, 121, 121, 121,
+		/* 70 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 121, 121, 121,
+		/* 80 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 121, 121, 1041, 1042, 1043, 1044,
+		/* A0 */ 525, 525, 525, 525, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 128 : 01D000 */
+		/* 00 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 10 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 20 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 30 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 40 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 50 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 60 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 70 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 80 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 90 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* A0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* B0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* C0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* D0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* E0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* F0 */ 346, 346, 346, 346, 346, 346, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 129 : 01D100 */
+		/* 00 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 10 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 20 */ 346, 346, 346, 346, 346, 346, 346, 121, 121, 346, 346, 346, 346, 346, 346, 346,
+		/* 30 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 40 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 50 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 60 */ 346, 346, 346, 346, 346, 1045, 1046, 114, 114, 114, 346, 346, 346, 493, 1047, 1047,
+		/* 70 */ 1047, 1047, 1047, 525, 525, 525, 525, 525, 525, 525, 525, 114, 114, 114, 114, 114,
+		/* 80 */ 114, 114, 114, 346, 346, 114, 114, 114, 114, 114, 114, 114, 346, 346, 346, 346,
+		/* 90 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* A0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 114, 114, 114, 114, 346, 346,
+		/* B0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* C0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* D0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* E0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 130 : 01D200 */
+		/* 00 */ 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751,
+		/* 10 */ 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751,
+		/* 20 */ 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751,
+		/* 30 */ 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751, 751,
+		/* 40 */ 751, 751, 1048, 1048, 1048, 751, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* F0 */ 30, 30, 30, 30, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 131 : 01D300 */
+		/* 00 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 10 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 20 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 30 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 40 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 50 */ 346, 346, 346, 346, 346, 346, 346, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 70 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 132 : 01D400 */
+		/* 00 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 10 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 548, 548, 548, 548, 548, 548,
+		/* 20 */ 548, 548, 559, 559, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* 30 */ 548, 548, 548, 548, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 40 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 548, 548,
+		/* 50 */ 548, 548, 548, 548, 548, 121, 559, 559, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* 60 */ 548, 548, 548, 548, 548, 548, 548, 548, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 70 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 80 */ 547, 547, 548, 548, 548, 548, 548, 548, 548, 548, 559, 559, 548, 548, 548, 548,
+		/* 90 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 547, 121, 547, 547,
+		/* A0 */ 121, 121, 547, 121, 121, 547, 547, 121, 121, 547, 547, 547, 547, 121, 547, 547,
+		/* B0 */ 547, 547, 547, 547, 547, 547, 548, 548, 548, 548, 121, 548, 121, 548, 559, 559,
+		/* C0 */ 548, 548, 548, 548, 121, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* D0 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* E0 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 548, 548, 548, 548, 548, 548,
+		/* F0 */ 548, 548, 559, 559, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+	},
+	{ /* 133 : 01D500 */
+		/* 00 */ 548, 548, 548, 548, 547, 547, 121, 547, 547, 547, 547, 121, 121, 547, 547, 547,
+		/* 10 */ 547, 547, 547, 547, 547, 121, 547, 547, 547, 547, 547, 547, 547, 121, 548, 548,
+		/* 20 */ 548, 548, 548, 548, 548, 548, 559, 559, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* 30 */ 548, 548, 548, 548, 548, 548, 548, 548, 547, 547, 121, 547, 547, 547, 547, 121,
+		/* 40 */ 547, 547, 547, 547, 547, 121, 547, 121, 121, 121, 547, 547, 547, 547, 547, 547,
+		/* 50 */ 547, 121, 548, 548, 548, 548, 548, 548, 548, 548, 559, 559, 548, 548, 548, 548,
+		/* 60 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 547, 547, 547, 547,
+		/* 70 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 80 */ 547, 547, 547, 547, 547, 547, 548, 548, 548, 548, 548, 548, 548, 548, 559, 559,
+		/* 90 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* A0 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* B0 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 548, 548, 548, 548, 548, 548,
+		/* C0 */ 548, 548, 559, 559, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* D0 */ 548, 548, 548, 548, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* E0 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 548, 548,
+		/* F0 */ 548, 548, 548, 548, 548, 548, 559, 559, 548, 548, 548, 548, 548, 548, 548, 548,
+	},
+	{ /* 134 : 01D600 */
+		/* 00 */ 548, 548, 548, 548, 548, 548, 548, 548, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 10 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 20 */ 547, 547, 548, 548, 548, 548, 548, 548, 548, 548, 559, 559, 548, 548, 548, 548,
+		/* 30 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 547, 547, 547, 547,
+		/* 40 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 50 */ 547, 547, 547, 547, 547, 547, 548, 548, 548, 548, 548, 548, 548, 548, 559, 559,
+		/* 60 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* 70 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 80 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 548, 548, 548, 548, 548, 548,
+		/* 90 */ 548, 548, 559, 559, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* A0 */ 548, 548, 548, 548, 548, 548, 121, 121, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* B0 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* C0 */ 547, 541, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* D0 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 541, 548, 548, 548, 548,
+		/* E0 */ 548, 548, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* F0 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 541, 548, 548, 548, 548,
+	},
+	{ /* 135 : 01D700 */
+		/* 00 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* 10 */ 548, 548, 548, 548, 548, 541, 548, 548, 548, 548, 548, 548, 547, 547, 547, 547,
+		/* 20 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 30 */ 547, 547, 547, 547, 547, 541, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* 40 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 541,
+		/* 50 */ 548, 548, 548, 548, 548, 548, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* 60 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 541,
+		/* 70 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* 80 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 541, 548, 548, 548, 548, 548, 548,
+		/* 90 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547, 547,
+		/* A0 */ 547, 547, 547, 547, 547, 547, 547, 547, 547, 541, 548, 548, 548, 548, 548, 548,
+		/* B0 */ 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548, 548,
+		/* C0 */ 548, 548, 548, 541, 548, 548, 548, 548, 548, 548, 547, 548, 121, 121, 1049, 1049,
+		/* D0 */ 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049,
+		/* E0 */ 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049,
+		/* F0 */ 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049, 1049,
+	},
+	{ /* 136 : 01D800 */
+		/* 00 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 10 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 20 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 30 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 40 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 50 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 60 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 70 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 80 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 90 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* A0 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* B0 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* C0 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* D0 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* E0 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* F0 */ 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+	},
+	{ /* 137 : 01DA00 */
+		/* 00 */ 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+		/* 10 */ 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+		/* 20 */ 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+		/* 30 */ 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1050, 1050, 1050, 1050, 1051, 1051, 1051, 1051, 1051,
+		/* 40 */ 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+		/* 50 */ 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+		/* 60 */ 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1050, 1050, 1050,
+		/* 70 */ 1050, 1050, 1050, 1050, 1050, 1051, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050,
+		/* 80 */ 1050, 1050, 1050, 1050, 1051, 1050, 1050, 1052, 1053, 1052, 1052, 1054, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 1051, 1051, 1051, 1051, 1051,
+		/* A0 */ 121, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 138 : 01E000 */
+		/* 00 */ 1055, 1055, 1055, 1055, 1055, 1055, 1055, 121, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+		/* 10 */ 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 121, 121, 1055, 1055, 1055, 1055, 1055,
+		/* 20 */ 1055, 1055, 121, 1055, 1055, 121, 1055, 1055, 1055, 1055, 1055, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 139 : 01E100 */
+		/* 00 */ 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
+		/* 10 */ 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
+		/* 20 */ 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 121, 121, 121,
+		/* 30 */ 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1058, 1058, 1058, 1058, 1058, 1059, 1059, 121, 121,
+		/* 40 */ 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 1060, 121, 121, 121, 121, 1056, 1061,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 140 : 01E200 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+		/* D0 */ 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+		/* E0 */ 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1063, 1063, 1063, 1063,
+		/* F0 */ 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 121, 121, 121, 121, 121, 1065,
+	},
+	{ /* 141 : 01E800 */
+		/* 00 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* 10 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* 20 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* 30 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* 40 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* 50 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* 60 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* 70 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* 80 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* 90 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* A0 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* B0 */ 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066, 1066,
+		/* C0 */ 1066, 1066, 1066, 1066, 1066, 121, 121, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067, 1067,
+		/* D0 */ 1068, 1068, 1068, 1068, 1068, 1068, 1068, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 142 : 01E900 */
+		/* 00 */ 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069,
+		/* 10 */ 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069,
+		/* 20 */ 1069, 1069, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070,
+		/* 30 */ 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070, 1070,
+		/* 40 */ 1070, 1070, 1070, 1070, 1071, 1071, 1071, 1072, 1073, 1073, 1073, 1074, 121, 121, 121, 121,
+		/* 50 */ 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 121, 121, 121, 121, 1076, 1076,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 143 : 01EC00 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 80 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 90 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* A0 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 346, 30, 30, 30,
+		/* B0 */ 319, 30, 30, 30, 30, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 144 : 01ED00 */
+		/* 00 */ 121, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 10 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30,
+		/* 20 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 346, 30,
+		/* 30 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 145 : 01EE00 */
+		/* 00 */ 1077, 1077, 1077, 1077, 121, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077,
+		/* 10 */ 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077,
+		/* 20 */ 121, 1077, 1077, 121, 1077, 121, 121, 1077, 121, 1077, 1077, 1077, 1077, 1077, 1077, 1077,
+		/* 30 */ 1077, 1077, 1077, 121, 1077, 1077, 1077, 1077, 121, 1077, 121, 1077, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 1077, 121, 121, 121, 121, 1077, 121, 1077, 121, 1077, 121, 1077, 1077, 1077,
+		/* 50 */ 121, 1077, 1077, 121, 1077, 121, 121, 1077, 121, 1077, 121, 1077, 121, 1077, 121, 1077,
+		/* 60 */ 121, 1077, 1077, 121, 1077, 121, 121, 1077, 1077, 1077, 1077, 121, 1077, 1077, 1077, 1077,
+		/* 70 */ 1077, 1077, 1077, 121, 1077, 1077, 1077, 1077, 121, 1077, 1077, 1077, 1077, 121, 1077, 121,
+		/* 80 */ 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 121, 1077, 1077, 1077, 1077, 1077,
+		/* 90 */ 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 121, 121, 121, 121,
+		/* A0 */ 121, 1077, 1077, 1077, 121, 1077, 1077, 1077, 1077, 1077, 121, 1077, 1077, 1077, 1077, 1077,
+		/* B0 */ 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 1077, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 189, 189, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 146 : 01F000 */
+		/* 00 */ 1078, 1078, 1078, 1078, 1079, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 10 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 20 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1080, 1080, 1080, 1080,
+		/* 30 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 40 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 50 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 60 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 70 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 80 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 90 */ 1078, 1078, 1078, 1078, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* A0 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1080,
+		/* B0 */ 1080, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* C0 */ 1080, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1079,
+		/* D0 */ 1080, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* E0 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* F0 */ 1078, 1078, 1078, 1078, 1078, 1078, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+	},
+	{ /* 147 : 01F100 */
+		/* 00 */ 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 1080, 1080, 1080,
+		/* 10 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 20 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 1078,
+		/* 30 */ 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081,
+		/* 40 */ 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 346, 346, 346, 346, 346, 346,
+		/* 50 */ 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081,
+		/* 60 */ 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 346, 346, 1078, 1080, 1080, 1080,
+		/* 70 */ 1082, 1082, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1082, 1082,
+		/* 80 */ 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 1081, 346, 346, 346, 346, 1079, 346,
+		/* 90 */ 346, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 346, 346, 346, 346, 346,
+		/* A0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 1080, 1080, 1080,
+		/* B0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* C0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* D0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* E0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083,
+		/* F0 */ 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083,
+	},
+	{ /* 148 : 01F200 */
+		/* 00 */ 1084, 1079, 550, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 10 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 1079, 346, 346, 346, 346, 346,
+		/* 20 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 1079,
+		/* 30 */ 346, 346, 1079, 1079, 1079, 1079, 1079, 550, 1079, 1079, 1079, 346, 1080, 1080, 1080, 1080,
+		/* 40 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 50 */ 1079, 1079, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 60 */ 1078, 1078, 1078, 1078, 1078, 1078, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 70 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 80 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 90 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* A0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* B0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* C0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* D0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* E0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* F0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+	},
+	{ /* 149 : 01F300 */
+		/* 00 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 10 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 20 */ 1079, 550, 1078, 1078, 550, 550, 550, 550, 550, 550, 550, 550, 550, 1079, 1079, 1079,
+		/* 30 */ 1079, 1079, 1079, 1079, 1079, 1079, 550, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 40 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 50 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 60 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 70 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 550, 1079, 1079,
+		/* 80 */ 1079, 1079, 1079, 1079, 1079, 1085, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 90 */ 1079, 1079, 1079, 1079, 1078, 1078, 550, 550, 1078, 550, 550, 550, 1078, 1078, 550, 550,
+		/* A0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* B0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* C0 */ 1079, 1079, 1085, 1085, 1085, 1079, 1079, 1085, 1079, 1079, 1085, 1086, 1086, 550, 550, 1079,
+		/* D0 */ 1079, 1079, 1079, 1079, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550, 550,
+		/* E0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* F0 */ 1079, 1078, 1078, 550, 1079, 550, 1078, 550, 1079, 1079, 1079, 1087, 1087, 1087, 1087, 1087,
+	},
+	{ /* 150 : 01F400 */
+		/* 00 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 10 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 20 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 30 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 550,
+		/* 40 */ 1079, 550, 1085, 1085, 1079, 1079, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
+		/* 50 */ 1085, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 60 */ 1079, 1079, 1079, 1079, 1079, 1079, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
+		/* 70 */ 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1079, 1079, 1079, 1085, 1079, 1079, 1079,
+		/* 80 */ 1079, 1085, 1085, 1085, 1079, 1085, 1085, 1085, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1085,
+		/* 90 */ 1079, 1085, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* A0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1085, 1079, 1079, 1079, 1079, 1079,
+		/* B0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* C0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* D0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* E0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* F0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 550, 1078, 1079,
+	},
+	{ /* 151 : 01F500 */
+		/* 00 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 10 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 20 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 30 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 346, 346,
+		/* 40 */ 346, 346, 346, 346, 346, 346, 1078, 1078, 1078, 550, 550, 1079, 1079, 1079, 1079, 1078,
+		/* 50 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 60 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 550,
+		/* 70 */ 550, 1078, 1078, 550, 1086, 1086, 550, 550, 550, 550, 1085, 1078, 1078, 1078, 1078, 1078,
+		/* 80 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 550, 1078, 1078, 550, 550, 550, 550, 1078, 1078,
+		/* 90 */ 1086, 1078, 1078, 1078, 1078, 1085, 1085, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* A0 */ 1078, 1078, 1078, 1078, 1079, 550, 1078, 1078, 550, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* B0 */ 1078, 550, 550, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 550, 1078, 1078, 1078,
+		/* C0 */ 1078, 1078, 550, 550, 550, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* D0 */ 1078, 550, 550, 550, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 550, 550, 550, 1078,
+		/* E0 */ 1078, 550, 1078, 550, 1078, 1078, 1078, 1078, 550, 1078, 1078, 1078, 1078, 1078, 1078, 550,
+		/* F0 */ 1078, 1078, 1078, 550, 1078, 1078, 1078, 1078, 1078, 1078, 550, 1079, 1079, 1079, 1079, 1079,
+	},
+	{ /* 152 : 01F600 */
+		/* 00 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 10 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 20 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 30 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 40 */ 1079, 1079, 1079, 1079, 1079, 1085, 1085, 1085, 1079, 1079, 1079, 1085, 1085, 1085, 1085, 1085,
+		/* 50 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 60 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 70 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 80 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 90 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* A0 */ 1079, 1079, 1079, 1085, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* B0 */ 1079, 1079, 1079, 1079, 1085, 1085, 1085, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* C0 */ 1085, 1079, 1079, 1079, 1079, 1079, 1078, 1078, 1078, 1078, 1078, 550, 1085, 550, 550, 550,
+		/* D0 */ 1079, 1079, 1079, 1078, 1078, 1079, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* E0 */ 550, 550, 550, 550, 550, 550, 1078, 1078, 1078, 550, 1078, 1079, 1079, 1080, 1080, 1080,
+		/* F0 */ 550, 1078, 1078, 550, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1080, 1080, 1080, 1080, 1080,
+	},
+	{ /* 153 : 01F700 */
+		/* 00 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 10 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 20 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 30 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 40 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 50 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 60 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 70 */ 346, 346, 346, 346, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 80 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 90 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* A0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* B0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* C0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* D0 */ 346, 346, 346, 346, 346, 1078, 1078, 1078, 1078, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* E0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1080, 1080, 1080, 1080,
+		/* F0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+	},
+	{ /* 154 : 01F800 */
+		/* 00 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 1080, 1080, 1080, 1080,
+		/* 10 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 20 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 30 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 40 */ 346, 346, 346, 346, 346, 346, 346, 346, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 50 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 60 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 70 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* 80 */ 346, 346, 346, 346, 346, 346, 346, 346, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 90 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346,
+		/* A0 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 1080, 1080,
+		/* B0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* C0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* D0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* E0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* F0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+	},
+	{ /* 155 : 01F900 */
+		/* 00 */ 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 346, 1080, 1079, 1079, 1085,
+		/* 10 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085,
+		/* 20 */ 1079, 1079, 1079, 1079, 1079, 1079, 1085, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 30 */ 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1079, 346, 1085, 1085, 1085, 1079,
+		/* 40 */ 1079, 1079, 1079, 1079, 1079, 1079, 346, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 50 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 60 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 70 */ 1079, 1079, 1080, 1079, 1079, 1079, 1079, 1080, 1080, 1080, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 80 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* 90 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* A0 */ 1079, 1079, 1079, 1080, 1080, 1079, 1079, 1079, 1079, 1079, 1079, 1080, 1080, 1080, 1079, 1079,
+		/* B0 */ 1088, 1088, 1088, 1088, 1079, 1085, 1085, 1079, 1085, 1085, 1079, 1085, 1079, 1079, 1079, 1079,
+		/* C0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1080, 1080, 1085, 1085, 1085,
+		/* D0 */ 1079, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1079, 1079,
+		/* E0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+		/* F0 */ 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+	},
+	{ /* 156 : 01FA00 */
+		/* 00 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 10 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 20 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 30 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 40 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078,
+		/* 50 */ 1078, 1078, 1078, 1078, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 60 */ 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1078, 1080, 1080,
+		/* 70 */ 1079, 1079, 1079, 1079, 1080, 1080, 1080, 1080, 1079, 1079, 1079, 1080, 1080, 1080, 1080, 1080,
+		/* 80 */ 1079, 1079, 1079, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 90 */ 1079, 1079, 1079, 1079, 1079, 1079, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* A0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* B0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* C0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* D0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* E0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* F0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+	},
+	{ /* 157 : 01FB00 */
+		/* 00 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 10 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 20 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 30 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 40 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 50 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 60 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 70 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 80 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 90 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* A0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* B0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* C0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* D0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* E0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* F0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+	},
+	{ /* 158 : 01FF00 */
+		/* 00 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 10 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 20 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 30 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 40 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 50 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 60 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 70 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 80 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* 90 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* A0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* B0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* C0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* D0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* E0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080,
+		/* F0 */ 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 732, 732,
+	},
+	{ /* 159 : 02A600 */
+		/* 00 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 10 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 20 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 30 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 40 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 50 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 60 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 70 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 80 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 90 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* A0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* B0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* C0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* D0 */ 631, 631, 631, 631, 631, 631, 631, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 160 : 02B700 */
+		/* 00 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 10 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 20 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 30 */ 631, 631, 631, 631, 631, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 50 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 60 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 70 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 80 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 90 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* A0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* B0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* C0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* D0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* E0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* F0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+	},
+	{ /* 161 : 02B800 */
+		/* 00 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 10 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 121, 121,
+		/* 20 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 30 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 40 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 50 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 60 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 70 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 80 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 90 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* A0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* B0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* C0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* D0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* E0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* F0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+	},
+	{ /* 162 : 02CE00 */
+		/* 00 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 10 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 20 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 30 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 40 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 50 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 60 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 70 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 80 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 90 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* A0 */ 631, 631, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* C0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* D0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* E0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* F0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+	},
+	{ /* 163 : 02EB00 */
+		/* 00 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 10 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 20 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 30 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 40 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 50 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 60 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 70 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 80 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* 90 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* A0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* B0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* C0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* D0 */ 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631, 631,
+		/* E0 */ 631, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 164 : 02FA00 */
+		/* 00 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728,
+		/* 10 */ 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 728, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	},
+	{ /* 165 : 02FF00 */
+		/* 00 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 10 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 20 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 30 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 40 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 50 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 60 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 70 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 80 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* 90 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* A0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* B0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* C0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* D0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* E0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+		/* F0 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 732, 732,
+	},
+	{ /* 166 : 0E0000 */
+		/* 00 */ 539, 540, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 10 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 20 */ 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089,
+		/* 30 */ 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089,
+		/* 40 */ 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089,
+		/* 50 */ 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089,
+		/* 60 */ 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089,
+		/* 70 */ 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089, 1089,
+		/* 80 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 90 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* A0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* B0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* C0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* D0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* E0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* F0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+	},
+	{ /* 167 : 0E0100 */
+		/* 00 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* 10 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* 20 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* 30 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* 40 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* 50 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* 60 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* 70 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* 80 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* 90 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* A0 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* B0 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* C0 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* D0 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* E0 */ 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733, 733,
+		/* F0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+	},
+	{ /* 168 : 0E0200 */
+		/* 00 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 10 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 20 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 30 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 40 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 50 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 60 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 70 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 80 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* 90 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* A0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* B0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* C0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* D0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* E0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+		/* F0 */ 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539, 539,
+	},
+	{ /* 169 : 0FFF00 */
+		/* 00 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 10 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 20 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 30 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 40 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 50 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 60 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 70 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 80 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* 90 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* A0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* B0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* C0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* D0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* E0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727,
+		/* F0 */ 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 727, 732, 732,
+	},
+};
+
+static const uint8_t record_index[] =
+{
+	/* 000000 */ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+	/* 001000 */ 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+	/* 002000 */ 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+	/* 003000 */ 48, 49, 50, 51, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 004000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 53, 52, 52,
+	/* 005000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 006000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 007000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 008000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 009000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 54,
+	/* 00A000 */ 55, 56, 56, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 65, 65, 65,
+	/* 00B000 */ 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+	/* 00C000 */ 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+	/* 00D000 */ 65, 65, 65, 65, 65, 65, 65, 66, 67, 67, 67, 67, 67, 67, 67, 67,
+	/* 00E000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 00F000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 69, 70, 71, 72, 73, 74, 75,
+	/* 010000 */ 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91,
+	/* 011000 */ 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+	/* 012000 */ 108, 108, 108, 109, 110, 111, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 013000 */ 112, 112, 112, 112, 113, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 014000 */ 103, 103, 103, 103, 114, 114, 115, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 015000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 016000 */ 103, 103, 103, 103, 103, 103, 103, 103, 116, 116, 117, 118, 103, 103, 119, 120,
+	/* 017000 */ 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+	/* 018000 */ 121, 121, 121, 121, 121, 121, 121, 122, 121, 121, 123, 103, 103, 103, 103, 103,
+	/* 019000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 01A000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 01B000 */ 124, 125, 126, 103, 103, 103, 103, 103, 103, 103, 103, 103, 127, 103, 103, 103,
+	/* 01C000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 01D000 */ 128, 129, 130, 131, 132, 133, 134, 135, 136, 136, 137, 103, 103, 103, 103, 103,
+	/* 01E000 */ 138, 139, 140, 103, 103, 103, 103, 103, 141, 142, 103, 103, 143, 144, 145, 103,
+	/* 01F000 */ 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 157, 157, 157, 158,
+	/* 020000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 021000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 022000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 023000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 024000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 025000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 026000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 027000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 028000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 029000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 02A000 */ 52, 52, 52, 52, 52, 52, 159, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 02B000 */ 52, 52, 52, 52, 52, 52, 52, 160, 161, 52, 52, 52, 52, 52, 52, 52,
+	/* 02C000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 162, 52,
+	/* 02D000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52,
+	/* 02E000 */ 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 52, 163, 103, 103, 103, 103,
+	/* 02F000 */ 103, 103, 103, 103, 103, 103, 103, 103, 69, 69, 164, 103, 103, 103, 103, 165,
+	/* 030000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 031000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 032000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 033000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 034000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 035000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 036000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 037000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 038000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 039000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 03A000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 03B000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 03C000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 03D000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 03E000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 03F000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 040000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 041000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 042000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 043000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 044000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 045000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 046000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 047000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 048000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 049000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 04A000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 04B000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 04C000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 04D000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 04E000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 04F000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 050000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 051000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 052000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 053000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 054000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 055000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 056000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 057000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 058000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 059000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 05A000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 05B000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 05C000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 05D000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 05E000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 05F000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 060000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 061000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 062000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 063000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 064000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 065000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 066000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 067000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 068000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 069000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 06A000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 06B000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 06C000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 06D000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 06E000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 06F000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 070000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 071000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 072000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 073000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 074000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 075000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 076000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 077000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 078000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 079000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 07A000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 07B000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 07C000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 07D000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 07E000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 07F000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 080000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 081000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 082000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 083000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 084000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 085000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 086000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 087000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 088000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 089000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 08A000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 08B000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 08C000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 08D000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 08E000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 08F000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 090000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 091000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 092000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 093000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 094000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 095000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 096000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 097000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 098000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 099000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 09A000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 09B000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 09C000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 09D000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 09E000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 09F000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 0A0000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0A1000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0A2000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0A3000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0A4000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0A5000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0A6000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0A7000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0A8000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0A9000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0AA000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0AB000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0AC000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0AD000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0AE000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0AF000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 0B0000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0B1000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0B2000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0B3000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0B4000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0B5000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0B6000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0B7000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0B8000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0B9000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0BA000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0BB000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0BC000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0BD000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0BE000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0BF000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 0C0000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0C1000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0C2000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0C3000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0C4000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0C5000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0C6000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0C7000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0C8000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0C9000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0CA000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0CB000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0CC000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0CD000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0CE000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0CF000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 0D0000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0D1000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0D2000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0D3000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0D4000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0D5000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0D6000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0D7000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0D8000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0D9000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0DA000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0DB000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0DC000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0DD000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0DE000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0DF000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 0E0000 */ 166, 167, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168, 168,
+	/* 0E1000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0E2000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0E3000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0E4000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0E5000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0E6000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0E7000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0E8000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0E9000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0EA000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0EB000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0EC000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0ED000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0EE000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+	/* 0EF000 */ 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 165,
+	/* 0F0000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0F1000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0F2000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0F3000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0F4000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0F5000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0F6000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0F7000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0F8000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0F9000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0FA000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0FB000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0FC000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0FD000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0FE000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 0FF000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 169,
+	/* 100000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 101000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 102000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 103000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 104000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 105000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 106000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 107000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 108000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 109000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 10A000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 10B000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 10C000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 10D000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 10E000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+	/* 10F000 */ 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 169,
+};
+
+const ucd_record *ucd_lookup_record(codepoint_t c)
+{
+	if (c > 0x10FFFF) return records; /* Invalid Unicode Codepoint */
+	return records + record_pages[record_index[c / 256]][c % 256];
+}
+
+codepoint_t ucd_record_toupper(const ucd_record *r, codepoint_t c)
+{
+	return (codepoint_t)(c + case_deltas[r->casing][0]);
+}
+
+codepoint_t ucd_record_tolower(const ucd_record *r, codepoint_t c)
+{
+	return (codepoint_t)(c + case_deltas[r->casing][1]);
+}
+
+codepoint_t ucd_record_totitle(const ucd_record *r, codepoint_t c)
+{
+	return (codepoint_t)(c + case_deltas[r->casing][2]);
+}
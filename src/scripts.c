@@ -3942,7 +3942,7 @@ static const uint8_t *scripts_0E0000_0E01FF[] =
 	scripts_0E0100,
 };
 
-ucd_script ucd_lookup_script(codepoint_t c)
+static ucd_script lookup_script(codepoint_t c)
 {
 	if (c <= 0x00D7FF) /* 000000..00D7FF */
 	{
@@ -3964,3 +3964,15 @@ ucd_script ucd_lookup_script(codepoint_t c)
 	if (c <= 0x10FFFF) return Zzzz; /* 0E0200..10FFFF : Unassigned */
 	return Zzzz; /* Invalid Unicode Codepoint */
 }
+
+ucd_script ucd_lookup_script(codepoint_t c)
+{
+	return lookup_script(c);
+}
+
+void ucd_lookup_script_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint8_t)lookup_script(in[i]);
+}
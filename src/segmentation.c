@@ -0,0 +1,164 @@
+/* Text Segmentation
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "ucd/ucd.h"
+#include "utf8.h"
+
+#include <string.h>
+
+size_t ucd_utf32_next_grapheme(const codepoint_t *in, size_t n)
+{
+	ucd_grapheme_break_state state;
+	size_t i;
+	if (n == 0)
+		return 0;
+	ucd_grapheme_break_init(&state);
+	ucd_grapheme_break_next(&state, in[0]);
+	for (i = 1; i < n; ++i)
+	{
+		if (ucd_grapheme_break_next(&state, in[i]))
+			break;
+	}
+	return i;
+}
+
+size_t ucd_utf8_next_grapheme(const char *in, size_t len)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	ucd_grapheme_break_state state;
+	codepoint_t c;
+	size_t i, used;
+	if (len == 0)
+		return 0;
+	/* ASCII codepoints are Other, Control, CR or LF, so there is always a
+	 * boundary between two of them except within a CR LF pair (GB3-GB5, GB999).
+	 */
+	if (p[0] < 0x80 && (len == 1 || (p[1] < 0x80 && !(p[0] == '\r' && p[1] == '\n'))))
+		return 1;
+	ucd_grapheme_break_init(&state);
+	i = utf8_decode(p, len, &c);
+	ucd_grapheme_break_next(&state, c);
+	while (i < len)
+	{
+		used = utf8_decode(p + i, len - i, &c);
+		if (ucd_grapheme_break_next(&state, c))
+			break;
+		i += used;
+	}
+	return i;
+}
+
+/* The scripts that the codepoints in a script run have in common. */
+typedef struct script_run_
+{
+	uint8_t scripts[UCD_MAX_SCRIPT_EXTENSIONS];
+	size_t n; /* 0 if the run only has Common and Inherited codepoints. */
+} script_run;
+
+/* Add a codepoint to the script run, returning zero if it does not share a
+ * script with the other codepoints in the run. The Common and Inherited
+ * codepoints are added to any run. Otherwise, the scripts of the run are
+ * intersected with the Script_Extensions of the codepoint.
+ */
+static int script_run_add(script_run *run, codepoint_t c)
+{
+	uint8_t scx[UCD_MAX_SCRIPT_EXTENSIONS];
+	size_t n = ucd_lookup_script_extensions(c, scx, UCD_MAX_SCRIPT_EXTENSIONS);
+	size_t i = 0, j = 0, m = 0;
+	if (n == 1 && (scx[0] == UCD_SCRIPT_Zyyy || scx[0] == UCD_SCRIPT_Zinh))
+		return 1;
+	if (run->n == 0)
+	{
+		memcpy(run->scripts, scx, n);
+		run->n = n;
+		return 1;
+	}
+	/* Both script sets are in script order. */
+	while (i < run->n && j < n)
+	{
+		if (run->scripts[i] < scx[j])
+			++i;
+		else if (run->scripts[i] > scx[j])
+			++j;
+		else
+		{
+			run->scripts[m++] = run->scripts[i];
+			++i;
+			++j;
+		}
+	}
+	if (m == 0)
+		return 0;
+	run->n = m;
+	return 1;
+}
+
+/* Return the script of a script run starting with the codepoint first. */
+static ucd_script script_run_script(const script_run *run, codepoint_t first)
+{
+	if (run->n == 0)
+		return ucd_lookup_script(first) == UCD_SCRIPT_Zinh ? UCD_SCRIPT_Zinh : UCD_SCRIPT_Zyyy;
+	return (ucd_script)run->scripts[0];
+}
+
+size_t ucd_utf32_next_script_run(const codepoint_t *in, size_t n, ucd_script *script)
+{
+	script_run run;
+	size_t i;
+	run.n = 0;
+	for (i = 0; i < n; ++i)
+	{
+		if (!script_run_add(&run, in[i]))
+			break;
+	}
+	*script = n == 0 ? UCD_SCRIPT_Zyyy : script_run_script(&run, in[0]);
+	return i;
+}
+
+size_t ucd_utf8_next_script_run(const char *in, size_t len, ucd_script *script)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	script_run run;
+	codepoint_t c, first = 0;
+	size_t i = 0, used;
+	run.n = 0;
+	while (i < len)
+	{
+		/* ASCII codepoints other than the Latin letters are Common. */
+		if (p[i] < 0x80 && !((p[i] | 0x20) >= 'a' && (p[i] | 0x20) <= 'z'))
+		{
+			if (i == 0)
+				first = p[i];
+			++i;
+			continue;
+		}
+		used = utf8_decode(p + i, len - i, &c);
+		if (c == UTF8_INVALID_CODEPOINT)
+			c = 0xFFFD; /* Displayed as the Common REPLACEMENT CHARACTER. */
+		if (!script_run_add(&run, c))
+			break;
+		if (i == 0)
+			first = c;
+		i += used;
+	}
+	*script = i == 0 ? UCD_SCRIPT_Zyyy : script_run_script(&run, first);
+	return i;
+}
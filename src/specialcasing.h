@@ -0,0 +1,47 @@
+/* Unicode Special Casing Data
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UNICODE_CHARACTER_DATA_SPECIALCASING_H
+#define UNICODE_CHARACTER_DATA_SPECIALCASING_H
+
+#include "ucd/ucd.h"
+
+/* The unconditional full case mappings for a codepoint from SpecialCasing.txt.
+ * The mappings are all in the BMP, and are terminated by a 0 entry if they
+ * are shorter than UCD_MAX_FULL_CASE_MAPPING codepoints.
+ */
+typedef struct special_casing_entry_
+{
+	uint16_t codepoint;
+	uint16_t lower[UCD_MAX_FULL_CASE_MAPPING];
+	uint16_t title[UCD_MAX_FULL_CASE_MAPPING];
+	uint16_t upper[UCD_MAX_FULL_CASE_MAPPING];
+} special_casing_entry;
+
+/* Return the full case mappings for the codepoint, or NULL if the codepoint
+ * does not have any. This is only called for codepoints flagged as having
+ * special casing in the case conversion table.
+ */
+#if defined(__GNUC__) && !defined(_WIN32)
+__attribute__((visibility("hidden")))
+#endif
+const special_casing_entry *ucd_lookup_special_casing(codepoint_t c);
+
+#endif
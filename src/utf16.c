@@ -0,0 +1,107 @@
+/* UTF-16 APIs.
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "ucd/ucd.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/* The number of codepoints decoded at a time by the classification functions. */
+#define CHUNK_SIZE 256
+
+#define IS_HIGH_SURROGATE(u) ((u & 0xFC00) == 0xD800)
+#define IS_LOW_SURROGATE(u)  ((u & 0xFC00) == 0xDC00)
+
+/* Decode the surrogate pair, or non-surrogate code unit, at in[i]. Unpaired
+ * surrogates are decoded as the surrogate codepoint.
+ */
+#define DECODE_ONE(in, len, i, out, o) \
+	do { \
+		if (IS_HIGH_SURROGATE(in[i]) && i + 1 < len && IS_LOW_SURROGATE(in[i + 1])) \
+		{ \
+			out[o++] = 0x10000 + ((codepoint_t)(in[i] - 0xD800) << 10) + (in[i + 1] - 0xDC00); \
+			i += 2; \
+		} \
+		else \
+			out[o++] = in[i++]; \
+	} while (0)
+
+size_t ucd_utf16_decode(const uint16_t *in, size_t len, codepoint_t *out, size_t n, size_t *used)
+{
+	size_t i = 0;
+	size_t o = 0;
+#if defined(__SSE2__)
+	const __m128i zero = _mm_setzero_si128();
+	const __m128i surrogate_mask = _mm_set1_epi16((short)0xF800);
+	const __m128i surrogate = _mm_set1_epi16((short)0xD800);
+	while (i + 8 <= len && o + 8 <= n)
+	{
+		__m128i units = _mm_loadu_si128((const __m128i *)(in + i));
+		__m128i is_surrogate = _mm_cmpeq_epi16(_mm_and_si128(units, surrogate_mask), surrogate);
+		int mask = _mm_movemask_epi8(is_surrogate);
+		if (mask == 0) /* 8 BMP non-surrogate codepoints */
+		{
+			_mm_storeu_si128((__m128i *)(out + o),     _mm_unpacklo_epi16(units, zero));
+			_mm_storeu_si128((__m128i *)(out + o + 4), _mm_unpackhi_epi16(units, zero));
+			i += 8;
+			o += 8;
+		}
+		else
+		{
+			/* Copy the non-surrogate prefix, then decode the first surrogate. */
+			size_t end = i + __builtin_ctz((unsigned)mask) / 2;
+			while (i < end)
+				out[o++] = in[i++];
+			DECODE_ONE(in, len, i, out, o);
+		}
+	}
+#endif
+	while (i < len && o < n)
+		DECODE_ONE(in, len, i, out, o);
+	if (used) *used = i;
+	return o;
+}
+
+/* Define a function that decodes the UTF-16 data in chunks, passing each chunk
+ * to the codepoint buffer version of the lookup function.
+ */
+#define UTF16_LOOKUP_N(name, lookup_n, type) \
+	size_t name(const uint16_t *in, size_t len, type *out) \
+	{ \
+		codepoint_t codepoints[CHUNK_SIZE]; \
+		size_t ret = 0; \
+		while (len > 0) \
+		{ \
+			size_t used; \
+			size_t n = ucd_utf16_decode(in, len, codepoints, CHUNK_SIZE, &used); \
+			lookup_n(codepoints, n, out + ret); \
+			ret += n; \
+			in  += used; \
+			len -= used; \
+		} \
+		return ret; \
+	}
+
+UTF16_LOOKUP_N(ucd_utf16_lookup_category_n, ucd_lookup_category_n, uint8_t)
+UTF16_LOOKUP_N(ucd_utf16_lookup_script_n, ucd_lookup_script_n, uint8_t)
+UTF16_LOOKUP_N(ucd_utf16_lookup_properties_n, ucd_lookup_properties_n, ucd_property)
+UTF16_LOOKUP_N(ucd_utf16_ctype_mask_n, ucd_ctype_mask_n, ucd_ctype)
@@ -0,0 +1,1031 @@
+/* UTF-8 APIs.
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "ucd/ucd.h"
+#include "utf8.h"
+
+#include <string.h>
+
+#if defined(__SSE2__) || defined(HAVE_AVX2_DISPATCH)
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+/* The number of codepoints decoded at a time by the classification functions. */
+#define CHUNK_SIZE 256
+
+/* Decode the non-ASCII sequence, or ASCII character, at in[i]. */
+#define DECODE_ONE(in, len, i, out, o) \
+	do { \
+		if (in[i] < 0x80) \
+			out[o++] = in[i++]; \
+		else \
+			i += utf8_decode(in + i, len - i, out + o++); \
+	} while (0)
+
+#if !defined(__SSE2__) && !(defined(__ARM_NEON) && defined(__aarch64__))
+static size_t decode_scalar(const uint8_t *in, size_t len, codepoint_t *out, size_t n, size_t *used)
+{
+	size_t i = 0;
+	size_t o = 0;
+	while (i < len && o < n)
+		DECODE_ONE(in, len, i, out, o);
+	*used = i;
+	return o;
+}
+#endif
+
+/* Return the number of ASCII characters at the start of in that fit in the
+ * out buffer. This checks up to 256 bytes at a time, so the ASCII characters
+ * are still in the L1 cache when they are widened.
+ */
+static __inline__ size_t ascii_length(const uint8_t *in, size_t len, size_t n)
+{
+	if (len > n)
+		len = n;
+	return utf8_ascii_length(in, len < 256 ? len : 256);
+}
+
+/* Widen the ASCII characters in the in[i..end) range 16 at a time. */
+#define WIDEN_ASCII(in, i, end, out, o, widen16) \
+	do { \
+		for (; i + 16 <= end; i += 16, o += 16) \
+			widen16(in + i, out + o); \
+		while (i < end) \
+			out[o++] = in[i++]; \
+	} while (0)
+
+/* Return the number of bytes used by the ASCII characters and 2 and 3 byte
+ * sequences in a block of size bytes, given the masks of the ASCII, lead and
+ * continuation bytes in the block, or 0 if the block has a 4 byte or an
+ * ill-formed sequence. The last sequence can end up to 2 bytes after the end
+ * of the block, so the caller checks those continuation bytes.
+ *
+ * The ASCII characters after the last 2 or 3 byte sequence are not used, so
+ * they are widened 16 at a time instead.
+ */
+static __inline__ size_t block_length(size_t size, uint32_t ascii, uint32_t lead2, uint32_t lead3, uint32_t cont)
+{
+	uint64_t all = ((uint64_t)1 << size) - 1;
+	uint64_t expected = ((uint64_t)(lead2 | lead3) << 1) | ((uint64_t)lead3 << 2);
+	if ((ascii | lead2 | lead3 | cont) != all || (expected & all) != cont)
+		return 0;
+	if (expected >> size)
+		return size + ((expected >> size) & 1) + ((expected >> (size + 1)) & 1);
+	return 32 - (size_t)__builtin_clz(lead2 | lead3 | cont);
+}
+
+/* Store the codepoints at the start of each sequence in the first length bytes
+ * of the block.
+ */
+static __inline__ size_t compact_block(const uint16_t *values, uint32_t starts, size_t length, codepoint_t *out)
+{
+	size_t o = 0;
+	if (length < 32)
+		starts &= ((uint32_t)1 << length) - 1;
+	while (starts)
+	{
+		out[o++] = values[__builtin_ctz(starts)];
+		starts &= starts - 1;
+	}
+	return o;
+}
+
+/* Decode the block at in[i], or the non-ASCII sequence at in[i] if the block
+ * has a 4 byte or an ill-formed sequence. The scalar decoder is then used for
+ * the rest of the block, so that text with those sequences is not checked a
+ * block at a time for each codepoint. A 4 byte sequence, or a 2 byte sequence
+ * followed by an ASCII character like an accented letter in Latin text, also
+ * uses the scalar decoder.
+ */
+#define DECODE_BLOCK(in, len, i, out, n, o, scalar_end, size, decode_block) \
+	do { \
+		size_t used_, count_; \
+		if (in[i] < 0xF0 && i + size + 2 <= len && in[i + 2] >= 0x80 && i >= scalar_end && n - o >= size) \
+		{ \
+			used_ = decode_block(in + i, out + o, &count_); \
+			if (used_ != 0) \
+			{ \
+				i += used_; \
+				o += count_; \
+				break; \
+			} \
+			scalar_end = i + size; \
+		} \
+		i += utf8_decode(in + i, len - i, out + o++); \
+	} while (0)
+
+#if defined(__SSE2__)
+static __inline__ void widen16_sse2(const uint8_t *in, codepoint_t *out)
+{
+	const __m128i zero = _mm_setzero_si128();
+	__m128i bytes = _mm_loadu_si128((const __m128i *)in);
+	__m128i lo = _mm_unpacklo_epi8(bytes, zero);
+	__m128i hi = _mm_unpackhi_epi8(bytes, zero);
+	_mm_storeu_si128((__m128i *)(out),      _mm_unpacklo_epi16(lo, zero));
+	_mm_storeu_si128((__m128i *)(out + 4),  _mm_unpackhi_epi16(lo, zero));
+	_mm_storeu_si128((__m128i *)(out + 8),  _mm_unpacklo_epi16(hi, zero));
+	_mm_storeu_si128((__m128i *)(out + 12), _mm_unpackhi_epi16(hi, zero));
+}
+
+/* Calculate the codepoints of the ASCII characters and 2 and 3 byte sequences
+ * in 8 bytes, widened to 16 bits, using the bytes after each byte (b1, b2).
+ */
+static __inline__ __m128i codepoints8_sse2(__m128i b0, __m128i b1, __m128i b2, __m128i lead2, __m128i lead3)
+{
+	const __m128i low6 = _mm_set1_epi16(0x3F);
+	__m128i c1 = _mm_and_si128(b1, low6);
+	__m128i c2 = _mm_and_si128(b2, low6);
+	__m128i v2 = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(b0, _mm_set1_epi16(0x1F)), 6), c1);
+	__m128i v3 = _mm_or_si128(_mm_or_si128(_mm_slli_epi16(b0, 12), _mm_slli_epi16(c1, 6)), c2);
+	__m128i v = _mm_or_si128(_mm_andnot_si128(lead2, b0), _mm_and_si128(lead2, v2));
+	return _mm_or_si128(_mm_andnot_si128(lead3, v), _mm_and_si128(lead3, v3));
+}
+
+/* Decode the ASCII characters and 2 and 3 byte sequences in the 16 bytes at
+ * in, returning the number of bytes used, or 0 if the block has a 4 byte or
+ * an ill-formed sequence (see block_length). This reads 18 bytes.
+ */
+static __inline__ size_t decode16_sse2(const uint8_t *in, codepoint_t *out, size_t *count)
+{
+	const __m128i zero = _mm_setzero_si128();
+	uint16_t values[16];
+	__m128i b0 = _mm_loadu_si128((const __m128i *)in);
+	__m128i b1 = _mm_loadu_si128((const __m128i *)(in + 1));
+	__m128i b2 = _mm_loadu_si128((const __m128i *)(in + 2));
+	/* The signed comparisons treat 0x80-0xFF as -128 to -1. */
+	__m128i cont0 = _mm_cmplt_epi8(b0, _mm_set1_epi8((char)0xC0));
+	__m128i cont1 = _mm_cmplt_epi8(b1, _mm_set1_epi8((char)0xC0));
+	__m128i cont2 = _mm_cmplt_epi8(b2, _mm_set1_epi8((char)0xC0));
+	__m128i lead2 = _mm_and_si128(_mm_cmpgt_epi8(b0, _mm_set1_epi8((char)0xC1)), _mm_cmplt_epi8(b0, _mm_set1_epi8((char)0xE0)));
+	__m128i lead3 = _mm_cmpeq_epi8(_mm_and_si128(b0, _mm_set1_epi8((char)0xF0)), _mm_set1_epi8((char)0xE0));
+	__m128i invalid = _mm_or_si128(_mm_andnot_si128(cont1, lead2), _mm_andnot_si128(_mm_and_si128(cont1, cont2), lead3));
+	size_t length;
+	invalid = _mm_or_si128(invalid, _mm_and_si128(_mm_cmpeq_epi8(b0, _mm_set1_epi8((char)0xE0)), _mm_cmplt_epi8(b1, _mm_set1_epi8((char)0xA0)))); /* overlong */
+	invalid = _mm_or_si128(invalid, _mm_and_si128(_mm_cmpeq_epi8(b0, _mm_set1_epi8((char)0xED)), _mm_cmpgt_epi8(b1, _mm_set1_epi8((char)0x9F)))); /* surrogates */
+	if (_mm_movemask_epi8(invalid))
+		return 0;
+	length = block_length(16,
+	                      (uint32_t)(~_mm_movemask_epi8(b0) & 0xFFFF),
+	                      (uint32_t)_mm_movemask_epi8(lead2),
+	                      (uint32_t)_mm_movemask_epi8(lead3),
+	                      (uint32_t)_mm_movemask_epi8(cont0));
+	if (length == 0)
+		return 0;
+	_mm_storeu_si128((__m128i *)values, codepoints8_sse2(
+		_mm_unpacklo_epi8(b0, zero), _mm_unpacklo_epi8(b1, zero), _mm_unpacklo_epi8(b2, zero),
+		_mm_unpacklo_epi8(lead2, lead2), _mm_unpacklo_epi8(lead3, lead3)));
+	_mm_storeu_si128((__m128i *)(values + 8), codepoints8_sse2(
+		_mm_unpackhi_epi8(b0, zero), _mm_unpackhi_epi8(b1, zero), _mm_unpackhi_epi8(b2, zero),
+		_mm_unpackhi_epi8(lead2, lead2), _mm_unpackhi_epi8(lead3, lead3)));
+	*count = compact_block(values, (uint32_t)_mm_movemask_epi8(_mm_xor_si128(cont0, _mm_set1_epi8((char)0xFF))), length, out);
+	return length;
+}
+
+static size_t decode_sse2(const uint8_t *in, size_t len, codepoint_t *out, size_t n, size_t *used)
+{
+	size_t i = 0;
+	size_t o = 0;
+	size_t end, scalar_end = 0;
+	while (i < len && o < n)
+	{
+		if (in[i] >= 0x80)
+		{
+			DECODE_BLOCK(in, len, i, out, n, o, scalar_end, 16, decode16_sse2);
+			continue;
+		}
+		end = i + ascii_length(in + i, len - i, n - o);
+		WIDEN_ASCII(in, i, end, out, o, widen16_sse2);
+	}
+	*used = i;
+	return o;
+}
+#endif
+
+#if defined(HAVE_AVX2_DISPATCH)
+__attribute__((target("avx2")))
+static __inline__ void widen16_avx2(const uint8_t *in, codepoint_t *out)
+{
+	__m128i bytes = _mm_loadu_si128((const __m128i *)in);
+	_mm256_storeu_si256((__m256i *)(out),     _mm256_cvtepu8_epi32(bytes));
+	_mm256_storeu_si256((__m256i *)(out + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8)));
+}
+
+/* Calculate the codepoints of the ASCII characters and 2 and 3 byte sequences
+ * in 16 bytes, widened to 16 bits, using the bytes after each byte (b1, b2).
+ */
+__attribute__((target("avx2")))
+static __inline__ __m256i codepoints16_avx2(__m128i b0, __m128i b1, __m128i b2, __m128i lead2, __m128i lead3)
+{
+	const __m256i low6 = _mm256_set1_epi16(0x3F);
+	__m256i x0 = _mm256_cvtepu8_epi16(b0);
+	__m256i c1 = _mm256_and_si256(_mm256_cvtepu8_epi16(b1), low6);
+	__m256i c2 = _mm256_and_si256(_mm256_cvtepu8_epi16(b2), low6);
+	__m256i v2 = _mm256_or_si256(_mm256_slli_epi16(_mm256_and_si256(x0, _mm256_set1_epi16(0x1F)), 6), c1);
+	__m256i v3 = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi16(x0, 12), _mm256_slli_epi16(c1, 6)), c2);
+	__m256i v = _mm256_blendv_epi8(x0, v2, _mm256_cvtepi8_epi16(lead2));
+	return _mm256_blendv_epi8(v, v3, _mm256_cvtepi8_epi16(lead3));
+}
+
+/* Decode the ASCII characters and 2 and 3 byte sequences in the 32 bytes at
+ * in, returning the number of bytes used, or 0 if the block has a 4 byte or
+ * an ill-formed sequence (see block_length). This reads 34 bytes.
+ */
+__attribute__((target("avx2")))
+static __inline__ size_t decode32_avx2(const uint8_t *in, codepoint_t *out, size_t *count)
+{
+	uint16_t values[32];
+	__m256i b0 = _mm256_loadu_si256((const __m256i *)in);
+	__m256i b1 = _mm256_loadu_si256((const __m256i *)(in + 1));
+	__m256i b2 = _mm256_loadu_si256((const __m256i *)(in + 2));
+	/* The signed comparisons treat 0x80-0xFF as -128 to -1. */
+	__m256i cont0 = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)0xC0), b0);
+	__m256i cont1 = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)0xC0), b1);
+	__m256i cont2 = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)0xC0), b2);
+	__m256i lead2 = _mm256_and_si256(_mm256_cmpgt_epi8(b0, _mm256_set1_epi8((char)0xC1)), _mm256_cmpgt_epi8(_mm256_set1_epi8((char)0xE0), b0));
+	__m256i lead3 = _mm256_cmpeq_epi8(_mm256_and_si256(b0, _mm256_set1_epi8((char)0xF0)), _mm256_set1_epi8((char)0xE0));
+	__m256i invalid = _mm256_or_si256(_mm256_andnot_si256(cont1, lead2), _mm256_andnot_si256(_mm256_and_si256(cont1, cont2), lead3));
+	size_t length;
+	invalid = _mm256_or_si256(invalid, _mm256_and_si256(_mm256_cmpeq_epi8(b0, _mm256_set1_epi8((char)0xE0)), _mm256_cmpgt_epi8(_mm256_set1_epi8((char)0xA0), b1))); /* overlong */
+	invalid = _mm256_or_si256(invalid, _mm256_and_si256(_mm256_cmpeq_epi8(b0, _mm256_set1_epi8((char)0xED)), _mm256_cmpgt_epi8(b1, _mm256_set1_epi8((char)0x9F)))); /* surrogates */
+	if (_mm256_movemask_epi8(invalid))
+		return 0;
+	length = block_length(32,
+	                      ~(uint32_t)_mm256_movemask_epi8(b0),
+	                      (uint32_t)_mm256_movemask_epi8(lead2),
+	                      (uint32_t)_mm256_movemask_epi8(lead3),
+	                      (uint32_t)_mm256_movemask_epi8(cont0));
+	if (length == 0)
+		return 0;
+	_mm256_storeu_si256((__m256i *)values, codepoints16_avx2(
+		_mm256_castsi256_si128(b0), _mm256_castsi256_si128(b1), _mm256_castsi256_si128(b2),
+		_mm256_castsi256_si128(lead2), _mm256_castsi256_si128(lead3)));
+	_mm256_storeu_si256((__m256i *)(values + 16), codepoints16_avx2(
+		_mm256_extracti128_si256(b0, 1), _mm256_extracti128_si256(b1, 1), _mm256_extracti128_si256(b2, 1),
+		_mm256_extracti128_si256(lead2, 1), _mm256_extracti128_si256(lead3, 1)));
+	*count = compact_block(values, ~(uint32_t)_mm256_movemask_epi8(cont0), length, out);
+	return length;
+}
+
+__attribute__((target("avx2")))
+static size_t decode_avx2(const uint8_t *in, size_t len, codepoint_t *out, size_t n, size_t *used)
+{
+	size_t i = 0;
+	size_t o = 0;
+	size_t end, scalar_end = 0;
+	while (i < len && o < n)
+	{
+		if (in[i] >= 0x80)
+		{
+			DECODE_BLOCK(in, len, i, out, n, o, scalar_end, 32, decode32_avx2);
+			continue;
+		}
+		end = i + ascii_length(in + i, len - i, n - o);
+		WIDEN_ASCII(in, i, end, out, o, widen16_avx2);
+	}
+	*used = i;
+	return o;
+}
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+static __inline__ void widen16_neon(const uint8_t *in, codepoint_t *out)
+{
+	uint8x16_t bytes = vld1q_u8(in);
+	uint16x8_t lo = vmovl_u8(vget_low_u8(bytes));
+	uint16x8_t hi = vmovl_u8(vget_high_u8(bytes));
+	vst1q_u32(out,      vmovl_u16(vget_low_u16(lo)));
+	vst1q_u32(out + 4,  vmovl_u16(vget_high_u16(lo)));
+	vst1q_u32(out + 8,  vmovl_u16(vget_low_u16(hi)));
+	vst1q_u32(out + 12, vmovl_u16(vget_high_u16(hi)));
+}
+
+/* Return a bit for each byte in the mask, like _mm_movemask_epi8. */
+static __inline__ uint32_t movemask_neon(uint8x16_t mask)
+{
+	static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+	uint8x16_t masked = vandq_u8(mask, vld1q_u8(bits));
+	return (uint32_t)vaddv_u8(vget_low_u8(masked)) | ((uint32_t)vaddv_u8(vget_high_u8(masked)) << 8);
+}
+
+/* Calculate the codepoints of the ASCII characters and 2 and 3 byte sequences
+ * in 8 bytes, widened to 16 bits, using the bytes after each byte (b1, b2).
+ */
+static __inline__ uint16x8_t codepoints8_neon(uint8x8_t b0, uint8x8_t b1, uint8x8_t b2, uint8x8_t lead2, uint8x8_t lead3)
+{
+	const uint16x8_t low6 = vdupq_n_u16(0x3F);
+	uint16x8_t x0 = vmovl_u8(b0);
+	uint16x8_t c1 = vandq_u16(vmovl_u8(b1), low6);
+	uint16x8_t c2 = vandq_u16(vmovl_u8(b2), low6);
+	uint16x8_t v2 = vorrq_u16(vshlq_n_u16(vandq_u16(x0, vdupq_n_u16(0x1F)), 6), c1);
+	uint16x8_t v3 = vorrq_u16(vorrq_u16(vshlq_n_u16(x0, 12), vshlq_n_u16(c1, 6)), c2);
+	uint16x8_t v = vbslq_u16(vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(lead2))), v2, x0);
+	return vbslq_u16(vreinterpretq_u16_s16(vmovl_s8(vreinterpret_s8_u8(lead3))), v3, v);
+}
+
+/* Decode the ASCII characters and 2 and 3 byte sequences in the 16 bytes at
+ * in, returning the number of bytes used, or 0 if the block has a 4 byte or
+ * an ill-formed sequence (see block_length). This reads 18 bytes.
+ */
+static __inline__ size_t decode16_neon(const uint8_t *in, codepoint_t *out, size_t *count)
+{
+	uint16_t values[16];
+	uint8x16_t b0 = vld1q_u8(in);
+	uint8x16_t b1 = vld1q_u8(in + 1);
+	uint8x16_t b2 = vld1q_u8(in + 2);
+	uint8x16_t cont0 = vceqq_u8(vandq_u8(b0, vdupq_n_u8(0xC0)), vdupq_n_u8(0x80));
+	uint8x16_t cont1 = vceqq_u8(vandq_u8(b1, vdupq_n_u8(0xC0)), vdupq_n_u8(0x80));
+	uint8x16_t cont2 = vceqq_u8(vandq_u8(b2, vdupq_n_u8(0xC0)), vdupq_n_u8(0x80));
+	uint8x16_t lead2 = vandq_u8(vcgeq_u8(b0, vdupq_n_u8(0xC2)), vcleq_u8(b0, vdupq_n_u8(0xDF)));
+	uint8x16_t lead3 = vceqq_u8(vandq_u8(b0, vdupq_n_u8(0xF0)), vdupq_n_u8(0xE0));
+	uint8x16_t invalid = vorrq_u8(vbicq_u8(lead2, cont1), vbicq_u8(lead3, vandq_u8(cont1, cont2)));
+	size_t length;
+	invalid = vorrq_u8(invalid, vandq_u8(vceqq_u8(b0, vdupq_n_u8(0xE0)), vcltq_u8(b1, vdupq_n_u8(0xA0)))); /* overlong */
+	invalid = vorrq_u8(invalid, vandq_u8(vceqq_u8(b0, vdupq_n_u8(0xED)), vcgtq_u8(b1, vdupq_n_u8(0x9F)))); /* surrogates */
+	if (vmaxvq_u8(invalid))
+		return 0;
+	length = block_length(16,
+	                      movemask_neon(vcltq_u8(b0, vdupq_n_u8(0x80))),
+	                      movemask_neon(lead2),
+	                      movemask_neon(lead3),
+	                      movemask_neon(cont0));
+	if (length == 0)
+		return 0;
+	vst1q_u16(values, codepoints8_neon(
+		vget_low_u8(b0), vget_low_u8(b1), vget_low_u8(b2), vget_low_u8(lead2), vget_low_u8(lead3)));
+	vst1q_u16(values + 8, codepoints8_neon(
+		vget_high_u8(b0), vget_high_u8(b1), vget_high_u8(b2), vget_high_u8(lead2), vget_high_u8(lead3)));
+	*count = compact_block(values, movemask_neon(vmvnq_u8(cont0)), length, out);
+	return length;
+}
+
+static size_t decode_neon(const uint8_t *in, size_t len, codepoint_t *out, size_t n, size_t *used)
+{
+	size_t i = 0;
+	size_t o = 0;
+	size_t end, scalar_end = 0;
+	while (i < len && o < n)
+	{
+		if (in[i] >= 0x80)
+		{
+			DECODE_BLOCK(in, len, i, out, n, o, scalar_end, 16, decode16_neon);
+			continue;
+		}
+		end = i + ascii_length(in + i, len - i, n - o);
+		WIDEN_ASCII(in, i, end, out, o, widen16_neon);
+	}
+	*used = i;
+	return o;
+}
+#endif
+
+size_t ucd_utf8_decode(const char *in, size_t len, codepoint_t *out, size_t n, size_t *used)
+{
+	size_t used_ = 0;
+	size_t ret;
+#if defined(HAVE_AVX2_DISPATCH)
+	if (__builtin_cpu_supports("avx2"))
+		ret = decode_avx2((const uint8_t *)in, len, out, n, &used_);
+	else
+#endif
+#if defined(__SSE2__)
+	ret = decode_sse2((const uint8_t *)in, len, out, n, &used_);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	ret = decode_neon((const uint8_t *)in, len, out, n, &used_);
+#else
+	ret = decode_scalar((const uint8_t *)in, len, out, n, &used_);
+#endif
+	if (used) *used = used_;
+	return ret;
+}
+
+/* Define a function that decodes the UTF-8 data in chunks, passing each chunk
+ * to the codepoint buffer version of the lookup function.
+ */
+#define UTF8_LOOKUP_N(name, lookup_n, type) \
+	size_t name(const char *in, size_t len, type *out) \
+	{ \
+		codepoint_t codepoints[CHUNK_SIZE]; \
+		size_t ret = 0; \
+		while (len > 0) \
+		{ \
+			size_t used; \
+			size_t n = ucd_utf8_decode(in, len, codepoints, CHUNK_SIZE, &used); \
+			lookup_n(codepoints, n, out + ret); \
+			ret += n; \
+			in  += used; \
+			len -= used; \
+		} \
+		return ret; \
+	}
+
+UTF8_LOOKUP_N(ucd_utf8_lookup_category_n, ucd_lookup_category_n, uint8_t)
+UTF8_LOOKUP_N(ucd_utf8_lookup_script_n, ucd_lookup_script_n, uint8_t)
+UTF8_LOOKUP_N(ucd_utf8_lookup_properties_n, ucd_lookup_properties_n, ucd_property)
+UTF8_LOOKUP_N(ucd_utf8_ctype_mask_n, ucd_ctype_mask_n, ucd_ctype)
+
+void ucd_utf8_count_blocks(const char *in, size_t len, size_t *counts)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	codepoint_t c, unit = UCD_INVALID_CODEPOINT;
+	ucd_block block = UCD_BLOCK_NB;
+	size_t i = 0, n;
+	while (i < len)
+	{
+		/* The ASCII characters are all in the Basic Latin block. */
+		n = utf8_ascii_length(p + i, len - i);
+		counts[UCD_BLOCK_ASCII] += n;
+		i += n;
+		if (i >= len)
+			break;
+
+		i += utf8_decode(p + i, len - i, &c);
+		if (c == UTF8_INVALID_CODEPOINT)
+			c = 0xFFFD;
+		if (c / 16 != unit)
+		{
+			unit = c / 16;
+			block = ucd_lookup_block(c);
+		}
+		++counts[block];
+	}
+}
+
+ucd_age ucd_utf8_max_age(const char *in, size_t len, ucd_age limit)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	ucd_age age, max_age = UCD_AGE_V1_1;
+	codepoint_t c;
+	size_t i = 0;
+	while (i < len)
+	{
+		/* The ASCII characters are all in Unicode 1.1. */
+		i += utf8_ascii_length(p + i, len - i);
+		if (i >= len)
+			break;
+
+		i += utf8_decode(p + i, len - i, &c);
+		age = c == UTF8_INVALID_CODEPOINT ? UCD_AGE_NA : ucd_lookup_age(c);
+		if (age > max_age)
+		{
+			max_age = age;
+			if (max_age > limit)
+				break;
+		}
+	}
+	return max_age;
+}
+
+size_t ucd_utf8_parse_uint(const char *in, size_t len, uint64_t *value)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	uint64_t result = 0;
+	codepoint_t c, zero;
+	size_t i = 0, n;
+	int overflow = 0;
+	int digit;
+
+	if (len == 0)
+	{
+		*value = 0;
+		return 0;
+	}
+
+	if ((unsigned int)(p[0] - '0') < 10)
+	{
+		/* The ASCII digits are parsed a byte at a time. */
+		for (; i < len && (unsigned int)(p[i] - '0') < 10; ++i)
+		{
+			digit = p[i] - '0';
+			if (result > (UINT64_MAX - digit) / 10)
+				overflow = 1;
+			result = result * 10 + digit;
+		}
+		*value = overflow ? UINT64_MAX : result;
+		return i;
+	}
+
+	n = utf8_decode(p, len, &c);
+	digit = ucd_digit_value(c);
+	if (c == UTF8_INVALID_CODEPOINT || digit < 0)
+	{
+		*value = 0;
+		return 0;
+	}
+
+	/* The decimal digits are in contiguous runs of 10, so the digits from the
+	 * same set as the first digit are the codepoints in zero..zero+9.
+	 */
+	zero = c - digit;
+	do
+	{
+		if (result > (UINT64_MAX - digit) / 10)
+			overflow = 1;
+		result = result * 10 + digit;
+		i += n;
+		if (i >= len)
+			break;
+		n = utf8_decode(p + i, len - i, &c);
+		digit = (int)(c - zero);
+	} while (c - zero < 10);
+
+	*value = overflow ? UINT64_MAX : result;
+	return i;
+}
+
+/* The ASCII characters in the classes used by the span functions:
+ *    identifier -- the XID_Continue characters [0-9A-Za-z_];
+ *    whitespace -- the Pattern_White_Space characters [\t\n\v\f\r ];
+ *    syntax     -- the Pattern_Syntax characters, which are the printable
+ *                  characters that are not identifier characters.
+ *
+ * The non-ASCII bytes are negative, so are not in any of the ranges checked by
+ * the signed comparisons.
+ */
+
+#if defined(__SSE2__)
+static __m128i identifier_sse2(__m128i bytes)
+{
+	__m128i lower = _mm_or_si128(bytes, _mm_set1_epi8(0x20));
+	__m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), lower));
+	__m128i digit = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), bytes));
+	return _mm_or_si128(_mm_or_si128(alpha, digit), _mm_cmpeq_epi8(bytes, _mm_set1_epi8('_')));
+}
+
+static __m128i whitespace_sse2(__m128i bytes)
+{
+	__m128i control = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x08)), _mm_cmpgt_epi8(_mm_set1_epi8(0x0E), bytes));
+	return _mm_or_si128(control, _mm_cmpeq_epi8(bytes, _mm_set1_epi8(0x20)));
+}
+
+static __m128i syntax_sse2(__m128i bytes)
+{
+	__m128i graph = _mm_and_si128(_mm_cmpgt_epi8(bytes, _mm_set1_epi8(0x20)), _mm_cmpgt_epi8(_mm_set1_epi8(0x7F), bytes));
+	return _mm_andnot_si128(identifier_sse2(bytes), graph);
+}
+
+/* Define a function that returns the number of bytes at the start of in that
+ * are in the ASCII class, checking 16 bytes at a time.
+ */
+#define ASCII_SPAN_SSE2(name, classify) \
+	static size_t name(const uint8_t *in, size_t len) \
+	{ \
+		size_t i = 0; \
+		while (i + 16 <= len) \
+		{ \
+			unsigned mask = (unsigned)_mm_movemask_epi8(classify(_mm_loadu_si128((const __m128i *)(in + i)))); \
+			if (mask != 0xFFFF) \
+				return i + __builtin_ctz(~mask); \
+			i += 16; \
+		} \
+		return i; \
+	}
+
+ASCII_SPAN_SSE2(ascii_identifier_sse2, identifier_sse2)
+ASCII_SPAN_SSE2(ascii_whitespace_sse2, whitespace_sse2)
+ASCII_SPAN_SSE2(ascii_syntax_sse2, syntax_sse2)
+#endif
+
+#if defined(HAVE_AVX2_DISPATCH)
+__attribute__((target("avx2")))
+static __m256i identifier_avx2(__m256i bytes)
+{
+	__m256i lower = _mm256_or_si256(bytes, _mm256_set1_epi8(0x20));
+	__m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+	__m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), bytes));
+	return _mm256_or_si256(_mm256_or_si256(alpha, digit), _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8('_')));
+}
+
+__attribute__((target("avx2")))
+static __m256i whitespace_avx2(__m256i bytes)
+{
+	__m256i control = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(0x08)), _mm256_cmpgt_epi8(_mm256_set1_epi8(0x0E), bytes));
+	return _mm256_or_si256(control, _mm256_cmpeq_epi8(bytes, _mm256_set1_epi8(0x20)));
+}
+
+__attribute__((target("avx2")))
+static __m256i syntax_avx2(__m256i bytes)
+{
+	__m256i graph = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, _mm256_set1_epi8(0x20)), _mm256_cmpgt_epi8(_mm256_set1_epi8(0x7F), bytes));
+	return _mm256_andnot_si256(identifier_avx2(bytes), graph);
+}
+
+/* Define a function that returns the number of bytes at the start of in that
+ * are in the ASCII class, checking 32 bytes at a time.
+ */
+#define ASCII_SPAN_AVX2(name, classify) \
+	__attribute__((target("avx2"))) \
+	static size_t name(const uint8_t *in, size_t len) \
+	{ \
+		size_t i = 0; \
+		while (i + 32 <= len) \
+		{ \
+			unsigned mask = (unsigned)_mm256_movemask_epi8(classify(_mm256_loadu_si256((const __m256i *)(in + i)))); \
+			if (mask != 0xFFFFFFFF) \
+				return i + __builtin_ctz(~mask); \
+			i += 32; \
+		} \
+		return i; \
+	}
+
+ASCII_SPAN_AVX2(ascii_identifier_avx2, identifier_avx2)
+ASCII_SPAN_AVX2(ascii_whitespace_avx2, whitespace_avx2)
+ASCII_SPAN_AVX2(ascii_syntax_avx2, syntax_avx2)
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+static uint8x16_t identifier_neon(uint8x16_t bytes)
+{
+	uint8x16_t alpha = vcleq_u8(vsubq_u8(vorrq_u8(bytes, vdupq_n_u8(0x20)), vdupq_n_u8('a')), vdupq_n_u8(25));
+	uint8x16_t digit = vcleq_u8(vsubq_u8(bytes, vdupq_n_u8('0')), vdupq_n_u8(9));
+	return vorrq_u8(vorrq_u8(alpha, digit), vceqq_u8(bytes, vdupq_n_u8('_')));
+}
+
+static uint8x16_t whitespace_neon(uint8x16_t bytes)
+{
+	uint8x16_t control = vcleq_u8(vsubq_u8(bytes, vdupq_n_u8(0x09)), vdupq_n_u8(4));
+	return vorrq_u8(control, vceqq_u8(bytes, vdupq_n_u8(0x20)));
+}
+
+static uint8x16_t syntax_neon(uint8x16_t bytes)
+{
+	uint8x16_t graph = vcleq_u8(vsubq_u8(bytes, vdupq_n_u8(0x21)), vdupq_n_u8(0x7E - 0x21));
+	return vbicq_u8(graph, identifier_neon(bytes));
+}
+
+/* Define a function that returns the number of bytes at the start of in that
+ * are in the ASCII class, checking 16 bytes at a time. This only checks whole
+ * 16 byte blocks, so may return less than the number of bytes in the class.
+ */
+#define ASCII_SPAN_NEON(name, classify) \
+	static size_t name(const uint8_t *in, size_t len) \
+	{ \
+		size_t i = 0; \
+		while (i + 16 <= len && vminvq_u8(classify(vld1q_u8(in + i))) == 0xFF) \
+			i += 16; \
+		return i; \
+	}
+
+ASCII_SPAN_NEON(ascii_identifier_neon, identifier_neon)
+ASCII_SPAN_NEON(ascii_whitespace_neon, whitespace_neon)
+ASCII_SPAN_NEON(ascii_syntax_neon, syntax_neon)
+#endif
+
+/* Define a function that returns the number of bytes at the start of in that
+ * are in the ASCII class, using the fastest SIMD version available. This may
+ * return less than the number of bytes in the class.
+ */
+#if defined(HAVE_AVX2_DISPATCH)
+#define ASCII_SPAN_AVX2_DISPATCH(name) \
+	if (__builtin_cpu_supports("avx2")) \
+		return name##_avx2(in, len);
+#else
+#define ASCII_SPAN_AVX2_DISPATCH(name)
+#endif
+
+#if defined(__SSE2__)
+#define ASCII_SPAN(name) \
+	static size_t name(const uint8_t *in, size_t len) \
+	{ \
+		ASCII_SPAN_AVX2_DISPATCH(name) \
+		return name##_sse2(in, len); \
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define ASCII_SPAN(name) \
+	static size_t name(const uint8_t *in, size_t len) \
+	{ \
+		return name##_neon(in, len); \
+	}
+#else
+#define ASCII_SPAN(name) \
+	static size_t name(const uint8_t *in, size_t len) \
+	{ \
+		(void)in; \
+		(void)len; \
+		return 0; \
+	}
+#endif
+
+ASCII_SPAN(ascii_identifier)
+ASCII_SPAN(ascii_whitespace)
+ASCII_SPAN(ascii_syntax)
+
+/* Return the number of bytes at the start of the UTF-8 data that are
+ * codepoints with the property, using ascii_span to skip the runs of ASCII
+ * characters that have the property. Ill-formed sequences do not have the
+ * property.
+ */
+static size_t span_property(const uint8_t *p, size_t len, ucd_property property,
+                            size_t (*ascii_span)(const uint8_t *in, size_t len))
+{
+	codepoint_t c;
+	size_t i = 0, n;
+	while (i < len)
+	{
+		i += ascii_span(p + i, len - i);
+		while (i < len && p[i] < 0x80)
+		{
+			if (!(ucd_lookup_properties(p[i]) & property))
+				return i;
+			++i;
+		}
+		if (i >= len)
+			break;
+
+		n = utf8_decode(p + i, len - i, &c);
+		if (c == UTF8_INVALID_CODEPOINT || !(ucd_lookup_properties(c) & property))
+			return i;
+		i += n;
+	}
+	return i;
+}
+
+size_t ucd_utf8_scan_identifier(const char *in, size_t len)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	codepoint_t c;
+	size_t n;
+
+	if (len == 0)
+		return 0;
+
+	n = utf8_decode(p, len, &c);
+	if (c == UTF8_INVALID_CODEPOINT || !(ucd_lookup_properties(c) & UCD_PROPERTY_XID_START))
+		return 0;
+	return n + span_property(p + n, len - n, UCD_PROPERTY_XID_CONTINUE, ascii_identifier);
+}
+
+size_t ucd_utf8_skip_pattern_whitespace(const char *in, size_t len)
+{
+	return span_property((const uint8_t *)in, len, UCD_PROPERTY_PATTERN_WHITE_SPACE, ascii_whitespace);
+}
+
+size_t ucd_utf8_span_pattern_syntax(const char *in, size_t len)
+{
+	return span_property((const uint8_t *)in, len, UCD_PROPERTY_PATTERN_SYNTAX, ascii_syntax);
+}
+
+/* Convert the case of the UTF-8 data. The ASCII characters in the first..last
+ * range are converted by toggling the 0x20 bit, and the other codepoints are
+ * converted to one or more codepoints using the convert function.
+ *
+ * The output is only written while whole UTF-8 sequences fit in the out
+ * buffer, but the length of the converted data is always returned.
+ */
+static size_t convert_case(const uint8_t *in, size_t len, uint8_t *out, size_t outlen,
+                           uint8_t first, uint8_t last, size_t (*convert)(codepoint_t c, codepoint_t *out))
+{
+	size_t i = 0;
+	size_t o = 0;
+	size_t end;
+#if defined(__SSE2__)
+	const __m128i before_first = _mm_set1_epi8((char)(first - 1));
+	const __m128i after_last = _mm_set1_epi8((char)(last + 1));
+	const __m128i case_bit = _mm_set1_epi8(0x20);
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	const uint8x16_t first_v = vdupq_n_u8(first);
+	const uint8x16_t last_v = vdupq_n_u8(last);
+	const uint8x16_t case_bit = vdupq_n_u8(0x20);
+#endif
+	while (i < len)
+	{
+		codepoint_t c;
+		codepoint_t mapping[UCD_MAX_FULL_CASE_MAPPING];
+		size_t n, m, j, k;
+
+		/* Convert the ASCII characters that fit in the out buffer. */
+		n = o < outlen ? outlen - o : 0;
+		end = i + utf8_ascii_length(in + i, len - i < n ? len - i : n);
+#if defined(__SSE2__)
+		for (; i + 16 <= end; i += 16, o += 16)
+		{
+			__m128i bytes = _mm_loadu_si128((const __m128i *)(in + i));
+			__m128i in_range = _mm_and_si128(_mm_cmpgt_epi8(bytes, before_first), _mm_cmpgt_epi8(after_last, bytes));
+			_mm_storeu_si128((__m128i *)(out + o), _mm_xor_si128(bytes, _mm_and_si128(in_range, case_bit)));
+		}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+		for (; i + 16 <= end; i += 16, o += 16)
+		{
+			uint8x16_t bytes = vld1q_u8(in + i);
+			uint8x16_t in_range = vandq_u8(vcgeq_u8(bytes, first_v), vcleq_u8(bytes, last_v));
+			vst1q_u8(out + o, veorq_u8(bytes, vandq_u8(in_range, case_bit)));
+		}
+#endif
+		for (; i < end; ++i, ++o)
+			out[o] = (in[i] >= first && in[i] <= last) ? (in[i] ^ 0x20) : in[i];
+		if (i == len)
+			break;
+		if (in[i] < 0x80)
+		{
+			if (o < outlen)
+				out[o] = (in[i] >= first && in[i] <= last) ? (in[i] ^ 0x20) : in[i];
+			else
+				outlen = o; /* stop writing to the out buffer */
+			++i;
+			++o;
+			continue;
+		}
+		n = utf8_decode(in + i, len - i, &c);
+		if (c == UTF8_INVALID_CODEPOINT)
+		{
+			/* Copy ill-formed sequences unchanged. */
+			if (o + n <= outlen)
+				memmove(out + o, in + i, n);
+			else
+				outlen = o;
+			i += n;
+			o += n;
+			continue;
+		}
+		k = convert(c, mapping);
+		for (j = 0, m = 0; j < k; ++j)
+			m += utf8_length(mapping[j]);
+		if (o + m <= outlen)
+		{
+			for (j = 0, m = 0; j < k; ++j)
+				m += utf8_encode(mapping[j], out + o + m);
+		}
+		else
+			outlen = o;
+		i += n;
+		o += m;
+	}
+	return o;
+}
+
+static size_t simple_tolower(codepoint_t c, codepoint_t *out)
+{
+	out[0] = ucd_tolower(c);
+	return 1;
+}
+
+static size_t simple_toupper(codepoint_t c, codepoint_t *out)
+{
+	out[0] = ucd_toupper(c);
+	return 1;
+}
+
+static size_t simple_totitle(codepoint_t c, codepoint_t *out)
+{
+	out[0] = ucd_totitle(c);
+	return 1;
+}
+
+size_t ucd_utf8_tolower(const char *in, size_t len, char *out, size_t outlen)
+{
+	return convert_case((const uint8_t *)in, len, (uint8_t *)out, outlen, 'A', 'Z', simple_tolower);
+}
+
+size_t ucd_utf8_toupper(const char *in, size_t len, char *out, size_t outlen)
+{
+	return convert_case((const uint8_t *)in, len, (uint8_t *)out, outlen, 'a', 'z', simple_toupper);
+}
+
+size_t ucd_utf8_totitle(const char *in, size_t len, char *out, size_t outlen)
+{
+	return convert_case((const uint8_t *)in, len, (uint8_t *)out, outlen, 'a', 'z', simple_totitle);
+}
+
+size_t ucd_utf8_casefold(const char *in, size_t len, char *out, size_t outlen)
+{
+	return convert_case((const uint8_t *)in, len, (uint8_t *)out, outlen, 'A', 'Z', ucd_casefold_full);
+}
+
+/* Iterate over the bytes of the full case folding of UTF-8 data, as written by
+ * ucd_utf8_casefold, without writing the folded data to a buffer.
+ */
+typedef struct
+{
+	const uint8_t *in;
+	const uint8_t *end;
+	uint8_t folded[UCD_MAX_FULL_CASE_MAPPING * 4];
+	size_t pos;
+	size_t len;
+} casefold_iterator;
+
+static void casefold_iterator_init(casefold_iterator *it, const char *in, size_t len)
+{
+	it->in = (const uint8_t *)in;
+	it->end = it->in + len;
+	it->pos = 0;
+	it->len = 0;
+}
+
+/* Fold the non-ASCII UTF-8 sequence at the current position. */
+static void casefold_iterator_fold(casefold_iterator *it)
+{
+	codepoint_t c;
+	codepoint_t mapping[UCD_MAX_FULL_CASE_MAPPING];
+	size_t n = utf8_decode(it->in, (size_t)(it->end - it->in), &c);
+	size_t m, i;
+	if (c == UTF8_INVALID_CODEPOINT)
+	{
+		memcpy(it->folded, it->in, n);
+		it->len = n;
+	}
+	else
+	{
+		m = ucd_casefold_full(c, mapping);
+		for (i = 0, it->len = 0; i < m; ++i)
+			it->len += utf8_encode(mapping[i], it->folded + it->len);
+	}
+	it->in += n;
+	it->pos = 0;
+}
+
+/* Return the next byte of the folded data, or -1 at the end of the data. */
+UTF8_INLINE int casefold_iterator_next(casefold_iterator *it)
+{
+	if (it->pos < it->len)
+		return it->folded[it->pos++];
+	if (it->in == it->end)
+		return -1;
+	if (*it->in < 0x80)
+	{
+		uint8_t b = *it->in++;
+		return (b >= 'A' && b <= 'Z') ? (b | 0x20) : b;
+	}
+	casefold_iterator_fold(it);
+	return it->folded[it->pos++];
+}
+
+int ucd_utf8_casecmp(const char *a, size_t alen, const char *b, size_t blen)
+{
+	casefold_iterator ia, ib;
+	int ca, cb;
+#if defined(__SSE2__)
+	const __m128i before_first = _mm_set1_epi8('A' - 1);
+	const __m128i after_last = _mm_set1_epi8('Z' + 1);
+	const __m128i case_bit = _mm_set1_epi8(0x20);
+	size_t scalar = 0;
+#endif
+	casefold_iterator_init(&ia, a, alen);
+	casefold_iterator_init(&ib, b, blen);
+	for (;;)
+	{
+#if defined(__SSE2__)
+		/* Compare 16 ASCII characters at a time when both iterators are
+		 * between UTF-8 sequences. If this fails, the next 16 bytes are
+		 * compared one at a time.
+		 */
+		if (scalar == 0 && ia.pos == ia.len && ib.pos == ib.len &&
+		    ia.end - ia.in >= 16 && ib.end - ib.in >= 16)
+		{
+			__m128i va = _mm_loadu_si128((const __m128i *)ia.in);
+			__m128i vb = _mm_loadu_si128((const __m128i *)ib.in);
+			if (_mm_movemask_epi8(_mm_or_si128(va, vb)) == 0) /* 16 ASCII characters */
+			{
+				va = _mm_or_si128(va, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi8(va, before_first), _mm_cmpgt_epi8(after_last, va)), case_bit));
+				vb = _mm_or_si128(vb, _mm_and_si128(_mm_and_si128(_mm_cmpgt_epi8(vb, before_first), _mm_cmpgt_epi8(after_last, vb)), case_bit));
+				if (_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) == 0xFFFF)
+				{
+					ia.in += 16;
+					ib.in += 16;
+					continue;
+				}
+			}
+			scalar = 16;
+		}
+		else if (scalar > 0)
+			--scalar;
+#endif
+		ca = casefold_iterator_next(&ia);
+		cb = casefold_iterator_next(&ib);
+		if (ca != cb)
+			return ca < cb ? -1 : 1;
+		if (ca < 0)
+			return 0;
+	}
+}
+
+uint32_t ucd_utf8_casefold_hash(const char *in, size_t len)
+{
+	casefold_iterator it;
+	uint32_t hash = 2166136261u; /* FNV-1a offset basis */
+	int c;
+	casefold_iterator_init(&it, in, len);
+	while ((c = casefold_iterator_next(&it)) >= 0)
+		hash = (hash ^ (uint32_t)c) * 16777619u; /* FNV-1a prime */
+	return hash;
+}
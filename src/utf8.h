@@ -0,0 +1,188 @@
+/* UTF-8 Helpers
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UNICODE_CHARACTER_DATA_UTF8_H
+#define UNICODE_CHARACTER_DATA_UTF8_H
+
+#include "ucd/ucd.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__)
+#define UTF8_INLINE static __inline__
+#else
+#define UTF8_INLINE static
+#endif
+
+/* The codepoint used for invalid UTF-8 sequences. This is outside the Unicode
+ * codepoint range, so it has the Ii category and no ctype classes.
+ */
+#define UTF8_INVALID_CODEPOINT 0xFFFFFFFF
+
+/* Decode the UTF-8 sequence at the start of in, storing the codepoint in c and
+ * returning the number of bytes used. The len argument must be at least 1.
+ *
+ * Ill-formed sequences (overlong forms, surrogates, codepoints above U+10FFFF,
+ * and truncated sequences) are decoded as UTF8_INVALID_CODEPOINT. These use
+ * the maximal subpart of the ill-formed sequence, as recommended by the Unicode
+ * Standard for U+FFFD substitution.
+ */
+UTF8_INLINE size_t utf8_decode(const uint8_t *in, size_t len, codepoint_t *c)
+{
+	uint8_t lo = 0x80;
+	uint8_t hi = 0xBF;
+	codepoint_t cp;
+	size_t n, i;
+	if (in[0] < 0x80)
+	{
+		*c = in[0];
+		return 1;
+	}
+	if (in[0] < 0xC2) /* continuation byte or overlong 2-byte form */
+	{
+		*c = UTF8_INVALID_CODEPOINT;
+		return 1;
+	}
+	if (in[0] < 0xE0)
+	{
+		n = 2;
+		cp = in[0] & 0x1F;
+	}
+	else if (in[0] < 0xF0)
+	{
+		n = 3;
+		cp = in[0] & 0x0F;
+		if (in[0] == 0xE0) lo = 0xA0; /* overlong */
+		if (in[0] == 0xED) hi = 0x9F; /* surrogates */
+	}
+	else if (in[0] < 0xF5)
+	{
+		n = 4;
+		cp = in[0] & 0x07;
+		if (in[0] == 0xF0) lo = 0x90; /* overlong */
+		if (in[0] == 0xF4) hi = 0x8F; /* > U+10FFFF */
+	}
+	else
+	{
+		*c = UTF8_INVALID_CODEPOINT;
+		return 1;
+	}
+	for (i = 1; i < n; ++i)
+	{
+		if (i >= len || in[i] < lo || in[i] > hi)
+		{
+			*c = UTF8_INVALID_CODEPOINT;
+			return i;
+		}
+		cp = (cp << 6) | (in[i] & 0x3F);
+		lo = 0x80;
+		hi = 0xBF;
+	}
+	*c = cp;
+	return n;
+}
+
+/* Return the number of ASCII characters at the start of in, checking up to len
+ * bytes. The bytes are checked 16 at a time using SSE2 or NEON instructions
+ * if they are available, after checking the first byte so non-ASCII text is
+ * not loaded 16 bytes at a time for each codepoint.
+ */
+UTF8_INLINE size_t utf8_ascii_length(const uint8_t *in, size_t len)
+{
+	size_t i = 0;
+#if defined(__SSE2__)
+	int mask;
+#endif
+	if (len == 0 || in[0] >= 0x80)
+		return 0;
+#if defined(__SSE2__)
+	while (i + 16 <= len)
+	{
+		mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(in + i)));
+		if (mask != 0)
+			return i + (size_t)__builtin_ctz((unsigned)mask);
+		i += 16;
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	while (i + 16 <= len && vmaxvq_u8(vld1q_u8(in + i)) < 0x80)
+		i += 16;
+#endif
+	while (i < len && in[i] < 0x80)
+		++i;
+	return i;
+}
+
+/* Return the number of bytes in a UTF-8 sequence starting with the lead byte,
+ * or 1 if it is not a valid lead byte.
+ */
+UTF8_INLINE size_t utf8_sequence_length(uint8_t lead)
+{
+	if (lead >= 0xC2 && lead < 0xE0) return 2;
+	if (lead >= 0xE0 && lead < 0xF0) return 3;
+	if (lead >= 0xF0 && lead < 0xF5) return 4;
+	return 1;
+}
+
+/* Return the number of bytes needed to encode the codepoint as UTF-8. */
+UTF8_INLINE size_t utf8_length(codepoint_t c)
+{
+	if (c < 0x80)    return 1;
+	if (c < 0x800)   return 2;
+	if (c < 0x10000) return 3;
+	return 4;
+}
+
+/* Encode the codepoint as UTF-8, returning the number of bytes written. The
+ * codepoint must be in the U+0000..U+10FFFF range.
+ */
+UTF8_INLINE size_t utf8_encode(codepoint_t c, uint8_t *out)
+{
+	if (c < 0x80)
+	{
+		out[0] = (uint8_t)c;
+		return 1;
+	}
+	if (c < 0x800)
+	{
+		out[0] = (uint8_t)(0xC0 | (c >> 6));
+		out[1] = (uint8_t)(0x80 | (c & 0x3F));
+		return 2;
+	}
+	if (c < 0x10000)
+	{
+		out[0] = (uint8_t)(0xE0 | (c >> 12));
+		out[1] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+		out[2] = (uint8_t)(0x80 | (c & 0x3F));
+		return 3;
+	}
+	out[0] = (uint8_t)(0xF0 | (c >> 18));
+	out[1] = (uint8_t)(0x80 | ((c >> 12) & 0x3F));
+	out[2] = (uint8_t)(0x80 | ((c >> 6) & 0x3F));
+	out[3] = (uint8_t)(0x80 | (c & 0x3F));
+	return 4;
+}
+
+#endif
@@ -0,0 +1,120 @@
+/* Unicode Display Width
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "config.h"
+#include "ucd/ucd.h"
+#include "utf8.h"
+
+int ucd_wcwidth(codepoint_t c)
+{
+	switch (ucd_lookup_category(c))
+	{
+	case UCD_CATEGORY_Cc:
+		return c == 0 ? 0 : -1;
+	case UCD_CATEGORY_Cs:
+	case UCD_CATEGORY_Ii:
+		return -1;
+	case UCD_CATEGORY_Cf:
+		/* The prepended concatenation marks are displayed above or below the
+		 * following digits, so have a visible glyph.
+		 */
+		if (ucd_lookup_properties(c) & UCD_PROPERTY_PREPENDED_CONCATENATION_MARK)
+			break;
+		return 0;
+	case UCD_CATEGORY_Me:
+	case UCD_CATEGORY_Mn:
+		return 0;
+	default:
+		break;
+	}
+	/* The medial vowel and final consonant jamo combine with the preceding
+	 * initial consonant jamo to form a single Hangul syllable.
+	 */
+	if ((c >= 0x1160 && c <= 0x11FF) || (c >= 0xD7B0 && c <= 0xD7FF))
+		return 0;
+	switch (ucd_lookup_east_asian_width(c))
+	{
+	case UCD_EAST_ASIAN_WIDTH_F:
+	case UCD_EAST_ASIAN_WIDTH_W:
+		return 2;
+	default:
+		return 1;
+	}
+}
+
+/* Return the number of printable ASCII characters (U+0020..U+007E) in the n
+ * ASCII characters at the start of in. The ASCII control characters do not
+ * use any columns.
+ */
+static size_t ascii_width(const uint8_t *in, size_t n)
+{
+	size_t i = 0, width = 0;
+#if defined(__SSE2__)
+	const __m128i before_space = _mm_set1_epi8(0x1F);
+	const __m128i del = _mm_set1_epi8(0x7F);
+	const __m128i one = _mm_set1_epi8(1);
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 16 <= n; i += 16)
+	{
+		__m128i bytes = _mm_loadu_si128((const __m128i *)(in + i));
+		__m128i printable = _mm_and_si128(_mm_cmpgt_epi8(bytes, before_space), _mm_cmplt_epi8(bytes, del));
+		__m128i sum = _mm_sad_epu8(_mm_and_si128(printable, one), zero);
+		width += (size_t)(_mm_extract_epi16(sum, 0) + _mm_extract_epi16(sum, 4));
+	}
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	const uint8x16_t space = vdupq_n_u8(0x20);
+	const uint8x16_t del = vdupq_n_u8(0x7F);
+	const uint8x16_t one = vdupq_n_u8(1);
+	for (; i + 16 <= n; i += 16)
+	{
+		uint8x16_t bytes = vld1q_u8(in + i);
+		uint8x16_t printable = vandq_u8(vcgeq_u8(bytes, space), vcltq_u8(bytes, del));
+		width += vaddvq_u8(vandq_u8(printable, one));
+	}
+#endif
+	for (; i < n; ++i)
+	{
+		if (in[i] >= 0x20 && in[i] < 0x7F)
+			++width;
+	}
+	return width;
+}
+
+size_t ucd_utf8_width(const char *in, size_t len)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	size_t i = 0, n, width = 0;
+	codepoint_t c;
+	int w;
+	while (i < len)
+	{
+		n = utf8_ascii_length(p + i, len - i);
+		width += ascii_width(p + i, n);
+		i += n;
+		if (i >= len)
+			break;
+		i += utf8_decode(p + i, len - i, &c);
+		if (c == UTF8_INVALID_CODEPOINT)
+			++width;
+		else if ((w = ucd_wcwidth(c)) > 0)
+			width += (size_t)w;
+	}
+	return width;
+}
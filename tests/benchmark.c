@@ -0,0 +1,481 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#define TEXT_LENGTH 65536
+#define ITERATIONS  200
+
+static const char *sample_text =
+	"The quick brown fox jumps over the lazy dog. "
+	"Pack my box with five dozen liquor jugs!\n"
+	"\t{ \"id\": 1234, \"name\": \"caf\xC3\xA9 na\xC3\xAFve\", \"tags\": [\"a\", \"b\"] }\n"
+	"\xCE\x9A\xCE\xB1\xCE\xBB\xCE\xB7\xCE\xBC\xCE\xAD\xCF\x81\xCE\xB1 "
+	"\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 "
+	"\xE4\xBD\xA0\xE5\xA5\xBD\n";
+
+static codepoint_t text[TEXT_LENGTH];
+
+static volatile unsigned long sink;
+
+static void init_text(void)
+{
+	const unsigned char *src = (const unsigned char *)sample_text;
+	size_t i;
+	for (i = 0; i < TEXT_LENGTH; ++i)
+	{
+		codepoint_t c;
+		if (*src == 0)
+			src = (const unsigned char *)sample_text;
+		if (src[0] < 0x80)
+			c = *src++;
+		else if (src[0] < 0xE0)
+		{
+			c = ((src[0] & 0x1F) << 6) | (src[1] & 0x3F);
+			src += 2;
+		}
+		else
+		{
+			c = ((src[0] & 0x0F) << 12) | ((src[1] & 0x3F) << 6) | (src[2] & 0x3F);
+			src += 3;
+		}
+		text[i] = c;
+	}
+}
+
+/* The ucd_is* implementations without the Latin-1 fast path, to compare the
+ * performance of the general path against the fast path.
+ */
+
+static int general_isalpha(codepoint_t c)
+{
+	ucd_category cat = ucd_lookup_category(c);
+	switch (cat)
+	{
+	case UCD_CATEGORY_Lu:
+	case UCD_CATEGORY_Ll:
+	case UCD_CATEGORY_Lt:
+	case UCD_CATEGORY_Lm:
+	case UCD_CATEGORY_Lo:
+	case UCD_CATEGORY_Nl:
+		return 1;
+	case UCD_CATEGORY_Mn:
+	case UCD_CATEGORY_Mc:
+	case UCD_CATEGORY_So:
+		return (ucd_properties(c, cat) & UCD_PROPERTY_OTHER_ALPHABETIC) == UCD_PROPERTY_OTHER_ALPHABETIC;
+	default:
+		return 0;
+	}
+}
+
+static int general_isspace(codepoint_t c)
+{
+	switch (ucd_lookup_category(c))
+	{
+	case UCD_CATEGORY_Zl:
+	case UCD_CATEGORY_Zp:
+		return 1;
+	case UCD_CATEGORY_Zs:
+		return c != 0x00A0 && c != 0x2007 && c != 0x202F;
+	case UCD_CATEGORY_Cc:
+		return (c >= 0x09 && c <= 0x0D) || c == 0x85;
+	default:
+		return 0;
+	}
+}
+
+static int general_ispunct(codepoint_t c)
+{
+	switch (ucd_lookup_category(c))
+	{
+	case UCD_CATEGORY_Cc:
+	case UCD_CATEGORY_Cf:
+	case UCD_CATEGORY_Cn:
+	case UCD_CATEGORY_Co:
+	case UCD_CATEGORY_Cs:
+	case UCD_CATEGORY_Zl:
+	case UCD_CATEGORY_Zp:
+	case UCD_CATEGORY_Zs:
+	case UCD_CATEGORY_Ii:
+		return 0;
+	default:
+		return !general_isalpha(c) && ucd_lookup_category_group(c) != UCD_CATEGORY_GROUP_N;
+	}
+}
+
+static int general_tolower(codepoint_t c)
+{
+	return (int)ucd_record_tolower(ucd_lookup_record(c), c);
+}
+
+typedef int (*ctype_fn)(codepoint_t c);
+
+static double time_ctype(ctype_fn fn)
+{
+	clock_t start = clock();
+	unsigned long count = 0;
+	int n;
+	size_t i;
+	for (n = 0; n < ITERATIONS; ++n)
+	{
+		for (i = 0; i < TEXT_LENGTH; ++i)
+			count += fn(text[i]);
+	}
+	sink = count;
+	return (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+}
+
+static int ucd_isalpha_(codepoint_t c) { return ucd_isalpha(c); }
+static int ucd_isspace_(codepoint_t c) { return ucd_isspace(c); }
+static int ucd_ispunct_(codepoint_t c) { return ucd_ispunct(c); }
+static int ucd_tolower_(codepoint_t c) { return (int)ucd_tolower(c); }
+
+static const struct
+{
+	const char *name;
+	ctype_fn fast;
+	ctype_fn general;
+} ctype_benchmarks[] =
+{
+	{ "isalpha", ucd_isalpha_, general_isalpha },
+	{ "isspace", ucd_isspace_, general_isspace },
+	{ "ispunct", ucd_ispunct_, general_ispunct },
+	{ "tolower", ucd_tolower_, general_tolower },
+};
+
+static void benchmark_latin1(void)
+{
+	size_t i;
+	printf("latin1: %d codepoints x %d iterations\n", TEXT_LENGTH, ITERATIONS);
+	for (i = 0; i < sizeof(ctype_benchmarks)/sizeof(ctype_benchmarks[0]); ++i)
+	{
+		double fast = time_ctype(ctype_benchmarks[i].fast);
+		double general = time_ctype(ctype_benchmarks[i].general);
+		printf("    %-10s %8.2f ms (general path %8.2f ms, %.1fx)\n",
+		       ctype_benchmarks[i].name, fast, general,
+		       fast > 0 ? general / fast : 0.0);
+	}
+}
+
+static uint8_t categories[TEXT_LENGTH];
+static codepoint_t converted[TEXT_LENGTH];
+
+static void benchmark_bulk(void)
+{
+	clock_t start;
+	double single, bulk;
+	int n;
+	size_t i;
+
+	printf("bulk: %d codepoints x %d iterations\n", TEXT_LENGTH, ITERATIONS);
+
+	start = clock();
+	for (n = 0; n < ITERATIONS; ++n)
+		for (i = 0; i < TEXT_LENGTH; ++i)
+			categories[i] = (uint8_t)ucd_lookup_category(text[i]);
+	single = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (n = 0; n < ITERATIONS; ++n)
+		ucd_lookup_category_n(text, TEXT_LENGTH, categories);
+	bulk = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+	printf("    %-10s %8.2f ms (per codepoint %8.2f ms, %.1fx)\n",
+	       "category", bulk, single, bulk > 0 ? single / bulk : 0.0);
+
+	start = clock();
+	for (n = 0; n < ITERATIONS; ++n)
+		for (i = 0; i < TEXT_LENGTH; ++i)
+			converted[i] = ucd_tolower(text[i]);
+	single = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (n = 0; n < ITERATIONS; ++n)
+		ucd_tolower_n(text, TEXT_LENGTH, converted);
+	bulk = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+	printf("    %-10s %8.2f ms (per codepoint %8.2f ms, %.1fx)\n",
+	       "tolower", bulk, single, bulk > 0 ? single / bulk : 0.0);
+}
+
+static char utf8_text[TEXT_LENGTH * 4];
+static char utf8_converted[TEXT_LENGTH * 4];
+static size_t utf8_length;
+
+static void init_utf8_text(void)
+{
+	size_t i;
+	char *out = utf8_text;
+	for (i = 0; i < TEXT_LENGTH; ++i)
+	{
+		codepoint_t c = text[i];
+		if (c < 0x80)
+			*out++ = (char)c;
+		else if (c < 0x800)
+		{
+			*out++ = (char)(0xC0 | (c >> 6));
+			*out++ = (char)(0x80 | (c & 0x3F));
+		}
+		else
+		{
+			*out++ = (char)(0xE0 | (c >> 12));
+			*out++ = (char)(0x80 | ((c >> 6) & 0x3F));
+			*out++ = (char)(0x80 | (c & 0x3F));
+		}
+	}
+	utf8_length = (size_t)(out - utf8_text);
+}
+
+static void benchmark_utf8(void)
+{
+	clock_t start;
+	double single, kernel;
+	int n;
+
+	init_utf8_text();
+	printf("utf8: %u bytes x %d iterations\n", (unsigned)utf8_length, ITERATIONS);
+
+	start = clock();
+	for (n = 0; n < ITERATIONS; ++n)
+	{
+		const unsigned char *in = (const unsigned char *)utf8_text;
+		const unsigned char *end = in + utf8_length;
+		size_t o = 0;
+		while (in < end)
+		{
+			codepoint_t c;
+			if (in[0] < 0x80)
+				c = *in++;
+			else if (in[0] < 0xE0)
+			{
+				c = ((in[0] & 0x1F) << 6) | (in[1] & 0x3F);
+				in += 2;
+			}
+			else
+			{
+				c = ((in[0] & 0x0F) << 12) | ((in[1] & 0x3F) << 6) | (in[2] & 0x3F);
+				in += 3;
+			}
+			categories[o++] = (uint8_t)ucd_lookup_category(c);
+		}
+	}
+	single = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (n = 0; n < ITERATIONS; ++n)
+		ucd_utf8_lookup_category_n(utf8_text, utf8_length, categories);
+	kernel = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+	printf("    %-10s %8.2f ms, %7.1f MB/s (decode and lookup %8.2f ms, %.1fx)\n",
+	       "category", kernel,
+	       kernel > 0 ? (double)utf8_length * ITERATIONS / (kernel * 1000.0) : 0.0,
+	       single, kernel > 0 ? single / kernel : 0.0);
+
+	start = clock();
+	for (n = 0; n < ITERATIONS; ++n)
+	{
+		const unsigned char *in = (const unsigned char *)utf8_text;
+		const unsigned char *end = in + utf8_length;
+		char *out = utf8_converted;
+		while (in < end)
+		{
+			codepoint_t c;
+			if (in[0] < 0x80)
+				c = *in++;
+			else if (in[0] < 0xE0)
+			{
+				c = ((in[0] & 0x1F) << 6) | (in[1] & 0x3F);
+				in += 2;
+			}
+			else
+			{
+				c = ((in[0] & 0x0F) << 12) | ((in[1] & 0x3F) << 6) | (in[2] & 0x3F);
+				in += 3;
+			}
+			c = ucd_tolower(c);
+			if (c < 0x80)
+				*out++ = (char)c;
+			else if (c < 0x800)
+			{
+				*out++ = (char)(0xC0 | (c >> 6));
+				*out++ = (char)(0x80 | (c & 0x3F));
+			}
+			else
+			{
+				*out++ = (char)(0xE0 | (c >> 12));
+				*out++ = (char)(0x80 | ((c >> 6) & 0x3F));
+				*out++ = (char)(0x80 | (c & 0x3F));
+			}
+		}
+	}
+	single = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+	start = clock();
+	for (n = 0; n < ITERATIONS; ++n)
+		ucd_utf8_tolower(utf8_text, utf8_length, utf8_converted, sizeof(utf8_converted));
+	kernel = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+	printf("    %-10s %8.2f ms, %7.1f MB/s (decode, convert and encode %8.2f ms, %.1fx)\n",
+	       "tolower", kernel,
+	       kernel > 0 ? (double)utf8_length * ITERATIONS / (kernel * 1000.0) : 0.0,
+	       single, kernel > 0 ? single / kernel : 0.0);
+}
+
+static const struct
+{
+	const char *name;
+	const char *text;
+} decode_benchmarks[] =
+{
+	{ "latin",    "Caf\xC3\xA9 na\xC3\xAFve, cr\xC3\xA8me br\xC3\xBBl\xC3\xA9""e et r\xC3\xA9sum\xC3\xA9. " },
+	{ "greek",    "\xCE\x9A\xCE\xB1\xCE\xBB\xCE\xB7\xCE\xBC\xCE\xAD\xCF\x81\xCE\xB1 \xCE\xBA\xCF\x8C\xCF\x83\xCE\xBC\xCE\xB5. " },
+	{ "cyrillic", "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, \xD0\xBC\xD0\xB8\xD1\x80! " },
+	{ "cjk",      "\xE4\xBD\xA0\xE5\xA5\xBD\xEF\xBC\x8C\xE4\xB8\x96\xE7\x95\x8C\xE3\x80\x82\xE6\x97\xA5\xE6\x9C\xAC\xE8\xAA\x9E" },
+	{ "emoji",    "\xF0\x9F\x98\x80 \xF0\x9F\x91\x8D\xF0\x9F\x8E\x89 " },
+};
+
+static void benchmark_decode(void)
+{
+	clock_t start;
+	double elapsed;
+	size_t i, len, count = 0, text_len;
+	int n;
+
+	printf("decode: %u bytes x %d iterations\n", TEXT_LENGTH, ITERATIONS);
+	for (i = 0; i < sizeof(decode_benchmarks)/sizeof(decode_benchmarks[0]); ++i)
+	{
+		text_len = strlen(decode_benchmarks[i].text);
+		for (len = 0; len + text_len <= TEXT_LENGTH; len += text_len)
+			memcpy(utf8_converted + len, decode_benchmarks[i].text, text_len);
+
+		start = clock();
+		for (n = 0; n < ITERATIONS; ++n)
+			count = ucd_utf8_decode(utf8_converted, len, converted, TEXT_LENGTH, NULL);
+		elapsed = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+		sink = count;
+
+		printf("    %-10s %8.2f ms, %7.1f MB/s (%u codepoints)\n",
+		       decode_benchmarks[i].name, elapsed,
+		       elapsed > 0 ? (double)len * ITERATIONS / (elapsed * 1000.0) : 0.0,
+		       (unsigned)count);
+	}
+}
+
+typedef size_t (*utf8_next_fn)(const char *in, size_t len);
+
+static const struct
+{
+	const char *name;
+	utf8_next_fn next;
+} segmentation_benchmarks[] =
+{
+	{ "grapheme", ucd_utf8_next_grapheme },
+	{ "word",     ucd_utf8_next_word },
+	{ "sentence", ucd_utf8_next_sentence },
+};
+
+#define LINE_BREAK_CHUNK 4096
+
+static void benchmark_segmentation(void)
+{
+	static uint8_t breaks[LINE_BREAK_CHUNK];
+	ucd_line_break_state state;
+	clock_t start;
+	double elapsed;
+	unsigned long count;
+	size_t i, pos, len;
+	int n;
+
+	init_utf8_text();
+	printf("segmentation: %u bytes x %d iterations\n", (unsigned)utf8_length, ITERATIONS);
+	for (i = 0; i < sizeof(segmentation_benchmarks)/sizeof(segmentation_benchmarks[0]); ++i)
+	{
+		count = 0;
+		start = clock();
+		for (n = 0; n < ITERATIONS; ++n)
+		{
+			for (pos = 0; pos < utf8_length; ++count)
+				pos += segmentation_benchmarks[i].next(utf8_text + pos, utf8_length - pos);
+		}
+		elapsed = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+		sink = count;
+
+		printf("    %-10s %8.2f ms, %7.1f MB/s (%lu segments)\n",
+		       segmentation_benchmarks[i].name, elapsed,
+		       elapsed > 0 ? (double)utf8_length * ITERATIONS / (elapsed * 1000.0) : 0.0,
+		       count / ITERATIONS);
+	}
+
+	count = 0;
+	start = clock();
+	for (n = 0; n < ITERATIONS; ++n)
+	{
+		ucd_line_break_init(&state);
+		for (pos = 0; pos < utf8_length; pos += len)
+		{
+			len = utf8_length - pos > LINE_BREAK_CHUNK ? LINE_BREAK_CHUNK : utf8_length - pos;
+			len = ucd_utf8_line_breaks(&state, utf8_text + pos, len, pos + len == utf8_length, breaks);
+			for (i = 0; i < len; ++i)
+				count += breaks[i] != UCD_BREAK_PROHIBITED;
+		}
+	}
+	elapsed = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+	sink = count;
+
+	printf("    %-10s %8.2f ms, %7.1f MB/s (%lu break opportunities, %d byte chunks)\n",
+	       "line", elapsed,
+	       elapsed > 0 ? (double)utf8_length * ITERATIONS / (elapsed * 1000.0) : 0.0,
+	       count / ITERATIONS, LINE_BREAK_CHUNK);
+}
+
+static const struct
+{
+	const char *name;
+	void (*run)(void);
+} benchmarks[] =
+{
+	{ "latin1", benchmark_latin1 },
+	{ "bulk",   benchmark_bulk },
+	{ "utf8",   benchmark_utf8 },
+	{ "decode", benchmark_decode },
+	{ "segmentation", benchmark_segmentation },
+};
+
+int main(int argc, char **argv)
+{
+	size_t i;
+	init_text();
+	for (i = 0; i < sizeof(benchmarks)/sizeof(benchmarks[0]); ++i)
+	{
+		int run = argc <= 1;
+		int arg;
+		for (arg = 1; arg < argc; ++arg)
+		{
+			if (!strcmp(argv[arg], benchmarks[i].name))
+				run = 1;
+		}
+		if (run)
+			benchmarks[i].run();
+	}
+	return 0;
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+
+static const char *ages[] =
+{
+	"1.1", "2.0", "2.1", "3.0", "3.1", "3.2", "4.0", "4.1", "5.0", "5.1",
+	"5.2", "6.0", "6.1", "6.2", "6.3", "7.0", "8.0", "9.0", "10.0", "11.0",
+	"12.0", "NA",
+};
+
+static const char *age(codepoint_t c)
+{
+	return ages[ucd_lookup_age(c)];
+}
+
+/* Check that the bulk lookup gives the same result as looking up the age of
+ * each codepoint, and that the max age is the latest of those ages.
+ */
+static void check_age_n(const codepoint_t *codepoints, size_t n)
+{
+	uint8_t values[BULK_SIZE];
+	ucd_age age, expected = UCD_AGE_V1_1;
+	size_t i;
+	ucd_lookup_age_n(codepoints, n, values);
+	for (i = 0; i < n; ++i)
+	{
+		age = ucd_lookup_age(codepoints[i]);
+		if (values[i] != age)
+			printf("%04X: ucd_lookup_age_n is %s, expected %s\n", codepoints[i], ages[values[i]], ages[age]);
+		if (age > expected)
+			expected = age;
+	}
+	age = ucd_max_age_n(codepoints, n, UCD_AGE_NA);
+	if (age != expected)
+		printf("%04X: ucd_max_age_n is %s, expected %s\n", codepoints[0], ages[age], ages[expected]);
+}
+
+/* Check that the max age scan stops at the first codepoint that is newer than
+ * the limit, for both codepoint and UTF-8 data.
+ */
+static void check_max_age(void)
+{
+	/* U+0041 (1.1), U+20AC (2.1), U+1F600 (6.1), U+1F97A (11.0), U+0378 (NA) */
+	static const codepoint_t text[] = { 0x41, 0x20AC, 0x1F600, 0x1F97A, 0x0378 };
+	char utf8[64];
+	size_t i, n = sizeof(text) / sizeof(text[0]), len = 0;
+	ucd_age age;
+
+	for (i = 0; i < 20; ++i)
+		utf8[len++] = 'a';
+	for (i = 0; i < n; ++i)
+		len += put_utf8c(utf8 + len, text[i]);
+
+	age = ucd_max_age_n(text, n, UCD_AGE_V6_1);
+	if (age != UCD_AGE_V11_0)
+		printf("ucd_max_age_n(6.1) is %s, expected 11.0\n", ages[age]);
+	age = ucd_utf8_max_age(utf8, len, UCD_AGE_V6_1);
+	if (age != UCD_AGE_V11_0)
+		printf("ucd_utf8_max_age(6.1) is %s, expected 11.0\n", ages[age]);
+
+	age = ucd_max_age_n(text, 3, UCD_AGE_V12_0);
+	if (age != UCD_AGE_V6_1)
+		printf("ucd_max_age_n(12.0) is %s, expected 6.1\n", ages[age]);
+	age = ucd_utf8_max_age(utf8, len - 6, UCD_AGE_V12_0);
+	if (age != UCD_AGE_V6_1)
+		printf("ucd_utf8_max_age(12.0) is %s, expected 6.1\n", ages[age]);
+
+	age = ucd_max_age_n(text, n, UCD_AGE_NA);
+	if (age != UCD_AGE_NA)
+		printf("ucd_max_age_n(NA) is %s, expected NA\n", ages[age]);
+	age = ucd_utf8_max_age(utf8, len, UCD_AGE_NA);
+	if (age != UCD_AGE_NA)
+		printf("ucd_utf8_max_age(NA) is %s, expected NA\n", ages[age]);
+
+	age = ucd_utf8_max_age(utf8, 20, UCD_AGE_V1_1);
+	if (age != UCD_AGE_V1_1)
+		printf("ucd_utf8_max_age(ASCII) is %s, expected 1.1\n", ages[age]);
+	age = ucd_max_age_n(text, 0, UCD_AGE_V1_1);
+	if (age != UCD_AGE_V1_1)
+		printf("ucd_max_age_n(empty) is %s, expected 1.1\n", ages[age]);
+
+	/* Ill-formed sequences are unassigned. */
+	age = ucd_utf8_max_age("a\xC0\x80z", 4, UCD_AGE_V12_0);
+	if (age != UCD_AGE_NA)
+		printf("ucd_utf8_max_age: ill-formed sequences are not NA\n");
+}
+
+/* Print the age of all the codepoints in the same format as the DerivedAge.txt
+ * file, with the adjacent ranges that have the same age merged and NA for the
+ * unassigned codepoints, and check the bulk lookup and max age functions.
+ */
+int main(void)
+{
+	print_ranges(age);
+	if (ucd_lookup_age(0x110000) != UCD_AGE_NA)
+		printf("110000: invalid codepoint is assigned\n");
+
+	check_bulk(check_age_n);
+	check_max_age();
+	return 0;
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_CODEPOINTS 4096
+
+/* Is the codepoint removed by rule X9 of the bidirectional algorithm? */
+static int is_removed(codepoint_t c)
+{
+	switch (ucd_lookup_bidi_class(c))
+	{
+	case UCD_BIDI_CLASS_RLE:
+	case UCD_BIDI_CLASS_LRE:
+	case UCD_BIDI_CLASS_RLO:
+	case UCD_BIDI_CLASS_LRO:
+	case UCD_BIDI_CLASS_PDF:
+	case UCD_BIDI_CLASS_BN:
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+/* Print the codepoints, paragraph direction, paragraph level and resolved
+ * levels of each test in a BidiCharacterTest.txt file, in the same format
+ * as that file.
+ */
+int main(int argc, char **argv)
+{
+	static codepoint_t codepoints[MAX_CODEPOINTS];
+	static uint8_t levels[MAX_CODEPOINTS];
+	char line[32768];
+	char *p, *end;
+	size_t i, n;
+	int direction, level;
+	FILE *in;
+
+	if (argc != 2)
+	{
+		fprintf(stdout, "usage: printbidi BidiCharacterTest.txt\n");
+		return 1;
+	}
+
+	in = fopen(argv[1], "r");
+	if (!in)
+		return 1;
+
+	while (fgets(line, sizeof(line), in))
+	{
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+
+		n = 0;
+		for (p = line; *p != ';' && *p != '\0'; p = end)
+		{
+			codepoint_t c = (codepoint_t)strtoul(p, &end, 16);
+			if (end == p)
+				end = p + 1;
+			else if (n < MAX_CODEPOINTS)
+				codepoints[n++] = c;
+		}
+		if (*p != ';')
+			continue;
+		direction = atoi(p + 1);
+
+		level = ucd_utf32_bidi_levels(codepoints, n, (ucd_bidi_direction)direction, levels);
+
+		for (i = 0; i < n; ++i)
+			printf(i == 0 ? "%04X" : " %04X", codepoints[i]);
+		printf(";%d;%d;", direction, level);
+		for (i = 0; i < n; ++i)
+		{
+			if (i != 0)
+				printf(" ");
+			if (is_removed(codepoints[i]))
+				printf("x");
+			else
+				printf("%d", levels[i]);
+		}
+		printf("\n");
+	}
+
+	fclose(in);
+	return 0;
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+
+static const char ascii[] = "\tThe quick brown fox\r\njumps over the lazy dog. ";
+
+static codepoint_t codepoints[BULK_SIZE];
+static size_t counts[UCD_BLOCK_COUNT];
+static size_t expected_counts[UCD_BLOCK_COUNT];
+
+static const char *block(codepoint_t c)
+{
+	return ucd_get_block_string(ucd_lookup_block(c));
+}
+
+/* Check that the bulk lookup gives the same result as looking up the block of
+ * each codepoint, and count the blocks of the codepoints.
+ */
+static void check_block_n(const codepoint_t *codepoints, size_t n)
+{
+	uint16_t blocks[BULK_SIZE];
+	size_t i;
+	ucd_lookup_block_n(codepoints, n, blocks);
+	ucd_count_blocks(codepoints, n, counts);
+	for (i = 0; i < n; ++i)
+	{
+		ucd_block block = ucd_lookup_block(codepoints[i]);
+		if (blocks[i] != block)
+			printf("%04X: ucd_lookup_block_n is %d, expected %d\n", codepoints[i], blocks[i], block);
+		++expected_counts[block];
+	}
+}
+
+/* Check that the block counts give the same result as counting the block of
+ * each codepoint.
+ */
+static void check_count_blocks(void)
+{
+	size_t i;
+	memset(counts, 0, sizeof(counts));
+	memset(expected_counts, 0, sizeof(expected_counts));
+	check_bulk(check_block_n);
+	for (i = 0; i < UCD_BLOCK_COUNT; ++i)
+	{
+		if (counts[i] != expected_counts[i])
+			printf("%s: ucd_count_blocks is %u, expected %u\n", ucd_get_block_string((ucd_block)i),
+			       (unsigned)counts[i], (unsigned)expected_counts[i]);
+	}
+}
+
+/* Check that counting the blocks in UTF-8 text gives the same result as
+ * counting the blocks of the codepoints in the text.
+ */
+static void check_utf8(void)
+{
+	char utf8[BULK_SIZE * 4];
+	codepoint_t c;
+	size_t i, n = 0, len = 0;
+	for (c = 0; c < MAX_CODEPOINTS && n + sizeof(ascii) < BULK_SIZE; c += 0x80)
+	{
+		if (c >= 0xD800 && c <= 0xDFFF)
+			continue;
+		for (i = 0; ascii[i] != '\0' && (c % 0x800) == 0; ++i)
+			codepoints[n++] = (codepoint_t)ascii[i];
+		codepoints[n++] = c + 0x7F;
+	}
+	for (i = 0; i < n; ++i)
+		len += put_utf8c(utf8 + len, codepoints[i]);
+
+	memset(counts, 0, sizeof(counts));
+	memset(expected_counts, 0, sizeof(expected_counts));
+	ucd_count_blocks(codepoints, n, expected_counts);
+	ucd_utf8_count_blocks(utf8, len, counts);
+	for (i = 0; i < UCD_BLOCK_COUNT; ++i)
+	{
+		if (counts[i] != expected_counts[i])
+			printf("%s: ucd_utf8_count_blocks is %u, expected %u\n", ucd_get_block_string((ucd_block)i),
+			       (unsigned)counts[i], (unsigned)expected_counts[i]);
+	}
+
+	/* Ill-formed sequences are counted as U+FFFD. */
+	memset(counts, 0, sizeof(counts));
+	ucd_utf8_count_blocks("a\xC0\x80\xE2\x82z", 6, counts);
+	if (counts[UCD_BLOCK_ASCII] != 2 || counts[ucd_lookup_block(0xFFFD)] != 3)
+		printf("ucd_utf8_count_blocks: ill-formed sequences are not counted as U+FFFD\n");
+}
+
+/* Check that the blocks are in codepoint order, with each block being a single
+ * range of codepoints.
+ */
+static void check_block_order(void)
+{
+	ucd_block block, current = UCD_BLOCK_NB, previous = UCD_BLOCK_NB;
+	codepoint_t c;
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		block = ucd_lookup_block(c);
+		if (block != UCD_BLOCK_NB && block != current)
+		{
+			if (block != previous + 1)
+				printf("%04X: block %s does not follow %s\n", c, ucd_get_block_string(block), ucd_get_block_string(previous));
+			previous = block;
+		}
+		current = block;
+	}
+	if (previous + 1 != UCD_BLOCK_COUNT)
+		printf("UCD_BLOCK_COUNT is %d, expected %d\n", UCD_BLOCK_COUNT, previous + 1);
+}
+
+/* Print the blocks of all the codepoints in the same format as the Blocks.txt
+ * file, using the short block names and NB for the codepoints that are not in
+ * a block, and check the block order, the bulk lookup and the block counts.
+ */
+int main(void)
+{
+	print_ranges(block);
+	if (ucd_lookup_block(0x110000) != UCD_BLOCK_NB)
+		printf("110000: invalid codepoint is in a block\n");
+
+	if (strcmp(ucd_get_block_string(UCD_BLOCK_ASCII), "ASCII") != 0)
+		printf("ucd_get_block_string(UCD_BLOCK_ASCII) is \"%s\"\n", ucd_get_block_string(UCD_BLOCK_ASCII));
+	if (strcmp(ucd_get_block_string((ucd_block)UCD_BLOCK_COUNT), "--") != 0)
+		printf("ucd_get_block_string(UCD_BLOCK_COUNT) is \"%s\"\n", ucd_get_block_string((ucd_block)UCD_BLOCK_COUNT));
+
+	check_block_order();
+	check_count_blocks();
+	check_utf8();
+	return 0;
+}
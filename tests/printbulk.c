@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stdio.h>
+
+#define BLOCK_SIZE 4096
+
+static codepoint_t codepoints[BLOCK_SIZE];
+static uint8_t scripts[BLOCK_SIZE];
+static uint8_t categories[BLOCK_SIZE];
+static codepoint_t upper[BLOCK_SIZE];
+static codepoint_t lower[BLOCK_SIZE];
+static codepoint_t title[BLOCK_SIZE];
+static ucd_property properties[BLOCK_SIZE];
+
+/* Print the bulk API data in the same format as:
+ *     printucddata --format="%pH %s %C %c %UH %LH %TH %P\n"
+ */
+int main(void)
+{
+	codepoint_t first;
+	for (first = 0; first <= 0x10FFFF; first += BLOCK_SIZE)
+	{
+		size_t i;
+		for (i = 0; i < BLOCK_SIZE; ++i)
+			codepoints[i] = title[i] = first + i;
+
+		ucd_lookup_script_n(codepoints, BLOCK_SIZE, scripts);
+		ucd_lookup_category_n(codepoints, BLOCK_SIZE, categories);
+		ucd_toupper_n(codepoints, BLOCK_SIZE, upper);
+		ucd_tolower_n(codepoints, BLOCK_SIZE, lower);
+		ucd_lookup_properties_n(codepoints, BLOCK_SIZE, properties);
+
+		ucd_totitle_n(title, BLOCK_SIZE, title); /* in and out are the same buffer */
+
+		for (i = 0; i < BLOCK_SIZE; ++i)
+		{
+			ucd_category category = (ucd_category)categories[i];
+			printf("%06X %s %s %s %06X %06X %06X %016llx\n", codepoints[i],
+			       ucd_get_script_string((ucd_script)scripts[i]),
+			       ucd_get_category_group_string(ucd_get_category_group_for_category(category)),
+			       ucd_get_category_string(category),
+			       upper[i],
+			       lower[i],
+			       title[i],
+			       (unsigned long long)properties[i]);
+		}
+	}
+	return 0;
+}
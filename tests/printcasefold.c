@@ -0,0 +1,163 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t fnv1a(const char *in, size_t len)
+{
+	uint32_t hash = 2166136261u;
+	size_t i;
+	for (i = 0; i < len; ++i)
+		hash = (hash ^ (uint8_t)in[i]) * 16777619u;
+	return hash;
+}
+
+static int sign(int value)
+{
+	return value < 0 ? -1 : (value > 0 ? 1 : 0);
+}
+
+/* Check the comparison and hash of two strings against their folded data. */
+static void check_casecmp(const char *a, size_t alen, const char *b, size_t blen)
+{
+	char fa[1024];
+	char fb[1024];
+	size_t falen = ucd_utf8_casefold(a, alen, fa, sizeof(fa));
+	size_t fblen = ucd_utf8_casefold(b, blen, fb, sizeof(fb));
+	int expected = memcmp(fa, fb, falen < fblen ? falen : fblen);
+	if (expected == 0)
+		expected = falen < fblen ? -1 : (falen > fblen ? 1 : 0);
+	if (sign(ucd_utf8_casecmp(a, alen, b, blen)) != sign(expected))
+		printf("casecmp: \"%.*s\" and \"%.*s\" compare as %d, expected %d\n",
+		       (int)alen, a, (int)blen, b, ucd_utf8_casecmp(a, alen, b, blen), sign(expected));
+	if (ucd_utf8_casefold_hash(a, alen) != fnv1a(fa, falen))
+		printf("casefold_hash: hash of \"%.*s\" is incorrect\n", (int)alen, a);
+}
+
+static void check_casecmp_str(const char *a, const char *b, int expected)
+{
+	int ret = sign(ucd_utf8_casecmp(a, strlen(a), b, strlen(b)));
+	if (ret != expected)
+		printf("casecmp: \"%s\" and \"%s\" compare as %d, expected %d\n", a, b, ret, expected);
+	if (expected == 0 && ucd_utf8_casefold_hash(a, strlen(a)) != ucd_utf8_casefold_hash(b, strlen(b)))
+		printf("casefold_hash: \"%s\" and \"%s\" have different hashes\n", a, b);
+	check_casecmp(a, strlen(a), b, strlen(b));
+}
+
+/* Check ASCII strings that differ at each position, so the SIMD and scalar
+ * code paths are used at each alignment.
+ */
+static void check_ascii_runs(void)
+{
+	static const char upper[] = "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, 0123456789 THE QUICK BROWN FOX";
+	static const char lower[] = "the quick brown fox jumps over the lazy dog, 0123456789 the quick brown fox";
+	char changed[sizeof(lower)];
+	size_t len = sizeof(lower) - 1;
+	size_t i;
+	for (i = 0; i <= len; ++i)
+	{
+		check_casecmp(upper, i, lower, i);
+		check_casecmp(upper, i, lower, len);
+		memcpy(changed, lower, sizeof(lower));
+		if (i < len)
+		{
+			changed[i] = '~';
+			check_casecmp(upper, len, changed, len);
+			changed[i] = '\xC3';
+			check_casecmp(upper, len, changed, len);
+		}
+	}
+}
+
+int main(void)
+{
+	codepoint_t mapping[UCD_MAX_FULL_CASE_MAPPING];
+	codepoint_t c;
+	char *utf8 = malloc(0x110000 * 4);
+	char *folded = malloc(0x110000 * 4 * UCD_MAX_FULL_CASE_MAPPING);
+	char *expected = malloc(0x110000 * 4 * UCD_MAX_FULL_CASE_MAPPING);
+	size_t len = 0;
+	size_t expected_len = 0;
+	size_t folded_len, i, n;
+	if (!utf8 || !folded || !expected)
+		return 1;
+
+	check_casecmp_str("Stra\xC3\x9F" "e", "STRASSE", 0);
+	check_casecmp_str("\xCE\xA3\xCE\xAF\xCF\x83\xCF\x85\xCF\x86\xCE\xBF\xCF\x82", "\xCE\xA3\xCE\x8A\xCE\xA3\xCE\xA5\xCE\xA6\xCE\x9F\xCE\xA3", 0);
+	check_casecmp_str("\xEF\xAC\x81le", "FILE", 0);
+	check_casecmp_str("abc", "ABD", -1);
+	check_casecmp_str("abd", "ABC", 1);
+	check_casecmp_str("ab", "ABC", -1);
+	check_casecmp_str("", "", 0);
+	check_casecmp_str("\x80", "\x81", -1);
+	check_ascii_runs();
+
+	for (c = 0; c <= 0x10FFFF; ++c)
+	{
+		char cu[4];
+		size_t culen;
+		size_t start = expected_len;
+		if (c >= 0xD800 && c <= 0xDFFF)
+			continue;
+		culen = put_utf8c(cu, c);
+		memcpy(utf8 + len, cu, culen);
+		len += culen;
+		n = ucd_casefold_full(c, mapping);
+		for (i = 0; i < n; ++i)
+			expected_len += put_utf8c(expected + expected_len, mapping[i]);
+		check_casecmp(cu, culen, expected + start, expected_len - start);
+	}
+
+	folded_len = ucd_utf8_casefold(utf8, len, folded, 0x110000 * 4 * UCD_MAX_FULL_CASE_MAPPING);
+	if (folded_len != expected_len || memcmp(folded, expected, folded_len) != 0)
+		printf("casefold: the folded UTF-8 data is incorrect\n");
+	if (ucd_utf8_casecmp(utf8, len, expected, expected_len) != 0)
+		printf("casecmp: the UTF-8 data does not match the folded data\n");
+	if (ucd_utf8_casefold_hash(utf8, len) != fnv1a(expected, expected_len))
+		printf("casefold_hash: the hash of the UTF-8 data is incorrect\n");
+
+	/* Print the case foldings in the same format as CaseFolding.txt. */
+	for (c = 0; c <= 0x10FFFF; ++c)
+	{
+		codepoint_t simple = ucd_casefold(c);
+		n = ucd_casefold_full(c, mapping);
+		if (n == 1 && mapping[0] == simple)
+		{
+			if (simple != c)
+				printf("%04X; C; %04X;\n", c, simple);
+			continue;
+		}
+		printf("%04X; F;", c);
+		for (i = 0; i < n; ++i)
+			printf(" %04X", mapping[i]);
+		printf(";\n");
+		if (simple != c)
+			printf("%04X; S; %04X;\n", c, simple);
+	}
+
+	free(utf8);
+	free(folded);
+	free(expected);
+	return 0;
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stdio.h>
+
+#define BLOCK_SIZE 4096
+
+static codepoint_t codepoints[BLOCK_SIZE];
+static uint8_t combining_classes[BLOCK_SIZE];
+
+/* Print the codepoints that have a non-zero Canonical_Combining_Class in the
+ * same format as the codepoint and ccc fields of UnicodeData.txt, checking
+ * that the bulk API gives the same result.
+ */
+int main(void)
+{
+	codepoint_t first;
+	for (first = 0; first <= 0x10FFFF; first += BLOCK_SIZE)
+	{
+		size_t i;
+		for (i = 0; i < BLOCK_SIZE; ++i)
+			codepoints[i] = first + i;
+
+		ucd_lookup_ccc_n(codepoints, BLOCK_SIZE, combining_classes);
+
+		for (i = 0; i < BLOCK_SIZE; ++i)
+		{
+			uint8_t ccc = ucd_lookup_ccc(codepoints[i]);
+			if (ccc != combining_classes[i])
+				printf("%04X: ucd_lookup_ccc_n is %d, expected %d\n", codepoints[i], combining_classes[i], ccc);
+			if (ccc != 0)
+				printf("%04X;%d\n", codepoints[i], ccc);
+		}
+	}
+	if (ucd_lookup_ccc(0x110000) != 0)
+		printf("110000: ucd_lookup_ccc is not 0\n");
+	return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_CODEPOINTS 0x110000
+
+typedef size_t (*full_fn)(codepoint_t c, codepoint_t *out);
+typedef size_t (*full_n_fn)(const codepoint_t *in, size_t n, codepoint_t *out, size_t outlen);
+
+static codepoint_t *all;
+static codepoint_t *converted;
+
+static void print_mapping(const codepoint_t *mapping, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		printf(" %04X", mapping[i]);
+	printf(";");
+}
+
+/* Check the buffer API against the single codepoint API. */
+static void check_full_n(const char *name, full_fn full, full_n_fn full_n)
+{
+	codepoint_t mapping[UCD_MAX_FULL_CASE_MAPPING];
+	size_t n, i, j, m, o, partial;
+
+	n = full_n(all, MAX_CODEPOINTS, converted, MAX_CODEPOINTS * UCD_MAX_FULL_CASE_MAPPING);
+	for (i = 0, o = 0; i < MAX_CODEPOINTS; ++i)
+	{
+		m = full(all[i], mapping);
+		for (j = 0; j < m; ++j)
+		{
+			if (o + j >= n || converted[o + j] != mapping[j])
+			{
+				printf("%s: %06X converted to %06X\n", name, all[i], converted[o + j]);
+				return;
+			}
+		}
+		o += m;
+	}
+	if (o != n)
+		printf("%s: converted length is %u, expected %u\n", name, (unsigned)n, (unsigned)o);
+
+	/* A short out buffer only contains the full mappings that fit. U+00DF
+	 * has a 2 codepoint upper-case and title-case mapping.
+	 */
+	converted[1] = converted[2] = 0;
+	partial = full_n(all + 0xDE, 2, converted, 2);
+	m = full(0xDF, mapping);
+	if (partial != 1 + m || converted[1] != (m == 1 ? mapping[0] : 0) || converted[2] != 0)
+		printf("%s: partial conversion is incorrect\n", name);
+}
+
+/* Print the codepoints whose full case mappings differ from the simple case
+ * mappings, in the same format as the unconditional SpecialCasing.txt entries.
+ */
+int main(void)
+{
+	codepoint_t lower[UCD_MAX_FULL_CASE_MAPPING];
+	codepoint_t title[UCD_MAX_FULL_CASE_MAPPING];
+	codepoint_t upper[UCD_MAX_FULL_CASE_MAPPING];
+	codepoint_t c;
+
+	all = malloc(MAX_CODEPOINTS * sizeof(codepoint_t));
+	converted = malloc(MAX_CODEPOINTS * UCD_MAX_FULL_CASE_MAPPING * sizeof(codepoint_t));
+	if (!all || !converted)
+		return 1;
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+		all[c] = c;
+
+	check_full_n("lower", ucd_tolower_full, ucd_tolower_full_n);
+	check_full_n("title", ucd_totitle_full, ucd_totitle_full_n);
+	check_full_n("upper", ucd_toupper_full, ucd_toupper_full_n);
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		size_t nlower = ucd_tolower_full(c, lower);
+		size_t ntitle = ucd_totitle_full(c, title);
+		size_t nupper = ucd_toupper_full(c, upper);
+		if (nlower == 1 && lower[0] == ucd_tolower(c) &&
+		    ntitle == 1 && title[0] == ucd_totitle(c) &&
+		    nupper == 1 && upper[0] == ucd_toupper(c))
+			continue;
+		printf("%04X;", c);
+		print_mapping(lower, nlower);
+		print_mapping(title, ntitle);
+		print_mapping(upper, nupper);
+		printf("\n");
+	}
+
+	free(all);
+	free(converted);
+	return 0;
+}
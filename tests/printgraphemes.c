@@ -0,0 +1,145 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+#define MAX_LINE_CODEPOINTS 64
+
+/* Check the bulk lookup API against the single codepoint API. */
+static void check_lookup_n(void)
+{
+	codepoint_t *all = malloc(MAX_CODEPOINTS * sizeof(codepoint_t));
+	uint8_t *breaks = malloc(MAX_CODEPOINTS);
+	codepoint_t c;
+	if (!all || !breaks)
+		return;
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+		all[c] = c;
+	ucd_lookup_grapheme_cluster_break_n(all, MAX_CODEPOINTS, breaks);
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		if (breaks[c] != ucd_lookup_grapheme_cluster_break(c))
+			printf("lookup: %06X is %d, expected %d\n", c, breaks[c], ucd_lookup_grapheme_cluster_break(c));
+	}
+
+	free(all);
+	free(breaks);
+}
+
+/* Check the UTF-32 and UTF-8 iterators against the break state results. */
+static void check_iterators(const codepoint_t *codepoints, const int *breaks, size_t n)
+{
+	char utf8[MAX_LINE_CODEPOINTS * 4];
+	size_t offsets[MAX_LINE_CODEPOINTS + 1];
+	size_t i, next, len, used;
+	int has_surrogates = 0;
+
+	for (i = 0, len = 0; i < n; ++i)
+	{
+		offsets[i] = len;
+		if (codepoints[i] >= 0xD800 && codepoints[i] <= 0xDFFF)
+			has_surrogates = 1;
+		else
+			len += put_utf8c(utf8 + len, codepoints[i]);
+	}
+	offsets[n] = len;
+
+	for (i = 0; i < n; i = next)
+	{
+		for (next = i + 1; next < n && !breaks[next]; ++next)
+			;
+
+		used = ucd_utf32_next_grapheme(codepoints + i, n - i);
+		if (used != next - i)
+			printf("utf32: grapheme at %04X is %u codepoints, expected %u\n", codepoints[i], (unsigned)used, (unsigned)(next - i));
+
+		/* Surrogates are ill-formed in UTF-8, so have different boundaries. */
+		if (has_surrogates)
+			continue;
+
+		used = ucd_utf8_next_grapheme(utf8 + offsets[i], len - offsets[i]);
+		if (used != offsets[next] - offsets[i])
+			printf("utf8: grapheme at %04X is %u bytes, expected %u\n", codepoints[i], (unsigned)used, (unsigned)(offsets[next] - offsets[i]));
+	}
+}
+
+/* Print the grapheme cluster boundaries for the codepoints in each test of a
+ * GraphemeBreakTest.txt file, in the same format as that file.
+ */
+int main(int argc, char **argv)
+{
+	codepoint_t codepoints[MAX_LINE_CODEPOINTS];
+	int breaks[MAX_LINE_CODEPOINTS];
+	ucd_grapheme_break_state state;
+	char line[1024];
+	char *p, *end;
+	size_t n, i;
+	FILE *in;
+
+	if (argc != 2)
+	{
+		fprintf(stdout, "usage: printgraphemes GraphemeBreakTest.txt\n");
+		return 1;
+	}
+
+	in = fopen(argv[1], "r");
+	if (!in)
+		return 1;
+
+	check_lookup_n();
+
+	while (fgets(line, sizeof(line), in))
+	{
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+
+		p = strchr(line, '#');
+		if (p) *p = '\0';
+
+		n = 0;
+		for (p = line; *p && n < MAX_LINE_CODEPOINTS; p = end)
+		{
+			codepoints[n] = (codepoint_t)strtoul(p, &end, 16);
+			if (end == p)
+				++end;
+			else
+				++n;
+		}
+
+		ucd_grapheme_break_init(&state);
+		for (i = 0; i < n; ++i)
+		{
+			breaks[i] = ucd_grapheme_break_next(&state, codepoints[i]);
+			printf("%s %04X ", breaks[i] ? "\xC3\xB7" : "\xC3\x97", codepoints[i]);
+		}
+		printf("\xC3\xB7\n");
+
+		check_iterators(codepoints, breaks, n);
+	}
+
+	fclose(in);
+	return 0;
+}
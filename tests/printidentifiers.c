@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+
+static const char ascii[] = "abcdefghijklmnopqrstuvwxyz_0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+/* Check scanning identifiers that start with, or contain, each codepoint. The
+ * codepoint is placed after a varying number of ASCII identifier characters so
+ * it is checked at different positions in the SIMD blocks.
+ */
+static void check_scan(void)
+{
+	char utf8[128];
+	codepoint_t c;
+	size_t i, n, len, expected, prefix;
+	ucd_property props;
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		if (c >= 0xD800 && c <= 0xDFFF)
+			continue;
+		props = ucd_lookup_properties(c);
+
+		/* The codepoint at the start of the identifier. */
+		len = put_utf8c(utf8, c);
+		memcpy(utf8 + len, "a1 ", 3);
+		expected = (props & UCD_PROPERTY_XID_START) ? len + 2 : 0;
+		n = ucd_utf8_scan_identifier(utf8, len + 3);
+		if (n != expected)
+			printf("%04X: start of identifier is %u bytes, expected %u\n", c, (unsigned)n, (unsigned)expected);
+
+		/* The codepoint in the identifier. */
+		prefix = 1 + (c % 40);
+		for (i = 0; i < prefix; ++i)
+			utf8[i] = ascii[i % (sizeof(ascii) - 1)];
+		len = prefix + put_utf8c(utf8 + prefix, c);
+		memcpy(utf8 + len, "_b2 ", 4);
+		expected = (props & UCD_PROPERTY_XID_CONTINUE) ? len + 3 : prefix;
+		n = ucd_utf8_scan_identifier(utf8, len + 4);
+		if (n != expected)
+			printf("%04X: identifier is %u bytes, expected %u\n", c, (unsigned)n, (unsigned)expected);
+	}
+
+	if (ucd_utf8_scan_identifier("", 0) != 0)
+		printf("ucd_utf8_scan_identifier: empty data is an identifier\n");
+	if (ucd_utf8_scan_identifier(ascii, sizeof(ascii) - 1) != sizeof(ascii) - 1)
+		printf("ucd_utf8_scan_identifier: ASCII identifier is not scanned to the end of the data\n");
+	if (ucd_utf8_scan_identifier("_a", 2) != 0 || ucd_utf8_scan_identifier("1a", 2) != 0)
+		printf("ucd_utf8_scan_identifier: identifier starts with an XID_Continue character\n");
+
+	/* Ill-formed sequences are not identifier characters. */
+	if (ucd_utf8_scan_identifier("\xC0\x80" "a", 3) != 0)
+		printf("ucd_utf8_scan_identifier: identifier starts with an ill-formed sequence\n");
+	if (ucd_utf8_scan_identifier("a\xE2\x82z", 4) != 1)
+		printf("ucd_utf8_scan_identifier: identifier contains an ill-formed sequence\n");
+}
+
+static const char *xid_start(codepoint_t c)
+{
+	return (ucd_lookup_properties(c) & UCD_PROPERTY_XID_START) ? "XID_Start" : NULL;
+}
+
+static const char *xid_continue(codepoint_t c)
+{
+	return (ucd_lookup_properties(c) & UCD_PROPERTY_XID_CONTINUE) ? "XID_Continue" : NULL;
+}
+
+/* Print the ranges of the codepoints that have the XID_Start and XID_Continue
+ * properties in the same format as the DerivedCoreProperties.txt file, and
+ * check the identifier scanner.
+ */
+int main(void)
+{
+	print_ranges(xid_start);
+	print_ranges(xid_continue);
+
+	check_scan();
+	return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+#define MAX_LINE_CODEPOINTS 64
+
+/* Check the bulk lookup API against the single codepoint API. */
+static void check_lookup_n(void)
+{
+	codepoint_t *all = malloc(MAX_CODEPOINTS * sizeof(codepoint_t));
+	uint8_t *breaks = malloc(MAX_CODEPOINTS);
+	codepoint_t c;
+	if (!all || !breaks)
+		return;
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+		all[c] = c;
+	ucd_lookup_line_break_n(all, MAX_CODEPOINTS, breaks);
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		if (breaks[c] != ucd_lookup_line_break(c))
+			printf("lookup: %06X is %d, expected %d\n", c, breaks[c], ucd_lookup_line_break(c));
+	}
+
+	free(all);
+	free(breaks);
+}
+
+/* Check the UTF-32 and UTF-8 chunk APIs against the break opportunities for
+ * the whole line. The data is passed in chunks of chunk_size codepoints or
+ * bytes, carrying any unprocessed data at the end of a chunk over to the next
+ * chunk.
+ */
+static void check_chunks(const codepoint_t *codepoints, const uint8_t *breaks, size_t n, size_t chunk_size)
+{
+	ucd_line_break_state state;
+	uint8_t utf32_breaks[MAX_LINE_CODEPOINTS];
+	uint8_t utf8_breaks[MAX_LINE_CODEPOINTS * 4];
+	size_t offsets[MAX_LINE_CODEPOINTS];
+	char utf8[MAX_LINE_CODEPOINTS * 4];
+	size_t i, len, start, end;
+
+	ucd_line_break_init(&state);
+	for (start = 0, end = 0; end < n; )
+	{
+		end = end + chunk_size > n ? n : end + chunk_size;
+		start += ucd_utf32_line_breaks(&state, codepoints + start, end - start, end == n, utf32_breaks + start);
+	}
+	if (start != n)
+		printf("utf32: %u codepoints were not processed\n", (unsigned)(n - start));
+	else if (memcmp(utf32_breaks, breaks, n) != 0)
+		printf("utf32: break opportunities differ at %04X\n", codepoints[0]);
+
+	for (i = 0, len = 0; i < n; ++i)
+	{
+		offsets[i] = len;
+		len += put_utf8c(utf8 + len, codepoints[i]);
+	}
+
+	ucd_line_break_init(&state);
+	for (start = 0, end = 0; end < len; )
+	{
+		end = end + chunk_size > len ? len : end + chunk_size;
+		start += ucd_utf8_line_breaks(&state, utf8 + start, end - start, end == len, utf8_breaks + start);
+	}
+	if (start != len)
+	{
+		printf("utf8: %u bytes were not processed\n", (unsigned)(len - start));
+		return;
+	}
+	for (i = 0; i < n; ++i)
+	{
+		if (utf8_breaks[offsets[i]] != breaks[i])
+			printf("utf8: break opportunity before %04X is %d, expected %d\n", codepoints[i], utf8_breaks[offsets[i]], breaks[i]);
+	}
+}
+
+/* Print the line break opportunities for the codepoints in each test of a
+ * LineBreakTest.txt file, in the same format as that file.
+ */
+int main(int argc, char **argv)
+{
+	codepoint_t codepoints[MAX_LINE_CODEPOINTS];
+	uint8_t breaks[MAX_LINE_CODEPOINTS];
+	ucd_line_break_state state;
+	char line[1024];
+	char *p, *end;
+	size_t n, i;
+	FILE *in;
+
+	if (argc != 2)
+	{
+		fprintf(stdout, "usage: printlinebreaks LineBreakTest.txt\n");
+		return 1;
+	}
+
+	in = fopen(argv[1], "r");
+	if (!in)
+		return 1;
+
+	check_lookup_n();
+
+	while (fgets(line, sizeof(line), in))
+	{
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+
+		p = strchr(line, '#');
+		if (p) *p = '\0';
+
+		n = 0;
+		for (p = line; *p && n < MAX_LINE_CODEPOINTS; p = end)
+		{
+			codepoints[n] = (codepoint_t)strtoul(p, &end, 16);
+			if (end == p)
+				++end;
+			else
+				++n;
+		}
+
+		ucd_line_break_init(&state);
+		ucd_utf32_line_breaks(&state, codepoints, n, 1, breaks);
+		for (i = 0; i < n; ++i)
+			printf("%s %04X ", breaks[i] == UCD_BREAK_PROHIBITED ? "\xC3\x97" : "\xC3\xB7", codepoints[i]);
+		printf("\xC3\xB7\n");
+
+		check_chunks(codepoints, breaks, n, 1);
+		check_chunks(codepoints, breaks, n, 2);
+		check_chunks(codepoints, breaks, n, 3);
+	}
+
+	fclose(in);
+	return 0;
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+
+/* Check that the name of the codepoint is the expected name, and that looking
+ * up the name gives the codepoint.
+ */
+static void check_name(codepoint_t c, const char *expected)
+{
+	char name[UCD_MAX_NAME_LENGTH + 1];
+	size_t len = ucd_get_name(c, name, sizeof(name));
+	if (len != strlen(expected) || strcmp(name, expected) != 0)
+		printf("%04X: name is \"%s\", expected \"%s\"\n", c, name, expected);
+	if (len != 0 && ucd_lookup_name(expected) != c)
+		printf("%04X: ucd_lookup_name(\"%s\") is %04X\n", c, expected, ucd_lookup_name(expected));
+}
+
+/* Check the names of the codepoints in a <..., First> to <..., Last> range. */
+static void check_range(codepoint_t first, codepoint_t last, const char *label)
+{
+	char expected[UCD_MAX_NAME_LENGTH + 1];
+	codepoint_t c;
+	for (c = first; c <= last; ++c)
+	{
+		if (strncmp(label, "<CJK Ideograph", 14) == 0)
+			sprintf(expected, "CJK UNIFIED IDEOGRAPH-%04X", c);
+		else if (strncmp(label, "<Tangut Ideograph", 17) == 0)
+			sprintf(expected, "TANGUT IDEOGRAPH-%04X", c);
+		else if (strncmp(label, "<Hangul Syllable", 16) == 0)
+		{
+			char name[UCD_MAX_NAME_LENGTH + 1];
+			if (ucd_get_name(c, name, sizeof(name)) <= 16 || strncmp(name, "HANGUL SYLLABLE ", 16) != 0)
+				printf("%04X: name is \"%s\", expected a Hangul Syllable\n", c, name);
+			strcpy(expected, name);
+		}
+		else
+			expected[0] = '\0';
+		check_name(c, expected);
+	}
+}
+
+/* Check that the output buffer is NUL terminated and not overrun when it is
+ * too small for the name.
+ */
+static void check_truncated(codepoint_t c)
+{
+	char name[UCD_MAX_NAME_LENGTH + 1];
+	char truncated[8];
+	size_t len = ucd_get_name(c, name, sizeof(name));
+	memset(truncated, '#', sizeof(truncated));
+	if (ucd_get_name(c, truncated, 5) != len)
+		printf("%04X: truncated name length differs\n", c);
+	if (strncmp(truncated, name, 4) != 0 || truncated[4] != '\0' || truncated[5] != '#')
+		printf("%04X: truncated name is not \"%.4s\"\n", c, name);
+	if (ucd_get_name(c, NULL, 0) != len)
+		printf("%04X: name length without a buffer differs\n", c);
+}
+
+static void check_invalid_name(const char *name)
+{
+	if (ucd_lookup_name(name) != UCD_INVALID_CODEPOINT)
+		printf("ucd_lookup_name(\"%s\") is %04X, expected no codepoint\n", name, ucd_lookup_name(name));
+}
+
+/* Print the codepoints and names in UnicodeData.txt in the same format as the
+ * codepoint and name fields of that file, checking the names of the codepoint
+ * ranges and that the names can be looked up.
+ */
+int main(int argc, char **argv)
+{
+	uint8_t *listed = calloc(MAX_CODEPOINTS, 1);
+	char line[4096], name[UCD_MAX_NAME_LENGTH + 1];
+	char *label, *end;
+	codepoint_t c, first = 0;
+	FILE *in;
+
+	if (argc != 2)
+	{
+		fprintf(stdout, "usage: printnames UnicodeData.txt\n");
+		return 1;
+	}
+
+	in = fopen(argv[1], "r");
+	if (!in || !listed)
+		return 1;
+
+	while (fgets(line, sizeof(line), in))
+	{
+		c = (codepoint_t)strtoul(line, &label, 16);
+		if (*label != ';')
+			continue;
+		end = strchr(++label, ';');
+		if (!end)
+			continue;
+		*end = '\0';
+
+		listed[c] = 1;
+		if (label[0] != '<')
+		{
+			ucd_get_name(c, name, sizeof(name));
+			printf("%04X;%s\n", c, name);
+			check_name(c, label);
+		}
+		else if (strstr(label, ", First>") != NULL)
+			first = c;
+		else if (strstr(label, ", Last>") != NULL)
+		{
+			check_range(first, c, label);
+			for (; first <= c; ++first)
+				listed[first] = 1;
+		}
+		else
+			check_name(c, "");
+	}
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		if (!listed[c] && ucd_get_name(c, name, sizeof(name)) != 0)
+			printf("%04X: unlisted codepoint has the name \"%s\"\n", c, name);
+	}
+	if (ucd_get_name(0x110000, name, sizeof(name)) != 0)
+		printf("110000: invalid codepoint has a name\n");
+
+	check_name(0xAC00, "HANGUL SYLLABLE GA");
+	check_name(0xAC01, "HANGUL SYLLABLE GAG");
+	check_name(0xC544, "HANGUL SYLLABLE A");
+	check_name(0xD7A3, "HANGUL SYLLABLE HIH");
+
+	check_truncated(0x0041);
+	check_truncated(0xAC00);
+	check_truncated(0x4E00);
+
+	check_invalid_name("");
+	check_invalid_name("LATIN CAPITAL LETTER");
+	check_invalid_name("LATIN CAPITAL LETTER A ");
+	check_invalid_name("latin capital letter a");
+	check_invalid_name("HANGUL SYLLABLE ");
+	check_invalid_name("HANGUL SYLLABLE GAX");
+	check_invalid_name("HANGUL SYLLABLE GGGA");
+	check_invalid_name("CJK UNIFIED IDEOGRAPH-");
+	check_invalid_name("CJK UNIFIED IDEOGRAPH-4e00");
+	check_invalid_name("CJK UNIFIED IDEOGRAPH-04E00");
+	check_invalid_name("CJK UNIFIED IDEOGRAPH-0041");
+	check_invalid_name("CJK COMPATIBILITY IDEOGRAPH-FA6E");
+	check_invalid_name("TANGUT IDEOGRAPH-187F8");
+
+	fclose(in);
+	free(listed);
+	return 0;
+}
@@ -0,0 +1,295 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+#define MAX_FIELD_CODEPOINTS 256
+
+static const char *form_names[] = { "NFC", "NFD", "NFKC", "NFKD" };
+
+typedef struct field_
+{
+	codepoint_t codepoints[MAX_FIELD_CODEPOINTS];
+	size_t n;
+} field;
+
+static int equal(const field *a, const field *b)
+{
+	return a->n == b->n && memcmp(a->codepoints, b->codepoints, a->n * sizeof(codepoint_t)) == 0;
+}
+
+static void print_field(const field *f)
+{
+	size_t i;
+	for (i = 0; i < f->n; ++i)
+		printf(i == 0 ? "%04X" : " %04X", f->codepoints[i]);
+	printf(";");
+}
+
+/* Normalize the text using the UTF-32 API, checking that the UTF-8 API, the
+ * quick check and the is normalized checks give the same result.
+ */
+static void normalize(const field *in, ucd_normalization_form form, field *out)
+{
+	char utf8[MAX_FIELD_CODEPOINTS * 4];
+	char normalized[MAX_FIELD_CODEPOINTS * 4];
+	char expected[MAX_FIELD_CODEPOINTS * 4];
+	size_t i, len, n, expected_len;
+	ucd_quick_check check;
+	int is_normalized;
+
+	out->n = ucd_utf32_normalize(in->codepoints, in->n, form, out->codepoints, MAX_FIELD_CODEPOINTS);
+	if (ucd_utf32_normalize(in->codepoints, in->n, form, NULL, 0) != out->n)
+		printf("utf32: %s length differs for %04X\n", form_names[form], in->codepoints[0]);
+
+	is_normalized = equal(in, out);
+	check = ucd_utf32_quick_check(in->codepoints, in->n, form);
+	if ((check == UCD_QUICK_CHECK_YES && !is_normalized) || (check == UCD_QUICK_CHECK_NO && is_normalized))
+		printf("utf32: %s quick check is %d for %04X\n", form_names[form], check, in->codepoints[0]);
+	if (!ucd_utf32_is_normalized(in->codepoints, in->n, form) != !is_normalized)
+		printf("utf32: %s is normalized differs for %04X\n", form_names[form], in->codepoints[0]);
+
+	for (i = 0, len = 0; i < in->n; ++i)
+		len += put_utf8c(utf8 + len, in->codepoints[i]);
+	for (i = 0, expected_len = 0; i < out->n; ++i)
+		expected_len += put_utf8c(expected + expected_len, out->codepoints[i]);
+
+	n = ucd_utf8_normalize(utf8, len, form, normalized, sizeof(normalized));
+	if (n != expected_len || memcmp(normalized, expected, n) != 0)
+		printf("utf8: %s differs for %04X\n", form_names[form], in->codepoints[0]);
+	if (ucd_utf8_quick_check(utf8, len, form) != check)
+		printf("utf8: %s quick check differs for %04X\n", form_names[form], in->codepoints[0]);
+	if (!ucd_utf8_is_normalized(utf8, len, form) != !is_normalized)
+		printf("utf8: %s is normalized differs for %04X\n", form_names[form], in->codepoints[0]);
+}
+
+/* Check the UTF-8 API against the UTF-32 API when the text is surrounded by
+ * runs of ASCII characters, which are processed 16 bytes at a time.
+ */
+static void check_ascii_runs(const field *in, ucd_normalization_form form)
+{
+	static const char ascii[] = "The quick brown fox jumps over the lazy dog";
+	codepoint_t text[MAX_FIELD_CODEPOINTS + 2 * sizeof(ascii)];
+	codepoint_t normalized[MAX_FIELD_CODEPOINTS + 2 * sizeof(ascii)];
+	char utf8[(MAX_FIELD_CODEPOINTS + 2 * sizeof(ascii)) * 4];
+	char utf8_normalized[(MAX_FIELD_CODEPOINTS + 2 * sizeof(ascii)) * 4];
+	char expected[(MAX_FIELD_CODEPOINTS + 2 * sizeof(ascii)) * 4];
+	size_t i, n = 0, len = 0, expected_len = 0;
+
+	for (i = 0; ascii[i] != '\0'; ++i)
+		text[n++] = (codepoint_t)ascii[i];
+	for (i = 0; i < in->n; ++i)
+		text[n++] = in->codepoints[i];
+	for (i = 0; ascii[i] != '\0'; ++i)
+		text[n++] = (codepoint_t)ascii[i];
+
+	for (i = 0; i < n; ++i)
+		len += put_utf8c(utf8 + len, text[i]);
+	n = ucd_utf32_normalize(text, n, form, normalized, sizeof(normalized) / sizeof(normalized[0]));
+	for (i = 0; i < n; ++i)
+		expected_len += put_utf8c(expected + expected_len, normalized[i]);
+
+	n = ucd_utf8_normalize(utf8, len, form, utf8_normalized, sizeof(utf8_normalized));
+	if (n != expected_len || memcmp(utf8_normalized, expected, n) != 0)
+		printf("utf8: %s differs for %04X in ASCII text\n", form_names[form], in->codepoints[0]);
+	if (!ucd_utf8_is_normalized(utf8, len, form) != !(expected_len == len && memcmp(utf8, expected, len) == 0))
+		printf("utf8: %s is normalized differs for %04X in ASCII text\n", form_names[form], in->codepoints[0]);
+}
+
+/* Check that the normalization of the text in a form is the expected text. */
+static void check_normalize(const field *in, ucd_normalization_form form, const field *expected, int column)
+{
+	field out;
+	normalize(in, form, &out);
+	if (!equal(&out, expected))
+		printf("%s(c%d) differs for %04X\n", form_names[form], column, in->codepoints[0]);
+}
+
+/* Check that the characters not in part 1 of the test file are not changed
+ * by normalization.
+ */
+static void check_unlisted(const uint8_t *listed)
+{
+	codepoint_t c, out[4];
+	int form;
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		if (listed[c] || (c >= 0xD800 && c <= 0xDFFF))
+			continue;
+		for (form = UCD_NFC; form <= UCD_NFKD; ++form)
+		{
+			if (ucd_utf32_normalize(&c, 1, (ucd_normalization_form)form, out, 4) != 1 || out[0] != c)
+				printf("%s(%04X) is not %04X\n", form_names[form], c, c);
+		}
+	}
+}
+
+/* Check that a run of combining marks that is longer than
+ * UCD_MAX_NORMALIZATION_SEGMENT is normalized to text in canonical order,
+ * which is in the normalization form, and that it is not changed if it is
+ * already normalized.
+ */
+static void check_long_runs(void)
+{
+	field in, out, again;
+	size_t i;
+	int form;
+
+	in.n = 0;
+	in.codepoints[in.n++] = 0x0061;
+	for (i = 0; i < 70; ++i)
+		in.codepoints[in.n++] = 0x0301;
+	in.codepoints[in.n++] = 0x0316;
+
+	for (form = UCD_NFC; form <= UCD_NFKD; ++form)
+	{
+		normalize(&in, (ucd_normalization_form)form, &out);
+		check_ascii_runs(&in, (ucd_normalization_form)form);
+		for (i = 1; i < out.n; ++i)
+		{
+			if (ucd_lookup_ccc(out.codepoints[i]) != 0 && ucd_lookup_ccc(out.codepoints[i - 1]) > ucd_lookup_ccc(out.codepoints[i]))
+				printf("%s of a long run is not in canonical order at %d\n", form_names[form], (int)i);
+		}
+
+		normalize(&out, (ucd_normalization_form)form, &again);
+		if (!equal(&out, &again))
+			printf("%s of a long run is not normalized\n", form_names[form]);
+	}
+
+	/* U+0334 COMBINING TILDE OVERLAY does not decompose or compose, so the
+	 * text is in all the normalization forms.
+	 */
+	in.n = 0;
+	in.codepoints[in.n++] = 0x0061;
+	for (i = 0; i < 100; ++i)
+		in.codepoints[in.n++] = 0x0334;
+
+	for (form = UCD_NFC; form <= UCD_NFKD; ++form)
+	{
+		normalize(&in, (ucd_normalization_form)form, &out);
+		if (!equal(&in, &out))
+			printf("%s changes a long normalized run\n", form_names[form]);
+		if (ucd_utf32_quick_check(in.codepoints, in.n, (ucd_normalization_form)form) != UCD_QUICK_CHECK_YES)
+			printf("%s quick check of a long normalized run is not YES\n", form_names[form]);
+	}
+
+	/* U+0301 COMBINING ACUTE ACCENT is not blocked from the starter by the
+	 * U+0334 characters, which have a lower combining class.
+	 */
+	in.codepoints[in.n++] = 0x0301;
+	normalize(&in, UCD_NFC, &out);
+	if (out.n != in.n - 1 || out.codepoints[0] != 0x00E1 || memcmp(out.codepoints + 1, in.codepoints + 1, (in.n - 2) * sizeof(codepoint_t)) != 0)
+		printf("NFC of a long run does not compose with the starter\n");
+}
+
+/* Print the normalization forms of the first column of each test in a
+ * NormalizationTest.txt file, in the same format as that file, checking
+ * the conformance invariants for the other columns.
+ */
+int main(int argc, char **argv)
+{
+	uint8_t *listed = calloc(MAX_CODEPOINTS, 1);
+	field c[5], out;
+	char line[4096];
+	char *p, *end;
+	int part = -1, i, form;
+	FILE *in;
+
+	if (argc != 2)
+	{
+		fprintf(stdout, "usage: printnormalization NormalizationTest.txt\n");
+		return 1;
+	}
+
+	in = fopen(argv[1], "r");
+	if (!in || !listed)
+		return 1;
+
+	while (fgets(line, sizeof(line), in))
+	{
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+		if (line[0] == '@')
+		{
+			part = atoi(line + 5);
+			continue;
+		}
+
+		p = line;
+		for (i = 0; i < 5; ++i)
+		{
+			c[i].n = 0;
+			while (*p != ';' && *p != '\0')
+			{
+				codepoint_t value = (codepoint_t)strtoul(p, &end, 16);
+				if (end == p)
+					++p;
+				else
+				{
+					if (c[i].n < MAX_FIELD_CODEPOINTS)
+						c[i].codepoints[c[i].n++] = value;
+					p = end;
+				}
+			}
+			if (*p == ';')
+				++p;
+		}
+
+		if (part == 1 && c[0].n == 1)
+			listed[c[0].codepoints[0]] = 1;
+
+		print_field(&c[0]);
+		for (form = UCD_NFC; form <= UCD_NFKD; ++form)
+		{
+			normalize(&c[0], (ucd_normalization_form)form, &out);
+			print_field(&out);
+			check_ascii_runs(&c[0], (ucd_normalization_form)form);
+		}
+		printf("\n");
+
+		for (i = 1; i < 5; ++i)
+		{
+			check_normalize(&c[i], UCD_NFKC, &c[3], i + 1);
+			check_normalize(&c[i], UCD_NFKD, &c[4], i + 1);
+		}
+		for (i = 1; i < 3; ++i)
+		{
+			check_normalize(&c[i], UCD_NFC, &c[1], i + 1);
+			check_normalize(&c[i], UCD_NFD, &c[2], i + 1);
+		}
+		for (i = 3; i < 5; ++i)
+		{
+			check_normalize(&c[i], UCD_NFC, &c[3], i + 1);
+			check_normalize(&c[i], UCD_NFD, &c[4], i + 1);
+		}
+	}
+
+	check_unlisted(listed);
+	check_long_runs();
+
+	fclose(in);
+	free(listed);
+	return 0;
+}
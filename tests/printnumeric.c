@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+
+static void print_value(int64_t numerator, int64_t denominator)
+{
+	if (denominator == 1)
+		printf("%lld", (long long)numerator);
+	else
+		printf("%lld/%lld", (long long)numerator, (long long)denominator);
+}
+
+static void check_parse_uint(const char *in, size_t expected_len, uint64_t expected)
+{
+	uint64_t value = 0;
+	size_t len = ucd_utf8_parse_uint(in, strlen(in), &value);
+	if (len != expected_len || value != expected)
+		printf("ucd_utf8_parse_uint(\"%s\") is %u bytes (%llu), expected %u bytes (%llu)\n", in,
+		       (unsigned)len, (unsigned long long)value, (unsigned)expected_len, (unsigned long long)expected);
+}
+
+/* Check parsing the decimal digits from different scripts, stopping at the
+ * digits that are not from the same set of ten digits as the first digit.
+ */
+static void check_utf8(void)
+{
+	check_parse_uint("", 0, 0);
+	check_parse_uint("abc", 0, 0);
+	check_parse_uint("\xC2\xB2", 0, 0); /* U+00B2 SUPERSCRIPT TWO is Di, not De */
+	check_parse_uint("\xC0\x80", 0, 0); /* ill-formed */
+	check_parse_uint("0", 1, 0);
+	check_parse_uint("1234567890abc", 10, 1234567890);
+	check_parse_uint("12\xD9\xA3", 2, 12); /* U+0663 ARABIC-INDIC DIGIT THREE */
+	check_parse_uint("\xD9\xA1\xD9\xA2\xD9\xA3", 6, 123); /* U+0661..U+0663 */
+	check_parse_uint("\xD9\xA1\xDB\xB2", 2, 1); /* U+0661, U+06F2 EXTENDED ARABIC-INDIC DIGIT TWO */
+	check_parse_uint("\xE0\xA5\xAA\xE0\xA5\xAB.", 6, 45); /* U+096A..U+096B DEVANAGARI */
+	check_parse_uint("\xEF\xBC\x99\xEF\xBC\x90" "1", 6, 90); /* U+FF19..U+FF10 FULLWIDTH */
+	check_parse_uint("\xF0\x9D\x9F\x8F\xF0\x9D\x9F\x90", 8, 12); /* U+1D7CF..U+1D7D0 MATHEMATICAL BOLD */
+	check_parse_uint("\xF0\x9D\x9F\x8F\xF0\x9D\x9F\x9A", 4, 1); /* U+1D7CF, U+1D7DA MATHEMATICAL DOUBLE-STRUCK */
+	check_parse_uint("18446744073709551615", 20, UINT64_MAX);
+	check_parse_uint("18446744073709551616", 20, UINT64_MAX);
+	check_parse_uint("99999999999999999999999", 23, UINT64_MAX);
+	check_parse_uint("\xD9\xA1\xD9\xA8\xD9\xA4\xD9\xA4\xD9\xA6\xD9\xA7\xD9\xA4\xD9\xA4\xD9\xA0\xD9\xA7"
+	                 "\xD9\xA3\xD9\xA7\xD9\xA0\xD9\xA9\xD9\xA5\xD9\xA5\xD9\xA1\xD9\xA6\xD9\xA1\xD9\xA6",
+	                 40, UINT64_MAX); /* 18446744073709551616 */
+}
+
+/* Print the decimal, digit and numeric fields of the codepoints with a numeric
+ * value in a UnicodeData.txt file, checking that the other codepoints do not
+ * have a numeric value.
+ */
+int main(int argc, char **argv)
+{
+	uint8_t *listed = calloc(MAX_CODEPOINTS, 1);
+	char line[4096];
+	codepoint_t c;
+	int64_t numerator, denominator;
+	ucd_numeric_type type;
+	int digit;
+	FILE *in;
+
+	if (argc != 2)
+	{
+		fprintf(stdout, "usage: printnumeric UnicodeData.txt\n");
+		return 1;
+	}
+
+	in = fopen(argv[1], "r");
+	if (!in || !listed)
+		return 1;
+
+	while (fgets(line, sizeof(line), in))
+	{
+		c = (codepoint_t)strtoul(line, NULL, 16);
+		type = ucd_lookup_numeric_value(c, &numerator, &denominator);
+		if (type != ucd_lookup_numeric_type(c))
+			printf("%04X: ucd_lookup_numeric_type does not match ucd_lookup_numeric_value\n", c);
+		if (type == UCD_NUMERIC_TYPE_None)
+			continue;
+		listed[c] = 1;
+
+		printf("%04X;", c);
+		if (type == UCD_NUMERIC_TYPE_De)
+		{
+			print_value(numerator, denominator);
+			printf(";");
+		}
+		else
+			printf(";");
+		if (type != UCD_NUMERIC_TYPE_Nu)
+		{
+			print_value(numerator, denominator);
+			printf(";");
+		}
+		else
+			printf(";");
+		print_value(numerator, denominator);
+		printf("\n");
+	}
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		type = ucd_lookup_numeric_value(c, &numerator, &denominator);
+		if (!listed[c] && type != UCD_NUMERIC_TYPE_None)
+			printf("%04X: unlisted codepoint has a numeric value\n", c);
+		digit = ucd_digit_value(c);
+		if (type == UCD_NUMERIC_TYPE_De ? digit != numerator : digit != -1)
+			printf("%04X: ucd_digit_value is %d\n", c, digit);
+	}
+	if (ucd_lookup_numeric_type(0x110000) != UCD_NUMERIC_TYPE_None || ucd_digit_value(0x110000) != -1)
+		printf("110000: invalid codepoint has a numeric value\n");
+
+	check_utf8();
+
+	fclose(in);
+	free(listed);
+	return 0;
+}
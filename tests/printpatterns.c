@@ -0,0 +1,96 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+
+typedef size_t (*span_function)(const char *in, size_t len);
+
+/* Check the span of the property before and after each codepoint. The
+ * codepoint is placed after a varying number of ASCII characters with the
+ * property so it is checked at different positions in the SIMD blocks.
+ */
+static void check_span(const char *name, span_function span, ucd_property property,
+                       const char *ascii, const char *end)
+{
+	char utf8[128];
+	codepoint_t c;
+	size_t i, n, len, expected, prefix;
+	size_t ascii_len = strlen(ascii);
+	size_t end_len = strlen(end);
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		if (c >= 0xD800 && c <= 0xDFFF)
+			continue;
+
+		prefix = c % 40;
+		for (i = 0; i < prefix; ++i)
+			utf8[i] = ascii[i % ascii_len];
+		len = prefix + put_utf8c(utf8 + prefix, c);
+		memcpy(utf8 + len, ascii, 2);
+		memcpy(utf8 + len + 2, end, end_len);
+		expected = (ucd_lookup_properties(c) & property) ? len + 2 : prefix;
+		n = span(utf8, len + 2 + end_len);
+		if (n != expected)
+			printf("%04X: %s is %u bytes, expected %u\n", c, name, (unsigned)n, (unsigned)expected);
+	}
+
+	if (span("", 0) != 0)
+		printf("%s: empty data is not 0 bytes\n", name);
+	if (span(ascii, ascii_len) != ascii_len)
+		printf("%s: ASCII characters are not scanned to the end of the data\n", name);
+
+	/* Ill-formed sequences do not have the property. */
+	memcpy(utf8, ascii, 3);
+	memcpy(utf8 + 3, "\xE2\x80", 2);
+	if (span(utf8, 5) != 3)
+		printf("%s: ill-formed sequences have the property\n", name);
+}
+
+static const char *pattern_white_space(codepoint_t c)
+{
+	return (ucd_lookup_properties(c) & UCD_PROPERTY_PATTERN_WHITE_SPACE) ? "Pattern_White_Space" : NULL;
+}
+
+static const char *pattern_syntax(codepoint_t c)
+{
+	return (ucd_lookup_properties(c) & UCD_PROPERTY_PATTERN_SYNTAX) ? "Pattern_Syntax" : NULL;
+}
+
+/* Print the ranges of the codepoints that have the Pattern_White_Space and
+ * Pattern_Syntax properties in the same format as the PropList.txt file, and
+ * check the span functions.
+ */
+int main(void)
+{
+	print_ranges(pattern_white_space);
+	print_ranges(pattern_syntax);
+
+	check_span("ucd_utf8_skip_pattern_whitespace", ucd_utf8_skip_pattern_whitespace,
+	           UCD_PROPERTY_PATTERN_WHITE_SPACE, " \t\r\n\v\f", "x");
+	check_span("ucd_utf8_span_pattern_syntax", ucd_utf8_span_pattern_syntax,
+	           UCD_PROPERTY_PATTERN_SYNTAX, "!\"#$%&'()*+,-./:;<=>?@[\\]^`{|}~", "_");
+	return 0;
+}
@@ -0,0 +1,44 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stdio.h>
+
+/* Print the record data in the same format as:
+ *     printucddata --format="%pH %s %C %c %UH %LH %TH %P\n"
+ */
+int main(void)
+{
+	codepoint_t c;
+	for (c = 0; c <= 0x10FFFF; ++c)
+	{
+		const ucd_record *r = ucd_lookup_record(c);
+		ucd_category category = (ucd_category)r->category;
+		printf("%06X %s %s %s %06X %06X %06X %016llx\n", c,
+		       ucd_get_script_string((ucd_script)r->script),
+		       ucd_get_category_group_string(ucd_get_category_group_for_category(category)),
+		       ucd_get_category_string(category),
+		       ucd_record_toupper(r, c),
+		       ucd_record_tolower(r, c),
+		       ucd_record_totitle(r, c),
+		       (unsigned long long)r->properties);
+	}
+	return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_RUNS 8
+
+typedef struct script_run_test_
+{
+	const codepoint_t *text;
+	size_t n;
+	size_t runs[MAX_RUNS]; /* The number of codepoints in each run. */
+	ucd_script scripts[MAX_RUNS];
+} script_run_test;
+
+static const codepoint_t latin_cyrillic[] = { 'H', 'i', ',', ' ', 0x41F, 0x440, 0x438, '!' };
+static const codepoint_t brackets[] = { '(', 0x3B1, 0x3B2, ')', ' ', 'a', 'b' };
+static const codepoint_t digits[] = { '1', '2', '3', '.', '4' };
+static const codepoint_t combining[] = { 0x301, 0x302 };
+static const codepoint_t latin_combining[] = { 0x301, 'a', 0x301, 'b', 0x308 };
+static const codepoint_t devanagari[] = { 0x928, 0x92E, 0x938, 0x94D, 0x924, 0x947, 0x964 };
+static const codepoint_t bengali[] = { 0x9A8, 0x9AE, 0x964, ' ', 0x928, 0x964 };
+static const codepoint_t japanese[] = { 0x3072, 0x3089, 0x30AB, 0x30FC, 0x30BF, 0x6F22, 0x5B57, 0x3002 };
+static const codepoint_t syriac[] = { 0x710, 0x640, 0x712, ' ', 0x627, 0x640, 0x628 };
+static const codepoint_t unknown[] = { 'a', 0x0378, 'b' };
+
+static const script_run_test tests[] =
+{
+	{ latin_cyrillic, 8, { 4, 4 }, { UCD_SCRIPT_Latn, UCD_SCRIPT_Cyrl } },
+	{ brackets, 7, { 5, 2 }, { UCD_SCRIPT_Grek, UCD_SCRIPT_Latn } },
+	{ digits, 5, { 5 }, { UCD_SCRIPT_Zyyy } },
+	{ combining, 2, { 2 }, { UCD_SCRIPT_Zinh } },
+	{ latin_combining, 5, { 5 }, { UCD_SCRIPT_Latn } },
+	{ devanagari, 7, { 7 }, { UCD_SCRIPT_Deva } },
+	{ bengali, 6, { 4, 2 }, { UCD_SCRIPT_Beng, UCD_SCRIPT_Deva } },
+	{ japanese, 8, { 2, 3, 3 }, { UCD_SCRIPT_Hira, UCD_SCRIPT_Kana, UCD_SCRIPT_Hani } },
+	{ syriac, 7, { 4, 3 }, { UCD_SCRIPT_Syrc, UCD_SCRIPT_Arab } },
+	{ unknown, 3, { 1, 1, 1 }, { UCD_SCRIPT_Latn, UCD_SCRIPT_Zzzz, UCD_SCRIPT_Latn } },
+};
+
+/* Check that the UTF-32 and UTF-8 script run iterators split the text into
+ * the expected runs.
+ */
+static void check_script_runs(const script_run_test *test)
+{
+	char utf8[64], tmp[4];
+	size_t i, r, n, len, expected_len;
+	size_t pos = 0, utf8_pos = 0;
+	ucd_script script;
+
+	for (i = 0, len = 0; i < test->n; ++i)
+		len += put_utf8c(utf8 + len, test->text[i]);
+
+	for (r = 0; r < MAX_RUNS && test->runs[r] != 0; ++r)
+	{
+		n = ucd_utf32_next_script_run(test->text + pos, test->n - pos, &script);
+		if (n != test->runs[r] || script != test->scripts[r])
+			printf("%04X: utf32 run %d is %d %s, expected %d %s\n", test->text[0], (int)r,
+			       (int)n, ucd_get_script_string(script), (int)test->runs[r], ucd_get_script_string(test->scripts[r]));
+
+		for (i = pos, expected_len = 0; i < pos + test->runs[r]; ++i)
+			expected_len += put_utf8c(tmp, test->text[i]);
+		n = ucd_utf8_next_script_run(utf8 + utf8_pos, len - utf8_pos, &script);
+		if (n != expected_len || script != test->scripts[r])
+			printf("%04X: utf8 run %d is %d %s, expected %d %s\n", test->text[0], (int)r,
+			       (int)n, ucd_get_script_string(script), (int)expected_len, ucd_get_script_string(test->scripts[r]));
+
+		pos += test->runs[r];
+		utf8_pos += expected_len;
+	}
+	if (ucd_utf32_next_script_run(test->text + pos, test->n - pos, &script) != 0)
+		printf("%04X: utf32 has more runs than expected\n", test->text[0]);
+	if (ucd_utf8_next_script_run(utf8 + utf8_pos, len - utf8_pos, &script) != 0)
+		printf("%04X: utf8 has more runs than expected\n", test->text[0]);
+}
+
+static const char *script_extensions(codepoint_t c)
+{
+	static char value[UCD_MAX_SCRIPT_EXTENSIONS * 5];
+	uint8_t scripts[UCD_MAX_SCRIPT_EXTENSIONS];
+	size_t i, n = ucd_lookup_script_extensions(c, scripts, UCD_MAX_SCRIPT_EXTENSIONS);
+	value[0] = '\0';
+	for (i = 0; i < n; ++i)
+	{
+		if (i > 0)
+			strcat(value, " ");
+		strcat(value, ucd_get_script_string((ucd_script)scripts[i]));
+	}
+	return value;
+}
+
+/* Print the Script_Extensions of all the codepoints in the same format as the
+ * ScriptExtensions.txt file, including the codepoints where it is the Script
+ * of the codepoint, and check the script run iterators.
+ */
+int main(void)
+{
+	uint8_t scripts[UCD_MAX_SCRIPT_EXTENSIONS];
+	size_t i;
+	ucd_script script;
+
+	print_ranges(script_extensions);
+
+	if (ucd_lookup_script_extensions('a', scripts, 0) != 1)
+		printf("0061: the Script_Extensions is not the Script\n");
+	if (ucd_lookup_script_extensions(0x110000, scripts, UCD_MAX_SCRIPT_EXTENSIONS) != 1 || scripts[0] != UCD_SCRIPT_Zzzz)
+		printf("110000: the Script_Extensions is not Zzzz\n");
+
+	for (i = 0; i < sizeof(tests) / sizeof(tests[0]); ++i)
+		check_script_runs(&tests[i]);
+	if (ucd_utf8_next_script_run("a\xFF" "b", 3, &script) != 3 || script != UCD_SCRIPT_Latn)
+		printf("ill-formed UTF-8: the script run is not 3 Latn\n");
+	return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+#define MAX_LINE_CODEPOINTS 64
+
+typedef int (*lookup_fn)(codepoint_t c);
+typedef void (*lookup_n_fn)(const codepoint_t *in, size_t n, uint8_t *out);
+typedef size_t (*utf32_next_fn)(const codepoint_t *in, size_t n);
+typedef size_t (*utf8_next_fn)(const char *in, size_t len);
+
+static int lookup_word_break(codepoint_t c)
+{
+	return ucd_lookup_word_break(c);
+}
+
+static int lookup_sentence_break(codepoint_t c)
+{
+	return ucd_lookup_sentence_break(c);
+}
+
+/* Check the bulk lookup API against the single codepoint API. */
+static void check_lookup_n(lookup_fn lookup, lookup_n_fn lookup_n)
+{
+	codepoint_t *all = malloc(MAX_CODEPOINTS * sizeof(codepoint_t));
+	uint8_t *breaks = malloc(MAX_CODEPOINTS);
+	codepoint_t c;
+	if (!all || !breaks)
+		return;
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+		all[c] = c;
+	lookup_n(all, MAX_CODEPOINTS, breaks);
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		if (breaks[c] != lookup(c))
+			printf("lookup: %06X is %d, expected %d\n", c, breaks[c], lookup(c));
+	}
+
+	free(all);
+	free(breaks);
+}
+
+/* Print the word or sentence boundaries for the codepoints in each test of a
+ * WordBreakTest.txt or SentenceBreakTest.txt file, in the same format as that
+ * file. The UTF-8 iterator is checked against the UTF-32 iterator.
+ */
+int main(int argc, char **argv)
+{
+	codepoint_t codepoints[MAX_LINE_CODEPOINTS];
+	size_t offsets[MAX_LINE_CODEPOINTS + 1];
+	char utf8[MAX_LINE_CODEPOINTS * 4];
+	utf32_next_fn utf32_next;
+	utf8_next_fn utf8_next;
+	char line[1024];
+	char *p, *end;
+	size_t n, i, next, len, used;
+	FILE *in;
+
+	if (argc != 3)
+	{
+		fprintf(stdout, "usage: printsegments word|sentence WordBreakTest.txt|SentenceBreakTest.txt\n");
+		return 1;
+	}
+
+	if (!strcmp(argv[1], "word"))
+	{
+		check_lookup_n(lookup_word_break, ucd_lookup_word_break_n);
+		utf32_next = ucd_utf32_next_word;
+		utf8_next = ucd_utf8_next_word;
+	}
+	else if (!strcmp(argv[1], "sentence"))
+	{
+		check_lookup_n(lookup_sentence_break, ucd_lookup_sentence_break_n);
+		utf32_next = ucd_utf32_next_sentence;
+		utf8_next = ucd_utf8_next_sentence;
+	}
+	else
+	{
+		fprintf(stdout, "unknown segmentation type: %s\n", argv[1]);
+		return 1;
+	}
+
+	in = fopen(argv[2], "r");
+	if (!in)
+		return 1;
+
+	while (fgets(line, sizeof(line), in))
+	{
+		if (line[0] == '#' || line[0] == '\n')
+			continue;
+
+		p = strchr(line, '#');
+		if (p) *p = '\0';
+
+		n = 0;
+		len = 0;
+		for (p = line; *p && n < MAX_LINE_CODEPOINTS; p = end)
+		{
+			codepoints[n] = (codepoint_t)strtoul(p, &end, 16);
+			if (end == p)
+				++end;
+			else
+			{
+				offsets[n] = len;
+				len += put_utf8c(utf8 + len, codepoints[n]);
+				++n;
+			}
+		}
+		offsets[n] = len;
+
+		for (i = 0; i < n; i = next)
+		{
+			next = i + utf32_next(codepoints + i, n - i);
+			if (next <= i || next > n)
+			{
+				printf("utf32: segment at %04X has an invalid length\n", codepoints[i]);
+				break;
+			}
+
+			used = utf8_next(utf8 + offsets[i], len - offsets[i]);
+			if (used != offsets[next] - offsets[i])
+				printf("utf8: segment at %04X is %u bytes, expected %u\n", codepoints[i], (unsigned)used, (unsigned)(offsets[next] - offsets[i]));
+
+			printf("\xC3\xB7 %04X ", codepoints[i]);
+			for (++i; i < next; ++i)
+				printf("\xC3\x97 %04X ", codepoints[i]);
+		}
+		printf("\xC3\xB7\n");
+	}
+
+	fclose(in);
+	return 0;
+}
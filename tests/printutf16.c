@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define MAX_CODEPOINTS 0x110000
+
+static uint16_t *utf16;
+static codepoint_t *all;
+static codepoint_t *codepoints;
+static uint8_t *categories;
+static uint8_t *scripts;
+static ucd_property *properties;
+static ucd_ctype *masks;
+
+static size_t put_utf16c(uint16_t *out, codepoint_t c)
+{
+	if (c < 0x10000)
+	{
+		out[0] = (uint16_t)c;
+		return 1;
+	}
+	out[0] = (uint16_t)(0xD800 | ((c - 0x10000) >> 10));
+	out[1] = (uint16_t)(0xDC00 | (c & 0x3FF));
+	return 2;
+}
+
+/* Check the classification of UTF-16 data against the single codepoint APIs. */
+static void check_utf16(const char *name, const uint16_t *in, size_t len, const codepoint_t *expected, size_t count)
+{
+	size_t n, i, used;
+
+	n = ucd_utf16_lookup_category_n(in, len, categories);
+	if (n != count)
+		printf("%s: category count is %u, expected %u\n", name, (unsigned)n, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (categories[i] != ucd_lookup_category(expected[i]))
+			printf("%s: category of %06X at %u is %s\n", name, expected[i], (unsigned)i,
+			       ucd_get_category_string((ucd_category)categories[i]));
+	}
+
+	n = ucd_utf16_lookup_script_n(in, len, scripts);
+	if (n != count)
+		printf("%s: script count is %u, expected %u\n", name, (unsigned)n, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (scripts[i] != ucd_lookup_script(expected[i]))
+			printf("%s: script of %06X at %u is %s\n", name, expected[i], (unsigned)i,
+			       ucd_get_script_string((ucd_script)scripts[i]));
+	}
+
+	n = ucd_utf16_lookup_properties_n(in, len, properties);
+	if (n != count)
+		printf("%s: properties count is %u, expected %u\n", name, (unsigned)n, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (properties[i] != ucd_lookup_properties(expected[i]))
+			printf("%s: properties of %06X at %u are %016llx\n", name, expected[i], (unsigned)i,
+			       (unsigned long long)properties[i]);
+	}
+
+	n = ucd_utf16_ctype_mask_n(in, len, masks);
+	if (n != count)
+		printf("%s: ctype count is %u, expected %u\n", name, (unsigned)n, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (masks[i] != ucd_ctype_mask(expected[i]))
+			printf("%s: ctype of %06X at %u is %04X\n", name, expected[i], (unsigned)i, masks[i]);
+	}
+
+	n = ucd_utf16_decode(in, len, codepoints, MAX_CODEPOINTS, &used);
+	if (n != count || used != len)
+		printf("%s: decoded %u codepoints from %u code units, expected %u\n", name,
+		       (unsigned)n, (unsigned)used, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (codepoints[i] != expected[i])
+			printf("%s: decoded %06X at %u, expected %06X\n", name, codepoints[i], (unsigned)i, expected[i]);
+	}
+}
+
+/* Check BMP runs of different lengths between surrogate pairs and unpaired
+ * surrogates, so the SIMD and scalar code paths are used at each alignment.
+ */
+static void check_bmp_runs(void)
+{
+	static const codepoint_t others[] = { 0x1F600, 0x10000, 0x10FFFF, 0xD800, 0xDBFF, 0xDC00, 0xDFFF };
+	codepoint_t expected[256];
+	uint16_t in[512];
+	size_t run, other;
+	for (other = 0; other < sizeof(others)/sizeof(others[0]); ++other)
+	{
+		for (run = 0; run <= 40; ++run)
+		{
+			size_t len = 0;
+			size_t count = 0;
+			size_t i;
+			for (i = 0; i < 3; ++i)
+			{
+				size_t j;
+				for (j = 0; j < run; ++j)
+				{
+					static const codepoint_t bmp[] = { 'A', 0xE9, 0x3B1, 0x20AC, 0xD7FF, 0xE000, 0xFFFF };
+					expected[count] = bmp[(count + j) % 7];
+					len += put_utf16c(in + len, expected[count++]);
+				}
+				expected[count] = others[other];
+				len += put_utf16c(in + len, expected[count++]);
+			}
+			check_utf16("bmp-runs", in, len, expected, count);
+		}
+	}
+}
+
+static const struct
+{
+	const char *name;
+	uint16_t in[4];
+	size_t len;
+	codepoint_t expected[4];
+	size_t count;
+} surrogates[] =
+{
+	{ "pair",             { 0xD83D, 0xDE00 },         2, { 0x1F600 },                 1 },
+	{ "high-high",        { 0xD83D, 0xD83D },         2, { 0xD83D, 0xD83D },          2 },
+	{ "high-high-low",    { 0xD83D, 0xD83D, 0xDE00 }, 3, { 0xD83D, 0x1F600 },         2 },
+	{ "low-high",         { 0xDE00, 0xD83D },         2, { 0xDE00, 0xD83D },          2 },
+	{ "high-bmp",         { 0xD83D, 'a' },            2, { 0xD83D, 'a' },             2 },
+	{ "bmp-low",          { 'a', 0xDE00 },            2, { 'a', 0xDE00 },             2 },
+	{ "truncated",        { 'a', 0xD83D },            2, { 'a', 0xD83D },             2 },
+};
+
+int main(void)
+{
+	codepoint_t c;
+	size_t len = 0;
+	size_t count = 0;
+	size_t i;
+
+	utf16 = malloc(MAX_CODEPOINTS * 2 * sizeof(uint16_t));
+	all = malloc(MAX_CODEPOINTS * sizeof(codepoint_t));
+	codepoints = malloc(MAX_CODEPOINTS * sizeof(codepoint_t));
+	categories = malloc(MAX_CODEPOINTS);
+	scripts = malloc(MAX_CODEPOINTS);
+	properties = malloc(MAX_CODEPOINTS * sizeof(ucd_property));
+	masks = malloc(MAX_CODEPOINTS * sizeof(ucd_ctype));
+	if (!utf16 || !all || !codepoints || !categories || !scripts || !properties || !masks)
+		return 1;
+
+	for (i = 0; i < sizeof(surrogates)/sizeof(surrogates[0]); ++i)
+		check_utf16(surrogates[i].name, surrogates[i].in, surrogates[i].len, surrogates[i].expected, surrogates[i].count);
+
+	check_bmp_runs();
+
+	/* The surrogates are encoded as unpaired surrogates. The low surrogates are
+	 * decoded separately, as U+DBFF followed by U+DC00 is a surrogate pair.
+	 */
+	for (c = 0; c <= 0x10FFFF; ++c)
+	{
+		len += put_utf16c(utf16 + len, c);
+		all[count++] = c;
+	}
+	check_utf16("all-before-low-surrogates", utf16, 0xDC00, all, 0xDC00);
+	check_utf16("all-from-low-surrogates", utf16 + 0xDC00, len - 0xDC00, all + 0xDC00, count - 0xDC00);
+
+	/* Print the data for every codepoint in the same format as:
+	 *     printucddata --format="%pH %s %c %P\n"
+	 */
+	ucd_utf16_lookup_script_n(utf16, 0xDC00, scripts);
+	ucd_utf16_lookup_script_n(utf16 + 0xDC00, len - 0xDC00, scripts + 0xDC00);
+	ucd_utf16_lookup_category_n(utf16, 0xDC00, categories);
+	ucd_utf16_lookup_category_n(utf16 + 0xDC00, len - 0xDC00, categories + 0xDC00);
+	ucd_utf16_lookup_properties_n(utf16, 0xDC00, properties);
+	ucd_utf16_lookup_properties_n(utf16 + 0xDC00, len - 0xDC00, properties + 0xDC00);
+	for (i = 0; i < count; ++i)
+	{
+		printf("%06X %s %s %016llx\n", all[i],
+		       ucd_get_script_string((ucd_script)scripts[i]),
+		       ucd_get_category_string((ucd_category)categories[i]),
+		       (unsigned long long)properties[i]);
+	}
+
+	free(utf16);
+	free(all);
+	free(codepoints);
+	free(categories);
+	free(scripts);
+	free(properties);
+	free(masks);
+	return 0;
+}
@@ -0,0 +1,299 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+
+static char *utf8;
+static codepoint_t *all;
+static codepoint_t *codepoints;
+static uint8_t *categories;
+static uint8_t *scripts;
+static ucd_property *properties;
+static ucd_ctype *masks;
+
+/* Check the classification of UTF-8 data against the single codepoint APIs. */
+static void check_utf8(const char *name, const char *in, size_t len, const codepoint_t *expected, size_t count)
+{
+	size_t n, i, used;
+
+	n = ucd_utf8_lookup_category_n(in, len, categories);
+	if (n != count)
+		printf("%s: category count is %u, expected %u\n", name, (unsigned)n, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (categories[i] != ucd_lookup_category(expected[i]))
+			printf("%s: category of %06X at %u is %s\n", name, expected[i], (unsigned)i,
+			       ucd_get_category_string((ucd_category)categories[i]));
+	}
+
+	n = ucd_utf8_lookup_script_n(in, len, scripts);
+	if (n != count)
+		printf("%s: script count is %u, expected %u\n", name, (unsigned)n, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (scripts[i] != ucd_lookup_script(expected[i]))
+			printf("%s: script of %06X at %u is %s\n", name, expected[i], (unsigned)i,
+			       ucd_get_script_string((ucd_script)scripts[i]));
+	}
+
+	n = ucd_utf8_lookup_properties_n(in, len, properties);
+	if (n != count)
+		printf("%s: properties count is %u, expected %u\n", name, (unsigned)n, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (properties[i] != ucd_lookup_properties(expected[i]))
+			printf("%s: properties of %06X at %u are %016llx\n", name, expected[i], (unsigned)i,
+			       (unsigned long long)properties[i]);
+	}
+
+	n = ucd_utf8_ctype_mask_n(in, len, masks);
+	if (n != count)
+		printf("%s: ctype count is %u, expected %u\n", name, (unsigned)n, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (masks[i] != ucd_ctype_mask(expected[i]))
+			printf("%s: ctype of %06X at %u is %04X\n", name, expected[i], (unsigned)i, masks[i]);
+	}
+
+	n = ucd_utf8_decode(in, len, codepoints, MAX_CODEPOINTS, &used);
+	if (n != count || used != len)
+		printf("%s: decoded %u codepoints from %u bytes, expected %u\n", name,
+		       (unsigned)n, (unsigned)used, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (codepoints[i] != expected[i] && (codepoints[i] <= 0x10FFFF || expected[i] <= 0x10FFFF))
+			printf("%s: decoded %06X at %u, expected %06X\n", name, codepoints[i], (unsigned)i, expected[i]);
+	}
+}
+
+/* Check ASCII runs of different lengths between non-ASCII characters, so the
+ * SIMD and scalar code paths are used at each alignment.
+ */
+static void check_ascii_runs(void)
+{
+	static const codepoint_t others[] = { 0xE9, 0x3B1, 0x20AC, 0x1F600 };
+	codepoint_t expected[256];
+	char in[1024];
+	size_t run, other;
+	for (other = 0; other < sizeof(others)/sizeof(others[0]); ++other)
+	{
+		for (run = 0; run <= 70; ++run)
+		{
+			size_t len = 0;
+			size_t count = 0;
+			size_t i;
+			for (i = 0; i < 3; ++i)
+			{
+				size_t j;
+				for (j = 0; j < run; ++j)
+				{
+					expected[count] = "Az 0!\t~"[(count + j) % 7];
+					in[len++] = (char)expected[count++];
+				}
+				expected[count] = others[other];
+				len += put_utf8c(in + len, expected[count++]);
+			}
+			check_utf8("ascii-runs", in, len, expected, count);
+		}
+	}
+}
+
+typedef size_t (*utf8_case_fn)(const char *in, size_t len, char *out, size_t outlen);
+
+/* Check the case conversion of UTF-8 data against the single codepoint APIs. */
+static void check_case(const char *name, utf8_case_fn utf8_convert, codepoint_t (*convert)(codepoint_t c),
+                       const char *in, size_t len, const codepoint_t *expected, size_t count)
+{
+	char *out = malloc(len * 4);
+	size_t outlen, n, i, partial;
+	if (!out)
+		return;
+
+	outlen = utf8_convert(in, len, out, len * 2);
+	n = ucd_utf8_decode(out, outlen, codepoints, MAX_CODEPOINTS, NULL);
+	if (n != count)
+		printf("%s: converted %u codepoints, expected %u\n", name, (unsigned)n, (unsigned)count);
+	for (i = 0; i < n && i < count; ++i)
+	{
+		if (codepoints[i] != convert(expected[i]))
+			printf("%s: converted %06X at %u to %06X\n", name, expected[i], (unsigned)i, codepoints[i]);
+	}
+
+	/* A short out buffer only contains the whole UTF-8 sequences that fit. */
+	memset(out + outlen, 0xFE, outlen / 2 + 16);
+	partial = utf8_convert(in, len, out + outlen, outlen / 2);
+	if (partial != outlen)
+		printf("%s: partial length is %u, expected %u\n", name, (unsigned)partial, (unsigned)outlen);
+	if (memcmp(out, out + outlen, outlen / 2 - 3) != 0)
+		printf("%s: partial conversion differs\n", name);
+	for (i = outlen / 2; i < outlen / 2 + 16; ++i)
+	{
+		if ((uint8_t)out[outlen + i] != 0xFE)
+			printf("%s: partial conversion wrote past the out buffer\n", name);
+	}
+	free(out);
+}
+
+/* Check in-place conversion of text where the converted UTF-8 length does not
+ * change, with ASCII runs long enough to use the SIMD code paths.
+ */
+static void check_case_in_place(void)
+{
+	static const char text[] = "The Quick Brown Fox Jumps Over The Lazy Dog. "
+	                           "CAF\xC3\x89 na\xC3\xAFve \xCE\x9A\xCE\xB1\xCE\xBB\xCE\xB7\xCE\xBC\xCE\xAD\xCF\x81\xCE\xB1 "
+	                           "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 \xE4\xBD\xA0\xE5\xA5\xBD \xF0\x9F\x98\x80 "
+	                           "0123456789 abcdefghijklmnopqrstuvwxyz ABCDEFGHIJKLMNOPQRSTUVWXYZ \x80\xFF";
+	static const utf8_case_fn converters[] = { ucd_utf8_tolower, ucd_utf8_toupper, ucd_utf8_totitle };
+	char expected[sizeof(text)];
+	char in_place[sizeof(text)];
+	size_t i, len;
+	for (i = 0; i < sizeof(converters)/sizeof(converters[0]); ++i)
+	{
+		len = converters[i](text, sizeof(text) - 1, expected, sizeof(expected));
+		memcpy(in_place, text, sizeof(text));
+		if (converters[i](in_place, sizeof(text) - 1, in_place, sizeof(in_place)) != len ||
+		    len != sizeof(text) - 1 || memcmp(expected, in_place, len) != 0)
+			printf("in-place: conversion %u differs\n", (unsigned)i);
+	}
+}
+
+#define X 0xFFFFFFFF /* ill-formed sequence */
+
+static const struct
+{
+	const char *in;
+	codepoint_t expected[8];
+	size_t count;
+} ill_formed[] =
+{
+	{ "\x80", { X }, 1 },
+	{ "a\xBF" "b", { 'a', X, 'b' }, 3 },
+	{ "\xC0\xAF", { X, X }, 2 },               /* overlong '/' */
+	{ "\xC1\xBF", { X, X }, 2 },               /* overlong U+007F */
+	{ "\xE0\x80\xAF", { X, X, X }, 3 },        /* overlong '/' */
+	{ "\xED\xA0\x80", { X, X, X }, 3 },        /* surrogate U+D800 */
+	{ "\xF0\x80\x80\xAF", { X, X, X, X }, 4 }, /* overlong '/' */
+	{ "\xF4\x90\x80\x80", { X, X, X, X }, 4 }, /* U+110000 */
+	{ "\xF5\x80", { X, X }, 2 },
+	{ "\xFF" "a", { X, 'a' }, 2 },
+	{ "\xE2\x82" "a", { X, 'a' }, 2 },         /* truncated U+20AC */
+	{ "\xF0\x9F\x98" "a", { X, 'a' }, 2 },     /* truncated U+1F600 */
+	{ "\xE2\x82", { X }, 1 },                  /* truncated at the end */
+	{ "\xC3\xA9\xC3", { 0xE9, X }, 2 },
+};
+
+/* Check the ill-formed sequences between runs of 2 and 3 byte sequences of
+ * different lengths, so the SIMD code finds them at each offset in a block.
+ */
+static void check_ill_formed_runs(void)
+{
+	static const codepoint_t others[] = { 0x3B1, 0x4E2D };
+	codepoint_t expected[256];
+	char in[1024];
+	size_t i, other, run, j, len, count;
+	for (i = 0; i < sizeof(ill_formed)/sizeof(ill_formed[0]); ++i)
+	{
+		for (other = 0; other < sizeof(others)/sizeof(others[0]); ++other)
+		{
+			for (run = 0; run <= 40; ++run)
+			{
+				len = 0;
+				count = 0;
+				for (j = 0; j < run; ++j)
+				{
+					expected[count] = others[other] + j;
+					len += put_utf8c(in + len, expected[count++]);
+				}
+				memcpy(in + len, ill_formed[i].in, strlen(ill_formed[i].in));
+				len += strlen(ill_formed[i].in);
+				memcpy(expected + count, ill_formed[i].expected, ill_formed[i].count * sizeof(codepoint_t));
+				count += ill_formed[i].count;
+				for (j = 0; j < 40; ++j)
+				{
+					expected[count] = others[other] + j;
+					len += put_utf8c(in + len, expected[count++]);
+				}
+				check_utf8("ill-formed-runs", in, len, expected, count);
+			}
+		}
+	}
+}
+
+int main(void)
+{
+	codepoint_t c;
+	size_t len = 0;
+	size_t count = 0;
+	size_t i;
+
+	utf8 = malloc(MAX_CODEPOINTS * 4);
+	all = malloc(MAX_CODEPOINTS * sizeof(codepoint_t));
+	codepoints = malloc(MAX_CODEPOINTS * sizeof(codepoint_t));
+	categories = malloc(MAX_CODEPOINTS * 4);
+	scripts = malloc(MAX_CODEPOINTS * 4);
+	properties = malloc(MAX_CODEPOINTS * 4 * sizeof(ucd_property));
+	masks = malloc(MAX_CODEPOINTS * 4 * sizeof(ucd_ctype));
+	if (!utf8 || !all || !codepoints || !categories || !scripts || !properties || !masks)
+		return 1;
+
+	for (i = 0; i < sizeof(ill_formed)/sizeof(ill_formed[0]); ++i)
+		check_utf8(ill_formed[i].in, ill_formed[i].in, strlen(ill_formed[i].in), ill_formed[i].expected, ill_formed[i].count);
+
+	check_ascii_runs();
+	check_ill_formed_runs();
+
+	for (c = 0; c <= 0x10FFFF; ++c)
+	{
+		if (c >= 0xD800 && c <= 0xDFFF)
+			continue;
+		len += put_utf8c(utf8 + len, c);
+		all[count++] = c;
+	}
+	check_utf8("all", utf8, len, all, count);
+
+	check_case("tolower", ucd_utf8_tolower, ucd_tolower, utf8, len, all, count);
+	check_case("toupper", ucd_utf8_toupper, ucd_toupper, utf8, len, all, count);
+	check_case("totitle", ucd_utf8_totitle, ucd_totitle, utf8, len, all, count);
+	check_case_in_place();
+
+	/* Print the General Category of every codepoint that can be encoded as
+	 * UTF-8 (i.e. excluding the surrogates) in the same format as:
+	 *     printucddata --format="%pH %c\n"
+	 */
+	count = ucd_utf8_lookup_category_n(utf8, len, categories);
+	ucd_utf8_decode(utf8, len, codepoints, MAX_CODEPOINTS, NULL);
+	for (i = 0; i < count; ++i)
+		printf("%06X %s\n", codepoints[i], ucd_get_category_string((ucd_category)categories[i]));
+
+	free(utf8);
+	free(all);
+	free(codepoints);
+	free(categories);
+	free(scripts);
+	free(properties);
+	free(masks);
+	return 0;
+}
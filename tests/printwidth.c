@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ucd/ucd.h"
+#include "testutil.h"
+
+#include <stdio.h>
+
+#define MAX_CODEPOINTS 0x110000
+#define BLOCK_SIZE 64
+
+static const char *ea_names[] = { "N", "A", "F", "H", "Na", "W" };
+
+static const char ascii[] = "\tThe quick brown fox\r\njumps over the lazy dog. ";
+
+/* Return the number of columns used by a codepoint in ucd_utf8_width. */
+static size_t column_width(codepoint_t c)
+{
+	int width = ucd_wcwidth(c);
+	return width < 0 ? 0 : (size_t)width;
+}
+
+static const char *east_asian_width(codepoint_t c)
+{
+	return ea_names[ucd_lookup_east_asian_width(c)];
+}
+
+/* Check that the bulk lookup gives the same result as looking up the East
+ * Asian Width of each codepoint.
+ */
+static void check_east_asian_width_n(const codepoint_t *codepoints, size_t n)
+{
+	uint8_t values[BULK_SIZE];
+	size_t i;
+	ucd_lookup_east_asian_width_n(codepoints, n, values);
+	for (i = 0; i < n; ++i)
+	{
+		ucd_east_asian_width ea = ucd_lookup_east_asian_width(codepoints[i]);
+		if (ea != values[i])
+			printf("%04X: ucd_lookup_east_asian_width_n is %s, expected %s\n", codepoints[i], ea_names[values[i]], ea_names[ea]);
+	}
+}
+
+/* Check that the width of UTF-8 data is the sum of the widths of the
+ * codepoints, when surrounded by runs of ASCII characters that are processed
+ * 16 bytes at a time.
+ */
+static void check_utf8_width(void)
+{
+	char utf8[(BLOCK_SIZE + 2 * sizeof(ascii)) * 4];
+	codepoint_t c;
+	size_t i, len, expected, width;
+	for (c = 0; c < MAX_CODEPOINTS; c += BLOCK_SIZE)
+	{
+		if (c >= 0xD800 && c <= 0xDFFF)
+			continue;
+		len = 0;
+		expected = 0;
+		for (i = 0; ascii[i] != '\0'; ++i)
+		{
+			utf8[len++] = ascii[i];
+			expected += column_width((codepoint_t)ascii[i]);
+		}
+		for (i = 0; i < BLOCK_SIZE; ++i)
+		{
+			len += put_utf8c(utf8 + len, c + i);
+			expected += column_width(c + i);
+		}
+		for (i = 0; ascii[i] != '\0'; ++i)
+		{
+			utf8[len++] = ascii[i];
+			expected += column_width((codepoint_t)ascii[i]);
+		}
+		width = ucd_utf8_width(utf8, len);
+		if (width != expected)
+			printf("%04X..%04X: ucd_utf8_width is %u, expected %u\n", c, c + BLOCK_SIZE - 1, (unsigned)width, (unsigned)expected);
+	}
+	if ((width = ucd_utf8_width("a\xC0\x80\xE4\xB8", 5)) != 4)
+		printf("ill-formed UTF-8: ucd_utf8_width is %u, expected 4\n", (unsigned)width);
+}
+
+/* Print the East Asian Width of all the codepoints in the same format as the
+ * EastAsianWidth.txt file, with the adjacent ranges that have the same value
+ * merged, and check the bulk lookup and display width functions.
+ */
+int main(void)
+{
+	print_ranges(east_asian_width);
+	if (ucd_lookup_east_asian_width(0x110000) != UCD_EAST_ASIAN_WIDTH_N)
+		printf("110000: ucd_lookup_east_asian_width is not N\n");
+
+	check_bulk(check_east_asian_width_n);
+	check_utf8_width();
+	return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "testutil.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define MAX_CODEPOINTS 0x110000
+
+size_t put_utf8c(char *out, codepoint_t c)
+{
+	if (c < 0x80)
+	{
+		out[0] = (char)c;
+		return 1;
+	}
+	if (c < 0x800)
+	{
+		out[0] = (char)(0xC0 | (c >> 6));
+		out[1] = (char)(0x80 | (c & 0x3F));
+		return 2;
+	}
+	if (c < 0x10000)
+	{
+		out[0] = (char)(0xE0 | (c >> 12));
+		out[1] = (char)(0x80 | ((c >> 6) & 0x3F));
+		out[2] = (char)(0x80 | (c & 0x3F));
+		return 3;
+	}
+	out[0] = (char)(0xF0 | (c >> 18));
+	out[1] = (char)(0x80 | ((c >> 12) & 0x3F));
+	out[2] = (char)(0x80 | ((c >> 6) & 0x3F));
+	out[3] = (char)(0x80 | (c & 0x3F));
+	return 4;
+}
+
+static void print_range(codepoint_t first, codepoint_t last, const char *value)
+{
+	if (first == last)
+		printf("%04X;%s\n", first, value);
+	else
+		printf("%04X..%04X;%s\n", first, last, value);
+}
+
+void print_ranges(property_fn property)
+{
+	char previous[256];
+	const char *value;
+	codepoint_t first = 0, c;
+	int has_value = 0;
+
+	for (c = 0; c < MAX_CODEPOINTS; ++c)
+	{
+		value = property(c);
+		if (has_value && value && !strcmp(value, previous))
+			continue;
+		if (has_value)
+			print_range(first, c - 1, previous);
+		has_value = value != NULL;
+		if (has_value)
+		{
+			strncpy(previous, value, sizeof(previous) - 1);
+			previous[sizeof(previous) - 1] = '\0';
+			first = c;
+		}
+	}
+	if (has_value)
+		print_range(first, c - 1, previous);
+}
+
+void check_bulk(bulk_fn check)
+{
+	static codepoint_t codepoints[BULK_SIZE];
+	codepoint_t first;
+	size_t i;
+	for (first = 0; first < MAX_CODEPOINTS; first += BULK_SIZE)
+	{
+		for (i = 0; i < BULK_SIZE; ++i)
+			codepoints[i] = first + i;
+		check(codepoints, BULK_SIZE);
+	}
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Helper functions shared by the test programs. */
+
+#ifndef UCD_TESTS_TESTUTIL_H
+#define UCD_TESTS_TESTUTIL_H
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+/* The number of codepoints passed to a bulk check function at a time. */
+#define BULK_SIZE 4096
+
+/* Write the codepoint to out as UTF-8, returning the number of bytes used. */
+size_t put_utf8c(char *out, codepoint_t c);
+
+/* Return the property value of a codepoint as a string, or NULL if the
+ * codepoint does not have the (binary) property. The string can be in a
+ * static buffer that is overwritten by the next call.
+ */
+typedef const char *(*property_fn)(codepoint_t c);
+
+/* Print the ranges of codepoints that have the same property value, from
+ * U+0000 to U+10FFFF, in the "0000..001F;value" format of the UCD data files.
+ * The codepoints that do not have the property are not printed.
+ */
+void print_ranges(property_fn property);
+
+/* Check the bulk lookup functions against the single codepoint versions. */
+typedef void (*bulk_fn)(const codepoint_t *codepoints, size_t n);
+
+/* Call check with each BULK_SIZE block of codepoints from U+0000 to U+10FFFF. */
+void check_bulk(bulk_fn check);
+
+#endif
@@ -0,0 +1,234 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+def age_alias(age):
+	return 'V%s' % age.replace('.', '_')
+
+unicode_chars = {}
+ages = set()
+for data in ucd.parse_ucd_data(ucd_rootdir, 'DerivedAge'):
+	for codepoint in data['Range']:
+		unicode_chars[codepoint] = age_alias(data['Age'])
+	ages.add(data['Age'])
+
+# The ages in version order, followed by NA for the unassigned codepoints.
+age_list = [age_alias(age) for age in sorted(ages, key=lambda age: [int(x) for x in age.split('.')])] + ['NA']
+
+# This map is a combination of the information in the DerivedAge and Blocks
+# data files. It is intended to reduce the number of age tables that need to
+# be generated.
+age_sets = [
+	(ucd.CodeRange('000000..00D7FF'), None,   'Multiple Blocks'),
+	(ucd.CodeRange('00D800..00DFFF'), 'V2_0', 'Surrogates'),
+	(ucd.CodeRange('00E000..00F7FF'), 'V1_1', 'Private Use Area'),
+	(ucd.CodeRange('00F800..02FAFF'), None,   'Multiple Blocks'),
+	(ucd.CodeRange('02FB00..0DFFFF'), 'NA',   'Unassigned'),
+	(ucd.CodeRange('0E0000..0E01FF'), None,   'Multiple Blocks'),
+	(ucd.CodeRange('0E0200..0EFFFF'), 'NA',   'Unassigned'),
+	(ucd.CodeRange('0F0000..10FFFF'), 'V2_0', 'Plane 15/16 Private Use'),
+]
+
+# The noncharacters at the end of each plane (U+nFFFE and U+nFFFF) can have a
+# different age to the rest of a codepoint range.
+noncharacter_ages = {}
+for codepoints, age, comment in age_sets:
+	if not age:
+		continue
+	for codepoint in codepoints:
+		value = unicode_chars.get(codepoint, 'NA')
+		if value == age:
+			continue
+		if (codepoint.codepoint & 0xFFFE) != 0xFFFE:
+			raise Exception('%s: the age is %s, not %s' % (codepoint, value, age))
+		if noncharacter_ages.get(str(codepoints), value) != value:
+			raise Exception('%s: the noncharacters have different ages' % codepoints)
+		noncharacter_ages[str(codepoints)] = value
+
+# These ages have many pages consisting of just this age:
+special_ages = []
+
+age_tables = {}
+for codepoints, age, comment in age_sets:
+	if not age:
+		table = {}
+		table_entry = None
+		table_codepoint = None
+		table_age = None
+		for i, codepoint in enumerate(codepoints):
+			try:
+				age = unicode_chars[codepoint]
+			except KeyError:
+				age = 'NA' # Unassigned
+			if (i % 256) == 0:
+				if table_entry:
+					if table_age in special_ages:
+						table[table_codepoint] = table_age
+					elif table_age:
+						special_ages.append(table_age)
+						table[table_codepoint] = table_age
+					else:
+						table[table_codepoint] = table_entry
+				table_entry = []
+				table_codepoint = codepoint
+				table_age = age
+			if age != table_age:
+				table_age = None
+			table_entry.append(age)
+		if table_entry:
+			if table_age in special_ages:
+				table[table_codepoint] = table_age
+			elif table_age:
+				special_ages.append(table_age)
+				table[table_codepoint] = table_age
+			else:
+				table[table_codepoint] = table_entry
+		age_tables['%s_%s' % (codepoints.first, codepoints.last)] = table
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Age
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the DerivedAge.txt file in
+ * the Unicode Character database by the ucd-tools/tools/age.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+""")
+	for age in age_list:
+		sys.stdout.write("""#define %s UCD_AGE_%s
+""" % (age, age))
+	sys.stdout.write("""
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	for age in special_ages:
+		sys.stdout.write('\n')
+		sys.stdout.write('static const uint8_t ages_%s[256] =\n' % age)
+		sys.stdout.write('{')
+		for i in range(0, 256):
+			if (i % 16) == 0:
+				sys.stdout.write('\n\t/* %02X */' % i)
+			sys.stdout.write(' %s,' % age)
+		sys.stdout.write('\n};\n')
+
+	for codepoints, age, comment in age_sets:
+		if not age:
+			tables = age_tables['%s_%s' % (codepoints.first, codepoints.last)]
+			for codepoint in sorted(tables.keys()):
+				table = tables[codepoint]
+				if table in special_ages:
+					continue
+
+				sys.stdout.write('\n')
+				sys.stdout.write('static const uint8_t ages_%s[256] =\n' % codepoint)
+				sys.stdout.write('{')
+				for i, age in enumerate(table):
+					if (i % 16) == 0:
+						sys.stdout.write('\n\t/* %02X */' % i)
+					sys.stdout.write(' %s,' % age)
+				sys.stdout.write('\n};\n')
+
+	for codepoints, age, comment in age_sets:
+		if not age:
+			table_index = '%s_%s' % (codepoints.first, codepoints.last)
+			sys.stdout.write('\n')
+			sys.stdout.write('static const uint8_t *ages_%s[] =\n' % table_index)
+			sys.stdout.write('{\n')
+			for codepoint, table in sorted(age_tables[table_index].items()):
+				if isinstance(table, str):
+					sys.stdout.write('\tages_%s, /* %s */\n' % (table, codepoint))
+				else:
+					sys.stdout.write('\tages_%s,\n' % codepoint)
+			sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static ucd_age lookup_age(codepoint_t c)\n')
+	sys.stdout.write('{\n')
+	for codepoints, age, comment in age_sets:
+		if age and str(codepoints) in noncharacter_ages:
+			sys.stdout.write('\tif (c <= 0x%s) /* %s : %s */\n' % (codepoints.last, codepoints, comment))
+			sys.stdout.write('\t\treturn (c & 0xFFFE) == 0xFFFE ? %s : %s; /* Noncharacters */\n' % (noncharacter_ages[str(codepoints)], age))
+		elif age:
+			sys.stdout.write('\tif (c <= 0x%s) return %s; /* %s : %s */\n' % (codepoints.last, age, codepoints, comment))
+		else:
+			sys.stdout.write('\tif (c <= 0x%s) /* %s */\n' % (codepoints.last, codepoints))
+			sys.stdout.write('\t{\n')
+			sys.stdout.write('\t\tconst uint8_t *table = ages_%s_%s[(c - 0x%s) / 256];\n' % (codepoints.first, codepoints.last, codepoints.first))
+			sys.stdout.write('\t\treturn (ucd_age)table[c % 256];\n')
+			sys.stdout.write('\t}\n')
+	sys.stdout.write('\treturn NA; /* Invalid Unicode Codepoint */\n')
+	sys.stdout.write('}\n')
+
+	sys.stdout.write("""
+ucd_age ucd_lookup_age(codepoint_t c)
+{
+	return lookup_age(c);
+}
+
+void ucd_lookup_age_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint8_t)lookup_age(in[i]);
+}
+
+ucd_age ucd_max_age_n(const codepoint_t *in, size_t n, ucd_age limit)
+{
+	ucd_age max_age = V1_1;
+	size_t i;
+	for (i = 0; i < n; ++i)
+	{
+		ucd_age age = in[i] < 0x80 ? V1_1 : lookup_age(in[i]);
+		if (age > max_age)
+		{
+			max_age = age;
+			if (max_age > limit)
+				break;
+		}
+	}
+	return max_age;
+}
+""")
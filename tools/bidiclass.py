@@ -0,0 +1,176 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+# The Bidi_Class values in ucd_bidi_class order. The default value (L) is first.
+bc_values = [
+	'L', 'AL', 'AN', 'B', 'BN', 'CS', 'EN', 'ES', 'ET', 'FSI', 'LRE', 'LRI',
+	'LRO', 'NSM', 'ON', 'PDF', 'PDI', 'R', 'RLE', 'RLI', 'RLO', 'S', 'WS'
+]
+
+# The Bidi_Paired_Bracket_Type values in ucd_bidi_paired_bracket_type order.
+bpt_values = ['n', 'o', 'c']
+
+# DerivedBidiClass.txt is used instead of the UnicodeData.txt field, as it
+# also lists the default values of the unassigned codepoints (e.g. R for the
+# unassigned codepoints in the Hebrew block).
+bidi_class = {}
+for data in ucd.parse_ucd_data(os.path.join(ucd_rootdir, 'extracted'), 'DerivedBidiClass'):
+	value = bc_values.index(data['Value'])
+	for codepoint in data['Range']:
+		bidi_class[codepoint.codepoint] = value
+
+brackets = []
+for data in ucd.parse_ucd_data(ucd_rootdir, 'BidiBrackets'):
+	c = data['CodePoint'].codepoint
+	bidi_class[c] = bidi_class.get(c, 0) | (bpt_values.index(data['Type']) << 5)
+	brackets.append((c, data['PairedBracket'].codepoint))
+brackets.sort()
+
+# The Bidi_Class (low 5 bits) and Bidi_Paired_Bracket_Type (high 3 bits) are
+# stored in 256 codepoint pages. Identical pages are only stored once.
+page_list = []
+page_index = {}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = tuple([bidi_class.get(c, 0) for c in range(page, page + 256)])
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Bidi Class
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the DerivedBidiClass.txt
+ * and BidiBrackets.txt files in the Unicode Character database by the
+ * ucd-tools/tools/bidiclass.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The Bidi_Class (low 5 bits) and Bidi_Paired_Bracket_Type (high 3 bits) of\n')
+	sys.stdout.write(' * each codepoint.\n')
+	sys.stdout.write(' */\n')
+	sys.stdout.write('static const uint8_t bidi_class_pages[][256] =\n')
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s bidi_class_index[] =\n' % c_type(len(page_list)))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The (codepoint, Bidi_Paired_Bracket) pairs, in codepoint order. */\n')
+	sys.stdout.write('static const codepoint_t paired_brackets[][2] =\n')
+	sys.stdout.write('{\n')
+	for c, paired in brackets:
+		sys.stdout.write('\t{ 0x%06X, 0x%06X },\n' % (c, paired))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write("""
+static uint8_t lookup_bidi_entry(codepoint_t c)
+{
+	if (c > 0x10FFFF) return UCD_BIDI_CLASS_L; /* Invalid Unicode Codepoint */
+	return bidi_class_pages[bidi_class_index[c / 256]][c % 256];
+}
+
+ucd_bidi_class ucd_lookup_bidi_class(codepoint_t c)
+{
+	return (ucd_bidi_class)(lookup_bidi_entry(c) & 0x1F);
+}
+
+void ucd_lookup_bidi_class_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = lookup_bidi_entry(in[i]) & 0x1F;
+}
+
+ucd_bidi_paired_bracket_type ucd_lookup_bidi_paired_bracket_type(codepoint_t c)
+{
+	return (ucd_bidi_paired_bracket_type)(lookup_bidi_entry(c) >> 5);
+}
+
+codepoint_t ucd_lookup_bidi_paired_bracket(codepoint_t c)
+{
+	size_t begin = 0;
+	size_t end = sizeof(paired_brackets)/sizeof(paired_brackets[0]);
+	if ((lookup_bidi_entry(c) >> 5) == UCD_BIDI_PAIRED_BRACKET_TYPE_NONE)
+		return c;
+	while (begin < end)
+	{
+		size_t pos = (begin + end) / 2;
+		if (c < paired_brackets[pos][0])
+			end = pos;
+		else if (c > paired_brackets[pos][0])
+			begin = pos + 1;
+		else
+			return paired_brackets[pos][1];
+	}
+	return c;
+}
+""")
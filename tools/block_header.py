@@ -0,0 +1,80 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+
+import sys
+import ucd
+import blocks
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Character Database API : Block Codes
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef UNICODE_CHARACTER_DATA_BLOCKS_H
+#define UNICODE_CHARACTER_DATA_BLOCKS_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** @brief Unicode Block
+  *
+  * The blocks are in codepoint order, using the Block property value aliases.
+  *
+  * @see   http://www.unicode.org/reports/tr44/
+  */
+typedef enum ucd_block_
+{
+""")
+	for alias, name in blocks.blocks:
+		sys.stdout.write("""	UCD_BLOCK_%s, /**< @brief %s */
+""" % (alias, name))
+	sys.stdout.write("""} ucd_block;
+
+/** @brief The number of ucd_block values.
+  */
+#define UCD_BLOCK_COUNT %d
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+""" % len(blocks.blocks))
@@ -0,0 +1,160 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+# The block boundaries are 16 codepoint aligned, so the blocks are stored for
+# each 16 codepoint unit.
+unit_size = 16
+
+def loose_name(name):
+	return name.lower().replace(' ', '').replace('-', '').replace('_', '')
+
+block_aliases = ucd.parse_property_mapping(ucd_rootdir, 'blk')
+loose_aliases = dict([(loose_name(name), alias) for alias, name in block_aliases.items()])
+
+# The (alias, name) of each block in codepoint order, starting with No_Block
+# for the codepoints that are not in a block.
+blocks = [('NB', 'No Block')]
+unit_blocks = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'Blocks'):
+	first = data['Range'].first.codepoint
+	last  = data['Range'].last.codepoint
+	if (first % unit_size) != 0 or ((last + 1) % unit_size) != 0:
+		raise Exception('%s: the block is not %d codepoint aligned' % (data['Range'], unit_size))
+	if not loose_name(data['Name']) in loose_aliases:
+		raise Exception('%s: no property value alias for the %s block' % (data['Range'], data['Name']))
+	for unit in range(first // unit_size, (last + 1) // unit_size):
+		unit_blocks[unit] = len(blocks)
+	blocks.append((loose_aliases[loose_name(data['Name'])], data['Name']))
+
+# The blocks are stored in pages of 16 units (256 codepoints). Identical pages
+# are only stored once, so all the pages where no codepoint is in a block share
+# the first page.
+units_per_page = 256 // unit_size
+page_list = [(0, tuple([0] * units_per_page))]
+page_index = {page_list[0][1]: 0}
+pages = []
+for page in range(0, 0x110000 // unit_size, units_per_page):
+	entries = tuple([unit_blocks.get(unit, 0) for unit in range(page, page + units_per_page)])
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page * unit_size, entries))
+	pages.append(page_index[entries])
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Blocks
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the Blocks.txt file in the
+ * Unicode Character database by the ucd-tools/tools/blocks.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The block (ucd_block) of each 16 codepoint unit in a 256 codepoint page. */\n')
+	sys.stdout.write('static const %s block_pages[][%d] =\n' % (c_type(len(blocks)), units_per_page))
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		if i == 0:
+			sys.stdout.write('\t/* %d : No_Block */' % i)
+		else:
+			sys.stdout.write('\t/* %d : %06X */' % (i, page))
+		sys.stdout.write(' {')
+		for entry in entries:
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write(' },\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s block_index[] =\n' % c_type(len(page_list)))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write("""
+ucd_block ucd_lookup_block(codepoint_t c)
+{
+	if (c > 0x10FFFF) /* Invalid Unicode Codepoint */
+		return UCD_BLOCK_NB;
+	return (ucd_block)block_pages[block_index[c / 256]][(c % 256) / 16];
+}
+
+void ucd_lookup_block_n(const codepoint_t *in, size_t n, uint16_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint16_t)ucd_lookup_block(in[i]);
+}
+
+void ucd_count_blocks(const codepoint_t *in, size_t n, size_t *counts)
+{
+	codepoint_t unit = UCD_INVALID_CODEPOINT;
+	ucd_block block = UCD_BLOCK_NB;
+	size_t i;
+	for (i = 0; i < n; ++i)
+	{
+		/* Text mostly uses codepoints that are close together, so only lookup
+		 * the block when the codepoint is in a different 16 codepoint unit.
+		 */
+		if (in[i] / 16 != unit)
+		{
+			unit = in[i] / 16;
+			block = ucd_lookup_block(in[i]);
+		}
+		++counts[block];
+	}
+}
+""")
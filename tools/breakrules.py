@@ -0,0 +1,214 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+# Helpers for compiling the UAX #14 and UAX #29 break rules into a state table.
+
+import sys
+import textwrap
+import ucd
+
+# The break actions for a state transition.
+CONTINUE      = 0 # There is no break before the codepoint.
+BREAK         = 1 # There is a break before the codepoint.
+MARK          = 2 # Mark the codepoint, as the break before it depends on the following codepoints.
+BREAK_AT_MARK = 3 # There is a break before the marked codepoint.
+
+# Store the break classes in 256 codepoint pages. Identical pages (e.g. pages
+# where all codepoints have the Other value) are only stored once.
+def break_pages(values):
+	page_list = []
+	page_index = {}
+	pages = []
+	for page in range(0, 0x110000, 256):
+		entries = tuple([values.get(codepoint, 0) for codepoint in ucd.CodeRange('%06X..%06X' % (page, page + 255))])
+		if not entries in page_index:
+			page_index[entries] = len(page_list)
+			page_list.append((page, entries))
+		pages.append(page_index[entries])
+	return page_list, pages
+
+# Compile the break rules into a state table.
+#
+# The rules are described by a transition function that takes a rule state
+# (any hashable value) and a break class, and returns the break action and the
+# next rule state. The rule states reachable from the start state are then
+# merged where they have the same actions and equivalent next states.
+#
+# A state is pending if a codepoint has been marked, and the following
+# codepoints determine whether there is a break before the marked codepoint.
+# The pending states are numbered after the other states.
+#
+# Returns a (transitions, first pending state) tuple, where transitions is a
+# list of (action, next state) lists for each state and break class.
+def compile_states(start, classes, transition, is_pending):
+	states = [start]
+	state_index = {start: 0}
+	rules = []
+	i = 0
+	while i < len(states):
+		row = []
+		for cls in classes:
+			action, target = transition(states[i], cls)
+			if not target in state_index:
+				state_index[target] = len(states)
+				states.append(target)
+			row.append((action, state_index[target]))
+		rules.append(row)
+		i = i + 1
+
+	pending_states = [is_pending(state) for state in states]
+	block = [int(state_pending) for state_pending in pending_states]
+	count = len(set(block))
+	while True:
+		numbering = {}
+		signatures = []
+		for i, row in enumerate(rules):
+			signature = (block[i], tuple([(action, block[target]) for action, target in row]))
+			if not signature in numbering:
+				numbering[signature] = len(numbering)
+			signatures.append(numbering[signature])
+		block = signatures
+		if len(numbering) == count:
+			break
+		count = len(numbering)
+
+	block_pending = {}
+	for i, state_pending in enumerate(pending_states):
+		block_pending[block[i]] = state_pending
+	order = sorted(range(count), key=lambda b: (block_pending[b], b))
+	numbering = dict([(b, i) for i, b in enumerate(order)])
+	transitions = [None] * count
+	for i, row in enumerate(rules):
+		index = numbering[block[i]]
+		if transitions[index] is None:
+			transitions[index] = [(action, numbering[block[target]]) for action, target in row]
+	pending = len([b for b in order if not block_pending[b]])
+	return transitions, pending
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
+
+def write_pages(name, page_list, pages):
+	sys.stdout.write('\n')
+	sys.stdout.write('static const uint8_t %s_pages[][256] =\n' % name)
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s %s_index[] =\n' % (c_type(len(page_list)), name))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+def write_actions(pending):
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The break actions for a state transition. */\n')
+	sys.stdout.write('#define CONTINUE      %d /* There is no break before the codepoint. */\n' % CONTINUE)
+	sys.stdout.write('#define BREAK         %d /* There is a break before the codepoint. */\n' % BREAK)
+	sys.stdout.write('#define MARK          %d /* The break before the codepoint depends on the following codepoints. */\n' % MARK)
+	sys.stdout.write('#define BREAK_AT_MARK %d /* There is a break before the marked codepoint. */\n' % BREAK_AT_MARK)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The states from this state onwards have a marked codepoint that is waiting\n')
+	sys.stdout.write(' * for the following codepoints to determine if there is a break before it.\n')
+	sys.stdout.write(' */\n')
+	sys.stdout.write('#define PENDING %d\n' % pending)
+
+def write_states(name, classes, transitions, rules='UAX #29'):
+	if len(transitions) > 64:
+		raise Exception('%s: %d states do not fit in the transition table' % (name, len(transitions)))
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The state transitions for each state and break class. The low 6 bits are\n')
+	sys.stdout.write(' * the next state, and the high 2 bits are the break action.\n')
+	sys.stdout.write(' *\n')
+	sys.stdout.write(' * This table is compiled from the %s rules by the\n' % rules)
+	sys.stdout.write(' * ucd-tools/tools/breakrules.py script.\n')
+	sys.stdout.write(' *\n')
+	for line in textwrap.wrap('The columns are the %s break classes.' % ', '.join(classes), 76):
+		sys.stdout.write(' * %s\n' % line)
+	sys.stdout.write(' */\n')
+	sys.stdout.write('static const uint8_t %s_states[][%d] =\n' % (name, len(classes)))
+	sys.stdout.write('{\n')
+	for i, row in enumerate(transitions):
+		values = ['0x%02X' % ((action << 6) | target) for action, target in row]
+		sys.stdout.write('\t/* %2d */ { %s },\n' % (i, ', '.join(values)))
+	sys.stdout.write('};\n')
+
+def write_iterators(name, segment):
+	sys.stdout.write("""
+size_t ucd_utf32_next_%(segment)s(const codepoint_t *in, size_t n)
+{
+	size_t i, mark = 0;
+	uint8_t state, transition;
+	if (n == 0)
+		return 0;
+	state = %(name)s_states[0][lookup_break_class(in[0])] & 0x3F;
+	for (i = 1; i < n; ++i)
+	{
+		transition = %(name)s_states[state][lookup_break_class(in[i])];
+		state = transition & 0x3F;
+		switch (transition >> 6)
+		{
+		case BREAK:         return i;
+		case MARK:          mark = i; break;
+		case BREAK_AT_MARK: return mark;
+		}
+	}
+	return state >= PENDING ? mark : n;
+}
+
+size_t ucd_utf8_next_%(segment)s(const char *in, size_t len)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	size_t i, used, mark = 0;
+	uint8_t state, transition;
+	codepoint_t c;
+	if (len == 0)
+		return 0;
+	i = utf8_decode(p, len, &c);
+	state = %(name)s_states[0][lookup_break_class(c)] & 0x3F;
+	while (i < len)
+	{
+		used = utf8_decode(p + i, len - i, &c);
+		transition = %(name)s_states[state][lookup_break_class(c)];
+		state = transition & 0x3F;
+		switch (transition >> 6)
+		{
+		case BREAK:         return i;
+		case MARK:          mark = i; break;
+		case BREAK_AT_MARK: return mark;
+		}
+		i += used;
+	}
+	return state >= PENDING ? mark : len;
+}
+""" % { 'name': name, 'segment': segment })
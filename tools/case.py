@@ -1,6 +1,6 @@
 #!/usr/bin/python
 
-# Copyright (C) 2012-2018, 2021 Reece H. Dunn
+# Copyright (C) 2012-2018, 2021, 2026 Reece H. Dunn
 #
 # This file is part of ucd-tools.
 #
@@ -20,20 +20,68 @@
 import os
 import sys
 import ucd
+import specialcasing
 
 ucd_rootdir = sys.argv[1]
 ucd_version = sys.argv[2]
 
-unicode_chars = {}
 null = ucd.CodePoint('0000')
+
+# The case mappings are stored as (upper, lower, title) deltas from the
+# codepoint, so characters in the same block typically share the same entry
+# (e.g. all ASCII upper-case letters have the deltas (0, 32, 0)).
+case_deltas = {}
 for data in ucd.parse_ucd_data(ucd_rootdir, 'UnicodeData'):
 	if data['LowerCase'] != null or data['UpperCase'] != null or data['TitleCase'] != null:
-		unicode_chars[data['CodePoint']] = (data['LowerCase'], data['UpperCase'], data['TitleCase'])
+		codepoint = data['CodePoint']
+		deltas = []
+		for case in ['UpperCase', 'LowerCase', 'TitleCase']:
+			if data[case] == null:
+				deltas.append(0)
+			else:
+				deltas.append(data[case].codepoint - codepoint.codepoint)
+		case_deltas[codepoint] = tuple(deltas)
+
+# The codepoints with a SpecialCasing.txt mapping are flagged, so the full case
+# mapping functions only need to search the special casing table for those.
+for codepoint in specialcasing.special_casing.keys():
+	case_deltas[codepoint] = case_deltas.get(codepoint, (0, 0, 0))[0:3] + (1,)
+for codepoint, deltas in case_deltas.items():
+	if len(deltas) == 3:
+		case_deltas[codepoint] = deltas + (0,)
+
+# The first entry is used for codepoints that do not have a case mapping.
+delta_list = [(0, 0, 0, 0)]
+delta_index = {(0, 0, 0, 0): 0}
+
+# The delta indices are stored in 256 codepoint pages. Identical pages (e.g.
+# pages without any case mappings) are only stored once.
+page_list = []
+page_index = {}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = []
+	for codepoint in ucd.CodeRange('%06X..%06X' % (page, page + 255)):
+		deltas = case_deltas.get(codepoint, (0, 0, 0, 0))
+		if not deltas in delta_index:
+			delta_index[deltas] = len(delta_list)
+			delta_list.append(deltas)
+		entries.append(delta_index[deltas])
+	entries = tuple(entries)
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
 
 if __name__ == '__main__':
 	sys.stdout.write("""/* Unicode Case Conversion
  *
- * Copyright (C) 2012-2018, 2021 Reece H. Dunn
+ * Copyright (C) 2012-2018, 2021, 2026 Reece H. Dunn
  *
  * This file is part of ucd-tools.
  *
@@ -56,44 +104,118 @@ if __name__ == '__main__':
  */
 
 #include "ucd/ucd.h"
+#include "latin1.h"
+#include "specialcasing.h"
 
 #include <stddef.h>
 
 /* Unicode Character Data %s */
-
-struct case_conversion_entry
-{
-	codepoint_t codepoint;
-	codepoint_t uppercase;
-	codepoint_t lowercase;
-	codepoint_t titlecase;
-};
 """ % ucd_version)
 
 	sys.stdout.write('\n')
-	sys.stdout.write('static const struct case_conversion_entry case_conversion_data[] =\n')
+	sys.stdout.write('static const int32_t case_deltas[][4] = /* upper, lower, title, special casing */\n')
+	sys.stdout.write('{\n')
+	for i, (upper, lower, title, special) in enumerate(delta_list):
+		sys.stdout.write('\t/* %3d */ { %d, %d, %d, %d },\n' % (i, upper, lower, title, special))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s case_pages[][256] =\n' % c_type(len(delta_list)))
 	sys.stdout.write('{\n')
-	for codepoint in sorted(unicode_chars.keys()):
-		lower, upper, title = unicode_chars[codepoint]
-		sys.stdout.write('\t{ 0x%s, 0x%s, 0x%s, 0x%s },\n' % (codepoint, upper, lower, title))
+	for i, (page, entries) in enumerate(page_list):
+		sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
 	sys.stdout.write('};\n')
 
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s case_index[] =\n' % c_type(len(page_list)))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	for i, case in enumerate(['upper', 'lower', 'title']):
+		sys.stdout.write('\n')
+		sys.stdout.write('static codepoint_t lookup_to%s(codepoint_t c)\n' % case)
+		sys.stdout.write('{\n')
+		sys.stdout.write('\tif (c <= 0xFF) return ucd_latin1_data[c].%s;\n' % case)
+		sys.stdout.write('\tif (c > 0x10FFFF) return c; /* Invalid Unicode Codepoint */\n')
+		sys.stdout.write('\treturn (codepoint_t)(c + case_deltas[case_pages[case_index[c / 256]][c %% 256]][%d]);\n' % i)
+		sys.stdout.write('}\n')
+
 	for case in ['upper', 'lower', 'title']:
 		sys.stdout.write('\n')
 		sys.stdout.write('codepoint_t ucd_to%s(codepoint_t c)\n' % case)
 		sys.stdout.write('{\n')
-		sys.stdout.write('\tint begin = 0;\n')
-		sys.stdout.write('\tint end   = sizeof(case_conversion_data)/sizeof(case_conversion_data[0]) - 1;\n')
-		sys.stdout.write('\twhile (begin <= end)\n')
+		sys.stdout.write('\treturn lookup_to%s(c);\n' % case)
+		sys.stdout.write('}\n')
+		sys.stdout.write('\n')
+		sys.stdout.write('void ucd_to%s_n(const codepoint_t *in, size_t n, codepoint_t *out)\n' % case)
+		sys.stdout.write('{\n')
+		sys.stdout.write('\tsize_t i;\n')
+		sys.stdout.write('\tfor (i = 0; i < n; ++i)\n')
+		sys.stdout.write('\t\tout[i] = lookup_to%s(in[i]);\n' % case)
+		sys.stdout.write('}\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static int has_special_casing(codepoint_t c)\n')
+	sys.stdout.write('{\n')
+	sys.stdout.write('\tif (c > 0x10FFFF) return 0; /* Invalid Unicode Codepoint */\n')
+	sys.stdout.write('\treturn case_deltas[case_pages[case_index[c / 256]][c % 256]][3];\n')
+	sys.stdout.write('}\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static size_t copy_mapping(const uint16_t *mapping, codepoint_t *out)\n')
+	sys.stdout.write('{\n')
+	sys.stdout.write('\tsize_t n;\n')
+	sys.stdout.write('\tfor (n = 0; n < UCD_MAX_FULL_CASE_MAPPING && mapping[n] != 0; ++n)\n')
+	sys.stdout.write('\t\tout[n] = mapping[n];\n')
+	sys.stdout.write('\treturn n;\n')
+	sys.stdout.write('}\n')
+
+	for case in ['upper', 'lower', 'title']:
+		sys.stdout.write('\n')
+		sys.stdout.write('static size_t lookup_to%s_full(codepoint_t c, codepoint_t *out)\n' % case)
+		sys.stdout.write('{\n')
+		sys.stdout.write('\tif (has_special_casing(c))\n')
+		sys.stdout.write('\t\treturn copy_mapping(ucd_lookup_special_casing(c)->%s, out);\n' % case)
+		sys.stdout.write('\tout[0] = lookup_to%s(c);\n' % case)
+		sys.stdout.write('\treturn 1;\n')
+		sys.stdout.write('}\n')
+
+	for case in ['upper', 'lower', 'title']:
+		sys.stdout.write('\n')
+		sys.stdout.write('size_t ucd_to%s_full(codepoint_t c, codepoint_t *out)\n' % case)
+		sys.stdout.write('{\n')
+		sys.stdout.write('\treturn lookup_to%s_full(c, out);\n' % case)
+		sys.stdout.write('}\n')
+		sys.stdout.write('\n')
+		sys.stdout.write('size_t ucd_to%s_full_n(const codepoint_t *in, size_t n, codepoint_t *out, size_t outlen)\n' % case)
+		sys.stdout.write('{\n')
+		sys.stdout.write('\tcodepoint_t mapping[UCD_MAX_FULL_CASE_MAPPING];\n')
+		sys.stdout.write('\tsize_t i, j, m;\n')
+		sys.stdout.write('\tsize_t o = 0;\n')
+		sys.stdout.write('\tfor (i = 0; i < n; ++i)\n')
 		sys.stdout.write('\t{\n')
-		sys.stdout.write('\t\tint pos = (begin + end) / 2;\n')
-		sys.stdout.write('\t\tconst struct case_conversion_entry *item = (case_conversion_data + pos);\n')
-		sys.stdout.write('\t\tif (c == item->codepoint)\n')
-		sys.stdout.write('\t\t\treturn item->%scase == 0 ? c : item->%scase;\n' % (case, case))
-		sys.stdout.write('\t\telse if (c > item->codepoint)\n')
-		sys.stdout.write('\t\t\tbegin = pos + 1;\n')
-		sys.stdout.write('\t\telse\n')
-		sys.stdout.write('\t\t\tend = pos - 1;\n')
+		sys.stdout.write('\t\tif (!has_special_casing(in[i]))\n')
+		sys.stdout.write('\t\t{\n')
+		sys.stdout.write('\t\t\tif (o < outlen)\n')
+		sys.stdout.write('\t\t\t\tout[o] = lookup_to%s(in[i]);\n' % case)
+		sys.stdout.write('\t\t\t++o;\n')
+		sys.stdout.write('\t\t\tcontinue;\n')
+		sys.stdout.write('\t\t}\n')
+		sys.stdout.write('\t\tm = copy_mapping(ucd_lookup_special_casing(in[i])->%s, mapping);\n' % case)
+		sys.stdout.write('\t\tif (o + m > outlen)\n')
+		sys.stdout.write('\t\t\toutlen = o; /* stop writing to the out buffer */\n')
+		sys.stdout.write('\t\tfor (j = 0; j < m && o + j < outlen; ++j)\n')
+		sys.stdout.write('\t\t\tout[o + j] = mapping[j];\n')
+		sys.stdout.write('\t\to += m;\n')
 		sys.stdout.write('\t}\n')
-		sys.stdout.write('\treturn c;\n')
+		sys.stdout.write('\treturn o;\n')
 		sys.stdout.write('}\n')
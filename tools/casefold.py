@@ -0,0 +1,191 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+# The maximum number of codepoints in a full case folding. This is the
+# UCD_MAX_FULL_CASE_MAPPING value in ucd.h.
+max_mapping = 3
+
+# The simple (C + S) case folding deltas, and the full (F) case foldings that
+# map a codepoint to multiple codepoints. The Turkic (T) foldings are not used.
+simple_folding = {}
+full_folding = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'CaseFolding'):
+	codepoint = data['CodePoint']
+	if data['Status'] in ['C', 'S']:
+		simple_folding[codepoint] = data['Mapping'][0].codepoint - codepoint.codepoint
+	elif data['Status'] == 'F':
+		if len(data['Mapping']) > max_mapping:
+			raise Exception('%s: the full case folding has more than %d codepoints' % (codepoint, max_mapping))
+		for c in [codepoint] + data['Mapping']:
+			if c.codepoint > 0xFFFF:
+				raise Exception('%s: the full case folding is not in the BMP' % codepoint)
+		full_folding[codepoint] = data['Mapping']
+
+# The fold entries are (simple delta, has full folding) pairs. The first entry
+# is used for codepoints that do not have a case folding.
+fold_list = [(0, 0)]
+fold_index = {(0, 0): 0}
+
+# The fold entry indices are stored in 256 codepoint pages. Identical pages
+# (e.g. pages without any case foldings) are only stored once.
+page_list = []
+page_index = {}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = []
+	for codepoint in ucd.CodeRange('%06X..%06X' % (page, page + 255)):
+		fold = (simple_folding.get(codepoint, 0), codepoint in full_folding and 1 or 0)
+		if not fold in fold_index:
+			fold_index[fold] = len(fold_list)
+			fold_list.append(fold)
+		entries.append(fold_index[fold])
+	entries = tuple(entries)
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Case Folding
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the CaseFolding.txt file in
+ * the Unicode Character database by the ucd-tools/tools/casefold.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const int32_t fold_deltas[][2] = /* simple folding, has full folding */\n')
+	sys.stdout.write('{\n')
+	for i, (delta, full) in enumerate(fold_list):
+		sys.stdout.write('\t/* %3d */ { %d, %d },\n' % (i, delta, full))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s fold_pages[][256] =\n' % c_type(len(fold_list)))
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s fold_index[] =\n' % c_type(len(page_list)))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const uint16_t full_folding[][1 + UCD_MAX_FULL_CASE_MAPPING] = /* codepoint, folding */\n')
+	sys.stdout.write('{\n')
+	for codepoint in sorted(full_folding.keys()):
+		mapping = full_folding[codepoint]
+		sys.stdout.write('\t{ 0x%04X, %s },\n' % (codepoint.codepoint,
+			', '.join(['0x%04X' % c.codepoint for c in mapping] + ['0'] * (max_mapping - len(mapping)))))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write("""
+static const int32_t *lookup_fold(codepoint_t c)
+{
+	return fold_deltas[fold_pages[fold_index[c / 256]][c % 256]];
+}
+
+codepoint_t ucd_casefold(codepoint_t c)
+{
+	if (c > 0x10FFFF) return c; /* Invalid Unicode Codepoint */
+	return (codepoint_t)(c + lookup_fold(c)[0]);
+}
+
+size_t ucd_casefold_full(codepoint_t c, codepoint_t *out)
+{
+	const int32_t *fold;
+	size_t begin, end, pos, n;
+	if (c > 0x10FFFF) /* Invalid Unicode Codepoint */
+	{
+		out[0] = c;
+		return 1;
+	}
+	fold = lookup_fold(c);
+	if (!fold[1])
+	{
+		out[0] = (codepoint_t)(c + fold[0]);
+		return 1;
+	}
+	begin = 0;
+	end = sizeof(full_folding)/sizeof(full_folding[0]);
+	while (begin < end)
+	{
+		pos = (begin + end) / 2;
+		if (c < full_folding[pos][0])
+			end = pos;
+		else if (c > full_folding[pos][0])
+			begin = pos + 1;
+		else
+		{
+			for (n = 0; n < UCD_MAX_FULL_CASE_MAPPING && full_folding[pos][n + 1] != 0; ++n)
+				out[n] = full_folding[pos][n + 1];
+			return n;
+		}
+	}
+	out[0] = c;
+	return 1;
+}
+""")
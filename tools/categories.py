@@ -194,7 +194,7 @@ if __name__ == '__main__':
 			sys.stdout.write('};\n')
 
 	sys.stdout.write('\n')
-	sys.stdout.write('ucd_category ucd_lookup_category(codepoint_t c)\n')
+	sys.stdout.write('static ucd_category lookup_category(codepoint_t c)\n')
 	sys.stdout.write('{\n')
 	for codepoints, category, comment in category_sets:
 		if category:
@@ -209,6 +209,18 @@ if __name__ == '__main__':
 	sys.stdout.write('}\n')
 
 	sys.stdout.write("""
+ucd_category ucd_lookup_category(codepoint_t c)
+{
+	return lookup_category(c);
+}
+
+void ucd_lookup_category_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint8_t)lookup_category(in[i]);
+}
+
 ucd_category_group ucd_get_category_group_for_category(ucd_category c)
 {
 	switch (c)
@@ -0,0 +1,238 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+null = ucd.CodePoint('0000')
+
+unicode_chars = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'UnicodeData'):
+	for codepoint in data['CodePoint']:
+		unicode_chars[codepoint] = data
+for propfile in ['PropList', 'DerivedCoreProperties']:
+	for data in ucd.parse_ucd_data(ucd_rootdir, propfile):
+		for codepoint in data['Range']:
+			try:
+				unicode_chars[codepoint][data['Property']] = 1
+			except KeyError:
+				unicode_chars[codepoint] = {'CodePoint': codepoint}
+				unicode_chars[codepoint][data['Property']] = 1
+if '--with-csur' in sys.argv:
+	for csur in ['Klingon']:
+		for data in ucd.parse_ucd_data('data/csur', csur):
+			for codepoint in data['CodePoint']:
+				unicode_chars[codepoint] = data
+
+def category(data):
+	return data.get('GeneralCategory', 'Cn')
+
+def nobreak(data):
+	dt = data.get('DecompositionType', None)
+	return dt != None and dt.startswith('<noBreak>')
+
+def isalnum(c, data):
+	return category(data)[0] == 'N' or data.get('Alphabetic', 0) == 1
+
+def isalpha(c, data):
+	return data.get('Alphabetic', 0) == 1
+
+def isblank(c, data):
+	return (category(data) == 'Zs' or c == 0x09) and not nobreak(data)
+
+def iscntrl(c, data):
+	return category(data) == 'Cc'
+
+def isdigit(c, data):
+	return c in range(0x30, 0x3A)
+
+def isgraph(c, data):
+	return category(data)[0] in 'LMNPS'
+
+def islower(c, data):
+	return data.get('Lowercase', 0) == 1 or data.get('UpperCase', null) != null
+
+def isprint(c, data):
+	return category(data)[0] in 'LMNPSZ'
+
+def ispunct(c, data):
+	return isgraph(c, data) and not isalnum(c, data)
+
+def isspace(c, data):
+	return data.get('White_Space', 0) == 1 and not nobreak(data)
+
+def isupper(c, data):
+	return data.get('Uppercase', 0) == 1 or data.get('LowerCase', null) != null
+
+def isxdigit(c, data):
+	return isdigit(c, data) or c in list(range(0x41, 0x47)) + list(range(0x61, 0x67))
+
+# The ctype classes in ucd_ctype bit order.
+ctype_classes = [
+	('ALNUM',  isalnum),
+	('ALPHA',  isalpha),
+	('BLANK',  isblank),
+	('CNTRL',  iscntrl),
+	('DIGIT',  isdigit),
+	('GRAPH',  isgraph),
+	('LOWER',  islower),
+	('PRINT',  isprint),
+	('PUNCT',  ispunct),
+	('SPACE',  isspace),
+	('UPPER',  isupper),
+	('XDIGIT', isxdigit),
+]
+
+def ctype_mask(codepoint):
+	data = unicode_chars.get(codepoint, {})
+	mask = 0
+	for i, (name, isclass) in enumerate(ctype_classes):
+		if isclass(codepoint.codepoint, data):
+			mask |= 2 ** i
+	return mask
+
+def ctype_string(mask):
+	classes = [name for i, (name, isclass) in enumerate(ctype_classes) if mask & (2 ** i)]
+	if len(classes) == 0:
+		return '0'
+	return '|'.join(classes)
+
+# There are only a small number of distinct ctype masks, so the masks are
+# stored in a palette and indexed by 256 codepoint pages. Identical pages (e.g.
+# unassigned codepoints and CJK ideographs) are only stored once.
+mask_list = []
+mask_index = {}
+page_list = []
+page_index = {}
+pages = []
+if __name__ == '__main__':
+	for page in range(0, 0x110000, 256):
+		entries = []
+		for codepoint in ucd.CodeRange('%06X..%06X' % (page, page + 255)):
+			mask = ctype_mask(codepoint)
+			if not mask in mask_index:
+				mask_index[mask] = len(mask_list)
+				mask_list.append(mask)
+			entries.append(mask_index[mask])
+		entries = tuple(entries)
+		if not entries in page_index:
+			page_index[entries] = len(page_list)
+			page_list.append((page, entries))
+		pages.append(page_index[entries])
+
+	sys.stdout.write("""/* ctype-style APIs.
+ *
+ * Copyright (C) 2012-2018, 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the UnicodeData.txt,
+ * PropList.txt and DerivedCoreProperties.txt files in the Unicode Character
+ * database by the ucd-tools/tools/ctype.py script.
+ */
+
+#include "ucd/ucd.h"
+#include "latin1.h"
+
+""")
+	for name, isclass in ctype_classes:
+		sys.stdout.write('#define %-6s UCD_CTYPE_%s\n' % (name, name))
+	sys.stdout.write("""
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const ucd_ctype ctype_masks[] =\n')
+	sys.stdout.write('{\n')
+	for i, mask in enumerate(mask_list):
+		sys.stdout.write('\t/* %2d */ %s,\n' % (i, ctype_string(mask)))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	if len(mask_list) <= 256:
+		sys.stdout.write('static const uint8_t ctype_pages[][256] =\n')
+	else:
+		sys.stdout.write('static const uint16_t ctype_pages[][256] =\n')
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	if len(page_list) <= 256:
+		sys.stdout.write('static const uint8_t ctype_index[] =\n')
+	else:
+		sys.stdout.write('static const uint16_t ctype_index[] =\n')
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write("""
+static ucd_ctype lookup_ctype_mask(codepoint_t c)
+{
+	if (c <= 0xFF) return ucd_latin1_data[c].ctype;
+	if (c > 0x10FFFF) return 0; /* Invalid Unicode Codepoint */
+	return ctype_masks[ctype_pages[ctype_index[c / 256]][c % 256]];
+}
+
+ucd_ctype ucd_ctype_mask(codepoint_t c)
+{
+	return lookup_ctype_mask(c);
+}
+
+void ucd_ctype_mask_n(const codepoint_t *in, size_t n, ucd_ctype *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = lookup_ctype_mask(in[i]);
+}
+""")
+
+	for name, isclass in ctype_classes:
+		sys.stdout.write('\n')
+		sys.stdout.write('int ucd_is%s(codepoint_t c)\n' % name.lower())
+		sys.stdout.write('{\n')
+		sys.stdout.write('\treturn (lookup_ctype_mask(c) & %s) != 0;\n' % name)
+		sys.stdout.write('}\n')
@@ -0,0 +1,139 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+# The East_Asian_Width values in ucd_east_asian_width order.
+ea_values = ['N', 'A', 'F', 'H', 'Na', 'W']
+
+# The unassigned codepoints in these ranges are not listed in EastAsianWidth.txt
+# and default to W. All other unlisted codepoints default to N.
+wide_defaults = [
+	(0x003400, 0x004DBF), # CJK Unified Ideographs Extension A
+	(0x004E00, 0x009FFF), # CJK Unified Ideographs
+	(0x00F900, 0x00FAFF), # CJK Compatibility Ideographs
+	(0x020000, 0x02FFFD), # Supplementary Ideographic Plane
+	(0x030000, 0x03FFFD), # Tertiary Ideographic Plane
+]
+
+east_asian_width = {}
+for first, last in wide_defaults:
+	for c in range(first, last + 1):
+		east_asian_width[c] = ea_values.index('W')
+for data in ucd.parse_ucd_data(ucd_rootdir, 'EastAsianWidth'):
+	for codepoint in data['Range']:
+		east_asian_width[codepoint.codepoint] = ea_values.index(data['Value'])
+
+# The East_Asian_Width values are stored in 256 codepoint pages. Identical
+# pages are only stored once, so all the pages where every codepoint has the
+# N value share the first page.
+page_list = [(0, tuple([0] * 256))]
+page_index = {page_list[0][1]: 0}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = tuple([east_asian_width.get(c, 0) for c in range(page, page + 256)])
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode East Asian Width
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the EastAsianWidth.txt file
+ * in the Unicode Character database by the ucd-tools/tools/eastasianwidth.py
+ * script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const uint8_t east_asian_width_pages[][256] =\n')
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		if i == 0:
+			sys.stdout.write('\t{ /* %d : ea=N */' % i)
+		else:
+			sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s east_asian_width_index[] =\n' % c_type(len(page_list)))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write("""
+ucd_east_asian_width ucd_lookup_east_asian_width(codepoint_t c)
+{
+	if (c > 0x10FFFF) return UCD_EAST_ASIAN_WIDTH_N; /* Invalid Unicode Codepoint */
+	return (ucd_east_asian_width)east_asian_width_pages[east_asian_width_index[c / 256]][c % 256];
+}
+
+void ucd_lookup_east_asian_width_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+	{
+		codepoint_t c = in[i];
+		out[i] = c > 0x10FFFF ? UCD_EAST_ASIAN_WIDTH_N : east_asian_width_pages[east_asian_width_index[c / 256]][c % 256];
+	}
+}
+""")
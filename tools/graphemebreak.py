@@ -0,0 +1,217 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import textwrap
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+emoji_rootdir = 'data/emoji'
+
+# The Grapheme_Cluster_Break values in ucd_grapheme_cluster_break order. The
+# Extended_Pictographic characters (which have the Other value) are given their
+# own break class, as they are used in the emoji ZWJ sequence rule (GB11).
+gcb_values = ['XX', 'CN', 'CR', 'EX', 'L', 'LF', 'LV', 'LVT', 'PP', 'RI', 'SM', 'T', 'V', 'ZWJ']
+break_classes = gcb_values + ['ExtPict']
+
+gcb_names = ucd.parse_property_mapping(ucd_rootdir, 'GCB', reverse=True)
+
+grapheme_break = {}
+for data in ucd.parse_ucd_data(os.path.join(ucd_rootdir, 'auxiliary'), 'GraphemeBreakProperty'):
+	value = break_classes.index(gcb_names[data['Value']])
+	for codepoint in data['Range']:
+		grapheme_break[codepoint] = value
+
+for data in ucd.parse_ucd_data(emoji_rootdir, 'emoji-data'):
+	if data['Property'] == 'Extended_Pictographic':
+		for codepoint in data['Range']:
+			if grapheme_break.get(codepoint, 0) != 0:
+				raise Exception('%s: Extended_Pictographic codepoint does not have the Other value' % codepoint)
+			grapheme_break[codepoint] = break_classes.index('ExtPict')
+
+# The break classes are stored in 256 codepoint pages. Identical pages (e.g.
+# pages where all codepoints have the Other value) are only stored once.
+page_list = []
+page_index = {}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = tuple([grapheme_break.get(codepoint, 0) for codepoint in ucd.CodeRange('%06X..%06X' % (page, page + 255))])
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+# The break state is the break class of the previous codepoint, with extra
+# states for the context needed by the regional indicator (GB12, GB13) and
+# emoji ZWJ sequence (GB11) rules:
+#     sot     -- the start of the text
+#     RI      -- an odd number of regional indicators
+#     RI_pair -- an even number of regional indicators
+#     EP_EX   -- an Extend after an ExtPict Extend* sequence
+#     EP_ZWJ  -- a ZWJ after an ExtPict Extend* sequence
+states = ['sot'] + break_classes + ['RI_pair', 'EP_EX', 'EP_ZWJ']
+state_class = {'sot': None, 'RI_pair': 'RI', 'EP_EX': 'EX', 'EP_ZWJ': 'ZWJ'}
+
+def is_break(state, cls):
+	prev = state_class.get(state, state)
+	if prev is None: return True # GB1
+	if prev == 'CR' and cls == 'LF': return False # GB3
+	if prev in ['CN', 'CR', 'LF']: return True # GB4
+	if cls in ['CN', 'CR', 'LF']: return True # GB5
+	if prev == 'L' and cls in ['L', 'V', 'LV', 'LVT']: return False # GB6
+	if prev in ['LV', 'V'] and cls in ['V', 'T']: return False # GB7
+	if prev in ['LVT', 'T'] and cls == 'T': return False # GB8
+	if cls in ['EX', 'ZWJ']: return False # GB9
+	if cls == 'SM': return False # GB9a
+	if prev == 'PP': return False # GB9b
+	if state == 'EP_ZWJ' and cls == 'ExtPict': return False # GB11
+	if state == 'RI' and cls == 'RI': return False # GB12, GB13
+	return True # GB999
+
+def next_state(state, cls):
+	if cls == 'RI' and state == 'RI':
+		return 'RI_pair'
+	if cls == 'EX' and state in ['ExtPict', 'EP_EX']:
+		return 'EP_EX'
+	if cls == 'ZWJ' and state in ['ExtPict', 'EP_EX']:
+		return 'EP_ZWJ'
+	return cls
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Grapheme Cluster Break
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the GraphemeBreakProperty.txt
+ * file in the Unicode Character database, and the emoji-data.txt file in the
+ * Unicode Emoji data, by the ucd-tools/tools/graphemebreak.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The break classes. These are the ucd_grapheme_cluster_break values, and an\n')
+	sys.stdout.write(' * ExtPict class for the Extended_Pictographic codepoints.\n')
+	sys.stdout.write(' */\n')
+	sys.stdout.write('#define ExtPict %d\n' % break_classes.index('ExtPict'))
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const uint8_t grapheme_break_pages[][256] =\n')
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s grapheme_break_index[] =\n' % c_type(len(page_list)))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The state transitions for each state and break class. The low 7 bits are\n')
+	sys.stdout.write(' * the next state, and the high bit is set if there is a break between the\n')
+	sys.stdout.write(' * previous codepoint and the current codepoint.\n')
+	sys.stdout.write(' *\n')
+	for line in textwrap.wrap('The columns are the %s break classes.' % ', '.join(break_classes), 76):
+		sys.stdout.write(' * %s\n' % line)
+	sys.stdout.write(' */\n')
+	sys.stdout.write('static const uint8_t grapheme_break_states[][%d] =\n' % len(break_classes))
+	sys.stdout.write('{\n')
+	for i, state in enumerate(states):
+		values = []
+		for cls in break_classes:
+			value = states.index(next_state(state, cls))
+			if is_break(state, cls):
+				value = value | 0x80
+			values.append('0x%02X' % value)
+		sys.stdout.write('\t/* %2d : %-7s */ { %s },\n' % (i, state, ', '.join(values)))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write("""
+static int lookup_break_class(codepoint_t c)
+{
+	if (c > 0x10FFFF) return UCD_GRAPHEME_CLUSTER_BREAK_XX; /* Invalid Unicode Codepoint */
+	return grapheme_break_pages[grapheme_break_index[c / 256]][c % 256];
+}
+
+ucd_grapheme_cluster_break ucd_lookup_grapheme_cluster_break(codepoint_t c)
+{
+	int cls = lookup_break_class(c);
+	return cls == ExtPict ? UCD_GRAPHEME_CLUSTER_BREAK_XX : (ucd_grapheme_cluster_break)cls;
+}
+
+void ucd_lookup_grapheme_cluster_break_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+	{
+		int cls = lookup_break_class(in[i]);
+		out[i] = cls == ExtPict ? UCD_GRAPHEME_CLUSTER_BREAK_XX : (uint8_t)cls;
+	}
+}
+
+void ucd_grapheme_break_init(ucd_grapheme_break_state *state)
+{
+	state->state = 0;
+}
+
+int ucd_grapheme_break_next(ucd_grapheme_break_state *state, codepoint_t c)
+{
+	uint8_t transition = grapheme_break_states[state->state][lookup_break_class(c)];
+	state->state = transition & 0x7F;
+	return transition >> 7;
+}
+""")
@@ -0,0 +1,82 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import ucd
+import ctype
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+null = ucd.CodePoint('0000')
+latin1 = ucd.CodeRange('000000..0000FF')
+
+def case_mapping(codepoint, data, case):
+	mapping = data.get(case, null)
+	if mapping == null:
+		return codepoint
+	return mapping
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Latin-1 Character Data
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the UnicodeData.txt,
+ * PropList.txt and DerivedCoreProperties.txt files in the Unicode Character
+ * database by the ucd-tools/tools/latin1.py script.
+ */
+
+#include "latin1.h"
+
+""")
+	for name, isclass in ctype.ctype_classes:
+		sys.stdout.write('#define %-6s UCD_CTYPE_%s\n' % (name, name))
+	sys.stdout.write("""
+/* Unicode Character Data %s */
+
+const latin1_entry ucd_latin1_data[256] =
+{
+""" % ucd_version)
+	for codepoint in latin1:
+		data = ctype.unicode_chars.get(codepoint, {})
+		sys.stdout.write('\t/* %02X */ { %s, 0x%04X, 0x%04X, 0x%04X },\n' % (
+		                 codepoint.codepoint,
+		                 ctype.ctype_string(ctype.ctype_mask(codepoint)),
+		                 case_mapping(codepoint, data, 'UpperCase').codepoint,
+		                 case_mapping(codepoint, data, 'LowerCase').codepoint,
+		                 case_mapping(codepoint, data, 'TitleCase').codepoint))
+	sys.stdout.write('};\n')
@@ -0,0 +1,391 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import sys
+import ucd
+import breakrules
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+# The Line_Break values in ucd_line_break order. The OP and CP codepoints with
+# an East_Asian_Width of F, W or H are given their own break classes, as they
+# are excluded from LB30. The SA codepoints with a Mn or Mc general category
+# are given their own break class, as they are resolved to CM by LB1.
+lb_values = [
+	'XX', 'AI', 'AL', 'B2', 'BA', 'BB', 'BK', 'CB', 'CJ', 'CL', 'CM', 'CP', 'CR', 'EB', 'EM', 'EX',
+	'GL', 'H2', 'H3', 'HL', 'HY', 'ID', 'IN', 'IS', 'JL', 'JT', 'JV', 'LF', 'NL', 'NS', 'NU', 'OP',
+	'PO', 'PR', 'QU', 'RI', 'SA', 'SG', 'SP', 'SY', 'WJ', 'ZW', 'ZWJ'
+]
+break_classes = lb_values + ['OP_EA', 'CP_EA', 'SA_CM']
+
+east_asian = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'EastAsianWidth'):
+	if data['Value'] in ['F', 'W', 'H']:
+		for codepoint in data['Range']:
+			east_asian[codepoint] = True
+
+categories = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'UnicodeData'):
+	if data['GeneralCategory'] in ['Mn', 'Mc']:
+		for codepoint in data['CodePoint']:
+			categories[codepoint] = data['GeneralCategory']
+
+line_break = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'LineBreak'):
+	for codepoint in data['Range']:
+		value = data['Value']
+		if value in ['OP', 'CP'] and codepoint in east_asian:
+			value = '%s_EA' % value
+		elif value == 'SA' and codepoint in categories:
+			value = 'SA_CM'
+		line_break[codepoint] = break_classes.index(value)
+
+page_list, pages = breakrules.break_pages(line_break)
+
+# The break opportunities before a codepoint.
+PROHIBITED = 0
+ALLOWED    = 1
+MANDATORY  = 2
+MARK       = 3 # The break opportunity depends on the following codepoints.
+
+# The break classes after resolving the AI, CJ, SA, SG and XX classes (LB1).
+resolved_classes = {
+	'AI': 'AL',
+	'CJ': 'NS',
+	'SA': 'AL',
+	'SA_CM': 'CM',
+	'SG': 'AL',
+	'XX': 'AL',
+}
+
+# The rule state is a (previous, zwj, number) tuple, where:
+#     previous -- the resolved break class of the previous codepoint after
+#                 ignoring the CM and ZWJ codepoints (LB9), with sot for the
+#                 start of the text, RI_pair for an even number of regional
+#                 indicators, HL_HY and HL_BA for HY and BA after HL (LB21a),
+#                 and (SP, context) for a sequence of spaces, where context is
+#                 the ZW, OP, QU, CL, CP or B2 class before the spaces (LB8,
+#                 LB14-LB17);
+#     zwj      -- set if the previous codepoint is a ZWJ (LB8a);
+#     number   -- NU for a NU (NU | SY | IS)* sequence, and CL for a
+#                 NU (NU | SY | IS)* (CL | CP) sequence (LB25).
+#
+# The pending state is a (pending, state) tuple, where state is the rule state
+# after an OP that follows a PR or PO codepoint. The break before the OP is
+# only prohibited if it is followed by a NU codepoint (LB25).
+#
+# LB25 uses the regular expression from Example 7 of Section 8.2 in UAX #14,
+# as is done by the LineBreakTest.txt file, where there is no break:
+#     1. between PR or PO and ( OP | HY )? NU;
+#     2. between OP or HY and NU;
+#     3. after NU (NU | SY | IS)* before NU, SY, IS, CL or CP;
+#     4. after NU (NU | SY | IS)* (CL | CP)? before PO or PR.
+Hard = ['BK', 'CR', 'LF', 'NL']
+AHLetter = ['AL', 'HL']
+Hangul = ['JL', 'JV', 'JT', 'H2', 'H3']
+
+def base_class(cls):
+	if isinstance(cls, tuple):
+		return cls[0]
+	return {'OP_EA': 'OP', 'CP_EA': 'CP', 'RI_pair': 'RI', 'HL_HY': 'HY', 'HL_BA': 'BA'}.get(cls, cls)
+
+def space_context(previous):
+	if isinstance(previous, tuple):
+		return previous[1]
+	return {'ZW': 'ZW', 'OP': 'OP', 'QU': 'QU', 'CL': 'CL', 'CP': 'CL', 'B2': 'B2'}.get(base_class(previous))
+
+def number_context(state, c):
+	previous, zwj, number = state
+	if c == 'NU':
+		return 'NU'
+	if number == 'NU' and c in ['SY', 'IS']:
+		return 'NU'
+	if number == 'NU' and c in ['CL', 'CP']:
+		return 'CL'
+	return None
+
+def next_state(state, cls):
+	previous, zwj, number = state
+	c = resolved_classes.get(cls, cls)
+	if c in ['CM', 'ZWJ']:
+		if not base_class(previous) in ['sot', 'SP', 'ZW'] + Hard:
+			return (previous, c == 'ZWJ', number) # LB9
+		c = 'AL' # LB10
+		return (c, cls == 'ZWJ', None)
+	cb = base_class(c)
+	if c == 'SP':
+		return (('SP', space_context(previous)), False, None)
+	if c in ['HY', 'BA'] and base_class(previous) == 'HL':
+		return ('HL_%s' % c, False, None)
+	if c == 'RI' and previous == 'RI':
+		return ('RI_pair', False, None)
+	if c == 'OP_EA':
+		return ('OP', False, None)
+	return (c, False, number_context(state, cb))
+
+def break_opportunity(state, cls):
+	previous, zwj, number = state
+	p = base_class(previous)
+	context = space_context(previous) if p == 'SP' else None
+	c = resolved_classes.get(cls, cls)
+	cb = base_class(c)
+	if p == 'sot': return PROHIBITED # LB2
+	if p == 'BK': return MANDATORY # LB4
+	if p == 'CR' and cb == 'LF': return PROHIBITED # LB5
+	if p in Hard: return MANDATORY # LB5
+	if cb in Hard: return PROHIBITED # LB6
+	if cb in ['SP', 'ZW']: return PROHIBITED # LB7
+	if p == 'ZW' or context == 'ZW': return ALLOWED # LB8
+	if zwj: return PROHIBITED # LB8a
+	if cb in ['CM', 'ZWJ']:
+		if not p in ['SP', 'ZW']: return PROHIBITED # LB9
+		cb = 'AL' # LB10
+	if cb == 'WJ' or p == 'WJ': return PROHIBITED # LB11
+	if p == 'GL': return PROHIBITED # LB12
+	if cb == 'GL' and not p in ['SP', 'BA', 'HY']: return PROHIBITED # LB12a
+	if cb in ['CL', 'CP', 'EX', 'IS', 'SY']: return PROHIBITED # LB13
+	if p == 'OP' or context == 'OP': return PROHIBITED # LB14
+	if (p == 'QU' or context == 'QU') and cb == 'OP': return PROHIBITED # LB15
+	if (p in ['CL', 'CP'] or context == 'CL') and cb == 'NS': return PROHIBITED # LB16
+	if (p == 'B2' or context == 'B2') and cb == 'B2': return PROHIBITED # LB17
+	if p == 'SP': return ALLOWED # LB18
+	if cb == 'QU' or p == 'QU': return PROHIBITED # LB19
+	if cb == 'CB' or p == 'CB': return ALLOWED # LB20
+	if cb in ['BA', 'HY', 'NS'] or p == 'BB': return PROHIBITED # LB21
+	if previous in ['HL_HY', 'HL_BA']: return PROHIBITED # LB21a
+	if p == 'SY' and cb == 'HL': return PROHIBITED # LB21b
+	if cb == 'IN': return PROHIBITED # LB22
+	if p in AHLetter and cb == 'NU': return PROHIBITED # LB23
+	if p == 'NU' and cb in AHLetter: return PROHIBITED # LB23
+	if p == 'PR' and cb in ['ID', 'EB', 'EM']: return PROHIBITED # LB23a
+	if p in ['ID', 'EB', 'EM'] and cb == 'PO': return PROHIBITED # LB23a
+	if p in ['PR', 'PO'] and cb in AHLetter: return PROHIBITED # LB24
+	if p in AHLetter and cb in ['PR', 'PO']: return PROHIBITED # LB24
+	if p in ['PR', 'PO'] and cb == 'NU': return PROHIBITED # LB25
+	if p in ['PR', 'PO'] and cb == 'OP': return MARK # LB25
+	if p in ['OP', 'HY'] and cb == 'NU': return PROHIBITED # LB25
+	if number == 'NU' and cb in ['NU', 'SY', 'IS', 'CL', 'CP']: return PROHIBITED # LB25
+	if number in ['NU', 'CL'] and cb in ['PO', 'PR']: return PROHIBITED # LB25
+	if p == 'JL' and cb in ['JL', 'JV', 'H2', 'H3']: return PROHIBITED # LB26
+	if p in ['JV', 'H2'] and cb in ['JV', 'JT']: return PROHIBITED # LB26
+	if p in ['JT', 'H3'] and cb == 'JT': return PROHIBITED # LB26
+	if p in Hangul and cb == 'PO': return PROHIBITED # LB27
+	if p == 'PR' and cb in Hangul: return PROHIBITED # LB27
+	if p in AHLetter and cb in AHLetter: return PROHIBITED # LB28
+	if p == 'IS' and cb in AHLetter: return PROHIBITED # LB29
+	if p in AHLetter + ['NU'] and c == 'OP': return PROHIBITED # LB30
+	if previous == 'CP' and cb in AHLetter + ['NU']: return PROHIBITED # LB30
+	if previous == 'RI' and cb == 'RI': return PROHIBITED # LB30a
+	if p == 'EB' and cb == 'EM': return PROHIBITED # LB30b
+	return ALLOWED # LB31
+
+# In a pending state, the break opportunity is for the marked OP codepoint, as
+# there is never a break opportunity after an OP codepoint (LB14).
+def transition(state, cls):
+	if state[0] == 'pending':
+		after = state[1]
+		if break_opportunity(after, cls) != PROHIBITED:
+			raise Exception('%s: break opportunity after an OP codepoint' % cls)
+		c = resolved_classes.get(cls, cls)
+		if c in ['CM', 'ZWJ']:
+			return PROHIBITED, state # LB9
+		if c == 'NU':
+			return PROHIBITED, next_state(after, cls) # LB25
+		return ALLOWED, next_state(after, cls) # LB31
+	opportunity = break_opportunity(state, cls)
+	if opportunity == MARK:
+		return MARK, ('pending', next_state(state, cls))
+	return opportunity, next_state(state, cls)
+
+def is_pending(state):
+	return state[0] == 'pending'
+
+transitions, pending = breakrules.compile_states(('sot', False, None), break_classes, transition, is_pending)
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Line Break
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the LineBreak.txt,
+ * EastAsianWidth.txt and UnicodeData.txt files in the Unicode Character
+ * database by the ucd-tools/tools/linebreak.py script.
+ */
+
+#include "ucd/ucd.h"
+#include "utf8.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The break classes. These are the ucd_line_break values, and classes for\n')
+	sys.stdout.write(' * the East Asian OP and CP codepoints and the SA combining marks.\n')
+	sys.stdout.write(' */\n')
+	sys.stdout.write('#define OP_EA %d\n' % break_classes.index('OP_EA'))
+	sys.stdout.write('#define CP_EA %d\n' % break_classes.index('CP_EA'))
+	sys.stdout.write('#define SA_CM %d\n' % break_classes.index('SA_CM'))
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The break opportunity actions. These are the ucd_break_opportunity values,\n')
+	sys.stdout.write(' * and an action to mark an OP codepoint that is only kept with a preceding PR\n')
+	sys.stdout.write(' * or PO codepoint if it is followed by a NU codepoint (LB25).\n')
+	sys.stdout.write(' */\n')
+	sys.stdout.write('#define MARK %d\n' % MARK)
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The states from this state onwards have a marked OP codepoint. */\n')
+	sys.stdout.write('#define PENDING %d\n' % pending)
+
+	breakrules.write_pages('line_break', page_list, pages)
+	breakrules.write_states('line_break', break_classes, transitions, rules='UAX #14')
+
+	sys.stdout.write("""
+static int lookup_break_class(codepoint_t c)
+{
+	if (c > 0x10FFFF) return UCD_LINE_BREAK_XX; /* Invalid Unicode Codepoint */
+	return line_break_pages[line_break_index[c / 256]][c % 256];
+}
+
+static ucd_line_break line_break(int cls)
+{
+	switch (cls)
+	{
+	case OP_EA: return UCD_LINE_BREAK_OP;
+	case CP_EA: return UCD_LINE_BREAK_CP;
+	case SA_CM: return UCD_LINE_BREAK_SA;
+	default:    return (ucd_line_break)cls;
+	}
+}
+
+ucd_line_break ucd_lookup_line_break(codepoint_t c)
+{
+	return line_break(lookup_break_class(c));
+}
+
+void ucd_lookup_line_break_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint8_t)line_break(lookup_break_class(in[i]));
+}
+
+void ucd_line_break_init(ucd_line_break_state *state)
+{
+	state->state = 0;
+}
+
+size_t ucd_utf32_line_breaks(ucd_line_break_state *state, const codepoint_t *in, size_t n, int last, uint8_t *out)
+{
+	size_t i, mark = 0;
+	uint8_t current = state->state, marked = 0, transition;
+	for (i = 0; i < n; ++i)
+	{
+		transition = line_break_states[current][lookup_break_class(in[i])];
+		if (current >= PENDING)
+		{
+			if ((transition >> 6) == UCD_BREAK_ALLOWED)
+				out[mark] = UCD_BREAK_ALLOWED;
+			out[i] = UCD_BREAK_PROHIBITED;
+		}
+		else if ((transition >> 6) == MARK)
+		{
+			mark = i;
+			marked = current;
+			out[i] = UCD_BREAK_PROHIBITED;
+		}
+		else
+			out[i] = transition >> 6;
+		current = transition & 0x3F;
+	}
+	if (current >= PENDING)
+	{
+		if (!last)
+		{
+			state->state = marked;
+			return mark;
+		}
+		out[mark] = UCD_BREAK_ALLOWED;
+	}
+	state->state = current;
+	return n;
+}
+
+size_t ucd_utf8_line_breaks(ucd_line_break_state *state, const char *in, size_t len, int last, uint8_t *out)
+{
+	const uint8_t *p = (const uint8_t *)in;
+	size_t i = 0, used, mark = 0;
+	uint8_t current = state->state, marked = 0, transition;
+	codepoint_t c;
+	while (i < len)
+	{
+		used = utf8_decode(p + i, len - i, &c);
+		if (!last && i + used == len && used < utf8_sequence_length(p[i]))
+			break; /* incomplete UTF-8 sequence */
+		transition = line_break_states[current][lookup_break_class(c)];
+		if (current >= PENDING)
+		{
+			if ((transition >> 6) == UCD_BREAK_ALLOWED)
+				out[mark] = UCD_BREAK_ALLOWED;
+			out[i] = UCD_BREAK_PROHIBITED;
+		}
+		else if ((transition >> 6) == MARK)
+		{
+			mark = i;
+			marked = current;
+			out[i] = UCD_BREAK_PROHIBITED;
+		}
+		else
+			out[i] = transition >> 6;
+		memset(out + i + 1, UCD_BREAK_PROHIBITED, used - 1);
+		current = transition & 0x3F;
+		i += used;
+	}
+	if (current >= PENDING)
+	{
+		if (!last)
+		{
+			state->state = marked;
+			return mark;
+		}
+		out[mark] = UCD_BREAK_ALLOWED;
+	}
+	state->state = current;
+	return i;
+}
+""")
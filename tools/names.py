@@ -0,0 +1,567 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+
+import re
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+max_name_length = 88
+
+# The number of word indices that are stored in a single byte. The other word
+# indices are stored in two bytes, with the first byte >= single_byte_words.
+single_byte_words = 192
+
+# The number of names between each entry in the name_phrase_blocks table.
+phrase_block_size = 32
+
+# The names of the codepoint ranges in UnicodeData.txt (NR2 in UAX #44), where
+# the name is the prefix followed by the hexadecimal codepoint.
+range_prefixes = {
+	'CJK Ideograph': 'CJK UNIFIED IDEOGRAPH-',
+	'Tangut Ideograph': 'TANGUT IDEOGRAPH-',
+}
+
+hangul_syllables = (0xAC00, 0xD7A3)
+
+names = {}
+prefix_names = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'UnicodeData'):
+	name = data['Name']
+	if isinstance(data['CodePoint'], ucd.CodeRange):
+		first = data['CodePoint'].first.codepoint
+		last  = data['CodePoint'].last.codepoint
+		if name == 'Hangul Syllable':
+			if (first, last) != hangul_syllables:
+				raise Exception('%s: unexpected Hangul Syllable range' % data['CodePoint'])
+			continue
+		for label, prefix in range_prefixes.items():
+			if name.startswith(label):
+				for c in range(first, last + 1):
+					prefix_names[c] = prefix
+		continue
+	if name.startswith('<'):
+		continue
+	if len(name) > max_name_length:
+		raise Exception('%s: the name is longer than %d characters' % (data['CodePoint'], max_name_length))
+	c = data['CodePoint'].codepoint
+	# Names like CJK COMPATIBILITY IDEOGRAPH-F900 are also derived from the
+	# codepoint, so only the prefix is stored.
+	m = re.match('^(.*-)([0-9A-F]+)$', name)
+	if m and m.group(2) == '%04X' % c:
+		prefix_names[c] = m.group(1)
+	else:
+		names[c] = name
+
+# The runs of consecutive codepoints that have the same name prefix.
+prefix_list = sorted(set(prefix_names.values()))
+prefix_ranges = []
+for c in sorted(prefix_names.keys()):
+	prefix = prefix_list.index(prefix_names[c])
+	if len(prefix_ranges) > 0 and prefix_ranges[-1][1] == c - 1 and prefix_ranges[-1][2] == prefix:
+		prefix_ranges[-1][1] = c
+	else:
+		prefix_ranges.append([c, c, prefix])
+
+for c in names.keys():
+	for prefix in prefix_list:
+		if names[c].startswith(prefix):
+			raise Exception('%06X: the name starts with the name prefix %s' % (c, prefix))
+
+# The name indices are assigned in codepoint order, with the runs of
+# consecutive codepoints mapping to consecutive name indices.
+codepoints = sorted(names.keys())
+name_ranges = []
+for index, c in enumerate(codepoints):
+	if len(name_ranges) > 0 and name_ranges[-1][1] == c - 1:
+		name_ranges[-1][1] = c
+	else:
+		name_ranges.append([c, c, index])
+
+# The words are ordered by frequency, so the most common words are stored in
+# a single byte.
+word_counts = {}
+for c in codepoints:
+	for word in names[c].split(' '):
+		word_counts[word] = word_counts.get(word, 0) + 1
+words = sorted(word_counts.keys(), key=lambda word: (-word_counts[word], word))
+word_index = dict([(word, i) for i, word in enumerate(words)])
+if len(words) > single_byte_words + (256 - single_byte_words) * 256:
+	raise Exception('there are too many words (%d) in the names' % len(words))
+
+word_offsets = [0]
+for word in words:
+	word_offsets.append(word_offsets[-1] + len(word))
+
+def encode_word(word):
+	i = word_index[word]
+	if i < single_byte_words:
+		return [i]
+	i -= single_byte_words
+	return [single_byte_words + i // 256, i % 256]
+
+# Each name is stored as the number of words followed by the encoded words.
+phrases = []
+phrase_blocks = []
+offset = 0
+for index, c in enumerate(codepoints):
+	phrase = [len(names[c].split(' '))]
+	for word in names[c].split(' '):
+		phrase.extend(encode_word(word))
+	if (index % phrase_block_size) == 0:
+		phrase_blocks.append(offset)
+	phrases.append(phrase)
+	offset += len(phrase)
+
+# The reverse lookup uses a hash and displace perfect hash. The first hash
+# selects a bucket, and the bucket's displacement is combined with the second
+# hash to select the slot in the hash table containing the name index.
+def name_hash(name):
+	h1 = 0x811C9DC5
+	h2 = 0
+	for ch in name:
+		h1 = ((h1 ^ ord(ch)) * 0x01000193) & 0xFFFFFFFF
+		h2 = (h2 * 31 + ord(ch)) & 0xFFFFFFFF
+	return h1, h2
+
+def hash_slot(h2, d, size):
+	x = h2 ^ ((d * 0x9E3779B9) & 0xFFFFFFFF)
+	x ^= x >> 16
+	x = (x * 0x85EBCA6B) & 0xFFFFFFFF
+	x ^= x >> 13
+	return x % size
+
+hash_buckets = len(codepoints) // 4 + 1
+hash_size = len(codepoints) + len(codepoints) // 8
+hash_table = [0xFFFF] * hash_size
+displacements = [0] * hash_buckets
+buckets = [[] for i in range(hash_buckets)]
+for index, c in enumerate(codepoints):
+	h1, h2 = name_hash(names[c])
+	buckets[h1 % hash_buckets].append((index, h2))
+
+for bucket in sorted(range(hash_buckets), key=lambda b: (-len(buckets[b]), b)):
+	if len(buckets[bucket]) == 0:
+		break
+	for d in range(0, 0x10000):
+		slots = [hash_slot(h2, d, hash_size) for index, h2 in buckets[bucket]]
+		if len(set(slots)) == len(slots) and all([hash_table[slot] == 0xFFFF for slot in slots]):
+			break
+	else:
+		raise Exception('unable to find a displacement for hash bucket %d' % bucket)
+	displacements[bucket] = d
+	for slot, (index, h2) in zip(slots, buckets[bucket]):
+		hash_table[slot] = index
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Character Names
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the UnicodeData.txt file in
+ * the Unicode Character database by the ucd-tools/tools/names.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('#define SINGLE_BYTE_WORDS %d\n' % single_byte_words)
+	sys.stdout.write('#define PHRASE_BLOCK_SIZE %d\n' % phrase_block_size)
+	sys.stdout.write('#define NAME_HASH_BUCKETS %d\n' % hash_buckets)
+	sys.stdout.write('#define NAME_HASH_SIZE %d\n' % hash_size)
+	sys.stdout.write('#define NO_NAME 0xFFFF\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The prefixes of the names that end with the hexadecimal codepoint. */\n')
+	sys.stdout.write('static const char *name_prefixes[] =\n')
+	sys.stdout.write('{\n')
+	for i, prefix in enumerate(prefix_list):
+		sys.stdout.write('\t/* %d */ "%s",\n' % (i, prefix))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The (first, last, prefix) of the codepoints with a name prefix. */\n')
+	sys.stdout.write('static const codepoint_t name_prefix_ranges[][3] =\n')
+	sys.stdout.write('{\n')
+	for first, last, prefix in prefix_ranges:
+		sys.stdout.write('\t{ 0x%06X, 0x%06X, %d },\n' % (first, last, prefix))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The characters of the words in the names, in word index order. */\n')
+	sys.stdout.write('static const char name_words[] =\n')
+	sys.stdout.write('{\n')
+	for i, word in enumerate(words):
+		sys.stdout.write('\t/* %5d */' % i)
+		for ch in word:
+			if ch == '\'':
+				sys.stdout.write(" '\\'',")
+			else:
+				sys.stdout.write(" '%s'," % ch)
+		sys.stdout.write('\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The offset of each word in name_words, and the end of the last word. */\n')
+	sys.stdout.write('static const uint32_t name_word_offsets[] =\n')
+	sys.stdout.write('{')
+	for i, offset in enumerate(word_offsets):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %5d */' % i)
+		sys.stdout.write(' %d,' % offset)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The number of words in each name, followed by the encoded words. */\n')
+	sys.stdout.write('static const uint8_t name_phrases[] =\n')
+	sys.stdout.write('{\n')
+	for c, phrase in zip(codepoints, phrases):
+		sys.stdout.write('\t/* %06X */ %s,\n' % (c, ', '.join([str(x) for x in phrase])))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The offset in name_phrases of every PHRASE_BLOCK_SIZE name index. */\n')
+	sys.stdout.write('static const uint32_t name_phrase_blocks[] =\n')
+	sys.stdout.write('{')
+	for i, offset in enumerate(phrase_blocks):
+		if (i % 8) == 0:
+			sys.stdout.write('\n\t/* %5d */' % (i * phrase_block_size))
+		sys.stdout.write(' %d,' % offset)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The (first, last, name index) of the runs of codepoints with a stored name. */\n')
+	sys.stdout.write('static const codepoint_t name_ranges[][3] =\n')
+	sys.stdout.write('{\n')
+	for first, last, index in name_ranges:
+		sys.stdout.write('\t{ 0x%06X, 0x%06X, %d },\n' % (first, last, index))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const uint16_t name_hash_displacements[] =\n')
+	sys.stdout.write('{')
+	for i, d in enumerate(displacements):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %5d */' % i)
+		sys.stdout.write(' %d,' % d)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const uint16_t name_hash_table[] =\n')
+	sys.stdout.write('{')
+	for i, index in enumerate(hash_table):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %5d */' % i)
+		if index == 0xFFFF:
+			sys.stdout.write(' NO_NAME,')
+		else:
+			sys.stdout.write(' %d,' % index)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write("""
+/* Hangul Syllable names (NR1 in UAX #44) are composed from the Jamo short names
+ * of the leading consonant, vowel and trailing consonant of the syllable.
+ */
+
+#define HANGUL_S_BASE  0xAC00
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_N_COUNT (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT 11172
+
+static const char *hangul_l_names[] =
+{
+	"G", "GG", "N", "D", "DD", "R", "M", "B", "BB", "S", "SS", "", "J", "JJ",
+	"C", "K", "T", "P", "H",
+};
+
+static const char *hangul_v_names[] =
+{
+	"A", "AE", "YA", "YAE", "EO", "E", "YEO", "YE", "O", "WA", "WAE", "OE",
+	"YO", "U", "WEO", "WE", "WI", "YU", "EU", "YI", "I",
+};
+
+static const char *hangul_t_names[] =
+{
+	"", "G", "GG", "GS", "N", "NJ", "NH", "D", "L", "LG", "LM", "LB", "LS",
+	"LT", "LP", "LH", "M", "B", "BS", "S", "SS", "NG", "J", "C", "K", "T",
+	"P", "H",
+};
+
+static const char hangul_prefix[] = "HANGUL SYLLABLE ";
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+/* Append the string to the name, returning the new length of the name. The
+ * characters are only written if there is space for them and the terminating
+ * NUL character.
+ */
+static size_t
+name_append(char *out, size_t outlen, size_t len, const char *s, size_t n)
+{
+	size_t i;
+	for (i = 0; i < n; ++i, ++len)
+	{
+		if (len + 1 < outlen)
+			out[len] = s[i];
+	}
+	return len;
+}
+
+static size_t
+name_append_hex(char *out, size_t outlen, size_t len, codepoint_t c)
+{
+	char hex[8];
+	int i, n = c > 0xFFFF ? 5 : 4;
+	for (i = n - 1; i >= 0; --i, c >>= 4)
+		hex[i] = hex_digits[c & 0xF];
+	return name_append(out, outlen, len, hex, n);
+}
+
+static const codepoint_t *
+find_prefix_range(codepoint_t c)
+{
+	size_t begin = 0;
+	size_t end = sizeof(name_prefix_ranges) / sizeof(name_prefix_ranges[0]);
+	while (begin < end)
+	{
+		size_t pos = (begin + end) / 2;
+		if (c < name_prefix_ranges[pos][0])
+			end = pos;
+		else if (c > name_prefix_ranges[pos][1])
+			begin = pos + 1;
+		else
+			return name_prefix_ranges[pos];
+	}
+	return NULL;
+}
+
+/* Get the name index of the codepoint, or NO_NAME if the name is not stored. */
+static uint32_t
+find_name_index(codepoint_t c)
+{
+	size_t begin = 0;
+	size_t end = sizeof(name_ranges) / sizeof(name_ranges[0]);
+	while (begin < end)
+	{
+		size_t pos = (begin + end) / 2;
+		if (c < name_ranges[pos][0])
+			end = pos;
+		else if (c > name_ranges[pos][1])
+			begin = pos + 1;
+		else
+			return name_ranges[pos][2] + (c - name_ranges[pos][0]);
+	}
+	return NO_NAME;
+}
+
+static codepoint_t
+name_index_codepoint(uint32_t index)
+{
+	size_t begin = 0;
+	size_t end = sizeof(name_ranges) / sizeof(name_ranges[0]);
+	while (end - begin > 1)
+	{
+		size_t pos = (begin + end) / 2;
+		if (index < name_ranges[pos][2])
+			end = pos;
+		else
+			begin = pos;
+	}
+	return name_ranges[begin][0] + (index - name_ranges[begin][2]);
+}
+
+static size_t
+decode_name(uint32_t index, char *out, size_t outlen)
+{
+	const uint8_t *phrase = name_phrases + name_phrase_blocks[index / PHRASE_BLOCK_SIZE];
+	uint32_t word;
+	size_t len = 0;
+	int i, n;
+
+	for (index %= PHRASE_BLOCK_SIZE; index > 0; --index)
+	{
+		for (i = 0, n = *phrase++; i < n; ++i)
+			phrase += *phrase >= SINGLE_BYTE_WORDS ? 2 : 1;
+	}
+
+	for (i = 0, n = *phrase++; i < n; ++i)
+	{
+		word = *phrase++;
+		if (word >= SINGLE_BYTE_WORDS)
+			word = SINGLE_BYTE_WORDS + (word - SINGLE_BYTE_WORDS) * 256 + *phrase++;
+		if (i != 0)
+			len = name_append(out, outlen, len, " ", 1);
+		len = name_append(out, outlen, len, name_words + name_word_offsets[word],
+		                  name_word_offsets[word + 1] - name_word_offsets[word]);
+	}
+	return len;
+}
+
+size_t ucd_get_name(codepoint_t c, char *out, size_t outlen)
+{
+	const codepoint_t *range;
+	uint32_t index;
+	size_t len = 0;
+
+	if (c >= HANGUL_S_BASE && c < HANGUL_S_BASE + HANGUL_S_COUNT)
+	{
+		codepoint_t s = c - HANGUL_S_BASE;
+		const char *l = hangul_l_names[s / HANGUL_N_COUNT];
+		const char *v = hangul_v_names[(s % HANGUL_N_COUNT) / HANGUL_T_COUNT];
+		const char *t = hangul_t_names[s % HANGUL_T_COUNT];
+		len = name_append(out, outlen, len, hangul_prefix, sizeof(hangul_prefix) - 1);
+		len = name_append(out, outlen, len, l, strlen(l));
+		len = name_append(out, outlen, len, v, strlen(v));
+		len = name_append(out, outlen, len, t, strlen(t));
+	}
+	else if ((range = find_prefix_range(c)) != NULL)
+	{
+		const char *prefix = name_prefixes[range[2]];
+		len = name_append(out, outlen, len, prefix, strlen(prefix));
+		len = name_append_hex(out, outlen, len, c);
+	}
+	else if ((index = find_name_index(c)) != NO_NAME)
+		len = decode_name(index, out, outlen);
+
+	if (outlen > 0)
+		out[len < outlen ? len : outlen - 1] = '\\0';
+	return len;
+}
+
+static int
+find_hangul_name(const char **names, size_t count, const char *name, size_t n)
+{
+	size_t i;
+	for (i = 0; i < count; ++i)
+	{
+		if (strlen(names[i]) == n && strncmp(names[i], name, n) == 0)
+			return (int)i;
+	}
+	return -1;
+}
+
+/* Split the Hangul Syllable name into the leading consonant, vowel and
+ * trailing consonant, which use distinct letters in the Jamo short names.
+ */
+static codepoint_t
+lookup_hangul_name(const char *name)
+{
+	size_t l_len = strspn(name, "GNDRMBSJCKTPH");
+	size_t v_len = strspn(name + l_len, "AEIOUWY");
+	size_t t_len = strlen(name + l_len + v_len);
+	int l = find_hangul_name(hangul_l_names, sizeof(hangul_l_names) / sizeof(hangul_l_names[0]), name, l_len);
+	int v = find_hangul_name(hangul_v_names, sizeof(hangul_v_names) / sizeof(hangul_v_names[0]), name + l_len, v_len);
+	int t = find_hangul_name(hangul_t_names, sizeof(hangul_t_names) / sizeof(hangul_t_names[0]), name + l_len + v_len, t_len);
+	if (l < 0 || v < 0 || t < 0)
+		return UCD_INVALID_CODEPOINT;
+	return HANGUL_S_BASE + (l * HANGUL_V_COUNT + v) * HANGUL_T_COUNT + t;
+}
+
+/* Parse the hexadecimal codepoint at the end of the name, which must be in
+ * the same form as it is written by name_append_hex.
+ */
+static codepoint_t
+parse_hex_codepoint(const char *s)
+{
+	codepoint_t c = 0;
+	const char *digit;
+	size_t n;
+	for (n = 0; s[n] != '\\0'; ++n)
+	{
+		if (n == 5 || (digit = strchr(hex_digits, s[n])) == NULL)
+			return UCD_INVALID_CODEPOINT;
+		c = c * 16 + (codepoint_t)(digit - hex_digits);
+	}
+	if (n != (c > 0xFFFF ? 5 : 4))
+		return UCD_INVALID_CODEPOINT;
+	return c;
+}
+
+codepoint_t ucd_lookup_name(const char *name)
+{
+	char buffer[UCD_MAX_NAME_LENGTH + 1];
+	const codepoint_t *range;
+	uint32_t h1 = 0x811C9DC5, h2 = 0, x;
+	uint16_t index;
+	codepoint_t c;
+	size_t i, n;
+
+	if (strncmp(name, hangul_prefix, sizeof(hangul_prefix) - 1) == 0)
+		return lookup_hangul_name(name + sizeof(hangul_prefix) - 1);
+
+	for (i = 0; i < sizeof(name_prefixes) / sizeof(name_prefixes[0]); ++i)
+	{
+		n = strlen(name_prefixes[i]);
+		if (strncmp(name, name_prefixes[i], n) == 0)
+		{
+			c = parse_hex_codepoint(name + n);
+			if (c == UCD_INVALID_CODEPOINT || (range = find_prefix_range(c)) == NULL || range[2] != i)
+				return UCD_INVALID_CODEPOINT;
+			return c;
+		}
+	}
+
+	for (i = 0; name[i] != '\\0'; ++i)
+	{
+		h1 = (h1 ^ (uint8_t)name[i]) * 0x01000193;
+		h2 = h2 * 31 + (uint8_t)name[i];
+	}
+	if (i > UCD_MAX_NAME_LENGTH)
+		return UCD_INVALID_CODEPOINT;
+
+	x = h2 ^ ((uint32_t)name_hash_displacements[h1 % NAME_HASH_BUCKETS] * 0x9E3779B9);
+	x ^= x >> 16;
+	x *= 0x85EBCA6B;
+	x ^= x >> 13;
+	index = name_hash_table[x % NAME_HASH_SIZE];
+	if (index == NO_NAME)
+		return UCD_INVALID_CODEPOINT;
+
+	buffer[decode_name(index, buffer, sizeof(buffer))] = '\\0';
+	if (strcmp(buffer, name) != 0)
+		return UCD_INVALID_CODEPOINT;
+	return name_index_codepoint(index);
+}
+""")
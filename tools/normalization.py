@@ -0,0 +1,306 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+max_decomposition = 18
+
+# The Hangul syllables are decomposed and composed algorithmically.
+SBase, LBase, VBase, TBase = 0xAC00, 0x1100, 0x1161, 0x11A7
+LCount, VCount, TCount = 19, 21, 28
+NCount = VCount * TCount
+SCount = LCount * NCount
+
+def hangul_decomposition(c):
+	s = c - SBase
+	if s < 0 or s >= SCount:
+		return None
+	if (s % TCount) == 0:
+		return [LBase + s // NCount, VBase + (s % NCount) // TCount]
+	return [SBase + s - (s % TCount), TBase + (s % TCount)]
+
+# The ccc values, and the decomposition mappings in the decomposition field of
+# UnicodeData.txt (parsed as DecompositionType), where the compatibility
+# mappings have a <tag> prefix.
+combining_classes = {}
+canonical_mappings = {}
+compatibility_mappings = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'UnicodeData'):
+	for codepoint in data['CodePoint']:
+		if data['CanonicalCombiningClass'] != 0:
+			combining_classes[codepoint.codepoint] = data['CanonicalCombiningClass']
+	decomposition = data['DecompositionType']
+	if decomposition:
+		mapping = [int(c, 16) for c in decomposition.split() if not c.startswith('<')]
+		if decomposition.startswith('<'):
+			compatibility_mappings[data['CodePoint'].codepoint] = mapping
+		else:
+			canonical_mappings[data['CodePoint'].codepoint] = mapping
+
+# The NFC_QC, NFD_QC, NFKC_QC and NFKD_QC values, in ucd_normalization_form
+# order, and the codepoints excluded from composition.
+quick_check_forms = ['NFC_QC', 'NFD_QC', 'NFKC_QC', 'NFKD_QC']
+quick_check_values = { 'Y': 0, 'N': 1, 'M': 2 }
+quick_checks = {}
+composition_exclusions = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'DerivedNormalizationProps'):
+	if data['Property'] in quick_check_forms:
+		shift = 2 * quick_check_forms.index(data['Property'])
+		for codepoint in data['Range']:
+			quick_checks[codepoint.codepoint] = quick_checks.get(codepoint.codepoint, 0) | (quick_check_values[data['Value']] << shift)
+	elif data['Property'] == 'Full_Composition_Exclusion':
+		for codepoint in data['Range']:
+			composition_exclusions[codepoint.codepoint] = True
+
+def full_decomposition(c, compatibility):
+	mapping = canonical_mappings.get(c, None)
+	if compatibility and not mapping:
+		mapping = compatibility_mappings.get(c, None)
+	if not mapping:
+		mapping = hangul_decomposition(c)
+	if not mapping:
+		return [c]
+	ret = []
+	for m in mapping:
+		ret.extend(full_decomposition(m, compatibility))
+	return ret
+
+# The primary composites, grouped by the first codepoint in the pair.
+compositions = {}
+for c, mapping in canonical_mappings.items():
+	if len(mapping) == 2 and not c in composition_exclusions:
+		compositions.setdefault(mapping[0], []).append((mapping[1], c))
+
+decomposition_list = [0]
+decomposition_index = {}
+composition_list = [(0, 0)]
+composition_index = {(): 0}
+
+def add_decomposition(c, compatibility):
+	if SBase <= c < SBase + SCount:
+		return (0, 0) # decomposed algorithmically
+	mapping = tuple(full_decomposition(c, compatibility))
+	if mapping == (c,):
+		return (0, 0)
+	if len(mapping) > max_decomposition:
+		raise Exception('%06X: the decomposition has more than %d codepoints' % (c, max_decomposition))
+	if not mapping in decomposition_index:
+		decomposition_index[mapping] = len(decomposition_list)
+		decomposition_list.extend(mapping)
+	return (decomposition_index[mapping], len(mapping))
+
+def add_compositions(c):
+	pairs = tuple(sorted(compositions.get(c, [])))
+	if not pairs in composition_index:
+		composition_index[pairs] = len(composition_list)
+		composition_list.extend(pairs)
+		composition_list.append((0, 0))
+	return composition_index[pairs]
+
+# The first record is used for invalid codepoints, and for codepoints that are
+# not changed by any normalization form.
+record_list = [(0, 0, 0, 0, 0, 0, 0)]
+record_index = {record_list[0]: 0}
+
+# The records for a codepoint are stored in 256 codepoint pages. Identical
+# pages (e.g. unassigned codepoints and CJK ideographs) are only stored once.
+page_list = []
+page_index = {}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = []
+	for c in range(page, page + 256):
+		canonical, canonical_length = add_decomposition(c, False)
+		compatibility, compatibility_length = add_decomposition(c, True)
+		record = (combining_classes.get(c, 0),
+		          quick_checks.get(c, 0),
+		          canonical_length,
+		          compatibility_length,
+		          canonical,
+		          compatibility,
+		          add_compositions(c))
+		if not record in record_index:
+			record_index[record] = len(record_list)
+			record_list.append(record)
+		entries.append(record_index[record])
+	entries = tuple(entries)
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+for name, count in [('decompositions', len(decomposition_list)), ('compositions', len(composition_list)), ('records', len(record_list))]:
+	if count > 0xFFFF:
+		raise Exception('%s: %d entries do not fit in a uint16_t index' % (name, count))
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Normalization Data
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the UnicodeData.txt and
+ * DerivedNormalizationProps.txt files in the Unicode Character database by
+ * the ucd-tools/tools/normalization.py script.
+ */
+
+#include "ucd/ucd.h"
+#include "normalization.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The full decompositions, referenced by the offset and length in the\n')
+	sys.stdout.write(' * normalization records.\n')
+	sys.stdout.write(' */\n')
+	sys.stdout.write('static const codepoint_t decompositions[] =\n')
+	sys.stdout.write('{')
+	for i, c in enumerate(decomposition_list):
+		if (i % 8) == 0:
+			sys.stdout.write('\n\t/* %5d */' % i)
+		sys.stdout.write(' 0x%06X,' % c)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The (second, primary composite) pairs for each first codepoint, in second\n')
+	sys.stdout.write(' * codepoint order, and terminated by a { 0, 0 } entry.\n')
+	sys.stdout.write(' */\n')
+	sys.stdout.write('static const codepoint_t compositions[][2] =\n')
+	sys.stdout.write('{\n')
+	for i, (second, composite) in enumerate(composition_list):
+		sys.stdout.write('\t/* %4d */ { 0x%06X, 0x%06X },\n' % (i, second, composite))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const normalization_record records[] =\n')
+	sys.stdout.write('{\n')
+	for i, record in enumerate(record_list):
+		sys.stdout.write('\t/* %4d */ { %d, 0x%02X, { %d, %d }, { %d, %d }, %d },\n' % ((i,) + record))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const uint16_t record_pages[][256] =\n')
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	if len(page_list) <= 256:
+		sys.stdout.write('static const uint8_t record_index[] =\n')
+	else:
+		sys.stdout.write('static const uint16_t record_index[] =\n')
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write("""
+#define SBase 0xAC00
+#define LBase 0x1100
+#define VBase 0x1161
+#define TBase 0x11A7
+#define LCount 19
+#define VCount 21
+#define TCount 28
+#define NCount (VCount * TCount)
+#define SCount (LCount * NCount)
+
+const normalization_record *ucd_lookup_normalization(codepoint_t c)
+{
+	if (c > 0x10FFFF) return records; /* Invalid Unicode Codepoint */
+	return records + record_pages[record_index[c / 256]][c % 256];
+}
+
+ucd_quick_check ucd_lookup_quick_check(codepoint_t c, ucd_normalization_form form)
+{
+	return (ucd_quick_check)((ucd_lookup_normalization(c)->quick_check >> (form * 2)) & 3);
+}
+
+size_t ucd_decompose(codepoint_t c, ucd_normalization_form form, codepoint_t *out)
+{
+	const normalization_record *record = ucd_lookup_normalization(c);
+	int compatibility = form == UCD_NFKC || form == UCD_NFKD;
+	size_t i, n = record->decomposition_length[compatibility];
+	codepoint_t s = c - SBase;
+	if (n != 0)
+	{
+		for (i = 0; i < n; ++i)
+			out[i] = decompositions[record->decomposition[compatibility] + i];
+		return n;
+	}
+	if (s < SCount)
+	{
+		out[0] = LBase + s / NCount;
+		out[1] = VBase + (s % NCount) / TCount;
+		if ((s % TCount) == 0)
+			return 2;
+		out[2] = TBase + (s % TCount);
+		return 3;
+	}
+	out[0] = c;
+	return 1;
+}
+
+codepoint_t ucd_compose(codepoint_t a, codepoint_t b)
+{
+	const codepoint_t *pair;
+	if (a - LBase < LCount && b - VBase < VCount)
+		return SBase + ((a - LBase) * VCount + (b - VBase)) * TCount;
+	if (a - SBase < SCount && ((a - SBase) % TCount) == 0 && b - TBase - 1 < TCount - 1)
+		return a + (b - TBase);
+	for (pair = compositions[ucd_lookup_normalization(a)->composition]; pair[0] != 0; pair += 2)
+	{
+		if (pair[0] == b)
+			return pair[1];
+		if (pair[0] > b)
+			break;
+	}
+	return 0;
+}
+""")
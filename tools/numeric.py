@@ -0,0 +1,226 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+numeric_types = ['None', 'De', 'Di', 'Nu']
+
+# NOTE: The UnicodeData.txt decomposition is parsed as DecompositionType, so
+# the decimal, digit and numeric fields are parsed as DecompositionMapping,
+# NumericType and NumericValue respectively.
+def numeric_value(data):
+	if data.get('DecompositionMapping', None):
+		numeric_type = 'De'
+	elif data.get('NumericType', None):
+		numeric_type = 'Di'
+	elif data.get('NumericValue', None):
+		numeric_type = 'Nu'
+	else:
+		return None
+	value = data['NumericValue'].split('/')
+	if len(value) == 1:
+		return (numeric_type, int(value[0]), 1)
+	return (numeric_type, int(value[0]), int(value[1]))
+
+unicode_chars = {}
+decimal_digits = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'UnicodeData'):
+	value = numeric_value(data)
+	if not value:
+		continue
+	for codepoint in data['CodePoint']:
+		unicode_chars[codepoint.codepoint] = value
+		if value[0] == 'De':
+			if data['GeneralCategory'] != 'Nd':
+				raise Exception('%s: decimal digit is not Nd' % codepoint)
+			decimal_digits[codepoint.codepoint] = value[1]
+
+# The decimal digits are in contiguous runs of 10, from 0 to 9, so only the
+# zero digit of each run is needed to get the value of a decimal digit.
+decimal_zeros = []
+for c in sorted(decimal_digits.keys()):
+	if decimal_digits[c] == 0:
+		for digit in range(0, 10):
+			if decimal_digits.get(c + digit, None) != digit:
+				raise Exception('%06X: the decimal digit %d is not contiguous' % (c, digit))
+		decimal_zeros.append(c)
+if len(decimal_zeros) * 10 != len(decimal_digits):
+	raise Exception('the decimal digits are not in runs of 10')
+
+# The numeric values, ordered by numeric type then value. The first entry is
+# for the codepoints that do not have a numeric value.
+def value_key(value):
+	numeric_type, numerator, denominator = value
+	return (numeric_types.index(numeric_type), float(numerator) / denominator, numerator, denominator)
+
+value_list = [('None', 0, 1)] + sorted(set(unicode_chars.values()), key=value_key)
+value_index = dict([(value, i) for i, value in enumerate(value_list)])
+
+# The numeric value indices are stored in 256 codepoint pages. Identical pages
+# are only stored once, so all the pages where no codepoint has a numeric
+# value share the first page.
+page_list = [(0, tuple([0] * 256))]
+page_index = {page_list[0][1]: 0}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = tuple([value_index[unicode_chars[c]] if c in unicode_chars else 0 for c in range(page, page + 256)])
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
+
+def c_int64(value):
+	if value > 0x7FFFFFFF:
+		return 'INT64_C(%d)' % value
+	return '%d' % value
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Numeric_Type and Numeric_Value
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the UnicodeData.txt file in
+ * the Unicode Character database by the ucd-tools/tools/numeric.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+""")
+	for numeric_type in numeric_types:
+		sys.stdout.write("""#define %s UCD_NUMERIC_TYPE_%s
+""" % (numeric_type, numeric_type))
+	sys.stdout.write("""
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The zero digit of each run of 10 decimal (Nd) digits. */\n')
+	sys.stdout.write('static const codepoint_t decimal_zeros[] =\n')
+	sys.stdout.write('{')
+	for i, c in enumerate(decimal_zeros):
+		if (i % 8) == 0:
+			sys.stdout.write('\n\t')
+		else:
+			sys.stdout.write(' ')
+		sys.stdout.write('0x%06X,' % c)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const uint8_t numeric_types[] =\n')
+	sys.stdout.write('{')
+	for i, value in enumerate(value_list):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %3d */' % i)
+		sys.stdout.write(' %s,' % value[0])
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const int64_t numeric_values[][2] = /* numerator, denominator */\n')
+	sys.stdout.write('{\n')
+	for i, value in enumerate(value_list):
+		sys.stdout.write('\t/* %3d */ { %s, %d },\n' % (i, c_int64(value[1]), value[2]))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s numeric_pages[][256] =\n' % c_type(len(value_list)))
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		if i == 0:
+			sys.stdout.write('\t{ /* %d : None */' % i)
+		else:
+			sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s numeric_index[] =\n' % c_type(len(page_list)))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write("""
+ucd_numeric_type ucd_lookup_numeric_type(codepoint_t c)
+{
+	if (c > 0x10FFFF) return None; /* Invalid Unicode Codepoint */
+	return (ucd_numeric_type)numeric_types[numeric_pages[numeric_index[c / 256]][c % 256]];
+}
+
+ucd_numeric_type ucd_lookup_numeric_value(codepoint_t c, int64_t *numerator, int64_t *denominator)
+{
+	unsigned int value = c > 0x10FFFF ? 0 : numeric_pages[numeric_index[c / 256]][c % 256];
+	*numerator = numeric_values[value][0];
+	*denominator = numeric_values[value][1];
+	return (ucd_numeric_type)numeric_types[value];
+}
+
+int ucd_digit_value(codepoint_t c)
+{
+	size_t first = 0;
+	size_t last = sizeof(decimal_zeros) / sizeof(decimal_zeros[0]);
+	if (c - '0' < 10)
+		return (int)(c - '0');
+	/* Find the last run of decimal digits starting at or before c. */
+	while (last - first > 1)
+	{
+		size_t mid = (first + last) / 2;
+		if (decimal_zeros[mid] <= c)
+			first = mid;
+		else
+			last = mid;
+	}
+	if (c - decimal_zeros[first] < 10)
+		return (int)(c - decimal_zeros[first]);
+	return -1;
+}
+""")
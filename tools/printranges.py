@@ -0,0 +1,105 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+
+# Print the ranges of codepoints that have the same property value, from
+# U+0000 to U+10FFFF, in the "0000..001F;value" format of the UCD data files.
+# This is derived from the UCD data files independently of the generated
+# tables, so is used as the expected output of the tests that print the
+# property values returned by the library.
+#
+# Usage: printranges.py UCD_ROOTDIR PROPERTY...
+#
+# where PROPERTY is ea (East_Asian_Width), blk (Block), age (Age), scx
+# (Script_Extensions), or a binary property in PropList.txt or
+# DerivedCoreProperties.txt.
+
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+
+MAX_CODEPOINTS = 0x110000
+
+def loose_name(name):
+	return name.lower().replace(' ', '').replace('-', '').replace('_', '')
+
+def set_values(values, data, key, mapping=lambda x: x):
+	for entry in data:
+		for codepoint in entry['Range']:
+			values[codepoint.codepoint] = mapping(entry[key])
+	return values
+
+def east_asian_width():
+	values = ['N'] * MAX_CODEPOINTS
+	# The unlisted CJK ideograph codepoints are Wide, as described in the
+	# comments at the start of EastAsianWidth.txt.
+	for first, last in [(0x3400, 0x4DBF), (0x4E00, 0x9FFF), (0xF900, 0xFAFF), (0x20000, 0x2FFFD), (0x30000, 0x3FFFD)]:
+		values[first:last + 1] = ['W'] * (last - first + 1)
+	return set_values(values, ucd.parse_ucd_data(ucd_rootdir, 'EastAsianWidth'), 'Value')
+
+def block():
+	aliases = ucd.parse_property_mapping(ucd_rootdir, 'blk')
+	loose_aliases = dict([(loose_name(name), alias) for alias, name in aliases.items()])
+	values = ['NB'] * MAX_CODEPOINTS
+	return set_values(values, ucd.parse_ucd_data(ucd_rootdir, 'Blocks'), 'Name', lambda x: loose_aliases[loose_name(x)])
+
+def age():
+	values = ['NA'] * MAX_CODEPOINTS
+	return set_values(values, ucd.parse_ucd_data(ucd_rootdir, 'DerivedAge'), 'Age')
+
+def script_extensions():
+	# The Script_Extensions of the unlisted codepoints is their Script.
+	values = ['Zzzz'] * MAX_CODEPOINTS
+	set_values(values, ucd.parse_ucd_data(ucd_rootdir, 'Scripts'), 'Script')
+	return set_values(values, ucd.parse_ucd_data(ucd_rootdir, 'ScriptExtensions'), 'Scripts')
+
+def binary_property(name):
+	values = [None] * MAX_CODEPOINTS
+	for dataset in ['PropList', 'DerivedCoreProperties']:
+		for entry in ucd.parse_ucd_data(ucd_rootdir, dataset):
+			if entry['Property'] == name:
+				for codepoint in entry['Range']:
+					values[codepoint.codepoint] = name
+	return values
+
+def print_ranges(values):
+	first = 0
+	for c in range(1, MAX_CODEPOINTS + 1):
+		if c < MAX_CODEPOINTS and values[c] == values[first]:
+			continue
+		if values[first] is not None:
+			if first == c - 1:
+				print('%04X;%s' % (first, values[first]))
+			else:
+				print('%04X..%04X;%s' % (first, c - 1, values[first]))
+		first = c
+
+properties = {
+	'ea': east_asian_width,
+	'blk': block,
+	'age': age,
+	'scx': script_extensions,
+}
+
+for name in sys.argv[2:]:
+	if name in properties:
+		print_ranges(properties[name]())
+	else:
+		print_ranges(binary_property(name))
@@ -0,0 +1,149 @@
+#!/usr/bin/python
+
+# Copyright (C) 2017-2018, 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+emoji_rootdir = 'data/emoji'
+
+properties = ucd.parse_properties(ucd_rootdir, emoji_rootdir)
+
+# There are only a small number of distinct property sets, so the property
+# masks are stored in a palette and indexed by 256 codepoint pages. Identical
+# pages (e.g. unassigned codepoints and CJK ideographs) are only stored once.
+mask_list = [0]
+mask_index = {0: 0}
+page_list = []
+page_index = {}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = []
+	for codepoint in ucd.CodeRange('%06X..%06X' % (page, page + 255)):
+		mask = properties.get(codepoint, 0)
+		if not mask in mask_index:
+			mask_index[mask] = len(mask_list)
+			mask_list.append(mask)
+		entries.append(mask_index[mask])
+	entries = tuple(entries)
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
+
+def property_string(mask):
+	props = [name for i, name in enumerate(ucd.properties) if mask & (2 ** i)]
+	return ' '.join(props)
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* PropList APIs.
+ *
+ * Copyright (C) 2017-2018, 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the PropList.txt,
+ * DerivedCoreProperties.txt and emoji-data.txt files in the Unicode Character
+ * database by the ucd-tools/tools/proplist.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const ucd_property property_masks[] =\n')
+	sys.stdout.write('{\n')
+	for i, mask in enumerate(mask_list):
+		if mask == 0:
+			sys.stdout.write('\t/* %2d */ 0x%016xull,\n' % (i, mask))
+		else:
+			sys.stdout.write('\t/* %2d */ 0x%016xull, /* %s */\n' % (i, mask, property_string(mask)))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s property_pages[][256] =\n' % c_type(len(mask_list)))
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s property_index[] =\n' % c_type(len(page_list)))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write("""
+static ucd_property lookup_properties(codepoint_t c)
+{
+	if (c > 0x10FFFF) return 0; /* Invalid Unicode Codepoint */
+	return property_masks[property_pages[property_index[c / 256]][c % 256]];
+}
+
+ucd_property ucd_lookup_properties(codepoint_t c)
+{
+	return lookup_properties(c);
+}
+
+void ucd_lookup_properties_n(const codepoint_t *in, size_t n, ucd_property *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = lookup_properties(in[i]);
+}
+
+ucd_property ucd_properties(codepoint_t c, ucd_category category)
+{
+	(void)category;
+	return lookup_properties(c);
+}
+""")
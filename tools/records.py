@@ -0,0 +1,225 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+emoji_rootdir = 'data/emoji'
+
+null = ucd.CodePoint('0000')
+
+categories = {}
+case_deltas = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'UnicodeData'):
+	for codepoint in data['CodePoint']:
+		categories[codepoint] = data['GeneralCategory']
+	if data['LowerCase'] != null or data['UpperCase'] != null or data['TitleCase'] != null:
+		codepoint = data['CodePoint']
+		deltas = []
+		for case in ['UpperCase', 'LowerCase', 'TitleCase']:
+			if data[case] == null:
+				deltas.append(0)
+			else:
+				deltas.append(data[case].codepoint - codepoint.codepoint)
+		case_deltas[codepoint] = tuple(deltas)
+
+scripts = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'Scripts'):
+	for codepoint in data['Range']:
+		scripts[codepoint] = data['Script']
+
+if '--with-csur' in sys.argv:
+	for csur in ['Klingon']:
+		for data in ucd.parse_ucd_data('data/csur', csur):
+			for codepoint in data['CodePoint']:
+				categories[codepoint] = data['GeneralCategory']
+				scripts[codepoint] = data['Script']
+
+properties = ucd.parse_properties(ucd_rootdir, emoji_rootdir)
+
+script_names = ucd.parse_property_mapping(ucd_rootdir, 'sc')
+
+# The first record is used for invalid codepoints, and the first case delta is
+# used for codepoints that do not have a case mapping.
+record_list = [(0, 'Ii', 'Zzzz', 0)]
+record_index = {}
+case_list = [(0, 0, 0)]
+case_index = {(0, 0, 0): 0}
+
+# The records for a codepoint are stored in 256 codepoint pages. Identical
+# pages (e.g. unassigned codepoints and CJK ideographs) are only stored once.
+page_list = []
+page_index = {}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = []
+	for codepoint in ucd.CodeRange('%06X..%06X' % (page, page + 255)):
+		deltas = case_deltas.get(codepoint, (0, 0, 0))
+		if not deltas in case_index:
+			case_index[deltas] = len(case_list)
+			case_list.append(deltas)
+		record = (properties.get(codepoint, 0),
+		          categories.get(codepoint, 'Cn'),
+		          scripts.get(codepoint, 'Zzzz'),
+		          case_index[deltas])
+		if not record in record_index:
+			record_index[record] = len(record_list)
+			record_list.append(record)
+		entries.append(record_index[record])
+	entries = tuple(entries)
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Character Records
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the UnicodeData.txt,
+ * Scripts.txt, PropList.txt, DerivedCoreProperties.txt and emoji-data.txt
+ * files in the Unicode Character database by the ucd-tools/tools/records.py
+ * script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+#define Cc UCD_CATEGORY_Cc
+#define Cf UCD_CATEGORY_Cf
+#define Cn UCD_CATEGORY_Cn
+#define Co UCD_CATEGORY_Co
+#define Cs UCD_CATEGORY_Cs
+#define Ll UCD_CATEGORY_Ll
+#define Lm UCD_CATEGORY_Lm
+#define Lo UCD_CATEGORY_Lo
+#define Lt UCD_CATEGORY_Lt
+#define Lu UCD_CATEGORY_Lu
+#define Mc UCD_CATEGORY_Mc
+#define Me UCD_CATEGORY_Me
+#define Mn UCD_CATEGORY_Mn
+#define Nd UCD_CATEGORY_Nd
+#define Nl UCD_CATEGORY_Nl
+#define No UCD_CATEGORY_No
+#define Pc UCD_CATEGORY_Pc
+#define Pd UCD_CATEGORY_Pd
+#define Pe UCD_CATEGORY_Pe
+#define Pf UCD_CATEGORY_Pf
+#define Pi UCD_CATEGORY_Pi
+#define Po UCD_CATEGORY_Po
+#define Ps UCD_CATEGORY_Ps
+#define Sc UCD_CATEGORY_Sc
+#define Sk UCD_CATEGORY_Sk
+#define Sm UCD_CATEGORY_Sm
+#define So UCD_CATEGORY_So
+#define Zl UCD_CATEGORY_Zl
+#define Zp UCD_CATEGORY_Zp
+#define Zs UCD_CATEGORY_Zs
+#define Ii UCD_CATEGORY_Ii
+
+""")
+	for script in sorted(script_names.keys()):
+		sys.stdout.write("""#define %s UCD_SCRIPT_%s
+""" % (script, script))
+	sys.stdout.write("""
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const int32_t case_deltas[][3] = /* upper, lower, title */\n')
+	sys.stdout.write('{\n')
+	for i, (upper, lower, title) in enumerate(case_list):
+		sys.stdout.write('\t/* %3d */ { %d, %d, %d },\n' % (i, upper, lower, title))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const ucd_record records[] =\n')
+	sys.stdout.write('{\n')
+	for i, (props, category, script, casing) in enumerate(record_list):
+		sys.stdout.write('\t/* %4d */ { 0x%016xull, %s, %s, %d },\n' % (i, props, category, script, casing))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const uint16_t record_pages[][256] =\n')
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	if len(page_list) <= 256:
+		sys.stdout.write('static const uint8_t record_index[] =\n')
+	else:
+		sys.stdout.write('static const uint16_t record_index[] =\n')
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write("""
+const ucd_record *ucd_lookup_record(codepoint_t c)
+{
+	if (c > 0x10FFFF) return records; /* Invalid Unicode Codepoint */
+	return records + record_pages[record_index[c / 256]][c % 256];
+}
+
+codepoint_t ucd_record_toupper(const ucd_record *r, codepoint_t c)
+{
+	return (codepoint_t)(c + case_deltas[r->casing][0]);
+}
+
+codepoint_t ucd_record_tolower(const ucd_record *r, codepoint_t c)
+{
+	return (codepoint_t)(c + case_deltas[r->casing][1]);
+}
+
+codepoint_t ucd_record_totitle(const ucd_record *r, codepoint_t c)
+{
+	return (codepoint_t)(c + case_deltas[r->casing][2]);
+}
+""")
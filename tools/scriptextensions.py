@@ -0,0 +1,167 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+max_script_extensions = 32
+
+# The Script_Extensions sets, where the first (empty) set is used for the
+# codepoints not listed in ScriptExtensions.txt, whose Script_Extensions is
+# their Script value.
+set_list = [()]
+set_index = {(): 0}
+script_extensions = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'ScriptExtensions'):
+	scripts = tuple(sorted(data['Scripts'].split()))
+	if len(scripts) > max_script_extensions:
+		raise Exception('%s: the Script_Extensions has more than %d scripts' % (data['Range'], max_script_extensions))
+	if not scripts in set_index:
+		set_index[scripts] = len(set_list)
+		set_list.append(scripts)
+	for codepoint in data['Range']:
+		script_extensions[codepoint.codepoint] = set_index[scripts]
+
+# The offset of each set in the script_extension_data array.
+set_offsets = []
+offset = 0
+for scripts in set_list:
+	set_offsets.append(offset)
+	offset += len(scripts)
+
+# The set indices are stored in 256 codepoint pages. Identical pages are only
+# stored once, so all the pages where no codepoint is listed in the data file
+# share the first page.
+page_list = [(0, tuple([0] * 256))]
+page_index = {page_list[0][1]: 0}
+pages = []
+for page in range(0, 0x110000, 256):
+	entries = tuple([script_extensions.get(c, 0) for c in range(page, page + 256)])
+	if not entries in page_index:
+		page_index[entries] = len(page_list)
+		page_list.append((page, entries))
+	pages.append(page_index[entries])
+
+def c_type(count):
+	if count <= 256:
+		return 'uint8_t'
+	return 'uint16_t'
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Script Extensions
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the ScriptExtensions.txt
+ * file in the Unicode Character database by the
+ * ucd-tools/tools/scriptextensions.py script.
+ */
+
+#include "ucd/ucd.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The scripts in each Script_Extensions set, in script order. */\n')
+	sys.stdout.write('static const uint8_t script_extension_data[] =\n')
+	sys.stdout.write('{\n')
+	for i, scripts in enumerate(set_list):
+		if len(scripts) == 0:
+			continue
+		sys.stdout.write('\t/* %3d */' % set_offsets[i])
+		for script in scripts:
+			sys.stdout.write(' UCD_SCRIPT_%s,' % script)
+		sys.stdout.write('\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The (offset, count) of each Script_Extensions set in script_extension_data. */\n')
+	sys.stdout.write('static const uint16_t script_extension_sets[][2] =\n')
+	sys.stdout.write('{\n')
+	for i, scripts in enumerate(set_list):
+		sys.stdout.write('\t/* %3d */ { %d, %d },\n' % (i, set_offsets[i], len(scripts)))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s script_extension_pages[][256] =\n' % c_type(len(set_list)))
+	sys.stdout.write('{\n')
+	for i, (page, entries) in enumerate(page_list):
+		if i == 0:
+			sys.stdout.write('\t{ /* %d : scx=sc */' % i)
+		else:
+			sys.stdout.write('\t{ /* %d : %06X */' % (i, page))
+		for j, entry in enumerate(entries):
+			if (j % 16) == 0:
+				sys.stdout.write('\n\t\t/* %02X */' % j)
+			sys.stdout.write(' %d,' % entry)
+		sys.stdout.write('\n\t},\n')
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const %s script_extension_index[] =\n' % c_type(len(page_list)))
+	sys.stdout.write('{')
+	for i, page in enumerate(pages):
+		if (i % 16) == 0:
+			sys.stdout.write('\n\t/* %06X */' % (i * 256))
+		sys.stdout.write(' %d,' % page)
+	sys.stdout.write('\n};\n')
+
+	sys.stdout.write("""
+size_t ucd_lookup_script_extensions(codepoint_t c, uint8_t *out, size_t outlen)
+{
+	const uint16_t *set;
+	size_t i;
+	if (c > 0x10FFFF) /* Invalid Unicode Codepoint */
+		set = script_extension_sets[0];
+	else
+		set = script_extension_sets[script_extension_pages[script_extension_index[c / 256]][c % 256]];
+	if (set[1] == 0)
+	{
+		if (outlen > 0)
+			out[0] = (uint8_t)ucd_lookup_script(c);
+		return 1;
+	}
+	for (i = 0; i < set[1] && i < outlen; ++i)
+		out[i] = script_extension_data[set[0] + i];
+	return set[1];
+}
+""")
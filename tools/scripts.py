@@ -164,7 +164,7 @@ if __name__ == '__main__':
 			sys.stdout.write('};\n')
 
 	sys.stdout.write('\n')
-	sys.stdout.write('ucd_script ucd_lookup_script(codepoint_t c)\n')
+	sys.stdout.write('static ucd_script lookup_script(codepoint_t c)\n')
 	sys.stdout.write('{\n')
 	for codepoints, script, comment in script_sets:
 		if script:
@@ -177,3 +177,17 @@ if __name__ == '__main__':
 			sys.stdout.write('\t}\n')
 	sys.stdout.write('\treturn Zzzz; /* Invalid Unicode Codepoint */\n')
 	sys.stdout.write('}\n')
+
+	sys.stdout.write("""
+ucd_script ucd_lookup_script(codepoint_t c)
+{
+	return lookup_script(c);
+}
+
+void ucd_lookup_script_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint8_t)lookup_script(in[i]);
+}
+""")
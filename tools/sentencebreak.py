@@ -0,0 +1,154 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import ucd
+import breakrules
+
+from breakrules import CONTINUE, BREAK, MARK, BREAK_AT_MARK
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+# The Sentence_Break values in ucd_sentence_break order.
+break_classes = ['XX', 'AT', 'CL', 'CR', 'EX', 'FO', 'LE', 'LF', 'LO', 'NU', 'SC', 'SE', 'SP', 'ST', 'UP']
+
+sb_names = ucd.parse_property_mapping(ucd_rootdir, 'SB', reverse=True)
+
+sentence_break = {}
+for data in ucd.parse_ucd_data(os.path.join(ucd_rootdir, 'auxiliary'), 'SentenceBreakProperty'):
+	value = break_classes.index(sb_names[data['Value']])
+	for codepoint in data['Range']:
+		sentence_break[codepoint] = value
+
+page_list, pages = breakrules.break_pages(sentence_break)
+
+# The rule states are:
+#     ('sot',)                         -- the start of the text;
+#     ('para', cls)                    -- after a ParaSep (CR, LF or Sep) codepoint;
+#     ('text', cls)                    -- after an Upper, Lower or other codepoint;
+#     ('term', cls, upper_lower, part) -- after an SATerm (ATerm or STerm) Close* Sp*
+#                                         sequence, where upper_lower is set if the
+#                                         ATerm follows an Upper or Lower codepoint
+#                                         (SB7), and part is the term, Close or Sp
+#                                         part of the sequence the codepoint is in;
+#     ('pending',)                     -- after an ATerm Close* Sp* sequence and a
+#                                         marked codepoint, waiting for a Lower
+#                                         codepoint to continue the sentence (SB8).
+ParaSep = ['SE', 'CR', 'LF']
+SATerm = ['AT', 'ST']
+
+def sentence_start(state, cls):
+	if cls in ParaSep:
+		return ('para', cls)
+	if cls in SATerm:
+		return ('term', cls, cls == 'AT' and state in [('text', 'UP'), ('text', 'LO')], 'term')
+	if cls in ['UP', 'LO']:
+		return ('text', cls)
+	return ('text', 'XX')
+
+start = ('sot',)
+
+def transition(state, cls):
+	if state[0] == 'pending':
+		if cls == 'LO': return CONTINUE, sentence_start(state, cls) # SB8
+		if cls in ['LE', 'UP'] + ParaSep + SATerm: return BREAK_AT_MARK, start # SB11
+		return CONTINUE, state # SB8
+	if state[0] == 'sot': return BREAK, sentence_start(state, cls) # SB1
+	if state == ('para', 'CR') and cls == 'LF': return CONTINUE, sentence_start(state, cls) # SB3
+	if state[0] == 'para': return BREAK, sentence_start(state, cls) # SB4
+	if cls in ['EX', 'FO']: return CONTINUE, state # SB5
+	if state[0] == 'term':
+		term, upper_lower, part = state[1:]
+		if term == 'AT' and part == 'term' and cls == 'NU': return CONTINUE, sentence_start(state, cls) # SB6
+		if upper_lower and part == 'term' and cls == 'UP': return CONTINUE, sentence_start(state, cls) # SB7
+		if term == 'AT' and cls == 'LO': return CONTINUE, sentence_start(state, cls) # SB8
+		if cls in ['SC'] + SATerm: return CONTINUE, sentence_start(state, cls) # SB8a
+		if part != 'sp' and cls == 'CL': return CONTINUE, ('term', term, upper_lower, 'close') # SB9
+		if cls == 'SP': return CONTINUE, ('term', term, upper_lower, 'sp') # SB9, SB10
+		if cls in ParaSep: return CONTINUE, sentence_start(state, cls) # SB9, SB10
+		if term == 'AT' and cls not in ['LE', 'UP']: return MARK, ('pending',) # SB8
+		return BREAK, sentence_start(state, cls) # SB11
+	return CONTINUE, sentence_start(state, cls) # SB998
+
+def is_pending(state):
+	return state[0] == 'pending'
+
+transitions, pending = breakrules.compile_states(start, break_classes, transition, is_pending)
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Sentence Break
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the SentenceBreakProperty.txt
+ * file in the Unicode Character database by the ucd-tools/tools/sentencebreak.py
+ * script.
+ */
+
+#include "ucd/ucd.h"
+#include "utf8.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	breakrules.write_pages('sentence_break', page_list, pages)
+	breakrules.write_actions(pending)
+	breakrules.write_states('sentence_break', break_classes, transitions)
+
+	sys.stdout.write("""
+static int lookup_break_class(codepoint_t c)
+{
+	if (c > 0x10FFFF) return UCD_SENTENCE_BREAK_XX; /* Invalid Unicode Codepoint */
+	return sentence_break_pages[sentence_break_index[c / 256]][c % 256];
+}
+
+ucd_sentence_break ucd_lookup_sentence_break(codepoint_t c)
+{
+	return (ucd_sentence_break)lookup_break_class(c);
+}
+
+void ucd_lookup_sentence_break_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint8_t)lookup_break_class(in[i]);
+}
+""")
+
+	breakrules.write_iterators('sentence_break', 'sentence')
@@ -0,0 +1,110 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import ucd
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+
+# The maximum number of codepoints in a full case mapping. This is the
+# UCD_MAX_FULL_CASE_MAPPING value in ucd.h.
+max_mapping = 3
+
+# The unconditional (language and context independent) full case mappings.
+# The conditional mappings require knowledge of the language or surrounding
+# text, so are not supported.
+special_casing = {}
+for data in ucd.parse_ucd_data(ucd_rootdir, 'SpecialCasing'):
+	if data['Conditions']:
+		continue
+	for case in ['LowerCase', 'TitleCase', 'UpperCase']:
+		if len(data[case]) > max_mapping:
+			raise Exception('%s: %s has more than %d codepoints' % (data['CodePoint'], case, max_mapping))
+		for c in data[case]:
+			if c.codepoint > 0xFFFF:
+				raise Exception('%s: %s is not in the BMP' % (data['CodePoint'], case))
+	special_casing[data['CodePoint']] = data
+
+def mapping_string(mapping):
+	return '{ %s }' % ', '.join(['0x%04X' % c.codepoint for c in mapping] + ['0'] * (max_mapping - len(mapping)))
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Special Casing
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the SpecialCasing.txt file
+ * in the Unicode Character database by the ucd-tools/tools/specialcasing.py
+ * script.
+ */
+
+#include "ucd/ucd.h"
+#include "specialcasing.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('static const special_casing_entry special_casing[] = /* codepoint, lower, title, upper */\n')
+	sys.stdout.write('{\n')
+	for codepoint in sorted(special_casing.keys()):
+		data = special_casing[codepoint]
+		sys.stdout.write('\t{ 0x%04X, %s, %s, %s },\n' % (codepoint.codepoint,
+			mapping_string(data['LowerCase']),
+			mapping_string(data['TitleCase']),
+			mapping_string(data['UpperCase'])))
+	sys.stdout.write('};\n')
+
+	sys.stdout.write('\n')
+	sys.stdout.write('const special_casing_entry *ucd_lookup_special_casing(codepoint_t c)\n')
+	sys.stdout.write('{\n')
+	sys.stdout.write('\tsize_t begin = 0;\n')
+	sys.stdout.write('\tsize_t end = sizeof(special_casing)/sizeof(special_casing[0]);\n')
+	sys.stdout.write('\twhile (begin < end)\n')
+	sys.stdout.write('\t{\n')
+	sys.stdout.write('\t\tsize_t pos = (begin + end) / 2;\n')
+	sys.stdout.write('\t\tif (c < special_casing[pos].codepoint)\n')
+	sys.stdout.write('\t\t\tend = pos;\n')
+	sys.stdout.write('\t\telse if (c > special_casing[pos].codepoint)\n')
+	sys.stdout.write('\t\t\tbegin = pos + 1;\n')
+	sys.stdout.write('\t\telse\n')
+	sys.stdout.write('\t\t\treturn &special_casing[pos];\n')
+	sys.stdout.write('\t}\n')
+	sys.stdout.write('\treturn NULL;\n')
+	sys.stdout.write('}\n')
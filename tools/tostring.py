@@ -20,6 +20,7 @@
 import os
 import sys
 import ucd
+import blocks
 
 ucd_rootdir = sys.argv[1]
 ucd_version = sys.argv[2]
@@ -118,4 +119,20 @@ const char *ucd_get_script_string(ucd_script s)
 		return "----";
 	return scripts[(unsigned int)s];
 }
+
+const char *ucd_get_block_string(ucd_block b)
+{
+	static const char *blocks[] =
+	{
+""")
+	for (alias, name) in blocks.blocks:
+		sys.stdout.write("""		"%s",
+""" % alias)
+	sys.stdout.write("""
+	};
+
+	if ((unsigned int)b >= (sizeof(blocks)/sizeof(blocks[0])))
+		return "--";
+	return blocks[(unsigned int)b];
+}
 """)
@@ -84,11 +84,19 @@ def codepoint(x):
 		return CodePoint('0000'), x[1:]
 	return CodePoint(x[0]), x[1:]
 
+def codepoints(x):
+	return [CodePoint(c) for c in x[0].split()], x[1:]
+
 def string(x):
 	if x[0] == '':
 		return None, x[1:]
 	return x[0], x[1:]
 
+def optional_string(x):
+	if len(x) == 0:
+		return None, x
+	return string(x)
+
 def integer(x):
 	return int(x[0]), x[1:]
 
@@ -109,24 +117,55 @@ data_items = {
 		('Range', codepoint),
 		('Property', string)
 	],
+	'BidiBrackets': [
+		('CodePoint', codepoint),
+		('PairedBracket', codepoint),
+		('Type', string),
+	],
 	'Blocks': [
 		('Range', codepoint),
 		('Name', string)
 	],
+	'CaseFolding': [
+		('CodePoint', codepoint),
+		('Status', string),
+		('Mapping', codepoints),
+	],
 	'DerivedAge': [
 		('Range', codepoint),
 		('Age', string),
 	],
+	'DerivedBidiClass': [
+		('Range', codepoint),
+		('Value', string),
+	],
 	'DerivedCoreProperties': [
 		('Range', codepoint),
 		('Property', string),
 	],
+	'DerivedNormalizationProps': [
+		('Range', codepoint),
+		('Property', string),
+		('Value', optional_string),
+	],
+	'EastAsianWidth': [
+		('Range', codepoint),
+		('Value', string),
+	],
 	'ExtraPropertyValues': [
 		('Property', string),
 		('Key', string),
 		('Value', string),
 		('Aliases', strlist),
 	],
+	'GraphemeBreakProperty': [
+		('Range', codepoint),
+		('Value', string),
+	],
+	'LineBreak': [
+		('Range', codepoint),
+		('Value', string),
+	],
 	'PropList': [
 		('Range', codepoint),
 		('Property', string),
@@ -141,6 +180,21 @@ data_items = {
 		('Range', codepoint),
 		('Script', script),
 	],
+	'ScriptExtensions': [
+		('Range', codepoint),
+		('Scripts', string),
+	],
+	'SentenceBreakProperty': [
+		('Range', codepoint),
+		('Value', string),
+	],
+	'SpecialCasing': [
+		('CodePoint', codepoint),
+		('LowerCase', codepoints),
+		('TitleCase', codepoints),
+		('UpperCase', codepoints),
+		('Conditions', string),
+	],
 	'UnicodeData': [
 		('CodePoint', codepoint),
 		('Name', string),
@@ -158,6 +212,10 @@ data_items = {
 		('LowerCase', codepoint),
 		('TitleCase', codepoint),
 	],
+	'WordBreakProperty': [
+		('Range', codepoint),
+		('Value', string),
+	],
 	# ConScript Unicode Registry Data:
 	'Klingon': [
 		('CodePoint', codepoint),
@@ -168,6 +226,63 @@ data_items = {
 	],
 }
 
+# The PropList and emoji-data properties in ucd_property bit order.
+properties = [
+	'White_Space',
+	'Bidi_Control',
+	'Join_Control',
+	'Dash',
+	'Hyphen',
+	'Quotation_Mark',
+	'Terminal_Punctuation',
+	'Other_Math',
+	'Hex_Digit',
+	'ASCII_Hex_Digit',
+	'Other_Alphabetic',
+	'Ideographic',
+	'Diacritic',
+	'Extender',
+	'Other_Lowercase',
+	'Other_Uppercase',
+	'Noncharacter_Code_Point',
+	'Other_Grapheme_Extend',
+	'IDS_Binary_Operator',
+	'IDS_Trinary_Operator',
+	'Radical',
+	'Unified_Ideograph',
+	'Other_Default_Ignorable_Code_Point',
+	'Deprecated',
+	'Soft_Dotted',
+	'Logical_Order_Exception',
+	'Other_ID_Start',
+	'Other_ID_Continue',
+	'Sentence_Terminal',
+	'Variation_Selector',
+	'Pattern_White_Space',
+	'Pattern_Syntax',
+	'Prepended_Concatenation_Mark',
+	'Emoji', # emoji-data
+	'Emoji_Presentation', # emoji-data
+	'Emoji_Modifier', # emoji-data
+	'Emoji_Modifier_Base', # emoji-data
+	'Regional_Indicator', # PropList 10.0.0
+	'Emoji_Component', # emoji-data 5.0
+	'Extended_Pictographic', # emoji-data 11.0
+	'XID_Start', # DerivedCoreProperties
+	'XID_Continue', # DerivedCoreProperties
+]
+
+def parse_properties(ucd_rootdir, emoji_rootdir):
+	props = {}
+	for propdir, propfile in [(ucd_rootdir, 'PropList'), (ucd_rootdir, 'DerivedCoreProperties'), (emoji_rootdir, 'emoji-data')]:
+		for data in parse_ucd_data(propdir, propfile):
+			if not data['Property'] in properties:
+				continue
+			bit = 2 ** properties.index(data['Property'])
+			for codepoint in data['Range']:
+				props[codepoint] = props.get(codepoint, 0) | bit
+	return props
+
 def parse_ucd_data(ucd_rootdir, dataset):
 	keys  = data_items[dataset]
 	first = None
@@ -0,0 +1,186 @@
+#!/usr/bin/python
+
+# Copyright (C) 2026 Reece H. Dunn
+#
+# This file is part of ucd-tools.
+#
+# ucd-tools is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# ucd-tools is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+
+import os
+import sys
+import ucd
+import breakrules
+
+from breakrules import CONTINUE, BREAK, MARK, BREAK_AT_MARK
+
+ucd_rootdir = sys.argv[1]
+ucd_version = sys.argv[2]
+emoji_rootdir = 'data/emoji'
+
+# The Word_Break values in ucd_word_break order. The Extended_Pictographic
+# characters (which have the Other or ALetter value) are given their own break
+# classes, as they are used in the emoji ZWJ sequence rule (WB3c).
+wb_values = ['XX', 'CR', 'DQ', 'EX', 'Extend', 'FO', 'HL', 'KA', 'LE', 'LF', 'MB', 'ML', 'MN', 'NL', 'NU', 'RI', 'SQ', 'WSegSpace', 'ZWJ']
+break_classes = wb_values + ['ExtPict', 'ExtPict_LE']
+
+wb_names = ucd.parse_property_mapping(ucd_rootdir, 'WB', reverse=True)
+
+word_break = {}
+for data in ucd.parse_ucd_data(os.path.join(ucd_rootdir, 'auxiliary'), 'WordBreakProperty'):
+	value = break_classes.index(wb_names[data['Value']])
+	for codepoint in data['Range']:
+		word_break[codepoint] = value
+
+for data in ucd.parse_ucd_data(emoji_rootdir, 'emoji-data'):
+	if data['Property'] == 'Extended_Pictographic':
+		for codepoint in data['Range']:
+			value = break_classes[word_break.get(codepoint, 0)]
+			if not value in ['XX', 'LE']:
+				raise Exception('%s: Extended_Pictographic codepoint does not have the Other or ALetter value' % codepoint)
+			word_break[codepoint] = break_classes.index({'XX': 'ExtPict', 'LE': 'ExtPict_LE'}[value])
+
+page_list, pages = breakrules.break_pages(word_break)
+
+# The rule state is a (previous, raw, pending) tuple, where:
+#     previous -- the break class of the previous codepoint after ignoring the
+#                 Extend, Format and ZWJ codepoints (WB4), with sot for the
+#                 start of the text, RI_pair for an even number of regional
+#                 indicators, and HL_SQ for a Hebrew_Letter Single_Quote pair;
+#     raw      -- the break class of the previous codepoint, if it is used
+#                 before WB4 is applied (ZWJ and WSegSpace);
+#     pending  -- the break classes that continue the word after a marked
+#                 MidLetter, MidNum, MidNumLet, Single_Quote or Double_Quote
+#                 codepoint (WB6, WB7b and WB12).
+AHLetter = ['LE', 'HL']
+Ignored = ['Extend', 'FO', 'ZWJ']
+Newline = ['CR', 'LF', 'NL']
+
+def word_class(cls):
+	return {'ExtPict': 'XX', 'ExtPict_LE': 'LE'}.get(cls, cls)
+
+def word_start(cls):
+	return (word_class(cls), {'ZWJ': 'ZWJ', 'WSegSpace': 'WSegSpace'}.get(cls), None)
+
+start = ('sot', None, None)
+
+def transition(state, cls):
+	previous, raw, pending = state
+	c = word_class(cls)
+	if pending:
+		if c in Ignored: return CONTINUE, state # WB4
+		if c in pending: return CONTINUE, word_start(cls) # WB7, WB7c, WB11
+		return BREAK_AT_MARK, start
+	if previous == 'sot': return BREAK, word_start(cls) # WB1
+	if previous == 'CR' and c == 'LF': return CONTINUE, word_start(cls) # WB3
+	if previous in Newline: return BREAK, word_start(cls) # WB3a
+	if c in Newline: return BREAK, word_start(cls) # WB3b
+	if raw == 'ZWJ' and cls in ['ExtPict', 'ExtPict_LE']: return CONTINUE, word_start(cls) # WB3c
+	if raw == 'WSegSpace' and c == 'WSegSpace': return CONTINUE, word_start(cls) # WB3d
+	if c in Ignored: return CONTINUE, (previous, {'ZWJ': 'ZWJ'}.get(c), None) # WB4
+	if previous in AHLetter and c in AHLetter: return CONTINUE, word_start(cls) # WB5
+	if previous == 'HL' and c == 'SQ': return CONTINUE, ('HL_SQ', None, None) # WB7a
+	if previous in AHLetter and c in ['ML', 'MB', 'SQ']: return MARK, ('mid', None, tuple(AHLetter)) # WB6
+	if previous == 'HL_SQ' and c in AHLetter: return CONTINUE, word_start(cls) # WB7
+	if previous == 'HL' and c == 'DQ': return MARK, ('mid', None, ('HL',)) # WB7b
+	if previous == 'NU' and c == 'NU': return CONTINUE, word_start(cls) # WB8
+	if previous in AHLetter and c == 'NU': return CONTINUE, word_start(cls) # WB9
+	if previous == 'NU' and c in AHLetter: return CONTINUE, word_start(cls) # WB10
+	if previous == 'NU' and c in ['MN', 'MB', 'SQ']: return MARK, ('mid', None, ('NU',)) # WB12
+	if previous == 'KA' and c == 'KA': return CONTINUE, word_start(cls) # WB13
+	if previous in AHLetter + ['NU', 'KA', 'EX'] and c == 'EX': return CONTINUE, word_start(cls) # WB13a
+	if previous == 'EX' and c in AHLetter + ['NU', 'KA']: return CONTINUE, word_start(cls) # WB13b
+	if previous == 'RI' and c == 'RI': return CONTINUE, ('RI_pair', None, None) # WB15, WB16
+	return BREAK, word_start(cls) # WB999
+
+def is_pending(state):
+	return state[2] is not None
+
+transitions, pending = breakrules.compile_states(start, break_classes, transition, is_pending)
+
+if __name__ == '__main__':
+	sys.stdout.write("""/* Unicode Word Break
+ *
+ * Copyright (C) 2026 Reece H. Dunn
+ *
+ * This file is part of ucd-tools.
+ *
+ * ucd-tools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ucd-tools is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with ucd-tools.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* NOTE: This file is automatically generated from the WordBreakProperty.txt
+ * file in the Unicode Character database, and the emoji-data.txt file in the
+ * Unicode Emoji data, by the ucd-tools/tools/wordbreak.py script.
+ */
+
+#include "ucd/ucd.h"
+#include "utf8.h"
+
+#include <stddef.h>
+
+/* Unicode Character Data %s */
+""" % ucd_version)
+
+	sys.stdout.write('\n')
+	sys.stdout.write('/* The break classes. These are the ucd_word_break values, and ExtPict classes\n')
+	sys.stdout.write(' * for the Extended_Pictographic codepoints.\n')
+	sys.stdout.write(' */\n')
+	sys.stdout.write('#define ExtPict    %d\n' % break_classes.index('ExtPict'))
+	sys.stdout.write('#define ExtPict_LE %d\n' % break_classes.index('ExtPict_LE'))
+
+	breakrules.write_pages('word_break', page_list, pages)
+	breakrules.write_actions(pending)
+	breakrules.write_states('word_break', break_classes, transitions)
+
+	sys.stdout.write("""
+static int lookup_break_class(codepoint_t c)
+{
+	if (c > 0x10FFFF) return UCD_WORD_BREAK_XX; /* Invalid Unicode Codepoint */
+	return word_break_pages[word_break_index[c / 256]][c % 256];
+}
+
+static ucd_word_break word_break(int cls)
+{
+	switch (cls)
+	{
+	case ExtPict:    return UCD_WORD_BREAK_XX;
+	case ExtPict_LE: return UCD_WORD_BREAK_LE;
+	default:         return (ucd_word_break)cls;
+	}
+}
+
+ucd_word_break ucd_lookup_word_break(codepoint_t c)
+{
+	return word_break(lookup_break_class(c));
+}
+
+void ucd_lookup_word_break_n(const codepoint_t *in, size_t n, uint8_t *out)
+{
+	size_t i;
+	for (i = 0; i < n; ++i)
+		out[i] = (uint8_t)word_break(lookup_break_class(in[i]));
+}
+""")
+
+	breakrules.write_iterators('word_break', 'word')